@@ -53,6 +53,7 @@ void lv_example_canvas_1(void)
     static uint8_t cbuf_tmp[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_WIDTH, CANVAS_HEIGHT)];
     lv_memcpy(cbuf_tmp, cbuf, sizeof(cbuf_tmp));
     lv_image_dsc_t img;
+    lv_memzero(&img, sizeof(img));
     img.data = (void *)cbuf_tmp;
     img.header.cf = LV_COLOR_FORMAT_NATIVE;
     img.header.w = CANVAS_WIDTH;
@@ -100,6 +100,17 @@
     /*The target buffer size for simple layer chunks.*/
     #define LV_DRAW_SW_LAYER_SIMPLE_BUF_SIZE          (24 * 1024)   /*[bytes]*/
 
+    /* Max. memory in bytes used to cache the rendered texts of the labels.
+     * A text drawn the second time with the same font, size and settings is rendered into an A8 coverage map,
+     * and later it's drawn with a single blend. The color and opacity can be changed without rendering it again.
+     * 0: to disable caching */
+    #define LV_DRAW_SW_TEXT_CACHE_SIZE                0
+
+    /* 1: Keep the colors of the ARGB8888 layers and the decoded PNG images premultiplied with their alpha.
+     * Blending them needs no division and scaling them doesn't bleed the color of the transparent pixels,
+     * but the opaque colors lose some precision. */
+    #define LV_DRAW_SW_PREMULTIPLIED                  0
+
     /* 0: use a simple renderer capable of drawing only simple rectangles with gradient, images, texts, and straight lines only
      * 1: use a complex renderer capable of drawing rounded corners, shadow, skew lines, and arcs too */
     #define LV_DRAW_SW_COMPLEX          1
@@ -112,9 +123,15 @@
 
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
-        * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+        * radius * 6 bytes are used per circle (the most often used radiuses are saved)
+        * The circles are kept between the refreshes, but the ones not used in a refresh are freed.
         * 0: to disable caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 16
+
+        /* Max. memory used by the cached circles in bytes.
+        * If a new circle doesn't fit, the least used circles are freed.
+        * 0: no limit */
+        #define LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES 0
     #endif
 #endif
 
@@ -234,6 +251,13 @@
     #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
 #endif
 
+/*1: Show the entries, the used size and the hit rate of the image cache
+ * Requires `LV_USE_SYSMON = 1`*/
+#define LV_USE_CACHE_MONITOR 0
+#if LV_USE_CACHE_MONITOR
+    #define LV_USE_CACHE_MONITOR_POS LV_ALIGN_TOP_LEFT
+#endif
+
 /*-------------
  * Others
  *-----------*/
@@ -254,6 +278,25 @@
  *will be dropped immediately after usage.*/
 #define LV_CACHE_DEF_SIZE       0
 
+/*1: Decode the image files of the thread safe decoders which cache their result (e.g. LodePNG, libjpeg-turbo)
+ *in the background. A placeholder is drawn in place of an image until it's decoded, and its area is redrawn when
+ *it's ready. The images which don't fit into the cache, variables and the images drawn on a canvas are still
+ *decoded while drawing.
+ *Requires `LV_USE_OS`*/
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Number of threads decoding the images*/
+    #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+
+    /*Stack size of the threads in bytes. The PNG and JPEG decoders run on these stacks.
+     *Ignored by the pthread backend*/
+    #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (32 * 1024)
+
+    /*Color and opacity of the rectangle drawn in place of the images being decoded. 0: draw nothing*/
+    #define LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR 0xC0C0C0
+    #define LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA 64
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -358,9 +401,30 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Enable subpixel rendering of the fonts with 3 times horizontal resolution (`LV_FONT_SUBPX_HOR`)
+ *on the displays where the subpixel order is set by `lv_display_set_subpx()`*/
+#define LV_USE_FONT_SUBPX 0
+#if LV_USE_FONT_SUBPX
+    /*1: the new displays use BGR subpixel order. 0: no subpixel order until `lv_display_set_subpx()` is called*/
+    #define LV_FONT_SUBPX_BGR 0
+#endif
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/*Max. memory in bytes used to cache the decoded bitmaps of the drawn glyphs.
+ *The cached glyphs are drawn without decoding them again (it helps the most with compressed fonts).
+ *If a new glyph doesn't fit, the least recently used glyphs are freed.
+ *0: to disable caching*/
+#define LV_FONT_GLYPH_CACHE_SIZE 0
+
+/*Max. memory in bytes used for the lookup tables of the fonts in LVGL's format (lv_font_fmt_txt).
+ *A small cache maps the used letters to glyphs (helps with the sparse cmaps, e.g. CJK fonts),
+ *and a table stores the kerning pairs. They are created when the font is used first.
+ *If the tables of a font don't fit, a smaller cache is used without the kerning table.
+ *0: to disable the lookup tables*/
+#define LV_FONT_FMT_TXT_LUT_SIZE 0
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -582,6 +646,9 @@
 /*BMP decoder library*/
 #define LV_USE_BMP 0
 
+/*Decoder of tiled, mip-mapped images (*.lvt) for large, zoomable images*/
+#define LV_USE_TILED_IMAGE 0
+
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_TJPGD 0
@@ -635,6 +702,15 @@
 #if LV_USE_FFMPEG
     /*Dump input information to stderr*/
     #define LV_FFMPEG_DUMP_FORMAT 0
+
+    /*Decode the frames of the players in a thread into a queue and show them at their timestamps.
+     *The YUV420 videos are drawn without converting them to RGB first.
+     *Requires `LV_USE_OS`*/
+    #define LV_FFMPEG_DECODE_THREAD 0
+    #if LV_FFMPEG_DECODE_THREAD
+        /*Number of frames decoded ahead*/
+        #define LV_FFMPEG_FRAME_QUEUE_LEN 3
+    #endif
 #endif
 
 /*==================
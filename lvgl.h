@@ -33,6 +33,8 @@ extern "C" {
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_profiler_builtin.h"
+#include "src/misc/lv_rle.h"
+#include "src/misc/lv_lz4.h"
 
 #include "src/tick/lv_tick.h"
 
@@ -45,6 +47,8 @@ extern "C" {
 #include "src/font/lv_font.h"
 #include "src/font/lv_font_loader.h"
 #include "src/font/lv_font_fmt_txt.h"
+#include "src/font/lv_font_glyph_cache.h"
+#include "src/draw/sw/lv_draw_sw_text_cache.h"
 
 #include "src/widgets/animimage/lv_animimage.h"
 #include "src/widgets/arc/lv_arc.h"
@@ -91,6 +95,7 @@ extern "C" {
 
 #include "src/libs/barcode/lv_barcode.h"
 #include "src/libs/bmp/lv_bmp.h"
+#include "src/libs/tiled_image/lv_tiled_image.h"
 #include "src/libs/fsdrv/lv_fsdrv.h"
 #include "src/libs/lodepng/lv_lodepng.h"
 #include "src/libs/gif/lv_gif.h"
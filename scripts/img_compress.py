@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+##################################################################
+# Compress LVGL images with RLE or LZ4 (see `lv_image_compress_t` in src/draw/lv_image_buf.h)
+# Dependencies: (PYTHON-3) Pillow, only to convert PNG, JPG, etc. images
+#
+# usage:
+#   python img_compress.py input.bin [--method RLE|LZ4] [-o output.bin|output.c] [--name var_name]
+#   python img_compress.py input.png --cf RGB565 [--method RLE|LZ4] [-o output.bin|output.c]
+#
+# The input is an uncompressed LVGL image file (*.bin) or an image to convert with Pillow.
+# The output is a compressed image file (*.bin) or a C array with an `lv_image_dsc_t` (*.c).
+##################################################################
+import argparse
+import os
+import struct
+import sys
+
+from img_to_lvt import convert_pixels, rle_compress
+
+HEADER_SIZE = 12
+
+COMPRESS_NONE = 0
+COMPRESS_RLE = 1
+COMPRESS_LZ4 = 2
+
+METHODS = {"RLE": COMPRESS_RLE, "LZ4": COMPRESS_LZ4}
+
+# Color format ID and the size of the blocks of the RLE packets in bytes
+COLOR_FORMATS = {
+    "L8":       (0x06, 1),
+    "I1":       (0x07, 1),
+    "I2":       (0x08, 1),
+    "I4":       (0x09, 1),
+    "I8":       (0x0A, 1),
+    "A8":       (0x0E, 1),
+    "RGB888":   (0x0F, 3),
+    "ARGB8888": (0x10, 4),
+    "XRGB8888": (0x11, 4),
+    "RGB565":   (0x12, 2),
+    "RGB565A8": (0x14, 2),
+}
+
+LZ4_MIN_MATCH = 4
+LZ4_MAX_OFFSET = 65535
+LZ4_LAST_LITERALS = 5   # The last bytes are always literals
+LZ4_MF_LIMIT = 12       # The last match starts at least this many bytes before the end
+
+
+def lz4_write_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def lz4_write_sequence(out, literals, offset=0, match_len=0):
+    lit_len = len(literals)
+    ml = match_len - LZ4_MIN_MATCH if match_len else 0
+    out.append((min(lit_len, 15) << 4) | min(ml, 15))
+    if lit_len >= 15:
+        lz4_write_length(out, lit_len - 15)
+    out += literals
+    if match_len:
+        out += struct.pack("<H", offset)
+        if ml >= 15:
+            lz4_write_length(out, ml - 15)
+
+
+def lz4_compress(data):
+    """Compress to an LZ4 block (without frame header) with greedy matching"""
+    n = len(data)
+    out = bytearray()
+    last_pos = {}
+    anchor = 0
+    i = 0
+    while i < n - LZ4_MF_LIMIT:
+        key = data[i:i + LZ4_MIN_MATCH]
+        cand = last_pos.get(key)
+        last_pos[key] = i
+        if cand is None or i - cand > LZ4_MAX_OFFSET:
+            i += 1
+            continue
+
+        match_len = LZ4_MIN_MATCH
+        limit = n - LZ4_LAST_LITERALS - i
+        while match_len < limit and data[cand + match_len] == data[i + match_len]:
+            match_len += 1
+
+        lz4_write_sequence(out, data[anchor:i], i - cand, match_len)
+        for k in range(i + 1, min(i + match_len, n - LZ4_MF_LIMIT)):
+            last_pos[data[k:k + LZ4_MIN_MATCH]] = k
+        i += match_len
+        anchor = i
+
+    lz4_write_sequence(out, data[anchor:])
+    return bytes(out)
+
+
+def compress(data, cf, method):
+    if method == COMPRESS_RLE:
+        blk_size = COLOR_FORMATS[cf][1]
+        # The decoder stops at the size of the image so the last block can be padded
+        pad = (-len(data)) % blk_size
+        return rle_compress(bytes(data) + bytes(pad), blk_size)
+    return lz4_compress(bytes(data))
+
+
+def read_bin(path):
+    """Read an uncompressed LVGL image file. Return the color format name, width, height, stride and data"""
+    with open(path, "rb") as f:
+        raw = f.read()
+    cf_byte, compress, _, _, w, h, stride, _ = struct.unpack("<BBBBHHHH", raw[:HEADER_SIZE])
+    if compress != COMPRESS_NONE:
+        raise ValueError("%s is already compressed" % path)
+    cf_id = cf_byte & 0x1F
+    for name, (fid, _) in COLOR_FORMATS.items():
+        if fid == cf_id:
+            return name, w, h, stride, raw[HEADER_SIZE:]
+    raise ValueError("Unsupported color format 0x%02X in %s" % (cf_id, path))
+
+
+def read_image(path, cf):
+    """Convert an image with Pillow"""
+    from PIL import Image
+
+    if cf not in ("A8", "RGB565", "RGB888", "ARGB8888", "XRGB8888"):
+        raise ValueError("Only A8, RGB565, RGB888, ARGB8888 and XRGB8888 images can be converted, not " + cf)
+    im = Image.open(path).convert("RGBA")
+    return cf, im.width, im.height, 0, convert_pixels(im.tobytes(), cf)
+
+
+def write_bin(path, cf, w, h, stride, method, data):
+    header = struct.pack("<BBBBHHHH", COLOR_FORMATS[cf][0], method, 0, 0, w, h, stride, 0)
+    with open(path, "wb") as f:
+        f.write(header)
+        f.write(data)
+
+
+def write_c(path, name, cf, w, h, stride, method, data, raw_size, include):
+    method_name = [k for k, v in METHODS.items() if v == method][0]
+    attr = "LV_ATTRIBUTE_IMAGE_" + name.upper()
+    lines = [
+        '#include "%s"' % include,
+        "",
+        "#ifndef LV_ATTRIBUTE_MEM_ALIGN",
+        "    #define LV_ATTRIBUTE_MEM_ALIGN",
+        "#endif",
+        "",
+        "#ifndef %s" % attr,
+        "    #define %s" % attr,
+        "#endif",
+        "",
+        "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %s uint8_t" % attr,
+        "%s_map[] = {" % name,
+        "    /*%s compressed, %d bytes decompressed*/" % (method_name, raw_size),
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x%02x," % b for b in data[i:i + 16]))
+    lines += [
+        "};",
+        "",
+        "const lv_image_dsc_t %s = {" % name,
+        "    .header.cf = LV_COLOR_FORMAT_%s," % cf,
+        "    .header.always_zero = 0,",
+        "    .header.compress = LV_IMAGE_COMPRESS_%s," % method_name,
+        "    .header.w = %d," % w,
+        "    .header.h = %d," % h,
+    ]
+    if stride:
+        lines.append("    .header.stride = %d," % stride)
+    lines += [
+        "    .data_size = %d," % len(data),
+        "    .data = %s_map," % name,
+        "};",
+        "",
+    ]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compress LVGL images with RLE or LZ4")
+    parser.add_argument("input", help="an uncompressed LVGL image (*.bin) or an image to convert")
+    parser.add_argument("-o", "--output", help="the output *.bin or *.c file, by default the input file with .bin "
+                                               "extension (with the method in its name for *.bin input)")
+    parser.add_argument("--method", choices=METHODS.keys(), default="RLE", help="compression method")
+    parser.add_argument("--cf", choices=COLOR_FORMATS.keys(), default="ARGB8888",
+                        help="color format if the input is not an LVGL image")
+    parser.add_argument("--name", help="name of the image variable in the C file, by default the file name")
+    parser.add_argument("--include", default="lvgl.h", help="the header to include in the C file")
+    args = parser.parse_args()
+
+    base, ext = os.path.splitext(args.input)
+    if ext.lower() == ".bin":
+        cf, w, h, stride, raw = read_bin(args.input)
+        output = args.output or "%s.%s.bin" % (base, args.method.lower())
+    else:
+        cf, w, h, stride, raw = read_image(args.input, args.cf)
+        output = args.output or base + ".bin"
+
+    method = METHODS[args.method]
+    data = compress(raw, cf, method)
+
+    if output.endswith(".c"):
+        name = args.name or os.path.splitext(os.path.basename(output))[0]
+        write_c(output, name, cf, w, h, stride, method, data, len(raw), args.include)
+    else:
+        write_bin(output, cf, w, h, stride, method, data)
+
+    print("%s: %s %dx%d, %d -> %d bytes (%.1f%%)" % (output, cf, w, h, len(raw), len(data),
+                                                     100.0 * len(data) / max(len(raw), 1)))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+##################################################################
+# Converter of images to LVGL's tiled, mip-mapped image format (*.lvt)
+# Dependencies: (PYTHON-3) Pillow
+#
+# usage:
+#   python img_to_lvt.py input.png [--cf ARGB8888] [--tile 128] [--levels 0] [--rle] [-o output.lvt]
+#
+# The layout of the files is described in src/libs/tiled_image/lv_tiled_image.h
+##################################################################
+import argparse
+import struct
+import sys
+
+LVT_VERSION = 1
+LVT_HEADER_SIZE = 20
+LVT_MAX_LEVELS = 16
+
+COMPRESS_NONE = 0
+COMPRESS_RLE = 1
+
+# Color format ID and pixel size in bytes
+COLOR_FORMATS = {
+    "A8":       (0x0E, 1),
+    "RGB565":   (0x12, 2),
+    "RGB888":   (0x0F, 3),
+    "ARGB8888": (0x10, 4),
+    "XRGB8888": (0x11, 4),
+}
+
+
+def convert_pixels(rgba, cf):
+    """Convert RGBA8888 bytes to the pixel format of LVGL"""
+    out = bytearray()
+    for i in range(0, len(rgba), 4):
+        r, g, b, a = rgba[i], rgba[i + 1], rgba[i + 2], rgba[i + 3]
+        if cf == "A8":
+            out.append(a)
+        elif cf == "RGB565":
+            c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+            out += struct.pack("<H", c)
+        elif cf == "RGB888":
+            out += bytes((b, g, r))
+        elif cf == "ARGB8888":
+            out += bytes((b, g, r, a))
+        else:
+            out += bytes((b, g, r, 0xFF))
+    return bytes(out)
+
+
+def rle_compress(data, px_size):
+    """Run-length encode pixels: a control byte `c` is followed by one pixel
+    to repeat `(c & 0x7F) + 1` times if `c & 0x80`, else by `c + 1` pixels to copy"""
+    pixels = [data[i:i + px_size] for i in range(0, len(data), px_size)]
+    out = bytearray()
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:128]
+            del literals[:128]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(p)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out += pixels[i]
+        else:
+            literals.append(pixels[i])
+        i += run
+    flush_literals()
+    return bytes(out)
+
+
+def write_lvt(path, levels, cf, tile_w, tile_h, rle):
+    """Write a tiled image.
+    `levels` is a list of (width, height, RGBA8888 bytes) tuples. Level `n` needs to be the image downscaled by 2^n.
+    """
+    cf_id, px_size = COLOR_FORMATS[cf]
+    w, h = levels[0][0], levels[0][1]
+
+    tile_cnt = 0
+    for lw, lh, _ in levels:
+        tile_cnt += ((lw + tile_w - 1) // tile_w) * ((lh + tile_h - 1) // tile_h)
+
+    header = b"LVTI" + struct.pack("<BBBBIIHH", LVT_VERSION, cf_id, COMPRESS_RLE if rle else COMPRESS_NONE,
+                                   len(levels), w, h, tile_w, tile_h)
+    table = bytearray()
+    data = bytearray()
+    data_pos = LVT_HEADER_SIZE + tile_cnt * 8
+
+    for lw, lh, rgba in levels:
+        for ty in range(0, lh, tile_h):
+            for tx in range(0, lw, tile_w):
+                tw = min(tile_w, lw - tx)
+                th = min(tile_h, lh - ty)
+                tile = bytearray()
+                for y in range(ty, ty + th):
+                    row_start = (y * lw + tx) * 4
+                    tile += rgba[row_start:row_start + tw * 4]
+                pixels = convert_pixels(tile, cf)
+                if rle:
+                    pixels = rle_compress(pixels, px_size)
+                table += struct.pack("<II", data_pos + len(data), len(pixels))
+                data += pixels
+
+    with open(path, "wb") as f:
+        f.write(header)
+        f.write(table)
+        f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an image to LVGL's tiled, mip-mapped image format")
+    parser.add_argument("input", help="the image to convert")
+    parser.add_argument("-o", "--output", help="the output file, by default the input file with .lvt extension")
+    parser.add_argument("--cf", choices=COLOR_FORMATS.keys(), default="ARGB8888", help="color format of the pixels")
+    parser.add_argument("--tile", type=int, default=128, help="width and height of the tiles")
+    parser.add_argument("--levels", type=int, default=0,
+                        help="number of mip levels, 0: until the image fits into a tile")
+    parser.add_argument("--rle", action="store_true", help="compress the tiles with run-length encoding")
+    args = parser.parse_args()
+
+    from PIL import Image
+
+    im = Image.open(args.input).convert("RGBA")
+    output = args.output or args.input.rsplit(".", 1)[0] + ".lvt"
+
+    levels = []
+    while True:
+        levels.append((im.width, im.height, im.tobytes()))
+        if len(levels) == LVT_MAX_LEVELS or len(levels) == args.levels:
+            break
+        if args.levels == 0 and im.width <= args.tile and im.height <= args.tile:
+            break
+        if im.width == 1 and im.height == 1:
+            break
+        # Average 2x2 pixels, the size is rounded up like in LVGL
+        im = im.reduce(2)
+
+    write_lvt(output, levels, args.cf, args.tile, args.tile, args.rle)
+    print("%s: %dx%d, %d levels" % (output, levels[0][0], levels[0][1], len(levels)))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
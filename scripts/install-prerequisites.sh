@@ -6,4 +6,4 @@
 #
 # Note: This script is run by the CI workflows.
 sudo apt update
-sudo apt install gcc python3 libpng-dev ruby-full gcovr cmake libjpeg-turbo8-dev
+sudo apt install gcc python3 libpng-dev ruby-full gcovr cmake libjpeg-turbo8-dev pkg-config libavformat-dev libavcodec-dev libavutil-dev libswscale-dev
@@ -16,6 +16,9 @@ if sys.version_info < (3,6,0):
   print("Python >=3.6 is required", file=sys.stderr)
   exit(1)
 
+#Options which are 1 by default, but not enable/disable switches
+NOT_SWITCHES = ['LV_IMAGE_DECODER_ASYNC_THREAD_CNT']
+
 fin = open(LV_CONF_TEMPLATE)
 fout = open(LV_CONF_INTERNAL, "w", newline='')
 
@@ -105,6 +108,11 @@ for line in fin.read().splitlines():
     #If the value should be 1 (enabled) by default use a more complex structure for Kconfig checks because
     #if a not defined CONFIG_... value should be interpreted as 0 and not the LVGL default
     is_one = re.search(r'#[\s]*define[\s]*[A-Z0-9_]+[\s]+1([\s]*$|[\s]+)', line)
+
+    #Some numbers are 1 by default but they are not switches, so 0 shouldn't be used in Kconfig
+    if name in NOT_SWITCHES:
+      is_one = None
+
     if is_one:
       #1. Use the value if already set from lv_conf.h or anything else (i.e. do nothing)
       #2. In Kconfig environment use the CONFIG_... value if set, else use 0
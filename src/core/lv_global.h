@@ -33,10 +33,12 @@ extern "C" {
 #include "../misc/lv_timer.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_FONT_FMT_TXT_LUT_SIZE > 0
 #include "../font/lv_font_fmt_txt.h"
 #endif
 
+#include "../font/lv_font_glyph_cache.h"
+
 #include "../tick/lv_tick.h"
 #include "../layouts/lv_layout.h"
 
@@ -102,6 +104,10 @@ typedef struct _lv_global_t {
     lv_draw_buf_handlers_t draw_buf_handlers;
 
     lv_ll_t img_decoder_ll;
+    lv_ll_t font_invalidate_cb_ll;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    _lv_image_decoder_async_t img_decoder_async;
+#endif
     lv_cache_manager_t cache_manager;
     lv_cache_builtin_dsc_t cache_builtin_dsc;
     size_t cache_builtin_max_size;
@@ -112,6 +118,10 @@ typedef struct _lv_global_t {
 #endif
 #if LV_DRAW_SW_COMPLEX
     _lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
+    _lv_draw_sw_mask_circle_cache_shard_arr_t sw_circle_cache_shards;
+#endif
+#if defined(LV_DRAW_SW_TEXT_CACHE_SIZE) && LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+    _lv_draw_sw_text_cache_t sw_text_cache;
 #endif
 
 #if LV_USE_LOG
@@ -162,6 +172,14 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    _lv_font_fmt_txt_lut_state_t font_fmt_txt_lut;
+#endif
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    _lv_font_glyph_cache_t font_glyph_cache;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
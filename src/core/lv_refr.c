@@ -178,7 +178,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 lv_area_t bottom = obj->coords;
                 bottom.y1 = bottom.y2 - rout + 1;
                 if(_lv_area_intersect(&bottom, &bottom, &clip_area_ori)) {
-                    layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &bottom);
+                    layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888_LAYER, &bottom);
 
                     for(i = 0; i < child_cnt; i++) {
                         lv_obj_t * child = obj->spec_attr->children[i];
@@ -199,7 +199,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 lv_area_t top = obj->coords;
                 top.y2 = top.y1 + rout - 1;
                 if(_lv_area_intersect(&top, &top, &clip_area_ori)) {
-                    layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &top);
+                    layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888_LAYER, &top);
 
                     for(i = 0; i < child_cnt; i++) {
                         lv_obj_t * child = obj->spec_attr->children[i];
@@ -407,12 +407,12 @@ refr_clean_up:
     lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
     disp_refr->inv_p = 0;
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+    _lv_draw_sw_mask_circle_cache_trim();
+#endif
 
-refr_finish:
 
-#if LV_DRAW_SW_COMPLEX == 1
-    _lv_draw_sw_mask_cleanup();
-#endif
+refr_finish:
 
     lv_display_send_event(disp_refr, LV_EVENT_REFR_FINISH, NULL);
 
@@ -833,8 +833,8 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
                 if(layer_area_act.y2 > layer_area_full.y2) layer_area_act.y2 = layer_area_full.y2;
             }
 
-            lv_layer_t * new_layer = lv_draw_layer_create(layer,
-                                                          area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
+            lv_color_format_t layer_cf = area_need_alpha ? LV_COLOR_FORMAT_ARGB8888_LAYER : LV_COLOR_FORMAT_NATIVE;
+            lv_layer_t * new_layer = lv_draw_layer_create(layer, layer_cf, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
             lv_draw_image_dsc_t layer_draw_dsc;
@@ -69,6 +69,9 @@ lv_display_t * lv_display_create(lv_coord_t hor_res, lv_coord_t ver_res)
     disp->offset_x         = 0;
     disp->offset_y         = 0;
     disp->antialiasing     = LV_COLOR_DEPTH > 8 ? 1 : 0;
+#if LV_USE_FONT_SUBPX && LV_FONT_SUBPX_BGR
+    disp->subpx            = LV_DISPLAY_SUBPX_BGR;
+#endif
     disp->dpi              = LV_DPI_DEF;
     disp->color_format = LV_COLOR_FORMAT_NATIVE;
 
@@ -421,6 +424,24 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
     return disp->antialiasing;
 }
 
+void lv_display_set_subpx(lv_display_t * disp, lv_display_subpx_t subpx)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    if(disp->subpx == subpx) return;
+    disp->subpx = subpx;
+    if(disp->act_scr) lv_obj_invalidate(disp->act_scr);
+}
+
+lv_display_subpx_t lv_display_get_subpx(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return LV_DISPLAY_SUBPX_NONE;
+
+    return disp->subpx;
+}
+
 
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
@@ -63,6 +63,12 @@ typedef enum {
     LV_DISPLAY_RENDER_MODE_FULL,
 } lv_display_render_mode_t;
 
+/** Order of the subpixels of the panel, used for subpixel text rendering*/
+typedef enum {
+    LV_DISPLAY_SUBPX_NONE,      /**< Don't use subpixel rendering*/
+    LV_DISPLAY_SUBPX_RGB,       /**< Horizontal R, G, B stripes*/
+    LV_DISPLAY_SUBPX_BGR,       /**< Horizontal B, G, R stripes*/
+} lv_display_subpx_t;
 
 typedef enum {
     LV_SCR_LOAD_ANIM_NONE,
@@ -281,6 +287,22 @@ void lv_display_set_antialiasing(lv_display_t * disp, bool en);
  */
 bool lv_display_get_antialiasing(lv_display_t * disp);
 
+/**
+ * Set the subpixel order of a display to render the subpixel fonts (`LV_FONT_SUBPX_HOR`)
+ * with per-channel coverage. Other fonts are not affected.
+ * Needs `LV_USE_FONT_SUBPX` and works only with the software renderer without rotation.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param subpx     `LV_DISPLAY_SUBPX_NONE/RGB/BGR`
+ */
+void lv_display_set_subpx(lv_display_t * disp, lv_display_subpx_t subpx);
+
+/**
+ * Get the subpixel order of a display
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          `LV_DISPLAY_SUBPX_NONE/RGB/BGR`
+ */
+lv_display_subpx_t lv_display_get_subpx(lv_display_t * disp);
+
 
 //! @cond Doxygen_Suppress
 
@@ -80,6 +80,7 @@ struct _lv_display_t {
 
     lv_display_render_mode_t render_mode;
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
+    uint32_t subpx : 2;              /**< Element of `lv_display_subpx_t`*/
 
     /** 1: The current screen rendering is in progress*/
     uint32_t rendering_in_progress : 1;
@@ -48,6 +48,7 @@ typedef enum {
     LV_DRAW_TASK_TYPE_TRIANGLE,
     LV_DRAW_TASK_TYPE_MASK_RECTANGLE,
     LV_DRAW_TASK_TYPE_MASK_BITMAP,
+    LV_DRAW_TASK_TYPE_PATH,
 } lv_draw_task_type_t;
 
 typedef enum {
@@ -173,7 +174,6 @@ typedef struct {
 #else
     int dispatch_req;
 #endif
-    lv_mutex_t circle_cache_mutex;
     bool task_running;
 } lv_draw_global_info_t;
 
@@ -251,6 +251,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer);
 #include "lv_draw_arc.h"
 #include "lv_draw_line.h"
 #include "lv_draw_triangle.h"
+#include "lv_draw_path.h"
 #include "lv_draw_mask.h"
 
 #ifdef __cplusplus
@@ -7,7 +7,8 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_image.h"
-#include "../display/lv_display.h"
+#include "lv_draw_rect.h"
+#include "../display/lv_display_private.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr.h"
@@ -25,6 +26,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_display_t * get_refreshed_disp(lv_layer_t * layer);
+static void draw_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords);
 
 /**********************
  *  STATIC VARIABLES
@@ -77,10 +80,27 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 
     lv_draw_image_dsc_t * new_image_dsc = lv_malloc(sizeof(*dsc));
     lv_memcpy(new_image_dsc, dsc, sizeof(*dsc));
-    lv_result_t res = lv_image_decoder_get_info(new_image_dsc->src, &new_image_dsc->header);
+
+    /*Redraw only the image's area when it's decoded in the background,
+     *but the area is not known if it's transformed or it's drawn on an other layer*/
+    const lv_area_t * inv_area = coords;
+    if(layer->parent || dsc->rotation || dsc->zoom != LV_SCALE_NONE) inv_area = NULL;
+
+    bool ready;
+    lv_result_t res = _lv_image_decoder_get_info_async(new_image_dsc->src, &new_image_dsc->header,
+                                                       get_refreshed_disp(layer), inv_area, &ready);
     if(res != LV_RESULT_OK) {
         LV_LOG_WARN("Couldn't get info about the image");
         lv_free(new_image_dsc);
+        LV_PROFILER_END;
+        return;
+    }
+
+    /*Draw a placeholder until the image is decoded*/
+    if(!ready) {
+        lv_free(new_image_dsc);
+        draw_placeholder(layer, dsc, coords);
+        LV_PROFILER_END;
         return;
     }
 
@@ -129,3 +149,39 @@ lv_image_src_t lv_image_src_get_type(const void * src)
  *   STATIC FUNCTIONS
  **********************/
 
+
+/**
+ * Get the display whose refresh draws on a layer
+ * @param layer     the layer to draw on
+ * @return          the display or NULL if the layer is not drawn by a display refresh (e.g. canvas or snapshot)
+ *                  so the layer won't be redrawn later
+ */
+static lv_display_t * get_refreshed_disp(lv_layer_t * layer)
+{
+    lv_display_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL || !disp->rendering_in_progress) return NULL;
+
+    while(layer->parent) layer = layer->parent;
+    return layer == disp->layer_head ? disp : NULL;
+}
+
+/**
+ * Draw a rectangle in place of an image which is being decoded in the background
+ * @param layer     the layer to draw on
+ * @param dsc       the descriptor of the image
+ * @param coords    the coordinates of the image (without transformation)
+ */
+static void draw_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC && LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA > 0
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_hex(LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR);
+    rect_dsc.bg_opa = LV_OPA_MIX2(LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA, dsc->opa);
+    lv_draw_rect(layer, &rect_dsc, coords);
+#else
+    LV_UNUSED(layer);
+    LV_UNUSED(dsc);
+    LV_UNUSED(coords);
+#endif
+}
@@ -11,9 +11,11 @@
 #include "../misc/lv_math.h"
 #include "../core/lv_obj_event.h"
 #include "../misc/lv_bidi.h"
+#include "../font/lv_font_glyph_cache.h"
 #include "../misc/lv_assert.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -30,6 +32,13 @@
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_letter_cb_t cb);
+static uint8_t * get_bitmap_buf(lv_draw_glyph_dsc_t * dsc, const lv_font_glyph_dsc_t * g);
+static bool subpx_is_enabled(void);
+static void subpx_to_a8(lv_draw_glyph_dsc_t * dsc, const lv_font_glyph_dsc_t * g);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                             uint32_t line_idx, int32_t w);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                              uint32_t line_end, uint32_t line_idx);
 
 /**********************
  *  STATIC VARIABLES
@@ -144,10 +153,20 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
+    /*Use the lines of the layout if it was calculated for the same text and width*/
+    const lv_text_layout_t * layout = dsc->layout;
+    if(!lv_text_layout_is_valid_for(layout, dsc->text, font, dsc->letter_space, dsc->line_space,
+                                    lv_area_get_width(coords), dsc->flag)) {
+        layout = NULL;
+    }
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(layout) {
+        w = layout->size.x;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -172,10 +191,11 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    /*Check the hint to use the cached info. Not required if the lines are known.*/
+    if(dsc->hint && layout == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -189,14 +209,14 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
         pos.y += dsc->hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                            dsc->flag);
+    uint32_t line_end = get_line_end(dsc, layout, line_start, line_idx, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_unit->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, layout, line_start, line_idx, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -211,14 +231,14 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_start, line_end, line_idx);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_start, line_end, line_idx);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -332,20 +352,19 @@ void lv_draw_label_interate_letters(lv_draw_unit_t * draw_unit, const lv_draw_la
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, layout, line_start, line_idx, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_start, line_end, line_idx);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_start, line_end, line_idx);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -370,7 +389,12 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     lv_font_glyph_dsc_t g;
 
     LV_PROFILER_BEGIN;
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    lv_font_glyph_cache_entry_t * cache_entry;
+    bool g_ret = _lv_font_glyph_cache_acquire(font, letter, &g, &cache_entry);
+#else
     bool g_ret = lv_font_get_glyph_dsc(font, &g, letter, '\0');
+#endif
     if(g_ret == false) {
         /*Add warning if the dsc is not found
          *but do not print warning for non printable ASCII chars (e.g. '\n')*/
@@ -389,19 +413,54 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
         return;
     }
 
+    /*The bitmaps of the subpixel fonts have 3 values per pixel*/
+    bool subpx = g.resolved_font && g.resolved_font->subpx == LV_FONT_SUBPX_HOR && g.bpp != LV_IMGFONT_BPP;
+
     lv_area_t letter_coords;
     letter_coords.x1 = pos->x + g.ofs_x;
-    letter_coords.x2 = letter_coords.x1 + g.box_w - 1;
+    letter_coords.x2 = letter_coords.x1 + (subpx ? g.box_w / 3 : g.box_w) - 1;
     letter_coords.y1 = pos->y + (font->line_height - font->base_line) - g.box_h - g.ofs_y;
     letter_coords.y2 = letter_coords.y1 + g.box_h - 1;
 
     /*If the letter is completely out of mask don't draw it*/
     if(_lv_area_is_out(&letter_coords, draw_unit->clip_area, 0)) {
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+        _lv_font_glyph_cache_release(cache_entry);
+#endif
+        LV_PROFILER_END;
+        return;
+    }
+
+    dsc->letter_coords = &letter_coords;
+    if(g.bpp == LV_IMGFONT_BPP) dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_IMAGE;
+    else if(subpx && subpx_is_enabled()) dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_A8_SUBPX;
+    else dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_A8;
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    /*The bitmap is already decoded, just draw it*/
+    if(cache_entry) {
+        dsc->bitmap = cache_entry->bitmap;
+        if(subpx && dsc->format == LV_DRAW_LETTER_BITMAP_FORMAT_A8) subpx_to_a8(dsc, &g);
+        cb(draw_unit, dsc, NULL, NULL);
+        _lv_font_glyph_cache_release(cache_entry);
         LV_PROFILER_END;
         return;
     }
+#endif
+
+    dsc->bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter, get_bitmap_buf(dsc, &g));
+    if(subpx && dsc->format == LV_DRAW_LETTER_BITMAP_FORMAT_A8) subpx_to_a8(dsc, &g);
+
+    cb(draw_unit, dsc, NULL, NULL);
+    LV_PROFILER_END;
+}
 
-    uint32_t bitmap_size = lv_draw_buf_width_to_stride(g.box_w, LV_COLOR_FORMAT_A8) * g.box_h;
+/**
+ * Get a buffer from the glyph draw descriptor which is large enough for the bitmap of a glyph
+ */
+static uint8_t * get_bitmap_buf(lv_draw_glyph_dsc_t * dsc, const lv_font_glyph_dsc_t * g)
+{
+    uint32_t bitmap_size = lv_draw_buf_width_to_stride(g->box_w, LV_COLOR_FORMAT_A8) * g->box_h;
     bitmap_size = (bitmap_size + 63) & (~63);   /*Round up*/
     if(dsc->_bitmap_buf_size < bitmap_size) {
         lv_draw_buf_free(dsc->_bitmap_buf_unaligned);
@@ -411,12 +470,86 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
         dsc->_bitmap_buf_size = bitmap_size;
     }
 
-    dsc->bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter, dsc->bitmap_buf);
-    dsc->letter_coords = &letter_coords;
-    if(g.bpp == LV_IMGFONT_BPP) dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_IMAGE;
-    else dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_A8;
+    return dsc->bitmap_buf;
+}
 
-    cb(draw_unit, dsc, NULL, NULL);
-    LV_PROFILER_END;
+/**
+ * Check if the subpixel fonts can be rendered with per-channel coverage on the display being refreshed
+ */
+static bool subpx_is_enabled(void)
+{
+#if LV_USE_FONT_SUBPX
+    lv_display_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL || lv_display_get_subpx(disp) == LV_DISPLAY_SUBPX_NONE) return false;
+
+    /*With rotation the subpixels are not in the rendered order anymore*/
+    return lv_display_get_rotation(disp) == LV_DISPLAY_ROTATION_0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Convert the bitmap of a subpixel glyph to a normal A8 bitmap by averaging the 3 values of each pixel.
+ * The result is written to `dsc->bitmap_buf` (in place if the bitmap was decoded there).
+ */
+static void subpx_to_a8(lv_draw_glyph_dsc_t * dsc, const lv_font_glyph_dsc_t * g)
+{
+    if(dsc->bitmap == NULL) return;
+
+    int32_t w = g->box_w / 3;
+    uint32_t src_stride = lv_draw_buf_width_to_stride(g->box_w, LV_COLOR_FORMAT_A8);
+    uint32_t dest_stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    const uint8_t * src = dsc->bitmap;
+    uint8_t * dest = get_bitmap_buf(dsc, g);
+
+    /*The destination is never ahead of the source so it works in place too*/
+    int32_t y;
+    for(y = 0; y < g->box_h; y++) {
+        int32_t x;
+        for(x = 0; x < w; x++) {
+            dest[x] = (src[x * 3] + src[x * 3 + 1] + src[x * 3 + 2]) / 3;
+        }
+        src += src_stride;
+        dest += dest_stride;
+    }
+
+    dsc->bitmap = dsc->bitmap_buf;
+}
+
+
+/**
+ * Get the byte index where the next line starts
+ * @param dsc           the label draw descriptor
+ * @param layout        the layout of the text or NULL to find the line break now
+ * @param line_start    the byte index of the line's start
+ * @param line_idx      the index of the line
+ * @param w             the max. width of the lines
+ * @return              the byte index of the next line's start
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                             uint32_t line_idx, int32_t w)
+{
+    if(layout) return line_idx < layout->line_cnt ? layout->lines[line_idx + 1].start : line_start;
+
+    /*The length is not known, measuring it would make the label hint useless on long texts*/
+    return line_start + _lv_text_get_next_line(&dsc->text[line_start], UINT32_MAX, dsc->font, dsc->letter_space, w,
+                                               NULL, dsc->flag);
 }
 
+/**
+ * Get the width of a line
+ * @param dsc           the label draw descriptor
+ * @param layout        the layout of the text or NULL to measure the line now
+ * @param line_start    the byte index of the line's start
+ * @param line_end      the byte index of the next line's start
+ * @param line_idx      the index of the line
+ * @return              the width of the line
+ */
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                              uint32_t line_end, uint32_t line_idx)
+{
+    if(layout) return line_idx < layout->line_cnt ? layout->lines[line_idx].width : 0;
+
+    return lv_text_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
@@ -16,6 +16,7 @@ extern "C" {
 #include "lv_draw.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_text.h"
+#include "../misc/lv_text_layout.h"
 #include "../misc/lv_color.h"
 #include "../misc/lv_style.h"
 
@@ -70,11 +71,15 @@ typedef struct {
 uint8_t text_local  :
     1;        /**< 1: malloc buffer and copy `text` there. 0: `text` is const and it's pointer will be valid during rendering*/
     lv_draw_label_hint_t * hint;
+    /** The already calculated lines of `text`. Used only if it was calculated with the same settings.
+     * Like `text`, it needs to be valid during rendering.*/
+    const lv_text_layout_t * layout;
 } lv_draw_label_dsc_t;
 
 typedef enum {
     LV_DRAW_LETTER_BITMAP_FORMAT_A8,
     LV_DRAW_LETTER_BITMAP_FORMAT_IMAGE,
+    LV_DRAW_LETTER_BITMAP_FORMAT_A8_SUBPX,  /**< 3 coverage values per pixel in the subpixel order of the display*/
 } lv_draw_letter_bitmap_format_t;
 
 typedef struct {
@@ -0,0 +1,207 @@
+/**
+ * @file lv_draw_path.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../core/lv_obj.h"
+#include "lv_draw_path.h"
+#include "../misc/lv_math.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Initial number of commands and points to allocate*/
+#define PATH_SIZE_INIT  8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void add_op(lv_draw_path_t * path, lv_draw_path_op_t op, const lv_point_t * points, uint32_t point_cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_path_init(lv_draw_path_t * path)
+{
+    lv_memzero(path, sizeof(lv_draw_path_t));
+}
+
+void lv_draw_path_reset(lv_draw_path_t * path)
+{
+    lv_free(path->ops);
+    lv_free(path->points);
+    lv_draw_path_init(path);
+}
+
+void lv_draw_path_move_to(lv_draw_path_t * path, const lv_point_t * p)
+{
+    add_op(path, LV_DRAW_PATH_OP_MOVE_TO, p, 1);
+}
+
+void lv_draw_path_line_to(lv_draw_path_t * path, const lv_point_t * p)
+{
+    add_op(path, LV_DRAW_PATH_OP_LINE_TO, p, 1);
+}
+
+void lv_draw_path_quad_to(lv_draw_path_t * path, const lv_point_t * cp, const lv_point_t * p)
+{
+    lv_point_t points[2] = {*cp, *p};
+    add_op(path, LV_DRAW_PATH_OP_QUAD_TO, points, 2);
+}
+
+void lv_draw_path_cubic_to(lv_draw_path_t * path, const lv_point_t * cp1, const lv_point_t * cp2,
+                           const lv_point_t * p)
+{
+    lv_point_t points[3] = {*cp1, *cp2, *p};
+    add_op(path, LV_DRAW_PATH_OP_CUBIC_TO, points, 3);
+}
+
+void lv_draw_path_close(lv_draw_path_t * path)
+{
+    add_op(path, LV_DRAW_PATH_OP_CLOSE, NULL, 0);
+}
+
+bool lv_draw_path_get_area(const lv_draw_path_t * path, lv_area_t * area)
+{
+    if(path->point_cnt == 0) return false;
+
+    area->x1 = LV_COORD_MAX;
+    area->y1 = LV_COORD_MAX;
+    area->x2 = LV_COORD_MIN;
+    area->y2 = LV_COORD_MIN;
+
+    uint32_t i;
+    for(i = 0; i < path->point_cnt; i++) {
+        area->x1 = LV_MIN(area->x1, path->points[i].x);
+        area->y1 = LV_MIN(area->y1, path->points[i].y);
+        area->x2 = LV_MAX(area->x2, path->points[i].x);
+        area->y2 = LV_MAX(area->y2, path->points[i].y);
+    }
+
+    return true;
+}
+
+void lv_draw_path_dsc_init(lv_draw_path_dsc_t * dsc)
+{
+    lv_memzero(dsc, sizeof(lv_draw_path_dsc_t));
+    dsc->fill_color = lv_color_white();
+    dsc->fill_grad.stops[0].color = lv_color_white();
+    dsc->fill_grad.stops[1].color = lv_color_black();
+    dsc->fill_grad.stops[1].frac = 0xFF;
+    dsc->fill_grad.stops_count = 2;
+    dsc->fill_opa = LV_OPA_COVER;
+    dsc->fill_rule = LV_DRAW_PATH_FILL_NONZERO;
+    dsc->stroke_color = lv_color_black();
+    dsc->stroke_opa = LV_OPA_COVER;
+    dsc->stroke_join = LV_DRAW_PATH_JOIN_MITER;
+    dsc->stroke_cap = LV_DRAW_PATH_CAP_BUTT;
+}
+
+void lv_draw_path(lv_layer_t * layer, const lv_draw_path_dsc_t * dsc)
+{
+    if(dsc->path == NULL || dsc->path->op_cnt == 0) return;
+
+    bool has_fill = dsc->fill_opa > LV_OPA_MIN;
+    bool has_stroke = dsc->stroke_opa > LV_OPA_MIN && dsc->stroke_width > 0;
+    if(!has_fill && !has_stroke) return;
+
+    lv_area_t a;
+    if(!lv_draw_path_get_area(dsc->path, &a)) return;
+
+    LV_PROFILER_BEGIN;
+
+    /*The stroke goes out by half width, miter joins and square caps even more*/
+    lv_coord_t ext = 1;
+    if(has_stroke) {
+        lv_coord_t r = (dsc->stroke_width + 1) / 2;
+        if(dsc->stroke_join == LV_DRAW_PATH_JOIN_MITER) ext += r * LV_DRAW_PATH_MITER_LIMIT;
+        else ext += (r * 3) / 2;
+    }
+    lv_area_increase(&a, ext, ext);
+
+    /*Copy the path too into the same memory block, so it's freed with the draw descriptor*/
+    const lv_draw_path_t * path = dsc->path;
+    uint32_t points_size = path->point_cnt * sizeof(lv_point_t);
+    uint32_t ops_size = path->op_cnt * sizeof(lv_draw_path_op_t);
+    uint8_t * buf = lv_malloc(sizeof(*dsc) + sizeof(lv_draw_path_t) + points_size + ops_size);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) {
+        LV_PROFILER_END;
+        return;
+    }
+
+    lv_draw_path_dsc_t * new_dsc = (lv_draw_path_dsc_t *)buf;
+    lv_draw_path_t * new_path = (lv_draw_path_t *)(buf + sizeof(*dsc));
+    lv_memcpy(new_dsc, dsc, sizeof(*dsc));
+    new_path->points = (lv_point_t *)(buf + sizeof(*dsc) + sizeof(lv_draw_path_t));
+    new_path->ops = buf + sizeof(*dsc) + sizeof(lv_draw_path_t) + points_size;
+    new_path->point_cnt = path->point_cnt;
+    new_path->point_size = path->point_cnt;
+    new_path->op_cnt = path->op_cnt;
+    new_path->op_size = path->op_cnt;
+    lv_memcpy(new_path->points, path->points, points_size);
+    lv_memcpy(new_path->ops, path->ops, ops_size);
+    new_dsc->path = new_path;
+
+    lv_draw_task_t * t = lv_draw_add_task(layer, &a);
+    t->draw_dsc = new_dsc;
+    t->type = LV_DRAW_TASK_TYPE_PATH;
+
+    lv_draw_finalize_task_creation(layer, t);
+    LV_PROFILER_END;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void add_op(lv_draw_path_t * path, lv_draw_path_op_t op, const lv_point_t * points, uint32_t point_cnt)
+{
+    /*Make room in both arrays before adding anything, so a failed allocation leaves the path unchanged*/
+    if(path->op_cnt >= path->op_size) {
+        uint32_t new_size = path->op_size ? path->op_size * 2 : PATH_SIZE_INIT;
+        lv_draw_path_op_t * new_ops = lv_realloc(path->ops, new_size * sizeof(lv_draw_path_op_t));
+        LV_ASSERT_MALLOC(new_ops);
+        if(new_ops == NULL) return;
+        path->ops = new_ops;
+        path->op_size = new_size;
+    }
+
+    if(path->point_cnt + point_cnt > path->point_size) {
+        uint32_t new_size = path->point_size ? path->point_size * 2 : PATH_SIZE_INIT;
+        while(new_size < path->point_cnt + point_cnt) new_size *= 2;
+        lv_point_t * new_points = lv_realloc(path->points, new_size * sizeof(lv_point_t));
+        LV_ASSERT_MALLOC(new_points);
+        /*The grown `ops` array is kept, but `op_cnt` is not changed*/
+        if(new_points == NULL) return;
+        path->points = new_points;
+        path->point_size = new_size;
+    }
+
+    path->ops[path->op_cnt] = op;
+    path->op_cnt++;
+
+    uint32_t i;
+    for(i = 0; i < point_cnt; i++) {
+        path->points[path->point_cnt] = points[i];
+        path->point_cnt++;
+    }
+}
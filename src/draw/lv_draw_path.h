@@ -0,0 +1,188 @@
+/**
+ * @file lv_draw_path.h
+ *
+ */
+
+#ifndef LV_DRAW_PATH_H
+#define LV_DRAW_PATH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_color.h"
+#include "../misc/lv_area.h"
+#include "../misc/lv_style.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The miter joins longer than `LV_DRAW_PATH_MITER_LIMIT * stroke_width / 2` are drawn as bevel*/
+#define LV_DRAW_PATH_MITER_LIMIT    4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_DRAW_PATH_OP_MOVE_TO,    /*1 point: start a new sub-path*/
+    LV_DRAW_PATH_OP_LINE_TO,    /*1 point: straight line*/
+    LV_DRAW_PATH_OP_QUAD_TO,    /*2 points: control point, end point*/
+    LV_DRAW_PATH_OP_CUBIC_TO,   /*3 points: 2 control points, end point*/
+    LV_DRAW_PATH_OP_CLOSE,      /*0 point: line back to the start of the sub-path*/
+};
+
+typedef uint8_t lv_draw_path_op_t;
+
+enum {
+    LV_DRAW_PATH_FILL_NONZERO,
+    LV_DRAW_PATH_FILL_EVENODD,
+};
+
+typedef uint8_t lv_draw_path_fill_rule_t;
+
+enum {
+    LV_DRAW_PATH_JOIN_MITER,
+    LV_DRAW_PATH_JOIN_BEVEL,
+    LV_DRAW_PATH_JOIN_ROUND,
+};
+
+typedef uint8_t lv_draw_path_join_t;
+
+enum {
+    LV_DRAW_PATH_CAP_BUTT,
+    LV_DRAW_PATH_CAP_SQUARE,
+    LV_DRAW_PATH_CAP_ROUND,
+};
+
+typedef uint8_t lv_draw_path_cap_t;
+
+/**
+ * A list of drawing commands and their points.
+ * The points are absolute coordinates like in case of the other draw descriptors.
+ */
+typedef struct {
+    lv_draw_path_op_t * ops;
+    lv_point_t * points;
+    uint32_t op_cnt;
+    uint32_t op_size;
+    uint32_t point_cnt;
+    uint32_t point_size;
+} lv_draw_path_t;
+
+/**
+ * Describes how to draw a path with `lv_draw_path()`
+ */
+typedef struct {
+    lv_draw_dsc_base_t base;
+
+    const lv_draw_path_t * path;
+
+    /*Fill the inside of the path. Every sub-path is closed implicitly for filling.*/
+    lv_color_t fill_color;
+    lv_grad_dsc_t fill_grad;
+    lv_opa_t fill_opa;
+    lv_draw_path_fill_rule_t fill_rule;
+
+    /*Draw the outline of the path above the fill*/
+    lv_color_t stroke_color;
+    lv_coord_t stroke_width;
+    lv_opa_t stroke_opa;
+    lv_draw_path_join_t stroke_join;
+    lv_draw_path_cap_t stroke_cap;
+} lv_draw_path_dsc_t;
+
+struct _lv_layer_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an empty path
+ * @param path      pointer to a path
+ */
+void lv_draw_path_init(lv_draw_path_t * path);
+
+/**
+ * Free the memory allocated for the commands of a path and make it empty again
+ * @param path      pointer to a path
+ */
+void lv_draw_path_reset(lv_draw_path_t * path);
+
+/**
+ * Start a new sub-path
+ * @param path      pointer to a path
+ * @param p         the start point
+ */
+void lv_draw_path_move_to(lv_draw_path_t * path, const lv_point_t * p);
+
+/**
+ * Add a straight line to the current sub-path
+ * @param path      pointer to a path
+ * @param p         the end point
+ */
+void lv_draw_path_line_to(lv_draw_path_t * path, const lv_point_t * p);
+
+/**
+ * Add a quadratic Bézier curve to the current sub-path
+ * @param path      pointer to a path
+ * @param cp        the control point
+ * @param p         the end point
+ */
+void lv_draw_path_quad_to(lv_draw_path_t * path, const lv_point_t * cp, const lv_point_t * p);
+
+/**
+ * Add a cubic Bézier curve to the current sub-path
+ * @param path      pointer to a path
+ * @param cp1       the first control point
+ * @param cp2       the second control point
+ * @param p         the end point
+ */
+void lv_draw_path_cubic_to(lv_draw_path_t * path, const lv_point_t * cp1, const lv_point_t * cp2,
+                           const lv_point_t * p);
+
+/**
+ * Close the current sub-path with a line to its start point
+ * @param path      pointer to a path
+ */
+void lv_draw_path_close(lv_draw_path_t * path);
+
+/**
+ * Get the area covered by the points of a path (including the control points)
+ * @param path      pointer to a path
+ * @param area      store the area here
+ * @return          false: the path is empty
+ */
+bool lv_draw_path_get_area(const lv_draw_path_t * path, lv_area_t * area);
+
+/**
+ * Initialize a path draw descriptor: white nonzero fill, no gradient and no stroke
+ * (`stroke_width = 0`) with black color, miter joins and butt caps
+ * @param dsc       pointer to a path draw descriptor
+ */
+void lv_draw_path_dsc_init(lv_draw_path_dsc_t * dsc);
+
+/**
+ * Create a draw task to fill and/or stroke a path.
+ * The path is copied so it can be modified or freed after this call.
+ * Only the SW renderer with `LV_DRAW_SW_COMPLEX` can draw paths, and the strokes can't be dashed.
+ * Therefore `lv_line` and `lv_chart` still draw their lines with `lv_draw_line()`.
+ * @param layer     pointer to a layer
+ * @param dsc       pointer to an initialized `lv_draw_path_dsc_t` variable
+ */
+void lv_draw_path(struct _lv_layer_t * layer, const lv_draw_path_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_PATH_H*/
@@ -42,6 +42,21 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+/**
+ * Compression methods of the image data. The compressed data decompresses to the same layout as the
+ * uncompressed image (the palette of indexed images included).
+ */
+typedef enum {
+    LV_IMAGE_COMPRESS_NONE = 0,
+    /**Run-length encoding of pixels: a control byte `c` is followed by one pixel
+     * to repeat `(c & 0x7F) + 1` times if `c & 0x80`, else by `c + 1` pixels to copy.
+     * The pixels are 1 byte for the formats with less than 8 bit per pixel and 2 bytes for RGB565A8
+     * (an RGB565 pixel or two alpha values).*/
+    LV_IMAGE_COMPRESS_RLE,
+    /**LZ4 block format (without frame header)*/
+    LV_IMAGE_COMPRESS_LZ4,
+} lv_image_compress_t;
+
 /**
  * The first 8 bit is very important to distinguish the different source types.
  * For more info see `lv_image_get_src_type()` in lv_img.c
@@ -65,7 +80,7 @@ typedef struct {
     uint32_t always_zero : 3; /*It the upper bits of the first byte. Always zero to look like a
                                  non-printable character*/
 
-    uint32_t format: 8;       /*Image format? To be defined by LVGL*/
+    uint32_t compress: 8;     /*Compression of the data: See `lv_image_compress_t`*/
     uint32_t user: 8;
     uint32_t reserved: 8;   /*Reserved to be used later*/
 
@@ -80,7 +95,7 @@ typedef struct {
  * the result from image converter utility*/
 typedef struct {
     lv_image_header_t header; /**< A header describing the basics of the image*/
-    uint32_t data_size;     /**< Size of the image in bytes*/
+    uint32_t data_size;     /**< Size of the image in bytes (the compressed size if `header.compress` is set)*/
     const uint8_t * data;   /**< Pointer to the data of the image*/
 } lv_image_dsc_t;
 
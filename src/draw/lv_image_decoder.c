@@ -12,23 +12,80 @@
 #include "../misc/lv_ll.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../misc/lv_cache.h"
+#include "../misc/lv_timer.h"
+#include "../misc/lv_rle.h"
+#include "../misc/lv_lz4.h"
+#include "../draw/lv_draw_buf.h"
+#include "../display/lv_display.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define img_decoder_ll_p &(LV_GLOBAL_DEFAULT()->img_decoder_ll)
+#define async LV_GLOBAL_DEFAULT()->img_decoder_async
+
+/*Save the state of the RLE decompression at every this many rows*/
+#define RLE_CHECKPOINT_ROWS     32
+
+/*Cache the checkpoints of an image with the image's source and this param1*/
+#define RLE_CHECKPOINT_CACHE_PARAM1     0x524C4500U     /*"RLE"*/
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*The state of `lv_rle_t` at the start of a row. Offsets are stored as the data is read again for files.*/
+typedef struct {
+    uint32_t in_ofs;
+    uint32_t remain;
+    uint32_t blk_ofs;           /*UINT32_MAX: the packet is a copy*/
+} rle_checkpoint_t;
+
+typedef struct {
+    const void * data;          /*The compressed data of a variable to notice if it has changed. NULL for files.*/
+    uint32_t data_size;
+    uint32_t cnt;               /*Number of saved checkpoints, the i-th is at row `i * RLE_CHECKPOINT_ROWS`*/
+    rle_checkpoint_t points[];
+} rle_checkpoints_t;
+
 typedef struct {
     lv_fs_file_t f;
     lv_color32_t * palette;
     uint8_t * img_data;
     lv_opa_t * opa;
+    uint8_t * file_data;        /*The compressed data read from a file*/
+    uint8_t * decompressed;     /*The whole decompressed image if it can't be decompressed row by row*/
+    const uint8_t * rle_data;   /*The RLE compressed data to decompress row by row*/
+    uint32_t rle_data_size;
+    lv_rle_t rle;
+    lv_coord_t rle_row;         /*The next row to decompress from `rle`*/
+    lv_cache_entry_t * rle_checkpoints_entry;
+    rle_checkpoints_t * rle_checkpoints;    /*Kept in the cache for the next time the image is opened. NULL if none.*/
+    uint32_t src_stride;        /*Size of a decompressed row*/
+    uint8_t * row_buf;          /*A row is decompressed here if it can't be decompressed in place*/
 } lv_image_decoder_built_in_data_t;
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+typedef enum {
+    ASYNC_JOB_QUEUED,
+    ASYNC_JOB_DECODING,
+    ASYNC_JOB_READY,
+    ASYNC_JOB_FAILED,
+} async_job_state_t;
+
+typedef struct {
+    char * src;                 /*Copy of the file name*/
+    lv_image_decoder_t * decoder;   /*Found on the LVGL thread as only its `open_cb` is called in the background*/
+    lv_image_header_t header;
+    async_job_state_t state;
+    lv_display_t * disp;        /*Redraw `inv_area` here when the image is ready. NULL: nothing to redraw*/
+    lv_area_t inv_area;
+    uint32_t inv_all : 1;       /*Redraw all the displays as the image is drawn on more displays*/
+} async_job_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -38,6 +95,41 @@ static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_
 
 static uint32_t img_width_to_stride(lv_image_header_t * header);
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, uint8_t * buff, uint32_t btr, uint32_t * br);
+static lv_fs_res_t fs_read_rows_at(lv_fs_file_t * f, uint32_t pos, uint32_t stride, uint8_t * buff, uint32_t len,
+                                   lv_coord_t row_cnt);
+static lv_image_decoder_t * get_info(const void * src, lv_image_header_t * header);
+static bool is_cacheable(lv_image_decoder_t * decoder, const lv_image_header_t * header);
+static bool is_cached(const void * src);
+
+static lv_result_t compressed_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header);
+static lv_result_t compressed_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static void compressed_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t open_compressed_built_in(lv_image_decoder_dsc_t * dsc);
+static uint8_t * read_compressed_file(lv_fs_file_t * f, uint32_t * size);
+static uint8_t * decompress_image(const lv_image_header_t * header, const uint8_t * in, uint32_t in_size);
+static lv_result_t decompress_rows(lv_image_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf,
+                                   uint32_t row_size);
+static void rle_checkpoints_open(lv_image_decoder_dsc_t * dsc);
+static void rle_checkpoints_close(lv_image_decoder_built_in_data_t * decoder_data);
+static void rle_checkpoint_save(lv_image_decoder_built_in_data_t * decoder_data);
+static bool rle_checkpoint_restore(lv_image_decoder_built_in_data_t * decoder_data, lv_coord_t y);
+static uint32_t get_decompressed_size(const lv_image_header_t * header);
+static uint32_t get_rle_blk_size(lv_color_format_t cf);
+static void set_img_data(lv_image_decoder_dsc_t * dsc, const uint8_t * data);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    static bool is_async_decodable(lv_image_decoder_t * decoder, const void * src);
+    static void async_init(void);
+    static void async_deinit(void);
+    static lv_result_t async_add_job(lv_image_decoder_t * decoder, const lv_image_header_t * header, const void * src,
+                                     lv_display_t * disp, const lv_area_t * inv_area);
+    static void async_forget_decoder(lv_image_decoder_t * decoder);
+    static void async_thread_cb(void * user_data);
+    static void async_timer_cb(lv_timer_t * timer);
+    static void async_invalidate(async_job_t * job);
+    static uint32_t async_get_src_hash(const char * src);
+    static bool async_is_failed(uint32_t hash);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -72,6 +164,34 @@ void _lv_image_decoder_init(void)
     lv_image_decoder_set_open_cb(decoder, lv_image_decoder_built_in_open);
     lv_image_decoder_set_get_area_cb(decoder, lv_image_decoder_built_in_get_area);
     lv_image_decoder_set_close_cb(decoder, lv_image_decoder_built_in_close);
+
+    /*Decompress the compressed images at once into the cache if they fit into it.
+     *As the decoders are tried in reverse order the built-in decoder is used only if this one can't open the image.*/
+    decoder = lv_image_decoder_create();
+    LV_ASSERT_MALLOC(decoder);
+    if(decoder == NULL) {
+        LV_LOG_WARN("out of memory");
+        return;
+    }
+
+    lv_image_decoder_set_info_cb(decoder, compressed_info);
+    lv_image_decoder_set_open_cb(decoder, compressed_open);
+    lv_image_decoder_set_close_cb(decoder, compressed_close);
+    lv_image_decoder_set_cached(decoder, true);
+    lv_image_decoder_set_thread_safe(decoder, true);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    async_init();
+#endif
+}
+
+void _lv_image_decoder_deinit(void)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC
+    async_deinit();
+#endif
+
+    _lv_ll_clear(img_decoder_ll_p);
 }
 
 /**
@@ -83,29 +203,78 @@ void _lv_image_decoder_init(void)
  */
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header)
 {
-    lv_memzero(header, sizeof(lv_image_header_t));
+    return get_info(src, header) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
 
-    if(src == NULL) return LV_RESULT_INVALID;
+lv_result_t _lv_image_decoder_get_info_async(const void * src, lv_image_header_t * header,
+                                             struct _lv_display_t * disp, const lv_area_t * inv_area, bool * ready)
+{
+    *ready = true;
 
-    lv_image_src_t src_type = lv_image_src_get_type(src);
-    if(src_type == LV_IMAGE_SRC_VARIABLE) {
-        const lv_image_dsc_t * img_dsc = src;
-        if(img_dsc->data == NULL) return LV_RESULT_INVALID;
+    lv_image_decoder_t * decoder = get_info(src, header);
+    if(decoder == NULL) return LV_RESULT_INVALID;
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*The images which wouldn't stay in the cache are decoded while drawing.
+     *It's done also if there is no display refresh which would draw the image once it's decoded.*/
+    if(disp && is_cacheable(decoder, header) && is_async_decodable(decoder, src) && !is_cached(src)) {
+        if(async_add_job(decoder, header, src, disp, inv_area) == LV_RESULT_OK) *ready = false;
     }
+#else
+    LV_UNUSED(disp);
+    LV_UNUSED(inv_area);
+#endif
 
-    lv_result_t res = LV_RESULT_INVALID;
-    lv_image_decoder_t * d;
-    _LV_LL_READ(img_decoder_ll_p, d) {
-        if(d->info_cb) {
-            res = d->info_cb(d, src, header);
-            if(res == LV_RESULT_OK) {
-                if(header->stride == 0) header->stride = img_width_to_stride(header);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_image_decoder_prefetch(const void * src)
+{
+    lv_image_header_t header;
+    lv_image_decoder_t * decoder = get_info(src, &header);
+    if(decoder == NULL) return LV_RESULT_INVALID;
+
+    /*Decoding it would be a waste if it's dropped right away*/
+    if(!is_cacheable(decoder, &header)) return LV_RESULT_INVALID;
+    if(is_cached(src)) return LV_RESULT_OK;
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    if(is_async_decodable(decoder, src)) return async_add_job(decoder, &header, src, NULL, NULL);
+#endif
+
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, src, lv_color_black(), 0);
+    if(res == LV_RESULT_OK) lv_image_decoder_close(&dsc);
+    return res;
+}
+
+void lv_image_decoder_flush(void)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*The timer exists while the threads are running*/
+    if(async.timer == NULL) return;
+
+    while(1) {
+        bool pending = false;
+        lv_mutex_lock(&async.mutex);
+        async_job_t * job;
+        _LV_LL_READ(&async.job_ll, job) {
+            if(job->state == ASYNC_JOB_QUEUED || job->state == ASYNC_JOB_DECODING) {
+                pending = true;
                 break;
             }
         }
+        lv_mutex_unlock(&async.mutex);
+
+        if(!pending) break;
+
+        /*Signaled when a thread finishes a job. Might be an other job or an earlier signal, so check again.*/
+        lv_thread_sync_wait(&async.done_sync);
     }
 
-    return res;
+    /*Invalidate the decoded images and free the jobs now instead of on the next timer period*/
+    async_timer_cb(async.timer);
+#endif
 }
 
 lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id)
@@ -171,13 +340,12 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
 }
 
 /**
- * Read a line from an opened image
+ * Decode an area of an opened image part by part, if `dsc->img_data` is NULL after opening it.
  * @param dsc pointer to `lv_image_decoder_dsc_t` used in `lv_image_decoder_open`
- * @param x start X coordinate (from left)
- * @param y start Y coordinate (from top)
- * @param len number of pixels to read
- * @param buf store the data here
- * @return LV_RESULT_OK: success; LV_RESULT_INVALID: an error occurred
+ * @param full_area the area of the image to decode, relative to the image or to its mip level `dsc->level`
+ * @param decoded_area set its `y1` to `LV_COORD_MIN` before the first call. It will be set to the decoded part
+ *                     which is stored in `dsc->img_data` with `dsc->header.stride`
+ * @return LV_RESULT_OK: a new part is decoded; LV_RESULT_INVALID: there are no more parts or an error occurred
  */
 lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
                                       lv_area_t * decoded_area)
@@ -226,6 +394,11 @@ lv_image_decoder_t * lv_image_decoder_create(void)
  */
 void lv_image_decoder_delete(lv_image_decoder_t * decoder)
 {
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*The timer exists while the threads are running*/
+    if(async.timer) async_forget_decoder(decoder);
+#endif
+
     _lv_ll_remove(img_decoder_ll_p, decoder);
     lv_free(decoder);
 }
@@ -283,6 +456,21 @@ void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decode
     decoder->close_cb = close_cb;
 }
 
+/**
+ * Tell that the decoder stores the decoded images in `lv_cache` with the image source as key.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder caches the images
+ */
+void lv_image_decoder_set_cached(lv_image_decoder_t * decoder, bool en)
+{
+    decoder->cached = en;
+}
+
+void lv_image_decoder_set_thread_safe(lv_image_decoder_t * decoder, bool en)
+{
+    decoder->thread_safe = en;
+}
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
@@ -300,6 +488,7 @@ lv_result_t lv_image_decoder_built_in_info(lv_image_decoder_t * decoder, const v
         header->h  = ((lv_image_dsc_t *)src)->header.h;
         header->cf = ((lv_image_dsc_t *)src)->header.cf;
         header->stride = ((lv_image_dsc_t *)src)->header.stride;
+        header->compress = ((lv_image_dsc_t *)src)->header.compress;
     }
     else if(src_type == LV_IMAGE_SRC_FILE) {
         /*Support only "*.bin" files*/
@@ -381,6 +570,8 @@ lv_result_t lv_image_decoder_built_in_open(lv_image_decoder_t * decoder, lv_imag
         lv_memcpy(&decoder_data->f, &f, sizeof(f));
         dsc->user_data = decoder_data;
 
+        if(dsc->header.compress != LV_IMAGE_COMPRESS_NONE) return open_compressed_built_in(dsc);
+
         /*read palette for indexed image*/
         if(LV_COLOR_FORMAT_IS_INDEXED(dsc->header.cf)) {
             uint32_t size = LV_COLOR_INDEXED_PALETTE_SIZE(dsc->header.cf);
@@ -446,43 +637,15 @@ lv_result_t lv_image_decoder_built_in_open(lv_image_decoder_t * decoder, lv_imag
             return LV_RESULT_INVALID;
         }
 
-        lv_color_format_t cf = img_dsc->header.cf;
-        if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
-            /*Need decoder data to store converted image*/
-            lv_image_decoder_built_in_data_t * decoder_data = get_decoder_data(dsc);
-            if(decoder_data == NULL) {
-                return LV_RESULT_INVALID;
-            }
-
-            uint8_t * img_data = lv_malloc(sizeof(lv_color32_t) * img_dsc->header.w *  img_dsc->header.h);
-            LV_ASSERT_NULL(img_data);
-            if(img_data == NULL) {
-                return LV_RESULT_INVALID;
-            }
-            decoder_data->img_data = img_data; /*Put to decoder data for later free*/
-
-            /*Assemble the decoded image dsc*/
-            uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf);
-            dsc->palette_size = palette_size;
-            dsc->palette = (const lv_color32_t *)img_dsc->data;
-            dsc->img_data = img_data; /*Return decoded image data.*/
-            dsc->header.cf = LV_COLOR_FORMAT_ARGB8888;
-            dsc->header.stride = dsc->header.w * 4;
-
-            uint32_t y;
-            lv_color32_t * out = (lv_color32_t *) dsc->img_data;
-            const uint8_t * in = img_dsc->data;
-            in += palette_size * 4;
-            for(y = 0; y < img_dsc->header.h; y++) {
-                decode_indexed_line(cf, dsc->palette, 0, y, img_dsc->header.w, in, out);
-            }
-        }
-        else {
-            /*In case of uncompressed formats the image stored in the ROM/RAM.
-             *So simply give its pointer*/
-            dsc->img_data = ((lv_image_dsc_t *)dsc->src)->data;
+        if(img_dsc->header.compress != LV_IMAGE_COMPRESS_NONE) {
+            if(get_decoder_data(dsc) == NULL) return LV_RESULT_INVALID;
+            return open_compressed_built_in(dsc);
         }
 
+        /*In case of uncompressed formats the image stored in the ROM/RAM.
+         *So simply give its pointer. Indexed images are drawn through their palette without conversion.*/
+        set_img_data(dsc, img_dsc->data);
+
         return LV_RESULT_OK;
     }
 
@@ -505,7 +668,12 @@ void lv_image_decoder_built_in_close(lv_image_decoder_t * decoder, lv_image_deco
 
         lv_free(decoder_data->img_data);
         lv_free(decoder_data->palette);
+        lv_free(decoder_data->file_data);
+        lv_free(decoder_data->row_buf);
+        rle_checkpoints_close(decoder_data);
+        if(decoder_data->decompressed) lv_draw_buf_free(decoder_data->decompressed);
         lv_free(decoder_data);
+        dsc->user_data = NULL;
     }
 }
 
@@ -514,51 +682,65 @@ lv_result_t lv_image_decoder_built_in_get_area(lv_image_decoder_t * decoder, lv_
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    lv_image_decoder_built_in_data_t * decoder_data = dsc->user_data;
+    if(decoder_data == NULL) return LV_RESULT_INVALID;
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
     bool supported = LV_COLOR_FORMAT_IS_INDEXED(cf)
                      || cf == LV_COLOR_FORMAT_ARGB8888 || cf == LV_COLOR_FORMAT_XRGB8888 || cf == LV_COLOR_FORMAT_RGB888
-                     || cf == LV_COLOR_FORMAT_RGB565 || cf == LV_COLOR_FORMAT_RGB565A8;
+                     || cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED
+                     || cf == LV_COLOR_FORMAT_RGB565 || cf == LV_COLOR_FORMAT_RGB565A8
+                     || decoder_data->rle_data != NULL;
     if(!supported) {
         LV_LOG_WARN("CF: %d is not supported", cf);
         return LV_RESULT_INVALID;
     }
 
-    lv_result_t res = LV_RESULT_INVALID;
-    lv_image_decoder_built_in_data_t * decoder_data = dsc->user_data;
+    lv_fs_res_t res;
     lv_fs_file_t * f = &decoder_data->f;
     uint32_t bpp = lv_color_format_get_bpp(cf);
-    lv_coord_t w_px = lv_area_get_width(full_area);
-    uint8_t * img_data = NULL;
+    uint32_t w_px = lv_area_get_width(full_area);
     uint32_t offset = sizeof(lv_image_header_t); /*All image starts with image header*/
 
-    /*We only support read line by line for now*/
+    /*Indexed images are converted to ARGB8888. RGB565A8 is returned as an RGB565 and an A8 plane*/
+    uint32_t row_size = LV_COLOR_FORMAT_IS_INDEXED(cf) ? sizeof(lv_color32_t) * w_px : w_px * bpp / 8;
+    uint32_t stride = cf == LV_COLOR_FORMAT_RGB565A8 ? w_px * 2 : row_size;
+
+    /*Read as many rows at once as fit into the buffer to have less file reads and blending*/
+    lv_coord_t band_h = LV_MAX(LV_IMAGE_DECODER_AREA_BUF_SIZE / row_size, 1);
+    band_h = LV_MIN(band_h, lv_area_get_height(full_area));
+
     if(decoded_area->y1 == LV_COORD_MIN) {
-        /*Indexed image is converted to ARGB888*/
-        uint32_t len = LV_COLOR_FORMAT_IS_INDEXED(cf) ? sizeof(lv_color32_t) * 8 : bpp;
-        len = (len * w_px) / 8;
-        img_data = lv_malloc(len);
+        uint8_t * img_data = lv_malloc(row_size * band_h);
         LV_ASSERT_NULL(img_data);
         if(img_data == NULL)
             return LV_RESULT_INVALID;
 
-        *decoded_area = *full_area;
-        decoded_area->y2 = decoded_area->y1;
+        lv_free(decoder_data->img_data);
         decoder_data->img_data = img_data; /*Free on decoder close*/
-    }
-    else {
-        decoded_area->y1++;
-        decoded_area->y2++;
-        img_data = decoder_data->img_data;
+        *decoded_area = *full_area;
+        decoded_area->y1 -= band_h;
     }
 
+    decoded_area->y1 += band_h;
+    decoded_area->y2 = LV_MIN(decoded_area->y1 + band_h - 1, full_area->y2);
     if(decoded_area->y1 > full_area->y2) {
         return LV_RESULT_INVALID;
     }
 
-    if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+    uint8_t * img_data = decoder_data->img_data;
+    lv_coord_t h = lv_area_get_height(decoded_area);
+
+    if(decoder_data->rle_data) {
+        if(decompress_rows(dsc, decoded_area, img_data, row_size) != LV_RESULT_OK) {
+            return LV_RESULT_INVALID;
+        }
+    }
+    else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
         lv_coord_t x_fraction = decoded_area->x1 % (8 / bpp);
+        uint32_t file_stride = (dsc->header.w * bpp + 7) / 8;
         uint32_t len = (w_px * bpp + 7) / 8 + 1; /*10px for 1bpp may across 3bytes*/
         uint8_t * buf = lv_malloc(len);
         LV_ASSERT_NULL(buf);
@@ -566,61 +748,53 @@ lv_result_t lv_image_decoder_built_in_get_area(lv_image_decoder_t * decoder, lv_
             return LV_RESULT_INVALID;
 
         offset += dsc->palette_size * 4; /*Skip palette*/
-        offset += decoded_area->y1 * ((dsc->header.w * bpp + 7) / 8); /*Move to y1*/
+        offset += decoded_area->y1 * file_stride; /*Move to y1*/
         offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
-        res = fs_read_file_at(f, offset, buf, len, NULL);
-        if(res != LV_FS_RES_OK) {
-            lv_free(buf);
-            return LV_RESULT_INVALID;
-        }
+        lv_coord_t y;
+        for(y = 0; y < h; y++) {
+            res = fs_read_file_at(f, offset + y * file_stride, buf, len, NULL);
+            if(res != LV_FS_RES_OK) {
+                lv_free(buf);
+                return LV_RESULT_INVALID;
+            }
 
-        decode_indexed_line(cf, dsc->palette, x_fraction, 0, w_px, buf, (lv_color32_t *)img_data);
+            decode_indexed_line(cf, dsc->palette, x_fraction, 0, w_px, buf, (lv_color32_t *)(img_data + y * row_size));
+        }
         lv_free(buf);
-
-        dsc->img_data = img_data; /*Return decoded image*/
-        return LV_RESULT_OK;
     }
-
-    if(cf == LV_COLOR_FORMAT_ARGB8888 || cf == LV_COLOR_FORMAT_XRGB8888 || cf == LV_COLOR_FORMAT_RGB888
-       || cf == LV_COLOR_FORMAT_RGB565) {
-        uint32_t len = (w_px * bpp) / 8;
-        offset += decoded_area->y1 * dsc->header.w * bpp / 8; /*Move to y1*/
-        offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
-        res = fs_read_file_at(f, offset, img_data, len, NULL);
+    else if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        uint32_t file_stride = dsc->header.w * 2;
+        uint32_t len = w_px * 2; /*The RGB565 map comes first*/
+        offset += decoded_area->y1 * file_stride; /*Move to y1*/
+        offset += decoded_area->x1 * 2; /*Move to x1*/
+        res = fs_read_rows_at(f, offset, file_stride, img_data, len, h);
         if(res != LV_FS_RES_OK) {
             return LV_RESULT_INVALID;
         }
 
-        dsc->img_data = img_data; /*Return decoded image*/
-        return LV_RESULT_OK;
-    }
-
-
-    if(cf == LV_COLOR_FORMAT_RGB565A8) {
-        bpp = 16; /* RGB565 + A8 mask*/
-        uint32_t len = (w_px * bpp) / 8; /*map comes firstly*/
-        offset += decoded_area->y1 * dsc->header.w * bpp / 8; /*Move to y1*/
-        offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
-        res = fs_read_file_at(f, offset, img_data, len, NULL);
+        /*Now the A8 mask*/
+        offset = sizeof(lv_image_header_t);
+        offset += dsc->header.h * file_stride; /*Move to A8 map*/
+        offset += decoded_area->y1 * dsc->header.w; /*Move to y1*/
+        offset += decoded_area->x1; /*Move to x1*/
+        res = fs_read_rows_at(f, offset, dsc->header.w, img_data + len * h, w_px, h);
         if(res != LV_FS_RES_OK) {
             return LV_RESULT_INVALID;
         }
-
-        /*Now the A8 mask*/
-        offset = sizeof(lv_image_header_t);
-        offset += dsc->header.h * dsc->header.w * bpp / 8; /*Move to A8 map*/
-        offset += decoded_area->y1 * dsc->header.w * 1; /*Move to y1*/
-        offset += decoded_area->x1 * 1; /*Move to x1*/
-        res = fs_read_file_at(f, offset, img_data + len, w_px * 1, NULL);
+    }
+    else {
+        uint32_t file_stride = dsc->header.w * bpp / 8;
+        offset += decoded_area->y1 * file_stride; /*Move to y1*/
+        offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
+        res = fs_read_rows_at(f, offset, file_stride, img_data, row_size, h);
         if(res != LV_FS_RES_OK) {
             return LV_RESULT_INVALID;
         }
-
-        dsc->img_data = img_data; /*Return decoded image*/
-        return LV_RESULT_OK;
     }
 
-    return LV_RESULT_INVALID;
+    dsc->img_data = img_data; /*Return decoded image*/
+    dsc->header.stride = stride;
+    return LV_RESULT_OK;
 }
 
 /**********************
@@ -714,3 +888,928 @@ static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, uint8_t * buf
 
     return LV_FS_RES_OK;
 }
+
+/**
+ * Read rows of `len` bytes from a file into a continuous buffer
+ * @param f         pointer to an opened file
+ * @param pos       position of the first byte to read
+ * @param stride    distance of the rows in the file in bytes
+ * @param buff      store the rows here, `len * row_cnt` bytes
+ * @param len       bytes to read from each row
+ * @param row_cnt   number of rows to read
+ * @return          LV_FS_RES_OK or an error
+ */
+static lv_fs_res_t fs_read_rows_at(lv_fs_file_t * f, uint32_t pos, uint32_t stride, uint8_t * buff, uint32_t len,
+                                   lv_coord_t row_cnt)
+{
+    /*Full rows are continuous in the file so read them at once*/
+    if(len == stride) return fs_read_file_at(f, pos, buff, len * row_cnt, NULL);
+
+    lv_coord_t i;
+    for(i = 0; i < row_cnt; i++) {
+        lv_fs_res_t res = fs_read_file_at(f, pos, buff, len, NULL);
+        if(res != LV_FS_RES_OK) return res;
+        pos += stride;
+        buff += len;
+    }
+
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Find the decoder which can open an image and get the info of the image
+ * @param src       the image source
+ * @param header    the image info will be stored here
+ * @return          the decoder or NULL if none of the decoders can open the image
+ */
+static lv_image_decoder_t * get_info(const void * src, lv_image_header_t * header)
+{
+    lv_memzero(header, sizeof(lv_image_header_t));
+
+    if(src == NULL) return NULL;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * img_dsc = src;
+        if(img_dsc->data == NULL) return NULL;
+    }
+
+    lv_image_decoder_t * d;
+    _LV_LL_READ(img_decoder_ll_p, d) {
+        if(d->info_cb) {
+            lv_result_t res = d->info_cb(d, src, header);
+            if(res == LV_RESULT_OK) {
+                if(header->stride == 0) header->stride = img_width_to_stride(header);
+                return d;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Check if the decoded image will be kept in the cache
+ * @param decoder   the decoder of the image
+ * @param header    the header of the image
+ * @return          true: the decoder caches its images and the image fits into the cache
+ */
+static bool is_cacheable(lv_image_decoder_t * decoder, const lv_image_header_t * header)
+{
+    if(!decoder->cached) return false;
+
+    /*Indexed images are cached with their palette and indices, I420 images with all 3 planes*/
+    bool extra_data = LV_COLOR_FORMAT_IS_INDEXED(header->cf) || header->cf == LV_COLOR_FORMAT_I420;
+    size_t size = extra_data ? get_decompressed_size(header) : (size_t)header->stride * header->h;
+    return size != 0 && size <= lv_cache_get_max_size();
+}
+
+static bool is_cached(const void * src)
+{
+    lv_cache_src_type_t cache_src_type = lv_image_src_get_type(src) == LV_IMAGE_SRC_FILE ?
+                                         LV_CACHE_SRC_TYPE_STR : LV_CACHE_SRC_TYPE_PTR;
+    lv_cache_lock();
+    bool cached = lv_cache_find(src, cache_src_type, 0, 0) != NULL;
+    lv_cache_unlock();
+
+    return cached;
+}
+
+static lv_result_t compressed_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header)
+{
+    lv_result_t res = lv_image_decoder_built_in_info(decoder, src, header);
+    if(res != LV_RESULT_OK) return res;
+
+    return header->compress != LV_IMAGE_COMPRESS_NONE ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+/**
+ * Decompress a whole image into the cache or take it from the cache
+ */
+static lv_result_t compressed_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE && strcmp(lv_fs_get_ext(dsc->src), "bin")) return LV_RESULT_INVALID;
+
+    lv_cache_src_type_t cache_src_type = dsc->src_type == LV_IMAGE_SRC_FILE ?
+                                         LV_CACHE_SRC_TYPE_STR : LV_CACHE_SRC_TYPE_PTR;
+    lv_cache_lock();
+    lv_cache_entry_t * cache = lv_cache_find_counted(dsc->src, cache_src_type, 0, 0);
+    if(cache) {
+        set_img_data(dsc, lv_cache_get_data(cache));
+        dsc->user_data = cache;     /*Save the cache to release it in compressed_close*/
+        lv_cache_unlock();
+        return LV_RESULT_OK;
+    }
+    lv_cache_unlock();
+
+    /*Let the built-in decoder decompress it row by row or only while it's drawn*/
+    uint32_t decompressed_size = get_decompressed_size(&dsc->header);
+    if(decompressed_size == 0 || decompressed_size > lv_cache_get_max_size()) return LV_RESULT_INVALID;
+
+    const uint8_t * data = NULL;
+    uint32_t data_size = 0;
+    uint8_t * file_data = NULL;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        lv_fs_file_t f;
+        if(lv_fs_open(&f, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RESULT_INVALID;
+        file_data = read_compressed_file(&f, &data_size);
+        lv_fs_close(&f);
+        if(file_data == NULL) return LV_RESULT_INVALID;
+        data = file_data;
+    }
+    else {
+        data = ((const lv_image_dsc_t *)dsc->src)->data;
+        data_size = ((const lv_image_dsc_t *)dsc->src)->data_size;
+    }
+
+    /*Decompress without locking the cache as the image might be decompressed in the background*/
+    uint32_t t = lv_tick_get();
+    uint8_t * img_data = decompress_image(&dsc->header, data, data_size);
+    t = lv_tick_elaps(t);
+    lv_free(file_data);
+    if(img_data == NULL) return LV_RESULT_INVALID;
+
+    lv_cache_lock();
+    /*Another thread might have decompressed the same image in the meantime*/
+    cache = lv_cache_find(dsc->src, cache_src_type, 0, 0);
+    if(cache) {
+        lv_draw_buf_free(img_data);
+    }
+    else {
+        cache = lv_cache_add(decompressed_size);
+        if(cache == NULL) {
+            lv_cache_unlock();
+            lv_draw_buf_free(img_data);
+            return LV_RESULT_INVALID;
+        }
+
+        cache->weight = t;
+        cache->data = img_data;
+        cache->free_data = 1;
+        cache->src_type = cache_src_type;
+        if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+            cache->src = lv_strdup(dsc->src);
+            cache->free_src = 1;
+        }
+        else {
+            cache->src = dsc->src;
+        }
+    }
+
+    set_img_data(dsc, lv_cache_get_data(cache));
+    dsc->user_data = cache;
+    lv_cache_unlock();
+
+    return LV_RESULT_OK;
+}
+
+static void compressed_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    lv_cache_lock();
+    lv_cache_release(dsc->user_data);
+    lv_cache_unlock();
+}
+
+/**
+ * Open a compressed image with the built-in decoder when it's not cached.
+ * RLE compressed images are decompressed row by row in `lv_image_decoder_built_in_get_area`,
+ * the others are decompressed at once and freed when the image is closed.
+ * @param dsc   the decoder descriptor with `user_data` already allocated
+ * @return      LV_RESULT_OK: the image is opened; LV_RESULT_INVALID: invalid data or out of memory
+ */
+static lv_result_t open_compressed_built_in(lv_image_decoder_dsc_t * dsc)
+{
+    lv_image_decoder_built_in_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+
+    const uint8_t * data;
+    uint32_t data_size;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        decoder_data->file_data = read_compressed_file(&decoder_data->f, &data_size);
+        data = decoder_data->file_data;
+    }
+    else {
+        data = ((const lv_image_dsc_t *)dsc->src)->data;
+        data_size = ((const lv_image_dsc_t *)dsc->src)->data_size;
+    }
+
+    if(data == NULL) {
+        lv_image_decoder_built_in_close(dsc->decoder, dsc);
+        return LV_RESULT_INVALID;
+    }
+
+    /*The rows of RLE compressed images can be decompressed one by one if the pixels are whole bytes.
+     *RGB565A8 would need the rows of its alpha plane too which are at the end of the data*/
+    uint32_t bpp = lv_color_format_get_bpp(cf);
+    bool indexed = LV_COLOR_FORMAT_IS_INDEXED(cf);
+    if(dsc->header.compress == LV_IMAGE_COMPRESS_RLE && cf != LV_COLOR_FORMAT_RGB565A8 &&
+       (indexed || (bpp != 0 && bpp % 8 == 0))) {
+        decoder_data->rle_data = data;
+        decoder_data->rle_data_size = data_size;
+        decoder_data->src_stride = indexed ? (dsc->header.w * bpp + 7) / 8 : dsc->header.stride;
+        decoder_data->row_buf = lv_malloc(decoder_data->src_stride);
+        LV_ASSERT_MALLOC(decoder_data->row_buf);
+
+        lv_rle_init(&decoder_data->rle, data, data_size, get_rle_blk_size(cf));
+        decoder_data->rle_row = 0;
+
+        if(decoder_data->row_buf && indexed) {
+            uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf);
+            decoder_data->palette = lv_malloc(sizeof(lv_color32_t) * palette_size);
+            LV_ASSERT_MALLOC(decoder_data->palette);
+            if(decoder_data->palette) {
+                uint32_t len = sizeof(lv_color32_t) * palette_size;
+                if(lv_rle_decompress(&decoder_data->rle, (uint8_t *)decoder_data->palette, len) != len) {
+                    LV_LOG_WARN("Invalid RLE data");
+                    lv_free(decoder_data->palette);
+                    decoder_data->palette = NULL;
+                }
+            }
+
+            dsc->palette = decoder_data->palette;
+            dsc->palette_size = palette_size;
+        }
+
+        if(decoder_data->row_buf == NULL || (indexed && decoder_data->palette == NULL)) {
+            lv_image_decoder_built_in_close(dsc->decoder, dsc);
+            return LV_RESULT_INVALID;
+        }
+
+        rle_checkpoints_open(dsc);
+
+        /*It needs to be read by get_area_cb later*/
+        return LV_RESULT_OK;
+    }
+
+    decoder_data->decompressed = decompress_image(&dsc->header, data, data_size);
+    lv_free(decoder_data->file_data);
+    decoder_data->file_data = NULL;
+    if(decoder_data->decompressed == NULL) {
+        lv_image_decoder_built_in_close(dsc->decoder, dsc);
+        return LV_RESULT_INVALID;
+    }
+
+    set_img_data(dsc, decoder_data->decompressed);
+    return LV_RESULT_OK;
+}
+
+/**
+ * Read the compressed data after the header of an image file
+ * @param f     pointer to an opened image file
+ * @param size  store the size of the compressed data here
+ * @return      the compressed data which needs to be freed with `lv_free`, or NULL on error
+ */
+static uint8_t * read_compressed_file(lv_fs_file_t * f, uint32_t * size)
+{
+    uint32_t file_size = 0;
+    lv_fs_res_t res = lv_fs_seek(f, 0, LV_FS_SEEK_END);
+    if(res == LV_FS_RES_OK) res = lv_fs_tell(f, &file_size);
+    if(res != LV_FS_RES_OK || file_size <= sizeof(lv_image_header_t)) {
+        LV_LOG_WARN("Couldn't get the size of the compressed image");
+        return NULL;
+    }
+
+    *size = file_size - sizeof(lv_image_header_t);
+    uint8_t * data = lv_malloc(*size);
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) {
+        LV_LOG_WARN("out of memory");
+        return NULL;
+    }
+
+    uint32_t br;
+    res = fs_read_file_at(f, sizeof(lv_image_header_t), data, *size, &br);
+    if(res != LV_FS_RES_OK || br != *size) {
+        LV_LOG_WARN("Couldn't read the compressed image");
+        lv_free(data);
+        return NULL;
+    }
+
+    return data;
+}
+
+/**
+ * Decompress a whole image. Indexed images are decompressed to their palette followed by the indices.
+ * @param header    the header of the image
+ * @param in        the compressed data
+ * @param in_size   size of the compressed data
+ * @return          the decompressed image which needs to be freed with `lv_draw_buf_free`, or NULL on error
+ */
+static uint8_t * decompress_image(const lv_image_header_t * header, const uint8_t * in, uint32_t in_size)
+{
+    lv_color_format_t cf = header->cf;
+    uint32_t size = get_decompressed_size(header);
+    if(size == 0) {
+        LV_LOG_WARN("Compressed images with CF: %d are not supported", cf);
+        return NULL;
+    }
+
+    uint8_t * out = lv_draw_buf_malloc(size, cf);
+    LV_ASSERT_MALLOC(out);
+    if(out == NULL) {
+        LV_LOG_WARN("out of memory");
+        return NULL;
+    }
+
+    uint32_t out_size = 0;
+    if(header->compress == LV_IMAGE_COMPRESS_RLE) {
+        lv_rle_t rle;
+        lv_rle_init(&rle, in, in_size, get_rle_blk_size(cf));
+        out_size = lv_rle_decompress(&rle, out, size);
+    }
+    else if(header->compress == LV_IMAGE_COMPRESS_LZ4) {
+        out_size = lv_lz4_decompress(in, in_size, out, size);
+    }
+
+    if(out_size != size) {
+        LV_LOG_WARN("Invalid compressed image data");
+        lv_draw_buf_free(out);
+        return NULL;
+    }
+
+    return out;
+}
+
+/**
+ * Decompress the rows of an RLE compressed image
+ * @param dsc       the decoder descriptor opened by `open_compressed_built_in`
+ * @param area      the area of the image to decompress
+ * @param buf       store the rows here, `row_size` bytes each
+ * @param row_size  size of the rows in `buf`
+ * @return          LV_RESULT_OK: decompressed; LV_RESULT_INVALID: invalid data
+ */
+static lv_result_t decompress_rows(lv_image_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf,
+                                   uint32_t row_size)
+{
+    lv_image_decoder_built_in_data_t * decoder_data = dsc->user_data;
+    lv_rle_t * rle = &decoder_data->rle;
+    lv_color_format_t cf = dsc->header.cf;
+    bool indexed = LV_COLOR_FORMAT_IS_INDEXED(cf);
+    uint32_t src_stride = decoder_data->src_stride;
+
+    /*The data can be decompressed only forward so continue from the last checkpoint before the first row,
+     *or start again if an earlier row is needed and there are no checkpoints*/
+    if(!rle_checkpoint_restore(decoder_data, area->y1) && area->y1 < decoder_data->rle_row) {
+        uint32_t palette_len = indexed ? sizeof(lv_color32_t) * LV_COLOR_INDEXED_PALETTE_SIZE(cf) : 0;
+        lv_rle_init(rle, decoder_data->rle_data, decoder_data->rle_data_size, get_rle_blk_size(cf));
+        lv_rle_decompress(rle, NULL, palette_len);
+        decoder_data->rle_row = 0;
+    }
+
+    /*Skip the rows until the next checkpoint at once*/
+    while(decoder_data->rle_row < area->y1) {
+        lv_coord_t next_checkpoint = (decoder_data->rle_row / RLE_CHECKPOINT_ROWS + 1) * RLE_CHECKPOINT_ROWS;
+        lv_coord_t n = LV_MIN(area->y1, next_checkpoint) - decoder_data->rle_row;
+        uint32_t skip = n * src_stride;
+        if(lv_rle_decompress(rle, NULL, skip) != skip) {
+            LV_LOG_WARN("Invalid RLE data");
+            decoder_data->rle_row = LV_COORD_MAX;   /*Start again on the next call*/
+            return LV_RESULT_INVALID;
+        }
+        decoder_data->rle_row += n;
+        rle_checkpoint_save(decoder_data);
+    }
+
+    /*Full rows can be decompressed directly into the buffer*/
+    bool in_place = !indexed && row_size == src_stride;
+    uint32_t x_ofs = indexed ? 0 : area->x1 * lv_color_format_get_size(cf);
+    lv_coord_t w_px = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        uint8_t * out = buf + (y - area->y1) * row_size;
+        uint8_t * row = in_place ? out : decoder_data->row_buf;
+        if(lv_rle_decompress(rle, row, src_stride) != src_stride) {
+            LV_LOG_WARN("Invalid RLE data");
+            decoder_data->rle_row = LV_COORD_MAX;   /*Start again on the next call*/
+            return LV_RESULT_INVALID;
+        }
+        decoder_data->rle_row++;
+        rle_checkpoint_save(decoder_data);
+
+        if(indexed) decode_indexed_line(cf, dsc->palette, area->x1, 0, w_px, row, (lv_color32_t *)out);
+        else if(!in_place) lv_memcpy(out, row + x_ofs, row_size);
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Find the checkpoints of an RLE compressed image in the cache or add them.
+ * The first checkpoint is saved here, the others while the rows are decompressed.
+ * @param dsc       the decoder descriptor opened by `open_compressed_built_in`
+ */
+static void rle_checkpoints_open(lv_image_decoder_dsc_t * dsc)
+{
+    lv_image_decoder_built_in_data_t * decoder_data = dsc->user_data;
+    lv_cache_src_type_t cache_src_type = dsc->src_type == LV_IMAGE_SRC_FILE ?
+                                         LV_CACHE_SRC_TYPE_STR : LV_CACHE_SRC_TYPE_PTR;
+    const void * data = dsc->src_type == LV_IMAGE_SRC_FILE ? NULL : decoder_data->rle_data;
+
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_find(dsc->src, cache_src_type, RLE_CHECKPOINT_CACHE_PARAM1, 0);
+
+    /*E.g. an image descriptor can be changed at the same address*/
+    if(e) {
+        const rle_checkpoints_t * cached = e->data;
+        if(cached->data != data || cached->data_size != decoder_data->rle_data_size) {
+            if(e->usage_count != 0) {
+                lv_cache_unlock();
+                return;
+            }
+            lv_cache_invalidate(e);
+            e = NULL;
+        }
+    }
+
+    if(e == NULL) {
+        uint32_t size = sizeof(rle_checkpoints_t) +
+                        (dsc->header.h / RLE_CHECKPOINT_ROWS + 1) * sizeof(rle_checkpoint_t);
+        rle_checkpoints_t * checkpoints = lv_draw_buf_malloc(size, LV_COLOR_FORMAT_UNKNOWN);
+        LV_ASSERT_MALLOC(checkpoints);
+        if(checkpoints == NULL) {
+            lv_cache_unlock();
+            return;
+        }
+
+        e = lv_cache_add(size);
+        if(e == NULL) {
+            lv_draw_buf_free(checkpoints);
+            lv_cache_unlock();
+            return;
+        }
+
+        checkpoints->data = data;
+        checkpoints->data_size = decoder_data->rle_data_size;
+        checkpoints->cnt = 0;
+        e->param1 = RLE_CHECKPOINT_CACHE_PARAM1;
+        e->data = checkpoints;
+        e->free_data = 1;
+        e->src_type = cache_src_type;
+        if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+            e->src = lv_strdup(dsc->src);
+            e->free_src = 1;
+        }
+        else {
+            e->src = dsc->src;
+        }
+    }
+
+    decoder_data->rle_checkpoints = (rle_checkpoints_t *)lv_cache_get_data(e);
+    decoder_data->rle_checkpoints_entry = e;
+    lv_cache_unlock();
+
+    rle_checkpoint_save(decoder_data);
+}
+
+static void rle_checkpoints_close(lv_image_decoder_built_in_data_t * decoder_data)
+{
+    if(decoder_data->rle_checkpoints_entry == NULL) return;
+
+    lv_cache_lock();
+    lv_cache_release(decoder_data->rle_checkpoints_entry);
+    lv_cache_unlock();
+    decoder_data->rle_checkpoints_entry = NULL;
+    decoder_data->rle_checkpoints = NULL;
+}
+
+/**
+ * Save the state of the decompression if the next row is the first after the saved checkpoints
+ * @param decoder_data  the data of an RLE compressed image
+ */
+static void rle_checkpoint_save(lv_image_decoder_built_in_data_t * decoder_data)
+{
+    rle_checkpoints_t * checkpoints = decoder_data->rle_checkpoints;
+    if(checkpoints == NULL || decoder_data->rle_row % RLE_CHECKPOINT_ROWS != 0) return;
+
+    /*The same image might be decompressed in an other thread too*/
+    lv_cache_lock();
+    uint32_t i = decoder_data->rle_row / RLE_CHECKPOINT_ROWS;
+    if(i == checkpoints->cnt) {
+        const lv_rle_t * rle = &decoder_data->rle;
+        rle_checkpoint_t * p = &checkpoints->points[i];
+        p->in_ofs = rle->in - decoder_data->rle_data;
+        p->remain = rle->remain;
+        p->blk_ofs = rle->blk ? (uint32_t)(rle->blk - decoder_data->rle_data) : UINT32_MAX;
+        checkpoints->cnt++;
+    }
+    lv_cache_unlock();
+}
+
+/**
+ * Continue the decompression from the last checkpoint before a row if it's closer than the current row
+ * @param decoder_data  the data of an RLE compressed image
+ * @param y             the row to decompress next
+ * @return              true: a checkpoint was restored; false: no checkpoint or the current state is better
+ */
+static bool rle_checkpoint_restore(lv_image_decoder_built_in_data_t * decoder_data, lv_coord_t y)
+{
+    rle_checkpoints_t * checkpoints = decoder_data->rle_checkpoints;
+    if(checkpoints == NULL) return false;
+
+    lv_cache_lock();
+    uint32_t cnt = checkpoints->cnt;
+    lv_cache_unlock();
+    if(cnt == 0) return false;
+
+    uint32_t i = LV_MIN((uint32_t)y / RLE_CHECKPOINT_ROWS, cnt - 1);
+    lv_coord_t row = i * RLE_CHECKPOINT_ROWS;
+    if(y >= decoder_data->rle_row && row <= decoder_data->rle_row) return false;
+
+    /*The saved checkpoints are not changed anymore*/
+    const rle_checkpoint_t * p = &checkpoints->points[i];
+    lv_rle_t * rle = &decoder_data->rle;
+    rle->in = decoder_data->rle_data + p->in_ofs;
+    rle->remain = p->remain;
+    rle->blk = p->blk_ofs == UINT32_MAX ? NULL : decoder_data->rle_data + p->blk_ofs;
+    decoder_data->rle_row = row;
+    return true;
+}
+
+/**
+ * Get the size of a decompressed image
+ * @param header    the header of the image
+ * @return          size of the data in bytes or 0 if the color format is not supported
+ */
+static uint32_t get_decompressed_size(const lv_image_header_t * header)
+{
+    lv_color_format_t cf = header->cf;
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        uint32_t stride = (header->w * lv_color_format_get_bpp(cf) + 7) / 8;
+        return LV_COLOR_INDEXED_PALETTE_SIZE(cf) * sizeof(lv_color32_t) + stride * header->h;
+    }
+
+    /*The A8 plane follows the RGB565 plane*/
+    if(cf == LV_COLOR_FORMAT_RGB565A8) return (uint32_t)header->stride * header->h + header->w * header->h;
+
+    /*The U and V planes in half resolution follow the Y plane*/
+    if(cf == LV_COLOR_FORMAT_I420) {
+        return (uint32_t)header->stride * header->h + 2 * ((header->stride + 1) / 2) * ((header->h + 1) / 2);
+    }
+
+    if(lv_color_format_get_size(cf) == 0) return 0;
+    return (uint32_t)header->stride * header->h;
+}
+
+/**
+ * Get the size of the blocks repeated or copied by the RLE packets
+ * @param cf    color format of the image
+ * @return      size of a block in bytes
+ */
+static uint32_t get_rle_blk_size(lv_color_format_t cf)
+{
+    if(cf == LV_COLOR_FORMAT_RGB565A8) return 2;
+
+    uint32_t size = lv_color_format_get_size(cf);
+    return size ? size : 1;
+}
+
+/**
+ * Set the pixels of a whole image in the decoder descriptor.
+ * Indexed images start with their palette which is followed by the indices.
+ * @param dsc   the decoder descriptor to set
+ * @param data  the data of the image
+ */
+static void set_img_data(lv_image_decoder_dsc_t * dsc, const uint8_t * data)
+{
+    lv_color_format_t cf = dsc->header.cf;
+    if(!LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        dsc->img_data = data;
+        return;
+    }
+
+    uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf);
+    dsc->palette = (const lv_color32_t *)data;
+    dsc->palette_size = palette_size;
+    dsc->img_data = data + palette_size * sizeof(lv_color32_t);
+    dsc->header.stride = (dsc->header.w * lv_color_format_get_bpp(cf) + 7) / 8;
+}
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Check if an image can be decoded in an other thread
+ * @param decoder   the decoder of the image
+ * @param src       the image source
+ * @return          true: it's a file on a thread safe driver and the decoder is thread safe too.
+ *                  The variables are not decoded in the background as they might be freed in the meantime.
+ */
+static bool is_async_decodable(lv_image_decoder_t * decoder, const void * src)
+{
+    if(!decoder->thread_safe) return false;
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE) return false;
+
+    lv_fs_drv_t * drv = lv_fs_get_drv(((const char *)src)[0]);
+    return drv && drv->thread_safe;
+}
+
+static void async_init(void)
+{
+    _lv_ll_init(&async.job_ll, sizeof(async_job_t));
+    lv_mutex_init(&async.mutex);
+    lv_thread_sync_init(&async.done_sync);
+    async.run = true;
+    lv_memzero(async.failed_hashes, sizeof(async.failed_hashes));
+    async.failed_next = 0;
+
+    async.timer = lv_timer_create(async_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    lv_timer_pause(async.timer);
+
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_sync_init(&async.syncs[i]);
+        lv_thread_sync_init(&async.exit_syncs[i]);
+        lv_thread_init(&async.threads[i], LV_THREAD_PRIO_LOW, async_thread_cb, LV_IMAGE_DECODER_ASYNC_STACK_SIZE,
+                       (void *)(uintptr_t)i);
+    }
+}
+
+static void async_deinit(void)
+{
+    lv_mutex_lock(&async.mutex);
+    async.run = false;
+    lv_mutex_unlock(&async.mutex);
+
+    /*Wake up the idle threads and wait for the busy ones to finish their image*/
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_sync_signal(&async.syncs[i]);
+    }
+
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+        lv_thread_sync_wait(&async.exit_syncs[i]);
+        lv_thread_delete(&async.threads[i]);
+        lv_thread_sync_delete(&async.syncs[i]);
+        lv_thread_sync_delete(&async.exit_syncs[i]);
+    }
+
+    async_job_t * job;
+    _LV_LL_READ(&async.job_ll, job) {
+        lv_free(job->src);
+    }
+    _lv_ll_clear(&async.job_ll);
+
+    lv_timer_del(async.timer);
+    async.timer = NULL;
+    lv_thread_sync_delete(&async.done_sync);
+    lv_mutex_delete(&async.mutex);
+}
+
+/**
+ * Queue an image file to decode in the background or update the area to redraw if it's already queued
+ * @param decoder   the decoder which will open the image
+ * @param header    the header of the image got by `decoder`
+ * @param src       the file name of the image
+ * @param disp      the display where the image is drawn, NULL for prefetching
+ * @param inv_area  the area to redraw when the image is ready, NULL to redraw the whole display
+ * @return          LV_RESULT_OK: the image is being decoded;
+ *                  LV_RESULT_INVALID: out of memory or the image couldn't be decoded recently
+ */
+static lv_result_t async_add_job(lv_image_decoder_t * decoder, const lv_image_header_t * header, const void * src,
+                                 lv_display_t * disp, const lv_area_t * inv_area)
+{
+    lv_area_t disp_area;
+    if(disp && inv_area == NULL) {
+        disp_area.x1 = 0;
+        disp_area.y1 = 0;
+        disp_area.x2 = lv_display_get_horizontal_resolution(disp) - 1;
+        disp_area.y2 = lv_display_get_vertical_resolution(disp) - 1;
+        inv_area = &disp_area;
+    }
+
+    uint32_t hash = async_get_src_hash(src);
+
+    lv_mutex_lock(&async.mutex);
+
+    /*Don't try it again, let the caller open it synchronously if it really needs it*/
+    if(async_is_failed(hash)) {
+        lv_mutex_unlock(&async.mutex);
+        return LV_RESULT_INVALID;
+    }
+
+    async_job_t * job;
+    _LV_LL_READ(&async.job_ll, job) {
+        if(strcmp(job->src, src) == 0) break;
+    }
+
+    if(job && job->state == ASYNC_JOB_FAILED) {
+        lv_mutex_unlock(&async.mutex);
+        return LV_RESULT_INVALID;
+    }
+
+    if(job == NULL) {
+        job = _lv_ll_ins_tail(&async.job_ll);
+        LV_ASSERT_MALLOC(job);
+        if(job == NULL) {
+            lv_mutex_unlock(&async.mutex);
+            return LV_RESULT_INVALID;
+        }
+
+        lv_memzero(job, sizeof(async_job_t));
+        job->src = lv_strdup(src);
+        LV_ASSERT_MALLOC(job->src);
+        if(job->src == NULL) {
+            _lv_ll_remove(&async.job_ll, job);
+            lv_free(job);
+            lv_mutex_unlock(&async.mutex);
+            return LV_RESULT_INVALID;
+        }
+        job->decoder = decoder;
+        job->header = *header;
+        job->state = ASYNC_JOB_QUEUED;
+    }
+
+    if(disp) {
+        if(job->disp == NULL) {
+            job->disp = disp;
+            job->inv_area = *inv_area;
+        }
+        else if(job->disp == disp) {
+            _lv_area_join(&job->inv_area, &job->inv_area, inv_area);
+        }
+        else {
+            job->inv_all = 1;
+        }
+    }
+
+    bool queued = job->state == ASYNC_JOB_QUEUED;
+    lv_mutex_unlock(&async.mutex);
+
+    if(queued) {
+        lv_timer_resume(async.timer);
+
+        /*The idle threads will look for the new job*/
+        uint32_t i;
+        for(i = 0; i < LV_IMAGE_DECODER_ASYNC_THREAD_CNT; i++) {
+            lv_thread_sync_signal(&async.syncs[i]);
+        }
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Make the queued jobs of a decoder fail and wait until the threads finish the images they are opening with it
+ * @param decoder   the decoder which is being deleted
+ */
+static void async_forget_decoder(lv_image_decoder_t * decoder)
+{
+    while(1) {
+        bool decoding = false;
+        lv_mutex_lock(&async.mutex);
+        async_job_t * job;
+        _LV_LL_READ(&async.job_ll, job) {
+            if(job->decoder != decoder) continue;
+            if(job->state == ASYNC_JOB_DECODING) decoding = true;
+            else job->decoder = NULL;
+        }
+        lv_mutex_unlock(&async.mutex);
+
+        if(!decoding) break;
+
+        /*Signaled when a thread finishes a job. Might be an other job or an earlier signal, so check again.*/
+        lv_thread_sync_wait(&async.done_sync);
+    }
+}
+
+static void async_thread_cb(void * user_data)
+{
+    uint32_t idx = (uint32_t)(uintptr_t)user_data;
+
+    while(1) {
+        lv_mutex_lock(&async.mutex);
+        if(!async.run) {
+            lv_mutex_unlock(&async.mutex);
+            break;
+        }
+
+        async_job_t * job;
+        _LV_LL_READ(&async.job_ll, job) {
+            if(job->state == ASYNC_JOB_QUEUED) break;
+        }
+        /*lv_image_decoder_delete() clears the decoder of the queued jobs and waits for the decoding ones*/
+        lv_image_decoder_t * decoder = NULL;
+        if(job) {
+            job->state = ASYNC_JOB_DECODING;
+            decoder = job->decoder;
+        }
+        lv_mutex_unlock(&async.mutex);
+
+        if(job == NULL) {
+            lv_thread_sync_wait(&async.syncs[idx]);
+            continue;
+        }
+
+        /*The decoder adds the image to the cache and it stays there after closing.
+         *Only the thread safe decoder of the image is called, not the `info_cb` of all decoders.*/
+        lv_result_t res = LV_RESULT_INVALID;
+        if(decoder) {
+            lv_image_decoder_dsc_t dsc;
+            lv_memzero(&dsc, sizeof(lv_image_decoder_dsc_t));
+            dsc.decoder = decoder;
+            dsc.header = job->header;
+            dsc.src_type = LV_IMAGE_SRC_FILE;
+            dsc.src = job->src;
+            dsc.color = lv_color_black();
+            res = decoder->open_cb(decoder, &dsc);
+            if(res == LV_RESULT_OK && decoder->close_cb) decoder->close_cb(decoder, &dsc);
+        }
+
+        lv_mutex_lock(&async.mutex);
+        job->state = res == LV_RESULT_OK ? ASYNC_JOB_READY : ASYNC_JOB_FAILED;
+        job->decoder = NULL;
+        lv_mutex_unlock(&async.mutex);
+        lv_thread_sync_signal(&async.done_sync);
+    }
+
+    lv_thread_sync_signal(&async.exit_syncs[idx]);
+}
+
+/**
+ * Redraw the decoded images and remove the finished jobs.
+ * Only the hash of the failed images is kept to not queue them again.
+ */
+static void async_timer_cb(lv_timer_t * timer)
+{
+    bool pending = false;
+    lv_mutex_lock(&async.mutex);
+    async_job_t * job = _lv_ll_get_head(&async.job_ll);
+    while(job) {
+        async_job_t * job_next = _lv_ll_get_next(&async.job_ll, job);
+        if(job->state == ASYNC_JOB_READY || job->state == ASYNC_JOB_FAILED) {
+            if(job->state == ASYNC_JOB_READY) {
+                async_invalidate(job);
+            }
+            else {
+                LV_LOG_WARN("Couldn't decode %s in the background", job->src);
+                async.failed_hashes[async.failed_next] = async_get_src_hash(job->src);
+                async.failed_next = (async.failed_next + 1) % _LV_IMAGE_DECODER_ASYNC_FAILED_CNT;
+            }
+            lv_free(job->src);
+            _lv_ll_remove(&async.job_ll, job);
+            lv_free(job);
+        }
+        else {
+            pending = true;
+        }
+        job = job_next;
+    }
+
+    if(!pending) lv_timer_pause(timer);
+    lv_mutex_unlock(&async.mutex);
+}
+
+static void async_invalidate(async_job_t * job)
+{
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        if(job->inv_all) {
+            lv_area_t disp_area;
+            disp_area.x1 = 0;
+            disp_area.y1 = 0;
+            disp_area.x2 = lv_display_get_horizontal_resolution(disp) - 1;
+            disp_area.y2 = lv_display_get_vertical_resolution(disp) - 1;
+            _lv_inv_area(disp, &disp_area);
+        }
+        /*The display might have been deleted in the meantime*/
+        else if(disp == job->disp) {
+            _lv_inv_area(disp, &job->inv_area);
+        }
+        disp = lv_display_get_next(disp);
+    }
+}
+
+/**
+ * FNV-1a hash of a file name
+ */
+static uint32_t async_get_src_hash(const char * src)
+{
+    uint32_t h = 2166136261U;
+    while(*src) {
+        h = (h ^ (uint8_t) * src) * 16777619U;
+        src++;
+    }
+
+    return h;
+}
+
+/**
+ * Check if an image file couldn't be decoded recently. `async.mutex` needs to be locked.
+ * In the rare case of a hash collision the image is simply decoded while drawing.
+ * @param hash      hash of the file name
+ * @return          true: the image failed recently
+ */
+static bool async_is_failed(uint32_t hash)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_IMAGE_DECODER_ASYNC_FAILED_CNT; i++) {
+        if(async.failed_hashes[i] == hash) return true;
+    }
+
+    return false;
+}
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
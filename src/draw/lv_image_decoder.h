@@ -20,10 +20,21 @@ extern "C" {
 #include "../misc/lv_fs.h"
 #include "../misc/lv_types.h"
 #include "../misc/lv_area.h"
+#include "../misc/lv_ll.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
  *********************/
+#if LV_USE_IMAGE_DECODER_ASYNC && LV_USE_OS == LV_OS_NONE
+#error "LV_USE_IMAGE_DECODER_ASYNC requires an operating system. Enable it in lv_conf.h (LV_USE_OS)"
+#endif
+
+/**The built-in decoders return this many bytes or at least one row from `get_area_cb` at once*/
+#define LV_IMAGE_DECODER_AREA_BUF_SIZE  (16 * 1024)
+
+/*The last this many image files which couldn't be decoded in the background are not queued again*/
+#define _LV_IMAGE_DECODER_ASYNC_FAILED_CNT  16
 
 /**********************
  *      TYPEDEFS
@@ -46,6 +57,7 @@ typedef uint8_t lv_image_src_t;
 
 /*Decoder function definitions*/
 struct _lv_image_decoder_dsc_t;
+struct _lv_display_t;
 struct _lv_image_decoder_t;
 
 /**
@@ -67,15 +79,17 @@ typedef lv_result_t (*lv_image_decoder_open_f_t)(struct _lv_image_decoder_t * de
                                                  struct _lv_image_decoder_dsc_t * dsc);
 
 /**
- * Decode `len` pixels starting from the given `x`, `y` coordinates and store them in `buf`.
+ * Decode the next part of an area of the image.
  * Required only if the "open" function can't return with the whole decoded pixel array.
+ * It's called repeatedly until it returns `LV_RESULT_INVALID` to get the parts of `full_area` one by one.
+ * Set `dsc->img_data` to the decoded part and `dsc->header.stride` to its stride in bytes.
  * @param decoder pointer to the decoder the function associated with
  * @param dsc pointer to decoder descriptor
- * @param x start x coordinate
- * @param y start y coordinate
- * @param len number of pixels to decode
- * @param buf a buffer to store the decoded pixels
- * @return LV_RESULT_OK: ok; LV_RESULT_INVALID: failed
+ * @param full_area the area of the image to decode, relative to the image (to the mip level `dsc->level` if
+ *                  the decoder sets `dsc->level_cnt`)
+ * @param decoded_area in the first call its `y1` is `LV_COORD_MIN`, later it's the part decoded in the last call.
+ *                     Set it to the newly decoded part.
+ * @return LV_RESULT_OK: a new part is decoded; LV_RESULT_INVALID: there are no more parts or failed
  */
 typedef lv_result_t (*lv_image_decoder_get_area_cb_t)(struct _lv_image_decoder_t * decoder,
                                                       struct _lv_image_decoder_dsc_t * dsc,
@@ -94,6 +108,15 @@ typedef struct _lv_image_decoder_t {
     lv_image_decoder_get_area_cb_t get_area_cb;
     lv_image_decoder_close_f_t close_cb;
     void * user_data;
+
+    /** The decoder stores the decoded images in `lv_cache` with the image source as key
+     * (`LV_CACHE_SRC_TYPE_STR` for files, `LV_CACHE_SRC_TYPE_PTR` for variables and 0 as parameters).
+     * These images can be prefetched.*/
+    uint32_t cached : 1;
+
+    /** The decoder can open images in other threads while LVGL is running.
+     * Only the files of these decoders are decoded in the background.*/
+    uint32_t thread_safe : 1;
 } lv_image_decoder_t;
 
 
@@ -121,9 +144,21 @@ typedef struct _lv_image_decoder_dsc_t {
      *  MUST be set in `open` function*/
     const uint8_t * img_data;
 
+    /**The colors of indexed images. If the whole image is decoded with an indexed color format,
+     * `img_data` points to the indices and `header.stride` is the size of a row of indices.
+     * Parts decoded by `get_area_cb` are ARGB8888.*/
     const lv_color32_t * palette;
     uint32_t palette_size;
 
+    /**Number of mip levels `get_area_cb` can decode. Can be set in `open` function if `img_data` is not set.
+     * If not 0, transformed images are also drawn part by part, and the smaller mip levels are used to downscale.
+     * 0: the image needs to be decoded as a whole to transform it*/
+    uint8_t level_cnt;
+
+    /**The mip level to decode by `get_area_cb`. Level `n` is the image downscaled by `2^n`, its width is
+     * `(w + 2^n - 1) >> n`, and similarly for the height. Set it before decoding the first part.*/
+    uint8_t level;
+
     /** How much time did it take to open the image. [ms]
      *  If not set `lv_image_cache` will measure and set the time to open*/
     uint32_t time_to_open;
@@ -136,6 +171,24 @@ typedef struct _lv_image_decoder_dsc_t {
     void * user_data;
 } lv_image_decoder_dsc_t;
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+struct _lv_timer_t;
+
+/**The threads and the images decoded in the background*/
+typedef struct {
+    lv_ll_t job_ll;
+    lv_mutex_t mutex;                   /**< Protects `job_ll`, the state of the jobs and `run`*/
+    lv_thread_t threads[LV_IMAGE_DECODER_ASYNC_THREAD_CNT];
+    lv_thread_sync_t syncs[LV_IMAGE_DECODER_ASYNC_THREAD_CNT];
+    lv_thread_sync_t exit_syncs[LV_IMAGE_DECODER_ASYNC_THREAD_CNT]; /**< Signaled by the threads when they exit*/
+    lv_thread_sync_t done_sync;         /**< Signaled by the threads when they finish a job*/
+    bool run;                           /**< Cleared to stop the threads*/
+    struct _lv_timer_t * timer;         /**< Invalidates the areas of the decoded images*/
+    uint32_t failed_hashes[_LV_IMAGE_DECODER_ASYNC_FAILED_CNT]; /**< Hash of the file names which couldn't be decoded*/
+    uint32_t failed_next;               /**< Index in `failed_hashes` to overwrite next*/
+} _lv_image_decoder_async_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -145,6 +198,11 @@ typedef struct _lv_image_decoder_dsc_t {
  */
 void _lv_image_decoder_init(void);
 
+/**
+ * Stop the decoder threads and free the image decoders
+ */
+void _lv_image_decoder_deinit(void);
+
 /**
  * Get information about an image.
  * Try the created image decoder one by one. Once one is able to get info that info will be used.
@@ -157,6 +215,40 @@ void _lv_image_decoder_init(void);
  */
 lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * header);
 
+/**
+ * Get information about an image which is about to be drawn and check if it's decoded.
+ * With `LV_USE_IMAGE_DECODER_ASYNC` the image files which are not in the cache yet are decoded in the background
+ * and `inv_area` is invalidated on `disp` when they are ready.
+ * @param src       the image source
+ * @param header    the image info will be stored here
+ * @param disp      the display whose refresh draws the image. NULL if nothing would redraw the image later
+ *                  (e.g. drawing on a canvas), so it's always decoded right away
+ * @param inv_area  the area to redraw when the image is ready, NULL to redraw the whole display
+ * @param ready     store here if the image can be drawn right away. Always true without `LV_USE_IMAGE_DECODER_ASYNC`
+ * @return LV_RESULT_OK: success; LV_RESULT_INVALID: wasn't able to get info about the image
+ */
+lv_result_t _lv_image_decoder_get_info_async(const void * src, lv_image_header_t * header,
+                                             struct _lv_display_t * disp, const lv_area_t * inv_area, bool * ready);
+
+/**
+ * Decode an image in advance to have it in the cache by the time it's drawn, e.g. before loading a new screen.
+ * With `LV_USE_IMAGE_DECODER_ASYNC` the image is decoded in the background if it's a file on a thread safe
+ * file system driver and its decoder is thread safe (see `lv_image_decoder_set_thread_safe`), else right away.
+ * Only the images of decoders which cache their result can be prefetched (see `lv_image_decoder_set_cached`),
+ * and only if they fit into the cache.
+ * @param src the image source. Can be
+ *  1) File name: E.g. "S:folder/img1.png" (The drivers needs to registered via `lv_fs_drv_register()`)
+ *  2) Variable: Pointer to an `lv_image_dsc_t` variable
+ * @return LV_RESULT_OK: the image is cached or it's being decoded; LV_RESULT_INVALID: the image can't be prefetched
+ */
+lv_result_t lv_image_decoder_prefetch(const void * src);
+
+/**
+ * Wait until the images queued for decoding in the background are decoded and redraw them.
+ * Useful e.g. before taking a screenshot. Does nothing without `LV_USE_IMAGE_DECODER_ASYNC`.
+ */
+void lv_image_decoder_flush(void);
+
 /**
  * Open an image.
  * Try the created image decoders one by one. Once one is able to open the image that decoder is saved in `dsc`
@@ -173,13 +265,12 @@ lv_result_t lv_image_decoder_get_info(const void * src, lv_image_header_t * head
 lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src, lv_color_t color, int32_t frame_id);
 
 /**
- * Read a line from an opened image
+ * Decode an area of an opened image part by part, if `dsc->img_data` is NULL after opening it.
  * @param dsc pointer to `lv_image_decoder_dsc_t` used in `lv_image_decoder_open`
- * @param x start X coordinate (from left)
- * @param y start Y coordinate (from top)
- * @param len number of pixels to read
- * @param buf store the data here
- * @return LV_RESULT_OK: success; LV_RESULT_INVALID: an error occurred
+ * @param full_area the area of the image to decode, relative to the image or to its mip level `dsc->level`
+ * @param decoded_area set its `y1` to `LV_COORD_MIN` before the first call. It will be set to the decoded part
+ *                     which is stored in `dsc->img_data` with `dsc->header.stride`
+ * @return LV_RESULT_OK: a new part is decoded; LV_RESULT_INVALID: there are no more parts or an error occurred
  */
 lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
                                       lv_area_t * decoded_area);
@@ -237,6 +328,24 @@ void lv_image_decoder_set_get_area_cb(lv_image_decoder_t * decoder, lv_image_dec
  */
 void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decoder_close_f_t close_cb);
 
+/**
+ * Tell that the decoder stores the decoded images in `lv_cache` with the image source as key.
+ * (`LV_CACHE_SRC_TYPE_STR` for files, `LV_CACHE_SRC_TYPE_PTR` for variables and 0 as parameters)
+ * It allows decoding its images in the background and prefetching them.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder caches the images
+ */
+void lv_image_decoder_set_cached(lv_image_decoder_t * decoder, bool en);
+
+/**
+ * Tell that the callbacks of the decoder can be called from an other thread while LVGL is running,
+ * even for more images at once. With `LV_USE_IMAGE_DECODER_ASYNC` the cached images of these decoders
+ * are decoded in the background.
+ * @param decoder pointer to an image decoder
+ * @param en true: the decoder is thread safe
+ */
+void lv_image_decoder_set_thread_safe(lv_image_decoder_t * decoder, bool en);
+
 /**
  * Get info about a built-in image
  * @param decoder the decoder where this function belongs
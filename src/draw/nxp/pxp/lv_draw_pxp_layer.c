@@ -55,6 +55,7 @@ void lv_draw_pxp_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * d
         return;
 
     lv_image_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(lv_image_dsc_t));
     img_dsc.header.w = layer_to_draw->draw_buf.width;
     img_dsc.header.h = layer_to_draw->draw_buf.height;
     img_dsc.header.cf = layer_to_draw->draw_buf.color_format;
@@ -112,7 +112,8 @@ static inline bool _vglite_cf_supported(lv_color_format_t cf)
 {
     // Add here the platform specific code for supported formats.
 
-    bool is_cf_unsupported = (cf == LV_COLOR_FORMAT_RGB565A8 || cf == LV_COLOR_FORMAT_RGB888);
+    bool is_cf_unsupported = (cf == LV_COLOR_FORMAT_RGB565A8 || cf == LV_COLOR_FORMAT_RGB888 ||
+                              cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
 
     return (!is_cf_unsupported);
 }
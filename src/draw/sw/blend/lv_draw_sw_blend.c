@@ -9,6 +9,7 @@
 #include "../lv_draw_sw.h"
 #include "lv_draw_sw_blend_to_rgb565.h"
 #include "lv_draw_sw_blend_to_argb8888.h"
+#include "lv_draw_sw_blend_to_argb8888_premultiplied.h"
 #include "lv_draw_sw_blend_to_rgb888.h"
 
 #if LV_USE_DRAW_SW
@@ -16,6 +17,14 @@
 /*********************
  *      DEFINES
  *********************/
+/*Max. number of spans a masked line is split into*/
+#define SPAN_MAX    16
+
+/*Indexed images are blended in chunks of this many pixels after looking up their colors*/
+#define INDEXED_CHUNK_W     64
+
+/*YUV images are blended in chunks of this many pixels if they can't be converted right into the layer*/
+#define YUV_CHUNK_W         64
 
 /**********************
  *      TYPEDEFS
@@ -24,6 +33,23 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void blend_clipped_area(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                               const lv_area_t * blend_area);
+
+static void blend_indexed(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                          const lv_area_t * blend_area);
+
+static void blend_yuv(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                      const lv_area_t * blend_area);
+
+#if LV_DRAW_SW_COMPLEX
+static uint32_t clip_spans(const lv_draw_sw_blend_dsc_t * blend_dsc, const lv_area_t * blend_area,
+                           lv_draw_sw_mask_span_t spans[], uint32_t span_max);
+
+static void blend_spans(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                        const lv_area_t * blend_area);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -45,6 +71,28 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
     lv_area_t blend_area;
     if(!_lv_area_intersect(&blend_area, blend_dsc->blend_area, draw_unit->clip_area)) return;
 
+#if LV_DRAW_SW_COMPLEX
+    /*Masked lines are typically transparent or fully covered except a few anti-aliased pixels.
+     *Split them to spans to skip the transparent parts and fill the covered parts without mask*/
+    if(blend_dsc->mask_buf && blend_dsc->mask_res == LV_DRAW_SW_MASK_RES_CHANGED &&
+       blend_area.y1 == blend_area.y2 &&
+       (blend_dsc->mask_spans || lv_area_get_width(&blend_area) >= 2 * LV_DRAW_SW_MASK_SPAN_MIN_LEN)) {
+        blend_spans(draw_unit, blend_dsc, &blend_area);
+        return;
+    }
+#endif
+
+    blend_clipped_area(draw_unit, blend_dsc, &blend_area);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void blend_clipped_area(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                               const lv_area_t * blend_area_ori)
+{
+    lv_area_t blend_area = *blend_area_ori;
     lv_layer_t * layer = draw_unit->target_layer;
 
     if(blend_dsc->src_buf == NULL) {
@@ -76,6 +124,9 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
             case LV_COLOR_FORMAT_ARGB8888:
                 lv_draw_sw_blend_color_to_argb8888(&fill_dsc);
                 break;
+            case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+                lv_draw_sw_blend_color_to_argb8888_premultiplied(&fill_dsc);
+                break;
             case LV_COLOR_FORMAT_RGB888:
                 lv_draw_sw_blend_color_to_rgb888(&fill_dsc, 3);
                 break;
@@ -89,6 +140,16 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
     else {
         if(!_lv_area_intersect(&blend_area, &blend_area, blend_dsc->src_area)) return;
 
+        if(LV_COLOR_FORMAT_IS_INDEXED(blend_dsc->src_color_format)) {
+            blend_indexed(draw_unit, blend_dsc, &blend_area);
+            return;
+        }
+
+        if(blend_dsc->src_color_format == LV_COLOR_FORMAT_I420) {
+            blend_yuv(draw_unit, blend_dsc, &blend_area);
+            return;
+        }
+
         _lv_draw_sw_blend_image_dsc_t image_dsc;
         image_dsc.dest_w = lv_area_get_width(&blend_area);
         image_dsc.dest_h = lv_area_get_height(&blend_area);
@@ -127,6 +188,9 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
             case LV_COLOR_FORMAT_ARGB8888:
                 lv_draw_sw_blend_image_to_argb8888(&image_dsc);
                 break;
+            case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+                lv_draw_sw_blend_image_to_argb8888_premultiplied(&image_dsc);
+                break;
             case LV_COLOR_FORMAT_RGB888:
                 lv_draw_sw_blend_image_to_rgb888(&image_dsc, 3);
                 break;
@@ -139,9 +203,230 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
     }
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+/**
+ * Blend an indexed image without converting the whole image. The colors of a few pixels are looked up
+ * from the converted palette at once and blended as a normal image.
+ * @param draw_unit     pointer to a draw unit
+ * @param blend_dsc     the blend descriptor with an indexed `src_buf` and `src_palette`
+ * @param blend_area    the area to blend, already clipped to the image and the clip area
+ */
+static void blend_indexed(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                          const lv_area_t * blend_area)
+{
+    const lv_draw_sw_blend_palette_t * palette = blend_dsc->src_palette;
+    if(palette == NULL) {
+        LV_LOG_WARN("No palette for the indexed image");
+        return;
+    }
+
+    lv_color32_t chunk_buf[INDEXED_CHUNK_W];
+    lv_opa_t chunk_a8[INDEXED_CHUNK_W];
+    bool has_a8 = palette->cf == LV_COLOR_FORMAT_RGB565A8;
+    bool masked = blend_dsc->mask_buf && blend_dsc->mask_res != LV_DRAW_SW_MASK_RES_FULL_COVER;
+
+    lv_area_t chunk_area;
+    lv_draw_sw_blend_dsc_t chunk_dsc = *blend_dsc;
+    chunk_dsc.src_buf = chunk_buf;
+    chunk_dsc.src_color_format = has_a8 ? LV_COLOR_FORMAT_RGB565 : palette->cf;
+    chunk_dsc.src_palette = NULL;
+    chunk_dsc.src_stride = INDEXED_CHUNK_W * lv_color_format_get_size(chunk_dsc.src_color_format);
+    chunk_dsc.src_area = &chunk_area;
+
+    /*The alpha of the pixels is applied as a mask which is mixed with the original mask*/
+    if(has_a8) {
+        chunk_dsc.mask_buf = chunk_a8;
+        chunk_dsc.mask_area = &chunk_area;
+        chunk_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    }
+
+    const uint8_t * src_buf = blend_dsc->src_buf;
+    int32_t mask_stride = masked ? lv_area_get_width(blend_dsc->mask_area) : 0;
+    int32_t y;
+    for(y = blend_area->y1; y <= blend_area->y2; y++) {
+        const uint8_t * src_row = src_buf + (y - blend_dsc->src_area->y1) * blend_dsc->src_stride;
+        chunk_area.y1 = y;
+        chunk_area.y2 = y;
+        int32_t x;
+        for(x = blend_area->x1; x <= blend_area->x2; x += INDEXED_CHUNK_W) {
+            chunk_area.x1 = x;
+            chunk_area.x2 = LV_MIN(x + INDEXED_CHUNK_W - 1, blend_area->x2);
+            int32_t chunk_w = lv_area_get_width(&chunk_area);
+            lv_draw_sw_blend_palette_lookup(palette, blend_dsc->src_color_format, src_row,
+                                            x - blend_dsc->src_area->x1, chunk_w, chunk_buf, chunk_a8);
+
+            if(has_a8 && masked) {
+                const lv_opa_t * mask = blend_dsc->mask_buf + (y - blend_dsc->mask_area->y1) * mask_stride +
+                                        (x - blend_dsc->mask_area->x1);
+                int32_t i;
+                for(i = 0; i < chunk_w; i++) chunk_a8[i] = LV_OPA_MIX2(chunk_a8[i], mask[i]);
+            }
+
+            blend_clipped_area(draw_unit, &chunk_dsc, &chunk_area);
+        }
+    }
+}
+
+/**
+ * Blend an I420 image. If the image simply covers the layer its pixels are converted right into the layer.
+ * Else the colors of a few pixels are converted at once and blended as a normal image.
+ * @param draw_unit     pointer to a draw unit
+ * @param blend_dsc     the blend descriptor with an I420 `src_buf`
+ * @param blend_area    the area to blend, already clipped to the image and the clip area
+ */
+static void blend_yuv(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                      const lv_area_t * blend_area)
+{
+    lv_layer_t * layer = draw_unit->target_layer;
+    lv_color_format_t dest_cf = layer->draw_buf.color_format;
+
+    lv_draw_sw_blend_yuv_planes_t planes;
+    lv_draw_sw_blend_yuv_planes_init(&planes, blend_dsc->src_buf, blend_dsc->src_stride,
+                                     lv_area_get_height(blend_dsc->src_area));
+
+    int32_t src_x = blend_area->x1 - blend_dsc->src_area->x1;
+    int32_t y;
+
+    bool masked = blend_dsc->mask_buf && blend_dsc->mask_res != LV_DRAW_SW_MASK_RES_FULL_COVER;
+    bool direct = !masked && blend_dsc->opa >= LV_OPA_MAX && blend_dsc->blend_mode == LV_BLEND_MODE_NORMAL &&
+                  (dest_cf == LV_COLOR_FORMAT_RGB565 || dest_cf == LV_COLOR_FORMAT_RGB888 ||
+                   dest_cf == LV_COLOR_FORMAT_XRGB8888 || dest_cf == LV_COLOR_FORMAT_ARGB8888 ||
+                   dest_cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+
+    if(direct) {
+        int32_t w = lv_area_get_width(blend_area);
+        for(y = blend_area->y1; y <= blend_area->y2; y++) {
+            void * dest = lv_draw_buf_go_to_xy(&layer->draw_buf, blend_area->x1 - layer->draw_buf_ofs.x,
+                                               y - layer->draw_buf_ofs.y);
+            lv_draw_sw_blend_yuv_convert(&planes, src_x, y - blend_dsc->src_area->y1, w, dest, dest_cf);
+        }
+        return;
+    }
+
+    lv_color32_t chunk_buf[YUV_CHUNK_W];
+    lv_area_t chunk_area;
+    lv_draw_sw_blend_dsc_t chunk_dsc = *blend_dsc;
+    chunk_dsc.src_buf = chunk_buf;
+    bool rgb565 = dest_cf == LV_COLOR_FORMAT_RGB565 || dest_cf == LV_COLOR_FORMAT_RGB565A8;
+    chunk_dsc.src_color_format = rgb565 ? LV_COLOR_FORMAT_RGB565 : LV_COLOR_FORMAT_XRGB8888;
+    chunk_dsc.src_stride = YUV_CHUNK_W * lv_color_format_get_size(chunk_dsc.src_color_format);
+    chunk_dsc.src_area = &chunk_area;
+
+    for(y = blend_area->y1; y <= blend_area->y2; y++) {
+        chunk_area.y1 = y;
+        chunk_area.y2 = y;
+        int32_t x;
+        for(x = blend_area->x1; x <= blend_area->x2; x += YUV_CHUNK_W) {
+            chunk_area.x1 = x;
+            chunk_area.x2 = LV_MIN(x + YUV_CHUNK_W - 1, blend_area->x2);
+            lv_draw_sw_blend_yuv_convert(&planes, x - blend_dsc->src_area->x1, y - blend_dsc->src_area->y1,
+                                         lv_area_get_width(&chunk_area), chunk_buf, chunk_dsc.src_color_format);
+            blend_clipped_area(draw_unit, &chunk_dsc, &chunk_area);
+        }
+    }
+}
+
+#if LV_DRAW_SW_COMPLEX
+/**
+ * Clip the spans given in the blend descriptor to the blend area
+ * @param blend_dsc     the blend descriptor with `mask_spans`
+ * @param blend_area    the clipped area of a single line
+ * @param spans         store the spans relative to `blend_area` here
+ * @param span_max      size of `spans`. If there are more spans the remaining pixels are merged into the last span.
+ * @return              number of spans written into `spans`
+ */
+static uint32_t clip_spans(const lv_draw_sw_blend_dsc_t * blend_dsc, const lv_area_t * blend_area,
+                           lv_draw_sw_mask_span_t spans[], uint32_t span_max)
+{
+    lv_coord_t ofs = blend_area->x1 - blend_dsc->mask_area->x1;
+    lv_coord_t len = lv_area_get_width(blend_area);
+
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < blend_dsc->mask_span_cnt; i++) {
+        lv_coord_t x1 = LV_MAX(blend_dsc->mask_spans[i].x - ofs, 0);
+        lv_coord_t x2 = LV_MIN(blend_dsc->mask_spans[i].x + blend_dsc->mask_spans[i].len - ofs, len);
+        if(x1 >= x2) continue;
+
+        if(cnt == span_max) {
+            spans[cnt - 1].len = x2 - spans[cnt - 1].x;
+            spans[cnt - 1].res = LV_DRAW_SW_MASK_RES_CHANGED;
+            continue;
+        }
+
+        spans[cnt].x = x1;
+        spans[cnt].len = x2 - x1;
+        spans[cnt].res = blend_dsc->mask_spans[i].res;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+static void blend_spans(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t * blend_dsc,
+                        const lv_area_t * blend_area)
+{
+    const lv_opa_t * mask_buf = blend_dsc->mask_buf;
+    mask_buf += lv_area_get_width(blend_dsc->mask_area) * (blend_area->y1 - blend_dsc->mask_area->y1) +
+                (blend_area->x1 - blend_dsc->mask_area->x1);
+
+    lv_draw_sw_mask_span_t spans[SPAN_MAX];
+    uint32_t span_cnt;
+    if(blend_dsc->mask_spans) span_cnt = clip_spans(blend_dsc, blend_area, spans, SPAN_MAX);
+    else span_cnt = lv_draw_sw_mask_get_spans(mask_buf, lv_area_get_width(blend_area), spans, SPAN_MAX);
+
+    /*Fully covered spans are filled with `opa` instead of masking with 255.
+     *Use the same opacity what the masked kernels would calculate to get the same result.
+     *Images mix the mask with their own alpha channel so for them only the transparent spans are skipped.*/
+    lv_opa_t cover_opa = blend_dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : LV_OPA_MIX2(LV_OPA_COVER, blend_dsc->opa);
+    bool cover_unmasked = blend_dsc->src_buf == NULL && cover_opa > LV_OPA_MIN;
+
+    /*On ARGB8888 the masked kernels also write the color of fully transparent destination pixels,
+     *so the transparent spans can't be skipped there. The premultiplied kernels leave them unchanged.*/
+    bool transp_skip = draw_unit->target_layer->draw_buf.color_format != LV_COLOR_FORMAT_ARGB8888;
+
+    lv_draw_sw_blend_dsc_t span_dsc = *blend_dsc;
+    lv_area_t span_area;
+    span_area.y1 = blend_area->y1;
+    span_area.y2 = blend_area->y2;
+
+    /*Adjacent spans which need the mask are collected and blended in one step*/
+    lv_coord_t masked_x1 = 0;
+    lv_coord_t masked_len = 0;
+
+    uint32_t i;
+    for(i = 0; i <= span_cnt; i++) {
+        bool masked = false;
+        if(i < span_cnt) {
+            if(spans[i].res == LV_DRAW_SW_MASK_RES_CHANGED) masked = true;
+            else if(spans[i].res == LV_DRAW_SW_MASK_RES_TRANSP) masked = !transp_skip;
+            else masked = !cover_unmasked;
+        }
+
+        if(masked) {
+            if(masked_len == 0) masked_x1 = spans[i].x;
+            masked_len += spans[i].len;
+            continue;
+        }
+
+        if(masked_len) {
+            span_area.x1 = blend_area->x1 + masked_x1;
+            span_area.x2 = span_area.x1 + masked_len - 1;
+            span_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+            span_dsc.opa = blend_dsc->opa;
+            blend_clipped_area(draw_unit, &span_dsc, &span_area);
+            masked_len = 0;
+        }
+
+        if(i < span_cnt && spans[i].res == LV_DRAW_SW_MASK_RES_FULL_COVER) {
+            span_area.x1 = blend_area->x1 + spans[i].x;
+            span_area.x2 = span_area.x1 + spans[i].len - 1;
+            span_dsc.mask_res = LV_DRAW_SW_MASK_RES_FULL_COVER;
+            span_dsc.opa = cover_opa;
+            blend_clipped_area(draw_unit, &span_dsc, &span_area);
+        }
+    }
+}
+#endif
 
 #endif
 
@@ -19,6 +19,8 @@ extern "C" {
 #include "../../../misc/lv_color.h"
 #include "../../../misc/lv_area.h"
 #include "../../../misc/lv_style.h"
+#include "lv_draw_sw_blend_indexed.h"
+#include "lv_draw_sw_blend_yuv.h"
 
 /*********************
  *      DEFINES
@@ -34,12 +36,16 @@ typedef struct {
     const void * src_buf;     /**< Pointer to an image to blend. If set `fill_color` is ignored */
     uint32_t src_stride;
     lv_color_format_t src_color_format;
+    const lv_draw_sw_blend_palette_t * src_palette; /**< The converted palette if `src_color_format` is indexed*/
     const lv_area_t * src_area;
     lv_opa_t opa;                   /**< The overall opacity*/
     lv_color_t color;               /**< Fill color*/
     const lv_opa_t * mask_buf;      /**< NULL if ignored, or an alpha mask to apply on `blend_area`*/
     lv_draw_sw_mask_res_t mask_res;    /**< The result of the previous mask operation */
     const lv_area_t * mask_area;    /**< The area of `mask_buf` with absolute coordinates*/
+    const lv_draw_sw_mask_span_t * mask_spans; /**< Optional spans of a single line `mask_buf`
+                                                 *   from `lv_draw_sw_mask_apply_spans`*/
+    uint32_t mask_span_cnt;         /**< Number of `mask_spans`*/
     lv_blend_mode_t blend_mode;     /**< E.g. LV_BLEND_MODE_ADDITIVE*/
 } lv_draw_sw_blend_dsc_t;
 
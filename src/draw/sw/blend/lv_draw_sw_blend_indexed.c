@@ -0,0 +1,229 @@
+/**
+ * @file lv_draw_sw_blend_indexed.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_indexed.h"
+#if LV_USE_DRAW_SW
+
+#include "../../../misc/lv_color_op.h"
+#include "../../../misc/lv_assert.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../lv_draw_buf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The palettes are cached with their address as source and these parameters*/
+#define PALETTE_CACHE_PARAM1(dest_cf, recolor_opa, size) \
+    (0x80000000U | ((size) << 16) | ((recolor_opa) << 8) | (dest_cf))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*A converted palette in the cache. It's followed by the colors it was converted from.*/
+typedef struct {
+    lv_draw_sw_blend_palette_t converted;
+    lv_color32_t colors[];
+} cached_palette_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool colors_equal(const lv_color32_t * c1, const lv_color32_t * c2, uint32_t cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_blend_palette_init(lv_draw_sw_blend_palette_t * dsc, const lv_color32_t * palette,
+                                   uint32_t palette_size, lv_color_format_t dest_cf,
+                                   lv_color_t recolor, lv_opa_t recolor_opa)
+{
+    if(palette_size > 256) palette_size = 256;
+
+    /*Opaque palettes can be blended as images without alpha channel*/
+    bool opaque = true;
+    uint32_t i;
+    for(i = 0; i < palette_size; i++) {
+        if(palette[i].alpha != LV_OPA_COVER) {
+            opaque = false;
+            break;
+        }
+    }
+
+    /*Recolor the same way as the images without palette*/
+    uint16_t c_mult[3] = {0};
+    lv_opa_t mix_inv = 255 - recolor_opa;
+    bool recolored = recolor_opa > LV_OPA_MIN;
+    if(recolored) {
+        c_mult[0] = recolor.blue * recolor_opa;
+        c_mult[1] = recolor.green * recolor_opa;
+        c_mult[2] = recolor.red * recolor_opa;
+    }
+
+    bool rgb565 = dest_cf == LV_COLOR_FORMAT_RGB565 || dest_cf == LV_COLOR_FORMAT_RGB565A8;
+    bool premultiplied = dest_cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+
+    if(rgb565) dsc->cf = opaque ? LV_COLOR_FORMAT_RGB565 : LV_COLOR_FORMAT_RGB565A8;
+    else if(opaque) dsc->cf = LV_COLOR_FORMAT_XRGB8888;
+    else if(premultiplied) dsc->cf = LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
+    else dsc->cf = LV_COLOR_FORMAT_ARGB8888;
+
+    for(i = 0; i < palette_size; i++) {
+        lv_color32_t c = palette[i];
+        if(recolored) {
+            c.blue = (c_mult[0] + c.blue * mix_inv) >> 8;
+            c.green = (c_mult[1] + c.green * mix_inv) >> 8;
+            c.red = (c_mult[2] + c.red * mix_inv) >> 8;
+        }
+
+        if(rgb565) {
+            dsc->lut.rgb565.c16[i] = ((c.red & 0xF8) << 8) + ((c.green & 0xFC) << 3) + ((c.blue & 0xF8) >> 3);
+            dsc->lut.rgb565.a8[i] = c.alpha;
+        }
+        else if(premultiplied) {
+            dsc->lut.c32[i] = lv_color32_premultiply(c);
+        }
+        else {
+            dsc->lut.c32[i] = c;
+        }
+    }
+}
+
+const lv_draw_sw_blend_palette_t * lv_draw_sw_blend_palette_get(const lv_color32_t * palette, uint32_t palette_size,
+                                                                lv_color_format_t dest_cf, lv_color_t recolor,
+                                                                lv_opa_t recolor_opa, lv_cache_entry_t ** entry)
+{
+    if(palette_size > 256) palette_size = 256;
+    if(recolor_opa <= LV_OPA_MIN) {
+        recolor_opa = LV_OPA_TRANSP;
+        recolor = lv_color_black();
+    }
+
+    uint32_t param1 = PALETTE_CACHE_PARAM1((uint32_t)dest_cf, (uint32_t)recolor_opa, palette_size);
+    uint32_t param2 = lv_color_to_int(recolor);
+
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_find(palette, LV_CACHE_SRC_TYPE_PTR, param1, param2);
+
+    /*E.g. the palette of a canvas can be changed at the same address*/
+    if(e && !colors_equal(((const cached_palette_t *)e->data)->colors, palette, palette_size)) {
+        if(e->usage_count == 0) lv_cache_invalidate(e);
+        e = NULL;
+    }
+
+    if(e == NULL) {
+        uint32_t size = sizeof(cached_palette_t) + palette_size * sizeof(lv_color32_t);
+        cached_palette_t * cached = lv_draw_buf_malloc(size, LV_COLOR_FORMAT_UNKNOWN);
+        LV_ASSERT_MALLOC(cached);
+        if(cached == NULL) {
+            lv_cache_unlock();
+            return NULL;
+        }
+
+        e = lv_cache_add(size);
+        if(e == NULL) {
+            lv_draw_buf_free(cached);
+            lv_cache_unlock();
+            return NULL;
+        }
+
+        lv_draw_sw_blend_palette_init(&cached->converted, palette, palette_size, dest_cf, recolor, recolor_opa);
+        lv_memcpy(cached->colors, palette, palette_size * sizeof(lv_color32_t));
+        e->src = palette;
+        e->src_type = LV_CACHE_SRC_TYPE_PTR;
+        e->param1 = param1;
+        e->param2 = param2;
+        e->data = cached;
+        e->free_data = 1;
+    }
+
+    const cached_palette_t * cached = lv_cache_get_data(e);
+    lv_cache_unlock();
+
+    *entry = e;
+    return &cached->converted;
+}
+
+void lv_draw_sw_blend_palette_release(lv_cache_entry_t * entry)
+{
+    lv_cache_lock();
+    lv_cache_release(entry);
+    lv_cache_unlock();
+}
+
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_palette_lookup(const lv_draw_sw_blend_palette_t * dsc,
+                                                           lv_color_format_t src_cf, const uint8_t * src,
+                                                           int32_t src_x, int32_t w, void * dest, lv_opa_t * dest_a8)
+{
+    bool rgb565 = dsc->cf == LV_COLOR_FORMAT_RGB565 || dsc->cf == LV_COLOR_FORMAT_RGB565A8;
+    bool has_a8 = dsc->cf == LV_COLOR_FORMAT_RGB565A8;
+    uint16_t * dest16 = dest;
+    lv_color32_t * dest32 = dest;
+    int32_t i;
+
+    if(src_cf == LV_COLOR_FORMAT_I8) {
+        src += src_x;
+        if(!rgb565) {
+            for(i = 0; i < w; i++) dest32[i] = dsc->lut.c32[src[i]];
+        }
+        else {
+            for(i = 0; i < w; i++) dest16[i] = dsc->lut.rgb565.c16[src[i]];
+            if(has_a8) for(i = 0; i < w; i++) dest_a8[i] = dsc->lut.rgb565.a8[src[i]];
+        }
+        return;
+    }
+
+    /*The pixels are stored from the most significant bits in the bytes*/
+    uint32_t bpp = lv_color_format_get_bpp(src_cf);
+    uint32_t px_mask = (1 << bpp) - 1;
+    src += (src_x * bpp) >> 3;
+    int32_t shift = 8 - bpp - ((src_x * bpp) & 0x7);
+
+    for(i = 0; i < w; i++) {
+        uint32_t idx = (*src >> shift) & px_mask;
+        if(!rgb565) {
+            dest32[i] = dsc->lut.c32[idx];
+        }
+        else {
+            dest16[i] = dsc->lut.rgb565.c16[idx];
+            if(has_a8) dest_a8[i] = dsc->lut.rgb565.a8[idx];
+        }
+
+        shift -= bpp;
+        if(shift < 0) {
+            shift = 8 - bpp;
+            src++;
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool colors_equal(const lv_color32_t * c1, const lv_color32_t * c2, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(c1[i].blue != c2[i].blue || c1[i].green != c2[i].green ||
+           c1[i].red != c2[i].red || c1[i].alpha != c2[i].alpha) return false;
+    }
+
+    return true;
+}
+
+#endif /*LV_USE_DRAW_SW*/
@@ -0,0 +1,112 @@
+/**
+ * @file lv_draw_sw_blend_indexed.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_INDEXED_H
+#define LV_DRAW_SW_BLEND_INDEXED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW
+
+#include "../../../misc/lv_color.h"
+#include "../../../misc/lv_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * The palette of an indexed image converted to a format which can be blended quickly to a given color format.
+ * Blending an indexed image looks up the colors of the indices in this table.
+ */
+typedef struct {
+    /**The format of the looked up colors:
+     * - `LV_COLOR_FORMAT_RGB565`: `rgb565.c16` is used
+     * - `LV_COLOR_FORMAT_RGB565A8`: `rgb565.c16` and `rgb565.a8` are used
+     * - `LV_COLOR_FORMAT_XRGB8888`, `LV_COLOR_FORMAT_ARGB8888` or `LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED`:
+     *   `c32` is used*/
+    lv_color_format_t cf;
+    union {
+        lv_color32_t c32[256];
+        struct {
+            uint16_t c16[256];
+            lv_opa_t a8[256];
+        } rgb565;
+    } lut;
+} lv_draw_sw_blend_palette_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Convert the palette of an indexed image to be blended to a given color format
+ * @param dsc           store the converted palette here
+ * @param palette       the colors of the image
+ * @param palette_size  number of colors in `palette`
+ * @param dest_cf       the color format to blend to
+ * @param recolor       mix the colors with this color...
+ * @param recolor_opa   ...with this ratio
+ */
+void lv_draw_sw_blend_palette_init(lv_draw_sw_blend_palette_t * dsc, const lv_color32_t * palette,
+                                   uint32_t palette_size, lv_color_format_t dest_cf,
+                                   lv_color_t recolor, lv_opa_t recolor_opa);
+
+/**
+ * Get the converted palette of an indexed image from the cache, or convert it and add it to the cache.
+ * The palettes are found by their address, and the colors are compared in case they were changed.
+ * @param palette       the colors of the image
+ * @param palette_size  number of colors in `palette`
+ * @param dest_cf       the color format to blend to
+ * @param recolor       mix the colors with this color...
+ * @param recolor_opa   ...with this ratio
+ * @param entry         store the cache entry here. Release it with `lv_draw_sw_blend_palette_release`.
+ * @return              the converted palette or NULL on error
+ */
+const lv_draw_sw_blend_palette_t * lv_draw_sw_blend_palette_get(const lv_color32_t * palette, uint32_t palette_size,
+                                                                lv_color_format_t dest_cf, lv_color_t recolor,
+                                                                lv_opa_t recolor_opa, lv_cache_entry_t ** entry);
+
+/**
+ * Release a converted palette returned by `lv_draw_sw_blend_palette_get`
+ * @param entry         the cache entry of the palette
+ */
+void lv_draw_sw_blend_palette_release(lv_cache_entry_t * entry);
+
+/**
+ * Look up the colors of the pixels of an indexed image
+ * @param dsc       the converted palette of the image
+ * @param src_cf    color format of the image (`LV_COLOR_FORMAT_I1/2/4/8`)
+ * @param src       pointer to a row of the image
+ * @param src_x     index of the first pixel to look up in the row
+ * @param w         number of pixels to look up
+ * @param dest      store the colors here in the format of `dsc->cf`
+ * @param dest_a8   store the alpha values here if `dsc->cf` is `LV_COLOR_FORMAT_RGB565A8`
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_palette_lookup(const lv_draw_sw_blend_palette_t * dsc,
+                                                           lv_color_format_t src_cf, const uint8_t * src,
+                                                           int32_t src_x, int32_t w, void * dest, lv_opa_t * dest_a8);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_INDEXED_H*/
@@ -0,0 +1,215 @@
+/**
+ * @file lv_draw_sw_blend_subpx.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_subpx.h"
+#if LV_USE_DRAW_SW && LV_USE_FONT_SUBPX
+
+#include "../../../misc/lv_math.h"
+#include "../../../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MIX(c, d, mix) LV_UDIV255((uint32_t)(c) * (mix) + (uint32_t)(d) * (255 - (mix)) + LV_COLOR_MIX_ROUND_OFS)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint8_t * dest_buf;
+    uint32_t dest_stride;           /*In bytes*/
+    const lv_opa_t * mask_buf;
+    uint32_t mask_stride;           /*In bytes*/
+    int32_t w;
+    int32_t h;
+    lv_color_t color;
+    lv_opa_t opa;
+    uint32_t r_ofs;                 /*Index of the red subpixel's coverage in a pixel's coverage triplet*/
+} subpx_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+LV_ATTRIBUTE_FAST_MEM static void blend_to_rgb565(const subpx_dsc_t * dsc);
+LV_ATTRIBUTE_FAST_MEM static void blend_to_rgb888(const subpx_dsc_t * dsc, uint32_t px_size);
+LV_ATTRIBUTE_FAST_MEM static void blend_to_argb8888(const subpx_dsc_t * dsc, bool premultiplied);
+LV_ATTRIBUTE_FAST_MEM static inline bool get_coverage(const subpx_dsc_t * dsc, const lv_opa_t * mask,
+                                                      lv_opa_t * r, lv_opa_t * g, lv_opa_t * b);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_subpx(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_subpx_dsc_t * dsc)
+{
+    if(dsc->opa <= LV_OPA_MIN) return;
+
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_unit->clip_area)) return;
+    if(!_lv_area_intersect(&blend_area, &blend_area, dsc->mask_area)) return;
+
+    lv_layer_t * layer = draw_unit->target_layer;
+
+    subpx_dsc_t subpx_dsc;
+    subpx_dsc.w = lv_area_get_width(&blend_area);
+    subpx_dsc.h = lv_area_get_height(&blend_area);
+    subpx_dsc.dest_stride = lv_draw_buf_get_stride(&layer->draw_buf);
+    subpx_dsc.dest_buf = lv_draw_buf_go_to_xy(&layer->draw_buf, blend_area.x1 - layer->draw_buf_ofs.x,
+                                              blend_area.y1 - layer->draw_buf_ofs.y);
+    subpx_dsc.mask_stride = dsc->mask_stride;
+    subpx_dsc.mask_buf = dsc->mask_buf + dsc->mask_stride * (blend_area.y1 - dsc->mask_area->y1) +
+                         (blend_area.x1 - dsc->mask_area->x1) * 3;
+    subpx_dsc.color = dsc->color;
+    subpx_dsc.opa = dsc->opa;
+    subpx_dsc.r_ofs = dsc->bgr ? 2 : 0;
+
+    switch(layer->draw_buf.color_format) {
+        case LV_COLOR_FORMAT_RGB565:
+            blend_to_rgb565(&subpx_dsc);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            blend_to_rgb888(&subpx_dsc, 3);
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            blend_to_rgb888(&subpx_dsc, 4);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            blend_to_argb8888(&subpx_dsc, false);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            blend_to_argb8888(&subpx_dsc, true);
+            break;
+        default:
+            LV_LOG_WARN("Not supported destination color format for subpixel rendering");
+            break;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM static void blend_to_rgb565(const subpx_dsc_t * dsc)
+{
+    uint8_t * dest_buf = dsc->dest_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->h; y++) {
+        uint16_t * dest = (uint16_t *)dest_buf;
+        for(x = 0; x < dsc->w; x++) {
+            lv_opa_t mr, mg, mb;
+            if(!get_coverage(dsc, &mask_buf[x * 3], &mr, &mg, &mb)) continue;
+
+            /*Convert to 8 bit channels, mix them one by one and convert back*/
+            uint32_t px = dest[x];
+            uint32_t r = (px >> 11) & 0x1F;
+            uint32_t g = (px >> 5) & 0x3F;
+            uint32_t b = px & 0x1F;
+            r = MIX(dsc->color.red, (r << 3) | (r >> 2), mr);
+            g = MIX(dsc->color.green, (g << 2) | (g >> 4), mg);
+            b = MIX(dsc->color.blue, (b << 3) | (b >> 2), mb);
+            dest[x] = (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+        }
+        dest_buf += dsc->dest_stride;
+        mask_buf += dsc->mask_stride;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void blend_to_rgb888(const subpx_dsc_t * dsc, uint32_t px_size)
+{
+    uint8_t * dest_buf = dsc->dest_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->h; y++) {
+        uint8_t * dest = dest_buf;
+        for(x = 0; x < dsc->w; x++) {
+            lv_opa_t mr, mg, mb;
+            if(get_coverage(dsc, &mask_buf[x * 3], &mr, &mg, &mb)) {
+                dest[0] = MIX(dsc->color.blue, dest[0], mb);
+                dest[1] = MIX(dsc->color.green, dest[1], mg);
+                dest[2] = MIX(dsc->color.red, dest[2], mr);
+            }
+            dest += px_size;
+        }
+        dest_buf += dsc->dest_stride;
+        mask_buf += dsc->mask_stride;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void blend_to_argb8888(const subpx_dsc_t * dsc, bool premultiplied)
+{
+    uint8_t * dest_buf = dsc->dest_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < dsc->h; y++) {
+        lv_color32_t * dest = (lv_color32_t *)dest_buf;
+        for(x = 0; x < dsc->w; x++) {
+            lv_opa_t mr, mg, mb;
+            if(!get_coverage(dsc, &mask_buf[x * 3], &mr, &mg, &mb)) continue;
+
+            if(dest[x].alpha == LV_OPA_COVER) {
+                dest[x].blue = MIX(dsc->color.blue, dest[x].blue, mb);
+                dest[x].green = MIX(dsc->color.green, dest[x].green, mg);
+                dest[x].red = MIX(dsc->color.red, dest[x].red, mr);
+                continue;
+            }
+
+            /*The subpixels can't be used on a transparent background. Use the average coverage as alpha.*/
+            uint32_t a = (mr + mg + mb) / 3;
+            if(premultiplied) {
+                dest[x] = lv_color32_premultiplied_over(lv_color32_premultiply(lv_color_to_32(dsc->color, a)), dest[x]);
+                continue;
+            }
+
+            uint32_t bg_a = LV_UDIV255(dest[x].alpha * (255 - a));
+            uint32_t res_a = a + bg_a;
+            if(res_a == 0) continue;
+            dest[x].blue = (dsc->color.blue * a + dest[x].blue * bg_a) / res_a;
+            dest[x].green = (dsc->color.green * a + dest[x].green * bg_a) / res_a;
+            dest[x].red = (dsc->color.red * a + dest[x].red * bg_a) / res_a;
+            dest[x].alpha = res_a;
+        }
+        dest_buf += dsc->dest_stride;
+        mask_buf += dsc->mask_stride;
+    }
+}
+
+/**
+ * Get the coverage of the red, green and blue channels of a pixel
+ * @return false if the pixel is not covered at all
+ */
+LV_ATTRIBUTE_FAST_MEM static inline bool get_coverage(const subpx_dsc_t * dsc, const lv_opa_t * mask,
+                                                      lv_opa_t * r, lv_opa_t * g, lv_opa_t * b)
+{
+    *r = mask[dsc->r_ofs];
+    *g = mask[1];
+    *b = mask[2 - dsc->r_ofs];
+    if((*r | *g | *b) == 0) return false;
+
+    if(dsc->opa < LV_OPA_MAX) {
+        *r = LV_OPA_MIX2(*r, dsc->opa);
+        *g = LV_OPA_MIX2(*g, dsc->opa);
+        *b = LV_OPA_MIX2(*b, dsc->opa);
+    }
+
+    return true;
+}
+
+#endif /*LV_USE_DRAW_SW && LV_USE_FONT_SUBPX*/
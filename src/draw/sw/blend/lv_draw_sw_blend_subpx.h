@@ -0,0 +1,63 @@
+/**
+ * @file lv_draw_sw_blend_subpx.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_SUBPX_H
+#define LV_DRAW_SW_BLEND_SUBPX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_draw_sw.h"
+#if LV_USE_DRAW_SW && LV_USE_FONT_SUBPX
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const lv_area_t * blend_area;   /**< The area with absolute coordinates to draw on the layer,
+                                     *   will be clipped to the clip area of the draw unit*/
+    const lv_opa_t * mask_buf;      /**< 3 coverage values per pixel in the order of the subpixels*/
+    uint32_t mask_stride;           /**< Stride of `mask_buf` in bytes*/
+    const lv_area_t * mask_area;    /**< The area of `mask_buf` with absolute coordinates in pixels*/
+    lv_color_t color;
+    lv_opa_t opa;
+    bool bgr;                       /**< The subpixels are in B, G, R order*/
+} lv_draw_sw_blend_subpx_dsc_t;
+
+struct _lv_draw_unit_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Fill an area with a color using a separate coverage for the red, green and blue channel of each pixel.
+ * RGB565, RGB888, XRGB8888 and ARGB8888 layers are supported.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           pointer to an initialized descriptor
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_subpx(struct _lv_draw_unit_t * draw_unit,
+                                                  const lv_draw_sw_blend_subpx_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW && LV_USE_FONT_SUBPX*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_SUBPX_H*/
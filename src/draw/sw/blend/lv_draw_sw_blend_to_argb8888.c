@@ -43,6 +43,8 @@ LV_ATTRIBUTE_FAST_MEM static void rgb888_image_blend(_lv_draw_sw_blend_image_dsc
 
 LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
 
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
 LV_ATTRIBUTE_FAST_MEM static inline lv_color32_t lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg,
                                                                     lv_color_mix_alpha_cache_t * cache);
 
@@ -166,6 +168,9 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_image_to_argb8888(_lv_draw_sw_blend_
         case LV_COLOR_FORMAT_ARGB8888:
             argb8888_image_blend(dsc);
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc);
+            break;
         default:
             LV_LOG_WARN("Not supported source color format");
             break;
@@ -443,6 +448,52 @@ LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_d
     }
 }
 
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    lv_color32_t color_argb;
+    lv_color_mix_alpha_cache_t cache;
+    lv_color_mix_with_alpha_cache_init(&cache);
+
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            lv_opa_t mix = opa;
+            if(mask_buf) mix = opa == LV_OPA_COVER ? mask_buf[x] : LV_OPA_MIX2(mask_buf[x], opa);
+
+            /*On an opaque background the premultiplied color can be simply added: `src + dest * (1 - src.alpha)`*/
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL && dest_buf_c32[x].alpha == LV_OPA_COVER) {
+                color_argb = lv_color32_premultiplied_scale(src_buf_c32[x], mix);
+                dest_buf_c32[x] = lv_color32_premultiplied_over(color_argb, dest_buf_c32[x]);
+                continue;
+            }
+
+            color_argb = lv_color32_unpremultiply(src_buf_c32[x]);
+            if(mix < LV_OPA_COVER) color_argb.alpha = LV_OPA_MIX2(color_argb.alpha, mix);
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                dest_buf_c32[x] = lv_color_32_32_mix(color_argb, dest_buf_c32[x], &cache);
+            }
+            else {
+                blend_non_normal_pixel(&dest_buf_c32[x], color_argb, dsc->blend_mode, &cache);
+            }
+        }
+        dest_buf_c32 += dest_stride;
+        src_buf_c32 += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
 LV_ATTRIBUTE_FAST_MEM static inline lv_color32_t lv_color_32_32_mix(lv_color32_t fg, lv_color32_t bg,
                                                                     lv_color_mix_alpha_cache_t * cache)
 {
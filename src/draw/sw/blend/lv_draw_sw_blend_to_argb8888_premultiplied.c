@@ -0,0 +1,365 @@
+/**
+ * @file lv_draw_sw_blend_to_argb8888_premultiplied.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_to_argb8888_premultiplied.h"
+#if LV_USE_DRAW_SW
+
+#include "lv_draw_sw_blend.h"
+#include "../../../misc/lv_math.h"
+#include "../../../misc/lv_color.h"
+#include "../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM static void rgb565_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+LV_ATTRIBUTE_FAST_MEM static void rgb888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc, const uint8_t src_px_size);
+
+LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t get_opa(const lv_opa_t * mask_buf, int32_t x, lv_opa_t opa);
+
+LV_ATTRIBUTE_FAST_MEM static inline void blend_straight_pixel(lv_color32_t * dest, lv_color32_t src,
+                                                              lv_blend_mode_t mode);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_color_to_argb8888_premultiplied(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    lv_color32_t * dest_buf = dsc->dest_buf;
+
+    int32_t x;
+    int32_t y;
+
+    /*Simple fill*/
+    if(mask == NULL && opa == LV_OPA_COVER) {
+        uint32_t color32 = lv_color_to_u32(dsc->color);
+        for(y = 0; y < h; y++) {
+            uint32_t * dest_buf_u32 = (uint32_t *)dest_buf;
+            for(x = 0; x < w; x++) {
+                dest_buf_u32[x] = color32;
+            }
+            dest_buf += dest_stride;
+        }
+    }
+    /*Opacity only: the premultiplied color is the same for all pixels*/
+    else if(mask == NULL) {
+        lv_color32_t color_pm = lv_color32_premultiply(lv_color_to_32(dsc->color, opa));
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf[x] = lv_color32_premultiplied_over(color_pm, dest_buf[x]);
+            }
+            dest_buf += dest_stride;
+        }
+    }
+    /*Masked*/
+    else {
+        lv_color32_t color_argb = lv_color_to_32(dsc->color, 0xff);
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                color_argb.alpha = get_opa(mask, x, opa);
+                dest_buf[x] = lv_color32_premultiplied_over(lv_color32_premultiply(color_argb), dest_buf[x]);
+            }
+            dest_buf += dest_stride;
+            mask += mask_stride;
+        }
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_image_to_argb8888_premultiplied(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(dsc->src_color_format) {
+        case LV_COLOR_FORMAT_RGB565:
+            rgb565_image_blend(dsc);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            rgb888_image_blend(dsc, 3);
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            rgb888_image_blend(dsc, 4);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            argb8888_image_blend(dsc);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc);
+            break;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            break;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+LV_ATTRIBUTE_FAST_MEM static void rgb565_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    const lv_color16_t * src_buf_c16 = (const lv_color16_t *) dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    lv_color32_t src_argb;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            src_argb.red = (src_buf_c16[x].red * 2106) >> 8;  /*To make it rounded*/
+            src_argb.green = (src_buf_c16[x].green * 1037) >> 8;
+            src_argb.blue = (src_buf_c16[x].blue * 2106) >> 8;
+            src_argb.alpha = get_opa(mask_buf, x, opa);
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                dest_buf_c32[x] = lv_color32_premultiplied_over(lv_color32_premultiply(src_argb), dest_buf_c32[x]);
+            }
+            else {
+                blend_straight_pixel(&dest_buf_c32[x], src_argb, dsc->blend_mode);
+            }
+        }
+        dest_buf_c32 += dest_stride;
+        src_buf_c16 += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void rgb888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc, const uint8_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf = dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride * src_px_size;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    /*Special case: the pixels are simply copied*/
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL && mask_buf == NULL && opa == LV_OPA_COVER) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                dest_buf_c32[dest_x].red = src_buf[src_x + 2];
+                dest_buf_c32[dest_x].green = src_buf[src_x + 1];
+                dest_buf_c32[dest_x].blue = src_buf[src_x + 0];
+                dest_buf_c32[dest_x].alpha = 0xff;
+            }
+            dest_buf_c32 += dest_stride;
+            src_buf += src_stride;
+        }
+        return;
+    }
+
+    lv_color32_t src_argb;
+    for(y = 0; y < h; y++) {
+        for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+            src_argb.red = src_buf[src_x + 2];
+            src_argb.green = src_buf[src_x + 1];
+            src_argb.blue = src_buf[src_x + 0];
+            src_argb.alpha = get_opa(mask_buf, dest_x, opa);
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                dest_buf_c32[dest_x] = lv_color32_premultiplied_over(lv_color32_premultiply(src_argb),
+                                                                     dest_buf_c32[dest_x]);
+            }
+            else {
+                blend_straight_pixel(&dest_buf_c32[dest_x], src_argb, dsc->blend_mode);
+            }
+        }
+        dest_buf_c32 += dest_stride;
+        src_buf += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    lv_color32_t src_argb;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            src_argb = src_buf_c32[x];
+            lv_opa_t mix = get_opa(mask_buf, x, opa);
+            if(mix < LV_OPA_COVER) src_argb.alpha = LV_OPA_MIX2(src_argb.alpha, mix);
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                dest_buf_c32[x] = lv_color32_premultiplied_over(lv_color32_premultiply(src_argb), dest_buf_c32[x]);
+            }
+            else {
+                blend_straight_pixel(&dest_buf_c32[x], src_argb, dsc->blend_mode);
+            }
+        }
+        dest_buf_c32 += dest_stride;
+        src_buf_c32 += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        /*The most common case, e.g. blending a layer: `src + dest * (1 - src.alpha)`*/
+        if(mask_buf == NULL && opa == LV_OPA_COVER) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_c32[x] = lv_color32_premultiplied_over(src_buf_c32[x], dest_buf_c32[x]);
+                }
+                dest_buf_c32 += dest_stride;
+                src_buf_c32 += src_stride;
+            }
+        }
+        else if(mask_buf == NULL) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    lv_color32_t src_pm = lv_color32_premultiplied_scale(src_buf_c32[x], opa);
+                    dest_buf_c32[x] = lv_color32_premultiplied_over(src_pm, dest_buf_c32[x]);
+                }
+                dest_buf_c32 += dest_stride;
+                src_buf_c32 += src_stride;
+            }
+        }
+        else {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    lv_color32_t src_pm = lv_color32_premultiplied_scale(src_buf_c32[x], get_opa(mask_buf, x, opa));
+                    dest_buf_c32[x] = lv_color32_premultiplied_over(src_pm, dest_buf_c32[x]);
+                }
+                dest_buf_c32 += dest_stride;
+                src_buf_c32 += src_stride;
+                mask_buf += mask_stride;
+            }
+        }
+    }
+    else {
+        lv_color32_t src_argb;
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                src_argb = lv_color32_unpremultiply(src_buf_c32[x]);
+                lv_opa_t mix = get_opa(mask_buf, x, opa);
+                if(mix < LV_OPA_COVER) src_argb.alpha = LV_OPA_MIX2(src_argb.alpha, mix);
+                blend_straight_pixel(&dest_buf_c32[x], src_argb, dsc->blend_mode);
+            }
+            dest_buf_c32 += dest_stride;
+            src_buf_c32 += src_stride;
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
+/**
+ * Get the opacity of a pixel from the mask and the overall opacity
+ * @param mask_buf  the mask or NULL
+ * @param x         index of the pixel in the mask
+ * @param opa       the overall opacity. LV_OPA_COVER if it's larger than LV_OPA_MAX
+ * @return          the opacity of the pixel
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t get_opa(const lv_opa_t * mask_buf, int32_t x, lv_opa_t opa)
+{
+    if(mask_buf == NULL) return opa;
+    if(opa == LV_OPA_COVER) return mask_buf[x];
+    return LV_OPA_MIX2(mask_buf[x], opa);
+}
+
+/**
+ * Blend a color with straight alpha with a not NORMAL blend mode.
+ * The blend modes are defined on straight colors so the destination pixel is un-premultiplied first.
+ * @param dest      pointer to the premultiplied destination pixel
+ * @param src       the source color whose `alpha` is already mixed with the opacity and the mask
+ * @param mode      the blend mode
+ */
+LV_ATTRIBUTE_FAST_MEM static inline void blend_straight_pixel(lv_color32_t * dest, lv_color32_t src,
+                                                              lv_blend_mode_t mode)
+{
+    lv_color32_t bg = lv_color32_unpremultiply(*dest);
+    lv_color32_t res;
+    switch(mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            res.red = LV_MIN(bg.red + src.red, 255);
+            res.green = LV_MIN(bg.green + src.green, 255);
+            res.blue = LV_MIN(bg.blue + src.blue, 255);
+            break;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            res.red = LV_MAX(bg.red - src.red, 0);
+            res.green = LV_MAX(bg.green - src.green, 0);
+            res.blue = LV_MAX(bg.blue - src.blue, 0);
+            break;
+        case LV_BLEND_MODE_MULTIPLY:
+            res.red = (bg.red * src.red) >> 8;
+            res.green = (bg.green * src.green) >> 8;
+            res.blue = (bg.blue * src.blue) >> 8;
+            break;
+        default:
+            LV_LOG_WARN("Not supported blend mode: %d", mode);
+            return;
+    }
+    res.alpha = src.alpha;
+    *dest = lv_color32_premultiplied_over(lv_color32_premultiply(res), *dest);
+}
+
+#endif
@@ -34,6 +34,8 @@ LV_ATTRIBUTE_FAST_MEM static void rgb888_image_blend(_lv_draw_sw_blend_image_dsc
 
 LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
 
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
 LV_ATTRIBUTE_FAST_MEM static inline uint16_t lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix);
 
 /**********************
@@ -215,6 +217,9 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_image_to_rgb565(_lv_draw_sw_blend_im
         case LV_COLOR_FORMAT_ARGB8888:
             argb8888_image_blend(dsc);
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc);
+            break;
         default:
             LV_LOG_WARN("Not supported source color format");
             break;
@@ -530,6 +535,71 @@ LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_d
     }
 }
 
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            lv_opa_t mix = opa;
+            if(mask_buf) mix = opa == LV_OPA_COVER ? mask_buf[x] : LV_OPA_MIX2(mask_buf[x], opa);
+
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                /*`src + dest * (1 - src.alpha)` on 8 bit channels, no need to divide by alpha*/
+                lv_color32_t src = lv_color32_premultiplied_scale(src_buf_c32[x], mix);
+                if(src.alpha == 0) continue;
+                uint32_t inv = 255 - src.alpha;
+                uint16_t dest = dest_buf_u16[x];
+                uint32_t red = src.red + LV_UDIV255(((dest >> 8) & 0xF8) * inv);
+                uint32_t green = src.green + LV_UDIV255(((dest >> 3) & 0xFC) * inv);
+                uint32_t blue = src.blue + LV_UDIV255(((dest << 3) & 0xF8) * inv);
+                dest_buf_u16[x] = ((red & 0xF8) << 8) + ((green & 0xFC) << 3) + (blue >> 3);
+            }
+            else {
+                lv_color32_t src_argb = lv_color32_unpremultiply(src_buf_c32[x]);
+                if(mix < LV_OPA_COVER) src_argb.alpha = LV_OPA_MIX2(src_argb.alpha, mix);
+                lv_color16_t * dest_c16 = (lv_color16_t *)&dest_buf_u16[x];
+                uint16_t res;
+                switch(dsc->blend_mode) {
+                    case LV_BLEND_MODE_ADDITIVE:
+                        res = LV_MIN(dest_c16->red + (src_argb.red >> 3), 31) << 11;
+                        res += LV_MIN(dest_c16->green + (src_argb.green >> 2), 63) << 5;
+                        res += LV_MIN(dest_c16->blue + (src_argb.blue >> 3), 31);
+                        break;
+                    case LV_BLEND_MODE_SUBTRACTIVE:
+                        res = LV_MAX(dest_c16->red - (src_argb.red >> 3), 0) << 11;
+                        res += LV_MAX(dest_c16->green - (src_argb.green >> 2), 0) << 5;
+                        res += LV_MAX(dest_c16->blue - (src_argb.blue >> 3), 0);
+                        break;
+                    case LV_BLEND_MODE_MULTIPLY:
+                        res = ((dest_c16->red * (src_argb.red >> 3)) >> 5) << 11;
+                        res += ((dest_c16->green * (src_argb.green >> 2)) >> 6) << 5;
+                        res += (dest_c16->blue * (src_argb.blue >> 3)) >> 5;
+                        break;
+                    default:
+                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
+                        return;
+                }
+                dest_buf_u16[x] = lv_color_16_16_mix(res, dest_buf_u16[x], src_argb.alpha);
+            }
+        }
+        dest_buf_u16 += dest_stride;
+        src_buf_c32 += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
 LV_ATTRIBUTE_FAST_MEM static inline uint16_t lv_color_24_16_mix(const uint8_t * c1, uint16_t c2, uint8_t mix)
 {
     if(mix == 0) {
@@ -35,6 +35,9 @@ LV_ATTRIBUTE_FAST_MEM static void rgb888_image_blend(_lv_draw_sw_blend_image_dsc
 
 LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size);
 
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                     uint32_t dest_px_size);
+
 LV_ATTRIBUTE_FAST_MEM static inline void lv_color_24_24_mix(const uint8_t * src, uint8_t * dest, uint8_t mix);
 
 LV_ATTRIBUTE_FAST_MEM static inline void blend_non_normal_pixel(uint8_t * dest, lv_color32_t src, lv_blend_mode_t mode);
@@ -179,6 +182,9 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_image_to_rgb888(_lv_draw_sw_blend_im
         case LV_COLOR_FORMAT_ARGB8888:
             argb8888_image_blend(dsc, dest_px_size);
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            argb8888_premultiplied_image_blend(dsc, dest_px_size);
+            break;
         default:
             LV_LOG_WARN("Not supported source color format");
             break;
@@ -445,6 +451,49 @@ LV_ATTRIBUTE_FAST_MEM static void argb8888_image_blend(_lv_draw_sw_blend_image_d
     }
 }
 
+LV_ATTRIBUTE_FAST_MEM static void argb8888_premultiplied_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                     uint32_t dest_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    uint8_t * dest_buf = dsc->dest_buf;
+    lv_coord_t dest_stride = dsc->dest_stride * dest_px_size;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+    lv_coord_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    lv_coord_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(dest_x = 0, src_x = 0; src_x < w; dest_x += dest_px_size, src_x++) {
+            lv_opa_t mix = opa;
+            if(mask_buf) mix = opa == LV_OPA_COVER ? mask_buf[src_x] : LV_OPA_MIX2(mask_buf[src_x], opa);
+
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                /*`src + dest * (1 - src.alpha)`, no need to divide by alpha*/
+                lv_color32_t src = lv_color32_premultiplied_scale(src_buf_c32[src_x], mix);
+                if(src.alpha == 0) continue;
+                uint32_t inv = 255 - src.alpha;
+                dest_buf[dest_x + 0] = src.blue + LV_UDIV255(dest_buf[dest_x + 0] * inv);
+                dest_buf[dest_x + 1] = src.green + LV_UDIV255(dest_buf[dest_x + 1] * inv);
+                dest_buf[dest_x + 2] = src.red + LV_UDIV255(dest_buf[dest_x + 2] * inv);
+            }
+            else {
+                lv_color32_t src_argb = lv_color32_unpremultiply(src_buf_c32[src_x]);
+                if(mix < LV_OPA_COVER) src_argb.alpha = LV_OPA_MIX2(src_argb.alpha, mix);
+                blend_non_normal_pixel(&dest_buf[dest_x], src_argb, dsc->blend_mode);
+            }
+        }
+        dest_buf += dest_stride;
+        src_buf_c32 += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
 LV_ATTRIBUTE_FAST_MEM static inline void blend_non_normal_pixel(uint8_t * dest, lv_color32_t src, lv_blend_mode_t mode)
 {
     uint8_t res[3] = {0, 0, 0};
@@ -0,0 +1,135 @@
+/**
+ * @file lv_draw_sw_blend_yuv.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_yuv.h"
+#if LV_USE_DRAW_SW
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*The parts of the R, G, B values which depend only on the U and V values. They are shared by 2 pixels.*/
+typedef struct {
+    int32_t r;
+    int32_t g;
+    int32_t b;
+} chroma_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline void chroma_get(chroma_t * c, uint8_t u, uint8_t v);
+static inline lv_color32_t yuv_to_color32(uint8_t y, const chroma_t * c);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+#define CLAMP_U8(v)     ((v) < 0 ? 0 : ((v) > 255 ? 255 : (v)))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_blend_yuv_planes_init(lv_draw_sw_blend_yuv_planes_t * planes, const uint8_t * buf,
+                                      uint32_t stride, uint32_t h)
+{
+    planes->y_stride = stride;
+    planes->uv_stride = (stride + 1) / 2;
+    planes->y = buf;
+    planes->u = planes->y + stride * h;
+    planes->v = planes->u + planes->uv_stride * ((h + 1) / 2);
+}
+
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_yuv_convert(const lv_draw_sw_blend_yuv_planes_t * planes,
+                                                        int32_t src_x, int32_t src_y, int32_t w,
+                                                        void * dest, lv_color_format_t dest_cf)
+{
+    const uint8_t * y_row = planes->y + src_y * planes->y_stride;
+    const uint8_t * u_row = planes->u + (src_y / 2) * planes->uv_stride;
+    const uint8_t * v_row = planes->v + (src_y / 2) * planes->uv_stride;
+
+    /*2 neighbouring pixels share the same U and V values so get them only on even x coordinates*/
+    chroma_t c;
+    chroma_get(&c, u_row[src_x / 2], v_row[src_x / 2]);
+
+    int32_t x_end = src_x + w;
+    int32_t x;
+    if(dest_cf == LV_COLOR_FORMAT_RGB565) {
+        uint16_t * dest16 = dest;
+        for(x = src_x; x < x_end; x++) {
+            if((x & 1) == 0) chroma_get(&c, u_row[x / 2], v_row[x / 2]);
+            lv_color32_t px = yuv_to_color32(y_row[x], &c);
+            *dest16 = ((px.red & 0xF8) << 8) + ((px.green & 0xFC) << 3) + ((px.blue & 0xF8) >> 3);
+            dest16++;
+        }
+    }
+    else if(dest_cf == LV_COLOR_FORMAT_RGB888) {
+        uint8_t * dest8 = dest;
+        for(x = src_x; x < x_end; x++) {
+            if((x & 1) == 0) chroma_get(&c, u_row[x / 2], v_row[x / 2]);
+            lv_color32_t px = yuv_to_color32(y_row[x], &c);
+            dest8[0] = px.blue;
+            dest8[1] = px.green;
+            dest8[2] = px.red;
+            dest8 += 3;
+        }
+    }
+    else {
+        /*The pixels are opaque so they are the same with premultiplied alpha too*/
+        lv_color32_t * dest32 = dest;
+        for(x = src_x; x < x_end; x++) {
+            if((x & 1) == 0) chroma_get(&c, u_row[x / 2], v_row[x / 2]);
+            *dest32 = yuv_to_color32(y_row[x], &c);
+            dest32++;
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Integer BT.601 conversion with limited range (Y: 16..235, U and V: 16..240) as used by most videos:
+ *R = 1.164(Y - 16) + 1.596(V - 128)
+ *G = 1.164(Y - 16) - 0.391(U - 128) - 0.813(V - 128)
+ *B = 1.164(Y - 16) + 2.018(U - 128)
+ *The coefficients are multiplied by 256*/
+
+static inline void chroma_get(chroma_t * c, uint8_t u, uint8_t v)
+{
+    int32_t d = (int32_t)u - 128;
+    int32_t e = (int32_t)v - 128;
+    c->r = 409 * e + 128;
+    c->g = -100 * d - 208 * e + 128;
+    c->b = 516 * d + 128;
+}
+
+static inline lv_color32_t yuv_to_color32(uint8_t y, const chroma_t * c)
+{
+    int32_t l = 298 * ((int32_t)y - 16);
+    int32_t r = (l + c->r) >> 8;
+    int32_t g = (l + c->g) >> 8;
+    int32_t b = (l + c->b) >> 8;
+
+    lv_color32_t px;
+    px.red = CLAMP_U8(r);
+    px.green = CLAMP_U8(g);
+    px.blue = CLAMP_U8(b);
+    px.alpha = 0xff;
+    return px;
+}
+
+#endif /*LV_USE_DRAW_SW*/
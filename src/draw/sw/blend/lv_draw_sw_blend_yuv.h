@@ -0,0 +1,80 @@
+/**
+ * @file lv_draw_sw_blend_yuv.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_YUV_H
+#define LV_DRAW_SW_BLEND_YUV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+#if LV_USE_DRAW_SW
+
+#include "../../../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * The planes of an `LV_COLOR_FORMAT_I420` image.
+ * The Y plane has `stride` bytes per row. It's followed by the U and the V planes
+ * which have `(stride + 1) / 2` bytes per row and `(h + 1) / 2` rows.
+ */
+typedef struct {
+    const uint8_t * y;
+    const uint8_t * u;
+    const uint8_t * v;
+    uint32_t y_stride;
+    uint32_t uv_stride;
+} lv_draw_sw_blend_yuv_planes_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Find the planes of an I420 image
+ * @param planes    store the planes here
+ * @param buf       the pixels of the image
+ * @param stride    stride of the Y plane in bytes
+ * @param h         height of the image
+ */
+void lv_draw_sw_blend_yuv_planes_init(lv_draw_sw_blend_yuv_planes_t * planes, const uint8_t * buf,
+                                      uint32_t stride, uint32_t h);
+
+/**
+ * Convert a part of a row of an I420 image to RGB using the BT.601 coefficients of videos
+ * @param planes    the planes of the image
+ * @param src_x     x coordinate of the first pixel to convert
+ * @param src_y     the row to convert
+ * @param w         number of pixels to convert
+ * @param dest      store the colors here
+ * @param dest_cf   `LV_COLOR_FORMAT_RGB565`, `LV_COLOR_FORMAT_RGB888`, `LV_COLOR_FORMAT_XRGB8888`,
+ *                  `LV_COLOR_FORMAT_ARGB8888` or `LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED`
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_yuv_convert(const lv_draw_sw_blend_yuv_planes_t * planes,
+                                                        int32_t src_x, int32_t src_y, int32_t w,
+                                                        void * dest, lv_color_format_t dest_cf);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_YUV_H*/
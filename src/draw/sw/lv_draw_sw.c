@@ -57,6 +57,10 @@ void lv_draw_sw_init(void)
     lv_draw_sw_mask_init();
 #endif
 
+#if LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+    _lv_draw_sw_text_cache_init();
+#endif
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
@@ -165,6 +169,9 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
         case LV_DRAW_TASK_TYPE_TRIANGLE:
             lv_draw_sw_triangle((lv_draw_unit_t *)u, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_PATH:
+            lv_draw_sw_path((lv_draw_unit_t *)u, t->draw_dsc);
+            break;
         case LV_DRAW_TASK_TYPE_LAYER:
             lv_draw_sw_layer((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
             break;
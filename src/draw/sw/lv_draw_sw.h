@@ -74,12 +74,25 @@ void lv_draw_sw_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
 
 void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_t * dsc);
 
+void lv_draw_sw_path(lv_draw_unit_t * draw_unit, const lv_draw_path_dsc_t * dsc);
+
 void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_dsc_t * dsc, const lv_area_t * coords);
 
 void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_area, const void * src_buf,
                           lv_coord_t src_w, lv_coord_t src_h,
                           const lv_draw_image_dsc_t * draw_dsc, const lv_draw_image_sup_t * sup, lv_color_format_t cf, void * dest_buf);
 
+/**
+ * Collect the parts of an area of an image which can be decoded only part by part into one buffer
+ * @param decoder_dsc   an opened image whose `img_data` is NULL
+ * @param area          the area to decode, relative to the image (or its mip level)
+ * @param area_dsc      initialized to describe the decoded area as an image.
+ *                      Its `img_data` needs to be freed by `lv_free`
+ * @return              LV_RESULT_OK: the area is decoded; LV_RESULT_INVALID: error
+ */
+lv_result_t _lv_draw_sw_image_decode_area(lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * area,
+                                          lv_image_decoder_dsc_t * area_dsc);
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
@@ -92,6 +105,8 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
 
 #endif /*LV_USE_DRAW_SW*/
 
+#include "lv_draw_sw_text_cache.h"
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
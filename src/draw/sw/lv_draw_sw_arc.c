@@ -26,6 +26,7 @@ static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness
  *********************/
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
+#define MASK_SPAN_MAX   16
 
 /**********************
  *      TYPEDEFS
@@ -112,6 +113,7 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     lv_coord_t blend_w = lv_area_get_width(&clipped_area);
     lv_coord_t h;
     lv_opa_t * mask_buf = lv_malloc(blend_w);
+    lv_draw_sw_mask_span_t mask_spans[MASK_SPAN_MAX];
 
     lv_area_t blend_area = clipped_area;
     lv_area_t img_area;
@@ -120,22 +122,63 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     blend_dsc.opa = dsc->opa;
     blend_dsc.blend_area = &blend_area;
     blend_dsc.mask_area = &blend_area;
-    if(dsc->img_src == NULL) {
+    lv_image_decoder_dsc_t decoder_dsc;
+    lv_image_decoder_dsc_t part_dsc;    /*The drawn part of an image which is decoded part by part*/
+    const lv_image_decoder_dsc_t * img_dsc = NULL;
+    lv_cache_entry_t * img_palette_cache = NULL;
+    bool img_opened = false;
+    if(dsc->img_src) {
+        img_opened = lv_image_decoder_open(&decoder_dsc, dsc->img_src, dsc->color, 0) == LV_RESULT_OK;
+        if(img_opened) {
+            img_area.x1 = 0;
+            img_area.y1 = 0;
+            img_area.x2 = decoder_dsc.header.w - 1;
+            img_area.y2 = decoder_dsc.header.h - 1;
+            lv_coord_t ofs = decoder_dsc.header.w / 2;
+            lv_area_move(&img_area, dsc->center.x - ofs, dsc->center.y - ofs);
+            img_dsc = &decoder_dsc;
+        }
+
+        /*If the image is not available as a whole decode only the part under the clip area.
+         *If it fails (e.g. out of memory) draw a simple arc.*/
+        if(img_opened && decoder_dsc.img_data == NULL) {
+            lv_area_t part_area;
+            img_dsc = NULL;
+            if(_lv_area_intersect(&part_area, &img_area, &clipped_area)) {
+                lv_area_move(&part_area, -img_area.x1, -img_area.y1);
+                if(_lv_draw_sw_image_decode_area(&decoder_dsc, &part_area, &part_dsc) == LV_RESULT_OK) {
+                    lv_area_move(&part_area, img_area.x1, img_area.y1);
+                    img_area = part_area;
+                    img_dsc = &part_dsc;
+                }
+            }
+
+            if(img_dsc == NULL) {
+                lv_image_decoder_close(&decoder_dsc);
+                img_opened = false;
+            }
+        }
+
+        /*Indexed images need the palette in the layer's format. If it can't be created draw a simple arc*/
+        if(img_opened && LV_COLOR_FORMAT_IS_INDEXED(img_dsc->header.cf)) {
+            blend_dsc.src_palette = lv_draw_sw_blend_palette_get(img_dsc->palette, img_dsc->palette_size,
+                                                                 draw_unit->target_layer->draw_buf.color_format,
+                                                                 lv_color_black(), LV_OPA_TRANSP, &img_palette_cache);
+            if(blend_dsc.src_palette == NULL) {
+                lv_image_decoder_close(&decoder_dsc);
+                img_opened = false;
+            }
+        }
+    }
+
+    if(!img_opened) {
         blend_dsc.color = dsc->color;
     }
     else {
-        lv_image_decoder_dsc_t decoder_dsc;
-        lv_image_decoder_open(&decoder_dsc, dsc->img_src, dsc->color, 0);
-        img_area.x1 = 0;
-        img_area.y1 = 0;
-        img_area.x2 = decoder_dsc.header.w - 1;
-        img_area.y2 = decoder_dsc.header.h - 1;
-        lv_coord_t ofs = decoder_dsc.header.w / 2;
-        lv_area_move(&img_area, dsc->center.x - ofs, dsc->center.y - ofs);
         blend_dsc.src_area = &img_area;
-        blend_dsc.src_buf = decoder_dsc.img_data;
-        blend_dsc.src_color_format = decoder_dsc.header.cf;
-        blend_dsc.src_stride = decoder_dsc.header.stride;
+        blend_dsc.src_buf = img_dsc->img_data;
+        blend_dsc.src_color_format = img_dsc->header.cf;
+        blend_dsc.src_stride = img_dsc->header.stride;
     }
 
 
@@ -169,7 +212,9 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     blend_area.y2 = blend_area.y1;
     for(h = 0; h < blend_h; h++) {
         lv_memset(mask_buf, 0xff, blend_w);
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w);
+        blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, blend_area.y1, blend_w,
+                                                         mask_spans, MASK_SPAN_MAX, &blend_dsc.mask_span_cnt);
+        blend_dsc.mask_spans = blend_dsc.mask_span_cnt ? mask_spans : NULL;
 
         if(dsc->rounded) {
             if(blend_area.y1 >= round_area_1.y1 && blend_area.y1 <= round_area_1.y2) {
@@ -178,6 +223,7 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
                     blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
                 add_circle(circle_mask, &blend_area, &round_area_1, mask_buf, width);
+                blend_dsc.mask_spans = NULL;
             }
             if(blend_area.y1 >= round_area_2.y1 && blend_area.y1 <= round_area_2.y2) {
                 if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
@@ -185,6 +231,7 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
                     blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
                 }
                 add_circle(circle_mask, &blend_area, &round_area_2, mask_buf, width);
+                blend_dsc.mask_spans = NULL;
             }
         }
 
@@ -202,6 +249,9 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
 
     lv_free(mask_buf);
     if(circle_mask) lv_free(circle_mask);
+    if(img_dsc == &part_dsc) lv_free((void *)part_dsc.img_data);
+    if(img_opened) lv_image_decoder_close(&decoder_dsc);
+    lv_draw_sw_blend_palette_release(img_palette_cache);
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_SW_COMPLEX == 0");
     LV_UNUSED(center);
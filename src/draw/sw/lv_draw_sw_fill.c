@@ -21,6 +21,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define MASK_SPAN_MAX   16
 
 /**********************
  *      TYPEDEFS
@@ -83,6 +84,7 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, const lv_draw_fill_dsc_t * dsc,
     lv_opa_t * mask_buf = NULL;
     lv_draw_sw_mask_radius_param_t mask_rout_param;
     void * mask_list[2] = {NULL, NULL};
+    lv_draw_sw_mask_span_t mask_spans[MASK_SPAN_MAX];
     if(rout > 0) {
         mask_buf = lv_malloc(clipped_w);
         lv_draw_sw_mask_radius_init(&mask_rout_param, &bg_coords, rout, false);
@@ -130,7 +132,15 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, const lv_draw_fill_dsc_t * dsc,
         /* Initialize the mask to opa instead of 0xFF and blend with LV_OPA_COVER.
          * It saves calculating the final opa in lv_draw_sw_blend*/
         lv_memset(mask_buf, opa, clipped_w);
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, top_y, clipped_w);
+        if(opa == LV_OPA_COVER && grad_opa_map == NULL) {
+            /*The covered spans are really 0xFF so they can be passed to the blend function*/
+            blend_dsc.mask_res = lv_draw_sw_mask_apply_spans(mask_list, mask_buf, blend_area.x1, top_y, clipped_w,
+                                                             mask_spans, MASK_SPAN_MAX, &blend_dsc.mask_span_cnt);
+            blend_dsc.mask_spans = blend_dsc.mask_span_cnt ? mask_spans : NULL;
+        }
+        else {
+            blend_dsc.mask_res = lv_draw_sw_mask_apply(mask_list, mask_buf, blend_area.x1, top_y, clipped_w);
+        }
         if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
 
         if(top_y >= clipped_coords.y1) {
@@ -166,6 +176,8 @@ void lv_draw_sw_fill(lv_draw_unit_t * draw_unit, const lv_draw_fill_dsc_t * dsc,
     }
 
     /* Draw the center of the rectangle.*/
+    blend_dsc.mask_spans = NULL;
+    blend_dsc.mask_span_cnt = 0;
 
     /*If no gradient, the center is a simple rectangle*/
     if(grad_dir == LV_GRAD_DIR_NONE) {
@@ -33,6 +33,11 @@
  **********************/
 static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * draw_area,
                           const lv_image_decoder_dsc_t * src, lv_draw_image_sup_t * sup, const lv_area_t * img_coords);
+static const uint8_t * get_indexed_as_argb8888(const lv_image_decoder_dsc_t * src, lv_cache_entry_t ** entry);
+static uint8_t * indexed_to_argb8888(const lv_image_decoder_dsc_t * src);
+static uint8_t * yuv_to_xrgb8888(const lv_image_decoder_dsc_t * src);
+static void draw_parts(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * draw_area,
+                       lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup, const lv_area_t * coords);
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +60,7 @@ void lv_draw_sw_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
     if(layer_to_draw->draw_buf.buf == NULL) return;
 
     lv_image_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(lv_image_dsc_t));
     img_dsc.header.w = layer_to_draw->draw_buf.width;
     img_dsc.header.h = layer_to_draw->draw_buf.height;
     img_dsc.header.cf = layer_to_draw->draw_buf.color_format;
@@ -89,7 +95,8 @@ void lv_draw_sw_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
 #if LV_USE_LAYER_DEBUG
     lv_draw_fill_dsc_t fill_dsc;
     lv_draw_fill_dsc_init(&fill_dsc);
-    fill_dsc.color = lv_color_hex(layer_to_draw->draw_buf.color_format == LV_COLOR_FORMAT_ARGB8888 ? 0xff0000 : 0x00ff00);
+    fill_dsc.color = lv_color_hex(layer_to_draw->draw_buf.color_format == LV_COLOR_FORMAT_ARGB8888_LAYER ? 0xff0000 :
+                                  0x00ff00);
     fill_dsc.opa = LV_OPA_20;
     lv_draw_sw_fill(draw_unit, &fill_dsc, &area_rot);
 
@@ -185,34 +192,79 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_image(lv_draw_unit_t * draw_unit, const lv
         img_draw_core(draw_unit, draw_dsc, &draw_area, &decoder_dsc,
                       &sup, coords);
     }
-    /*Draw line by line*/
+    /*Transformations need the whole image, so collect the decoded parts*/
+    else if((draw_dsc->rotation || draw_dsc->zoom != LV_SCALE_NONE) && decoder_dsc.level_cnt == 0) {
+        lv_image_decoder_dsc_t whole_dsc;
+        lv_area_t whole_area = {0, 0, decoder_dsc.header.w - 1, decoder_dsc.header.h - 1};
+        if(_lv_draw_sw_image_decode_area(&decoder_dsc, &whole_area, &whole_dsc) == LV_RESULT_OK) {
+            img_draw_core(draw_unit, draw_dsc, &draw_area, &whole_dsc,
+                          &sup, coords);
+            lv_free((void *)whole_dsc.img_data);
+        }
+    }
+    /*Decode and draw only the visible part of the image, part by part*/
     else {
-        lv_area_t relative_full_area_to_decode = draw_area;
-        lv_area_move(&relative_full_area_to_decode, -coords->x1, -coords->y1);
-
-        lv_area_t relative_decoded_area;
-        relative_decoded_area.x1 = LV_COORD_MIN;
-        relative_decoded_area.y1 = LV_COORD_MIN;
-        relative_decoded_area.x2 = LV_COORD_MIN;
-        relative_decoded_area.y2 = LV_COORD_MIN;
-        res = LV_RESULT_OK;
-        while(res == LV_RESULT_OK) {
-            res = lv_image_decoder_get_area(&decoder_dsc, &relative_full_area_to_decode, &relative_decoded_area);
-
-            lv_area_t absolute_decoded_area = relative_decoded_area;
-            lv_area_move(&absolute_decoded_area, coords->x1, coords->y1);
-            if(res == LV_RESULT_OK) {
-                /*Limit draw area to the current decoded area and draw the image*/
-                lv_area_t draw_area_sub;
-                if(_lv_area_intersect(&draw_area_sub, &draw_area, &absolute_decoded_area)) {
-                    img_draw_core(draw_unit, draw_dsc, &draw_area_sub, &decoder_dsc,
-                                  &sup, &absolute_decoded_area);
-                }
+        draw_parts(draw_unit, draw_dsc, &draw_area, &decoder_dsc, &sup, coords);
+    }
+
+    lv_image_decoder_close(&decoder_dsc);
+}
+
+lv_result_t _lv_draw_sw_image_decode_area(lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * area,
+                                          lv_image_decoder_dsc_t * area_dsc)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+
+    /*The indexed images are decoded to ARGB8888 and RGB565A8 has an RGB565 and an A8 plane*/
+    lv_color_format_t cf = decoder_dsc->header.cf;
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf)) cf = LV_COLOR_FORMAT_ARGB8888;
+    bool has_a8_plane = cf == LV_COLOR_FORMAT_RGB565A8;
+    uint32_t px_size = has_a8_plane ? 2 : lv_color_format_get_size(cf);
+    uint32_t stride = w * px_size;
+
+    uint8_t * buf = lv_malloc(stride * h + (has_a8_plane ? w * h : 0));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return LV_RESULT_INVALID;
+
+    lv_area_t decoded_area;
+    decoded_area.x1 = LV_COORD_MIN;
+    decoded_area.y1 = LV_COORD_MIN;
+    decoded_area.x2 = LV_COORD_MIN;
+    decoded_area.y2 = LV_COORD_MIN;
+    while(lv_image_decoder_get_area(decoder_dsc, area, &decoded_area) == LV_RESULT_OK) {
+        /*The parts can be larger than the area (e.g. JPG blocks or tiles)*/
+        lv_area_t copy_area;
+        if(!_lv_area_intersect(&copy_area, area, &decoded_area)) continue;
+
+        uint32_t part_stride = decoder_dsc->header.stride;
+        lv_coord_t part_h = lv_area_get_height(&decoded_area);
+        lv_coord_t part_w = lv_area_get_width(&decoded_area);
+        lv_coord_t part_x = copy_area.x1 - decoded_area.x1;
+        lv_coord_t buf_x = copy_area.x1 - area->x1;
+        lv_coord_t copy_w = lv_area_get_width(&copy_area);
+        lv_coord_t y;
+        for(y = copy_area.y1; y <= copy_area.y2; y++) {
+            lv_coord_t part_y = y - decoded_area.y1;
+            lv_coord_t buf_y = y - area->y1;
+            lv_memcpy(buf + buf_y * stride + buf_x * px_size,
+                      decoder_dsc->img_data + part_y * part_stride + part_x * px_size, copy_w * px_size);
+
+            if(has_a8_plane) {
+                lv_memcpy(buf + stride * h + buf_y * w + buf_x,
+                          decoder_dsc->img_data + part_stride * part_h + part_y * part_w + part_x, copy_w);
             }
         }
     }
 
-    lv_image_decoder_close(&decoder_dsc);
+    *area_dsc = *decoder_dsc;
+    area_dsc->header.w = w;
+    area_dsc->header.h = h;
+    area_dsc->header.cf = cf;
+    area_dsc->header.stride = stride;
+    area_dsc->img_data = buf;
+
+    return LV_RESULT_OK;
 }
 
 
@@ -227,7 +279,25 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
     uint32_t img_stride = header->stride;
     lv_color_format_t cf = header->cf;
 
-    cf = LV_COLOR_FORMAT_IS_INDEXED(cf) ? LV_COLOR_FORMAT_ARGB8888 : cf,
+    /*Transformations need the colors of the neighbour pixels, so convert the indexed images first*/
+    uint8_t * argb_buf = NULL;
+    const uint8_t * indexed_argb_buf = NULL;
+    lv_cache_entry_t * indexed_argb_cache = NULL;
+    if(transformed && LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        indexed_argb_buf = get_indexed_as_argb8888(src, &indexed_argb_cache);
+        if(indexed_argb_buf == NULL) return;
+        src_buf = indexed_argb_buf;
+        cf = LV_COLOR_FORMAT_ARGB8888;
+        img_stride = header->w * sizeof(lv_color32_t);
+    }
+    /*YUV images are converted while blending, but to transform or recolor them they are converted first*/
+    else if(cf == LV_COLOR_FORMAT_I420 && (transformed || draw_dsc->recolor_opa != LV_OPA_TRANSP)) {
+        argb_buf = yuv_to_xrgb8888(src);
+        if(argb_buf == NULL) return;
+        src_buf = argb_buf;
+        cf = LV_COLOR_FORMAT_XRGB8888;
+        img_stride = header->w * sizeof(lv_color32_t);
+    }
 
     lv_memzero(&blend_dsc, sizeof(lv_draw_sw_blend_dsc_t));
     blend_dsc.opa = draw_dsc->opa;
@@ -247,6 +317,23 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         blend_dsc.blend_area = img_coords;
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
+    /*Blend the indices through the palette converted to the color format of the layer. It's recolored too.*/
+    else if(!transformed && LV_COLOR_FORMAT_IS_INDEXED(cf)) {
+        lv_cache_entry_t * palette_cache;
+        lv_color_format_t dest_cf = draw_unit->target_layer->draw_buf.color_format;
+        const lv_draw_sw_blend_palette_t * palette;
+        palette = lv_draw_sw_blend_palette_get(src->palette, src->palette_size, dest_cf,
+                                               draw_dsc->recolor, draw_dsc->recolor_opa, &palette_cache);
+        if(palette == NULL) return;
+
+        blend_dsc.src_area = img_coords;
+        blend_dsc.src_buf = src_buf;
+        blend_dsc.blend_area = img_coords;
+        blend_dsc.src_color_format = cf;
+        blend_dsc.src_palette = palette;
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+        lv_draw_sw_blend_palette_release(palette_cache);
+    }
     else if(!transformed && cf == LV_COLOR_FORMAT_RGB565A8 && draw_dsc->recolor_opa == LV_OPA_TRANSP) {
         lv_coord_t src_h = lv_area_get_height(img_coords);
         lv_coord_t src_w = lv_area_get_width(img_coords);
@@ -380,6 +467,19 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
                                    ((c_mult[0] + (buf16[i] & 0x1F) * mix_inv) >> 8);
                     }
                 }
+                else if(cf_final == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) {
+                    /*The recolor needs to be premultiplied with the alpha of each pixel too*/
+                    uint32_t size = lv_area_get_size(&blend_area);
+                    uint32_t i;
+                    lv_color32_t * tmp_buf_c32 = (lv_color32_t *)tmp_buf;
+                    for(i = 0; i < size; i++) {
+                        lv_color32_t * px = &tmp_buf_c32[i];
+                        uint8_t a = px->alpha;
+                        px->blue = (LV_UDIV255(color.blue * a) * mix + px->blue * mix_inv) >> 8;
+                        px->green = (LV_UDIV255(color.green * a) * mix + px->green * mix_inv) >> 8;
+                        px->red = (LV_UDIV255(color.red * a) * mix + px->red * mix_inv) >> 8;
+                    }
+                }
                 else  if(cf_final != LV_COLOR_FORMAT_A8) {
                     uint32_t size = lv_area_get_size(&blend_area);
                     uint32_t i;
@@ -413,10 +513,230 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
 
         lv_free(tmp_buf);
     }
+
+    lv_free(argb_buf);
+    if(indexed_argb_cache) {
+        lv_cache_lock();
+        lv_cache_release(indexed_argb_cache);
+        lv_cache_unlock();
+    }
+    else if(indexed_argb_buf) {
+        lv_draw_buf_free((void *)indexed_argb_buf);
+    }
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get a whole indexed image converted to ARGB8888. If the decoder cached the indices, the converted image is
+ * cached too and it's dropped together with the indices.
+ * @param src       an opened indexed image with its `palette`
+ * @param entry     set to the cache entry of the converted image to release it,
+ *                  or NULL if it's not cached and needs to be freed by `lv_draw_buf_free`
+ * @return          the converted image with `header.w * 4` stride, or NULL on error
+ */
+static const uint8_t * get_indexed_as_argb8888(const lv_image_decoder_dsc_t * src, lv_cache_entry_t ** entry)
+{
+    *entry = NULL;
+    if(src->decoder == NULL || !src->decoder->cached) return indexed_to_argb8888(src);
+
+    lv_cache_src_type_t src_type = src->src_type == LV_IMAGE_SRC_FILE ? LV_CACHE_SRC_TYPE_STR : LV_CACHE_SRC_TYPE_PTR;
+    lv_cache_lock();
+    /*The cached data of an indexed image starts with its palette*/
+    lv_cache_entry_t * base = lv_cache_find(src->src, src_type, 0, 0);
+    if(base == NULL || base->data != (const void *)src->palette) {
+        lv_cache_unlock();
+        return indexed_to_argb8888(src);
+    }
+
+    if(base->derived) {
+        *entry = base->derived;
+        const uint8_t * cached_buf = lv_cache_get_data(base->derived);
+        lv_cache_unlock();
+        return cached_buf;
+    }
+    lv_cache_unlock();
+
+    /*Convert without locking the cache, as other threads might need it meanwhile*/
+    uint8_t * buf = indexed_to_argb8888(src);
+    if(buf == NULL) return NULL;
+
+    lv_cache_lock();
+    /*The image might have been dropped or converted by an other thread meanwhile*/
+    base = lv_cache_find(src->src, src_type, 0, 0);
+    if(base == NULL || base->data != (const void *)src->palette) {
+        lv_cache_unlock();
+        return buf;
+    }
+
+    if(base->derived) {
+        lv_draw_buf_free(buf);
+        *entry = base->derived;
+    }
+    else {
+        *entry = lv_cache_add(src->header.w * src->header.h * sizeof(lv_color32_t));
+        if(*entry == NULL) {
+            lv_cache_unlock();
+            return buf;
+        }
+
+        /*It's found only through `base`. Its own buffer is a unique source.*/
+        (*entry)->src = buf;
+        (*entry)->src_type = LV_CACHE_SRC_TYPE_PTR;
+        (*entry)->data = buf;
+        (*entry)->free_data = 1;
+        lv_cache_set_derived(base, *entry);
+    }
+
+    const uint8_t * cached_buf = lv_cache_get_data(*entry);
+    lv_cache_unlock();
+    return cached_buf;
+}
+
+/**
+ * Convert a whole indexed image to ARGB8888
+ * @param src   an opened indexed image with its `palette`
+ * @return      the converted image with `header.w * 4` stride which needs to be freed by `lv_draw_buf_free`,
+ *              or NULL on error
+ */
+static uint8_t * indexed_to_argb8888(const lv_image_decoder_dsc_t * src)
+{
+    const lv_image_header_t * header = &src->header;
+    uint8_t * buf = lv_draw_buf_malloc(header->w * header->h * sizeof(lv_color32_t), LV_COLOR_FORMAT_ARGB8888);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return NULL;
+
+    /*Recolor is applied later on the transformed pixels*/
+    lv_cache_entry_t * palette_cache;
+    const lv_draw_sw_blend_palette_t * palette = lv_draw_sw_blend_palette_get(src->palette, src->palette_size,
+                                                                              LV_COLOR_FORMAT_ARGB8888,
+                                                                              lv_color_black(), LV_OPA_TRANSP,
+                                                                              &palette_cache);
+    if(palette == NULL) {
+        lv_draw_buf_free(buf);
+        return NULL;
+    }
+
+    uint32_t y;
+    for(y = 0; y < header->h; y++) {
+        lv_draw_sw_blend_palette_lookup(palette, header->cf, src->img_data + y * header->stride, 0, header->w,
+                                        buf + y * header->w * sizeof(lv_color32_t), NULL);
+    }
+
+    lv_draw_sw_blend_palette_release(palette_cache);
+    return buf;
+}
+
+/**
+ * Convert a whole I420 image to XRGB8888
+ * @param src   an opened I420 image
+ * @return      the converted image with `header.w * 4` stride which needs to be freed by `lv_free`, or NULL on error
+ */
+static uint8_t * yuv_to_xrgb8888(const lv_image_decoder_dsc_t * src)
+{
+    const lv_image_header_t * header = &src->header;
+    uint8_t * buf = lv_malloc(header->w * header->h * sizeof(lv_color32_t));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return NULL;
+
+    lv_draw_sw_blend_yuv_planes_t planes;
+    lv_draw_sw_blend_yuv_planes_init(&planes, src->img_data, header->stride, header->h);
+
+    uint32_t y;
+    for(y = 0; y < header->h; y++) {
+        lv_draw_sw_blend_yuv_convert(&planes, 0, y, header->w, buf + y * header->w * sizeof(lv_color32_t),
+                                     LV_COLOR_FORMAT_XRGB8888);
+    }
+
+    return buf;
+}
+
+/**
+ * Decode and draw an image part by part. If the decoder supports mip levels, the smallest level
+ * which is not smaller than the transformed image is drawn. To transform the image only the parts
+ * needed for the draw area are decoded.
+ * @param draw_unit     pointer to a draw unit
+ * @param draw_dsc      the image draw descriptor
+ * @param draw_area     the area to draw on the screen, already clipped
+ * @param decoder_dsc   an opened image whose `img_data` is NULL
+ * @param sup           supplementary draw data
+ * @param coords        coordinates of the image without transformation
+ */
+static void draw_parts(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * draw_area,
+                       lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup, const lv_area_t * coords)
+{
+    /*Halving the zoom of the image is the same as drawing the next mip level with the same zoom*/
+    lv_draw_image_dsc_t level_dsc = *draw_dsc;
+    uint32_t level = 0;
+    while(level + 1 < decoder_dsc->level_cnt && level_dsc.zoom <= LV_SCALE_NONE / 2) {
+        level_dsc.zoom *= 2;
+        level++;
+    }
+    decoder_dsc->level = level;
+    level_dsc.pivot.x = draw_dsc->pivot.x >> level;
+    level_dsc.pivot.y = draw_dsc->pivot.y >> level;
+
+    /*Place the level to keep the pivot point in place*/
+    lv_area_t level_coords;
+    level_coords.x1 = coords->x1 + draw_dsc->pivot.x - level_dsc.pivot.x;
+    level_coords.y1 = coords->y1 + draw_dsc->pivot.y - level_dsc.pivot.y;
+    level_coords.x2 = level_coords.x1 + ((decoder_dsc->header.w + (1 << level) - 1) >> level) - 1;
+    level_coords.y2 = level_coords.y1 + ((decoder_dsc->header.h + (1 << level) - 1) >> level) - 1;
+
+    /*Find the area of the level which is transformed to the draw area*/
+    bool transformed = level_dsc.rotation || level_dsc.zoom != LV_SCALE_NONE;
+    lv_area_t full_area = *draw_area;
+    lv_area_move(&full_area, -level_coords.x1, -level_coords.y1);
+    if(transformed) {
+        lv_point_t ofs = {full_area.x1, full_area.y1};
+        lv_point_t pivot = {level_dsc.pivot.x - ofs.x, level_dsc.pivot.y - ofs.y};
+        uint32_t zoom_inv = LV_MIN((256 * 256) / level_dsc.zoom, 0xFFFF);
+        _lv_image_buf_get_transformed_area(&full_area, lv_area_get_width(draw_area), lv_area_get_height(draw_area),
+                                           -level_dsc.rotation, zoom_inv, &pivot);
+        lv_area_move(&full_area, ofs.x, ofs.y);
+        lv_area_increase(&full_area, 1, 1);   /*Rounding*/
+
+        lv_area_t level_area = {0, 0, lv_area_get_width(&level_coords) - 1, lv_area_get_height(&level_coords) - 1};
+        if(!_lv_area_intersect(&full_area, &full_area, &level_area)) return;
+
+        /*Collect the parts of the area to transform them together, so the neighbour pixels of the parts are mixed*/
+        lv_image_decoder_dsc_t area_dsc;
+        if(_lv_draw_sw_image_decode_area(decoder_dsc, &full_area, &area_dsc) != LV_RESULT_OK) return;
+
+        lv_area_t area_coords = full_area;
+        lv_area_move(&area_coords, level_coords.x1, level_coords.y1);
+        level_dsc.pivot.x -= full_area.x1;
+        level_dsc.pivot.y -= full_area.y1;
+        img_draw_core(draw_unit, &level_dsc, draw_area, &area_dsc, sup, &area_coords);
+        lv_free((void *)area_dsc.img_data);
+        return;
+    }
+
+    lv_area_t decoded_area;
+    decoded_area.x1 = LV_COORD_MIN;
+    decoded_area.y1 = LV_COORD_MIN;
+    decoded_area.x2 = LV_COORD_MIN;
+    decoded_area.y2 = LV_COORD_MIN;
+    while(lv_image_decoder_get_area(decoder_dsc, &full_area, &decoded_area) == LV_RESULT_OK) {
+        lv_area_t part_coords = decoded_area;
+        lv_area_move(&part_coords, level_coords.x1, level_coords.y1);
+
+        /*The decoded part is drawn as an image on its own*/
+        lv_image_decoder_dsc_t part_dsc = *decoder_dsc;
+        part_dsc.header.w = lv_area_get_width(&decoded_area);
+        part_dsc.header.h = lv_area_get_height(&decoded_area);
+
+        /*The decoders return the colors of the indexed images*/
+        if(LV_COLOR_FORMAT_IS_INDEXED(part_dsc.header.cf)) part_dsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+
+        /*Limit draw area to the current decoded area and draw the image*/
+        lv_area_t draw_area_sub;
+        if(_lv_area_intersect(&draw_area_sub, draw_area, &part_coords)) {
+            img_draw_core(draw_unit, &level_dsc, &draw_area_sub, &part_dsc, sup, &part_coords);
+        }
+    }
+}
+
 #endif /*LV_USE_DRAW_SW*/
@@ -17,21 +17,51 @@
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
 #include "../../stdlib/lv_string.h"
+#include "blend/lv_draw_sw_blend_subpx.h"
 
 /*********************
  *      DEFINES
  *********************/
+/*Wider or taller lines are drawn letter by letter to limit the memory usage*/
+#define LINE_BUF_SIZE_MAX   (32 * 1024)
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Collects the coverage of the letters of a line into one A8 buffer to blend them at once.
+ * `base_unit` is a copy of the real draw unit and needs to be the first member
+ * because `lv_draw_label_interate_letters` passes it to `line_batch_cb`.
+ */
+typedef struct {
+    lv_draw_unit_t base_unit;
+    lv_draw_unit_t * draw_unit;     /*The real draw unit*/
+    uint8_t * buf_unaligned;
+    uint8_t * buf;
+    uint32_t stride;
+    lv_area_t buf_area;             /*The area of the current line covered by `buf`*/
+    lv_area_t dirty_area;           /*The part of `buf_area` with letters. Empty if x1 > x2*/
+    bool started;                   /*A line is collected in `buf`*/
+    lv_color_t color;
+    lv_opa_t opa;
+} line_batch_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 LV_ATTRIBUTE_FAST_MEM static void draw_letter_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
                                                  lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
+static void line_batch_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                          lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area);
+static void line_batch_start(line_batch_t * batch, int32_t line_y, lv_color_t color, lv_opa_t opa);
+static bool line_batch_add(line_batch_t * batch, const lv_area_t * area, const uint8_t * bitmap, uint32_t stride);
+static void line_batch_flush(line_batch_t * batch);
+#if LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+static void draw_text_run(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords,
+                          const lv_draw_sw_text_cache_entry_t * entry);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -53,6 +83,45 @@ void lv_draw_sw_label(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * ds
 {
     if(dsc->opa <= LV_OPA_MIN) return;
 
+#if LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+    lv_draw_sw_text_cache_entry_t * entry = _lv_draw_sw_text_cache_acquire(dsc, coords);
+    if(entry) {
+        draw_text_run(draw_unit, dsc, coords, entry);
+        _lv_draw_sw_text_cache_release(entry);
+        return;
+    }
+#endif
+
+    /*Collect the letters line by line and blend each line only once*/
+    lv_area_t clipped_area;
+    if(!_lv_area_intersect(&clipped_area, coords, draw_unit->clip_area)) return;
+
+    int32_t line_h = lv_font_get_line_height(dsc->font) + dsc->line_space;
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(&clipped_area), LV_COLOR_FORMAT_A8);
+    uint32_t buf_size = stride * line_h;
+    if(line_h > 0 && buf_size <= LINE_BUF_SIZE_MAX) {
+        line_batch_t batch;
+        lv_memzero(&batch, sizeof(batch));
+        batch.buf_unaligned = lv_draw_buf_malloc(buf_size, LV_COLOR_FORMAT_A8);
+        if(batch.buf_unaligned) {
+            batch.base_unit = *draw_unit;
+            batch.draw_unit = draw_unit;
+            batch.buf = lv_draw_buf_align_buf(batch.buf_unaligned, LV_COLOR_FORMAT_A8);
+            batch.stride = stride;
+            batch.buf_area.x1 = clipped_area.x1;
+            batch.buf_area.x2 = clipped_area.x2;
+            batch.buf_area.y2 = line_h - 1;
+            batch.dirty_area.x1 = 1;
+            batch.dirty_area.x2 = 0;
+            lv_memzero(batch.buf, buf_size);
+
+            lv_draw_label_interate_letters(&batch.base_unit, dsc, coords, line_batch_cb);
+            line_batch_flush(&batch);
+            lv_draw_buf_free(batch.buf_unaligned);
+            return;
+        }
+    }
+
     lv_draw_label_interate_letters(draw_unit, dsc, coords, draw_letter_cb);
 }
 
@@ -89,6 +158,22 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_cb(lv_draw_unit_t * draw_unit, lv_
 
             lv_draw_sw_blend(draw_unit, &blend_dsc);
         }
+#if LV_USE_FONT_SUBPX
+        else if(glyph_draw_dsc->format == LV_DRAW_LETTER_BITMAP_FORMAT_A8_SUBPX) {
+            lv_draw_sw_blend_subpx_dsc_t blend_dsc;
+            lv_memzero(&blend_dsc, sizeof(blend_dsc));
+            blend_dsc.color = glyph_draw_dsc->color;
+            blend_dsc.opa = glyph_draw_dsc->opa;
+            blend_dsc.mask_buf = glyph_draw_dsc->bitmap;
+            blend_dsc.mask_area = glyph_draw_dsc->letter_coords;
+            blend_dsc.mask_stride = lv_draw_buf_width_to_stride(lv_area_get_width(glyph_draw_dsc->letter_coords) * 3,
+                                                                LV_COLOR_FORMAT_A8);
+            blend_dsc.blend_area = glyph_draw_dsc->letter_coords;
+            blend_dsc.bgr = lv_display_get_subpx(_lv_refr_get_disp_refreshing()) == LV_DISPLAY_SUBPX_BGR;
+
+            lv_draw_sw_blend_subpx(draw_unit, &blend_dsc);
+        }
+#endif
         else if(glyph_draw_dsc->format == LV_DRAW_LETTER_BITMAP_FORMAT_IMAGE) {
 #if LV_USE_IMGFONT
             lv_draw_image_dsc_t img_dsc;
@@ -108,4 +193,174 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_cb(lv_draw_unit_t * draw_unit, lv_
 
 }
 
+static void line_batch_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_draw_dsc,
+                          lv_draw_fill_dsc_t * fill_draw_dsc, const lv_area_t * fill_area)
+{
+    line_batch_t * batch = (line_batch_t *)draw_unit;
+
+    if(glyph_draw_dsc) {
+        bool added = false;
+        if(glyph_draw_dsc->bitmap && glyph_draw_dsc->format == LV_DRAW_LETTER_BITMAP_FORMAT_A8) {
+            line_batch_start(batch, glyph_draw_dsc->bg_coords->y1, glyph_draw_dsc->color, glyph_draw_dsc->opa);
+            uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(glyph_draw_dsc->letter_coords),
+                                                          LV_COLOR_FORMAT_A8);
+            added = line_batch_add(batch, glyph_draw_dsc->letter_coords, glyph_draw_dsc->bitmap, stride);
+        }
+
+        /*Keep the drawing order: blend the collected letters first*/
+        if(!added) {
+            line_batch_flush(batch);
+            draw_letter_cb(batch->draw_unit, glyph_draw_dsc, NULL, NULL);
+        }
+    }
+
+    if(fill_draw_dsc && fill_area) {
+        /*The underline and strikethrough have the color of the text so they can be added to the line*/
+        bool added = false;
+        if(batch->started && fill_draw_dsc->radius == 0 && fill_draw_dsc->grad.dir == LV_GRAD_DIR_NONE &&
+           lv_color_eq(fill_draw_dsc->color, batch->color) && fill_draw_dsc->opa == batch->opa) {
+            added = line_batch_add(batch, fill_area, NULL, 0);
+        }
+
+        if(!added) {
+            line_batch_flush(batch);
+            draw_letter_cb(batch->draw_unit, NULL, fill_draw_dsc, fill_area);
+        }
+    }
+}
+
+/**
+ * Start collecting a new line if the letter is in an other line or has a different style (e.g. selected)
+ */
+static void line_batch_start(line_batch_t * batch, int32_t line_y, lv_color_t color, lv_opa_t opa)
+{
+    if(batch->started && batch->buf_area.y1 == line_y && lv_color_eq(batch->color, color) && batch->opa == opa) return;
+
+    line_batch_flush(batch);
+
+    int32_t line_h = lv_area_get_height(&batch->buf_area);
+    batch->buf_area.y1 = line_y;
+    batch->buf_area.y2 = line_y + line_h - 1;
+    batch->color = color;
+    batch->opa = opa;
+    batch->started = true;
+}
+
+/**
+ * Add the coverage of a letter to the current line
+ * @param batch     the line batch
+ * @param area      coordinates of the letter or fill area
+ * @param bitmap    A8 bitmap of the letter or NULL to fully cover `area`
+ * @param stride    stride of `bitmap`
+ * @return          false if the visible part of `area` is out of the line's buffer
+ */
+static bool line_batch_add(line_batch_t * batch, const lv_area_t * area, const uint8_t * bitmap, uint32_t stride)
+{
+    lv_area_t a;
+    if(!_lv_area_intersect(&a, area, batch->draw_unit->clip_area)) return true;
+    if(!_lv_area_is_in(&a, &batch->buf_area, 0)) return false;
+
+    int32_t w = lv_area_get_width(&a);
+    uint8_t * dest = batch->buf + (a.y1 - batch->buf_area.y1) * batch->stride + (a.x1 - batch->buf_area.x1);
+    int32_t y;
+    if(bitmap) {
+        const uint8_t * src = bitmap + (a.y1 - area->y1) * stride + (a.x1 - area->x1);
+        for(y = a.y1; y <= a.y2; y++) {
+            int32_t x;
+            for(x = 0; x < w; x++) {
+                /*Overlapping letters: combine the coverages like blending one over the other*/
+                if(src[x] == 0) continue;
+                else if(dest[x] == 0) dest[x] = src[x];
+                else dest[x] = 255 - LV_UDIV255((255 - dest[x]) * (255 - src[x]));
+            }
+            dest += batch->stride;
+            src += stride;
+        }
+    }
+    else {
+        for(y = a.y1; y <= a.y2; y++) {
+            lv_memset(dest, 0xff, w);
+            dest += batch->stride;
+        }
+    }
+
+    if(batch->dirty_area.x1 > batch->dirty_area.x2) batch->dirty_area = a;
+    else _lv_area_join(&batch->dirty_area, &batch->dirty_area, &a);
+
+    return true;
+}
+
+/**
+ * Blend the collected letters of the current line and clear the buffer
+ */
+static void line_batch_flush(line_batch_t * batch)
+{
+    batch->started = false;
+    if(batch->dirty_area.x1 > batch->dirty_area.x2) return;
+
+    lv_area_t mask_area = batch->buf_area;
+    mask_area.x2 = mask_area.x1 + batch->stride - 1;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = batch->color;
+    blend_dsc.opa = batch->opa;
+    blend_dsc.mask_buf = batch->buf;
+    blend_dsc.mask_area = &mask_area;
+    blend_dsc.blend_area = &batch->dirty_area;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    lv_draw_sw_blend(batch->draw_unit, &blend_dsc);
+
+    int32_t w = lv_area_get_width(&batch->dirty_area);
+    uint8_t * buf = batch->buf + (batch->dirty_area.y1 - batch->buf_area.y1) * batch->stride +
+                    (batch->dirty_area.x1 - batch->buf_area.x1);
+    int32_t y;
+    for(y = batch->dirty_area.y1; y <= batch->dirty_area.y2; y++) {
+        lv_memzero(buf, w);
+        buf += batch->stride;
+    }
+
+    batch->dirty_area.x1 = 1;
+    batch->dirty_area.x2 = 0;
+}
+
+#if LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+/**
+ * Draw a rendered text with its coverage map as mask.
+ * Blend it line by line to let the blender skip the transparent parts between the letters.
+ */
+static void draw_text_run(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords,
+                          const lv_draw_sw_text_cache_entry_t * entry)
+{
+    lv_area_t clipped_area;
+    if(!_lv_area_intersect(&clipped_area, coords, draw_unit->clip_area)) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+
+    lv_area_t blend_area;
+    blend_area.x1 = clipped_area.x1;
+    blend_area.x2 = clipped_area.x2;
+    blend_dsc.blend_area = &blend_area;
+
+    lv_area_t mask_area;
+    mask_area.x1 = coords->x1;
+    mask_area.x2 = coords->x1 + entry->stride - 1;
+    blend_dsc.mask_area = &mask_area;
+
+    int32_t y;
+    for(y = clipped_area.y1; y <= clipped_area.y2; y++) {
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        mask_area.y1 = y;
+        mask_area.y2 = y;
+        blend_dsc.mask_buf = entry->buf + (y - coords->y1) * entry->stride;
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+    }
+}
+#endif
+
 #endif /*LV_USE_DRAW_SW*/
@@ -21,9 +21,15 @@
  *      DEFINES
  *********************/
 #define CIRCLE_CACHE_LIFE_MAX           1000
-#define CIRCLE_CACHE_AGING(life, r)     life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
-#define circle_cache_mutex              LV_GLOBAL_DEFAULT()->draw_info.circle_cache_mutex
+#define CIRCLE_CACHE_AGING(life, r)     life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), CIRCLE_CACHE_LIFE_MAX)
+/*Lose 1/8 of the life on every miss, so the circles which are not used anymore can be replaced*/
+#define CIRCLE_CACHE_DECAY(life)        life -= (life + 7) >> 3
 #define _circle_cache                   LV_GLOBAL_DEFAULT()->sw_circle_cache
+#define _circle_cache_shards            LV_GLOBAL_DEFAULT()->sw_circle_cache_shards
+#define CIRCLE_SHARD_CNT                _LV_DRAW_SW_CIRCLE_CACHE_SHARD_CNT
+
+/*Memory allocated for a circle by `circ_calc_aa4`*/
+#define CIRCLE_BYTE_SIZE(r)             ((uint32_t)(r) * 6 + 6)
 
 /**********************
  *      TYPEDEFS
@@ -61,9 +67,15 @@ static void circ_init(lv_point_t * c, lv_coord_t * tmp, lv_coord_t radius);
 static bool circ_cont(lv_point_t * c);
 static void circ_next(lv_point_t * c, lv_coord_t * tmp);
 static void circ_calc_aa4(_lv_draw_sw_mask_radius_circle_dsc_t * c, lv_coord_t radius);
+static uint32_t circle_shard_id(lv_coord_t radius);
+static _lv_draw_sw_mask_radius_circle_dsc_t * circle_cache_find(_lv_draw_sw_mask_circle_cache_shard_t * shard,
+                                                                 lv_coord_t radius);
+static _lv_draw_sw_mask_radius_circle_dsc_t * circle_cache_get_entry(_lv_draw_sw_mask_circle_cache_shard_t * shard,
+                                                                      uint32_t shard_id, lv_coord_t radius);
 static lv_opa_t * get_next_line(_lv_draw_sw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
                                 lv_coord_t * x_start);
 LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
+LV_ATTRIBUTE_FAST_MEM static lv_coord_t span_same_end(const lv_opa_t * mask_buf, lv_coord_t x, lv_coord_t len);
 
 /**********************
  *  STATIC VARIABLES
@@ -79,7 +91,11 @@ LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_
 
 void lv_draw_sw_mask_init(void)
 {
-    lv_mutex_init(&circle_cache_mutex);
+    uint32_t i;
+    for(i = 0; i < CIRCLE_SHARD_CNT; i++) {
+        lv_mutex_init(&_circle_cache_shards[i].mutex);
+        lv_hash_lru_init(&_circle_cache_shards[i].circles);
+    }
 }
 
 
@@ -102,6 +118,128 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_mask_apply(void * masks[]
     return changed ? LV_DRAW_SW_MASK_RES_CHANGED : LV_DRAW_SW_MASK_RES_FULL_COVER;
 }
 
+uint32_t lv_draw_sw_mask_get_spans(const lv_opa_t * mask_buf, lv_coord_t len, lv_draw_sw_mask_span_t spans[],
+                                   uint32_t span_max)
+{
+    if(span_max == 0 || len <= 0) return 0;
+
+    uint32_t cnt = 0;
+    lv_coord_t x = 0;
+    while(x < len) {
+        /*Use a run of 0 or 255 as a span on its own if it's long enough*/
+        lv_opa_t v = mask_buf[x];
+        if(v == LV_OPA_TRANSP || v == LV_OPA_COVER) {
+            lv_coord_t end = span_same_end(mask_buf, x, len);
+            if(end - x >= LV_DRAW_SW_MASK_SPAN_MIN_LEN || end - x == len) {
+                /*Leave the last span for the remaining pixels*/
+                if(cnt == span_max - 1 && end != len) break;
+
+                spans[cnt].x = x;
+                spans[cnt].len = end - x;
+                spans[cnt].res = v == LV_OPA_TRANSP ? LV_DRAW_SW_MASK_RES_TRANSP : LV_DRAW_SW_MASK_RES_FULL_COVER;
+                cnt++;
+                x = end;
+                continue;
+            }
+        }
+
+        if(cnt == span_max - 1) break;
+
+        /*Collect the partially covered pixels (and the too short runs) until a long run is found*/
+        lv_coord_t start = x;
+        while(x < len) {
+            v = mask_buf[x];
+            if(v == LV_OPA_TRANSP || v == LV_OPA_COVER) {
+                lv_coord_t end = span_same_end(mask_buf, x, len);
+                if(end - x >= LV_DRAW_SW_MASK_SPAN_MIN_LEN) break;
+                x = end;
+            }
+            else {
+                x++;
+            }
+        }
+
+        spans[cnt].x = start;
+        spans[cnt].len = x - start;
+        spans[cnt].res = LV_DRAW_SW_MASK_RES_CHANGED;
+        cnt++;
+    }
+
+    /*Out of spans: the rest is handled as one partially covered span*/
+    if(x < len) {
+        spans[cnt].x = x;
+        spans[cnt].len = len - x;
+        spans[cnt].res = LV_DRAW_SW_MASK_RES_CHANGED;
+        cnt++;
+    }
+
+    return cnt;
+}
+
+LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_mask_apply_spans(void * masks[], lv_opa_t * mask_buf,
+                                                                        lv_coord_t abs_x, lv_coord_t abs_y,
+                                                                        lv_coord_t len, lv_draw_sw_mask_span_t spans[],
+                                                                        uint32_t span_max, uint32_t * span_cnt)
+{
+    *span_cnt = 0;
+    if(span_max == 0 || len <= 0) return lv_draw_sw_mask_apply(masks, mask_buf, abs_x, abs_y, len);
+
+    uint32_t cnt = 0;
+    bool all_transp = true;
+    bool all_cover = true;
+    lv_coord_t x;
+    for(x = 0; x < len; x += LV_DRAW_SW_MASK_SPAN_CHUNK_LEN) {
+        lv_coord_t chunk_len = LV_MIN(LV_DRAW_SW_MASK_SPAN_CHUNK_LEN, len - x);
+
+        /*Intersect the coverage of the masks on this interval. The masks return early with
+         *TRANSP or FULL_COVER if the interval is completely outside or inside of them,
+         *so only the intervals on the edges are calculated pixel by pixel.*/
+        lv_draw_sw_mask_res_t res = LV_DRAW_SW_MASK_RES_FULL_COVER;
+        uint32_t i;
+        for(i = 0; masks[i]; i++) {
+            _lv_draw_sw_mask_common_dsc_t * dsc = masks[i];
+            lv_draw_sw_mask_res_t mask_res = dsc->cb(&mask_buf[x], abs_x + x, abs_y, chunk_len, masks[i]);
+            if(mask_res == LV_DRAW_SW_MASK_RES_TRANSP) {
+                res = LV_DRAW_SW_MASK_RES_TRANSP;
+                break;
+            }
+            else if(mask_res == LV_DRAW_SW_MASK_RES_CHANGED) {
+                res = LV_DRAW_SW_MASK_RES_CHANGED;
+            }
+        }
+
+        /*Keep the mask valid everywhere for the blend functions which still use it.
+         *A fully covered interval is left unchanged.*/
+        if(res == LV_DRAW_SW_MASK_RES_TRANSP) lv_memzero(&mask_buf[x], chunk_len);
+
+        if(res != LV_DRAW_SW_MASK_RES_TRANSP) all_transp = false;
+        if(res != LV_DRAW_SW_MASK_RES_FULL_COVER) all_cover = false;
+
+        /*Join the interval to the previous span if they are the same kind*/
+        if(cnt > 0 && spans[cnt - 1].res == res) {
+            spans[cnt - 1].len += chunk_len;
+        }
+        /*Out of spans: the last one is handled as partially covered.
+         *It's still valid as the mask is set on the whole line.*/
+        else if(cnt == span_max) {
+            spans[cnt - 1].len += chunk_len;
+            spans[cnt - 1].res = LV_DRAW_SW_MASK_RES_CHANGED;
+        }
+        else {
+            spans[cnt].x = x;
+            spans[cnt].len = chunk_len;
+            spans[cnt].res = res;
+            cnt++;
+        }
+    }
+
+    if(all_transp) return LV_DRAW_SW_MASK_RES_TRANSP;
+    if(all_cover) return LV_DRAW_SW_MASK_RES_FULL_COVER;
+
+    *span_cnt = cnt;
+    return LV_DRAW_SW_MASK_RES_CHANGED;
+}
+
 /**
  * Free the data from the parameter.
  * It's called inside `lv_draw_mask_remove_id` and `lv_draw_mask_remove_custom`
@@ -111,32 +249,100 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_mask_apply(void * masks[]
  */
 void lv_draw_sw_mask_free_param(void * p)
 {
-    lv_mutex_lock(&circle_cache_mutex);
     _lv_draw_sw_mask_common_dsc_t * pdsc = p;
     if(pdsc->type == LV_DRAW_SW_MASK_TYPE_RADIUS) {
         lv_draw_sw_mask_radius_param_t * radius_p = (lv_draw_sw_mask_radius_param_t *) p;
         if(radius_p->circle) {
-            if(radius_p->circle->life < 0) {
+            /*Temporary circles are not shared, they can be freed without locking.
+             *Check the address because the life of the cached circles can be changed by the other draw units.*/
+            if(radius_p->circle < &_circle_cache[0] ||
+               radius_p->circle >= &_circle_cache[LV_DRAW_SW_CIRCLE_CACHE_SIZE]) {
                 lv_free(radius_p->circle->cir_opa);
                 lv_free(radius_p->circle);
             }
             else {
+                lv_mutex_t * mutex = &_circle_cache_shards[circle_shard_id(radius_p->circle->radius)].mutex;
+                lv_mutex_lock(mutex);
                 radius_p->circle->used_cnt--;
+                lv_mutex_unlock(mutex);
             }
         }
     }
-
-    lv_mutex_unlock(&circle_cache_mutex);
 }
 
 void _lv_draw_sw_mask_cleanup(void)
 {
-    uint8_t i;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].buf) {
-            lv_free(_circle_cache[i].buf);
+    uint32_t s;
+    for(s = 0; s < CIRCLE_SHARD_CNT; s++) {
+        _lv_draw_sw_mask_circle_cache_shard_t * shard = &_circle_cache_shards[s];
+        lv_mutex_lock(&shard->mutex);
+        uint32_t i;
+        for(i = s * LV_DRAW_SW_CIRCLE_CACHE_SIZE / CIRCLE_SHARD_CNT;
+            i < (s + 1) * LV_DRAW_SW_CIRCLE_CACHE_SIZE / CIRCLE_SHARD_CNT; i++) {
+            /*Free the circles of the masks which were not freed too as nothing can use them after deinit*/
+            if(_circle_cache[i].buf) {
+                lv_hash_lru_remove(&shard->circles, &_circle_cache[i].node);
+                lv_free(_circle_cache[i].buf);
+            }
+            lv_memzero(&(_circle_cache[i]), sizeof(_circle_cache[i]));
+        }
+        lv_hash_lru_deinit(&shard->circles);
+        lv_mutex_unlock(&shard->mutex);
+        lv_mutex_delete(&shard->mutex);
+    }
+}
+
+void _lv_draw_sw_mask_circle_cache_trim(void)
+{
+    uint32_t s;
+    for(s = 0; s < CIRCLE_SHARD_CNT; s++) {
+        _lv_draw_sw_mask_circle_cache_shard_t * shard = &_circle_cache_shards[s];
+        lv_mutex_lock(&shard->mutex);
+        uint32_t i;
+        for(i = s * LV_DRAW_SW_CIRCLE_CACHE_SIZE / CIRCLE_SHARD_CNT;
+            i < (s + 1) * LV_DRAW_SW_CIRCLE_CACHE_SIZE / CIRCLE_SHARD_CNT; i++) {
+            _lv_draw_sw_mask_radius_circle_dsc_t * c = &(_circle_cache[i]);
+            if(c->buf == NULL || c->used_cnt) continue;
+            if(c->refr_used) {
+                c->refr_used = 0;
+                continue;
+            }
+
+            lv_hash_lru_remove(&shard->circles, &c->node);
+            lv_free(c->buf);
+            lv_memzero(c, sizeof(_lv_draw_sw_mask_radius_circle_dsc_t));
         }
-        lv_memzero(&(_circle_cache[i]), sizeof(_circle_cache[i]));
+        lv_mutex_unlock(&shard->mutex);
+    }
+}
+
+void lv_draw_sw_mask_circle_cache_get_stats(lv_draw_sw_mask_circle_cache_stats_t * stats)
+{
+    lv_memzero(stats, sizeof(lv_draw_sw_mask_circle_cache_stats_t));
+
+    uint32_t s;
+    for(s = 0; s < CIRCLE_SHARD_CNT; s++) {
+        _lv_draw_sw_mask_circle_cache_shard_t * shard = &_circle_cache_shards[s];
+        lv_mutex_lock(&shard->mutex);
+        stats->hit_cnt += shard->circles.stats.hit_cnt;
+        stats->miss_cnt += shard->circles.stats.miss_cnt;
+        stats->evict_cnt += shard->circles.stats.evict_cnt;
+        stats->temp_cnt += shard->temp_cnt;
+        stats->entry_cnt += shard->circles.stats.entry_cnt;
+        stats->byte_cnt += shard->circles.stats.byte_cnt;
+        lv_mutex_unlock(&shard->mutex);
+    }
+}
+
+void lv_draw_sw_mask_circle_cache_reset_stats(void)
+{
+    uint32_t s;
+    for(s = 0; s < CIRCLE_SHARD_CNT; s++) {
+        _lv_draw_sw_mask_circle_cache_shard_t * shard = &_circle_cache_shards[s];
+        lv_mutex_lock(&shard->mutex);
+        lv_hash_lru_reset_stats(&shard->circles);
+        shard->temp_cnt = 0;
+        lv_mutex_unlock(&shard->mutex);
     }
 }
 
@@ -353,29 +559,24 @@ void lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t * param, const l
         return;
     }
 
-    lv_mutex_lock(&circle_cache_mutex);
-
-    uint32_t i;
+    uint32_t shard_id = circle_shard_id(radius);
+    _lv_draw_sw_mask_circle_cache_shard_t * shard = &_circle_cache_shards[shard_id];
+    lv_mutex_lock(&shard->mutex);
 
     /*Try to reuse a circle cache entry*/
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].radius == radius) {
-            _circle_cache[i].used_cnt++;
-            CIRCLE_CACHE_AGING(_circle_cache[i].life, radius);
-            param->circle = &(_circle_cache[i]);
-            lv_mutex_unlock(&circle_cache_mutex);
-            return;
-        }
+    _lv_draw_sw_mask_radius_circle_dsc_t * entry = circle_cache_find(shard, radius);
+    if(entry) {
+        entry->used_cnt++;
+        entry->refr_used = 1;
+        CIRCLE_CACHE_AGING(entry->life, radius);
+        param->circle = entry;
+        shard->circles.stats.hit_cnt++;
+        lv_mutex_unlock(&shard->mutex);
+        return;
     }
 
-    /*If not cached use the free entry with lowest life*/
-    _lv_draw_sw_mask_radius_circle_dsc_t * entry = NULL;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].used_cnt == 0) {
-            if(!entry) entry = &(_circle_cache[i]);
-            else if(_circle_cache[i].life < entry->life) entry = &(_circle_cache[i]);
-        }
-    }
+    shard->circles.stats.miss_cnt++;
+    entry = circle_cache_get_entry(shard, shard_id, radius);
 
     /*There is no unused entry. Allocate one temporarily*/
     if(!entry) {
@@ -383,9 +584,15 @@ void lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t * param, const l
         LV_ASSERT_MALLOC(entry);
         lv_memzero(entry, sizeof(_lv_draw_sw_mask_radius_circle_dsc_t));
         entry->life = -1;
+        shard->temp_cnt++;
     }
     else {
+        if(entry->buf) {
+            shard->circles.stats.evict_cnt++;
+            lv_hash_lru_remove(&shard->circles, &entry->node);
+        }
         entry->used_cnt++;
+        entry->refr_used = 1;
         entry->life = 0;
         CIRCLE_CACHE_AGING(entry->life, radius);
     }
@@ -393,7 +600,11 @@ void lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t * param, const l
     param->circle = entry;
 
     circ_calc_aa4(param->circle, radius);
-    lv_mutex_unlock(&circle_cache_mutex);
+    if(entry->life >= 0) {
+        lv_hash_lru_add(&shard->circles, &entry->node, CIRCLE_BYTE_SIZE(radius));
+        lv_hash_lru_index(&shard->circles, &entry->node, (uint32_t)radius);
+    }
+    lv_mutex_unlock(&shard->mutex);
 
 }
 
@@ -932,7 +1143,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_sw_mask_res_t lv_draw_mask_radius(lv_opa_t
             else if(first < len) {
                 lv_memzero(&mask_buf[first], len - first);
             }
-            if(last == 0 && first == len) return LV_DRAW_SW_MASK_RES_FULL_COVER;
+            if(last <= 0 && first >= len) return LV_DRAW_SW_MASK_RES_FULL_COVER;
             else return LV_DRAW_SW_MASK_RES_CHANGED;
         }
         else {
@@ -1128,6 +1339,95 @@ static void circ_next(lv_point_t * c, lv_coord_t * tmp)
     c->y++;
 }
 
+/**
+ * Get the shard of the circle cache where a radius is stored.
+ * The radii are spread evenly to avoid having the typical small radii in the same shard.
+ */
+static uint32_t circle_shard_id(lv_coord_t radius)
+{
+#if CIRCLE_SHARD_CNT > 1
+    return (((uint32_t)radius * 2654435769U) >> 24) % CIRCLE_SHARD_CNT;
+#else
+    LV_UNUSED(radius);
+    return 0;
+#endif
+}
+
+/**
+ * Find a cached circle in a shard. The shard needs to be locked.
+ * @param shard     pointer to the shard
+ * @param radius    radius of the circle
+ * @return          the cached circle or NULL if the radius is not cached
+ */
+static _lv_draw_sw_mask_radius_circle_dsc_t * circle_cache_find(_lv_draw_sw_mask_circle_cache_shard_t * shard,
+                                                                 lv_coord_t radius)
+{
+    /*The hash is the radius, so it doesn't need to be compared*/
+    return (_lv_draw_sw_mask_radius_circle_dsc_t *)lv_hash_lru_find_first(&shard->circles, (uint32_t)radius);
+}
+
+/**
+ * Find an entry for a new circle in a shard and age the cached circles. The shard needs to be locked.
+ * @param shard     pointer to the shard
+ * @param shard_id  index of the shard
+ * @param radius    radius of the new circle
+ * @return          the unused entry with the lowest life or NULL if
+ *                  there is no unused entry or the new circle doesn't fit into the memory budget
+ */
+static _lv_draw_sw_mask_radius_circle_dsc_t * circle_cache_get_entry(_lv_draw_sw_mask_circle_cache_shard_t * shard,
+                                                                      uint32_t shard_id, lv_coord_t radius)
+{
+    uint32_t first = shard_id * LV_DRAW_SW_CIRCLE_CACHE_SIZE / CIRCLE_SHARD_CNT;
+    uint32_t end = (shard_id + 1) * LV_DRAW_SW_CIRCLE_CACHE_SIZE / CIRCLE_SHARD_CNT;
+
+    _lv_draw_sw_mask_radius_circle_dsc_t * entry = NULL;
+    uint32_t i;
+    for(i = first; i < end; i++) {
+        if(_circle_cache[i].life > 0) CIRCLE_CACHE_DECAY(_circle_cache[i].life);
+        if(_circle_cache[i].used_cnt == 0) {
+            if(!entry) entry = &(_circle_cache[i]);
+            else if(_circle_cache[i].life < entry->life) entry = &(_circle_cache[i]);
+        }
+    }
+
+#if LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES > 0
+    if(entry == NULL) return NULL;
+
+    /*Check if the circle fits into the budget if all the unused circles were freed*/
+    uint32_t budget = LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES / CIRCLE_SHARD_CNT;
+    uint32_t new_size = CIRCLE_BYTE_SIZE(radius);
+    uint32_t freeable = 0;
+    for(i = first; i < end; i++) {
+        if(_circle_cache[i].used_cnt == 0 && _circle_cache[i].buf) freeable += CIRCLE_BYTE_SIZE(_circle_cache[i].radius);
+    }
+    if(shard->circles.stats.byte_cnt - freeable + new_size > budget) return NULL;
+
+    /*Free the unused circles with the lowest life until the new one fits*/
+    uint32_t byte_cnt = shard->circles.stats.byte_cnt - (entry->buf ? CIRCLE_BYTE_SIZE(entry->radius) : 0);
+    while(byte_cnt + new_size > budget) {
+        _lv_draw_sw_mask_radius_circle_dsc_t * victim = NULL;
+        for(i = first; i < end; i++) {
+            _lv_draw_sw_mask_radius_circle_dsc_t * c = &(_circle_cache[i]);
+            if(c == entry || c->used_cnt || c->buf == NULL) continue;
+            if(!victim || c->life < victim->life) victim = c;
+        }
+        if(victim == NULL) break;
+
+        uint32_t victim_size = CIRCLE_BYTE_SIZE(victim->radius);
+        byte_cnt -= victim_size;
+        shard->circles.stats.evict_cnt++;
+        lv_hash_lru_remove(&shard->circles, &victim->node);
+        lv_free(victim->buf);
+        lv_memzero(victim, sizeof(_lv_draw_sw_mask_radius_circle_dsc_t));
+    }
+#else
+    LV_UNUSED(shard);
+    LV_UNUSED(radius);
+#endif
+
+    return entry;
+}
+
 static void circ_calc_aa4(_lv_draw_sw_mask_radius_circle_dsc_t * c, lv_coord_t radius)
 {
     if(radius == 0) return;
@@ -1295,5 +1595,32 @@ LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_
     return LV_UDIV255(mask_act * mask_new);
 }
 
+/**
+ * Find the end of the run of pixels having the same value as `mask_buf[x]`
+ * @param mask_buf  the mask line
+ * @param x         start of the run
+ * @param len       length of the mask line
+ * @return          index of the first pixel with a different value or `len`
+ */
+LV_ATTRIBUTE_FAST_MEM static lv_coord_t span_same_end(const lv_opa_t * mask_buf, lv_coord_t x, lv_coord_t len)
+{
+    lv_opa_t v = mask_buf[x];
+    x++;
+
+    /*Compare 4 pixels at once. Copy them instead of casting the pointer to not break the strict aliasing rules.
+     *The copy is inlined by the compiler to a single load.*/
+    uint32_t v32 = (uint32_t)v * 0x01010101;
+    while(x <= len - 4) {
+        uint32_t px4;
+        lv_memcpy_small(&px4, &mask_buf[x], sizeof(px4));
+        if(px4 != v32) break;
+        x += 4;
+    }
+
+    while(x < len && mask_buf[x] == v) x++;
+
+    return x;
+}
+
 
 #endif /*LV_DRAW_SW_COMPLEX*/
@@ -18,6 +18,8 @@ extern "C" {
 #include "../../misc/lv_area.h"
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_hash_lru.h"
+#include "../../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -29,6 +31,23 @@ extern "C" {
 # define _LV_MASK_MAX_NUM     1
 #endif
 
+/*Runs of fully transparent or fully covered pixels shorter than this are
+ *kept in the neighbouring partial span as splitting them costs more than it saves*/
+#define LV_DRAW_SW_MASK_SPAN_MIN_LEN    8
+
+/*`lv_draw_sw_mask_apply_spans` intersects the masks on intervals of this many pixels*/
+#define LV_DRAW_SW_MASK_SPAN_CHUNK_LEN  (4 * LV_DRAW_SW_MASK_SPAN_MIN_LEN)
+
+/*The circle cache is split into independently locked shards by radius
+ *so that the draw units rarely wait for each other*/
+#if LV_USE_OS && LV_DRAW_SW_CIRCLE_CACHE_SIZE >= 16
+# define _LV_DRAW_SW_CIRCLE_CACHE_SHARD_CNT     4
+#elif LV_USE_OS && LV_DRAW_SW_CIRCLE_CACHE_SIZE >= 4
+# define _LV_DRAW_SW_CIRCLE_CACHE_SHARD_CNT     2
+#else
+# define _LV_DRAW_SW_CIRCLE_CACHE_SHARD_CNT     1
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -129,7 +148,8 @@ typedef struct {
     uint16_t delta_deg;
 } lv_draw_sw_mask_angle_param_t;
 
-typedef struct  {
+typedef struct {
+    lv_hash_lru_node_t node;    /*Must be the first. Its hash is the radius.*/
     uint8_t * buf;
     lv_opa_t * cir_opa;         /*Opacity of values on the circumference of an 1/4 circle*/
     uint16_t * x_start_on_y;        /*The x coordinate of the circle for each y value*/
@@ -137,10 +157,30 @@ typedef struct  {
     int32_t life;               /*How many times the entry way used*/
     uint32_t used_cnt;          /*Like a semaphore to count the referencing masks*/
     lv_coord_t radius;          /*The radius of the entry*/
+    uint8_t refr_used;          /*1: used since the end of the last refresh*/
 } _lv_draw_sw_mask_radius_circle_dsc_t;
 
 typedef _lv_draw_sw_mask_radius_circle_dsc_t _lv_draw_sw_mask_radius_circle_dsc_arr_t[LV_DRAW_SW_CIRCLE_CACHE_SIZE];
 
+typedef struct {
+    lv_mutex_t mutex;
+    /*The cached circles by radius. They are replaced by their life, so the order of the list is not used.*/
+    lv_hash_lru_t circles;
+    uint32_t temp_cnt;
+} _lv_draw_sw_mask_circle_cache_shard_t;
+
+typedef _lv_draw_sw_mask_circle_cache_shard_t
+_lv_draw_sw_mask_circle_cache_shard_arr_t[_LV_DRAW_SW_CIRCLE_CACHE_SHARD_CNT];
+
+typedef struct {
+    uint32_t hit_cnt;           /*The circle was found in the cache*/
+    uint32_t miss_cnt;          /*The circle had to be calculated*/
+    uint32_t evict_cnt;         /*A cached circle was replaced by an other one*/
+    uint32_t temp_cnt;          /*No free entry or out of memory budget: the circle was calculated only for one mask*/
+    uint32_t entry_cnt;         /*Number of cached circles*/
+    uint32_t byte_cnt;          /*Memory used by the cached circles*/
+} lv_draw_sw_mask_circle_cache_stats_t;
+
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_sw_mask_common_dsc_t dsc;
@@ -181,6 +221,17 @@ typedef struct _lv_draw_sw_mask_map_param_t {
     } cfg;
 } lv_draw_sw_mask_map_param_t;
 
+/**
+ * Describes a run of pixels in a mask line with the same kind of coverage.
+ */
+typedef struct {
+    lv_coord_t x;                   /**< Start of the span relative to the start of the mask line*/
+    lv_coord_t len;                 /**< Number of pixels in the span*/
+    lv_draw_sw_mask_res_t res;      /**< `LV_DRAW_SW_MASK_RES_TRANSP`: all pixels are 0,
+                                     *   `LV_DRAW_SW_MASK_RES_FULL_COVER`: all pixels are 255,
+                                     *   `LV_DRAW_SW_MASK_RES_CHANGED`: the mask values need to be used*/
+} lv_draw_sw_mask_span_t;
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -206,6 +257,39 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_mask_apply(void * masks[]
                                                                   lv_coord_t abs_y,
                                                                   lv_coord_t len);
 
+/**
+ * Split a line of mask values into runs of transparent, fully covered and partially covered pixels.
+ * It allows the blend functions to skip the transparent parts and to fill the covered parts without a mask.
+ * @param mask_buf  the mask line to process
+ * @param len       length of the line
+ * @param spans     store the spans here
+ * @param span_max  size of `spans`. If there are more spans the remaining pixels are merged into the last span.
+ * @return          number of spans written into `spans`
+ */
+uint32_t lv_draw_sw_mask_get_spans(const lv_opa_t * mask_buf, lv_coord_t len, lv_draw_sw_mask_span_t spans[],
+                                   uint32_t span_max);
+
+/**
+ * Apply the masks on a line interval by interval and describe the result as spans.
+ * The coverage of the masks is intersected on each interval: if any mask is transparent there
+ * the interval is transparent, if all masks cover it the interval is fully covered.
+ * Only the partially covered intervals are calculated pixel by pixel.
+ * @param masks     the masks list to apply, must be ended with NULL pointer in array.
+ * @param mask_buf  store the result mask here. Has to be `len` byte long. Should be initialized with `0xFF`.
+ *                  The fully covered spans are left unchanged and the transparent spans are set to 0.
+ * @param abs_x     absolute X coordinate where the line to calculate start
+ * @param abs_y     absolute Y coordinate where the line to calculate start
+ * @param len       length of the line to calculate (in pixel count)
+ * @param spans     store the spans here. Only set if `LV_DRAW_SW_MASK_RES_CHANGED` is returned.
+ * @param span_max  size of `spans`. If there are more spans the remaining pixels are merged into the last span.
+ * @param span_cnt  store the number of spans here
+ * @return          the same as `lv_draw_sw_mask_apply`
+ */
+LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_mask_apply_spans(void * masks[], lv_opa_t * mask_buf,
+                                                                        lv_coord_t abs_x, lv_coord_t abs_y,
+                                                                        lv_coord_t len, lv_draw_sw_mask_span_t spans[],
+                                                                        uint32_t span_max, uint32_t * span_cnt);
+
 //! @endcond
 
 /**
@@ -218,11 +302,27 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_mask_apply(void * masks[]
 void lv_draw_sw_mask_free_param(void * p);
 
 /**
- * Called by LVGL the rendering of a screen is ready to clean up
- * the temporal (cache) data of the masks
+ * Free the cached circles and the locks of the circle cache. Called by LVGL on deinit.
  */
 void _lv_draw_sw_mask_cleanup(void);
 
+/**
+ * Free the cached circles which were not used since the previous call.
+ * Called by LVGL at the end of every refresh, so only the circles of the redrawn objects are kept.
+ */
+void _lv_draw_sw_mask_circle_cache_trim(void);
+
+/**
+ * Get the statistics of the circle cache used by the radius masks.
+ * @param stats     store the result here
+ */
+void lv_draw_sw_mask_circle_cache_get_stats(lv_draw_sw_mask_circle_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss, evict and temporary counters of the circle cache
+ */
+void lv_draw_sw_mask_circle_cache_reset_stats(void);
+
 /**
  *Initialize a line mask from two points.
  * @param param pointer to a `lv_draw_mask_param_t` to initialize
@@ -58,6 +58,7 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
 
     uint32_t area_w = lv_area_get_width(&draw_area);
     lv_opa_t * mask_buf = lv_malloc(area_w);
+    bool premultiplied = draw_unit->target_layer->draw_buf.color_format == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
 
     lv_coord_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
@@ -70,12 +71,22 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
         lv_color32_t * c32_buf = lv_draw_buf_go_to_xy(&target_layer->draw_buf, draw_area.x1 - target_layer->draw_buf_ofs.x,
                                                       y - target_layer->draw_buf_ofs.y);
 
-        if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
+        /*The color channels of the premultiplied pixels need to be masked too*/
+        if(res == LV_DRAW_SW_MASK_RES_TRANSP && premultiplied) {
+            lv_memzero(c32_buf, area_w * sizeof(lv_color32_t));
+        }
+        else if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
             uint32_t i;
             for(i = 0; i < area_w; i++) {
                 c32_buf[i].alpha = 0x00;
             }
         }
+        else if(premultiplied) {
+            uint32_t i;
+            for(i = 0; i < area_w; i++) {
+                c32_buf[i] = lv_color32_premultiplied_scale(c32_buf[i], mask_buf[i]);
+            }
+        }
         else {
             uint32_t i;
             for(i = 0; i < area_w; i++) {
@@ -0,0 +1,640 @@
+/**
+ * @file lv_draw_sw_path.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+#if LV_USE_DRAW_SW
+
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
+#include "../lv_draw_path.h"
+#include "lv_draw_sw_gradient.h"
+#include "lv_draw_sw_raster.h"
+
+#if LV_DRAW_SW_COMPLEX
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ONE             LV_DRAW_SW_RASTER_SUBPX_ONE
+
+/*The path points are the centers of the pixels*/
+#define TO_SUBPX(v)     LV_DRAW_SW_RASTER_SUBPX_CENTER(v)
+
+/*Max. number of lines to approximate a Bézier curve with*/
+#define CURVE_SEG_MAX   64
+
+/*Initial number of points and sub-paths to allocate*/
+#define POLY_SIZE_INIT  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*A point in sub-pixel units*/
+typedef struct {
+    int32_t x;
+    int32_t y;
+} subpx_point_t;
+
+typedef struct {
+    uint32_t start;     /*Index of the first point*/
+    uint32_t cnt;       /*Number of points*/
+    bool closed;
+} sub_path_t;
+
+/*The path flattened to polylines*/
+typedef struct {
+    subpx_point_t * points;
+    uint32_t point_cnt;
+    uint32_t point_size;
+    sub_path_t * subs;
+    uint32_t sub_cnt;
+    uint32_t sub_size;
+} poly_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flatten_path(const lv_draw_path_t * path, poly_t * poly);
+static void poly_start(poly_t * poly, int32_t x, int32_t y);
+static void poly_add(poly_t * poly, int32_t x, int32_t y);
+static void poly_close(poly_t * poly);
+static void flatten_quad(poly_t * poly, const subpx_point_t * p0, const subpx_point_t * p1, const subpx_point_t * p2);
+static void flatten_cubic(poly_t * poly, const subpx_point_t * p0, const subpx_point_t * p1, const subpx_point_t * p2,
+                          const subpx_point_t * p3);
+static void add_fill(lv_draw_sw_raster_t * raster, const poly_t * poly);
+static void add_stroke(lv_draw_sw_raster_t * raster, const poly_t * poly, const lv_draw_path_dsc_t * dsc);
+static void add_join(lv_draw_sw_raster_t * raster, const subpx_point_t * prev, const subpx_point_t * v,
+                     const subpx_point_t * next, int32_t r, lv_draw_path_join_t join);
+static void add_cap(lv_draw_sw_raster_t * raster, const subpx_point_t * p, const subpx_point_t * from, int32_t r,
+                    lv_draw_path_cap_t cap);
+static void add_circle(lv_draw_sw_raster_t * raster, const subpx_point_t * c, int32_t r);
+static void add_shape(lv_draw_sw_raster_t * raster, const subpx_point_t * points, uint32_t cnt);
+static void get_normal(const subpx_point_t * p1, const subpx_point_t * p2, int32_t r, subpx_point_t * n);
+static uint32_t sqrt_u64(uint64_t x);
+static void blend_raster(lv_draw_unit_t * draw_unit, lv_draw_sw_raster_t * raster, lv_draw_sw_raster_fill_rule_t fill_rule,
+                         lv_color_t color, lv_opa_t opa, const lv_grad_dsc_t * grad_dsc, const lv_area_t * grad_area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_path(lv_draw_unit_t * draw_unit, const lv_draw_path_dsc_t * dsc)
+{
+    lv_area_t path_area;
+    if(!lv_draw_path_get_area(dsc->path, &path_area)) return;
+
+    poly_t poly;
+    lv_memzero(&poly, sizeof(poly));
+    flatten_path(dsc->path, &poly);
+
+    lv_draw_sw_raster_t raster;
+    if(dsc->fill_opa > LV_OPA_MIN) {
+        lv_draw_sw_raster_init(&raster);
+        add_fill(&raster, &poly);
+        lv_draw_sw_raster_fill_rule_t fill_rule = dsc->fill_rule == LV_DRAW_PATH_FILL_EVENODD ?
+                                                  LV_DRAW_SW_RASTER_FILL_EVENODD : LV_DRAW_SW_RASTER_FILL_NONZERO;
+        blend_raster(draw_unit, &raster, fill_rule, dsc->fill_color, dsc->fill_opa, &dsc->fill_grad, &path_area);
+        lv_draw_sw_raster_deinit(&raster);
+    }
+
+    if(dsc->stroke_opa > LV_OPA_MIN && dsc->stroke_width > 0) {
+        lv_draw_sw_raster_init(&raster);
+        add_stroke(&raster, &poly, dsc);
+        /*All the parts of the stroke have the same direction so they are merged by the nonzero rule*/
+        blend_raster(draw_unit, &raster, LV_DRAW_SW_RASTER_FILL_NONZERO, dsc->stroke_color, dsc->stroke_opa, NULL, NULL);
+        lv_draw_sw_raster_deinit(&raster);
+    }
+
+    lv_free(poly.points);
+    lv_free(poly.subs);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Convert the commands of a path to polylines
+ */
+static void flatten_path(const lv_draw_path_t * path, poly_t * poly)
+{
+    subpx_point_t cur = {0, 0};
+    subpx_point_t start = {0, 0};
+    bool in_sub = false;
+    bool drawn = false;
+    uint32_t pi = 0;
+    uint32_t i;
+    for(i = 0; i < path->op_cnt; i++) {
+        lv_draw_path_op_t op = path->ops[i];
+        if(op == LV_DRAW_PATH_OP_CLOSE) {
+            if(in_sub) poly_close(poly);
+            in_sub = false;
+            drawn = false;
+            cur = start;
+            continue;
+        }
+
+        uint32_t p_cnt = op == LV_DRAW_PATH_OP_QUAD_TO ? 2 : (op == LV_DRAW_PATH_OP_CUBIC_TO ? 3 : 1);
+        if(pi + p_cnt > path->point_cnt) break;
+
+        subpx_point_t p[3];
+        uint32_t j;
+        for(j = 0; j < p_cnt; j++) {
+            p[j].x = TO_SUBPX(path->points[pi + j].x);
+            p[j].y = TO_SUBPX(path->points[pi + j].y);
+        }
+        pi += p_cnt;
+
+        if(op == LV_DRAW_PATH_OP_MOVE_TO) {
+            /*Drop the previous sub-path if nothing was drawn after its `move_to`*/
+            if(in_sub && !drawn && poly->sub_cnt) {
+                poly->point_cnt = poly->subs[poly->sub_cnt - 1].start;
+                poly->sub_cnt--;
+            }
+            poly_start(poly, p[0].x, p[0].y);
+            in_sub = true;
+            drawn = false;
+            cur = p[0];
+            start = p[0];
+            continue;
+        }
+
+        /*Drawing without `move_to` continues from the last point*/
+        if(!in_sub) {
+            poly_start(poly, cur.x, cur.y);
+            in_sub = true;
+            start = cur;
+        }
+
+        if(op == LV_DRAW_PATH_OP_LINE_TO) poly_add(poly, p[0].x, p[0].y);
+        else if(op == LV_DRAW_PATH_OP_QUAD_TO) flatten_quad(poly, &cur, &p[0], &p[1]);
+        else if(op == LV_DRAW_PATH_OP_CUBIC_TO) flatten_cubic(poly, &cur, &p[0], &p[1], &p[2]);
+
+        drawn = true;
+        cur = p[p_cnt - 1];
+    }
+}
+
+static void poly_start(poly_t * poly, int32_t x, int32_t y)
+{
+    if(poly->sub_cnt >= poly->sub_size) {
+        uint32_t new_size = poly->sub_size ? poly->sub_size * 2 : POLY_SIZE_INIT;
+        sub_path_t * new_subs = lv_realloc(poly->subs, new_size * sizeof(sub_path_t));
+        LV_ASSERT_MALLOC(new_subs);
+        if(new_subs == NULL) return;
+        poly->subs = new_subs;
+        poly->sub_size = new_size;
+    }
+
+    sub_path_t * sub = &poly->subs[poly->sub_cnt];
+    sub->start = poly->point_cnt;
+    sub->cnt = 0;
+    sub->closed = false;
+    poly->sub_cnt++;
+
+    poly_add(poly, x, y);
+}
+
+static void poly_add(poly_t * poly, int32_t x, int32_t y)
+{
+    if(poly->sub_cnt == 0) return;
+    sub_path_t * sub = &poly->subs[poly->sub_cnt - 1];
+
+    /*Skip the repeated points to avoid zero length segments*/
+    if(sub->cnt) {
+        const subpx_point_t * last = &poly->points[poly->point_cnt - 1];
+        if(last->x == x && last->y == y) return;
+    }
+
+    if(poly->point_cnt >= poly->point_size) {
+        uint32_t new_size = poly->point_size ? poly->point_size * 2 : POLY_SIZE_INIT;
+        subpx_point_t * new_points = lv_realloc(poly->points, new_size * sizeof(subpx_point_t));
+        LV_ASSERT_MALLOC(new_points);
+        if(new_points == NULL) return;
+        poly->points = new_points;
+        poly->point_size = new_size;
+    }
+
+    poly->points[poly->point_cnt].x = x;
+    poly->points[poly->point_cnt].y = y;
+    poly->point_cnt++;
+    sub->cnt++;
+}
+
+static void poly_close(poly_t * poly)
+{
+    if(poly->sub_cnt == 0) return;
+    sub_path_t * sub = &poly->subs[poly->sub_cnt - 1];
+
+    /*The closing line is implicit so remove the last point if it's the same as the first*/
+    const subpx_point_t * first = &poly->points[sub->start];
+    const subpx_point_t * last = &poly->points[poly->point_cnt - 1];
+    if(sub->cnt > 1 && first->x == last->x && first->y == last->y) {
+        poly->point_cnt--;
+        sub->cnt--;
+    }
+
+    sub->closed = true;
+}
+
+/**
+ * Approximate a quadratic Bézier curve with lines.
+ * The distance of a line segment from the curve is `|p0 - 2 * p1 + p2| / (4 * n^2)`
+ * so `n` is chosen to keep it below 1/4 pixel.
+ */
+static void flatten_quad(poly_t * poly, const subpx_point_t * p0, const subpx_point_t * p1, const subpx_point_t * p2)
+{
+    int64_t ddx = p0->x - 2 * p1->x + p2->x;
+    int64_t ddy = p0->y - 2 * p1->y + p2->y;
+    uint32_t dd = sqrt_u64(ddx * ddx + ddy * ddy);
+    int64_t n = sqrt_u64(dd / ONE);
+    n = LV_CLAMP(1, n + 1, CURVE_SEG_MAX);
+
+    int64_t i;
+    for(i = 1; i <= n; i++) {
+        int64_t a = (n - i) * (n - i);
+        int64_t b = 2 * (n - i) * i;
+        int64_t c = i * i;
+        int64_t x = (a * p0->x + b * p1->x + c * p2->x) / (n * n);
+        int64_t y = (a * p0->y + b * p1->y + c * p2->y) / (n * n);
+        poly_add(poly, (int32_t)x, (int32_t)y);
+    }
+}
+
+/**
+ * Approximate a cubic Bézier curve with lines.
+ * The distance of a line segment from the curve is less than `3 * max(|p0 - 2 * p1 + p2|, |p1 - 2 * p2 + p3|) / (4 * n^2)`
+ */
+static void flatten_cubic(poly_t * poly, const subpx_point_t * p0, const subpx_point_t * p1, const subpx_point_t * p2,
+                          const subpx_point_t * p3)
+{
+    int64_t ddx1 = p0->x - 2 * p1->x + p2->x;
+    int64_t ddy1 = p0->y - 2 * p1->y + p2->y;
+    int64_t ddx2 = p1->x - 2 * p2->x + p3->x;
+    int64_t ddy2 = p1->y - 2 * p2->y + p3->y;
+    uint32_t dd = LV_MAX(sqrt_u64(ddx1 * ddx1 + ddy1 * ddy1), sqrt_u64(ddx2 * ddx2 + ddy2 * ddy2));
+    int64_t n = sqrt_u64(((uint64_t)dd * 3) / ONE);
+    n = LV_CLAMP(1, n + 1, CURVE_SEG_MAX);
+
+    int64_t n3 = n * n * n;
+    int64_t i;
+    for(i = 1; i <= n; i++) {
+        int64_t u = n - i;
+        int64_t a = u * u * u;
+        int64_t b = 3 * u * u * i;
+        int64_t c = 3 * u * i * i;
+        int64_t d = i * i * i;
+        int64_t x = (a * p0->x + b * p1->x + c * p2->x + d * p3->x) / n3;
+        int64_t y = (a * p0->y + b * p1->y + c * p2->y + d * p3->y) / n3;
+        poly_add(poly, (int32_t)x, (int32_t)y);
+    }
+}
+
+/**
+ * Add every sub-path as a closed polygon
+ */
+static void add_fill(lv_draw_sw_raster_t * raster, const poly_t * poly)
+{
+    uint32_t s;
+    for(s = 0; s < poly->sub_cnt; s++) {
+        const sub_path_t * sub = &poly->subs[s];
+        if(sub->cnt < 3) continue;
+
+        const subpx_point_t * p = &poly->points[sub->start];
+        uint32_t i;
+        for(i = 0; i < sub->cnt; i++) {
+            const subpx_point_t * p2 = &p[i + 1 < sub->cnt ? i + 1 : 0];
+            lv_draw_sw_raster_add_edge(raster, p[i].x, p[i].y, p2->x, p2->y);
+        }
+    }
+}
+
+/**
+ * Add the outline of the stroke as separate shapes: a rectangle for each segment
+ * plus the joins between them and the caps on the ends of the open sub-paths.
+ */
+static void add_stroke(lv_draw_sw_raster_t * raster, const poly_t * poly, const lv_draw_path_dsc_t * dsc)
+{
+    int32_t r = (dsc->stroke_width * ONE) / 2;
+
+    uint32_t s;
+    for(s = 0; s < poly->sub_cnt; s++) {
+        const sub_path_t * sub = &poly->subs[s];
+        const subpx_point_t * p = &poly->points[sub->start];
+        uint32_t cnt = sub->cnt;
+
+        /*A single point is drawn only with round or square caps*/
+        if(cnt == 1) {
+            if(dsc->stroke_cap == LV_DRAW_PATH_CAP_ROUND) {
+                add_circle(raster, &p[0], r);
+            }
+            else if(dsc->stroke_cap == LV_DRAW_PATH_CAP_SQUARE) {
+                subpx_point_t sq[4] = {
+                    {p[0].x - r, p[0].y - r}, {p[0].x + r, p[0].y - r},
+                    {p[0].x + r, p[0].y + r}, {p[0].x - r, p[0].y + r}
+                };
+                add_shape(raster, sq, 4);
+            }
+            continue;
+        }
+
+        bool closed = sub->closed && cnt > 2;
+        uint32_t seg_cnt = closed ? cnt : cnt - 1;
+        uint32_t i;
+        for(i = 0; i < seg_cnt; i++) {
+            const subpx_point_t * p1 = &p[i];
+            const subpx_point_t * p2 = &p[i + 1 < cnt ? i + 1 : 0];
+            subpx_point_t n;
+            get_normal(p1, p2, r, &n);
+            subpx_point_t rect[4] = {
+                {p1->x + n.x, p1->y + n.y}, {p2->x + n.x, p2->y + n.y},
+                {p2->x - n.x, p2->y - n.y}, {p1->x - n.x, p1->y - n.y}
+            };
+            add_shape(raster, rect, 4);
+        }
+
+        /*Joins on the inner points, or on all points if closed*/
+        uint32_t join_start = closed ? 0 : 1;
+        uint32_t join_end = closed ? cnt : cnt - 1;
+        for(i = join_start; i < join_end; i++) {
+            const subpx_point_t * prev = &p[i > 0 ? i - 1 : cnt - 1];
+            const subpx_point_t * next = &p[i + 1 < cnt ? i + 1 : 0];
+            add_join(raster, prev, &p[i], next, r, dsc->stroke_join);
+        }
+
+        if(!closed) {
+            add_cap(raster, &p[0], &p[1], r, dsc->stroke_cap);
+            add_cap(raster, &p[cnt - 1], &p[cnt - 2], r, dsc->stroke_cap);
+        }
+    }
+}
+
+/**
+ * Fill the gap on the outer side of the corner between two segments
+ */
+static void add_join(lv_draw_sw_raster_t * raster, const subpx_point_t * prev, const subpx_point_t * v,
+                     const subpx_point_t * next, int32_t r, lv_draw_path_join_t join)
+{
+    int64_t d1x = v->x - prev->x;
+    int64_t d1y = v->y - prev->y;
+    int64_t d2x = next->x - v->x;
+    int64_t d2y = next->y - v->y;
+    int64_t cross = d1x * d2y - d1y * d2x;
+
+    /*Continues straight, no gap*/
+    if(cross == 0 && d1x * d2x + d1y * d2y > 0) return;
+
+    if(join == LV_DRAW_PATH_JOIN_ROUND) {
+        add_circle(raster, v, r);
+        return;
+    }
+
+    /*The outer side is on the left of a right turn and vice versa*/
+    subpx_point_t o1;
+    subpx_point_t o2;
+    get_normal(prev, v, r, &o1);
+    get_normal(v, next, r, &o2);
+    if(cross > 0) {
+        o1.x = -o1.x;
+        o1.y = -o1.y;
+        o2.x = -o2.x;
+        o2.y = -o2.y;
+    }
+
+    if(join == LV_DRAW_PATH_JOIN_MITER) {
+        /*The miter point is at `(o1 + o2) * r^2 / (r^2 + o1 * o2)` from the vertex.
+         *Its length relative to `r` is `sqrt(2 * r^2 / (r^2 + o1 * o2))` which is limited by the miter limit.*/
+        int64_t r2 = (int64_t)r * r;
+        int64_t den = r2 + (int64_t)o1.x * o2.x + (int64_t)o1.y * o2.y;
+        if(den > 0 && den * LV_DRAW_PATH_MITER_LIMIT * LV_DRAW_PATH_MITER_LIMIT >= 2 * r2) {
+            subpx_point_t miter[4] = {
+                {v->x, v->y},
+                {v->x + o1.x, v->y + o1.y},
+                {v->x + (int32_t)(((int64_t)(o1.x + o2.x) * r2) / den), v->y + (int32_t)(((int64_t)(o1.y + o2.y) * r2) / den)},
+                {v->x + o2.x, v->y + o2.y},
+            };
+            add_shape(raster, miter, 4);
+            return;
+        }
+    }
+
+    subpx_point_t bevel[3] = {
+        {v->x, v->y},
+        {v->x + o1.x, v->y + o1.y},
+        {v->x + o2.x, v->y + o2.y},
+    };
+    add_shape(raster, bevel, 3);
+}
+
+/**
+ * Add a cap to the end of an open sub-path
+ * @param p         the end point
+ * @param from      the point before the end point
+ */
+static void add_cap(lv_draw_sw_raster_t * raster, const subpx_point_t * p, const subpx_point_t * from, int32_t r,
+                    lv_draw_path_cap_t cap)
+{
+    if(cap == LV_DRAW_PATH_CAP_ROUND) {
+        add_circle(raster, p, r);
+    }
+    else if(cap == LV_DRAW_PATH_CAP_SQUARE) {
+        /*The normal rotated by 90° is the direction of the segment*/
+        subpx_point_t n;
+        get_normal(from, p, r, &n);
+        subpx_point_t d = {n.y, -n.x};
+        subpx_point_t rect[4] = {
+            {p->x + n.x, p->y + n.y}, {p->x + n.x + d.x, p->y + n.y + d.y},
+            {p->x - n.x + d.x, p->y - n.y + d.y}, {p->x - n.x, p->y - n.y}
+        };
+        add_shape(raster, rect, 4);
+    }
+}
+
+static void add_circle(lv_draw_sw_raster_t * raster, const subpx_point_t * c, int32_t r)
+{
+    /*Use more segments for larger circles to keep the error below ~1/4 px*/
+    int32_t r_px = r / ONE;
+    int32_t step;
+    if(r_px <= 3) step = 45;
+    else if(r_px <= 7) step = 30;
+    else if(r_px <= 29) step = 15;
+    else if(r_px <= 66) step = 10;
+    else step = 5;
+
+    subpx_point_t points[360 / 5];
+    uint32_t cnt = 0;
+    int32_t angle;
+    for(angle = 0; angle < 360; angle += step) {
+        points[cnt].x = c->x + (int32_t)(((int64_t)lv_trigo_cos(angle) * r) >> LV_TRIGO_SHIFT);
+        points[cnt].y = c->y + (int32_t)(((int64_t)lv_trigo_sin(angle) * r) >> LV_TRIGO_SHIFT);
+        cnt++;
+    }
+
+    add_shape(raster, points, cnt);
+}
+
+/**
+ * Add a closed polygon always with the same orientation.
+ * This way the overlapping parts of the stroke are not cancelling each other with the nonzero rule.
+ */
+static void add_shape(lv_draw_sw_raster_t * raster, const subpx_point_t * points, uint32_t cnt)
+{
+    int64_t area2 = 0;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const subpx_point_t * p2 = &points[i + 1 < cnt ? i + 1 : 0];
+        area2 += (int64_t)points[i].x * p2->y - (int64_t)p2->x * points[i].y;
+    }
+
+    for(i = 0; i < cnt; i++) {
+        const subpx_point_t * p1 = &points[i];
+        const subpx_point_t * p2 = &points[i + 1 < cnt ? i + 1 : 0];
+        if(area2 >= 0) lv_draw_sw_raster_add_edge(raster, p1->x, p1->y, p2->x, p2->y);
+        else lv_draw_sw_raster_add_edge(raster, p2->x, p2->y, p1->x, p1->y);
+    }
+}
+
+/**
+ * Get the normal of a segment with `r` length
+ */
+static void get_normal(const subpx_point_t * p1, const subpx_point_t * p2, int32_t r, subpx_point_t * n)
+{
+    int64_t dx = p2->x - p1->x;
+    int64_t dy = p2->y - p1->y;
+    int64_t len = sqrt_u64(dx * dx + dy * dy);
+    if(len == 0) {
+        n->x = 0;
+        n->y = 0;
+        return;
+    }
+
+    n->x = (int32_t)((-dy * r) / len);
+    n->y = (int32_t)((dx * r) / len);
+}
+
+static uint32_t sqrt_u64(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while(bit > x) bit >>= 2;
+
+    while(bit) {
+        if(x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)res;
+}
+
+static void blend_raster(lv_draw_unit_t * draw_unit, lv_draw_sw_raster_t * raster, lv_draw_sw_raster_fill_rule_t fill_rule,
+                         lv_color_t color, lv_opa_t opa, const lv_grad_dsc_t * grad_dsc, const lv_area_t * grad_area)
+{
+    lv_area_t raster_area;
+    if(!lv_draw_sw_raster_get_area(raster, &raster_area)) return;
+
+    lv_area_t draw_area;
+    if(!_lv_area_intersect(&draw_area, &raster_area, draw_unit->clip_area)) return;
+
+    /*The gradient is calculated for the area of the path's points. Without direction it's only a solid color.*/
+    lv_grad_t * grad = NULL;
+    if(grad_dsc && grad_dsc->dir != LV_GRAD_DIR_NONE && grad_area) {
+        if(!_lv_area_intersect(&draw_area, &draw_area, grad_area)) return;
+        grad = lv_gradient_get(grad_dsc, lv_area_get_width(grad_area), lv_area_get_height(grad_area));
+    }
+    lv_grad_dir_t grad_dir = grad ? grad_dsc->dir : LV_GRAD_DIR_NONE;
+
+    lv_draw_sw_raster_start(raster, &draw_area, fill_rule);
+
+    lv_coord_t area_w = lv_area_get_width(&draw_area);
+    lv_opa_t * mask_buf = lv_malloc(area_w);
+    LV_ASSERT_MALLOC(mask_buf);
+    if(mask_buf == NULL) {
+        if(grad) lv_gradient_cleanup(grad);
+        return;
+    }
+
+    lv_area_t blend_area = draw_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = color;
+    blend_dsc.opa = opa;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    lv_opa_t * grad_opa_map = NULL;
+    if(grad_dir == LV_GRAD_DIR_HOR) {
+        blend_dsc.src_area = &blend_area;
+        blend_dsc.src_buf = grad->color_map + draw_area.x1 - grad_area->x1;
+        blend_dsc.src_color_format = LV_COLOR_FORMAT_RGB888;
+        grad_opa_map = grad->opa_map + draw_area.x1 - grad_area->x1;
+    }
+
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        blend_dsc.mask_buf = mask_buf;
+        blend_dsc.mask_res = lv_draw_sw_raster_get_line(raster, y, mask_buf);
+        if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_TRANSP) continue;
+
+        if(grad_dir == LV_GRAD_DIR_VER) {
+            blend_dsc.color = grad->color_map[y - grad_area->y1];
+            blend_dsc.opa = grad->opa_map[y - grad_area->y1];
+            if(opa < LV_OPA_MAX) blend_dsc.opa = LV_OPA_MIX2(blend_dsc.opa, opa);
+        }
+        else if(grad_dir == LV_GRAD_DIR_HOR) {
+            if(blend_dsc.mask_res == LV_DRAW_SW_MASK_RES_FULL_COVER) {
+                blend_dsc.mask_buf = grad_opa_map;
+                blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+            }
+            else {
+                lv_coord_t i;
+                for(i = 0; i < area_w; i++) {
+                    if(grad_opa_map[i] < LV_OPA_MAX) mask_buf[i] = LV_OPA_MIX2(mask_buf[i], grad_opa_map[i]);
+                }
+            }
+        }
+
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+    }
+
+    lv_free(mask_buf);
+    if(grad) lv_gradient_cleanup(grad);
+}
+
+#else /*LV_DRAW_SW_COMPLEX*/
+
+void lv_draw_sw_path(lv_draw_unit_t * draw_unit, const lv_draw_path_dsc_t * dsc)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(dsc);
+    LV_LOG_WARN("Can't draw paths with LV_DRAW_SW_COMPLEX == 0");
+}
+
+#endif /*LV_DRAW_SW_COMPLEX*/
+
+#endif /*LV_USE_DRAW_SW*/
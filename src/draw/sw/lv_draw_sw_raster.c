@@ -0,0 +1,336 @@
+/**
+ * @file lv_draw_sw_raster.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+
+#include "lv_draw_sw_raster.h"
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ONE             LV_DRAW_SW_RASTER_SUBPX_ONE
+#define SHIFT           LV_DRAW_SW_RASTER_SUBPX_SHIFT
+
+/*Accumulated coverage of a fully covered pixel*/
+#define COVER_FULL      (ONE * ONE)
+
+/*Initial number of edges to allocate*/
+#define EDGE_SIZE_INIT  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sort_edges(_lv_draw_sw_raster_edge_t * edges, uint32_t cnt);
+LV_ATTRIBUTE_FAST_MEM static void accumulate_edge(lv_draw_sw_raster_t * raster, const _lv_draw_sw_raster_edge_t * e,
+                                                  int32_t row_y);
+LV_ATTRIBUTE_FAST_MEM static inline void add_cell(int32_t * acc, int32_t w, int32_t x, int32_t d, int32_t fract);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_raster_init(lv_draw_sw_raster_t * raster)
+{
+    lv_memzero(raster, sizeof(lv_draw_sw_raster_t));
+    raster->min_x = INT32_MAX;
+    raster->min_y = INT32_MAX;
+    raster->max_x = INT32_MIN;
+    raster->max_y = INT32_MIN;
+}
+
+void lv_draw_sw_raster_deinit(lv_draw_sw_raster_t * raster)
+{
+    lv_free(raster->edges);
+    lv_free(raster->acc);
+    lv_free(raster->active);
+    lv_draw_sw_raster_init(raster);
+}
+
+void lv_draw_sw_raster_add_edge(lv_draw_sw_raster_t * raster, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    raster->min_x = LV_MIN3(raster->min_x, x0, x1);
+    raster->max_x = LV_MAX3(raster->max_x, x0, x1);
+    raster->min_y = LV_MIN3(raster->min_y, y0, y1);
+    raster->max_y = LV_MAX3(raster->max_y, y0, y1);
+
+    /*Horizontal edges don't change the coverage*/
+    if(y0 == y1) return;
+
+    if(raster->edge_cnt >= raster->edge_size) {
+        uint32_t new_size = raster->edge_size ? raster->edge_size * 2 : EDGE_SIZE_INIT;
+        _lv_draw_sw_raster_edge_t * new_edges = lv_realloc(raster->edges, new_size * sizeof(_lv_draw_sw_raster_edge_t));
+        LV_ASSERT_MALLOC(new_edges);
+        if(new_edges == NULL) return;
+        raster->edges = new_edges;
+        raster->edge_size = new_size;
+    }
+
+    _lv_draw_sw_raster_edge_t * e = &raster->edges[raster->edge_cnt];
+    if(y0 < y1) {
+        e->x0 = x0;
+        e->y0 = y0;
+        e->x1 = x1;
+        e->y1 = y1;
+        e->dir = 1;
+    }
+    else {
+        e->x0 = x1;
+        e->y0 = y1;
+        e->x1 = x0;
+        e->y1 = y0;
+        e->dir = -1;
+    }
+    raster->edge_cnt++;
+}
+
+void lv_draw_sw_raster_add_polygon(lv_draw_sw_raster_t * raster, const lv_point_t * points, uint32_t point_cnt)
+{
+    if(point_cnt < 3) return;
+
+    uint32_t i;
+    for(i = 0; i < point_cnt; i++) {
+        const lv_point_t * p1 = &points[i];
+        const lv_point_t * p2 = &points[i + 1 < point_cnt ? i + 1 : 0];
+        lv_draw_sw_raster_add_edge(raster, LV_DRAW_SW_RASTER_SUBPX(p1->x), LV_DRAW_SW_RASTER_SUBPX(p1->y),
+                                   LV_DRAW_SW_RASTER_SUBPX(p2->x), LV_DRAW_SW_RASTER_SUBPX(p2->y));
+    }
+}
+
+bool lv_draw_sw_raster_get_area(const lv_draw_sw_raster_t * raster, lv_area_t * area)
+{
+    if(raster->min_x > raster->max_x || raster->min_y > raster->max_y) return false;
+
+    /*The pixels touched by the [min;max) range*/
+    area->x1 = raster->min_x >> SHIFT;
+    area->y1 = raster->min_y >> SHIFT;
+    area->x2 = raster->max_x > raster->min_x ? (raster->max_x - 1) >> SHIFT : area->x1;
+    area->y2 = raster->max_y > raster->min_y ? (raster->max_y - 1) >> SHIFT : area->y1;
+    return true;
+}
+
+void lv_draw_sw_raster_start(lv_draw_sw_raster_t * raster, const lv_area_t * area,
+                             lv_draw_sw_raster_fill_rule_t fill_rule)
+{
+    raster->area = *area;
+    raster->fill_rule = fill_rule;
+    raster->next_edge = 0;
+    raster->active_cnt = 0;
+
+    sort_edges(raster->edges, raster->edge_cnt);
+
+    /*One more item to store the right side of the cells on the last pixel*/
+    lv_free(raster->acc);
+    raster->acc = lv_malloc((lv_area_get_width(area) + 1) * sizeof(int32_t));
+    LV_ASSERT_MALLOC(raster->acc);
+
+    lv_free(raster->active);
+    raster->active = raster->edge_cnt ? lv_malloc(raster->edge_cnt * sizeof(uint32_t)) : NULL;
+    LV_ASSERT_MALLOC(raster->edge_cnt == 0 || raster->active);
+}
+
+LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_raster_get_line(lv_draw_sw_raster_t * raster, lv_coord_t y,
+                                                                       lv_opa_t * mask_buf)
+{
+    if(raster->acc == NULL || (raster->edge_cnt && raster->active == NULL)) return LV_DRAW_SW_MASK_RES_TRANSP;
+
+    int32_t row_y = LV_DRAW_SW_RASTER_SUBPX(y);
+
+    /*Add the edges starting in this line*/
+    while(raster->next_edge < raster->edge_cnt && raster->edges[raster->next_edge].y0 < row_y + ONE) {
+        raster->active[raster->active_cnt] = raster->next_edge;
+        raster->active_cnt++;
+        raster->next_edge++;
+    }
+
+    /*Remove the edges ended above this line*/
+    uint32_t i;
+    uint32_t act = 0;
+    for(i = 0; i < raster->active_cnt; i++) {
+        if(raster->edges[raster->active[i]].y1 > row_y) {
+            raster->active[act] = raster->active[i];
+            act++;
+        }
+    }
+    raster->active_cnt = act;
+
+    if(raster->active_cnt == 0) return LV_DRAW_SW_MASK_RES_TRANSP;
+
+    int32_t w = lv_area_get_width(&raster->area);
+    int32_t * acc = raster->acc;
+    lv_memzero(acc, (w + 1) * sizeof(int32_t));
+
+    for(i = 0; i < raster->active_cnt; i++) {
+        accumulate_edge(raster, &raster->edges[raster->active[i]], row_y);
+    }
+
+    /*Sum up the cells from left to right to get the area covered on each pixel*/
+    bool transp = true;
+    bool cover = true;
+    bool even_odd = raster->fill_rule == LV_DRAW_SW_RASTER_FILL_EVENODD;
+    int32_t sum = 0;
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        sum += acc[x];
+        int32_t v = LV_ABS(sum);
+        if(even_odd) {
+            v &= 2 * COVER_FULL - 1;
+            if(v > COVER_FULL) v = 2 * COVER_FULL - v;
+        }
+
+        lv_opa_t opa;
+        if(v >= COVER_FULL) opa = LV_OPA_COVER;
+        else opa = (v * 255) >> (2 * SHIFT);
+
+        mask_buf[x] = opa;
+        if(opa != LV_OPA_TRANSP) transp = false;
+        if(opa != LV_OPA_COVER) cover = false;
+    }
+
+    if(transp) return LV_DRAW_SW_MASK_RES_TRANSP;
+    if(cover) return LV_DRAW_SW_MASK_RES_FULL_COVER;
+    return LV_DRAW_SW_MASK_RES_CHANGED;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Sort the edges by their top Y coordinate (Shell sort, no recursion and no extra memory)
+ */
+static void sort_edges(_lv_draw_sw_raster_edge_t * edges, uint32_t cnt)
+{
+    uint32_t gap;
+    for(gap = cnt / 2; gap > 0; gap /= 2) {
+        uint32_t i;
+        for(i = gap; i < cnt; i++) {
+            _lv_draw_sw_raster_edge_t tmp = edges[i];
+            uint32_t j = i;
+            while(j >= gap && edges[j - gap].y0 > tmp.y0) {
+                edges[j] = edges[j - gap];
+                j -= gap;
+            }
+            edges[j] = tmp;
+        }
+    }
+}
+
+/**
+ * Add the part of an edge in the current line to the accumulation buffer.
+ * Each touched pixel gets the area on the right of the edge and the next pixel gets the rest,
+ * so the running sum of the buffer gives the covered area of every pixel.
+ * @param raster    pointer to the rasterizer
+ * @param e         the edge to add
+ * @param row_y     top of the current line in sub-pixel units
+ */
+LV_ATTRIBUTE_FAST_MEM static void accumulate_edge(lv_draw_sw_raster_t * raster, const _lv_draw_sw_raster_edge_t * e,
+                                                  int32_t row_y)
+{
+    int32_t ys = LV_MAX(e->y0, row_y);
+    int32_t ye = LV_MIN(e->y1, row_y + ONE);
+    if(ys >= ye) return;
+
+    /*X coordinates where the edge enters and leaves the line (relative to the area)*/
+    int32_t edge_dx = e->x1 - e->x0;
+    int32_t edge_dy = e->y1 - e->y0;
+    int32_t area_x = LV_DRAW_SW_RASTER_SUBPX(raster->area.x1);
+    int32_t xs = e->x0 + (int32_t)(((int64_t)(ys - e->y0) * edge_dx) / edge_dy) - area_x;
+    int32_t xe = e->x0 + (int32_t)(((int64_t)(ye - e->y0) * edge_dx) / edge_dy) - area_x;
+
+    int32_t d = (ye - ys) * e->dir;
+    int32_t w = lv_area_get_width(&raster->area);
+    int32_t * acc = raster->acc;
+
+    if(xs > xe) {
+        int32_t t = xs;
+        xs = xe;
+        xe = t;
+    }
+
+    /*Completely on the left or on the right of the area*/
+    if(xe <= 0) {
+        acc[0] += d * ONE;
+        return;
+    }
+    if(xs >= LV_DRAW_SW_RASTER_SUBPX(w)) return;
+
+    int32_t x_first = xs >> SHIFT;
+    int32_t x_last = xe > xs ? (xe - 1) >> SHIFT : x_first;
+
+    /*The whole part is in one pixel. Use the average X to get the area*/
+    if(x_first == x_last) {
+        add_cell(acc, w, x_first, d, ((xs + xe) >> 1) - (x_first << SHIFT));
+        return;
+    }
+
+    /*Distribute the height proportionally among the touched pixels*/
+    int32_t dx = xe - xs;
+    int32_t x_prev = xs;
+    int32_t d_prev = 0;
+
+    /*The part on the left of the area covers all the visible pixels*/
+    if(xs < 0) {
+        d_prev = (int32_t)(((int64_t)d * (-xs)) / dx);
+        acc[0] += d_prev * ONE;
+        x_prev = 0;
+        x_first = 0;
+    }
+
+    int32_t x;
+    for(x = x_first; x <= x_last; x++) {
+        int32_t x_next = x == x_last ? xe : (x + 1) << SHIFT;
+        int32_t d_cum = (int32_t)(((int64_t)d * (x_next - xs)) / dx);
+        add_cell(acc, w, x, d_cum - d_prev, ((x_prev + x_next) >> 1) - (x << SHIFT));
+        d_prev = d_cum;
+        x_prev = x_next;
+
+        /*Nothing is visible on the right*/
+        if(x >= w) break;
+    }
+}
+
+/**
+ * Add the coverage of an edge part in a pixel
+ * @param acc       the accumulation buffer
+ * @param w         width of the accumulation buffer
+ * @param x         X coordinate of the pixel (relative to the area)
+ * @param d         height of the edge part in the pixel (signed)
+ * @param fract     the average X position of the edge inside the pixel [0..ONE]
+ */
+LV_ATTRIBUTE_FAST_MEM static inline void add_cell(int32_t * acc, int32_t w, int32_t x, int32_t d, int32_t fract)
+{
+    /*Left from the area: every visible pixel is on the right of the edge*/
+    if(x < 0) {
+        acc[0] += d * ONE;
+        return;
+    }
+
+    if(x >= w) return;
+
+    acc[x] += d * (ONE - fract);
+    acc[x + 1] += d * fract;
+}
+
+#endif /*LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX*/
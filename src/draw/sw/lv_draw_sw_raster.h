@@ -0,0 +1,156 @@
+/**
+ * @file lv_draw_sw_raster.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_RASTER_H
+#define LV_DRAW_SW_RASTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_mask.h"
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The coordinates of the edges are in 1/(2^LV_DRAW_SW_RASTER_SUBPX_SHIFT) pixel units*/
+#define LV_DRAW_SW_RASTER_SUBPX_SHIFT   8
+#define LV_DRAW_SW_RASTER_SUBPX_ONE     (1 << LV_DRAW_SW_RASTER_SUBPX_SHIFT)
+
+/*Convert a pixel coordinate to sub-pixel coordinate*/
+#define LV_DRAW_SW_RASTER_SUBPX(v)      ((int32_t)(v) * LV_DRAW_SW_RASTER_SUBPX_ONE)
+
+/*Convert a pixel coordinate to the sub-pixel coordinate of the pixel's center.
+ *The points of the paths and the vertices of the triangles are pixel centers.*/
+#define LV_DRAW_SW_RASTER_SUBPX_CENTER(v)   (LV_DRAW_SW_RASTER_SUBPX(v) + LV_DRAW_SW_RASTER_SUBPX_ONE / 2)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_DRAW_SW_RASTER_FILL_NONZERO,
+    LV_DRAW_SW_RASTER_FILL_EVENODD,
+};
+
+typedef uint8_t lv_draw_sw_raster_fill_rule_t;
+
+typedef struct {
+    int32_t x0;     /*Top point*/
+    int32_t y0;
+    int32_t x1;     /*Bottom point*/
+    int32_t y1;
+    int32_t dir;    /*1: the edge was added downwards, -1: upwards*/
+} _lv_draw_sw_raster_edge_t;
+
+/**
+ * A scanline coverage rasterizer.
+ * Arbitrary polygons are added as edges and the exact area coverage of each pixel
+ * is calculated line by line. Overlapping and self intersecting shapes are resolved by the fill rule,
+ * so there are no double anti-aliased pixels at the joints.
+ * Only the triangles and the paths are drawn with it yet; arcs, lines and rectangles still use
+ * the masks of `lv_draw_sw_mask.h`.
+ */
+typedef struct {
+    _lv_draw_sw_raster_edge_t * edges;
+    uint32_t edge_cnt;
+    uint32_t edge_size;
+
+    /*Bounding box of the added edges in sub-pixel coordinates*/
+    int32_t min_x;
+    int32_t min_y;
+    int32_t max_x;
+    int32_t max_y;
+
+    /*Data used while rendering. Set by `lv_draw_sw_raster_start`*/
+    lv_area_t area;
+    int32_t * acc;
+    uint32_t * active;
+    uint32_t active_cnt;
+    uint32_t next_edge;
+    lv_draw_sw_raster_fill_rule_t fill_rule;
+} lv_draw_sw_raster_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a rasterizer
+ * @param raster    pointer to a rasterizer
+ */
+void lv_draw_sw_raster_init(lv_draw_sw_raster_t * raster);
+
+/**
+ * Free the memory allocated by the rasterizer
+ * @param raster    pointer to a rasterizer
+ */
+void lv_draw_sw_raster_deinit(lv_draw_sw_raster_t * raster);
+
+/**
+ * Add an edge to the rasterizer. The edges need to form closed polygons.
+ * @param raster    pointer to a rasterizer
+ * @param x0        X coordinate of the start point in sub-pixel units
+ * @param y0        Y coordinate of the start point in sub-pixel units
+ * @param x1        X coordinate of the end point in sub-pixel units
+ * @param y1        Y coordinate of the end point in sub-pixel units
+ */
+void lv_draw_sw_raster_add_edge(lv_draw_sw_raster_t * raster, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+
+/**
+ * Add a closed polygon to the rasterizer.
+ * @param raster    pointer to a rasterizer
+ * @param points    the vertices in pixel coordinates. The pixel (x;y) covers the [x;x+1) x [y;y+1) area,
+ *                  so the vertices are the top left corners of the pixels.
+ *                  Use `lv_draw_sw_raster_add_edge` with `LV_DRAW_SW_RASTER_SUBPX_CENTER` for pixel centers.
+ * @param point_cnt number of points
+ */
+void lv_draw_sw_raster_add_polygon(lv_draw_sw_raster_t * raster, const lv_point_t * points, uint32_t point_cnt);
+
+/**
+ * Get the bounding box of the added edges in pixels
+ * @param raster    pointer to a rasterizer
+ * @param area      store the area here
+ * @return          false: no edges were added
+ */
+bool lv_draw_sw_raster_get_area(const lv_draw_sw_raster_t * raster, lv_area_t * area);
+
+/**
+ * Prepare the rasterizer to render the lines of an area. No edges can be added after this.
+ * @param raster    pointer to a rasterizer
+ * @param area      the area to render (absolute coordinates)
+ * @param fill_rule `LV_DRAW_SW_RASTER_FILL_NONZERO` or `LV_DRAW_SW_RASTER_FILL_EVENODD`
+ */
+void lv_draw_sw_raster_start(lv_draw_sw_raster_t * raster, const lv_area_t * area,
+                             lv_draw_sw_raster_fill_rule_t fill_rule);
+
+/**
+ * Calculate the coverage of a line. Needs to be called with increasing `y` values.
+ * @param raster    pointer to a rasterizer prepared by `lv_draw_sw_raster_start`
+ * @param y         the absolute Y coordinate of the line
+ * @param mask_buf  store the coverage here. Has to be `lv_area_get_width(area)` long.
+ * @return          `LV_DRAW_SW_MASK_RES_TRANSP`: nothing to draw in this line. `mask_buf` may be not set;
+ *                  `LV_DRAW_SW_MASK_RES_FULL_COVER`: every pixel is fully covered;
+ *                  `LV_DRAW_SW_MASK_RES_CHANGED`: `mask_buf` is set
+ */
+LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_res_t lv_draw_sw_raster_get_line(lv_draw_sw_raster_t * raster, lv_coord_t y,
+                                                                       lv_opa_t * mask_buf);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_RASTER_H*/
@@ -0,0 +1,458 @@
+/**
+ * @file lv_draw_sw_text_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_text_cache.h"
+#if LV_USE_DRAW_SW && defined(LV_DRAW_SW_TEXT_CACHE_SIZE) && LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+
+#include "../../core/lv_global.h"
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _text_cache LV_GLOBAL_DEFAULT()->sw_text_cache
+
+/*Larger texts are not cached so that a few of them can't take the whole cache*/
+#define MAX_BITMAP_SIZE     (LV_DRAW_SW_TEXT_CACHE_SIZE / 4)
+
+/*The texts seen only once store only their key, so a smaller budget is enough for them*/
+#define GHOST_SIZE          (LV_DRAW_SW_TEXT_CACHE_SIZE / 8)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A draw unit which composes the glyphs into the bitmap of an entry instead of drawing them
+ */
+typedef struct {
+    lv_draw_unit_t base_unit;
+    const lv_area_t * coords;
+    uint8_t * buf;
+    uint32_t stride;
+    bool ok;
+} render_unit_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool is_cacheable(const lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
+static uint32_t get_text_hash(const char * text);
+static bool text_is_equal(const char * t1, const char * t2);
+static lv_draw_sw_text_cache_entry_t * find_entry(lv_hash_lru_t * table, const lv_draw_label_dsc_t * dsc,
+                                                  int32_t w, int32_t h, uint32_t hash);
+static lv_draw_sw_text_cache_entry_t * create_entry(const lv_draw_label_dsc_t * dsc, int32_t w, int32_t h,
+                                                    bool with_bitmap);
+static void add_entry(lv_draw_sw_text_cache_entry_t * entry, uint32_t hash);
+static void remove_entry(lv_draw_sw_text_cache_entry_t * entry);
+static void free_entry(lv_draw_sw_text_cache_entry_t * entry);
+static void free_all(lv_hash_lru_t * table);
+static bool render(lv_draw_sw_text_cache_entry_t * entry, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords);
+static void render_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_dsc, lv_draw_fill_dsc_t * fill_dsc,
+                      const lv_area_t * fill_area);
+static bool uses_font(const lv_font_t * font_act, const lv_font_t * font);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_draw_sw_text_cache_init(void)
+{
+    lv_memzero(&_text_cache, sizeof(_text_cache));
+    lv_mutex_init(&_text_cache.mutex);
+    lv_mem_budget_init(&_text_cache.mem_budget, LV_DRAW_SW_TEXT_CACHE_SIZE);
+    lv_mem_budget_init(&_text_cache.ghost_mem_budget, GHOST_SIZE);
+    lv_hash_lru_init(&_text_cache.entries);
+    lv_hash_lru_init(&_text_cache.ghosts);
+    lv_font_add_invalidate_cb(lv_draw_sw_text_cache_invalidate_font);
+}
+
+void _lv_draw_sw_text_cache_deinit(void)
+{
+    lv_font_remove_invalidate_cb(lv_draw_sw_text_cache_invalidate_font);
+
+    free_all(&_text_cache.entries);
+    free_all(&_text_cache.ghosts);
+
+    lv_hash_lru_deinit(&_text_cache.entries);
+    lv_hash_lru_deinit(&_text_cache.ghosts);
+    lv_mutex_delete(&_text_cache.mutex);
+    lv_memzero(&_text_cache, sizeof(_text_cache));
+}
+
+lv_draw_sw_text_cache_entry_t * _lv_draw_sw_text_cache_acquire(const lv_draw_label_dsc_t * dsc,
+                                                                const lv_area_t * coords)
+{
+    if(!is_cacheable(dsc, coords)) return NULL;
+
+    int32_t w = lv_area_get_width(coords);
+    int32_t h = lv_area_get_height(coords);
+    uint32_t hash = get_text_hash(dsc->text);
+
+    lv_mutex_lock(&_text_cache.mutex);
+    lv_draw_sw_text_cache_entry_t * entry = find_entry(&_text_cache.entries, dsc, w, h, hash);
+    if(entry) {
+        lv_hash_lru_touch(&_text_cache.entries, &entry->node);
+        entry->ref_cnt++;
+        _text_cache.entries.stats.hit_cnt++;
+        lv_mutex_unlock(&_text_cache.mutex);
+        return entry;
+    }
+
+    lv_draw_sw_text_cache_entry_t * ghost = find_entry(&_text_cache.ghosts, dsc, w, h, hash);
+    if(ghost == NULL) {
+        /*Texts drawn only once (e.g. a changing value) are not rendered, just remembered as a ghost entry*/
+        ghost = create_entry(dsc, w, h, false);
+        if(ghost) add_entry(ghost, hash);
+        lv_mutex_unlock(&_text_cache.mutex);
+        return NULL;
+    }
+
+    lv_hash_lru_touch(&_text_cache.ghosts, &ghost->node);
+    if(ghost->no_cache) {
+        lv_mutex_unlock(&_text_cache.mutex);
+        return NULL;
+    }
+
+    /*It's drawn the second time so it's probably static. Render it and replace the ghost entry.*/
+    lv_draw_sw_text_cache_entry_t * entry_new = create_entry(dsc, w, h, true);
+    lv_mutex_unlock(&_text_cache.mutex);
+    if(entry_new == NULL) return NULL;
+
+    /*Render without holding the lock, so the other draw units are not blocked*/
+    bool ok = render(entry_new, dsc, coords);
+
+    lv_mutex_lock(&_text_cache.mutex);
+    ghost = find_entry(&_text_cache.ghosts, dsc, w, h, hash);
+    if(!ok) {
+        /*Remember that it can't be cached and don't try again*/
+        if(ghost) ghost->no_cache = 1;
+        free_entry(entry_new);
+        lv_mutex_unlock(&_text_cache.mutex);
+        return NULL;
+    }
+
+    /*Another draw unit might have rendered the same text in the meantime*/
+    entry = find_entry(&_text_cache.entries, dsc, w, h, hash);
+    if(entry) {
+        free_entry(entry_new);
+        entry_new = entry;
+    }
+    else {
+        /*The ghost entries are never used for drawing so they can be freed*/
+        if(ghost) {
+            remove_entry(ghost);
+            free_entry(ghost);
+        }
+        add_entry(entry_new, hash);
+        _text_cache.entries.stats.miss_cnt++;
+    }
+
+    entry_new->ref_cnt++;
+    lv_mutex_unlock(&_text_cache.mutex);
+
+    return entry_new;
+}
+
+void _lv_draw_sw_text_cache_release(lv_draw_sw_text_cache_entry_t * entry)
+{
+    lv_mutex_lock(&_text_cache.mutex);
+    entry->ref_cnt--;
+    if(entry->temporary && entry->ref_cnt == 0) free_entry(entry);
+    lv_mutex_unlock(&_text_cache.mutex);
+}
+
+void lv_draw_sw_text_cache_invalidate_font(const lv_font_t * font)
+{
+    lv_mutex_lock(&_text_cache.mutex);
+    lv_hash_lru_t * tables[] = {&_text_cache.entries, &_text_cache.ghosts};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_hash_lru_node_t * node = tables[i]->lru_head;
+        while(node) {
+            lv_hash_lru_node_t * next = node->lru_next;
+            lv_draw_sw_text_cache_entry_t * entry = (lv_draw_sw_text_cache_entry_t *)node;
+            if(uses_font(entry->font, font)) {
+                remove_entry(entry);
+                /*If it's being drawn just detach it, the last user will free it*/
+                if(entry->ref_cnt) entry->temporary = 1;
+                else free_entry(entry);
+            }
+            node = next;
+        }
+    }
+    lv_mutex_unlock(&_text_cache.mutex);
+}
+
+void lv_draw_sw_text_cache_get_stats(lv_draw_sw_text_cache_stats_t * stats)
+{
+    lv_mutex_lock(&_text_cache.mutex);
+    *stats = _text_cache.entries.stats;
+    stats->entry_cnt += _text_cache.ghosts.stats.entry_cnt;
+    stats->byte_cnt += _text_cache.ghosts.stats.byte_cnt;
+    lv_mutex_unlock(&_text_cache.mutex);
+}
+
+void lv_draw_sw_text_cache_reset_stats(void)
+{
+    lv_mutex_lock(&_text_cache.mutex);
+    lv_hash_lru_reset_stats(&_text_cache.entries);
+    lv_mutex_unlock(&_text_cache.mutex);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool is_cacheable(const lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    /*The selected letters have different colors*/
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) return false;
+
+    /*Scrolled texts are moving anyway*/
+    if(dsc->ofs_x != 0 || dsc->ofs_y != 0) return false;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(coords), LV_COLOR_FORMAT_A8);
+    if(stride * lv_area_get_height(coords) > MAX_BITMAP_SIZE) return false;
+
+    return true;
+}
+
+/**
+ * FNV-1a hash of a string
+ */
+static uint32_t get_text_hash(const char * text)
+{
+    uint32_t h = 2166136261U;
+    while(*text) {
+        h ^= (uint8_t) * text;
+        h *= 16777619U;
+        text++;
+    }
+
+    /*Mix the bits as only the lower bits are used to select the bucket*/
+    h ^= h >> 16;
+    h *= 0x7feb352dU;
+    h ^= h >> 15;
+    return h;
+}
+
+static bool text_is_equal(const char * t1, const char * t2)
+{
+    while(*t1 && *t1 == *t2) {
+        t1++;
+        t2++;
+    }
+
+    return *t1 == *t2;
+}
+
+static lv_draw_sw_text_cache_entry_t * find_entry(lv_hash_lru_t * table, const lv_draw_label_dsc_t * dsc,
+                                                  int32_t w, int32_t h, uint32_t hash)
+{
+    lv_hash_lru_node_t * node = lv_hash_lru_find_first(table, hash);
+    while(node) {
+        lv_draw_sw_text_cache_entry_t * entry = (lv_draw_sw_text_cache_entry_t *)node;
+        if(entry->font == dsc->font && entry->w == w && entry->h == h &&
+           entry->letter_space == dsc->letter_space && entry->line_space == dsc->line_space &&
+           entry->flag == dsc->flag && entry->align == dsc->align && entry->bidi_dir == dsc->bidi_dir &&
+           entry->decor == dsc->decor && text_is_equal(entry->text, dsc->text)) {
+            return entry;
+        }
+        node = lv_hash_lru_find_next(node);
+    }
+
+    return NULL;
+}
+
+/**
+ * Allocate and initialize a new entry. Free the least recently used texts which are not drawn right now if needed.
+ * The ghost entries (without bitmap) can free only other ghost entries.
+ * The entry is not added to the cache.
+ */
+static lv_draw_sw_text_cache_entry_t * create_entry(const lv_draw_label_dsc_t * dsc, int32_t w, int32_t h,
+                                                    bool with_bitmap)
+{
+    uint32_t text_size = lv_strlen(dsc->text) + 1;
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    uint32_t size = sizeof(lv_draw_sw_text_cache_entry_t) + text_size;
+    if(with_bitmap) size += LV_DRAW_BUF_ALIGN - 1 + stride * h;
+
+    lv_mem_budget_t * budget = with_bitmap ? &_text_cache.mem_budget : &_text_cache.ghost_mem_budget;
+    lv_hash_lru_t * table = with_bitmap ? &_text_cache.entries : &_text_cache.ghosts;
+
+    lv_draw_sw_text_cache_entry_t * entry = lv_mem_budget_alloc(budget, size);
+    lv_hash_lru_node_t * victim = table->lru_tail;
+    while(entry == NULL && victim) {
+        lv_hash_lru_node_t * prev = victim->lru_prev;
+        if(((lv_draw_sw_text_cache_entry_t *)victim)->ref_cnt == 0) {
+            remove_entry((lv_draw_sw_text_cache_entry_t *)victim);
+            free_entry((lv_draw_sw_text_cache_entry_t *)victim);
+            if(with_bitmap) _text_cache.entries.stats.evict_cnt++;
+            entry = lv_mem_budget_alloc(budget, size);
+        }
+        victim = prev;
+    }
+
+    if(entry == NULL) return NULL;
+
+    lv_memzero(entry, sizeof(lv_draw_sw_text_cache_entry_t));
+    entry->size = size;
+    entry->font = dsc->font;
+    entry->w = w;
+    entry->h = h;
+    entry->letter_space = dsc->letter_space;
+    entry->line_space = dsc->line_space;
+    entry->flag = dsc->flag;
+    entry->align = dsc->align;
+    entry->bidi_dir = dsc->bidi_dir;
+    entry->decor = dsc->decor;
+
+    char * text = (char *)entry + sizeof(lv_draw_sw_text_cache_entry_t);
+    lv_memcpy(text, dsc->text, text_size);
+    entry->text = text;
+
+    if(with_bitmap) {
+        entry->buf = lv_draw_buf_align_buf(text + text_size, LV_COLOR_FORMAT_A8);
+        entry->stride = stride;
+    }
+
+    return entry;
+}
+
+static void add_entry(lv_draw_sw_text_cache_entry_t * entry, uint32_t hash)
+{
+    lv_hash_lru_t * table = entry->buf ? &_text_cache.entries : &_text_cache.ghosts;
+    lv_hash_lru_add(table, &entry->node, entry->size);
+    lv_hash_lru_index(table, &entry->node, hash);
+}
+
+static void remove_entry(lv_draw_sw_text_cache_entry_t * entry)
+{
+    lv_hash_lru_remove(entry->buf ? &_text_cache.entries : &_text_cache.ghosts, &entry->node);
+}
+
+/**
+ * Free an entry which is not in the cache
+ */
+static void free_entry(lv_draw_sw_text_cache_entry_t * entry)
+{
+    lv_mem_budget_free(entry->buf ? &_text_cache.mem_budget : &_text_cache.ghost_mem_budget, entry, entry->size);
+}
+
+static void free_all(lv_hash_lru_t * table)
+{
+    lv_hash_lru_node_t * node = table->lru_head;
+    while(node) {
+        lv_hash_lru_node_t * next = node->lru_next;
+        free_entry((lv_draw_sw_text_cache_entry_t *)node);
+        node = next;
+    }
+}
+
+/**
+ * Render the coverage of a text into the bitmap of an entry
+ * @return      false: the text can't be rendered exactly (e.g. it's out of `coords` or has image glyphs)
+ */
+static bool render(lv_draw_sw_text_cache_entry_t * entry, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords)
+{
+    lv_memzero(entry->buf, entry->stride * entry->h);
+
+    /*If the text doesn't fit into the area, it can be drawn out of it when it's not cached.
+     *So visit all the letters, not only the ones in `coords`, and `render_cb` rejects the ones out of it.*/
+    lv_area_t clip_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX};
+
+    render_unit_t u;
+    lv_memzero(&u, sizeof(u));
+    u.base_unit.clip_area = &clip_area;
+    u.coords = coords;
+    u.buf = entry->buf;
+    u.stride = entry->stride;
+    u.ok = true;
+
+    lv_draw_label_dsc_t dsc_tmp = *dsc;
+    dsc_tmp.hint = NULL;
+    lv_draw_label_interate_letters(&u.base_unit, &dsc_tmp, coords, render_cb);
+
+    return u.ok;
+}
+
+static void render_cb(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * glyph_dsc, lv_draw_fill_dsc_t * fill_dsc,
+                      const lv_area_t * fill_area)
+{
+    render_unit_t * u = (render_unit_t *)draw_unit;
+    if(!u->ok) return;
+
+    if(glyph_dsc) {
+        /*Only the normal glyphs can be rendered, placeholders and images are drawn differently*/
+        if(glyph_dsc->bitmap == NULL || glyph_dsc->format != LV_DRAW_LETTER_BITMAP_FORMAT_A8 ||
+           !_lv_area_is_in(glyph_dsc->letter_coords, u->coords, 0)) {
+            u->ok = false;
+            return;
+        }
+
+        const lv_area_t * a = glyph_dsc->letter_coords;
+        int32_t glyph_w = lv_area_get_width(a);
+        int32_t glyph_h = lv_area_get_height(a);
+        uint32_t glyph_stride = lv_draw_buf_width_to_stride(glyph_w, LV_COLOR_FORMAT_A8);
+        const uint8_t * src = glyph_dsc->bitmap;
+        uint8_t * dest = u->buf + (a->y1 - u->coords->y1) * u->stride + (a->x1 - u->coords->x1);
+        int32_t x;
+        int32_t y;
+        for(y = 0; y < glyph_h; y++) {
+            for(x = 0; x < glyph_w; x++) {
+                /*Overlapping glyphs: combine the coverages as if they were blended on each other*/
+                if(dest[x] == 0) dest[x] = src[x];
+                else if(src[x]) dest[x] = 255 - LV_UDIV255((255 - dest[x]) * (255 - src[x]));
+            }
+            src += glyph_stride;
+            dest += u->stride;
+        }
+    }
+
+    if(fill_dsc && fill_area) {
+        if(!_lv_area_is_in(fill_area, u->coords, 0)) {
+            u->ok = false;
+            return;
+        }
+
+        int32_t fill_w = lv_area_get_width(fill_area);
+        uint8_t * dest = u->buf + (fill_area->y1 - u->coords->y1) * u->stride + (fill_area->x1 - u->coords->x1);
+        int32_t y;
+        for(y = fill_area->y1; y <= fill_area->y2; y++) {
+            lv_memset(dest, 0xff, fill_w);
+            dest += u->stride;
+        }
+    }
+}
+
+/**
+ * Check if a font or its fallbacks are `font`
+ */
+static bool uses_font(const lv_font_t * font_act, const lv_font_t * font)
+{
+    while(font_act) {
+        if(font_act == font) return true;
+        font_act = font_act->fallback;
+    }
+
+    return false;
+}
+
+#endif /*LV_DRAW_SW_TEXT_CACHE_SIZE > 0*/
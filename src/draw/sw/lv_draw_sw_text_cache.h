@@ -0,0 +1,130 @@
+/**
+ * @file lv_draw_sw_text_cache.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_TEXT_CACHE_H
+#define LV_DRAW_SW_TEXT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_conf_internal.h"
+#include "../lv_draw_label.h"
+#include "../../misc/lv_mem_budget.h"
+#include "../../misc/lv_hash_lru.h"
+#include "../../osal/lv_os.h"
+
+#if LV_USE_DRAW_SW && defined(LV_DRAW_SW_TEXT_CACHE_SIZE) && LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A rendered text: the coverage of the whole label area in A8 format.
+ * The entry, the text and the bitmap are allocated together with `lv_malloc`.
+ */
+typedef struct {
+    lv_hash_lru_node_t node;            /**< Must be the first. Its hash is the hash of the text.*/
+    const lv_font_t * font;
+    int32_t w;                          /**< Width of the label area*/
+    int32_t h;                          /**< Height of the label area*/
+    int32_t letter_space;
+    int32_t line_space;
+    lv_text_flag_t flag;
+    lv_text_align_t align;
+    lv_base_dir_t bidi_dir;
+    lv_text_decor_t decor;
+    const char * text;                  /**< Copy of the text*/
+    uint8_t * buf;                      /**< The A8 coverage or NULL if the text was seen only once*/
+    uint32_t stride;                    /**< Stride of `buf` in bytes*/
+    uint32_t size;                      /**< Memory used by the entry in bytes*/
+    uint32_t ref_cnt;                   /**< Number of draw units drawing the text right now*/
+    uint32_t no_cache : 1;              /**< The text can't be rendered into a bitmap, always draw it normally*/
+    uint32_t temporary : 1;             /**< Not in the cache: freed when the last user releases it*/
+} lv_draw_sw_text_cache_entry_t;
+
+typedef lv_hash_lru_stats_t lv_draw_sw_text_cache_stats_t;
+
+/**
+ * The entries are allocated one by one, but the rendered texts use at most `LV_DRAW_SW_TEXT_CACHE_SIZE` bytes.
+ * If a new entry doesn't fit, the least recently used texts are freed.
+ * The texts seen only once have a smaller budget of their own, so they can't evict the rendered texts.
+ */
+typedef struct {
+    lv_mem_budget_t mem_budget;
+    lv_mem_budget_t ghost_mem_budget;
+    lv_hash_lru_t entries;      /**< The rendered texts by the hash of their text and in the order to evict them*/
+    lv_hash_lru_t ghosts;       /**< The texts seen only once, without bitmap*/
+    lv_mutex_t mutex;
+} _lv_draw_sw_text_cache_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the text cache. Called by LVGL in `lv_draw_sw_init`.
+ */
+void _lv_draw_sw_text_cache_init(void);
+
+/**
+ * Free all the cached texts. Called by LVGL in `lv_deinit`.
+ */
+void _lv_draw_sw_text_cache_deinit(void);
+
+/**
+ * Get the rendered bitmap of a text. A text is rendered when it's drawn the second time with the same settings.
+ * The entry can't be freed until `_lv_draw_sw_text_cache_release` is called.
+ * @param dsc       the label draw descriptor
+ * @param coords    the coordinates of the label
+ * @return          the entry with the rendered text or NULL if the text needs to be drawn normally
+ */
+lv_draw_sw_text_cache_entry_t * _lv_draw_sw_text_cache_acquire(const lv_draw_label_dsc_t * dsc,
+                                                                const lv_area_t * coords);
+
+/**
+ * Mark a rendered text as not used anymore
+ * @param entry     the entry returned by `_lv_draw_sw_text_cache_acquire`
+ */
+void _lv_draw_sw_text_cache_release(lv_draw_sw_text_cache_entry_t * entry);
+
+/**
+ * Drop the texts rendered with a font from the cache. It's called by `lv_font_invalidate`.
+ * The texts whose font has `font` as fallback are dropped too.
+ * @param font      pointer to a font
+ */
+void lv_draw_sw_text_cache_invalidate_font(const lv_font_t * font);
+
+/**
+ * Get the statistics of the text cache. A hit means the text was drawn from the cache, a miss means it was
+ * rendered into the cache. The entries include the texts seen only once, which have no bitmap.
+ * @param stats     store the statistics here
+ */
+void lv_draw_sw_text_cache_get_stats(lv_draw_sw_text_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and evict counters of the text cache
+ */
+void lv_draw_sw_text_cache_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_DRAW_SW_TEXT_CACHE_SIZE > 0*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_TEXT_CACHE_H*/
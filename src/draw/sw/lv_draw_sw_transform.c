@@ -13,6 +13,7 @@
 #include "../../misc/lv_area.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_color.h"
+#include "../../stdlib/lv_mem.h"
 
 /*********************
  *      DEFINES
@@ -21,6 +22,28 @@
 /**********************
  *      TYPEDEFS
  **********************/
+enum {
+    SCALE_MODE_NEAREST,     /*Antialiasing is disabled: take the closest source pixel*/
+    SCALE_MODE_BILINEAR,    /*Mix the closest pixel with its horizontal and vertical neighbours*/
+    SCALE_MODE_BOX,         /*Downscale below 50%: average all the source pixels under the destination pixel*/
+};
+
+typedef uint8_t scale_mode_t;
+
+/**
+ * The source coordinates of a destination column or row in case of scaling only.
+ * As they don't depend on the other axis, they are calculated only once per column and row.
+ */
+typedef struct {
+    int32_t ups;        /*Upscaled (x256) source coordinate of the middle of the pixel*/
+    int32_t pos;        /*The source pixel under the middle of the destination pixel*/
+    int32_t next;       /*-1 or 1: direction of the neighbour pixel to mix with*/
+    int32_t fract;      /*0..0x7F: weight of the neighbour pixel*/
+    bool inner;         /*`pos` and its neighbour are both on the image*/
+    int32_t box_start;  /*First source pixel in the box, clipped to the image*/
+    int32_t box_cnt;    /*Number of source pixels in the box, clipped to the image*/
+    int32_t box_full;   /*Number of source pixels in the box without clipping*/
+} scale_coord_t;
 typedef struct {
     int32_t x_in;
     int32_t y_in;
@@ -49,14 +72,44 @@ typedef struct {
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout);
 
+/**
+ * Find the pixels of a row where the source pixel and its neighbours are all on the image.
+ * These pixels are stepped with accumulators and read without bounds checks, but the neighbour selection
+ * and the color comparisons still branch per pixel. The other pixels are handled by the `*_edge` functions.
+ * @param xs_ups        upscaled source X of the first pixel
+ * @param ys_ups        upscaled source Y of the first pixel
+ * @param xs_step       X step per pixel in 1/256 units
+ * @param ys_step       Y step per pixel in 1/256 units
+ * @param x_end         number of pixels in the row
+ * @param src_w         width of the image
+ * @param src_h         height of the image
+ * @param aa            true: antialiasing is enabled
+ * @param inner_start   store the first inner pixel here
+ * @param inner_end     store the pixel after the last inner pixel here
+ */
+static void get_inner_span(int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step, int32_t x_end,
+                           lv_coord_t src_w, lv_coord_t src_h, bool aa, int32_t * inner_start, int32_t * inner_end);
+
+/**
+ * Find the pixels of a row where a source coordinate is in a range
+ * @param c_ups         upscaled source coordinate of the first pixel
+ * @param step          step of the coordinate per pixel in 1/256 units
+ * @param min           the smallest upscaled coordinate in the range
+ * @param max           the upscaled coordinate after the range
+ * @param start         store the first pixel in the range here
+ * @param end           store the pixel after the last pixel in the range here. It's <= `start` if no pixel is in it.
+ */
+static void get_axis_span(int32_t c_ups, int32_t step, int32_t min, int32_t max, int64_t * start, int64_t * end);
+
+static inline int64_t div_floor(int64_t a, int64_t b);
+
 static void tranform_rgb888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                             int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
 
-
 static void tranform_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
                               int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
-                              int32_t x_end, uint8_t * dest_buf, bool aa);
+                              int32_t x_end, uint8_t * dest_buf, bool aa, bool premultiplied);
 
 static void transform_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
                                int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
@@ -66,6 +119,54 @@ static void transform_a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h
                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                          int32_t x_end, uint8_t * abuf, bool aa);
 
+/*The generic per pixel functions. Used for the pixels on the edges of the image and when antialiasing is disabled*/
+static void tranform_rgb888_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                                 int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                 int32_t x_start, int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
+
+static void tranform_argb8888_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                                   int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                   int32_t x_start, int32_t x_end, uint8_t * dest_buf, bool aa, bool premultiplied);
+
+static void transform_rgb565a8_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                    int32_t x_start, int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8,
+                                    bool aa);
+
+static void transform_a8_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                              int32_t x_start, int32_t x_end, uint8_t * abuf, bool aa);
+
+static void transform_scale(const lv_area_t * dest_area, const void * src_buf, lv_coord_t src_w, lv_coord_t src_h,
+                            lv_coord_t src_stride, const lv_draw_image_dsc_t * draw_dsc, lv_color_format_t src_cf,
+                            uint8_t * dest_buf, lv_coord_t dest_stride, uint8_t * alpha_buf, lv_coord_t dest_stride_a8);
+
+static void scale_coord_init(scale_coord_t * c, int32_t ups, int32_t step, lv_coord_t size, scale_mode_t mode);
+
+static void scale_rgb888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                         const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                         int32_t inner_start, int32_t inner_end, int32_t x_end,
+                         lv_color32_t * dest_c32, scale_mode_t mode, uint32_t px_size);
+
+static void scale_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                           const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                           int32_t inner_start, int32_t inner_end, int32_t x_end,
+                           lv_color32_t * dest_c32, scale_mode_t mode, bool premultiplied);
+
+/*Interpolate premultiplied colors: all the channels are mixed the same way*/
+static inline lv_color32_t premultiplied_mix(lv_color32_t fg, lv_color32_t bg, int32_t mix);
+static inline lv_color32_t premultiplied_fade(lv_color32_t c, int32_t fade);
+
+static void scale_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                           const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                           int32_t inner_start, int32_t inner_end, int32_t x_end,
+                           uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, scale_mode_t mode);
+
+static void scale_a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                     const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                     int32_t inner_start, int32_t inner_end, int32_t x_end,
+                     uint8_t * abuf, scale_mode_t mode);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -127,6 +228,13 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
         alpha_buf = NULL;
     }
 
+    /*In case of scaling only the source coordinates can be calculated per column and per row*/
+    if(draw_dsc->rotation == 0) {
+        transform_scale(dest_area, src_buf, src_w, src_h, src_stride, draw_dsc, src_cf, dest_buf, dest_stride,
+                        alpha_buf, dest_stride_a8);
+        return;
+    }
+
     bool aa = draw_dsc->antialias;
 
     lv_coord_t y;
@@ -159,7 +267,12 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
                 transform_a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
                 break;
             case LV_COLOR_FORMAT_ARGB8888:
-                tranform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa);
+                tranform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                                  false);
+                break;
+            case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+                tranform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
+                                  true);
                 break;
             case LV_COLOR_FORMAT_RGB565:
                 transform_rgb565a8(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
@@ -183,16 +296,315 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
  *   STATIC FUNCTIONS
  **********************/
 
+static void get_inner_span(int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step, int32_t x_end,
+                           lv_coord_t src_w, lv_coord_t src_h, bool aa, int32_t * inner_start, int32_t * inner_end)
+{
+    /*Without antialiasing the neighbours are not used, let the generic functions handle the whole row*/
+    if(!aa) {
+        *inner_start = x_end;
+        *inner_end = x_end;
+        return;
+    }
+
+    /*The source coordinates are monotonic in X so the pixels where both of them are in range form a span.
+     *The pixel under the point and the neighbour toward the point need to be on the image.*/
+    int64_t x_start;
+    int64_t x_stop;
+    int64_t y_start;
+    int64_t y_stop;
+    get_axis_span(xs_ups, xs_step, 0x80, (src_w - 1) * 256 + 0x80, &x_start, &x_stop);
+    get_axis_span(ys_ups, ys_step, 0x80, (src_h - 1) * 256 + 0x80, &y_start, &y_stop);
+
+    int64_t start = LV_MAX(LV_MAX(x_start, y_start), 0);
+    int64_t end = LV_MIN(LV_MIN(x_stop, y_stop), x_end);
+    if(start >= end) {
+        /*No inner pixels, the edge functions handle the whole row*/
+        *inner_start = x_end;
+        *inner_end = x_end;
+        return;
+    }
+
+    *inner_start = (int32_t)start;
+    *inner_end = (int32_t)end;
+}
+
+static void get_axis_span(int32_t c_ups, int32_t step, int32_t min, int32_t max, int64_t * start, int64_t * end)
+{
+    /*The coordinate of pixel `x` is `c_ups + floor(step * x / 256)`, so
+     *`c >= min` <=> `step * x >= 256 * (min - c_ups)` and `c < max` <=> `step * x < 256 * (max - c_ups)`*/
+    int64_t lo = ((int64_t)min - c_ups) * 256;
+    int64_t hi = ((int64_t)max - c_ups) * 256;
+
+    if(step == 0) {
+        bool in = lo <= 0 && hi > 0;
+        *start = in ? INT32_MIN : 0;
+        *end = in ? INT32_MAX : 0;
+    }
+    else if(step > 0) {
+        *start = -div_floor(-lo, step);         /*ceil(lo / step)*/
+        *end = -div_floor(-hi, step);           /*ceil(hi / step)*/
+    }
+    else {
+        *start = div_floor(hi, step) + 1;
+        *end = div_floor(lo, step) + 1;
+    }
+}
+
+static inline int64_t div_floor(int64_t a, int64_t b)
+{
+    int64_t q = a / b;
+    if((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+
 static void tranform_rgb888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                             int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
+{
+    int32_t inner_start;
+    int32_t inner_end;
+    get_inner_span(xs_ups, ys_ups, xs_step, ys_step, x_end, src_w, src_h, aa, &inner_start, &inner_end);
+
+    tranform_rgb888_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                         0, inner_start, dest_buf, aa, px_size);
+    tranform_rgb888_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                         inner_end, x_end, dest_buf, aa, px_size);
+
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+    int32_t line_size = src_stride * (int32_t)px_size;
+    int32_t xs_acc = xs_step * inner_start;
+    int32_t ys_acc = ys_step * inner_start;
+
+    lv_coord_t x;
+    for(x = inner_start; x < inner_end; x++) {
+        int32_t xs = xs_ups + (xs_acc >> 8);
+        int32_t ys = ys_ups + (ys_acc >> 8);
+        xs_acc += xs_step;
+        ys_acc += ys_step;
+
+        int32_t xs_fract = xs & 0xFF;
+        int32_t ys_fract = ys & 0xFF;
+        int32_t x_next = xs_fract < 0x80 ? -1 : 1;
+        int32_t y_next = ys_fract < 0x80 ? -1 : 1;
+        xs_fract = xs_fract < 0x80 ? 0x7F - xs_fract : xs_fract - 0x80;
+        ys_fract = ys_fract < 0x80 ? 0x7F - ys_fract : ys_fract - 0x80;
+
+        const uint8_t * src_u8 = src + (ys >> 8) * line_size + (xs >> 8) * (int32_t)px_size;
+
+        lv_color32_t c;
+        c.red = src_u8[2];
+        c.green = src_u8[1];
+        c.blue = src_u8[0];
+        c.alpha = 0xff;
+
+        const uint8_t * px_ver_u8 = src_u8 + y_next * line_size;
+        lv_color32_t px_ver;
+        px_ver.red = px_ver_u8[2];
+        px_ver.green = px_ver_u8[1];
+        px_ver.blue = px_ver_u8[0];
+        px_ver.alpha = 0xff;
+
+        const uint8_t * px_hor_u8 = src_u8 + x_next * (int32_t)px_size;
+        lv_color32_t px_hor;
+        px_hor.red = px_hor_u8[2];
+        px_hor.green = px_hor_u8[1];
+        px_hor.blue = px_hor_u8[0];
+        px_hor.alpha = 0xff;
+
+        if(!lv_color32_eq(c, px_ver)) {
+            px_ver.alpha = ys_fract;
+            c = lv_color_mix32(px_ver, c);
+        }
+
+        if(!lv_color32_eq(c, px_hor)) {
+            px_hor.alpha = xs_fract;
+            c = lv_color_mix32(px_hor, c);
+        }
+
+        dest_c32[x] = c;
+    }
+}
+
+static void tranform_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                              int32_t x_end, uint8_t * dest_buf, bool aa, bool premultiplied)
+{
+    int32_t inner_start;
+    int32_t inner_end;
+    get_inner_span(xs_ups, ys_ups, xs_step, ys_step, x_end, src_w, src_h, aa, &inner_start, &inner_end);
+
+    tranform_argb8888_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                           0, inner_start, dest_buf, aa, premultiplied);
+    tranform_argb8888_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                           inner_end, x_end, dest_buf, aa, premultiplied);
+
+    const lv_color32_t * src_c32 = (const lv_color32_t *)src;
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+    int32_t xs_acc = xs_step * inner_start;
+    int32_t ys_acc = ys_step * inner_start;
+
+    lv_coord_t x;
+    for(x = inner_start; x < inner_end; x++) {
+        int32_t xs = xs_ups + (xs_acc >> 8);
+        int32_t ys = ys_ups + (ys_acc >> 8);
+        xs_acc += xs_step;
+        ys_acc += ys_step;
+
+        int32_t xs_fract = xs & 0xFF;
+        int32_t ys_fract = ys & 0xFF;
+        int32_t x_next = xs_fract < 0x80 ? -1 : 1;
+        int32_t y_next = ys_fract < 0x80 ? -1 : 1;
+        xs_fract = xs_fract < 0x80 ? 0x7F - xs_fract : xs_fract - 0x80;
+        ys_fract = ys_fract < 0x80 ? 0x7F - ys_fract : ys_fract - 0x80;
+
+        const lv_color32_t * src_px = src_c32 + (ys >> 8) * src_stride + (xs >> 8);
+        lv_color32_t c = src_px[0];
+        lv_color32_t px_hor = src_px[x_next];
+        lv_color32_t px_ver = src_px[y_next * src_stride];
+
+        if(premultiplied) {
+            c = premultiplied_mix(px_ver, c, ys_fract);
+            dest_c32[x] = premultiplied_mix(px_hor, c, xs_fract);
+            continue;
+        }
+
+        if(px_ver.alpha == 0) {
+            c.alpha = (c.alpha * (0xFF - ys_fract)) >> 8;
+        }
+        else if(!lv_color32_eq(c, px_ver)) {
+            c.alpha = ((px_ver.alpha * ys_fract) + (c.alpha * (0xFF - ys_fract))) >> 8;
+            px_ver.alpha = ys_fract;
+            c = lv_color_mix32(px_ver, c);
+        }
+
+        if(px_hor.alpha == 0) {
+            c.alpha = (c.alpha * (0xFF - xs_fract)) >> 8;
+        }
+        else if(!lv_color32_eq(c, px_hor)) {
+            c.alpha = ((px_hor.alpha * xs_fract) + (c.alpha * (0xFF - xs_fract))) >> 8;
+            px_hor.alpha = xs_fract;
+            c = lv_color_mix32(px_hor, c);
+        }
+
+        dest_c32[x] = c;
+    }
+}
+
+static void transform_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                               int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                               int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa)
+{
+    int32_t inner_start;
+    int32_t inner_end;
+    get_inner_span(xs_ups, ys_ups, xs_step, ys_step, x_end, src_w, src_h, aa, &inner_start, &inner_end);
+
+    transform_rgb565a8_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                            0, inner_start, cbuf, abuf, src_has_a8, aa);
+    transform_rgb565a8_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                            inner_end, x_end, cbuf, abuf, src_has_a8, aa);
+
+    const uint16_t * src_rgb = (const uint16_t *)src;
+    const lv_opa_t * src_alpha = src + src_stride * src_h * 2;
+    int32_t xs_acc = xs_step * inner_start;
+    int32_t ys_acc = ys_step * inner_start;
+
+    lv_coord_t x;
+    for(x = inner_start; x < inner_end; x++) {
+        int32_t xs = xs_ups + (xs_acc >> 8);
+        int32_t ys = ys_ups + (ys_acc >> 8);
+        xs_acc += xs_step;
+        ys_acc += ys_step;
+
+        int32_t xs_fract = xs & 0xFF;
+        int32_t ys_fract = ys & 0xFF;
+        int32_t x_next = xs_fract < 0x80 ? -1 : 1;
+        int32_t y_next = ys_fract < 0x80 ? -1 : 1;
+        xs_fract = (xs_fract < 0x80 ? 0x7F - xs_fract : xs_fract - 0x80) * 2;
+        ys_fract = (ys_fract < 0x80 ? 0x7F - ys_fract : ys_fract - 0x80) * 2;
+
+        int32_t ofs = (ys >> 8) * src_stride + (xs >> 8);
+        const uint16_t * src_px = src_rgb + ofs;
+        uint16_t c = src_px[0];
+        uint16_t px_hor = src_px[x_next];
+        uint16_t px_ver = src_px[y_next * src_stride];
+        cbuf[x] = c;
+
+        if(src_has_a8) {
+            const lv_opa_t * src_alpha_px = src_alpha + ofs;
+            lv_opa_t a = src_alpha_px[0];
+            lv_opa_t a_hor = src_alpha_px[x_next];
+            lv_opa_t a_ver = src_alpha_px[y_next * src_stride];
+
+            if(a_ver != a) a_ver = ((a_ver * ys_fract) + (a * (0x100 - ys_fract))) >> 8;
+            if(a_hor != a) a_hor = ((a_hor * xs_fract) + (a * (0x100 - xs_fract))) >> 8;
+            abuf[x] = (a_ver + a_hor) >> 1;
+
+            if(abuf[x] == 0x00) continue;
+        }
+        else {
+            abuf[x] = 0xff;
+        }
+
+        if(c != px_ver || c != px_hor) {
+            uint16_t v = lv_color_16_16_mix(px_ver, c, ys_fract);
+            uint16_t h = lv_color_16_16_mix(px_hor, c, xs_fract);
+            cbuf[x] = lv_color_16_16_mix(h, v, LV_OPA_50);
+        }
+    }
+}
+
+static void transform_a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                         int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                         int32_t x_end, uint8_t * abuf, bool aa)
+{
+    int32_t inner_start;
+    int32_t inner_end;
+    get_inner_span(xs_ups, ys_ups, xs_step, ys_step, x_end, src_w, src_h, aa, &inner_start, &inner_end);
+
+    transform_a8_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                      0, inner_start, abuf, aa);
+    transform_a8_edge(src, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step, ys_step,
+                      inner_end, x_end, abuf, aa);
+
+    int32_t xs_acc = xs_step * inner_start;
+    int32_t ys_acc = ys_step * inner_start;
+
+    lv_coord_t x;
+    for(x = inner_start; x < inner_end; x++) {
+        int32_t xs = xs_ups + (xs_acc >> 8);
+        int32_t ys = ys_ups + (ys_acc >> 8);
+        xs_acc += xs_step;
+        ys_acc += ys_step;
+
+        int32_t xs_fract = xs & 0xFF;
+        int32_t ys_fract = ys & 0xFF;
+        int32_t x_next = xs_fract < 0x80 ? -1 : 1;
+        int32_t y_next = ys_fract < 0x80 ? -1 : 1;
+        xs_fract = (xs_fract < 0x80 ? 0x7F - xs_fract : xs_fract - 0x80) * 2;
+        ys_fract = (ys_fract < 0x80 ? 0x7F - ys_fract : ys_fract - 0x80) * 2;
+
+        /*Mix the neighbours the same way as `transform_a8_edge` does*/
+        const uint8_t * src_px = src + (ys >> 8) * src_stride + (xs >> 8);
+        lv_opa_t a = src_px[0];
+        lv_opa_t a_ver = src_px[x_next];
+        lv_opa_t a_hor = src_px[y_next * src_stride];
+
+        if(a_ver != a) a_ver = ((a_ver * ys_fract) + (a * (0x100 - ys_fract))) >> 8;
+        if(a_hor != a) a_hor = ((a_hor * xs_fract) + (a * (0x100 - xs_fract))) >> 8;
+        abuf[x] = (a_ver + a_hor) >> 1;
+    }
+}
+
+static void tranform_rgb888_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                                 int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                 int32_t x_start, int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
     lv_coord_t x;
-    for(x = 0; x < x_end; x++) {
+    for(x = x_start; x < x_end; x++) {
         xs_ups = xs_ups_start + ((xs_step * x) >> 8);
         ys_ups = ys_ups_start + ((ys_step * x) >> 8);
 
@@ -284,9 +696,9 @@ static void tranform_rgb888(const uint8_t * src, lv_coord_t src_w, lv_coord_t sr
 
 #include "../../stdlib/lv_string.h"
 
-static void tranform_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
-                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
-                              int32_t x_end, uint8_t * dest_buf, bool aa)
+static void tranform_argb8888_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                                   int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                   int32_t x_start, int32_t x_end, uint8_t * dest_buf, bool aa, bool premultiplied)
 {
     //    lv_memzero(dest_buf, x_end * 4);
     int32_t xs_ups_start = xs_ups;
@@ -294,7 +706,7 @@ static void tranform_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
     lv_coord_t x;
-    for(x = 0; x < x_end; x++) {
+    for(x = x_start; x < x_end; x++) {
         xs_ups = xs_ups_start + ((xs_step * x) >> 8);
         ys_ups = ys_ups_start + ((ys_step * x) >> 8);
 
@@ -345,6 +757,12 @@ static void tranform_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t
             lv_color32_t px_hor = src_c32[x_next];
             lv_color32_t px_ver = src_c32[y_next * src_stride];
 
+            if(premultiplied) {
+                dest_c32[x] = premultiplied_mix(px_ver, dest_c32[x], ys_fract);
+                dest_c32[x] = premultiplied_mix(px_hor, dest_c32[x], xs_fract);
+                continue;
+            }
+
             if(px_ver.alpha == 0) {
                 dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - ys_fract)) >> 8;
             }
@@ -365,22 +783,50 @@ static void tranform_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t
         }
         /*Partially out of the image*/
         else {
+            int32_t fade;
             if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - xs_fract)) >> 7;
+                fade = 0x7F - xs_fract;
             }
             else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
-                dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - ys_fract)) >> 7;
+                fade = 0x7F - ys_fract;
             }
             else {
-                dest_c32[x].alpha = 0x00;
+                fade = 0;
             }
+
+            /*The color channels of the premultiplied pixels fade out together with the alpha*/
+            if(premultiplied) dest_c32[x] = premultiplied_fade(dest_c32[x], fade);
+            else dest_c32[x].alpha = (dest_c32[x].alpha * fade) >> 7;
         }
     }
 }
 
-static void transform_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
-                               int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
-                               int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, bool aa)
+static inline lv_color32_t premultiplied_mix(lv_color32_t fg, lv_color32_t bg, int32_t mix)
+{
+    if(lv_color32_eq(fg, bg)) return bg;
+
+    int32_t mix_inv = 0xFF - mix;
+    lv_color32_t ret;
+    ret.red = (fg.red * mix + bg.red * mix_inv) >> 8;
+    ret.green = (fg.green * mix + bg.green * mix_inv) >> 8;
+    ret.blue = (fg.blue * mix + bg.blue * mix_inv) >> 8;
+    ret.alpha = (fg.alpha * mix + bg.alpha * mix_inv) >> 8;
+    return ret;
+}
+
+static inline lv_color32_t premultiplied_fade(lv_color32_t c, int32_t fade)
+{
+    c.red = (c.red * fade) >> 7;
+    c.green = (c.green * fade) >> 7;
+    c.blue = (c.blue * fade) >> 7;
+    c.alpha = (c.alpha * fade) >> 7;
+    return c;
+}
+
+static void transform_rgb565a8_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                                    int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                    int32_t x_start, int32_t x_end, uint16_t * cbuf, uint8_t * abuf, bool src_has_a8,
+                                    bool aa)
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
@@ -389,7 +835,7 @@ static void transform_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t
     const lv_opa_t * src_alpha = src + src_stride * src_h * 2;
 
     lv_coord_t x;
-    for(x = 0; x < x_end; x++) {
+    for(x = x_start; x < x_end; x++) {
         xs_ups = xs_ups_start + ((xs_step * x) >> 8);
         ys_ups = ys_ups_start + ((ys_step * x) >> 8);
 
@@ -489,15 +935,15 @@ static void transform_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t
     }
 }
 
-static void transform_a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
-                         int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
-                         int32_t x_end, uint8_t * abuf, bool aa)
+static void transform_a8_edge(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                              int32_t x_start, int32_t x_end, uint8_t * abuf, bool aa)
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
 
     lv_coord_t x;
-    for(x = 0; x < x_end; x++) {
+    for(x = x_start; x < x_end; x++) {
         xs_ups = xs_ups_start + ((xs_step * x) >> 8);
         ys_ups = ys_ups_start + ((ys_step * x) >> 8);
 
@@ -567,6 +1013,555 @@ static void transform_a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h
 }
 
 
+static void transform_scale(const lv_area_t * dest_area, const void * src_buf, lv_coord_t src_w, lv_coord_t src_h,
+                            lv_coord_t src_stride, const lv_draw_image_dsc_t * draw_dsc, lv_color_format_t src_cf,
+                            uint8_t * dest_buf, lv_coord_t dest_stride, uint8_t * alpha_buf, lv_coord_t dest_stride_a8)
+{
+    int32_t step = (256 * 256) / draw_dsc->zoom;
+
+    scale_mode_t mode;
+    if(!draw_dsc->antialias) mode = SCALE_MODE_NEAREST;
+    else if(draw_dsc->zoom < LV_SCALE_NONE / 2) mode = SCALE_MODE_BOX;
+    else mode = SCALE_MODE_BILINEAR;
+
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_coord_t dest_h = lv_area_get_height(dest_area);
+
+    scale_coord_t * cols = lv_malloc(dest_w * sizeof(scale_coord_t));
+    LV_ASSERT_MALLOC(cols);
+    if(cols == NULL) return;
+
+    /*Same as `transform_point_upscaled` with the `+0x80` to sample the middle of the pixels*/
+    int32_t xs_ups = (dest_area->x1 - draw_dsc->pivot.x) * step + draw_dsc->pivot.x * 256 + 0x80;
+    int32_t ys_ups = (dest_area->y1 - draw_dsc->pivot.y) * step + draw_dsc->pivot.y * 256 + 0x80;
+
+    lv_coord_t x;
+    for(x = 0; x < dest_w; x++) {
+        scale_coord_init(&cols[x], xs_ups + x * step, step, src_w, mode);
+    }
+
+    /*The columns are monotonic so the ones whose neighbour is also on the image form a single span*/
+    int32_t inner_start = 0;
+    while(inner_start < dest_w && !cols[inner_start].inner) inner_start++;
+    int32_t inner_end = inner_start;
+    while(inner_end < dest_w && cols[inner_end].inner) inner_end++;
+
+    lv_coord_t y;
+    for(y = 0; y < dest_h; y++) {
+        scale_coord_t row;
+        scale_coord_init(&row, ys_ups + y * step, step, src_h, mode);
+
+        switch(src_cf) {
+            case LV_COLOR_FORMAT_XRGB8888:
+                scale_rgb888(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                             (lv_color32_t *)dest_buf, mode, 4);
+                break;
+            case LV_COLOR_FORMAT_RGB888:
+                scale_rgb888(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                             (lv_color32_t *)dest_buf, mode, 3);
+                break;
+            case LV_COLOR_FORMAT_A8:
+                scale_a8(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                         dest_buf, mode);
+                break;
+            case LV_COLOR_FORMAT_ARGB8888:
+                scale_argb8888(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                               (lv_color32_t *)dest_buf, mode, false);
+                break;
+            case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+                scale_argb8888(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                               (lv_color32_t *)dest_buf, mode, true);
+                break;
+            case LV_COLOR_FORMAT_RGB565:
+                scale_rgb565a8(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                               (uint16_t *)dest_buf, alpha_buf, false, mode);
+                break;
+            case LV_COLOR_FORMAT_RGB565A8:
+                scale_rgb565a8(src_buf, src_w, src_h, src_stride, cols, &row, step, inner_start, inner_end, dest_w,
+                               (uint16_t *)dest_buf, alpha_buf, true, mode);
+                break;
+            default:
+                break;
+        }
+
+        dest_buf += dest_stride;
+        if(alpha_buf) alpha_buf += dest_stride_a8;
+    }
+
+    lv_free(cols);
+}
+
+static void scale_coord_init(scale_coord_t * c, int32_t ups, int32_t step, lv_coord_t size, scale_mode_t mode)
+{
+    c->ups = ups;
+    c->pos = ups >> 8;
+
+    int32_t fract = ups & 0xFF;
+    if(fract < 0x80) {
+        c->next = -1;
+        c->fract = 0x7F - fract;
+    }
+    else {
+        c->next = 1;
+        c->fract = fract - 0x80;
+    }
+
+    c->inner = c->pos >= 0 && c->pos < size && c->pos + c->next >= 0 && c->pos + c->next < size;
+
+    if(mode == SCALE_MODE_BOX) {
+        /*The destination pixel covers `step` upscaled source coordinates around its middle*/
+        int32_t first = (ups - step / 2) >> 8;
+        int32_t last = (ups + step / 2 - 1) >> 8;
+        c->box_full = last - first + 1;
+        if(first < 0) first = 0;
+        if(last > size - 1) last = size - 1;
+        c->box_start = first;
+        c->box_cnt = last >= first ? last - first + 1 : 0;
+    }
+}
+
+static void scale_rgb888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                         const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                         int32_t inner_start, int32_t inner_end, int32_t x_end,
+                         lv_color32_t * dest_c32, scale_mode_t mode, uint32_t px_size)
+{
+    int32_t line_size = src_stride * (int32_t)px_size;
+    int32_t x;
+
+    if(mode == SCALE_MODE_NEAREST) {
+        bool row_in = row->pos >= 0 && row->pos < src_h;
+        const uint8_t * src_row = src + row->pos * line_size;
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(!row_in || col->pos < 0 || col->pos >= src_w) {
+                dest_c32[x].alpha = 0x00;
+                continue;
+            }
+
+            const uint8_t * src_u8 = src_row + col->pos * (int32_t)px_size;
+            dest_c32[x].red = src_u8[2];
+            dest_c32[x].green = src_u8[1];
+            dest_c32[x].blue = src_u8[0];
+            dest_c32[x].alpha = 0xff;
+        }
+    }
+    else if(mode == SCALE_MODE_BOX) {
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(row->box_cnt == 0 || col->box_cnt == 0) {
+                dest_c32[x].alpha = 0x00;
+                continue;
+            }
+
+            uint32_t r = 0;
+            uint32_t g = 0;
+            uint32_t b = 0;
+            const uint8_t * src_line = src + row->box_start * line_size + col->box_start * (int32_t)px_size;
+            int32_t yi;
+            for(yi = 0; yi < row->box_cnt; yi++) {
+                const uint8_t * src_u8 = src_line;
+                int32_t xi;
+                for(xi = 0; xi < col->box_cnt; xi++) {
+                    b += src_u8[0];
+                    g += src_u8[1];
+                    r += src_u8[2];
+                    src_u8 += px_size;
+                }
+                src_line += line_size;
+            }
+
+            /*The pixels out of the image are transparent*/
+            uint32_t cnt = col->box_cnt * row->box_cnt;
+            dest_c32[x].red = r / cnt;
+            dest_c32[x].green = g / cnt;
+            dest_c32[x].blue = b / cnt;
+            dest_c32[x].alpha = (0xFF * cnt) / (col->box_full * row->box_full);
+        }
+    }
+    else {
+        /*Let the generic function handle the edges of the image*/
+        if(!row->inner) {
+            inner_start = x_end;
+            inner_end = x_end;
+        }
+        if(inner_start > 0) {
+            tranform_rgb888_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                                 0, inner_start, (uint8_t *)dest_c32, true, px_size);
+        }
+        if(inner_end < x_end) {
+            tranform_rgb888_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                                 inner_end, x_end, (uint8_t *)dest_c32, true, px_size);
+        }
+
+        const uint8_t * src_row = src + row->pos * line_size;
+        int32_t ver_ofs = row->next * line_size;
+        int32_t ys_fract = row->fract;
+        for(x = inner_start; x < inner_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            const uint8_t * src_u8 = src_row + col->pos * (int32_t)px_size;
+
+            lv_color32_t c;
+            c.red = src_u8[2];
+            c.green = src_u8[1];
+            c.blue = src_u8[0];
+            c.alpha = 0xff;
+
+            const uint8_t * px_ver_u8 = src_u8 + ver_ofs;
+            lv_color32_t px_ver;
+            px_ver.red = px_ver_u8[2];
+            px_ver.green = px_ver_u8[1];
+            px_ver.blue = px_ver_u8[0];
+            px_ver.alpha = 0xff;
+
+            const uint8_t * px_hor_u8 = src_u8 + col->next * (int32_t)px_size;
+            lv_color32_t px_hor;
+            px_hor.red = px_hor_u8[2];
+            px_hor.green = px_hor_u8[1];
+            px_hor.blue = px_hor_u8[0];
+            px_hor.alpha = 0xff;
+
+            if(!lv_color32_eq(c, px_ver)) {
+                px_ver.alpha = ys_fract;
+                c = lv_color_mix32(px_ver, c);
+            }
+
+            if(!lv_color32_eq(c, px_hor)) {
+                px_hor.alpha = col->fract;
+                c = lv_color_mix32(px_hor, c);
+            }
+
+            dest_c32[x] = c;
+        }
+    }
+}
+
+static void scale_argb8888(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                           const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                           int32_t inner_start, int32_t inner_end, int32_t x_end,
+                           lv_color32_t * dest_c32, scale_mode_t mode, bool premultiplied)
+{
+    const lv_color32_t * src_c32 = (const lv_color32_t *)src;
+    int32_t x;
+
+    if(mode == SCALE_MODE_NEAREST) {
+        bool row_in = row->pos >= 0 && row->pos < src_h;
+        const lv_color32_t * src_row = src_c32 + row->pos * src_stride;
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(!row_in || col->pos < 0 || col->pos >= src_w) {
+                ((uint32_t *)dest_c32)[x] = 0x00000000;
+                continue;
+            }
+
+            dest_c32[x] = src_row[col->pos];
+        }
+    }
+    else if(mode == SCALE_MODE_BOX) {
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(row->box_cnt == 0 || col->box_cnt == 0) {
+                ((uint32_t *)dest_c32)[x] = 0x00000000;
+                continue;
+            }
+
+            /*Weight the colors with their opacity to not mix the color of the transparent pixels.
+             *The premultiplied colors are already weighted.*/
+            uint32_t r = 0;
+            uint32_t g = 0;
+            uint32_t b = 0;
+            uint32_t a = 0;
+            const lv_color32_t * src_line = src_c32 + row->box_start * src_stride + col->box_start;
+            int32_t yi;
+            for(yi = 0; yi < row->box_cnt; yi++) {
+                int32_t xi;
+                if(premultiplied) {
+                    for(xi = 0; xi < col->box_cnt; xi++) {
+                        lv_color32_t px = src_line[xi];
+                        r += px.red;
+                        g += px.green;
+                        b += px.blue;
+                        a += px.alpha;
+                    }
+                }
+                else {
+                    for(xi = 0; xi < col->box_cnt; xi++) {
+                        lv_color32_t px = src_line[xi];
+                        r += px.red * px.alpha;
+                        g += px.green * px.alpha;
+                        b += px.blue * px.alpha;
+                        a += px.alpha;
+                    }
+                }
+                src_line += src_stride;
+            }
+
+            if(premultiplied) {
+                uint32_t cnt_full = col->box_full * row->box_full;
+                dest_c32[x].red = r / cnt_full;
+                dest_c32[x].green = g / cnt_full;
+                dest_c32[x].blue = b / cnt_full;
+                dest_c32[x].alpha = a / cnt_full;
+                continue;
+            }
+
+            if(a == 0) {
+                ((uint32_t *)dest_c32)[x] = 0x00000000;
+                continue;
+            }
+
+            dest_c32[x].red = r / a;
+            dest_c32[x].green = g / a;
+            dest_c32[x].blue = b / a;
+            dest_c32[x].alpha = a / (col->box_full * row->box_full);
+        }
+    }
+    else {
+        /*Let the generic function handle the edges of the image*/
+        if(!row->inner) {
+            inner_start = x_end;
+            inner_end = x_end;
+        }
+        if(inner_start > 0) {
+            tranform_argb8888_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                                   0, inner_start, (uint8_t *)dest_c32, true, premultiplied);
+        }
+        if(inner_end < x_end) {
+            tranform_argb8888_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                                   inner_end, x_end, (uint8_t *)dest_c32, true, premultiplied);
+        }
+
+        const lv_color32_t * src_row = src_c32 + row->pos * src_stride;
+        int32_t ver_ofs = row->next * src_stride;
+        int32_t ys_fract = row->fract;
+        for(x = inner_start; x < inner_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            int32_t xs_fract = col->fract;
+            const lv_color32_t * src_px = src_row + col->pos;
+
+            lv_color32_t c = src_px[0];
+            lv_color32_t px_hor = src_px[col->next];
+            lv_color32_t px_ver = src_px[ver_ofs];
+
+            if(premultiplied) {
+                c = premultiplied_mix(px_ver, c, ys_fract);
+                dest_c32[x] = premultiplied_mix(px_hor, c, xs_fract);
+                continue;
+            }
+
+            if(px_ver.alpha == 0) {
+                c.alpha = (c.alpha * (0xFF - ys_fract)) >> 8;
+            }
+            else if(!lv_color32_eq(c, px_ver)) {
+                c.alpha = ((px_ver.alpha * ys_fract) + (c.alpha * (0xFF - ys_fract))) >> 8;
+                px_ver.alpha = ys_fract;
+                c = lv_color_mix32(px_ver, c);
+            }
+
+            if(px_hor.alpha == 0) {
+                c.alpha = (c.alpha * (0xFF - xs_fract)) >> 8;
+            }
+            else if(!lv_color32_eq(c, px_hor)) {
+                c.alpha = ((px_hor.alpha * xs_fract) + (c.alpha * (0xFF - xs_fract))) >> 8;
+                px_hor.alpha = xs_fract;
+                c = lv_color_mix32(px_hor, c);
+            }
+
+            dest_c32[x] = c;
+        }
+    }
+}
+
+static void scale_rgb565a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                           const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                           int32_t inner_start, int32_t inner_end, int32_t x_end,
+                           uint16_t * cbuf, uint8_t * abuf, bool src_has_a8, scale_mode_t mode)
+{
+    const uint16_t * src_rgb = (const uint16_t *)src;
+    const lv_opa_t * src_alpha = src + src_stride * src_h * 2;
+    int32_t x;
+
+    if(mode == SCALE_MODE_NEAREST) {
+        bool row_in = row->pos >= 0 && row->pos < src_h;
+        const uint16_t * src_row = src_rgb + row->pos * src_stride;
+        const lv_opa_t * src_alpha_row = src_alpha + row->pos * src_stride;
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(!row_in || col->pos < 0 || col->pos >= src_w) {
+                abuf[x] = 0x00;
+                continue;
+            }
+
+            cbuf[x] = src_row[col->pos];
+            abuf[x] = src_has_a8 ? src_alpha_row[col->pos] : 0xff;
+        }
+    }
+    else if(mode == SCALE_MODE_BOX) {
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(row->box_cnt == 0 || col->box_cnt == 0) {
+                abuf[x] = 0x00;
+                continue;
+            }
+
+            uint32_t r = 0;
+            uint32_t g = 0;
+            uint32_t b = 0;
+            uint32_t a = 0;
+            int32_t ofs = row->box_start * src_stride + col->box_start;
+            int32_t yi;
+            for(yi = 0; yi < row->box_cnt; yi++) {
+                int32_t xi;
+                for(xi = 0; xi < col->box_cnt; xi++) {
+                    uint16_t px = src_rgb[ofs + xi];
+                    uint32_t px_a = src_has_a8 ? src_alpha[ofs + xi] : 0xff;
+                    r += (px >> 11) * px_a;
+                    g += ((px >> 5) & 0x3F) * px_a;
+                    b += (px & 0x1F) * px_a;
+                    a += px_a;
+                }
+                ofs += src_stride;
+            }
+
+            if(a == 0) {
+                abuf[x] = 0x00;
+                continue;
+            }
+
+            cbuf[x] = ((r / a) << 11) | ((g / a) << 5) | (b / a);
+            abuf[x] = a / (col->box_full * row->box_full);
+        }
+    }
+    else {
+        /*Let the generic function handle the edges of the image*/
+        if(!row->inner) {
+            inner_start = x_end;
+            inner_end = x_end;
+        }
+        if(inner_start > 0) {
+            transform_rgb565a8_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                                    0, inner_start, cbuf, abuf, src_has_a8, true);
+        }
+        if(inner_end < x_end) {
+            transform_rgb565a8_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                                    inner_end, x_end, cbuf, abuf, src_has_a8, true);
+        }
+
+        const uint16_t * src_row = src_rgb + row->pos * src_stride;
+        const lv_opa_t * src_alpha_row = src_alpha + row->pos * src_stride;
+        int32_t ver_ofs = row->next * src_stride;
+        int32_t ys_fract = row->fract * 2;
+        for(x = inner_start; x < inner_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            int32_t xs_fract = col->fract * 2;
+            const uint16_t * src_px = src_row + col->pos;
+
+            uint16_t c = src_px[0];
+            uint16_t px_hor = src_px[col->next];
+            uint16_t px_ver = src_px[ver_ofs];
+            cbuf[x] = c;
+
+            if(src_has_a8) {
+                const lv_opa_t * src_alpha_px = src_alpha_row + col->pos;
+                lv_opa_t a = src_alpha_px[0];
+                lv_opa_t a_hor = src_alpha_px[col->next];
+                lv_opa_t a_ver = src_alpha_px[ver_ofs];
+
+                if(a_ver != a) a_ver = ((a_ver * ys_fract) + (a * (0x100 - ys_fract))) >> 8;
+                if(a_hor != a) a_hor = ((a_hor * xs_fract) + (a * (0x100 - xs_fract))) >> 8;
+                abuf[x] = (a_ver + a_hor) >> 1;
+
+                if(abuf[x] == 0x00) continue;
+            }
+            else {
+                abuf[x] = 0xff;
+            }
+
+            if(c != px_ver || c != px_hor) {
+                uint16_t v = lv_color_16_16_mix(px_ver, c, ys_fract);
+                uint16_t h = lv_color_16_16_mix(px_hor, c, xs_fract);
+                cbuf[x] = lv_color_16_16_mix(h, v, LV_OPA_50);
+            }
+        }
+    }
+}
+
+static void scale_a8(const uint8_t * src, lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
+                     const scale_coord_t * cols, const scale_coord_t * row, int32_t step,
+                     int32_t inner_start, int32_t inner_end, int32_t x_end,
+                     uint8_t * abuf, scale_mode_t mode)
+{
+    int32_t x;
+
+    if(mode == SCALE_MODE_NEAREST) {
+        bool row_in = row->pos >= 0 && row->pos < src_h;
+        const uint8_t * src_row = src + row->pos * src_stride;
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(!row_in || col->pos < 0 || col->pos >= src_w) {
+                abuf[x] = 0x00;
+                continue;
+            }
+
+            abuf[x] = src_row[col->pos];
+        }
+    }
+    else if(mode == SCALE_MODE_BOX) {
+        for(x = 0; x < x_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            if(row->box_cnt == 0 || col->box_cnt == 0) {
+                abuf[x] = 0x00;
+                continue;
+            }
+
+            uint32_t a = 0;
+            const uint8_t * src_line = src + row->box_start * src_stride + col->box_start;
+            int32_t yi;
+            for(yi = 0; yi < row->box_cnt; yi++) {
+                int32_t xi;
+                for(xi = 0; xi < col->box_cnt; xi++) {
+                    a += src_line[xi];
+                }
+                src_line += src_stride;
+            }
+
+            abuf[x] = a / (col->box_full * row->box_full);
+        }
+    }
+    else {
+        /*Let the generic function handle the edges of the image*/
+        if(!row->inner) {
+            inner_start = x_end;
+            inner_end = x_end;
+        }
+        if(inner_start > 0) {
+            transform_a8_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                              0, inner_start, abuf, true);
+        }
+        if(inner_end < x_end) {
+            transform_a8_edge(src, src_w, src_h, src_stride, cols[0].ups, row->ups, step * 256, 0,
+                              inner_end, x_end, abuf, true);
+        }
+
+        /*Mix the neighbours the same way as `transform_a8` does*/
+        const uint8_t * src_row = src + row->pos * src_stride;
+        int32_t ver_ofs = row->next * src_stride;
+        int32_t ys_fract = row->fract * 2;
+        for(x = inner_start; x < inner_end; x++) {
+            const scale_coord_t * col = &cols[x];
+            int32_t xs_fract = col->fract * 2;
+            const uint8_t * src_px = src_row + col->pos;
+
+            lv_opa_t a = src_px[0];
+            lv_opa_t a_ver = src_px[col->next];
+            lv_opa_t a_hor = src_px[ver_ofs];
+
+            if(a_ver != a) a_ver = ((a_ver * ys_fract) + (a * (0x100 - ys_fract))) >> 8;
+            if(a_hor != a) a_hor = ((a_hor * xs_fract) + (a * (0x100 - xs_fract))) >> 8;
+            abuf[x] = (a_ver + a_hor) >> 1;
+        }
+    }
+}
+
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout)
 {
@@ -10,12 +10,14 @@
 #if LV_USE_DRAW_SW
 
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_mem.h"
 #include "../../misc/lv_area.h"
 #include "../../misc/lv_color.h"
 #include "../../stdlib/lv_string.h"
 #include "../lv_draw_triangle.h"
 #include "lv_draw_sw_gradient.h"
+#include "lv_draw_sw_raster.h"
 
 /*********************
  *      DEFINES
@@ -55,78 +57,35 @@ void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_
     is_common = _lv_area_intersect(&draw_area, &tri_area, draw_unit->clip_area);
     if(!is_common) return;
 
-    lv_point_t p[3];
-    p[0] = dsc->p[0];
-    p[1] = dsc->p[1];
-    p[2] = dsc->p[2];
-
-    /*Order the points like this:
-     * [0]: left bottom
-     * [1]: top
-     * [2]: right bottom*/
-
-
-    if(dsc->p[0].y <= dsc->p[1].y && dsc->p[0].y <= dsc->p[2].y) {
-        p[1] = dsc->p[0];
-        if(dsc->p[1].x < dsc->p[2].x) {
-            p[0] = dsc->p[1];
-            p[2] = dsc->p[2];
-        }
-        else {
-            p[0] = dsc->p[2];
-            p[2] = dsc->p[1];
-        }
+    /*Rasterize the triangle with analytic coverage. The order of the points doesn't matter.
+     *The points are pixel centers, the same as the points of the paths, so the pixels of the vertices
+     *are in `tri_area`. The edge pixels get their exact covered area as opacity.
+     *The 3 line masks used before were anti-aliased separately, so they rendered the edges
+     *and the corners slightly differently.*/
+    lv_draw_sw_raster_t raster;
+    lv_draw_sw_raster_init(&raster);
+    uint32_t p_i;
+    for(p_i = 0; p_i < 3; p_i++) {
+        const lv_point_t * p1 = &dsc->p[p_i];
+        const lv_point_t * p2 = &dsc->p[p_i < 2 ? p_i + 1 : 0];
+        lv_draw_sw_raster_add_edge(&raster,
+                                   LV_DRAW_SW_RASTER_SUBPX_CENTER(p1->x), LV_DRAW_SW_RASTER_SUBPX_CENTER(p1->y),
+                                   LV_DRAW_SW_RASTER_SUBPX_CENTER(p2->x), LV_DRAW_SW_RASTER_SUBPX_CENTER(p2->y));
     }
-    else if(dsc->p[1].y <= dsc->p[0].y && dsc->p[1].y <= dsc->p[2].y) {
-        p[1] = dsc->p[1];
-        if(dsc->p[0].x < dsc->p[2].x) {
-            p[0] = dsc->p[0];
-            p[2] = dsc->p[2];
-        }
-        else {
-            p[0] = dsc->p[2];
-            p[2] = dsc->p[0];
-        }
-    }
-    else {
-        p[1] = dsc->p[2];
-        if(dsc->p[0].x < dsc->p[1].x) {
-            p[0] = dsc->p[0];
-            p[2] = dsc->p[1];
-        }
-        else {
-            p[0] = dsc->p[1];
-            p[2] = dsc->p[0];
-        }
-    }
-
-    void * masks[4] = {0};
-    lv_draw_sw_mask_line_param_t mask_left;
-    lv_draw_sw_mask_line_param_t mask_right;
-    lv_draw_sw_mask_line_param_t mask_bottom;
-
+    lv_draw_sw_raster_start(&raster, &draw_area, LV_DRAW_SW_RASTER_FILL_NONZERO);
 
-    lv_draw_sw_mask_line_points_init(&mask_left, p[1].x, p[1].y,
-                                     p[0].x, p[0].y,
-                                     LV_DRAW_SW_MASK_LINE_SIDE_RIGHT);
-
-    lv_draw_sw_mask_line_points_init(&mask_right, p[1].x, p[1].y,
-                                     p[2].x, p[2].y,
-                                     LV_DRAW_SW_MASK_LINE_SIDE_LEFT);
-
-    lv_draw_sw_mask_line_points_init(&mask_bottom, p[0].x, p[0].y,
-                                     p[2].x, p[2].y,
-                                     LV_DRAW_SW_MASK_LINE_SIDE_TOP);
-
-    masks[0] = &mask_left;
-    masks[1] = &mask_right;
-    masks[2] = &mask_bottom;
     lv_coord_t area_w = lv_area_get_width(&draw_area);
     lv_opa_t * mask_buf = lv_malloc(area_w);
+    LV_ASSERT_MALLOC(mask_buf);
+    if(mask_buf == NULL) {
+        lv_draw_sw_raster_deinit(&raster);
+        return;
+    }
 
     lv_area_t blend_area = draw_area;
     blend_area.y2 = blend_area.y1;
     lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
     blend_dsc.color = dsc->bg_color;
     blend_dsc.opa = dsc->bg_opa;
     blend_dsc.mask_buf = mask_buf;
@@ -151,8 +110,7 @@ void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
         blend_area.y1 = y;
         blend_area.y2 = y;
-        lv_memset(mask_buf, 0xff, area_w);
-        blend_dsc.mask_res = lv_draw_sw_mask_apply(masks, mask_buf, draw_area.x1, y, area_w);
+        blend_dsc.mask_res = lv_draw_sw_raster_get_line(&raster, y, mask_buf);
         if(grad_dir == LV_GRAD_DIR_VER) {
             blend_dsc.color = grad->color_map[y - tri_area.y1];
             blend_dsc.opa = grad->opa_map[y - tri_area.y1];
@@ -180,9 +138,7 @@ void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_
     }
 
     lv_free(mask_buf);
-    lv_draw_sw_mask_free_param(&mask_bottom);
-    lv_draw_sw_mask_free_param(&mask_left);
-    lv_draw_sw_mask_free_param(&mask_right);
+    lv_draw_sw_raster_deinit(&raster);
 
     if(grad) {
         lv_gradient_cleanup(grad);
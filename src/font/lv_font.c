@@ -8,6 +8,9 @@
  *********************/
 
 #include "lv_font.h"
+#include "lv_font_fmt_txt.h"
+#include "lv_font_glyph_cache.h"
+#include "../core/lv_global.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_assert.h"
@@ -15,6 +18,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define invalidate_cb_ll LV_GLOBAL_DEFAULT()->font_invalidate_cb_ll
 
 /**********************
  *      TYPEDEFS
@@ -119,6 +123,68 @@ uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32
     return g.adv_w;
 }
 
+void lv_font_get_glyph_widths(const lv_font_t * font, const uint32_t * letters, uint32_t cnt, uint16_t * widths)
+{
+    LV_ASSERT_NULL(font);
+
+    /*Most fonts are in the built-in format which can measure the letters in one go.
+     *Only the letters it doesn't have need to be searched in the fallback fonts.*/
+    bool fmt_txt = font->get_glyph_dsc == lv_font_get_glyph_dsc_fmt_txt;
+    if(fmt_txt && lv_font_get_glyph_widths_fmt_txt(font, letters, cnt, widths)) return;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(fmt_txt && widths[i] != UINT16_MAX) continue;
+        widths[i] = lv_font_get_glyph_width(font, letters[i], letters[i + 1]);
+    }
+}
+
+void lv_font_prefetch(const lv_font_t * font_p, const char * txt)
+{
+    LV_ASSERT_NULL(font_p);
+    if(txt == NULL || txt[0] == '\0') return;
+
+    const lv_font_t * f;
+    for(f = font_p; f; f = f->fallback) {
+        if(f->prefetch_cb) f->prefetch_cb(f, txt);
+    }
+}
+
+void lv_font_invalidate(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_glyph_cache_invalidate_font(font);
+
+    lv_font_invalidate_cb_t * cb;
+    _LV_LL_READ(&invalidate_cb_ll, cb) {
+        (*cb)(font);
+    }
+}
+
+void lv_font_add_invalidate_cb(lv_font_invalidate_cb_t cb)
+{
+    LV_ASSERT_NULL(cb);
+
+    lv_font_invalidate_cb_t * new_cb = _lv_ll_ins_tail(&invalidate_cb_ll);
+    LV_ASSERT_MALLOC(new_cb);
+    if(new_cb == NULL) return;
+
+    *new_cb = cb;
+}
+
+void lv_font_remove_invalidate_cb(lv_font_invalidate_cb_t cb)
+{
+    lv_font_invalidate_cb_t * cb_act;
+    _LV_LL_READ(&invalidate_cb_ll, cb_act) {
+        if(*cb_act == cb) {
+            _lv_ll_remove(&invalidate_cb_ll, cb_act);
+            lv_free(cb_act);
+            return;
+        }
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -42,7 +42,7 @@ typedef struct {
     const struct _lv_font_t *
         resolved_font; /**< Pointer to a font where the glyph was actually found after handling fallbacks*/
     uint16_t adv_w; /**< The glyph needs this space. Draw the next glyph after this width.*/
-    uint16_t box_w; /**< Width of the glyph's bounding box*/
+    uint16_t box_w; /**< Width of the glyph's bounding box. In subpixels (3 per pixel) with `LV_FONT_SUBPX_HOR`*/
     uint16_t box_h; /**< Height of the glyph's bounding box*/
     int16_t ofs_x;  /**< x offset of the bounding box*/
     int16_t ofs_y;  /**< y offset of the bounding box*/
@@ -50,7 +50,10 @@ typedef struct {
     uint8_t is_placeholder: 1; /** Glyph is missing. But placeholder will still be displayed */
 } lv_font_glyph_dsc_t;
 
-/** The bitmaps might be upscaled by 3 to achieve subpixel rendering.*/
+/**
+ * The bitmaps might be upscaled by 3 to achieve subpixel rendering.
+ * With `LV_FONT_SUBPX_HOR` the bitmaps have 3 coverage values per pixel and `box_w` is a multiple of 3.
+ */
 enum _lv_font_subpx_t {
     LV_FONT_SUBPX_NONE,
     LV_FONT_SUBPX_HOR,
@@ -72,6 +75,9 @@ typedef struct _lv_font_t {
     /** Get a glyph's bitmap from a font*/
     const uint8_t * (*get_glyph_bitmap)(const struct _lv_font_t *, uint32_t, uint8_t *);
 
+    /** Optional: prepare the glyphs of a text to be drawn, e.g. read them from a file*/
+    void (*prefetch_cb)(const struct _lv_font_t *, const char * txt);
+
     /*Pointer to the font in a font pack (must have the same line height)*/
     lv_coord_t line_height;         /**< The real line height where any text fits*/
     lv_coord_t base_line;           /**< Base line measured from the top of the line_height*/
@@ -85,6 +91,11 @@ typedef struct _lv_font_t {
     void * user_data;               /**< Custom user data for font.*/
 } lv_font_t;
 
+/**
+ * Called by `lv_font_invalidate` to drop the data cached for a font
+ */
+typedef void (*lv_font_invalidate_cb_t)(const lv_font_t * font);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -118,6 +129,42 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out
  */
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next);
 
+/**
+ * Get the width of more glyphs with kerning at once. Faster than calling `lv_font_get_glyph_width` for each letter.
+ * @param font          pointer to a font
+ * @param letters       `cnt + 1` UNICODE letters. The last one is the letter after the run, used only for kerning.
+ * @param cnt           number of widths to get
+ * @param widths        store the width of the glyphs here (`cnt` items)
+ */
+void lv_font_get_glyph_widths(const lv_font_t * font, const uint32_t * letters, uint32_t cnt, uint16_t * widths);
+
+/**
+ * Prepare the glyphs of a text to be drawn. It's called when the text of a label is set.
+ * Only fonts which load the glyphs on demand need to do something (see `prefetch_cb`).
+ * @param font_p        pointer to a font. The fallback fonts are prefetched too.
+ * @param txt           the text to draw
+ */
+void lv_font_prefetch(const lv_font_t * font_p, const char * txt);
+
+/**
+ * Tell the caches that the glyphs of a font changed or the font is about to be freed.
+ * The font engines need to call it when they change the size or rendering of a font and before freeing it.
+ * @param font          pointer to a font. The cached data of the fonts which use it as fallback is dropped too.
+ */
+void lv_font_invalidate(const lv_font_t * font);
+
+/**
+ * Register a callback to drop the data cached for the invalidated fonts, e.g. by a renderer
+ * @param cb            the callback to call in `lv_font_invalidate`
+ */
+void lv_font_add_invalidate_cb(lv_font_invalidate_cb_t cb);
+
+/**
+ * Remove a callback registered by `lv_font_add_invalidate_cb`
+ * @param cb            the callback to remove
+ */
+void lv_font_remove_invalidate_cb(lv_font_invalidate_cb_t cb);
+
 /**
  * Get the line height of a font. All characters fit into this height
  * @param font      pointer to a font
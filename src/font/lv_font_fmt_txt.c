@@ -12,8 +12,10 @@
 #include "../misc/lv_assert.h"
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
+#include "../misc/lv_math.h"
 #include "../misc/lv_utils.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +24,30 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    #define lut_state LV_GLOBAL_DEFAULT()->font_fmt_txt_lut
+
+    /*Min. and max. number of slots of the glyph ID cache.
+     *With at least 32 slots the rest of a letter (max. 21 bits) fits into the upper 16 bits of a slot.*/
+    #define LUT_CMAP_SLOT_MIN   32
+    #define LUT_CMAP_SLOT_MAX   1024
+
+    /*Marks the entries of the freed tables. They can be reused but don't end the search like the unused entries.*/
+    #define LUT_FONT_REMOVED    ((const lv_font_fmt_txt_dsc_t *)&lut_state.none)
+
+    /*The tables are published for the readers only when they are complete*/
+    #if defined(__GNUC__)
+        #define LUT_STORE(dst, val) __atomic_store_n(&(dst), (val), __ATOMIC_RELEASE)
+        #define LUT_LOAD(src)       __atomic_load_n(&(src), __ATOMIC_ACQUIRE)
+        #define LUT_LOCK_FREE       1
+    #else
+        #define LUT_STORE(dst, val) (dst) = (val)
+        #define LUT_LOAD(src)       (src)
+        /*Without atomics the readers need the mutex too if there can be other threads*/
+        #define LUT_LOCK_FREE       (LV_USE_OS == LV_OS_NONE)
+    #endif
+#endif /*LV_FONT_FMT_TXT_LUT_SIZE > 0*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -29,8 +55,12 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
-static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, const _lv_font_fmt_txt_lut_t * lut, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+static int8_t get_kern_value(const lv_font_t * font, const _lv_font_fmt_txt_lut_t * lut, uint32_t gid_left,
+                             uint32_t gid_right);
+static inline const _lv_font_fmt_txt_lut_t * lut_get(const lv_font_fmt_txt_dsc_t * fdsc);
+static inline uint32_t get_hash(uint32_t key);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
@@ -43,6 +73,19 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
     static inline uint8_t rle_next(void);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    static const _lv_font_fmt_txt_lut_t * lut_find(const lv_font_fmt_txt_dsc_t * fdsc);
+    static const _lv_font_fmt_txt_lut_t * lut_create(const lv_font_fmt_txt_dsc_t * fdsc);
+    static _lv_font_fmt_txt_lut_t * lut_build(const lv_font_fmt_txt_dsc_t * fdsc);
+    static uint32_t lut_get_glyph_id(const _lv_font_fmt_txt_lut_t * lut, const lv_font_fmt_txt_dsc_t * fdsc,
+                                     uint32_t letter);
+    static void lut_add_kern_pairs(_lv_font_fmt_txt_lut_t * lut, const lv_font_fmt_txt_kern_pair_t * kdsc);
+    static inline uint32_t lut_get_font_index(const lv_font_fmt_txt_dsc_t * fdsc);
+    static inline uint32_t lut_get_missed_index(const lv_font_fmt_txt_dsc_t * fdsc);
+    static void lut_clear_removed(void);
+    static uint32_t lut_get_size_pow2(uint32_t cnt);
+#endif /*LV_FONT_FMT_TXT_LUT_SIZE > 0*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -75,10 +118,8 @@ static const uint8_t opa2_table[4] = {0, 85, 170, 255};
 
 const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unicode_letter, uint8_t * bitmap_out)
 {
-    if(unicode_letter == '\t') unicode_letter = ' ';
-
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    uint32_t gid = lv_font_fmt_txt_get_glyph_id(font, unicode_letter);
     if(!gid) return NULL;
 
     const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
@@ -86,8 +127,22 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
+    const uint8_t * glyph_bitmap;
+    if(fdsc->glyph_bitmap) {
+        glyph_bitmap = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    }
+    else if(fdsc->acquire_glyph_bitmap_cb) {
+        glyph_bitmap = fdsc->acquire_glyph_bitmap_cb(font, gid);
+        if(glyph_bitmap == NULL) return NULL;
+    }
+    else {
+        return NULL;
+    }
+
+    const uint8_t * res = NULL;
+
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+        const uint8_t * bitmap_in = glyph_bitmap;
         uint8_t * bitmap_out_tmp = bitmap_out;
         int32_t i = 0;
         int32_t x, y;
@@ -143,23 +198,25 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
                 bitmap_out_tmp += stride;
             }
         }
-        return bitmap_out;
+        res = bitmap_out;
     }
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
+        decompress(glyph_bitmap, bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return bitmap_out;
+        res = bitmap_out;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
 #endif
     }
 
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
+    if(fdsc->glyph_bitmap == NULL && fdsc->release_glyph_bitmap_cb) {
+        fdsc->release_glyph_bitmap_cb(font, glyph_bitmap);
+    }
+
+    return res;
 }
 
 /**
@@ -180,14 +237,15 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
         unicode_letter = ' ';
     }
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    const _lv_font_fmt_txt_lut_t * lut = lut_get(fdsc);
+    uint32_t gid = get_glyph_dsc_id(font, lut, unicode_letter);
     if(!gid) return false;
 
     int8_t kvalue = 0;
     if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        uint32_t gid_next = get_glyph_dsc_id(font, lut, unicode_letter_next);
         if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
+            kvalue = get_kern_value(font, lut, gid, gid_next);
         }
     }
 
@@ -215,16 +273,116 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+uint32_t lv_font_fmt_txt_get_glyph_id(const lv_font_t * font, uint32_t unicode_letter)
+{
+    if(unicode_letter == '\t') unicode_letter = ' ';
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    return get_glyph_dsc_id(font, lut_get(fdsc), unicode_letter);
+}
+
+bool lv_font_get_glyph_widths_fmt_txt(const lv_font_t * font, const uint32_t * letters, uint32_t cnt,
+                                      uint16_t * widths)
+{
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const _lv_font_fmt_txt_lut_t * lut = lut_get(fdsc);
+
+    bool all_found = true;
+    uint32_t gid = cnt ? get_glyph_dsc_id(font, lut, letters[0] == '\t' ? ' ' : letters[0]) : 0;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*The next letter's glyph ID is used for kerning (as it is) and for its own width too*/
+        uint32_t letter_next = letters[i + 1];
+        uint32_t gid_next = get_glyph_dsc_id(font, lut, letter_next);
+
+        if(gid == 0) {
+            widths[i] = UINT16_MAX;
+            all_found = false;
+        }
+        else {
+            int8_t kvalue = 0;
+            if(fdsc->kern_dsc && gid_next) kvalue = get_kern_value(font, lut, gid, gid_next);
+            int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+            uint32_t adv_w = fdsc->glyph_dsc[gid].adv_w;
+            if(letters[i] == '\t') adv_w *= 2;
+            adv_w += kv;
+            widths[i] = (uint16_t)((adv_w + (1 << 3)) >> 4);
+        }
+
+        gid = letter_next == '\t' ? get_glyph_dsc_id(font, lut, ' ') : gid_next;
+    }
+
+    return all_found;
+}
+
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+
+void _lv_font_fmt_txt_lut_init(void)
+{
+    lv_memzero(&lut_state, sizeof(lut_state));
+    lv_mutex_init(&lut_state.mutex);
+    lv_mem_budget_init(&lut_state.mem_budget, LV_FONT_FMT_TXT_LUT_SIZE);
+}
+
+void _lv_font_fmt_txt_lut_deinit(void)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        _lv_font_fmt_txt_lut_t * lut = (_lv_font_fmt_txt_lut_t *)lut_state.fonts[i].lut;
+        if(lut && lut != &lut_state.none) lv_mem_budget_free(&lut_state.mem_budget, lut, lut->size);
+    }
+
+    lv_mutex_delete(&lut_state.mutex);
+    lv_memzero(&lut_state, sizeof(lut_state));
+}
+
+void lv_font_fmt_txt_lut_invalidate_font(const lv_font_t * font)
+{
+    lv_mutex_lock(&lut_state.mutex);
+    uint32_t idx = lut_get_font_index(font->dsc);
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        _lv_font_fmt_txt_lut_entry_t * entry = &lut_state.fonts[(idx + i) & (_LV_FONT_FMT_TXT_LUT_FONT_CNT - 1)];
+        if(entry->fdsc == NULL) break;
+        if(entry->fdsc != font->dsc) continue;
+
+        const _lv_font_fmt_txt_lut_t * lut = entry->lut;
+        LUT_STORE(entry->fdsc, LUT_FONT_REMOVED);
+        LUT_STORE(entry->lut, NULL);
+        if(lut && lut != &lut_state.none) lv_mem_budget_free(&lut_state.mem_budget, (void *)lut, lut->size);
+        lut_clear_removed();
+        break;
+    }
+
+    /*The fonts which didn't fit can get an entry now*/
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_MISSED_CNT; i++) {
+        LUT_STORE(lut_state.missed[i], NULL);
+    }
+    lv_mutex_unlock(&lut_state.mutex);
+}
+
+#endif /*LV_FONT_FMT_TXT_LUT_SIZE > 0*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, const _lv_font_fmt_txt_lut_t * lut, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    if(lut && lut->cmap_slots) return lut_get_glyph_id(lut, font->dsc, letter);
+#else
+    LV_UNUSED(lut);
+#endif
+
+    return find_glyph_dsc_id(font->dsc, letter);
+}
 
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -268,13 +426,23 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 }
 
-static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
+static int8_t get_kern_value(const lv_font_t * font, const _lv_font_fmt_txt_lut_t * lut, uint32_t gid_left,
+                             uint32_t gid_right)
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
     int8_t value = 0;
 
-    if(fdsc->kern_classes == 0) {
+    if(lut && lut->kern_keys) {
+        /*Find the pair in the hash table. A key can't be 0 as the 0 glyph ID is not used*/
+        uint32_t key = (gid_right << 16) + gid_left;
+        uint32_t i = get_hash(key) & lut->kern_mask;
+        while(lut->kern_keys[i]) {
+            if(lut->kern_keys[i] == key) return lut->kern_values[i];
+            i = (i + 1) & lut->kern_mask;
+        }
+    }
+    else if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
         if(kdsc->glyph_ids_size == 0) {
@@ -557,3 +725,292 @@ static int32_t unicode_list_compare(const void * ref, const void * element)
 {
     return ((int32_t)(*(uint16_t *)ref)) - ((int32_t)(*(uint16_t *)element));
 }
+
+static inline uint32_t get_hash(uint32_t key)
+{
+    uint32_t h = key * 2654435761U;
+    return h ^ (h >> 16);
+}
+
+/**
+ * Get the lookup tables of a font. They can be used without locking.
+ * @param fdsc      pointer to a font descriptor
+ * @return          the lookup tables or NULL if the font has no tables
+ */
+static inline const _lv_font_fmt_txt_lut_t * lut_get(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    const _lv_font_fmt_txt_lut_t * lut;
+#if LUT_LOCK_FREE
+    /*The fonts which didn't fit into the table of fonts are neither searched nor locked for again*/
+    if(LUT_LOAD(lut_state.missed[lut_get_missed_index(fdsc)]) == fdsc) return NULL;
+
+    lut = lut_find(fdsc);
+    if(lut) return lut;
+#endif
+
+    /*Build them only once even if more threads need them at the same time*/
+    lv_mutex_lock(&lut_state.mutex);
+    lut = lut_create(fdsc);
+    lv_mutex_unlock(&lut_state.mutex);
+    return lut;
+#else
+    LV_UNUSED(fdsc);
+    return NULL;
+#endif
+}
+
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+
+/**
+ * Find the published tables of a font without locking
+ * @param fdsc      pointer to a font descriptor
+ * @return          the tables or NULL if they are not built yet
+ */
+static const _lv_font_fmt_txt_lut_t * lut_find(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    uint32_t idx = lut_get_font_index(fdsc);
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        _lv_font_fmt_txt_lut_entry_t * entry = &lut_state.fonts[(idx + i) & (_LV_FONT_FMT_TXT_LUT_FONT_CNT - 1)];
+        const lv_font_fmt_txt_dsc_t * entry_fdsc = LUT_LOAD(entry->fdsc);
+        if(entry_fdsc == fdsc) return LUT_LOAD(entry->lut);
+        if(entry_fdsc == NULL) break;
+    }
+
+    return NULL;
+}
+
+/**
+ * Build and publish the tables of a font if no other thread did it yet. Needs to be called with locked mutex.
+ * @param fdsc      pointer to a font descriptor
+ * @return          the tables or NULL if there is no free entry for the font
+ */
+static const _lv_font_fmt_txt_lut_t * lut_create(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    if(lut_state.missed[lut_get_missed_index(fdsc)] == fdsc) return NULL;
+
+    /*Find the font's entry or the first free one where it can be added*/
+    _lv_font_fmt_txt_lut_entry_t * free_entry = NULL;
+    uint32_t idx = lut_get_font_index(fdsc);
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        _lv_font_fmt_txt_lut_entry_t * entry = &lut_state.fonts[(idx + i) & (_LV_FONT_FMT_TXT_LUT_FONT_CNT - 1)];
+        if(entry->fdsc == fdsc) {
+            if(entry->lut) return entry->lut;
+            free_entry = entry;
+            break;
+        }
+
+        if(entry->fdsc == NULL || entry->fdsc == LUT_FONT_REMOVED) {
+            if(free_entry == NULL) free_entry = entry;
+            if(entry->fdsc == NULL) break;
+        }
+    }
+
+    if(free_entry == NULL) {
+        LV_LOG_INFO("No free entry for the lookup tables of a font, increase _LV_FONT_FMT_TXT_LUT_FONT_CNT");
+        LUT_STORE(lut_state.missed[lut_get_missed_index(fdsc)], fdsc);
+        return NULL;
+    }
+
+    /*Even without tables the font is added to avoid trying again on every letter*/
+    const _lv_font_fmt_txt_lut_t * lut = lut_build(fdsc);
+    if(lut == NULL) lut = &lut_state.none;
+
+    LUT_STORE(free_entry->lut, lut);
+    LUT_STORE(free_entry->fdsc, fdsc);
+
+    return lut;
+}
+
+/**
+ * Allocate and fill the tables of a font
+ * @param fdsc      pointer to a font descriptor
+ * @return          the tables or NULL if the font doesn't need tables or they don't fit
+ */
+static _lv_font_fmt_txt_lut_t * lut_build(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*The format 0 cmaps are fast anyway, the sparse ones need to be searched*/
+    uint32_t glyph_cnt = 0;
+    bool has_sparse = false;
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ||
+           fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+            has_sparse = true;
+            glyph_cnt += fdsc->cmaps[i].list_length;
+        }
+        else {
+            glyph_cnt += fdsc->cmaps[i].range_length;
+        }
+    }
+
+    /*The cache needs to hold only the used letters, so it's capped even for the large CJK fonts*/
+    uint32_t cmap_cnt = 0;
+    if(has_sparse || fdsc->cmap_num > 2) {
+        cmap_cnt = lut_get_size_pow2(LV_CLAMP(LUT_CMAP_SLOT_MIN, glyph_cnt, LUT_CMAP_SLOT_MAX));
+    }
+
+    /*Keep the kern hash table at most half full*/
+    uint32_t kern_cnt = 0;
+    const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+    if(kdsc && fdsc->kern_classes == 0 && kdsc->glyph_ids_size <= 1 && kdsc->pair_cnt) {
+        kern_cnt = lut_get_size_pow2(kdsc->pair_cnt * 2);
+    }
+
+    if(cmap_cnt == 0 && kern_cnt == 0) return NULL;
+
+    uint32_t head_size = sizeof(_lv_font_fmt_txt_lut_t);
+    uint32_t cmap_size = cmap_cnt * sizeof(_lv_font_fmt_txt_lut_slot_t);
+    uint32_t kern_size = kern_cnt * (sizeof(uint32_t) + sizeof(int8_t));
+
+    /*Try to allocate all tables. If they don't fit, drop the kern table as the glyph IDs are needed more often,
+     *then try smaller glyph ID caches.*/
+    uint32_t size = head_size + cmap_size + kern_size;
+    _lv_font_fmt_txt_lut_t * lut = lv_mem_budget_alloc(&lut_state.mem_budget, size);
+    if(lut == NULL && cmap_size && kern_size) {
+        kern_cnt = 0;
+        kern_size = 0;
+        size = head_size + cmap_size;
+        lut = lv_mem_budget_alloc(&lut_state.mem_budget, size);
+    }
+    while(lut == NULL && cmap_cnt > LUT_CMAP_SLOT_MIN) {
+        cmap_cnt /= 2;
+        cmap_size = cmap_cnt * sizeof(_lv_font_fmt_txt_lut_slot_t);
+        size = head_size + cmap_size;
+        lut = lv_mem_budget_alloc(&lut_state.mem_budget, size);
+    }
+    if(lut == NULL) {
+        LV_LOG_INFO("The lookup tables of a font don't fit into LV_FONT_FMT_TXT_LUT_SIZE");
+        return NULL;
+    }
+
+    lv_memzero(lut, head_size + cmap_size + kern_size);
+    lut->fdsc = fdsc;
+    lut->size = size;
+
+    uint8_t * buf = (uint8_t *)lut + head_size;
+    if(cmap_cnt) {
+        lut->cmap_slots = (_lv_font_fmt_txt_lut_slot_t *)buf;
+        lut->cmap_mask = cmap_cnt - 1;
+        while((1U << lut->cmap_bits) < cmap_cnt) lut->cmap_bits++;
+        buf += cmap_size;
+    }
+
+    if(kern_cnt) {
+        lut->kern_keys = (uint32_t *)buf;
+        lut->kern_values = (int8_t *)(buf + kern_cnt * sizeof(uint32_t));
+        lut->kern_mask = kern_cnt - 1;
+        lut_add_kern_pairs(lut, kdsc);
+    }
+
+    return lut;
+}
+
+/**
+ * Get the glyph ID of a letter from the glyph ID cache, or find it and store it in the cache
+ * @param lut       the lookup tables of a font with glyph ID cache
+ * @param fdsc      the font's descriptor
+ * @param letter    a UNICODE letter code
+ * @return          the glyph ID or 0 if the letter is not in the font
+ */
+static uint32_t lut_get_glyph_id(const _lv_font_fmt_txt_lut_t * lut, const lv_font_fmt_txt_dsc_t * fdsc,
+                                 uint32_t letter)
+{
+    /*The letters out of the UNICODE range are not cached*/
+    uint32_t tag = (letter >> lut->cmap_bits) + 1;
+    if(tag > 0xFFFF) return find_glyph_dsc_id(fdsc, letter);
+
+#if !LUT_LOCK_FREE
+    lv_mutex_lock(&lut_state.mutex);
+#endif
+
+    /*The consecutive letters are in different slots. The letters not in the font are cached too.*/
+    _lv_font_fmt_txt_lut_slot_t * slot = &lut->cmap_slots[letter & lut->cmap_mask];
+    _lv_font_fmt_txt_lut_slot_t v = LUT_LOAD(*slot);
+    uint32_t glyph_id;
+    if((v >> 16) == tag) {
+        glyph_id = v & 0xFFFF;
+    }
+    else {
+        glyph_id = find_glyph_dsc_id(fdsc, letter);
+        if(glyph_id <= 0xFFFF) LUT_STORE(*slot, (tag << 16) | glyph_id);
+    }
+
+#if !LUT_LOCK_FREE
+    lv_mutex_unlock(&lut_state.mutex);
+#endif
+
+    return glyph_id;
+}
+
+static void lut_add_kern_pairs(_lv_font_fmt_txt_lut_t * lut, const lv_font_fmt_txt_kern_pair_t * kdsc)
+{
+    uint32_t i;
+    for(i = 0; i < kdsc->pair_cnt; i++) {
+        uint32_t gid_left;
+        uint32_t gid_right;
+        if(kdsc->glyph_ids_size == 0) {
+            const uint8_t * g_ids = kdsc->glyph_ids;
+            gid_left = g_ids[i * 2];
+            gid_right = g_ids[i * 2 + 1];
+        }
+        else {
+            const uint16_t * g_ids = kdsc->glyph_ids;
+            gid_left = g_ids[i * 2];
+            gid_right = g_ids[i * 2 + 1];
+        }
+
+        uint32_t key = (gid_right << 16) + gid_left;
+        uint32_t k = get_hash(key) & lut->kern_mask;
+        while(lut->kern_keys[k] && lut->kern_keys[k] != key) k = (k + 1) & lut->kern_mask;
+        lut->kern_keys[k] = key;
+        lut->kern_values[k] = kdsc->values[i];
+    }
+}
+
+static inline uint32_t lut_get_font_index(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    return get_hash((uint32_t)(lv_uintptr_t)fdsc) & (_LV_FONT_FMT_TXT_LUT_FONT_CNT - 1);
+}
+
+static inline uint32_t lut_get_missed_index(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    return get_hash((uint32_t)(lv_uintptr_t)fdsc) & (_LV_FONT_FMT_TXT_LUT_MISSED_CNT - 1);
+}
+
+/**
+ * Mark the removed entries as unused if no font is searched through them.
+ * This way the searches don't skip them anymore. Needs to be called with locked mutex.
+ */
+static void lut_clear_removed(void)
+{
+    bool skipped[_LV_FONT_FMT_TXT_LUT_FONT_CNT];
+    lv_memzero(skipped, sizeof(skipped));
+
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        const lv_font_fmt_txt_dsc_t * fdsc = lut_state.fonts[i].fdsc;
+        if(fdsc == NULL || fdsc == LUT_FONT_REMOVED) continue;
+
+        /*The entries between the font's index and its entry are skipped when searching it*/
+        uint32_t k;
+        for(k = lut_get_font_index(fdsc); k != i; k = (k + 1) & (_LV_FONT_FMT_TXT_LUT_FONT_CNT - 1)) {
+            skipped[k] = true;
+        }
+    }
+
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        if(lut_state.fonts[i].fdsc == LUT_FONT_REMOVED && !skipped[i]) LUT_STORE(lut_state.fonts[i].fdsc, NULL);
+    }
+}
+
+static uint32_t lut_get_size_pow2(uint32_t cnt)
+{
+    uint32_t size = 1;
+    while(size < cnt) size <<= 1;
+    return size;
+}
+
+#endif /*LV_FONT_FMT_TXT_LUT_SIZE > 0*/
@@ -17,6 +17,8 @@ extern "C" {
 #include <stddef.h>
 #include <stdbool.h>
 #include "lv_font.h"
+#include "../misc/lv_mem_budget.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -161,6 +163,13 @@ typedef struct {
     /*The bitmaps of all glyphs*/
     const uint8_t * glyph_bitmap;
 
+    /**
+     * Optional: if `glyph_bitmap` is NULL get the bitmap of a glyph on demand (e.g. read it from a file).
+     * Return the bitmap in the format of `glyph_bitmap`, which needs to stay valid until `release_glyph_bitmap_cb`.
+     */
+    const uint8_t * (*acquire_glyph_bitmap_cb)(const lv_font_t * font, uint32_t glyph_id);
+    void (*release_glyph_bitmap_cb)(const lv_font_t * font, const uint8_t * bitmap);
+
     /*Describe the glyphs*/
     const lv_font_fmt_txt_glyph_dsc_t * glyph_dsc;
 
@@ -211,6 +220,57 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+/**
+ * A slot of the glyph ID cache: `((letter >> cmap_bits) + 1) << 16 | glyph_id`, 0 if it's unused.
+ * The letter's low bits are the index of the slot, so they are not stored.
+ */
+typedef uint32_t _lv_font_fmt_txt_lut_slot_t;
+
+/**
+ * Lookup tables of a font built when the font is used first.
+ * They make finding the glyph IDs and kern values faster.
+ * The kern table is not modified after it's built and the slots of the glyph ID cache are
+ * written with atomic 32 bit stores, so the tables are read without locking.
+ */
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;         /**< The font whose tables these are*/
+    uint32_t size;                              /**< Memory used by the tables in bytes*/
+    _lv_font_fmt_txt_lut_slot_t * cmap_slots;   /**< Direct mapped cache of the recently used glyph IDs or NULL*/
+    uint32_t cmap_mask;                         /**< Number of `cmap_slots` - 1*/
+    uint32_t cmap_bits;                         /**< log2 of the number of `cmap_slots`*/
+    uint32_t * kern_keys;                       /**< Hash table of the kern pairs as `(right << 16) + left` or NULL*/
+    int8_t * kern_values;                       /**< The kern values of `kern_keys`*/
+    uint32_t kern_mask;                         /**< Number of `kern_keys` - 1*/
+} _lv_font_fmt_txt_lut_t;
+
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+
+/*Max. number of fonts with lookup tables. Must be a power of 2.*/
+#define _LV_FONT_FMT_TXT_LUT_FONT_CNT   32
+
+/*Number of remembered fonts which didn't fit into the table of fonts. Must be a power of 2.*/
+#define _LV_FONT_FMT_TXT_LUT_MISSED_CNT 8
+
+/** The lookup tables of a font published for the lock-free readers*/
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;         /**< The font, NULL if the entry was never used*/
+    const _lv_font_fmt_txt_lut_t * lut;         /**< Its tables or NULL if they are not built yet*/
+} _lv_font_fmt_txt_lut_entry_t;
+
+/**
+ * The lookup tables of all fonts use at most `LV_FONT_FMT_TXT_LUT_SIZE` bytes.
+ * If a font's tables don't fit, a smaller glyph ID cache is used, and the font is used without tables
+ * only if even the smallest one doesn't fit.
+ */
+typedef struct {
+    lv_mem_budget_t mem_budget;
+    _lv_font_fmt_txt_lut_entry_t fonts[_LV_FONT_FMT_TXT_LUT_FONT_CNT];   /**< Hash table of the fonts by `fdsc`*/
+    _lv_font_fmt_txt_lut_t none;        /**< Published for the fonts without tables to not try again*/
+    const lv_font_fmt_txt_dsc_t * missed[_LV_FONT_FMT_TXT_LUT_MISSED_CNT]; /**< Fonts not fitting into `fonts`*/
+    lv_mutex_t mutex;                   /**< Taken only to build and free the tables*/
+} _lv_font_fmt_txt_lut_state_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -237,6 +297,51 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Get the ID of the glyph of a letter, i.e. the index of its descriptor in `glyph_dsc`.
+ * @param font              pointer to a font in lvgl's native format
+ * @param unicode_letter    a UNICODE letter code
+ * @return                  the glyph ID or 0 if the letter is not in the font
+ */
+uint32_t lv_font_fmt_txt_get_glyph_id(const lv_font_t * font, uint32_t unicode_letter);
+
+/**
+ * Get the advance width of more letters at once, like `lv_font_get_glyph_width` would for each letter.
+ * Faster than getting the descriptors one by one as the lookup tables are found only once
+ * and the glyph ID of each letter is searched only once.
+ * @param font              pointer to a font in lvgl's native format
+ * @param letters           `cnt + 1` UNICODE letters. The last one is used only for the kerning of the last width.
+ * @param cnt               number of widths to get
+ * @param widths            store the widths here. `UINT16_MAX` for the letters not found in the font.
+ * @return                  true: all letters were found in the font
+ */
+bool lv_font_get_glyph_widths_fmt_txt(const lv_font_t * font, const uint32_t * letters, uint32_t cnt,
+                                      uint16_t * widths);
+
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+
+/**
+ * Initialize the lookup tables of the fonts. Called by LVGL in `lv_init`.
+ */
+void _lv_font_fmt_txt_lut_init(void);
+
+/**
+ * Free the lookup tables of the fonts. Called by LVGL in `lv_deinit`.
+ */
+void _lv_font_fmt_txt_lut_deinit(void);
+
+/**
+ * Free the lookup tables of a font. Needs to be called before freeing a font,
+ * when the font is not used by any thread.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_lut_invalidate_font(const lv_font_t * font);
+
+#else
+
+#define lv_font_fmt_txt_lut_invalidate_font(font) LV_UNUSED(font)
+
+#endif /*LV_FONT_FMT_TXT_LUT_SIZE > 0*/
 
 /**********************
  *      MACROS
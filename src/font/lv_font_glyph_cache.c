@@ -0,0 +1,260 @@
+/**
+ * @file lv_font_glyph_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_glyph_cache.h"
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+
+#include "../core/lv_global.h"
+#include "../draw/lv_draw_buf.h"
+#include "../misc/lv_assert.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _glyph_cache LV_GLOBAL_DEFAULT()->font_glyph_cache
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t get_hash(const lv_font_t * font, uint32_t letter);
+static lv_font_glyph_cache_entry_t * find_entry(const lv_font_t * font, uint32_t letter);
+static lv_font_glyph_cache_entry_t * alloc_entry(uint32_t size);
+static void add_entry(lv_font_glyph_cache_entry_t * entry);
+static void remove_entry(lv_font_glyph_cache_entry_t * entry);
+static void free_entry(lv_font_glyph_cache_entry_t * entry);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_font_glyph_cache_init(void)
+{
+    lv_memzero(&_glyph_cache, sizeof(_glyph_cache));
+    lv_mutex_init(&_glyph_cache.mutex);
+    lv_mem_budget_init(&_glyph_cache.mem_budget, LV_FONT_GLYPH_CACHE_SIZE);
+    lv_hash_lru_init(&_glyph_cache.entries);
+}
+
+void _lv_font_glyph_cache_deinit(void)
+{
+    lv_hash_lru_node_t * node = _glyph_cache.entries.lru_head;
+    while(node) {
+        lv_hash_lru_node_t * next = node->lru_next;
+        free_entry((lv_font_glyph_cache_entry_t *)node);
+        node = next;
+    }
+
+    lv_hash_lru_deinit(&_glyph_cache.entries);
+
+    lv_mutex_delete(&_glyph_cache.mutex);
+    lv_memzero(&_glyph_cache, sizeof(_glyph_cache));
+}
+
+bool _lv_font_glyph_cache_acquire(const lv_font_t * font, uint32_t letter, lv_font_glyph_dsc_t * dsc_out,
+                                  lv_font_glyph_cache_entry_t ** entry_out)
+{
+    *entry_out = NULL;
+
+    lv_mutex_lock(&_glyph_cache.mutex);
+    lv_font_glyph_cache_entry_t * entry = find_entry(font, letter);
+    if(entry) {
+        lv_hash_lru_touch(&_glyph_cache.entries, &entry->node);
+        entry->ref_cnt++;
+        _glyph_cache.entries.stats.hit_cnt++;
+        *dsc_out = entry->dsc;
+        *entry_out = entry;
+        lv_mutex_unlock(&_glyph_cache.mutex);
+        return true;
+    }
+    lv_mutex_unlock(&_glyph_cache.mutex);
+
+    if(!lv_font_get_glyph_dsc(font, dsc_out, letter, '\0')) return false;
+
+    /*Nothing to cache for empty glyphs, and image fonts have images instead of bitmaps*/
+    if(dsc_out->box_w == 0 || dsc_out->box_h == 0 || dsc_out->bpp == LV_IMGFONT_BPP) return true;
+
+    uint32_t stride = lv_draw_buf_width_to_stride(dsc_out->box_w, LV_COLOR_FORMAT_A8);
+    uint32_t bitmap_size = stride * dsc_out->box_h;
+    uint32_t size = sizeof(lv_font_glyph_cache_entry_t) + LV_DRAW_BUF_ALIGN - 1 + bitmap_size;
+
+    lv_mutex_lock(&_glyph_cache.mutex);
+    entry = alloc_entry(size);
+    lv_mutex_unlock(&_glyph_cache.mutex);
+
+    /*All the glyphs in the cache are being drawn, allocate this one only while it's used*/
+    if(entry == NULL) {
+        entry = lv_malloc(size);
+        LV_ASSERT_MALLOC(entry);
+        if(entry == NULL) return true;
+        lv_memzero(entry, sizeof(lv_font_glyph_cache_entry_t));
+        entry->size = size;
+        entry->heap = 1;
+        entry->temporary = 1;
+    }
+
+    /*Decode the bitmap without holding the lock, so the other draw units are not blocked*/
+    uint8_t * bitmap = (uint8_t *)entry + sizeof(lv_font_glyph_cache_entry_t);
+    bitmap = lv_draw_buf_align_buf(bitmap, LV_COLOR_FORMAT_A8);
+    const uint8_t * bitmap_res = lv_font_get_glyph_bitmap(dsc_out->resolved_font, letter, bitmap);
+
+    lv_mutex_lock(&_glyph_cache.mutex);
+
+    /*E.g. a placeholder is drawn for missing glyphs*/
+    if(bitmap_res == NULL) {
+        free_entry(entry);
+        lv_mutex_unlock(&_glyph_cache.mutex);
+        return true;
+    }
+
+    /*Some fonts return their own buffer*/
+    if(bitmap_res != bitmap) lv_memcpy(bitmap, bitmap_res, bitmap_size);
+
+    entry->font = font;
+    entry->letter = letter;
+    entry->dsc = *dsc_out;
+    entry->bitmap = bitmap;
+    _glyph_cache.entries.stats.miss_cnt++;
+
+    /*Another draw unit might have added the same glyph in the meantime*/
+    lv_font_glyph_cache_entry_t * entry_other = find_entry(font, letter);
+    if(entry_other) {
+        free_entry(entry);
+        entry = entry_other;
+    }
+    else if(!entry->temporary) {
+        add_entry(entry);
+    }
+
+    entry->ref_cnt++;
+    *entry_out = entry;
+    lv_mutex_unlock(&_glyph_cache.mutex);
+
+    return true;
+}
+
+void _lv_font_glyph_cache_release(lv_font_glyph_cache_entry_t * entry)
+{
+    if(entry == NULL) return;
+
+    lv_mutex_lock(&_glyph_cache.mutex);
+    entry->ref_cnt--;
+    if(entry->temporary && entry->ref_cnt == 0) free_entry(entry);
+    lv_mutex_unlock(&_glyph_cache.mutex);
+}
+
+void lv_font_glyph_cache_invalidate_font(const lv_font_t * font)
+{
+    lv_mutex_lock(&_glyph_cache.mutex);
+    lv_hash_lru_node_t * node = _glyph_cache.entries.lru_head;
+    while(node) {
+        lv_hash_lru_node_t * next = node->lru_next;
+        lv_font_glyph_cache_entry_t * entry = (lv_font_glyph_cache_entry_t *)node;
+        if(entry->font == font || entry->dsc.resolved_font == font) {
+            remove_entry(entry);
+            /*If it's being drawn just detach it, the last user will free it*/
+            if(entry->ref_cnt) entry->temporary = 1;
+            else free_entry(entry);
+        }
+        node = next;
+    }
+    lv_mutex_unlock(&_glyph_cache.mutex);
+}
+
+void lv_font_glyph_cache_get_stats(lv_font_glyph_cache_stats_t * stats)
+{
+    lv_mutex_lock(&_glyph_cache.mutex);
+    *stats = _glyph_cache.entries.stats;
+    lv_mutex_unlock(&_glyph_cache.mutex);
+}
+
+void lv_font_glyph_cache_reset_stats(void)
+{
+    lv_mutex_lock(&_glyph_cache.mutex);
+    lv_hash_lru_reset_stats(&_glyph_cache.entries);
+    lv_mutex_unlock(&_glyph_cache.mutex);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t get_hash(const lv_font_t * font, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font >> 3) ^ (letter * 2654435761U);
+    return h ^ (h >> 16);
+}
+
+static lv_font_glyph_cache_entry_t * find_entry(const lv_font_t * font, uint32_t letter)
+{
+    lv_hash_lru_node_t * node = lv_hash_lru_find_first(&_glyph_cache.entries, get_hash(font, letter));
+    while(node) {
+        lv_font_glyph_cache_entry_t * entry = (lv_font_glyph_cache_entry_t *)node;
+        if(entry->font == font && entry->letter == letter) return entry;
+        node = lv_hash_lru_find_next(node);
+    }
+
+    return NULL;
+}
+
+/**
+ * Allocate memory for a new entry. Free the least recently used glyphs which are not drawn right now if needed.
+ */
+static lv_font_glyph_cache_entry_t * alloc_entry(uint32_t size)
+{
+    lv_font_glyph_cache_entry_t * entry = lv_mem_budget_alloc(&_glyph_cache.mem_budget, size);
+    lv_hash_lru_node_t * victim = _glyph_cache.entries.lru_tail;
+    while(entry == NULL && victim) {
+        lv_hash_lru_node_t * prev = victim->lru_prev;
+        if(((lv_font_glyph_cache_entry_t *)victim)->ref_cnt == 0) {
+            remove_entry((lv_font_glyph_cache_entry_t *)victim);
+            free_entry((lv_font_glyph_cache_entry_t *)victim);
+            _glyph_cache.entries.stats.evict_cnt++;
+            entry = lv_mem_budget_alloc(&_glyph_cache.mem_budget, size);
+        }
+        victim = prev;
+    }
+
+    if(entry == NULL) return NULL;
+
+    lv_memzero(entry, sizeof(lv_font_glyph_cache_entry_t));
+    entry->size = size;
+    return entry;
+}
+
+static void add_entry(lv_font_glyph_cache_entry_t * entry)
+{
+    lv_hash_lru_add(&_glyph_cache.entries, &entry->node, entry->size);
+    lv_hash_lru_index(&_glyph_cache.entries, &entry->node, get_hash(entry->font, entry->letter));
+}
+
+static void remove_entry(lv_font_glyph_cache_entry_t * entry)
+{
+    lv_hash_lru_remove(&_glyph_cache.entries, &entry->node);
+}
+
+static void free_entry(lv_font_glyph_cache_entry_t * entry)
+{
+    if(entry->heap) lv_free(entry);
+    else lv_mem_budget_free(&_glyph_cache.mem_budget, entry, entry->size);
+}
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE > 0*/
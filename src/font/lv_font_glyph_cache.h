@@ -0,0 +1,125 @@
+/**
+ * @file lv_font_glyph_cache.h
+ *
+ */
+
+#ifndef LV_FONT_GLYPH_CACHE_H
+#define LV_FONT_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_font.h"
+#include "../osal/lv_os.h"
+#include "../misc/lv_mem_budget.h"
+#include "../misc/lv_hash_lru.h"
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A cached glyph: its descriptor and its bitmap in A8 format
+ */
+typedef struct {
+    lv_hash_lru_node_t node;            /**< Must be the first*/
+    const lv_font_t * font;             /**< The font which was asked for the glyph*/
+    uint32_t letter;                    /**< UNICODE letter*/
+    lv_font_glyph_dsc_t dsc;            /**< Descriptor of the glyph*/
+    const uint8_t * bitmap;             /**< The A8 bitmap with `lv_draw_buf_width_to_stride(box_w, A8)` stride*/
+    uint32_t size;                      /**< Memory used by the entry in bytes*/
+    uint32_t ref_cnt;                   /**< Number of users drawing the glyph right now*/
+    uint32_t temporary : 1;             /**< Not in the cache: freed when the last user releases it*/
+    uint32_t heap : 1;                  /**< Allocated out of the cache's memory budget because it didn't fit*/
+} lv_font_glyph_cache_entry_t;
+
+typedef lv_hash_lru_stats_t lv_font_glyph_cache_stats_t;
+
+/**
+ * The glyphs use at most `LV_FONT_GLYPH_CACHE_SIZE` bytes.
+ * If they don't fit, the least recently used glyphs are freed.
+ */
+typedef struct {
+    lv_mem_budget_t mem_budget;
+    lv_hash_lru_t entries;      /**< The entries by font and letter and in the order to evict them*/
+    lv_mutex_t mutex;
+} _lv_font_glyph_cache_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the glyph cache. Called by LVGL in `lv_init`.
+ */
+void _lv_font_glyph_cache_init(void);
+
+/**
+ * Free all the cached glyphs. Called by LVGL in `lv_deinit`.
+ */
+void _lv_font_glyph_cache_deinit(void);
+
+/**
+ * Get the descriptor and the A8 bitmap of a glyph. If the glyph is not cached yet it's decoded and added to the cache.
+ * The entry can't be freed until `_lv_font_glyph_cache_release` is called.
+ * @param font      pointer to a font
+ * @param letter    a UNICODE letter
+ * @param dsc_out   store the descriptor of the glyph here
+ * @param entry_out store the cache entry here. It's NULL if the glyph can't be cached
+ *                  (e.g. it's empty, it's an image font or it has no bitmap).
+ *                  In this case the bitmap needs to be get with `lv_font_get_glyph_bitmap`.
+ * @return          false: the glyph was not found, `dsc_out` is not set
+ */
+bool _lv_font_glyph_cache_acquire(const lv_font_t * font, uint32_t letter, lv_font_glyph_dsc_t * dsc_out,
+                                  lv_font_glyph_cache_entry_t ** entry_out);
+
+/**
+ * Mark a glyph as not used anymore
+ * @param entry     the entry returned by `_lv_font_glyph_cache_acquire`
+ */
+void _lv_font_glyph_cache_release(lv_font_glyph_cache_entry_t * entry);
+
+/**
+ * Drop the glyphs of a font from the cache. Needs to be called before freeing a font.
+ * The glyphs whose fallback font is `font` are dropped too.
+ * @param font      pointer to a font
+ */
+void lv_font_glyph_cache_invalidate_font(const lv_font_t * font);
+
+/**
+ * Get the statistics of the glyph cache
+ * @param stats     store the statistics here
+ */
+void lv_font_glyph_cache_get_stats(lv_font_glyph_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and evict counters of the glyph cache
+ */
+void lv_font_glyph_cache_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#else /*LV_FONT_GLYPH_CACHE_SIZE > 0*/
+
+#define lv_font_glyph_cache_invalidate_font(font) LV_UNUSED(font)
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE > 0*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_GLYPH_CACHE_H*/
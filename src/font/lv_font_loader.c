@@ -12,13 +12,61 @@
 
 #include "../lvgl.h"
 #include "../misc/lv_fs.h"
+#include "../misc/lv_hash_lru.h"
 #include "lv_font_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+
 /**********************
  *      TYPEDEFS
  **********************/
+typedef enum {
+    LOAD_MODE_COPY,         /*Read all the tables into the heap*/
+    LOAD_MODE_MAPPED,       /*Use the tables in place from the mapped file*/
+    LOAD_MODE_STREAMED,     /*Read the glyph bitmaps on demand*/
+} load_mode_t;
+
+/*A glyph bitmap read from the file. The bitmap is stored after the entry.*/
+typedef struct {
+    lv_hash_lru_node_t node;            /*Hashed by the glyph ID. Its size is the size of the entry with the bitmap*/
+    uint32_t glyph_id;
+    uint32_t ref_cnt;                   /*The bitmap is being drawn, can't be freed*/
+} stream_entry_t;
+
+/*Data of a font whose glyph bitmaps are read from the file on demand*/
+typedef struct {
+    uint32_t * glyph_offset;    /*Offset of the glyphs in the glyf table + the end of the last glyph*/
+    uint32_t glyph_cnt;
+    uint32_t glyf_start;        /*Position of the glyf table in the file*/
+    uint8_t header_bits;        /*Size of the glyphs' header before their bitmap*/
+    uint32_t cache_max;         /*The cached bitmaps can use this much memory*/
+    lv_hash_lru_t entries;      /*The cached bitmaps. A miss means a read from the file.*/
+    lv_mutex_t mutex;
+} font_stream_t;
+
 typedef struct {
     lv_fs_file_t * fp;
+    const uint8_t * map;    /*The content of the file if it's mapped, else NULL*/
+    uint32_t map_size;
+    uint32_t pos;           /*Read position in `map`*/
+    uint32_t heap_size;     /*Memory allocated for the font so far*/
+    font_stream_t * stream; /*Don't load the glyph bitmaps but prepare the font for streaming them*/
+} font_loader_t;
+
+/*The loaded font with the data needed to free it*/
+typedef struct {
+    lv_font_t font;         /*Needs to be the first to cast `lv_font_t *` to `loaded_font_t *`*/
+    lv_fs_file_t file;      /*The file is kept open while it's mapped or streamed*/
+    const uint8_t * map;
+    uint32_t map_size;
+    font_stream_t * stream;
+    lv_font_load_info_t info;
+} loaded_font_t;
+
+typedef struct {
+    font_loader_t * ld;
     int8_t bit_pos;
     uint8_t byte_value;
 } bit_iterator_t;
@@ -63,13 +111,26 @@ typedef struct cmap_table_bin {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+static lv_font_t * load_font(const char * font_name, load_mode_t mode, uint32_t cache_size);
+static bit_iterator_t init_bit_iterator(font_loader_t * ld);
+static bool lvgl_load_font(font_loader_t * ld, lv_font_t * font);
+int32_t load_kern(font_loader_t * ld, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 
+static void * loader_malloc(font_loader_t * ld, uint32_t size);
+static lv_fs_res_t loader_read(font_loader_t * ld, void * buf, uint32_t btr);
+static lv_fs_res_t loader_seek(font_loader_t * ld, uint32_t pos);
+static bool load_table(font_loader_t * ld, const void ** table_p, uint32_t size, uint32_t align);
+static void free_table(loaded_font_t * lfont, const void * table);
+
+static const uint8_t * stream_acquire_bitmap(const lv_font_t * font, uint32_t glyph_id);
+static void stream_release_bitmap(const lv_font_t * font, const uint8_t * bitmap);
+static void stream_prefetch(const lv_font_t * font, const char * txt);
+static stream_entry_t * stream_get(loaded_font_t * lfont, uint32_t glyph_id);
+static void stream_free(loaded_font_t * lfont);
+
 /**********************
  *      MACROS
  **********************/
@@ -78,32 +139,19 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
  *   GLOBAL FUNCTIONS
  **********************/
 
-
 lv_font_t * lv_font_load(const char * font_name)
 {
-    lv_fs_file_t file;
-    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
-    if(res != LV_FS_RES_OK)
-        return NULL;
-
-    lv_font_t * font = lv_malloc(sizeof(lv_font_t));
-    if(font) {
-        memset(font, 0, sizeof(lv_font_t));
-        if(!lvgl_load_font(&file, font)) {
-            LV_LOG_WARN("Error loading font file: %s\n", font_name);
-            /*
-            * When `lvgl_load_font` fails it can leak some pointers.
-            * All non-null pointers can be assumed as allocated and
-            * `lv_font_free` should free them correctly.
-            */
-            lv_font_free(font);
-            font = NULL;
-        }
-    }
+    return load_font(font_name, LOAD_MODE_COPY, 0);
+}
 
-    lv_fs_close(&file);
+lv_font_t * lv_font_load_mapped(const char * font_name)
+{
+    return load_font(font_name, LOAD_MODE_MAPPED, 0);
+}
 
-    return font;
+lv_font_t * lv_font_load_streamed(const char * font_name, uint32_t cache_size)
+{
+    return load_font(font_name, LOAD_MODE_STREAMED, cache_size);
 }
 
 #if LV_USE_FS_MEMFS
@@ -116,9 +164,27 @@ lv_font_t * lv_font_load_from_buffer(void * buffer, uint32_t size)
 }
 #endif
 
+void lv_font_get_load_info(const lv_font_t * font, lv_font_load_info_t * info)
+{
+    const loaded_font_t * lfont = (const loaded_font_t *)font;
+    *info = lfont->info;
+
+    font_stream_t * stream = lfont->stream;
+    if(stream) {
+        lv_mutex_lock(&stream->mutex);
+        info->cache_size = stream->entries.stats.byte_cnt;
+        info->read_cnt = stream->entries.stats.miss_cnt;
+        lv_mutex_unlock(&stream->mutex);
+    }
+}
+
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        lv_font_invalidate(font);
+        lv_font_fmt_txt_lut_invalidate_font(font);
+
+        loaded_font_t * lfont = (loaded_font_t *)font;
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
@@ -128,12 +194,8 @@ void lv_font_free(lv_font_t * font)
                     (lv_font_fmt_txt_kern_pair_t *)dsc->kern_dsc;
 
                 if(NULL != kern_dsc) {
-                    if(kern_dsc->glyph_ids)
-                        lv_free((void *)kern_dsc->glyph_ids);
-
-                    if(kern_dsc->values)
-                        lv_free((void *)kern_dsc->values);
-
+                    free_table(lfont, kern_dsc->glyph_ids);
+                    free_table(lfont, kern_dsc->values);
                     lv_free((void *)kern_dsc);
                 }
             }
@@ -142,15 +204,9 @@ void lv_font_free(lv_font_t * font)
                     (lv_font_fmt_txt_kern_classes_t *)dsc->kern_dsc;
 
                 if(NULL != kern_dsc) {
-                    if(kern_dsc->class_pair_values)
-                        lv_free((void *)kern_dsc->class_pair_values);
-
-                    if(kern_dsc->left_class_mapping)
-                        lv_free((void *)kern_dsc->left_class_mapping);
-
-                    if(kern_dsc->right_class_mapping)
-                        lv_free((void *)kern_dsc->right_class_mapping);
-
+                    free_table(lfont, kern_dsc->class_pair_values);
+                    free_table(lfont, kern_dsc->left_class_mapping);
+                    free_table(lfont, kern_dsc->right_class_mapping);
                     lv_free((void *)kern_dsc);
                 }
             }
@@ -160,22 +216,28 @@ void lv_font_free(lv_font_t * font)
 
             if(NULL != cmaps) {
                 for(int i = 0; i < dsc->cmap_num; ++i) {
-                    if(NULL != cmaps[i].glyph_id_ofs_list)
-                        lv_free((void *)cmaps[i].glyph_id_ofs_list);
-                    if(NULL != cmaps[i].unicode_list)
-                        lv_free((void *)cmaps[i].unicode_list);
+                    free_table(lfont, cmaps[i].glyph_id_ofs_list);
+                    free_table(lfont, cmaps[i].unicode_list);
                 }
                 lv_free(cmaps);
             }
 
-            if(NULL != dsc->glyph_bitmap) {
-                lv_free((void *)dsc->glyph_bitmap);
-            }
+            free_table(lfont, dsc->glyph_bitmap);
             if(NULL != dsc->glyph_dsc) {
                 lv_free((void *)dsc->glyph_dsc);
             }
             lv_free(dsc);
         }
+
+        if(lfont->map) {
+            lv_fs_unmap(&lfont->file, lfont->map, lfont->map_size);
+        }
+        if(lfont->stream) {
+            stream_free(lfont);
+        }
+        if(lfont->file.drv) {
+            lv_fs_close(&lfont->file);
+        }
         lv_free(font);
     }
 }
@@ -184,10 +246,285 @@ void lv_font_free(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
-static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
+static lv_font_t * load_font(const char * font_name, load_mode_t mode, uint32_t cache_size)
+{
+    uint32_t t_start = lv_tick_get();
+
+    font_loader_t ld;
+    lv_memzero(&ld, sizeof(ld));
+
+    loaded_font_t * lfont = loader_malloc(&ld, sizeof(loaded_font_t));
+    if(lfont == NULL) return NULL;
+    lv_memzero(lfont, sizeof(loaded_font_t));
+
+    lv_fs_res_t res = lv_fs_open(&lfont->file, font_name, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK) {
+        lv_free(lfont);
+        return NULL;
+    }
+    ld.fp = &lfont->file;
+
+    if(mode == LOAD_MODE_MAPPED) {
+        const void * buf;
+        if(lv_fs_map(ld.fp, &buf, &ld.map_size) == LV_FS_RES_OK) {
+            ld.map = buf;
+            /*Set the map already to let `lv_font_free` know which tables are not allocated*/
+            lfont->map = ld.map;
+            lfont->map_size = ld.map_size;
+        }
+        else {
+            LV_LOG_INFO("The file can't be mapped, loading the font normally");
+        }
+    }
+    else if(mode == LOAD_MODE_STREAMED) {
+        font_stream_t * stream = loader_malloc(&ld, sizeof(font_stream_t));
+        if(stream == NULL) {
+            lv_fs_close(&lfont->file);
+            lv_font_free(&lfont->font);
+            return NULL;
+        }
+        lv_memzero(stream, sizeof(font_stream_t));
+        lv_mutex_init(&stream->mutex);
+        lv_hash_lru_init(&stream->entries);
+        stream->cache_max = cache_size;
+        lfont->stream = stream;
+        ld.stream = stream;
+    }
+
+    lv_font_t * font = &lfont->font;
+    bool loaded = lvgl_load_font(&ld, font);
+
+    /*Only the mapped and streamed fonts need the file later*/
+    if(lfont->map == NULL && lfont->stream == NULL) {
+        lv_fs_close(&lfont->file);
+    }
+
+    if(!loaded) {
+        LV_LOG_WARN("Error loading font file: %s\n", font_name);
+        /*
+        * When `lvgl_load_font` fails it can leak some pointers.
+        * All non-null pointers can be assumed as allocated and
+        * `lv_font_free` should free them correctly.
+        */
+        lv_font_free(font);
+        return NULL;
+    }
+
+    if(lfont->stream) {
+        lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+        font_dsc->acquire_glyph_bitmap_cb = stream_acquire_bitmap;
+        font_dsc->release_glyph_bitmap_cb = stream_release_bitmap;
+        font->prefetch_cb = stream_prefetch;
+    }
+
+    lfont->info.load_time = lv_tick_elaps(t_start);
+    lfont->info.heap_size = ld.heap_size;
+    lfont->info.mapped_size = ld.map_size;
+    LV_LOG_INFO("Font loaded in %" LV_PRIu32 " ms, heap: %" LV_PRIu32 " bytes, mapped: %" LV_PRIu32 " bytes",
+                lfont->info.load_time, lfont->info.heap_size, lfont->info.mapped_size);
+
+    return font;
+}
+
+static void * loader_malloc(font_loader_t * ld, uint32_t size)
+{
+    void * p = lv_malloc(size);
+    if(p) ld->heap_size += size;
+    return p;
+}
+
+static lv_fs_res_t loader_read(font_loader_t * ld, void * buf, uint32_t btr)
+{
+    if(ld->map == NULL) return lv_fs_read(ld->fp, buf, btr, NULL);
+
+    if(btr > ld->map_size - ld->pos) return LV_FS_RES_FS_ERR;
+    lv_memcpy(buf, ld->map + ld->pos, btr);
+    ld->pos += btr;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t loader_seek(font_loader_t * ld, uint32_t pos)
+{
+    if(ld->map == NULL) return lv_fs_seek(ld->fp, pos, LV_FS_SEEK_SET);
+
+    if(pos > ld->map_size) return LV_FS_RES_FS_ERR;
+    ld->pos = pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Get a table from the current position. If the file is mapped and the table is aligned
+ * it's used in place, else it's allocated and read.
+ * `*table_p` is set before reading to let `lv_font_free` free it if reading fails.
+ */
+static bool load_table(font_loader_t * ld, const void ** table_p, uint32_t size, uint32_t align)
+{
+    if(ld->map && size <= ld->map_size - ld->pos && ((lv_uintptr_t)(ld->map + ld->pos) & (align - 1)) == 0) {
+        *table_p = ld->map + ld->pos;
+        ld->pos += size;
+        return true;
+    }
+
+    void * table = loader_malloc(ld, size);
+    *table_p = table;
+    if(table == NULL && size != 0) return false;
+
+    return loader_read(ld, table, size) == LV_FS_RES_OK;
+}
+
+/**
+ * Free a table of a font if it was allocated and not used from the mapped file
+ */
+static void free_table(loaded_font_t * lfont, const void * table)
+{
+    if(table == NULL) return;
+
+    const uint8_t * p = table;
+    if(lfont->map && p >= lfont->map && p < lfont->map + lfont->map_size) return;
+
+    lv_free((void *)table);
+}
+
+static const uint8_t * stream_acquire_bitmap(const lv_font_t * font, uint32_t glyph_id)
+{
+    loaded_font_t * lfont = (loaded_font_t *)font;
+    font_stream_t * stream = lfont->stream;
+
+    lv_mutex_lock(&stream->mutex);
+    stream_entry_t * entry = stream_get(lfont, glyph_id);
+    if(entry) entry->ref_cnt++;
+    lv_mutex_unlock(&stream->mutex);
+
+    return entry ? (const uint8_t *)(entry + 1) : NULL;
+}
+
+static void stream_release_bitmap(const lv_font_t * font, const uint8_t * bitmap)
+{
+    loaded_font_t * lfont = (loaded_font_t *)font;
+    stream_entry_t * entry = (stream_entry_t *)bitmap - 1;
+
+    lv_mutex_lock(&lfont->stream->mutex);
+    entry->ref_cnt--;
+    lv_mutex_unlock(&lfont->stream->mutex);
+}
+
+/**
+ * Read the bitmaps of the letters of a text which are not cached yet.
+ * Stop if the cache is filled to not to evict the glyphs of the same text.
+ */
+static void stream_prefetch(const lv_font_t * font, const char * txt)
+{
+    loaded_font_t * lfont = (loaded_font_t *)font;
+    font_stream_t * stream = lfont->stream;
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+
+    lv_mutex_lock(&stream->mutex);
+    uint32_t prefetched = 0;
+    uint32_t i = 0;
+    while(txt[i] != '\0' && prefetched < stream->cache_max) {
+        uint32_t letter = _lv_text_encoded_next(txt, &i);
+        uint32_t glyph_id = lv_font_fmt_txt_get_glyph_id(font, letter);
+        if(glyph_id == 0) continue;
+
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[glyph_id];
+        if(gdsc->box_w * gdsc->box_h == 0) continue;
+
+        stream_entry_t * entry = stream_get(lfont, glyph_id);
+        if(entry) prefetched += entry->node.size;
+    }
+    lv_mutex_unlock(&stream->mutex);
+}
+
+/**
+ * Get the bitmap of a glyph from the cache or read it from the file.
+ * The least recently used bitmaps are freed if the cache is full. Needs to be called with locked mutex.
+ */
+static stream_entry_t * stream_get(loaded_font_t * lfont, uint32_t glyph_id)
+{
+    font_stream_t * stream = lfont->stream;
+    if(glyph_id >= stream->glyph_cnt) return NULL;
+
+    stream_entry_t * entry = (stream_entry_t *)lv_hash_lru_find_first(&stream->entries, glyph_id);
+    if(entry) {
+        lv_hash_lru_touch(&stream->entries, &entry->node);
+        stream->entries.stats.hit_cnt++;
+        return entry;
+    }
+
+    /*The bitmap starts after the header bits so read from the byte containing its first bit*/
+    uint32_t glyph_start = stream->glyph_offset[glyph_id];
+    uint32_t glyph_size = stream->glyph_offset[glyph_id + 1] - glyph_start;
+    if(glyph_size <= stream->header_bits / 8u) return NULL;
+    uint32_t bmp_size = glyph_size - stream->header_bits / 8;
+    uint32_t entry_size = sizeof(stream_entry_t) + bmp_size;
+
+    /*Make room by freeing the least recently used bitmaps which are not drawn right now*/
+    stream_entry_t * victim = (stream_entry_t *)stream->entries.lru_tail;
+    while(victim && stream->entries.stats.byte_cnt + entry_size > stream->cache_max) {
+        stream_entry_t * prev = (stream_entry_t *)victim->node.lru_prev;
+        if(victim->ref_cnt == 0) {
+            lv_hash_lru_remove(&stream->entries, &victim->node);
+            stream->entries.stats.evict_cnt++;
+            lv_free(victim);
+        }
+        victim = prev;
+    }
+
+    entry = lv_malloc(entry_size);
+    if(entry == NULL) {
+        LV_LOG_WARN("Couldn't allocate %" LV_PRIu32 " bytes for a glyph", entry_size);
+        return NULL;
+    }
+
+    uint8_t * bmp = (uint8_t *)(entry + 1);
+    if(lv_fs_seek(&lfont->file, stream->glyf_start + glyph_start + stream->header_bits / 8,
+                  LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+       lv_fs_read(&lfont->file, bmp, bmp_size, NULL) != LV_FS_RES_OK) {
+        LV_LOG_WARN("Couldn't read glyph %" LV_PRIu32, glyph_id);
+        lv_free(entry);
+        return NULL;
+    }
+
+    /*Shift out the header bits. The last fragment should be on the MSB as `load_glyph` does it.*/
+    uint32_t shift = stream->header_bits % 8;
+    if(shift) {
+        uint32_t k;
+        for(k = 0; k < bmp_size - 1; k++) {
+            bmp[k] = (uint8_t)((bmp[k] << shift) | (bmp[k + 1] >> (8 - shift)));
+        }
+        bmp[bmp_size - 1] = (uint8_t)(bmp[bmp_size - 1] << shift);
+    }
+
+    entry->glyph_id = glyph_id;
+    entry->ref_cnt = 0;
+    lv_hash_lru_add(&stream->entries, &entry->node, entry_size);
+    lv_hash_lru_index(&stream->entries, &entry->node, glyph_id);
+    stream->entries.stats.miss_cnt++;
+
+    return entry;
+}
+
+static void stream_free(loaded_font_t * lfont)
+{
+    font_stream_t * stream = lfont->stream;
+    lv_hash_lru_node_t * node = stream->entries.lru_head;
+    while(node) {
+        lv_hash_lru_node_t * next = node->lru_next;
+        lv_free(node);
+        node = next;
+    }
+    lv_hash_lru_deinit(&stream->entries);
+
+    lv_free(stream->glyph_offset);
+    lv_mutex_delete(&stream->mutex);
+    lv_free(stream);
+    lfont->stream = NULL;
+}
+
+static bit_iterator_t init_bit_iterator(font_loader_t * ld)
 {
     bit_iterator_t it;
-    it.fp = fp;
+    it.ld = ld;
     it.bit_pos = -1;
     it.byte_value = 0;
     return it;
@@ -202,7 +539,7 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
 
         if(it->bit_pos < 0) {
             it->bit_pos = 7;
-            *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
+            *res = loader_read(it->ld, &(it->byte_value), 1);
             if(*res != LV_FS_RES_OK) {
                 return 0;
             }
@@ -224,15 +561,15 @@ static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res)
     return value;
 }
 
-static int read_label(lv_fs_file_t * fp, int start, const char * label)
+static int read_label(font_loader_t * ld, int start, const char * label)
 {
-    lv_fs_seek(fp, start, LV_FS_SEEK_SET);
+    loader_seek(ld, start);
 
     uint32_t length;
     char buf[4];
 
-    if(lv_fs_read(fp, &length, 4, NULL) != LV_FS_RES_OK
-       || lv_fs_read(fp, buf, 4, NULL) != LV_FS_RES_OK
+    if(loader_read(ld, &length, 4) != LV_FS_RES_OK
+       || loader_read(ld, buf, 4) != LV_FS_RES_OK
        || memcmp(label, buf, 4) != 0) {
         LV_LOG_WARN("Error reading '%s' label.", label);
         return -1;
@@ -241,15 +578,15 @@ static int read_label(lv_fs_file_t * fp, int start, const char * label)
     return length;
 }
 
-static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+static bool load_cmaps_tables(font_loader_t * ld, lv_font_fmt_txt_dsc_t * font_dsc,
                               uint32_t cmaps_start, cmap_table_bin_t * cmap_table)
 {
-    if(lv_fs_read(fp, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t), NULL) != LV_FS_RES_OK) {
+    if(loader_read(ld, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
     for(unsigned int i = 0; i < font_dsc->cmap_num; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, cmaps_start + cmap_table[i].data_offset, LV_FS_SEEK_SET);
+        lv_fs_res_t res = loader_seek(ld, cmaps_start + cmap_table[i].data_offset);
         if(res != LV_FS_RES_OK) {
             return false;
         }
@@ -263,12 +600,11 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
 
         switch(cmap_table[i].format_type) {
             case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
-                    uint8_t ids_size = sizeof(uint8_t) * cmap_table[i].data_entries_count;
-                    uint8_t * glyph_id_ofs_list = lv_malloc(ids_size);
-
+                    uint32_t ids_size = sizeof(uint8_t) * cmap_table[i].data_entries_count;
+                    const void * glyph_id_ofs_list;
+                    bool ok = load_table(ld, &glyph_id_ofs_list, ids_size, sizeof(uint8_t));
                     cmap->glyph_id_ofs_list = glyph_id_ofs_list;
-
-                    if(lv_fs_read(fp, glyph_id_ofs_list, ids_size, NULL) != LV_FS_RES_OK) {
+                    if(!ok) {
                         return false;
                     }
 
@@ -280,21 +616,20 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
             case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
             case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: {
                     uint32_t list_size = sizeof(uint16_t) * cmap_table[i].data_entries_count;
-                    uint16_t * unicode_list = (uint16_t *)lv_malloc(list_size);
-
+                    const void * unicode_list;
+                    bool ok = load_table(ld, &unicode_list, list_size, sizeof(uint16_t));
                     cmap->unicode_list = unicode_list;
                     cmap->list_length = cmap_table[i].data_entries_count;
 
-                    if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
+                    if(!ok) {
                         return false;
                     }
 
                     if(cmap_table[i].format_type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-                        uint16_t * buf = lv_malloc(sizeof(uint16_t) * cmap->list_length);
-
-                        cmap->glyph_id_ofs_list = buf;
-
-                        if(lv_fs_read(fp, buf, sizeof(uint16_t) * cmap->list_length, NULL) != LV_FS_RES_OK) {
+                        const void * glyph_id_ofs_list;
+                        ok = load_table(ld, &glyph_id_ofs_list, sizeof(uint16_t) * cmap->list_length, sizeof(uint16_t));
+                        cmap->glyph_id_ofs_list = glyph_id_ofs_list;
+                        if(!ok) {
                             return false;
                         }
                     }
@@ -308,20 +643,20 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
     return true;
 }
 
-static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
+static int32_t load_cmaps(font_loader_t * ld, lv_font_fmt_txt_dsc_t * font_dsc, uint32_t cmaps_start)
 {
-    int32_t cmaps_length = read_label(fp, cmaps_start, "cmap");
+    int32_t cmaps_length = read_label(ld, cmaps_start, "cmap");
     if(cmaps_length < 0) {
         return -1;
     }
 
     uint32_t cmaps_subtables_count;
-    if(lv_fs_read(fp, &cmaps_subtables_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(loader_read(ld, &cmaps_subtables_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
     lv_font_fmt_txt_cmap_t * cmaps =
-        lv_malloc(cmaps_subtables_count * sizeof(lv_font_fmt_txt_cmap_t));
+        loader_malloc(ld, cmaps_subtables_count * sizeof(lv_font_fmt_txt_cmap_t));
 
     memset(cmaps, 0, cmaps_subtables_count * sizeof(lv_font_fmt_txt_cmap_t));
 
@@ -330,39 +665,49 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
 
     cmap_table_bin_t * cmaps_tables = lv_malloc(sizeof(cmap_table_bin_t) * font_dsc->cmap_num);
 
-    bool success = load_cmaps_tables(fp, font_dsc, cmaps_start, cmaps_tables);
+    bool success = load_cmaps_tables(ld, font_dsc, cmaps_start, cmaps_tables);
 
     lv_free(cmaps_tables);
 
     return success ? cmaps_length : -1;
 }
 
-static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
+static int32_t load_glyph(font_loader_t * ld, lv_font_fmt_txt_dsc_t * font_dsc,
                           uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
 {
-    int32_t glyph_length = read_label(fp, start, "glyf");
+    int32_t glyph_length = read_label(ld, start, "glyf");
     if(glyph_length < 0) {
         return -1;
     }
 
     lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t *)
-                                              lv_malloc(loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
+                                              loader_malloc(ld, loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
 
     memset(glyph_dsc, 0, loca_count * sizeof(lv_font_fmt_txt_glyph_dsc_t));
 
     font_dsc->glyph_dsc = glyph_dsc;
 
+    int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+
+    /*If the bitmaps start on byte boundaries they can be used in place from the mapped file.
+     *The OS reads them from the file on the first access.
+     *Else they are shifted into a copy as the renderer needs the bitmaps to start on a byte.*/
+    bool bmp_in_place = ld->map != NULL && nbits % 8 == 0 && (uint32_t)start + glyph_length <= ld->map_size;
+#if LV_FONT_FMT_TXT_LARGE == 0
+    if(glyph_length >= (1 << 20)) bmp_in_place = false;    /*`bitmap_index` has only 20 bits*/
+#endif
+
     int cur_bmp_size = 0;
 
     for(unsigned int i = 0; i < loca_count; ++i) {
         lv_font_fmt_txt_glyph_dsc_t * gdsc = &glyph_dsc[i];
 
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+        lv_fs_res_t res = loader_seek(ld, start + glyph_offset[i]);
         if(res != LV_FS_RES_OK) {
             return -1;
         }
 
-        bit_iterator_t bit_it = init_bit_iterator(fp);
+        bit_iterator_t bit_it = init_bit_iterator(ld);
 
         if(header->advance_width_bits == 0) {
             gdsc->adv_w = header->default_advance_width;
@@ -398,7 +743,6 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             return -1;
         }
 
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
         int next_offset = (i < loca_count - 1) ? glyph_offset[i + 1] : (uint32_t)glyph_length;
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
@@ -410,26 +754,43 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             gdsc->ofs_y = 0;
         }
 
+        if(bmp_in_place) {
+            gdsc->bitmap_index = glyph_offset[i] + nbits / 8;
+            continue;
+        }
+
+        /*The bitmaps will be found by `glyph_offset` when streaming*/
+        if(ld->stream) continue;
+
         gdsc->bitmap_index = cur_bmp_size;
         if(gdsc->box_w * gdsc->box_h != 0) {
             cur_bmp_size += bmp_size;
         }
     }
 
-    uint8_t * glyph_bmp = (uint8_t *)lv_malloc(sizeof(uint8_t) * cur_bmp_size);
+    if(bmp_in_place) {
+        font_dsc->glyph_bitmap = ld->map + start;
+        return glyph_length;
+    }
+
+    if(ld->stream) {
+        ld->stream->glyf_start = start;
+        ld->stream->header_bits = nbits;
+        return glyph_length;
+    }
+
+    uint8_t * glyph_bmp = (uint8_t *)loader_malloc(ld, sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
 
     cur_bmp_size = 0;
 
     for(unsigned int i = 1; i < loca_count; ++i) {
-        lv_fs_res_t res = lv_fs_seek(fp, start + glyph_offset[i], LV_FS_SEEK_SET);
+        lv_fs_res_t res = loader_seek(ld, start + glyph_offset[i]);
         if(res != LV_FS_RES_OK) {
             return -1;
         }
-        bit_iterator_t bit_it = init_bit_iterator(fp);
-
-        int nbits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+        bit_iterator_t bit_it = init_bit_iterator(ld);
 
         read_bits(&bit_it, nbits, &res);
         if(res != LV_FS_RES_OK) {
@@ -444,7 +805,7 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
         if(nbits % 8 == 0) {  /*Fast path*/
-            if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
+            if(loader_read(ld, &glyph_bmp[cur_bmp_size], bmp_size) != LV_FS_RES_OK) {
                 return -1;
             }
         }
@@ -471,7 +832,7 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 }
 
 /*
- * Loads a `lv_font_t` from a binary file, given a `lv_fs_file_t`.
+ * Loads a `lv_font_t` from a binary file, given a `font_loader_t`.
  *
  * Memory allocations on `lvgl_load_font` should be immediately zeroed and
  * the pointer should be set on the `lv_font_t` data before any possible return.
@@ -479,26 +840,26 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * When something fails, it returns `false` and the memory on the `lv_font_t`
  * still needs to be freed using `lv_font_free`.
  *
- * `lv_font_free` will assume that all non-null pointers are allocated and
- * should be freed.
+ * `lv_font_free` will assume that all non-null pointers are allocated
+ * (or point into the mapped file) and should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(font_loader_t * ld, lv_font_t * font)
 {
     lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
+                                       loader_malloc(ld, sizeof(lv_font_fmt_txt_dsc_t));
 
     memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
 
     font->dsc = font_dsc;
 
     /*header*/
-    int32_t header_length = read_label(fp, 0, "head");
+    int32_t header_length = read_label(ld, 0, "head");
     if(header_length < 0) {
         return false;
     }
 
     font_header_bin_t font_header;
-    if(lv_fs_read(fp, &font_header, sizeof(font_header_bin_t), NULL) != LV_FS_RES_OK) {
+    if(loader_read(ld, &font_header, sizeof(font_header_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -516,20 +877,20 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     /*cmaps*/
     uint32_t cmaps_start = header_length;
-    int32_t cmaps_length = load_cmaps(fp, font_dsc, cmaps_start);
+    int32_t cmaps_length = load_cmaps(ld, font_dsc, cmaps_start);
     if(cmaps_length < 0) {
         return false;
     }
 
     /*loca*/
     uint32_t loca_start = cmaps_start + cmaps_length;
-    int32_t loca_length = read_label(fp, loca_start, "loca");
+    int32_t loca_length = read_label(ld, loca_start, "loca");
     if(loca_length < 0) {
         return false;
     }
 
     uint32_t loca_count;
-    if(lv_fs_read(fp, &loca_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(loader_read(ld, &loca_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -539,7 +900,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     if(font_header.index_to_loc_format == 0) {
         for(unsigned int i = 0; i < loca_count; ++i) {
             uint16_t offset;
-            if(lv_fs_read(fp, &offset, sizeof(uint16_t), NULL) != LV_FS_RES_OK) {
+            if(loader_read(ld, &offset, sizeof(uint16_t)) != LV_FS_RES_OK) {
                 failed = true;
                 break;
             }
@@ -547,7 +908,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
         }
     }
     else if(font_header.index_to_loc_format == 1) {
-        if(lv_fs_read(fp, glyph_offset, loca_count * sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(loader_read(ld, glyph_offset, loca_count * sizeof(uint32_t)) != LV_FS_RES_OK) {
             failed = true;
         }
     }
@@ -564,9 +925,18 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
-
-    lv_free(glyph_offset);
+                               ld, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+
+    if(ld->stream && glyph_length >= 0) {
+        /*Keep the offsets to find the bitmaps later*/
+        glyph_offset[loca_count] = glyph_length;
+        ld->stream->glyph_offset = glyph_offset;
+        ld->stream->glyph_cnt = loca_count;
+        ld->heap_size += sizeof(uint32_t) * (loca_count + 1);
+    }
+    else {
+        lv_free(glyph_offset);
+    }
 
     if(glyph_length < 0) {
         return false;
@@ -581,27 +951,27 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     uint32_t kern_start = glyph_start + glyph_length;
 
-    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+    int32_t kern_length = load_kern(ld, font_dsc, font_header.glyph_id_format, kern_start);
 
     return kern_length >= 0;
 }
 
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
+int32_t load_kern(font_loader_t * ld, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
 {
-    int32_t kern_length = read_label(fp, start, "kern");
+    int32_t kern_length = read_label(ld, start, "kern");
     if(kern_length < 0) {
         return -1;
     }
 
     uint8_t kern_format_type;
     int32_t padding;
-    if(lv_fs_read(fp, &kern_format_type, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-       lv_fs_read(fp, &padding, 3 * sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+    if(loader_read(ld, &kern_format_type, sizeof(uint8_t)) != LV_FS_RES_OK ||
+       loader_read(ld, &padding, 3 * sizeof(uint8_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
     if(0 == kern_format_type) { /*sorted pairs*/
-        lv_font_fmt_txt_kern_pair_t * kern_pair = lv_malloc(sizeof(lv_font_fmt_txt_kern_pair_t));
+        lv_font_fmt_txt_kern_pair_t * kern_pair = loader_malloc(ld, sizeof(lv_font_fmt_txt_kern_pair_t));
 
         memset(kern_pair, 0, sizeof(lv_font_fmt_txt_kern_pair_t));
 
@@ -609,7 +979,7 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         font_dsc->kern_classes = 0;
 
         uint32_t glyph_entries;
-        if(lv_fs_read(fp, &glyph_entries, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(loader_read(ld, &glyph_entries, sizeof(uint32_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
@@ -621,25 +991,23 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
             ids_size = sizeof(int16_t) * 2 * glyph_entries;
         }
 
-        uint8_t * glyph_ids = lv_malloc(ids_size);
-        int8_t * values = lv_malloc(glyph_entries);
-
         kern_pair->glyph_ids_size = format;
         kern_pair->pair_cnt = glyph_entries;
-        kern_pair->glyph_ids = glyph_ids;
-        kern_pair->values = values;
 
-        if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
-            return -1;
+        const void * values;
+        bool ok = load_table(ld, &kern_pair->glyph_ids, ids_size, format == 0 ? sizeof(int8_t) : sizeof(int16_t));
+        if(ok) {
+            ok = load_table(ld, &values, glyph_entries, sizeof(int8_t));
+            kern_pair->values = values;
         }
 
-        if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
+        if(!ok) {
             return -1;
         }
     }
     else if(3 == kern_format_type) { /*array M*N of classes*/
 
-        lv_font_fmt_txt_kern_classes_t * kern_classes = lv_malloc(sizeof(lv_font_fmt_txt_kern_classes_t));
+        lv_font_fmt_txt_kern_classes_t * kern_classes = loader_malloc(ld, sizeof(lv_font_fmt_txt_kern_classes_t));
 
         memset(kern_classes, 0, sizeof(lv_font_fmt_txt_kern_classes_t));
 
@@ -650,27 +1018,32 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         uint8_t kern_table_rows;
         uint8_t kern_table_cols;
 
-        if(lv_fs_read(fp, &kern_class_mapping_length, sizeof(uint16_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_rows, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_cols, sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+        if(loader_read(ld, &kern_class_mapping_length, sizeof(uint16_t)) != LV_FS_RES_OK ||
+           loader_read(ld, &kern_table_rows, sizeof(uint8_t)) != LV_FS_RES_OK ||
+           loader_read(ld, &kern_table_cols, sizeof(uint8_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
         int kern_values_length = sizeof(int8_t) * kern_table_rows * kern_table_cols;
 
-        uint8_t * kern_left = lv_malloc(kern_class_mapping_length);
-        uint8_t * kern_right = lv_malloc(kern_class_mapping_length);
-        int8_t * kern_values = lv_malloc(kern_values_length);
-
-        kern_classes->left_class_mapping  = kern_left;
-        kern_classes->right_class_mapping = kern_right;
         kern_classes->left_class_cnt = kern_table_rows;
         kern_classes->right_class_cnt = kern_table_cols;
-        kern_classes->class_pair_values = kern_values;
 
-        if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
+        const void * kern_left = NULL;
+        const void * kern_right = NULL;
+        const void * kern_values = NULL;
+        bool ok = load_table(ld, &kern_left, kern_class_mapping_length, sizeof(uint8_t));
+        kern_classes->left_class_mapping  = kern_left;
+        if(ok) {
+            ok = load_table(ld, &kern_right, kern_class_mapping_length, sizeof(uint8_t));
+            kern_classes->right_class_mapping = kern_right;
+        }
+        if(ok) {
+            ok = load_table(ld, &kern_values, kern_values_length, sizeof(int8_t));
+            kern_classes->class_pair_values = kern_values;
+        }
+
+        if(!ok) {
             return -1;
         }
     }
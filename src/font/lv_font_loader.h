@@ -22,6 +22,14 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t load_time;     /**< Time of loading the font in milliseconds*/
+    uint32_t heap_size;     /**< Memory allocated for the font in bytes*/
+    uint32_t mapped_size;   /**< Size of the file used in place. Only the pages in use are kept in the RAM by the OS.*/
+    uint32_t cache_size;    /**< Streamed fonts: memory used by the glyph bitmaps read from the file*/
+    uint32_t read_cnt;      /**< Streamed fonts: number of glyph bitmaps read from the file so far*/
+} lv_font_load_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -33,6 +41,20 @@ extern "C" {
  */
 lv_font_t * lv_font_load(const char * fontName);
 
+/**
+ * Loads a `lv_font_t` object from a binary font file without copying its tables.
+ * The file is mapped into the memory (see `lv_fs_map`) and the cmaps, kerning tables and
+ * glyph bitmaps are used in place. Only the glyph descriptors are decoded and allocated.
+ * The glyph bitmaps are copied if the glyph headers are not a multiple of 8 bits, as the bitmaps
+ * need to start on byte boundaries. `lv_font_get_load_info` tells how much was allocated.
+ * The file is kept open until the font is freed.
+ * If the file can't be mapped the font is loaded as with `lv_font_load`.
+ * @param font_name filename where the font file is located.
+ *                  Can be also the path of a memory buffer created with `lv_fs_make_path_from_buffer`.
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_mapped(const char * font_name);
+
 
 #if LV_USE_FS_MEMFS
 /**
@@ -45,6 +67,26 @@ lv_font_t * lv_font_load(const char * fontName);
 lv_font_t * lv_font_load_from_buffer(void * buffer, uint32_t size);
 #endif
 
+/**
+ * Loads a `lv_font_t` object from a binary font file but read the glyph bitmaps only when they are used.
+ * Only the index of the glyphs (character maps, glyph descriptors and kerning) is loaded up front.
+ * The bitmaps read from the file are kept in an LRU cache of `cache_size` bytes.
+ * The bitmaps of a label's text are read when the text is set (see `lv_font_prefetch`).
+ * The file is kept open until the font is freed.
+ * @param font_name     filename where the font file is located
+ * @param cache_size    the bitmaps read from the file can use this many bytes.
+ *                      The bitmaps being drawn are not freed even if the cache is full.
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_streamed(const char * font_name, uint32_t cache_size);
+
+/**
+ * Get the statistics of loading a font
+ * @param font      a font loaded by `lv_font_load()`, `lv_font_load_mapped()` or `lv_font_load_streamed()`
+ * @param info      store the statistics here
+ */
+void lv_font_get_load_info(const lv_font_t * font, lv_font_load_info_t * info);
+
 /**
  * Frees the memory allocated by the `lv_font_load()` function
  * @param font lv_font_t object created by the lv_font_load function
@@ -33,9 +33,22 @@
 
 #define FRAME_DEF_REFR_PERIOD   33  /*[ms]*/
 
+#if LV_FFMPEG_DECODE_THREAD
+/*The queued frames and the shown one*/
+#define FRAME_SLOT_CNT              (LV_FFMPEG_FRAME_QUEUE_LEN + 1)
+#define DECODE_THREAD_STACK_SIZE    (64 * 1024)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_FFMPEG_DECODE_THREAD
+typedef struct {
+    uint8_t * data;
+    int64_t pts;            /*Presentation timestamp [ms]*/
+} ffmpeg_frame_t;
+#endif
+
 struct ffmpeg_context_s {
     AVFormatContext * fmt_ctx;
     AVCodecContext * video_dec_ctx;
@@ -50,6 +63,26 @@ struct ffmpeg_context_s {
     int video_dst_linesize[4];
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
+#if LV_FFMPEG_DECODE_THREAD
+    /*The frames are decoded by a thread into a ring buffer. The shown frame is right before the queued ones.*/
+    ffmpeg_frame_t frames[FRAME_SLOT_CNT];
+    ffmpeg_frame_t * decode_frame;  /*The frame the thread decodes into*/
+    bool decode_frame_ready;
+    int64_t next_pts;               /*Used if a frame has no timestamp*/
+    uint32_t shown;
+    uint32_t queue_start;
+    uint32_t queue_cnt;
+    int64_t clock_pts;              /*The presentation time at `clock_tick`*/
+    uint32_t clock_tick;
+    bool clock_valid;               /*false: restart the clock at the next shown frame*/
+    bool seek_req;                  /*The thread needs to rewind the video*/
+    bool eof;
+    bool thread_run;
+    lv_thread_t thread;
+    lv_mutex_t mutex;               /*Protects the queue and the flags*/
+    lv_thread_sync_t sync;          /*Wakes up the thread*/
+    lv_thread_sync_t exit_sync;     /*Signaled by the thread when it exits*/
+#endif
 };
 
 #pragma pack(1)
@@ -82,6 +115,16 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
 
+#if LV_FFMPEG_DECODE_THREAD
+static int ffmpeg_queue_init(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_queue_deinit(struct ffmpeg_context_s * ffmpeg_ctx);
+static int ffmpeg_queue_update(lv_ffmpeg_player_t * player);
+static void ffmpeg_queue_rewind(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_queue_reset_clock(struct ffmpeg_context_s * ffmpeg_ctx);
+static int ffmpeg_decode_into(struct ffmpeg_context_s * ffmpeg_ctx, ffmpeg_frame_t * frame);
+static void ffmpeg_decode_thread_cb(void * user_data);
+#endif
+
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 
@@ -150,35 +193,64 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     lv_timer_pause(player->timer);
 
     player->ffmpeg_ctx = ffmpeg_open_file(path);
+    player->dropped_frames = 0;
 
     if(!player->ffmpeg_ctx) {
         LV_LOG_ERROR("ffmpeg file open failed: %s", path);
         goto failed;
     }
 
+#if LV_FFMPEG_DECODE_THREAD
+    /*The YUV420 frames are drawn directly without converting them to RGB.
+     *Only the limited range is supported which is used by the most videos.*/
+    if(player->ffmpeg_ctx->video_dec_ctx->pix_fmt == AV_PIX_FMT_YUV420P &&
+       player->ffmpeg_ctx->video_dec_ctx->color_range != AVCOL_RANGE_JPEG) {
+        player->ffmpeg_ctx->video_dst_pix_fmt = AV_PIX_FMT_YUV420P;
+    }
+#endif
+
     if(ffmpeg_image_allocate(player->ffmpeg_ctx) < 0) {
         LV_LOG_ERROR("ffmpeg image allocate failed");
         ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
+        goto failed;
+    }
+
+#if LV_FFMPEG_DECODE_THREAD
+    if(ffmpeg_queue_init(player->ffmpeg_ctx) < 0) {
+        LV_LOG_ERROR("ffmpeg frame queue init failed");
+        ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
         goto failed;
     }
+#endif
 
     bool has_alpha = player->ffmpeg_ctx->has_alpha;
     int width = player->ffmpeg_ctx->video_dec_ctx->width;
     int height = player->ffmpeg_ctx->video_dec_ctx->height;
     uint32_t data_size = 0;
+    lv_color_format_t cf = has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
 
     data_size = width * height * 4;
 
+    if(player->ffmpeg_ctx->video_dst_pix_fmt == AV_PIX_FMT_YUV420P) {
+        cf = LV_COLOR_FORMAT_I420;
+        data_size = av_image_get_buffer_size(AV_PIX_FMT_YUV420P, width, height, 1);
+    }
 
     player->imgdsc.header.always_zero = 0;
     player->imgdsc.header.w = width;
     player->imgdsc.header.h = height;
     player->imgdsc.data_size = data_size;
-    player->imgdsc.header.cf = has_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE;
+    player->imgdsc.header.cf = cf;
     player->imgdsc.data = ffmpeg_get_image_data(player->ffmpeg_ctx);
 
     lv_image_set_src(&player->img.obj, &(player->imgdsc));
 
+#if LV_FFMPEG_DECODE_THREAD
+    /*The frames are shown at their timestamps so check the queue at every display refresh*/
+    lv_timer_set_period(player->timer, LV_DEF_REFR_PERIOD);
+#else
     int period = ffmpeg_get_frame_refr_period(player->ffmpeg_ctx);
 
     if(period > 0) {
@@ -189,6 +261,7 @@ lv_result_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     else {
         LV_LOG_WARN("unable to get frame refresh period");
     }
+#endif
 
     res = LV_RESULT_OK;
 
@@ -210,14 +283,22 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
 
     switch(cmd) {
         case LV_FFMPEG_PLAYER_CMD_START:
+#if LV_FFMPEG_DECODE_THREAD
+            ffmpeg_queue_rewind(player->ffmpeg_ctx);
+#else
             av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
                           0, 0, AVSEEK_FLAG_BACKWARD);
+#endif
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player start");
             break;
         case LV_FFMPEG_PLAYER_CMD_STOP:
+#if LV_FFMPEG_DECODE_THREAD
+            ffmpeg_queue_rewind(player->ffmpeg_ctx);
+#else
             av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
                           0, 0, AVSEEK_FLAG_BACKWARD);
+#endif
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player stop");
             break;
@@ -226,6 +307,10 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
             LV_LOG_INFO("ffmpeg player pause");
             break;
         case LV_FFMPEG_PLAYER_CMD_RESUME:
+#if LV_FFMPEG_DECODE_THREAD
+            /*Continue with the next frame instead of catching up with the time of the pause*/
+            ffmpeg_queue_reset_clock(player->ffmpeg_ctx);
+#endif
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player resume");
             break;
@@ -242,6 +327,13 @@ void lv_ffmpeg_player_set_auto_restart(lv_obj_t * obj, bool en)
     player->auto_restart = en;
 }
 
+uint32_t lv_ffmpeg_player_get_dropped_frames(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
+    return player->dropped_frames;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -316,6 +408,13 @@ static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 
 static uint8_t * ffmpeg_get_image_data(struct ffmpeg_context_s * ffmpeg_ctx)
 {
+#if LV_FFMPEG_DECODE_THREAD
+    /*The player shows the frames of the queue*/
+    if(ffmpeg_ctx->frames[0].data) {
+        return ffmpeg_ctx->frames[ffmpeg_ctx->shown].data;
+    }
+#endif
+
     uint8_t * img_data = ffmpeg_ctx->video_dst_data[0];
 
     if(img_data == NULL) {
@@ -381,6 +480,32 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 
     LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
 
+#if LV_FFMPEG_DECODE_THREAD
+    if(ffmpeg_ctx->decode_frame) {
+        /*Convert the timestamp to ms to show the frame in time*/
+        int64_t pts = frame->best_effort_timestamp;
+        if(pts != AV_NOPTS_VALUE) {
+            pts = av_rescale_q(pts, ffmpeg_ctx->video_stream->time_base, av_make_q(1, 1000));
+        }
+        else {
+            pts = ffmpeg_ctx->next_pts;
+        }
+
+        int period = ffmpeg_get_frame_refr_period(ffmpeg_ctx);
+        ffmpeg_ctx->next_pts = pts + (period > 0 ? period : FRAME_DEF_REFR_PERIOD);
+        ffmpeg_ctx->decode_frame->pts = pts;
+        ffmpeg_ctx->decode_frame_ready = true;
+    }
+
+    /*E.g. the YUV420 frames are drawn as they are. Only their planes are copied after each other.*/
+    if(ffmpeg_ctx->video_dst_pix_fmt == ffmpeg_ctx->video_dec_ctx->pix_fmt) {
+        av_image_copy(ffmpeg_ctx->video_dst_data, ffmpeg_ctx->video_dst_linesize,
+                      (const uint8_t **)(frame->data), frame->linesize,
+                      ffmpeg_ctx->video_dec_ctx->pix_fmt, width, height);
+        return 0;
+    }
+#endif
+
     /* copy decoded frame to destination buffer:
      * this is required since rawvideo expects non aligned data
      */
@@ -774,6 +899,11 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
         return;
     }
 
+#if LV_FFMPEG_DECODE_THREAD
+    /*Stop the decoding first as it uses everything*/
+    ffmpeg_queue_deinit(ffmpeg_ctx);
+#endif
+
     sws_freeContext(ffmpeg_ctx->sws_ctx);
     ffmpeg_close_src_ctx(ffmpeg_ctx);
     ffmpeg_close_dst_ctx(ffmpeg_ctx);
@@ -782,6 +912,241 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
     LV_LOG_INFO("ffmpeg_ctx closed");
 }
 
+#if LV_FFMPEG_DECODE_THREAD
+static int ffmpeg_queue_init(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    int width = ffmpeg_ctx->video_dec_ctx->width;
+    int height = ffmpeg_ctx->video_dec_ctx->height;
+
+    /*The frames are decoded right into the queue*/
+    ffmpeg_close_dst_ctx(ffmpeg_ctx);
+
+    int size = av_image_get_buffer_size(ffmpeg_ctx->video_dst_pix_fmt, width, height, 1);
+    if(size < 0) {
+        LV_LOG_ERROR("Could not get the frame size");
+        return size;
+    }
+
+    uint32_t i;
+    for(i = 0; i < FRAME_SLOT_CNT; i++) {
+        ffmpeg_ctx->frames[i].data = av_malloc(size);
+        if(ffmpeg_ctx->frames[i].data == NULL) {
+            LV_LOG_ERROR("Could not allocate the frame queue");
+            return -1;
+        }
+    }
+
+    LV_LOG_INFO("allocate %d frames of %d bytes", FRAME_SLOT_CNT, size);
+
+    /*Show the first frame until the video is started. The decoder might need more packets for a frame.*/
+    int ret;
+    do {
+        ret = ffmpeg_decode_into(ffmpeg_ctx, &ffmpeg_ctx->frames[0]);
+    } while(ret == 0);
+
+    if(ret < 0) {
+        LV_LOG_ERROR("Could not decode the first frame");
+        return ret;
+    }
+
+    ffmpeg_ctx->shown = 0;
+    ffmpeg_ctx->queue_start = 1;
+    ffmpeg_ctx->queue_cnt = 0;
+    ffmpeg_ctx->clock_valid = false;
+    ffmpeg_ctx->seek_req = true;    /*Decode ahead from the beginning*/
+    ffmpeg_ctx->eof = false;
+
+    lv_mutex_init(&ffmpeg_ctx->mutex);
+    lv_thread_sync_init(&ffmpeg_ctx->sync);
+    lv_thread_sync_init(&ffmpeg_ctx->exit_sync);
+
+    ffmpeg_ctx->thread_run = true;
+    if(lv_thread_init(&ffmpeg_ctx->thread, LV_THREAD_PRIO_MID, ffmpeg_decode_thread_cb, DECODE_THREAD_STACK_SIZE,
+                      ffmpeg_ctx) != LV_RESULT_OK) {
+        LV_LOG_ERROR("Could not create the decoder thread");
+        ffmpeg_ctx->thread_run = false;
+        lv_mutex_delete(&ffmpeg_ctx->mutex);
+        lv_thread_sync_delete(&ffmpeg_ctx->sync);
+        lv_thread_sync_delete(&ffmpeg_ctx->exit_sync);
+        return -1;
+    }
+
+    return 0;
+}
+
+static void ffmpeg_queue_deinit(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    /*Not a player's context*/
+    if(ffmpeg_ctx->frames[0].data == NULL) return;
+
+    if(ffmpeg_ctx->thread_run) {
+        lv_mutex_lock(&ffmpeg_ctx->mutex);
+        ffmpeg_ctx->thread_run = false;
+        lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+        lv_thread_sync_wait(&ffmpeg_ctx->exit_sync);
+        lv_thread_delete(&ffmpeg_ctx->thread);
+
+        lv_mutex_delete(&ffmpeg_ctx->mutex);
+        lv_thread_sync_delete(&ffmpeg_ctx->sync);
+        lv_thread_sync_delete(&ffmpeg_ctx->exit_sync);
+    }
+
+    /*`video_dst_data` pointed to one of the frames*/
+    ffmpeg_ctx->video_dst_data[0] = NULL;
+
+    uint32_t i;
+    for(i = 0; i < FRAME_SLOT_CNT; i++) {
+        av_freep(&ffmpeg_ctx->frames[i].data);
+    }
+}
+
+/**
+ * Show the last frame of the queue whose time has come. The earlier ones are dropped.
+ * @param player    pointer to a ffmpeg_player object
+ * @return          1: a new frame is shown; 0: no new frame is due; -1: the video ended
+ */
+static int ffmpeg_queue_update(lv_ffmpeg_player_t * player)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
+    int32_t shown = -1;
+    uint32_t dropped = 0;
+    bool ended = false;
+
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+
+    /*The queued frames are invalid until the thread rewinds the video*/
+    if(!ffmpeg_ctx->seek_req) {
+        /*Start the clock at the first frame*/
+        if(!ffmpeg_ctx->clock_valid && ffmpeg_ctx->queue_cnt > 0) {
+            ffmpeg_ctx->clock_pts = ffmpeg_ctx->frames[ffmpeg_ctx->queue_start].pts;
+            ffmpeg_ctx->clock_tick = lv_tick_get();
+            ffmpeg_ctx->clock_valid = true;
+        }
+
+        int64_t now = ffmpeg_ctx->clock_pts + lv_tick_elaps(ffmpeg_ctx->clock_tick);
+        while(ffmpeg_ctx->clock_valid && ffmpeg_ctx->queue_cnt > 0 &&
+              ffmpeg_ctx->frames[ffmpeg_ctx->queue_start].pts <= now) {
+            if(shown >= 0) dropped++;
+            shown = ffmpeg_ctx->queue_start;
+            ffmpeg_ctx->queue_start = (ffmpeg_ctx->queue_start + 1) % FRAME_SLOT_CNT;
+            ffmpeg_ctx->queue_cnt--;
+        }
+
+        /*The previously shown frame can be reused by the thread*/
+        if(shown >= 0) ffmpeg_ctx->shown = shown;
+
+        ended = ffmpeg_ctx->eof && ffmpeg_ctx->queue_cnt == 0;
+    }
+
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+    if(dropped) {
+        player->dropped_frames += dropped;
+        LV_LOG_INFO("%d frames dropped, %d in total", (int)dropped, (int)player->dropped_frames);
+    }
+
+    if(shown >= 0) {
+        /*The new frame is set before the next refresh, so the thread can't overwrite the drawn one*/
+        player->imgdsc.data = ffmpeg_ctx->frames[shown].data;
+        lv_thread_sync_signal(&ffmpeg_ctx->sync);
+        return 1;
+    }
+
+    return ended ? -1 : 0;
+}
+
+static void ffmpeg_queue_rewind(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    ffmpeg_ctx->seek_req = true;
+    ffmpeg_ctx->clock_valid = false;
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+    lv_thread_sync_signal(&ffmpeg_ctx->sync);
+}
+
+static void ffmpeg_queue_reset_clock(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    lv_mutex_lock(&ffmpeg_ctx->mutex);
+    ffmpeg_ctx->clock_valid = false;
+    lv_mutex_unlock(&ffmpeg_ctx->mutex);
+}
+
+/**
+ * Decode the next frame of the video into a frame of the queue
+ * @param ffmpeg_ctx    the context of a player
+ * @param frame         decode into this frame
+ * @return              1: decoded; 0: no frame yet, the decoder needs more packets; < 0: end of the video or error
+ */
+static int ffmpeg_decode_into(struct ffmpeg_context_s * ffmpeg_ctx, ffmpeg_frame_t * frame)
+{
+    av_image_fill_arrays(ffmpeg_ctx->video_dst_data, ffmpeg_ctx->video_dst_linesize, frame->data,
+                         ffmpeg_ctx->video_dst_pix_fmt,
+                         ffmpeg_ctx->video_dec_ctx->width, ffmpeg_ctx->video_dec_ctx->height, 1);
+
+    ffmpeg_ctx->decode_frame = frame;
+    ffmpeg_ctx->decode_frame_ready = false;
+    int ret = ffmpeg_update_next_frame(ffmpeg_ctx);
+    ffmpeg_ctx->decode_frame = NULL;
+
+    if(ret < 0) return ret;
+    return ffmpeg_ctx->decode_frame_ready ? 1 : 0;
+}
+
+static void ffmpeg_decode_thread_cb(void * user_data)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = user_data;
+
+    while(1) {
+        lv_mutex_lock(&ffmpeg_ctx->mutex);
+        if(!ffmpeg_ctx->thread_run) {
+            lv_mutex_unlock(&ffmpeg_ctx->mutex);
+            break;
+        }
+
+        /*Only take the request here. The seek can be slow so it's done without blocking the player's timer.*/
+        bool seek = ffmpeg_ctx->seek_req;
+        if(seek) {
+            ffmpeg_ctx->queue_cnt = 0;
+            ffmpeg_ctx->eof = false;
+            ffmpeg_ctx->seek_req = false;
+        }
+
+        /*The shown frame is right before the queue so the frame after the queue is free if the queue is not full*/
+        bool can_decode = !ffmpeg_ctx->eof && ffmpeg_ctx->queue_cnt < LV_FFMPEG_FRAME_QUEUE_LEN;
+        uint32_t slot = (ffmpeg_ctx->queue_start + ffmpeg_ctx->queue_cnt) % FRAME_SLOT_CNT;
+        lv_mutex_unlock(&ffmpeg_ctx->mutex);
+
+        /*Only this thread uses the decoder. The queue is empty so the player shows nothing from before the seek.*/
+        if(seek) {
+            av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+            avcodec_flush_buffers(ffmpeg_ctx->video_dec_ctx);
+            continue;
+        }
+
+        if(!can_decode) {
+            lv_thread_sync_wait(&ffmpeg_ctx->sync);
+            continue;
+        }
+
+        /*Decode without holding the mutex. Only this thread adds frames to the queue, so the slot stays free.*/
+        int ret = ffmpeg_decode_into(ffmpeg_ctx, &ffmpeg_ctx->frames[slot]);
+
+        lv_mutex_lock(&ffmpeg_ctx->mutex);
+        /*Drop the frame if the video was rewound meanwhile*/
+        if(!ffmpeg_ctx->seek_req) {
+            if(ret < 0) ffmpeg_ctx->eof = true;
+            else if(ret > 0) ffmpeg_ctx->queue_cnt++;
+        }
+        lv_mutex_unlock(&ffmpeg_ctx->mutex);
+    }
+
+    lv_thread_sync_signal(&ffmpeg_ctx->exit_sync);
+}
+#endif /*LV_FFMPEG_DECODE_THREAD*/
+
 static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
 {
     lv_obj_t * obj = (lv_obj_t *)timer->user_data;
@@ -791,7 +1156,12 @@ static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
         return;
     }
 
+#if LV_FFMPEG_DECODE_THREAD
+    int has_next = ffmpeg_queue_update(player);
+    if(has_next == 0) return;
+#else
     int has_next = ffmpeg_update_next_frame(player->ffmpeg_ctx);
+#endif
 
     if(has_next < 0) {
         lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
@@ -815,6 +1185,7 @@ static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p,
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
 
     player->auto_restart = false;
+    player->dropped_frames = 0;
     player->ffmpeg_ctx = NULL;
     player->timer = lv_timer_create(lv_ffmpeg_player_frame_update_cb,
                                     FRAME_DEF_REFR_PERIOD, obj);
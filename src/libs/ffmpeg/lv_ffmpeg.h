@@ -18,6 +18,9 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#if LV_FFMPEG_DECODE_THREAD && LV_USE_OS == LV_OS_NONE
+#error "LV_FFMPEG_DECODE_THREAD requires an operating system. Enable it in lv_conf.h (LV_USE_OS)"
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -31,6 +34,7 @@ typedef struct {
     lv_timer_t * timer;
     lv_image_dsc_t imgdsc;
     bool auto_restart;
+    uint32_t dropped_frames;
     struct ffmpeg_context_s * ffmpeg_ctx;
 } lv_ffmpeg_player_t;
 
@@ -87,6 +91,14 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd);
  */
 void lv_ffmpeg_player_set_auto_restart(lv_obj_t * obj, bool en);
 
+/**
+ * Get the number of decoded frames which were skipped as a later frame was already due.
+ * Only counted if `LV_FFMPEG_DECODE_THREAD` is enabled.
+ * @param obj pointer to a ffmpeg_player object
+ * @return number of dropped frames since the source was set
+ */
+uint32_t lv_ffmpeg_player_get_dropped_frames(lv_obj_t * obj);
+
 /*=====================
  * Other functions
  *====================*/
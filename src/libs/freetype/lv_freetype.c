@@ -16,6 +16,7 @@
 #include FT_SIZES_H
 #include FT_IMAGE_H
 #include FT_OUTLINE_H
+#include FT_LCD_FILTER_H
 
 #include "../../core/lv_global.h"
 /*********************
@@ -78,6 +79,8 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
 static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font,
                                                     uint32_t unicode_letter,
                                                     uint8_t * buf_out);
+static const uint8_t * freetype_copy_bitmap(const uint8_t * src, int pitch, uint32_t width, uint32_t rows,
+                                            uint8_t * buf_out);
 
 /**********************
 *  STATIC VARIABLES
@@ -107,6 +110,10 @@ lv_result_t lv_freetype_init(uint16_t max_faces, uint16_t max_sizes, uint32_t ma
         return LV_RESULT_INVALID;
     }
 
+    /*Reduce the color fringes of the subpixel glyphs.
+     *Without ClearType support FreeType uses its own method for LCD rendering and this fails, that's fine.*/
+    FT_Library_SetLcdFilter(context->library, FT_LCD_FILTER_DEFAULT);
+
     error = FTC_Manager_New(context->library,
                             max_faces,
                             max_sizes,
@@ -227,11 +234,26 @@ lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16
     return font;
 }
 
+void lv_freetype_font_set_subpx(lv_font_t * font, lv_font_subpx_t subpx)
+{
+    LV_ASSERT_NULL(font);
+    if(subpx != LV_FONT_SUBPX_NONE && subpx != LV_FONT_SUBPX_HOR) {
+        LV_LOG_WARN("only horizontal subpixel rendering is supported");
+        return;
+    }
+    if(font->subpx == subpx) return;
+
+    /*The glyphs are cached by FreeType with the render mode so only LVGL's caches need to be dropped*/
+    font->subpx = subpx;
+    lv_font_invalidate(font);
+}
+
 void lv_freetype_font_del(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
     LV_ASSERT_NULL(dsc);
+    lv_font_invalidate(font);
     FTC_Manager_RemoveFaceID(ft_ctx->cache_manager, (FTC_FaceID)dsc);
     lv_free(dsc->pathname);
     lv_free(dsc);
@@ -282,7 +304,7 @@ static FT_Error freetype_get_bold_glyph(const lv_font_t * font,
         }
     }
 
-    error = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL);
+    error = FT_Render_Glyph(face->glyph, font->subpx == LV_FONT_SUBPX_HOR ? FT_RENDER_MODE_LCD : FT_RENDER_MODE_NORMAL);
     if(error) {
         FT_ERROR_MSG("FT_Render_Glyph", error);
         return error;
@@ -358,7 +380,7 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
 
     FTC_ImageTypeRec desc_type;
     desc_type.face_id = face_id;
-    desc_type.flags = FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL;
+    desc_type.flags = FT_LOAD_RENDER | (font->subpx == LV_FONT_SUBPX_HOR ? FT_LOAD_TARGET_LCD : FT_LOAD_TARGET_NORMAL);
     desc_type.height = dsc->size;
     desc_type.width = dsc->size;
 
@@ -407,7 +429,8 @@ static bool freetype_get_glyph_dsc_cb(const lv_font_t * font,
 
 end:
     if((dsc->style & LV_FREETYPE_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
-        dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
+        int32_t box_w = font->subpx == LV_FONT_SUBPX_HOR ? dsc_out->box_w / 3 : dsc_out->box_w;
+        dsc_out->adv_w = box_w + dsc_out->ofs_x;
     }
 
     return true;
@@ -416,25 +439,54 @@ end:
 static const uint8_t * freetype_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter, uint8_t * buf_out)
 {
     LV_UNUSED(unicode_letter);
-    LV_UNUSED(buf_out);
 
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)font->dsc;
     lv_freetype_context_t * context = ft_ctx;
 
     if(dsc->style & LV_FREETYPE_FONT_STYLE_BOLD) {
         if(context->current_face && context->current_face->glyph->format == FT_GLYPH_FORMAT_BITMAP) {
-            return (const uint8_t *)(context->current_face->glyph->bitmap.buffer);
+            FT_Bitmap * bitmap = &context->current_face->glyph->bitmap;
+            return freetype_copy_bitmap(bitmap->buffer, bitmap->pitch, bitmap->width, bitmap->rows, buf_out);
         }
         return NULL;
     }
 
 #if LV_FREETYPE_SBIT_CACHE
-    return (const uint8_t *)context->sbit->buffer;
+    FTC_SBit sbit = context->sbit;
+    return freetype_copy_bitmap(sbit->buffer, sbit->pitch, sbit->width, sbit->height, buf_out);
 #else
     FT_BitmapGlyph glyph_bitmap = (FT_BitmapGlyph)context->image_glyph;
-    return (const uint8_t *)glyph_bitmap->bitmap.buffer;
+    return freetype_copy_bitmap(glyph_bitmap->bitmap.buffer, glyph_bitmap->bitmap.pitch, glyph_bitmap->bitmap.width,
+                                glyph_bitmap->bitmap.rows, buf_out);
 #endif
 }
 
+/**
+ * Return the bitmap as it is if its pitch is the same as LVGL's stride or copy it to `buf_out` otherwise.
+ * The rows of the LCD (subpixel) bitmaps are typically padded.
+ * @return      the bitmap with LVGL's stride or NULL if it needs to be copied but `buf_out` is NULL
+ */
+static const uint8_t * freetype_copy_bitmap(const uint8_t * src, int pitch, uint32_t width, uint32_t rows,
+                                            uint8_t * buf_out)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_A8);
+    if(pitch == (int)stride) return src;
+
+    if(buf_out == NULL) {
+        LV_LOG_WARN("the pitch of the bitmap is different from the stride, but there is no buffer to copy it");
+        return NULL;
+    }
+
+    uint8_t * dest = buf_out;
+    uint32_t y;
+    for(y = 0; y < rows; y++) {
+        lv_memcpy(dest, src, width);
+        src += pitch;
+        dest += stride;
+    }
+
+    return buf_out;
+}
+
 #endif /*LV_USE_FREETYPE*/
 
@@ -57,6 +57,14 @@ void lv_freetype_uninit(void);
  */
 lv_font_t * lv_freetype_font_create(const char * pathname, uint16_t size, uint16_t style);
 
+/**
+ * Render a freetype font with 3 times horizontal resolution for subpixel rendering.
+ * The subpixel order is set per display by `lv_display_set_subpx()`.
+ * @param font freetype font.
+ * @param subpx `LV_FONT_SUBPX_HOR` to enable or `LV_FONT_SUBPX_NONE` to disable subpixel rendering.
+ */
+void lv_freetype_font_set_subpx(lv_font_t * font, lv_font_subpx_t subpx);
+
 /**
  * Delete a freetype font.
  * @param font freetype font to be deleted.
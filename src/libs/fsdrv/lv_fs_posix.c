@@ -17,6 +17,8 @@
 #ifndef WIN32
     #include <dirent.h>
     #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
 #else
     #include <windows.h>
 #endif
@@ -49,6 +51,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#ifndef WIN32
+    static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p);
+    static lv_fs_res_t fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -81,6 +87,7 @@ void lv_fs_posix_init(void)
     /*Set up fields...*/
     fs_drv_p->letter = LV_FS_POSIX_LETTER;
     fs_drv_p->cache_size = LV_FS_POSIX_CACHE_SIZE;
+    fs_drv_p->thread_safe = true;
 
     fs_drv_p->open_cb = fs_open;
     fs_drv_p->close_cb = fs_close;
@@ -88,6 +95,10 @@ void lv_fs_posix_init(void)
     fs_drv_p->write_cb = fs_write;
     fs_drv_p->seek_cb = fs_seek;
     fs_drv_p->tell_cb = fs_tell;
+#ifndef WIN32
+    fs_drv_p->map_cb = fs_map;
+    fs_drv_p->unmap_cb = fs_unmap;
+#endif
 
     fs_drv_p->dir_close_cb = fs_dir_close;
     fs_drv_p->dir_open_cb = fs_dir_open;
@@ -219,6 +230,46 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return offset < 0 ? LV_FS_RES_FS_ERR : LV_FS_RES_OK;
 }
 
+#ifndef WIN32
+/**
+ * Map the whole file into the memory. The pages are read by the OS on the first access.
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable
+ * @param buf_p store the address of the mapped memory here
+ * @param size_p store the size of the file here
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_map(lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p)
+{
+    LV_UNUSED(drv);
+    struct stat st;
+    if(fstat(FILEP2FD(file_p), &st) != 0) return LV_FS_RES_FS_ERR;
+    if(st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) return LV_FS_RES_NOT_IMP;
+
+    void * buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, FILEP2FD(file_p), 0);
+    if(buf == MAP_FAILED) return LV_FS_RES_NOT_IMP;
+
+    *buf_p = buf;
+    *size_p = st.st_size;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Unmap a file mapped by `fs_map`
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable
+ * @param buf the mapped memory
+ * @param size the size of the mapped memory
+ * @return LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_unmap(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    return munmap((void *)buf, size) == 0 ? LV_FS_RES_OK : LV_FS_RES_FS_ERR;
+}
+#endif
+
 #ifdef WIN32
     static char next_fn[256];
 #endif
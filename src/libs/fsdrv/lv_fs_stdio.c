@@ -77,6 +77,7 @@ void lv_fs_stdio_init(void)
     /*Set up fields...*/
     fs_drv_p->letter = LV_FS_STDIO_LETTER;
     fs_drv_p->cache_size = LV_FS_STDIO_CACHE_SIZE;
+    fs_drv_p->thread_safe = true;
 
     fs_drv_p->open_cb = fs_open;
     fs_drv_p->close_cb = fs_close;
@@ -73,6 +73,7 @@ void lv_fs_win32_init(void)
     /*Set up fields...*/
     fs_drv_p->letter = LV_FS_WIN32_LETTER;
     fs_drv_p->cache_size = LV_FS_WIN32_CACHE_SIZE;
+    fs_drv_p->thread_safe = true;
 
     fs_drv_p->open_cb = fs_open;
     fs_drv_p->close_cb = fs_close;
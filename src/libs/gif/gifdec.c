@@ -17,7 +17,7 @@ typedef struct Entry {
     uint8_t  suffix;
 } Entry;
 
-typedef struct Table {
+typedef struct _gd_Table {
     int bulk;
     int nentries;
     Entry * entries;
@@ -296,21 +296,27 @@ read_ext(gd_GIF * gif)
     }
 }
 
+/* Reset the LZW code table for a new frame.
+ * The table is allocated only for the first frame and it's grown only if a frame needs more entries.
+ * Return NULL if out of memory. */
 static Table *
-new_table(int key_size)
+reset_table(gd_GIF * gif, int key_size)
 {
     int key;
     int init_bulk = MAX(1 << (key_size + 1), 0x100);
-    Table * table = lv_malloc(sizeof(*table) + sizeof(Entry) * init_bulk);
-    if(table) {
+    Table * table = gif->table;
+    if(!table || table->bulk < init_bulk) {
+        table = lv_realloc(table, sizeof(*table) + sizeof(Entry) * init_bulk);
+        if(!table) return NULL;
         table->bulk = init_bulk;
-        table->nentries = (1 << key_size) + 2;
         table->entries = (Entry *) &table[1];
-        for(key = 0; key < (1 << key_size); key++)
-            table->entries[key] = (Entry) {
-            1, 0xFFF, key
-        };
+        gif->table = table;
     }
+    table->nentries = (1 << key_size) + 2;
+    for(key = 0; key < (1 << key_size); key++)
+        table->entries[key] = (Entry) {
+        1, 0xFFF, key
+    };
     return table;
 }
 
@@ -411,7 +417,8 @@ read_image_data(gd_GIF * gif, int interlace)
     f_gif_seek(gif, start, LV_FS_SEEK_SET);
     clear = 1 << key_size;
     stop = clear + 1;
-    table = new_table(key_size);
+    table = reset_table(gif, key_size);
+    if(!table) return -1;
     key_size++;
     init_key_size = key_size;
     sub_len = shift = 0;
@@ -426,11 +433,9 @@ read_image_data(gd_GIF * gif, int interlace)
             table_is_full = 0;
         }
         else if(!table_is_full) {
-            ret = add_entry(&table, str_len + 1, key, entry.suffix);
-            if(ret == -1) {
-                lv_free(table);
-                return -1;
-            }
+            ret = add_entry(&gif->table, str_len + 1, key, entry.suffix);
+            if(ret == -1) return -1;
+            table = gif->table;
             if(table->nentries == 0x1000) {
                 ret = 0;
                 table_is_full = 1;
@@ -458,7 +463,6 @@ read_image_data(gd_GIF * gif, int interlace)
         if(key < table->nentries - 1 && !table_is_full)
             table->entries[table->nentries - 1].suffix = entry.suffix;
     }
-    lv_free(table);
     if(key == stop) f_gif_read(gif, &sub_len, 1);  /* Must be zero! */
     f_gif_seek(gif, end, LV_FS_SEEK_SET);
     return 0;
@@ -564,18 +568,46 @@ dispose(gd_GIF * gif)
         case 3: /* Restore to previous, i.e., don't update canvas.*/
             break;
         default:
-            /* Add frame non-transparent pixels to canvas. */
-            render_frame_rect(gif, gif->canvas);
+            /* Add frame non-transparent pixels to canvas if they are not there yet. */
+            if(!gif->canvas_rendered) render_frame_rect(gif, gif->canvas);
     }
 }
 
+/* Add an area to the changed area of the frame. */
+static void
+add_dirty_rect(gd_GIF * gif, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if(w == 0 || h == 0) return;
+
+    if(gif->dw == 0 || gif->dh == 0) {
+        gif->dx = x;
+        gif->dy = y;
+        gif->dw = w;
+        gif->dh = h;
+        return;
+    }
+
+    uint16_t x2 = MAX(gif->dx + gif->dw, x + w);
+    uint16_t y2 = MAX(gif->dy + gif->dh, y + h);
+    gif->dx = MIN(gif->dx, x);
+    gif->dy = MIN(gif->dy, y);
+    gif->dw = x2 - gif->dx;
+    gif->dh = y2 - gif->dy;
+}
+
 /* Return 1 if got a frame; 0 if got GIF trailer; -1 if error. */
 int
 gd_get_frame(gd_GIF * gif)
 {
     char sep;
 
+    /* Restoring the background changes the area of the previous frame too. */
+    gif->dw = gif->dh = 0;
+    if(gif->gce.disposal == 2)
+        add_dirty_rect(gif, gif->fx, gif->fy, gif->fw, gif->fh);
+
     dispose(gif);
+    gif->canvas_rendered = 0;
     f_gif_read(gif, &sep, 1);
     while(sep != ',') {
         if(sep == ';') {
@@ -594,6 +626,7 @@ gd_get_frame(gd_GIF * gif)
     }
     if(read_image(gif) == -1)
         return -1;
+    add_dirty_rect(gif, gif->fx, gif->fy, gif->fw, gif->fh);
     return 1;
 }
 
@@ -601,6 +634,7 @@ void
 gd_render_frame(gd_GIF * gif, uint8_t * buffer)
 {
     render_frame_rect(gif, buffer);
+    if(buffer == gif->canvas) gif->canvas_rendered = 1;
 }
 
 void
@@ -614,6 +648,7 @@ void
 gd_close_gif(gd_GIF * gif)
 {
     f_gif_close(gif);
+    lv_free(gif->table);
     lv_free(gif);
 }
 
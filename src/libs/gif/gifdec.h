@@ -41,8 +41,11 @@ typedef struct _gd_GIF {
     void (*comment)(struct _gd_GIF * gif);
     void (*application)(struct _gd_GIF * gif, char id[8], char auth[3]);
     uint16_t fx, fy, fw, fh;
+    uint16_t dx, dy, dw, dh;    /* Area changed by the last frame (dw = 0: nothing has changed) */
     uint8_t bgindex;
+    uint8_t canvas_rendered;    /* The current frame is already rendered to `canvas` */
     uint8_t * canvas, *frame;
+    struct _gd_Table * table;   /* LZW code table reused for all frames */
 } gd_GIF;
 
 gd_GIF * gd_open_gif_file(const char * fname);
@@ -27,6 +27,7 @@
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void invalidate_frame(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -154,10 +155,42 @@ static void next_frame_task_cb(lv_timer_t * t)
 
     gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
 
+    /*E.g. an empty frame which only sets the delay*/
+    if(gifobj->gif->dw == 0 || gifobj->gif->dh == 0) return;
+
     lv_cache_lock();
     lv_cache_invalidate(lv_cache_find(lv_img_get_src(obj), LV_CACHE_SRC_TYPE_PTR, 0, 0));
     lv_cache_unlock();
-    lv_obj_invalidate(obj);
+    invalidate_frame(obj);
+}
+
+/**
+ * Invalidate only the area changed by the last frame if the image is drawn 1:1,
+ * else the whole object as it's not trivial to know where the changed pixels are drawn.
+ * @param obj   pointer to a gif object
+ */
+static void invalidate_frame(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    lv_image_t * img = (lv_image_t *) obj;
+    gd_GIF * gif = gifobj->gif;
+
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+
+    /*Transformed or tiled*/
+    if(img->rotation != 0 || img->zoom != LV_SCALE_NONE || img->offset.x != 0 || img->offset.y != 0 ||
+       lv_area_get_width(&content) != img->w || lv_area_get_height(&content) != img->h) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t area;
+    area.x1 = content.x1 + gif->dx;
+    area.y1 = content.y1 + gif->dy;
+    area.x2 = area.x1 + gif->dw - 1;
+    area.y2 = area.y1 + gif->dh - 1;
+    lv_obj_invalidate_area(obj, &area);
 }
 
 #endif /*LV_USE_GIF*/
@@ -61,6 +61,8 @@ void lv_libjpeg_turbo_init(void)
     lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
     lv_image_decoder_set_close_cb(dec, decoder_close);
+    lv_image_decoder_set_cached(dec, true);
+    lv_image_decoder_set_thread_safe(dec, true);
 }
 
 void lv_libjpeg_turbo_deinit(void)
@@ -156,16 +158,26 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         const char * fn = dsc->src;
 
+        /*Decode without locking the cache as the image might be decoded in the background*/
+        uint32_t t = lv_tick_get();
+        const void * decoded_img = decode_jpeg_file(fn);
+        t = lv_tick_elaps(t);
+        if(decoded_img == NULL) return LV_RESULT_INVALID;
+
+        /*Another thread might have decoded the same image in the meantime*/
+        if(try_cache(dsc) == LV_RESULT_OK) {
+            lv_draw_buf_free((void *)decoded_img);
+            return LV_RESULT_OK;
+        }
+
         lv_cache_lock();
         lv_cache_entry_t * cache = lv_cache_add(dsc->header.w * dsc->header.h * JPEG_PIXEL_SIZE);
         if(cache == NULL) {
             lv_cache_unlock();
+            lv_draw_buf_free((void *)decoded_img);
             return LV_RESULT_INVALID;
         }
 
-        uint32_t t = lv_tick_get();
-        const void * decoded_img = decode_jpeg_file(fn);
-        t = lv_tick_elaps(t);
         cache->weight = t;
         cache->data = decoded_img;
         cache->free_data = 1;
@@ -206,7 +218,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         const char * fn = dsc->src;
 
-        lv_cache_entry_t * cache = lv_cache_find(fn, LV_CACHE_SRC_TYPE_STR, 0, 0);
+        lv_cache_entry_t * cache = lv_cache_find_counted(fn, LV_CACHE_SRC_TYPE_STR, 0, 0);
         if(cache) {
             dsc->img_data = lv_cache_get_data(cache);
             dsc->user_data = cache;     /*Save the cache to release it in decoder_close*/
@@ -5385,6 +5385,330 @@ unsigned lodepng_decode24(unsigned char ** out, unsigned * w, unsigned * h, cons
     return lodepng_decode_memory(out, w, h, in, insize, LCT_RGB, 8);
 }
 
+#ifdef LODEPNG_COMPILE_ZLIB
+/*
+LVGL extension: decode a PNG row by row.
+Only the compressed image data, the LZ77 window and two scanlines are kept in memory, so any band of rows
+can be decoded without decoding the whole image.
+*/
+
+#define ROW_DECODER_WINDOW_SIZE 32768u /*the max. distance of a back reference in deflate*/
+
+struct LodePNGRowDecoder {
+    LodePNGState state; /*the color mode of the PNG is in `state.info_png.color`*/
+    unsigned w, h;
+    unsigned y; /*the next row to decode*/
+    size_t linebytes; /*size of a row without the filter type byte*/
+    size_t bytewidth; /*bytes per pixel (at least 1) for the unfiltering*/
+    unsigned char * idat; /*the concatenated IDAT chunks*/
+    size_t idatsize;
+    unsigned char * scanline; /*filter type byte + the row being decoded*/
+    unsigned char * prevline; /*filter type byte + the previous unfiltered row*/
+
+    /*state of the inflator*/
+    LodePNGBitReader reader;
+    HuffmanTree tree_ll;
+    HuffmanTree tree_d;
+    unsigned char * window; /*the last `ROW_DECODER_WINDOW_SIZE` decompressed bytes*/
+    size_t window_pos; /*number of decompressed bytes so far*/
+    unsigned in_block; /*1: inside a deflate block*/
+    unsigned btype; /*type of the current block*/
+    unsigned bfinal; /*1: the current block is the last one*/
+    size_t stored_left; /*bytes left from a stored block*/
+    size_t copy_left; /*bytes left from a back reference*/
+    size_t copy_distance; /*distance of the back reference*/
+};
+
+static void rowDecoderResetInflate(LodePNGRowDecoder * dec)
+{
+    HuffmanTree_cleanup(&dec->tree_ll);
+    HuffmanTree_cleanup(&dec->tree_d);
+    HuffmanTree_init(&dec->tree_ll);
+    HuffmanTree_init(&dec->tree_d);
+    dec->window_pos = 0;
+    dec->in_block = 0;
+    dec->bfinal = 0;
+    dec->stored_left = 0;
+    dec->copy_left = 0;
+    dec->y = 0;
+}
+
+/*start to inflate the zlib stream in `idat` from the beginning*/
+static unsigned rowDecoderRewind(LodePNGRowDecoder * dec)
+{
+    const unsigned char * in = dec->idat;
+    rowDecoderResetInflate(dec);
+
+    if(dec->idatsize < 2) return 53; /*error, size of zlib data too small*/
+    if((in[0] * 256 + in[1]) % 31 != 0) return 24;
+    if((in[0] & 15) != 8 || ((in[0] >> 4) & 15) > 7) return 25;
+    if(((in[1] >> 5) & 1) != 0) return 26;
+
+    return LodePNGBitReader_init(&dec->reader, in + 2, dec->idatsize - 2);
+}
+
+/*read the header of the next deflate block*/
+static unsigned rowDecoderStartBlock(LodePNGRowDecoder * dec)
+{
+    LodePNGBitReader * reader = &dec->reader;
+
+    if(dec->bfinal) return 91; /*the image data ended before the last row*/
+    if(!ensureBits9(reader, 3)) return 52; /*error, bit pointer will jump past memory*/
+    dec->bfinal = readBits(reader, 1);
+    dec->btype = readBits(reader, 2);
+
+    if(dec->btype == 3) return 20; /*error: invalid BTYPE*/
+    if(dec->btype == 0) {
+        unsigned LEN, NLEN;
+        size_t bytepos = (reader->bp + 7u) >> 3u;
+        if(bytepos + 4 >= reader->size) return 52; /*error, bit pointer will jump past memory*/
+        LEN = (unsigned)reader->data[bytepos] + ((unsigned)reader->data[bytepos + 1] << 8u);
+        NLEN = (unsigned)reader->data[bytepos + 2] + ((unsigned)reader->data[bytepos + 3] << 8u);
+        if(!dec->state.decoder.zlibsettings.ignore_nlen && LEN + NLEN != 65535) return 21;
+        reader->bp = (bytepos + 4) << 3u;
+        dec->stored_left = LEN;
+    }
+    else {
+        unsigned error;
+        HuffmanTree_cleanup(&dec->tree_ll);
+        HuffmanTree_cleanup(&dec->tree_d);
+        HuffmanTree_init(&dec->tree_ll);
+        HuffmanTree_init(&dec->tree_d);
+        if(dec->btype == 1) error = getTreeInflateFixed(&dec->tree_ll, &dec->tree_d);
+        else error = getTreeInflateDynamic(&dec->tree_ll, &dec->tree_d, reader);
+        if(error) return error;
+    }
+
+    dec->in_block = 1;
+    return 0;
+}
+
+/*decode the next literal or back reference of a Huffman block. `*c` is set if it was a literal*/
+static unsigned rowDecoderDecodeSymbol(LodePNGRowDecoder * dec, int * c)
+{
+    LodePNGBitReader * reader = &dec->reader;
+    unsigned code_ll;
+
+    *c = -1;
+    ensureBits25(reader, 20); /* up to 15 for the huffman symbol, up to 5 for the length extra bits */
+    code_ll = huffmanDecodeSymbol(reader, &dec->tree_ll);
+    if(code_ll <= 255) {
+        *c = (int)code_ll;
+    }
+    else if(code_ll >= FIRST_LENGTH_CODE_INDEX && code_ll <= LAST_LENGTH_CODE_INDEX) {
+        unsigned code_d, numextrabits;
+        size_t length, distance;
+
+        length = LENGTHBASE[code_ll - FIRST_LENGTH_CODE_INDEX];
+        numextrabits = LENGTHEXTRA[code_ll - FIRST_LENGTH_CODE_INDEX];
+        if(numextrabits != 0) length += readBits(reader, numextrabits);
+
+        ensureBits32(reader, 28); /* up to 15 for the huffman symbol, up to 13 for the extra bits */
+        code_d = huffmanDecodeSymbol(reader, &dec->tree_d);
+        if(code_d > 29) return code_d <= 31 ? 18 : 16; /*invalid distance code or disallowed huffman symbol*/
+        distance = DISTANCEBASE[code_d];
+        numextrabits = DISTANCEEXTRA[code_d];
+        if(numextrabits != 0) distance += readBits(reader, numextrabits);
+
+        if(distance > dec->window_pos || distance > ROW_DECODER_WINDOW_SIZE) return 52; /*too long backward distance*/
+        dec->copy_left = length;
+        dec->copy_distance = distance;
+    }
+    else if(code_ll == 256) {
+        dec->in_block = 0; /*end code*/
+    }
+    else {
+        return 16; /*error: tried to read disallowed huffman symbol*/
+    }
+
+    if(reader->bp > reader->bitsize) return 51; /*error, bit pointer jumps past memory*/
+    return 0;
+}
+
+/*inflate the next `size` bytes of the image data to `out`*/
+static unsigned rowDecoderInflate(LodePNGRowDecoder * dec, unsigned char * out, size_t size)
+{
+    const size_t mask = ROW_DECODER_WINDOW_SIZE - 1;
+    size_t i = 0;
+    while(i < size) {
+        int c;
+        if(dec->copy_left) {
+            c = dec->window[(dec->window_pos - dec->copy_distance) & mask];
+            dec->copy_left--;
+        }
+        else if(!dec->in_block) {
+            unsigned error = rowDecoderStartBlock(dec);
+            if(error) return error;
+            continue;
+        }
+        else if(dec->btype == 0) {
+            size_t bytepos = dec->reader.bp >> 3u;
+            if(dec->stored_left == 0) {
+                dec->in_block = 0;
+                continue;
+            }
+            if(bytepos >= dec->reader.size) return 23; /*error: reading outside of in buffer*/
+            c = dec->reader.data[bytepos];
+            dec->reader.bp += 8;
+            dec->stored_left--;
+        }
+        else {
+            unsigned error = rowDecoderDecodeSymbol(dec, &c);
+            if(error) return error;
+            if(c < 0) continue; /*back reference or end of the block*/
+        }
+
+        dec->window[dec->window_pos & mask] = (unsigned char)c;
+        dec->window_pos++;
+        out[i++] = (unsigned char)c;
+    }
+
+    return 0;
+}
+
+unsigned lodepng_row_decoder_create(LodePNGRowDecoder ** out, unsigned * w, unsigned * h,
+                                    const unsigned char * in, size_t insize)
+{
+    const unsigned char * chunk;
+    unsigned IEND = 0;
+    unsigned error;
+    size_t bpp;
+    LodePNGRowDecoder * dec;
+
+    *out = 0;
+    dec = (LodePNGRowDecoder *)lodepng_malloc(sizeof(LodePNGRowDecoder));
+    if(!dec) return 83; /*alloc fail*/
+    lodepng_memset(dec, 0, sizeof(LodePNGRowDecoder));
+    lodepng_state_init(&dec->state);
+    HuffmanTree_init(&dec->tree_ll);
+    HuffmanTree_init(&dec->tree_d);
+
+    error = lodepng_inspect(&dec->w, &dec->h, &dec->state, in, insize);
+    if(!error && dec->state.info_png.interlace_method != 0) error = 114; /*Adam7 has no rows to stream*/
+
+    /*the input filesize is a safe upper bound for the sum of idat chunks size*/
+    if(!error) {
+        dec->idat = (unsigned char *)lodepng_malloc(insize);
+        if(!dec->idat) error = 83; /*alloc fail*/
+    }
+
+    /*collect the IDAT chunks and the color information. The CRCs are not checked to open quickly*/
+    chunk = &in[33];
+    while(!error && !IEND) {
+        unsigned chunkLength;
+        const unsigned char * data;
+        if((size_t)((chunk - in) + 12) > insize || chunk < in) {
+            error = 30;
+            break;
+        }
+        chunkLength = lodepng_chunk_length(chunk);
+        if(chunkLength > 2147483647 || (size_t)((chunk - in) + chunkLength + 12) > insize) {
+            error = 64;
+            break;
+        }
+
+        data = lodepng_chunk_data_const(chunk);
+        if(lodepng_chunk_type_equals(chunk, "IDAT")) {
+            lodepng_memcpy(dec->idat + dec->idatsize, data, chunkLength);
+            dec->idatsize += chunkLength;
+        }
+        else if(lodepng_chunk_type_equals(chunk, "PLTE")) {
+            error = readChunk_PLTE(&dec->state.info_png.color, data, chunkLength);
+        }
+        else if(lodepng_chunk_type_equals(chunk, "tRNS")) {
+            error = readChunk_tRNS(&dec->state.info_png.color, data, chunkLength);
+        }
+        else if(lodepng_chunk_type_equals(chunk, "IEND")) {
+            IEND = 1;
+        }
+        else if(!lodepng_chunk_ancillary(chunk)) {
+            error = 69; /*error: unknown critical chunk*/
+        }
+
+        if(!IEND) chunk = lodepng_chunk_next_const(chunk, in + insize);
+    }
+
+    if(!error && dec->state.info_png.color.colortype == LCT_PALETTE && !dec->state.info_png.color.palette) {
+        error = 106; /* error: PNG file must have PLTE chunk if color type is palette */
+    }
+
+    if(!error) {
+        bpp = lodepng_get_bpp(&dec->state.info_png.color);
+        dec->linebytes = lodepng_get_raw_size_idat(dec->w, 1, (unsigned)bpp) - 1;
+        dec->bytewidth = (bpp + 7u) / 8u;
+        dec->scanline = (unsigned char *)lodepng_malloc(dec->linebytes + 1);
+        dec->prevline = (unsigned char *)lodepng_malloc(dec->linebytes + 1);
+        dec->window = (unsigned char *)lodepng_malloc(ROW_DECODER_WINDOW_SIZE);
+        if(!dec->scanline || !dec->prevline || !dec->window) error = 83; /*alloc fail*/
+    }
+
+    if(!error) error = rowDecoderRewind(dec);
+
+    if(error) {
+        lodepng_row_decoder_delete(dec);
+        return error;
+    }
+
+    if(w) *w = dec->w;
+    if(h) *h = dec->h;
+    *out = dec;
+    return 0;
+}
+
+unsigned lodepng_row_decoder_next(LodePNGRowDecoder * dec, unsigned char * out)
+{
+    unsigned error;
+    unsigned char * tmp;
+    unsigned char * recon = dec->scanline + 1;
+
+    if(dec->y >= dec->h) return 91; /*there are no more rows*/
+
+    error = rowDecoderInflate(dec, dec->scanline, dec->linebytes + 1);
+    if(error) return error;
+
+    /*unfilter in place, the previous row is the reference*/
+    error = unfilterScanline(recon, recon, dec->y == 0 ? 0 : dec->prevline + 1, dec->bytewidth,
+                             dec->scanline[0], dec->linebytes);
+    if(error) return error;
+
+    if(out) {
+        LodePNGColorMode mode_out = lodepng_color_mode_make(LCT_RGBA, 8);
+        error = lodepng_convert(out, recon, &mode_out, &dec->state.info_png.color, dec->w, 1);
+        if(error) return error;
+    }
+
+    tmp = dec->prevline;
+    dec->prevline = dec->scanline;
+    dec->scanline = tmp;
+    dec->y++;
+
+    return 0;
+}
+
+unsigned lodepng_row_decoder_get_y(const LodePNGRowDecoder * dec)
+{
+    return dec->y;
+}
+
+unsigned lodepng_row_decoder_rewind(LodePNGRowDecoder * dec)
+{
+    return rowDecoderRewind(dec);
+}
+
+void lodepng_row_decoder_delete(LodePNGRowDecoder * dec)
+{
+    if(!dec) return;
+    HuffmanTree_cleanup(&dec->tree_ll);
+    HuffmanTree_cleanup(&dec->tree_d);
+    lodepng_state_cleanup(&dec->state);
+    lodepng_free(dec->idat);
+    lodepng_free(dec->scanline);
+    lodepng_free(dec->prevline);
+    lodepng_free(dec->window);
+    lodepng_free(dec);
+}
+#endif /*LODEPNG_COMPILE_ZLIB*/
+
 #ifdef LODEPNG_COMPILE_DISK
 unsigned lodepng_decode_file(unsigned char ** out, unsigned * w, unsigned * h, const char * filename,
                              LodePNGColorType colortype, unsigned bitdepth)
@@ -6812,6 +7136,8 @@ const char * lodepng_error_text(unsigned code)
         unreasonable memory consumption when decoding due to impossibly large ICC profile*/
         case 113:
             return "ICC profile unreasonably large";
+        case 114:
+            return "interlaced PNG can't be decoded row by row";
     }
     return "unknown error code";
 }
@@ -140,6 +140,31 @@ unsigned lodepng_decode32(unsigned char ** out, unsigned * w, unsigned * h,
 unsigned lodepng_decode24(unsigned char ** out, unsigned * w, unsigned * h,
                           const unsigned char * in, size_t insize);
 
+#ifdef LODEPNG_COMPILE_ZLIB
+/*
+LVGL extension: decode the rows of a PNG one by one to 32-bit RGBA.
+Only the compressed data, the 32 kB deflate window and two rows are stored, so a band of rows
+of a large image can be decoded without the memory of the whole image. Interlaced PNGs are not supported (error 114).
+The decoder copies what it needs from `in`, so `in` can be freed after creating the decoder.
+*/
+typedef struct LodePNGRowDecoder LodePNGRowDecoder;
+
+/*Parse the chunks of the PNG and prepare to decode the first row. Returns error code*/
+unsigned lodepng_row_decoder_create(LodePNGRowDecoder ** dec, unsigned * w, unsigned * h,
+                                    const unsigned char * in, size_t insize);
+
+/*Decode the next row to `out` (w * 4 bytes) or skip it if `out` is NULL. Returns error code*/
+unsigned lodepng_row_decoder_next(LodePNGRowDecoder * dec, unsigned char * out);
+
+/*Get the index of the row `lodepng_row_decoder_next` will decode*/
+unsigned lodepng_row_decoder_get_y(const LodePNGRowDecoder * dec);
+
+/*Start decoding from the first row again. Returns error code*/
+unsigned lodepng_row_decoder_rewind(LodePNGRowDecoder * dec);
+
+void lodepng_row_decoder_delete(LodePNGRowDecoder * dec);
+#endif /*LODEPNG_COMPILE_ZLIB*/
+
 #ifdef LODEPNG_COMPILE_DISK
 /*
 Load PNG from disk, from file with given name.
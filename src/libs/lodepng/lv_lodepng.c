@@ -21,12 +21,25 @@
  *      TYPEDEFS
  **********************/
 
+/*A PNG image which is decoded row by row as it doesn't fit into the cache*/
+typedef struct {
+    LodePNGRowDecoder * row_decoder;
+    uint8_t * row;                  /*A whole row of the image*/
+    uint8_t * buf;                  /*The decoded part of the image*/
+    const void * decoded_img;       /*The whole image if it can't be decoded row by row (interlaced)*/
+} png_rows_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_result_t decoder_info(struct _lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header);
 static lv_result_t decoder_open(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc);
 static void decoder_close(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_open_rows(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
+static void decoder_close_rows(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc);
+static lv_result_t load_png_data(lv_image_decoder_dsc_t * dsc, const uint8_t ** png_data, size_t * png_data_size);
 static void convert_color_depth(uint8_t * img_p, uint32_t px_cnt);
 static const void * decode_png_data(const void * png_data, size_t png_data_size);
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
@@ -48,20 +61,29 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
  */
 void lv_lodepng_init(void)
 {
+    /*The images which don't fit into the cache are decoded row by row.
+     *As the decoders are tried in reverse order this one is used only if the one below can't open the image.*/
     lv_image_decoder_t * dec = lv_image_decoder_create();
     lv_image_decoder_set_info_cb(dec, decoder_info);
+    lv_image_decoder_set_open_cb(dec, decoder_open_rows);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
+    lv_image_decoder_set_close_cb(dec, decoder_close_rows);
+
+    dec = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(dec, decoder_info);
     lv_image_decoder_set_open_cb(dec, decoder_open);
     lv_image_decoder_set_close_cb(dec, decoder_close);
+    lv_image_decoder_set_cached(dec, true);
+    lv_image_decoder_set_thread_safe(dec, true);
 }
 
 void lv_lodepng_deinit(void)
 {
-    lv_image_decoder_t * dec = NULL;
-    while((dec = lv_image_decoder_get_next(dec)) != NULL) {
-        if(dec->info_cb == decoder_info) {
-            lv_image_decoder_delete(dec);
-            break;
-        }
+    lv_image_decoder_t * dec = lv_image_decoder_get_next(NULL);
+    while(dec) {
+        lv_image_decoder_t * next = lv_image_decoder_get_next(dec);
+        if(dec->info_cb == decoder_info) lv_image_decoder_delete(dec);
+        dec = next;
     }
 }
 
@@ -104,7 +126,7 @@ static lv_result_t decoder_info(struct _lv_image_decoder_t * decoder, const void
 
             /*Save the data in the header*/
             header->always_zero = 0;
-            header->cf = LV_COLOR_FORMAT_ARGB8888;
+            header->cf = LV_COLOR_FORMAT_ARGB8888_LAYER;
             /*The width and height are stored in Big endian format so convert them to little endian*/
             header->w = (lv_coord_t)((size[0] & 0xff000000) >> 24) + ((size[0] & 0x00ff0000) >> 8);
             header->h = (lv_coord_t)((size[1] & 0xff000000) >> 24) + ((size[1] & 0x00ff0000) >> 8);
@@ -122,7 +144,7 @@ static lv_result_t decoder_info(struct _lv_image_decoder_t * decoder, const void
         if(memcmp(magic, img_dsc->data, sizeof(magic))) return LV_RESULT_INVALID;
         header->always_zero = 0;
 
-        header->cf = LV_COLOR_FORMAT_ARGB8888;
+        header->cf = LV_COLOR_FORMAT_ARGB8888_LAYER;
 
         if(img_dsc->header.w) {
             header->w = img_dsc->header.w;         /*Save the image width*/
@@ -159,41 +181,34 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     /*Check the cache first*/
     if(try_cache(dsc) == LV_RESULT_OK) return LV_RESULT_OK;
 
+    /*Let the other decoder decode it row by row*/
+    if((size_t)dsc->header.stride * dsc->header.h > lv_cache_get_max_size()) return LV_RESULT_INVALID;
+
     const uint8_t * png_data = NULL;
     size_t png_data_size = 0;
-    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
-        const char * fn = dsc->src;
-        if(strcmp(lv_fs_get_ext(fn), "png") == 0) {              /*Check the extension*/
-            unsigned error;
-            error = lodepng_load_file((void *)&png_data, &png_data_size, fn);  /*Load the file*/
-            if(error) {
-                if(png_data != NULL) {
-                    lv_free((void *)png_data);
-                }
-                LV_LOG_WARN("error %u: %s\n", error, lodepng_error_text(error));
-                return LV_RESULT_INVALID;
-            }
-        }
-    }
-    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
-        const lv_img_dsc_t * img_dsc = dsc->src;
-        png_data = img_dsc->data;
-        png_data_size = img_dsc->data_size;
-    }
-    else {
-        return LV_RESULT_INVALID;
+    if(load_png_data(dsc, &png_data, &png_data_size) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    /*Decode without locking the cache as the image might be decoded in the background*/
+    uint32_t t = lv_tick_get();
+    const void * decoded_img = decode_png_data(png_data, png_data_size);
+    t = lv_tick_elaps(t);
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)png_data);
+    if(decoded_img == NULL) return LV_RESULT_INVALID;
+
+    /*Another thread might have decoded the same image in the meantime*/
+    if(try_cache(dsc) == LV_RESULT_OK) {
+        lv_draw_buf_free((void *)decoded_img);
+        return LV_RESULT_OK;
     }
 
     lv_cache_lock();
     lv_cache_entry_t * cache = lv_cache_add(dsc->header.w * dsc->header.h * 4);
     if(cache == NULL) {
         lv_cache_unlock();
+        lv_draw_buf_free((void *)decoded_img);
         return LV_RESULT_INVALID;
     }
 
-    uint32_t t = lv_tick_get();
-    const void * decoded_img = decode_png_data(png_data, png_data_size);
-    t = lv_tick_elaps(t);
     cache->weight = t;
     cache->data = decoded_img;
     cache->free_data = 1;
@@ -201,7 +216,6 @@ static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         cache->src = lv_strdup(dsc->src);
         cache->src_type = LV_CACHE_SRC_TYPE_STR;
         cache->free_src = 1;
-        lv_free((void *)png_data);
     }
     else {
         cache->src_type = LV_CACHE_SRC_TYPE_PTR;
@@ -225,13 +239,163 @@ static void decoder_close(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc
 }
 
 
+/**
+ * Open a PNG image to decode it row by row in `decoder_get_area`
+ */
+static lv_result_t decoder_open_rows(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    const uint8_t * png_data = NULL;
+    size_t png_data_size = 0;
+    if(load_png_data(dsc, &png_data, &png_data_size) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    png_rows_t * rows = lv_malloc(sizeof(png_rows_t));
+    LV_ASSERT_MALLOC(rows);
+    if(rows == NULL) {
+        if(dsc->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)png_data);
+        return LV_RESULT_INVALID;
+    }
+    lv_memzero(rows, sizeof(png_rows_t));
+
+    unsigned error = lodepng_row_decoder_create(&rows->row_decoder, NULL, NULL, png_data, png_data_size);
+    if(error == 0) {
+        rows->row = lv_malloc(dsc->header.w * 4);
+        LV_ASSERT_MALLOC(rows->row);
+        if(rows->row == NULL) error = 83;
+    }
+    /*Interlaced images can be decoded only at once*/
+    else if(error == 114) {
+        rows->decoded_img = decode_png_data(png_data, png_data_size);
+        dsc->img_data = rows->decoded_img;
+        error = rows->decoded_img ? 0 : 83;
+    }
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)png_data);
+
+    if(error) {
+        LV_LOG_WARN("error %u: %s\n", error, lodepng_error_text(error));
+        dsc->user_data = rows;
+        decoder_close_rows(decoder, dsc);
+        return LV_RESULT_INVALID;
+    }
+
+    dsc->user_data = rows;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decode the rows of an area in bands
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder);
+
+    png_rows_t * rows = dsc->user_data;
+    lv_coord_t w_px = lv_area_get_width(full_area);
+    uint32_t row_size = w_px * 4;
+    lv_coord_t band_h = LV_MAX(LV_IMAGE_DECODER_AREA_BUF_SIZE / row_size, 1);
+    band_h = LV_MIN(band_h, lv_area_get_height(full_area));
+
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        lv_free(rows->buf);
+        rows->buf = lv_malloc(row_size * band_h);
+        LV_ASSERT_MALLOC(rows->buf);
+        if(rows->buf == NULL) return LV_RESULT_INVALID;
+
+        /*PNG has no random access, so go back to the first row if a row above the current one is needed*/
+        if(lodepng_row_decoder_get_y(rows->row_decoder) > (unsigned)full_area->y1) {
+            if(lodepng_row_decoder_rewind(rows->row_decoder)) return LV_RESULT_INVALID;
+        }
+
+        *decoded_area = *full_area;
+        decoded_area->y1 -= band_h;
+    }
+
+    decoded_area->y1 += band_h;
+    decoded_area->y2 = LV_MIN(decoded_area->y1 + band_h - 1, full_area->y2);
+    if(decoded_area->y1 > full_area->y2) return LV_RESULT_INVALID;
+
+    /*The rows above are needed only as the reference of the filters*/
+    unsigned error = 0;
+    while(!error && lodepng_row_decoder_get_y(rows->row_decoder) < (unsigned)decoded_area->y1) {
+        error = lodepng_row_decoder_next(rows->row_decoder, NULL);
+    }
+
+    lv_coord_t h = lv_area_get_height(decoded_area);
+    lv_coord_t y;
+    for(y = 0; y < h && !error; y++) {
+        error = lodepng_row_decoder_next(rows->row_decoder, rows->row);
+        if(error) break;
+
+        uint8_t * dest = rows->buf + y * row_size;
+        lv_memcpy(dest, rows->row + decoded_area->x1 * 4, row_size);
+        convert_color_depth(dest, w_px);
+    }
+
+    if(error) {
+        LV_LOG_WARN("error %u: %s\n", error, lodepng_error_text(error));
+        return LV_RESULT_INVALID;
+    }
+
+    dsc->img_data = rows->buf;
+    dsc->header.stride = row_size;
+    return LV_RESULT_OK;
+}
+
+static void decoder_close_rows(lv_image_decoder_t * dec, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+
+    png_rows_t * rows = dsc->user_data;
+    lodepng_row_decoder_delete(rows->row_decoder);
+    lv_free(rows->row);
+    lv_free(rows->buf);
+    if(rows->decoded_img) lv_draw_buf_free((void *)rows->decoded_img);
+    lv_free(rows);
+}
+
+/**
+ * Get the PNG data of a file or a variable
+ * @param dsc           pointer to the decoder descriptor
+ * @param png_data      store the pointer to the data here. Needs to be freed with `lv_free` for files
+ * @param png_data_size store the size of the data here
+ * @return              LV_RESULT_OK: no error; LV_RESULT_INVALID: can't load the data
+ */
+static lv_result_t load_png_data(lv_image_decoder_dsc_t * dsc, const uint8_t ** png_data, size_t * png_data_size)
+{
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        const char * fn = dsc->src;
+        if(strcmp(lv_fs_get_ext(fn), "png")) return LV_RESULT_INVALID;      /*Check the extension*/
+
+        unsigned error = lodepng_load_file((void *)png_data, png_data_size, fn);  /*Load the file*/
+        if(error) {
+            if(*png_data != NULL) {
+                lv_free((void *)*png_data);
+            }
+            LV_LOG_WARN("error %u: %s\n", error, lodepng_error_text(error));
+            return LV_RESULT_INVALID;
+        }
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        *png_data = img_dsc->data;
+        *png_data_size = img_dsc->data_size;
+    }
+    else {
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
 static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
 {
     lv_cache_lock();
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         const char * fn = dsc->src;
 
-        lv_cache_entry_t * cache = lv_cache_find(fn, LV_CACHE_SRC_TYPE_STR, 0, 0);
+        lv_cache_entry_t * cache = lv_cache_find_counted(fn, LV_CACHE_SRC_TYPE_STR, 0, 0);
         if(cache) {
             dsc->img_data = lv_cache_get_data(cache);
             dsc->user_data = cache;     /*Save the cache to release it in decoder_close*/
@@ -243,7 +407,7 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
     else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
         const lv_img_dsc_t * img_dsc = dsc->src;
 
-        lv_cache_entry_t * cache = lv_cache_find(img_dsc, LV_CACHE_SRC_TYPE_PTR, 0, 0);
+        lv_cache_entry_t * cache = lv_cache_find_counted(img_dsc, LV_CACHE_SRC_TYPE_PTR, 0, 0);
         if(cache) {
             dsc->img_data = lv_cache_get_data(cache);
             dsc->user_data = cache;     /*Save the cache to release it in decoder_close*/
@@ -279,7 +443,8 @@ static const void * decode_png_data(const void * png_data, size_t png_data_size)
 
 
 /**
- * If the display is not in 32 bit format (ARGB888) then convert the image to the current color depth
+ * Convert the RGBA image of lodepng to the ARGB8888 layout of LVGL
+ * (and premultiply the colors with the alpha if the layers are premultiplied)
  * @param img the ARGB888 image
  * @param px_cnt number of pixels in `img`
  */
@@ -291,6 +456,9 @@ static void convert_color_depth(uint8_t * img_p, uint32_t px_cnt)
         uint8_t blue = img_argb[i].blue;
         img_argb[i].blue = img_argb[i].red;
         img_argb[i].red = blue;
+#if LV_USE_DRAW_SW && LV_DRAW_SW_PREMULTIPLIED
+        img_argb[i] = lv_color32_premultiply(img_argb[i]);
+#endif
     }
 }
 
@@ -136,7 +136,8 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     }
 
     rlottie->imgdsc.header.always_zero = 0;
-    rlottie->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+    /*rlottie renders premultiplied colors*/
+    rlottie->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED;
     rlottie->imgdsc.header.h = create_info.height;
     rlottie->imgdsc.header.w = create_info.width;
     rlottie->imgdsc.data = (void *)rlottie->allocated_buf;
@@ -0,0 +1,467 @@
+/**
+ * @file lv_tiled_image.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_TILED_IMAGE
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_coord_t w;
+    lv_coord_t h;
+    uint32_t col_cnt;
+    uint32_t row_cnt;
+    uint32_t table_pos;             /*Position of the level's tile table in the file*/
+} level_t;
+
+typedef struct {
+    lv_fs_file_t f;
+    lv_color_format_t cf;
+    lv_tiled_image_compress_t compress;
+    uint32_t tile_w;
+    uint32_t tile_h;
+    uint32_t level_cnt;
+    level_t levels[LV_TILED_IMAGE_MAX_LEVELS];
+    lv_cache_entry_t * tile_cache;  /*The cache entry of the tile decoded last*/
+    uint8_t * read_buf;             /*The compressed data of the tiles is read here*/
+    uint32_t read_buf_size;
+} tiled_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_result_t decoder_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header);
+static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area);
+static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+
+static lv_result_t read_header(lv_fs_file_t * f, tiled_dsc_t * t);
+static lv_cache_entry_t * get_tile(lv_image_decoder_dsc_t * dsc, uint32_t level, uint32_t col, uint32_t row,
+                                   const uint8_t ** data);
+static uint8_t * decode_tile(tiled_dsc_t * t, uint32_t pos, uint32_t size, uint32_t w, uint32_t h);
+static void release_tile(tiled_dsc_t * t);
+static uint32_t get_u32(const uint8_t * buf);
+static uint32_t get_u16(const uint8_t * buf);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_tiled_image_init(void)
+{
+    lv_image_decoder_t * dec = lv_image_decoder_create();
+    LV_ASSERT_MALLOC(dec);
+    if(dec == NULL) {
+        LV_LOG_WARN("out of memory");
+        return;
+    }
+
+    lv_image_decoder_set_info_cb(dec, decoder_info);
+    lv_image_decoder_set_open_cb(dec, decoder_open);
+    lv_image_decoder_set_get_area_cb(dec, decoder_get_area);
+    lv_image_decoder_set_close_cb(dec, decoder_close);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get info about a tiled image
+ * @param decoder   pointer to the decoder
+ * @param src       the file name of the image
+ * @param header    store the info here
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: can't get the info
+ */
+static lv_result_t decoder_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header)
+{
+    LV_UNUSED(decoder);
+
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE) return LV_RESULT_INVALID;
+    if(strcmp(lv_fs_get_ext(src), "lvt") != 0) return LV_RESULT_INVALID;
+
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, src, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RESULT_INVALID;
+
+    tiled_dsc_t t;
+    lv_result_t res = read_header(&f, &t);
+    lv_fs_close(&f);
+    if(res != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    header->always_zero = 0;
+    header->cf = t.cf;
+    header->w = t.levels[0].w;
+    header->h = t.levels[0].h;
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Open a tiled image. Only the header is read, the tiles are decoded in `decoder_get_area`.
+ * @param decoder   pointer to the decoder
+ * @param dsc       the decoder descriptor to initialize
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: can't open the image
+ */
+static lv_result_t decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    if(dsc->src_type != LV_IMAGE_SRC_FILE) return LV_RESULT_INVALID;
+    if(strcmp(lv_fs_get_ext(dsc->src), "lvt") != 0) return LV_RESULT_INVALID;
+
+    tiled_dsc_t * t = lv_malloc(sizeof(tiled_dsc_t));
+    LV_ASSERT_MALLOC(t);
+    if(t == NULL) return LV_RESULT_INVALID;
+    lv_memzero(t, sizeof(tiled_dsc_t));
+
+    if(lv_fs_open(&t->f, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        lv_free(t);
+        return LV_RESULT_INVALID;
+    }
+
+    if(read_header(&t->f, t) != LV_RESULT_OK) {
+        lv_fs_close(&t->f);
+        lv_free(t);
+        return LV_RESULT_INVALID;
+    }
+
+    dsc->user_data = t;
+    dsc->img_data = NULL;
+    dsc->level_cnt = t->level_cnt;
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decode the next tile of the current mip level which intersects with an area.
+ * The tiles are returned row by row.
+ * @param decoder       pointer to the decoder
+ * @param dsc           the decoder descriptor of the opened image
+ * @param full_area     the area to decode relative to the mip level `dsc->level`
+ * @param decoded_area  set to the area of the decoded tile
+ * @return              LV_RESULT_OK: a tile is decoded; LV_RESULT_INVALID: there are no more tiles or an error
+ */
+static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                    const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    LV_UNUSED(decoder);
+    tiled_dsc_t * t = dsc->user_data;
+
+    /*The previous tile is not used anymore*/
+    release_tile(t);
+    dsc->img_data = NULL;
+
+    if(dsc->level >= t->level_cnt) return LV_RESULT_INVALID;
+    const level_t * level = &t->levels[dsc->level];
+
+    lv_area_t level_area = {0, 0, level->w - 1, level->h - 1};
+    lv_area_t area;
+    if(!_lv_area_intersect(&area, full_area, &level_area)) return LV_RESULT_INVALID;
+
+    uint32_t col_first = area.x1 / t->tile_w;
+    uint32_t col_last = area.x2 / t->tile_w;
+    uint32_t row_last = area.y2 / t->tile_h;
+    uint32_t col;
+    uint32_t row;
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        col = col_first;
+        row = area.y1 / t->tile_h;
+    }
+    else {
+        col = decoded_area->x1 / t->tile_w + 1;
+        row = decoded_area->y1 / t->tile_h;
+        if(col > col_last) {
+            col = col_first;
+            row++;
+        }
+    }
+
+    if(row > row_last) return LV_RESULT_INVALID;
+
+    t->tile_cache = get_tile(dsc, dsc->level, col, row, &dsc->img_data);
+    if(t->tile_cache == NULL) return LV_RESULT_INVALID;
+
+    decoded_area->x1 = col * t->tile_w;
+    decoded_area->y1 = row * t->tile_h;
+    decoded_area->x2 = LV_MIN(decoded_area->x1 + (lv_coord_t)t->tile_w, level->w) - 1;
+    decoded_area->y2 = LV_MIN(decoded_area->y1 + (lv_coord_t)t->tile_h, level->h) - 1;
+
+    dsc->header.stride = lv_draw_buf_width_to_stride(lv_area_get_width(decoded_area), t->cf);
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Free the allocated resources
+ * @param decoder   pointer to the decoder
+ * @param dsc       the decoder descriptor of the opened image
+ */
+static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    tiled_dsc_t * t = dsc->user_data;
+
+    release_tile(t);
+    lv_fs_close(&t->f);
+    lv_free(t->read_buf);
+    lv_free(t);
+}
+
+/**
+ * Read and check the header of a tiled image and calculate the layout of the levels
+ * @param f     an opened tiled image file
+ * @param t     store the info here
+ * @return      LV_RESULT_OK: no error; LV_RESULT_INVALID: not a valid tiled image
+ */
+static lv_result_t read_header(lv_fs_file_t * f, tiled_dsc_t * t)
+{
+    uint8_t buf[LV_TILED_IMAGE_HEADER_SIZE];
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_read(f, buf, sizeof(buf), &br);
+    if(res != LV_FS_RES_OK || br != sizeof(buf)) return LV_RESULT_INVALID;
+
+    if(memcmp(buf, "LVTI", 4) != 0) return LV_RESULT_INVALID;
+    if(buf[4] != LV_TILED_IMAGE_VERSION) {
+        LV_LOG_WARN("Unsupported tiled image version: %d", buf[4]);
+        return LV_RESULT_INVALID;
+    }
+
+    t->cf = buf[5];
+    switch(t->cf) {
+        case LV_COLOR_FORMAT_A8:
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888:
+            break;
+        default:
+            LV_LOG_WARN("Unsupported color format of a tiled image: %d", t->cf);
+            return LV_RESULT_INVALID;
+    }
+
+    t->compress = buf[6];
+    t->level_cnt = buf[7];
+    uint32_t w = get_u32(&buf[8]);
+    uint32_t h = get_u32(&buf[12]);
+    t->tile_w = get_u16(&buf[16]);
+    t->tile_h = get_u16(&buf[18]);
+
+    if(t->compress > LV_TILED_IMAGE_COMPRESS_RLE || t->level_cnt == 0 || t->level_cnt > LV_TILED_IMAGE_MAX_LEVELS ||
+       t->tile_w == 0 || t->tile_h == 0 || w == 0 || h == 0 || w > 0xFFFF || h > 0xFFFF ||
+       lv_draw_buf_width_to_stride(t->tile_w, t->cf) > 0xFFFF) {
+        LV_LOG_WARN("Invalid tiled image header");
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t table_pos = LV_TILED_IMAGE_HEADER_SIZE;
+    uint32_t i;
+    for(i = 0; i < t->level_cnt; i++) {
+        level_t * level = &t->levels[i];
+        level->w = (w + (1 << i) - 1) >> i;
+        level->h = (h + (1 << i) - 1) >> i;
+        level->col_cnt = (level->w + t->tile_w - 1) / t->tile_w;
+        level->row_cnt = (level->h + t->tile_h - 1) / t->tile_h;
+        level->table_pos = table_pos;
+        table_pos += level->col_cnt * level->row_cnt * 8;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Get a decoded tile from the cache or decode it and add it to the cache
+ * @param dsc       the decoder descriptor of the opened image
+ * @param level     index of the mip level
+ * @param col       column of the tile
+ * @param row       row of the tile
+ * @param data      store the pixels of the tile here
+ * @return          the cache entry of the tile, it needs to be released. NULL on error
+ */
+static lv_cache_entry_t * get_tile(lv_image_decoder_dsc_t * dsc, uint32_t level, uint32_t col, uint32_t row,
+                                   const uint8_t ** data)
+{
+    tiled_dsc_t * t = dsc->user_data;
+    const level_t * lvl = &t->levels[level];
+    uint32_t tile_id = row * lvl->col_cnt + col;
+
+    /*Use `level + 1` to not mix the tiles with the whole decoded images*/
+    lv_cache_lock();
+    lv_cache_entry_t * cache = lv_cache_find_counted(dsc->src, LV_CACHE_SRC_TYPE_STR, level + 1, tile_id);
+    if(cache) {
+        *data = lv_cache_get_data(cache);
+        lv_cache_unlock();
+        return cache;
+    }
+    lv_cache_unlock();
+
+    /*Find the tile in the file*/
+    uint8_t entry[8];
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_seek(&t->f, lvl->table_pos + tile_id * 8, LV_FS_SEEK_SET);
+    if(res == LV_FS_RES_OK) res = lv_fs_read(&t->f, entry, sizeof(entry), &br);
+    if(res != LV_FS_RES_OK || br != sizeof(entry)) {
+        LV_LOG_WARN("Couldn't read the tile table");
+        return NULL;
+    }
+
+    uint32_t w = LV_MIN(t->tile_w, lvl->w - col * t->tile_w);
+    uint32_t h = LV_MIN(t->tile_h, lvl->h - row * t->tile_h);
+    uint32_t time = lv_tick_get();
+    uint8_t * tile = decode_tile(t, get_u32(&entry[0]), get_u32(&entry[4]), w, h);
+    if(tile == NULL) return NULL;
+    time = lv_tick_elaps(time);
+
+    char * src = lv_strdup(dsc->src);
+    LV_ASSERT_MALLOC(src);
+    if(src == NULL) {
+        lv_draw_buf_free(tile);
+        return NULL;
+    }
+
+    lv_cache_lock();
+    cache = lv_cache_add(lv_draw_buf_width_to_stride(w, t->cf) * h);
+    if(cache == NULL) {
+        lv_cache_unlock();
+        lv_free(src);
+        lv_draw_buf_free(tile);
+        return NULL;
+    }
+
+    cache->weight = time;
+    cache->data = tile;
+    cache->free_data = 1;
+    cache->src = src;
+    cache->src_type = LV_CACHE_SRC_TYPE_STR;
+    cache->free_src = 1;
+    cache->param1 = level + 1;
+    cache->param2 = tile_id;
+    *data = lv_cache_get_data(cache);
+    lv_cache_unlock();
+
+    return cache;
+}
+
+/**
+ * Read and decompress a tile
+ * @param t         the tiled image descriptor
+ * @param pos       position of the tile's data in the file
+ * @param size      size of the tile's data in the file
+ * @param w         width of the tile
+ * @param h         height of the tile
+ * @return          the decoded pixels allocated with `lv_draw_buf_malloc`. NULL on error
+ */
+static uint8_t * decode_tile(tiled_dsc_t * t, uint32_t pos, uint32_t size, uint32_t w, uint32_t h)
+{
+    uint32_t px_size = lv_color_format_get_size(t->cf);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, t->cf);
+    uint32_t row_size = w * px_size;
+
+    if(t->compress == LV_TILED_IMAGE_COMPRESS_NONE && size != row_size * h) {
+        LV_LOG_WARN("Invalid tile size");
+        return NULL;
+    }
+
+    /*Don't trust the size in the file to allocate the read buffer. In the worst case every pixel of an
+     *RLE compressed tile is stored in its own packet (1 control byte + 1 pixel).*/
+    if(t->compress == LV_TILED_IMAGE_COMPRESS_RLE && (size == 0 || size > (uint64_t)(row_size + w) * h)) {
+        LV_LOG_WARN("Invalid tile size");
+        return NULL;
+    }
+
+    uint8_t * tile = lv_draw_buf_malloc(stride * h, t->cf);
+    LV_ASSERT_MALLOC(tile);
+    if(tile == NULL) return NULL;
+
+    /*Read the uncompressed tiles directly into their place*/
+    bool direct = t->compress == LV_TILED_IMAGE_COMPRESS_NONE && stride == row_size;
+    uint8_t * in = tile;
+    if(!direct) {
+        if(t->read_buf_size < size) {
+            lv_free(t->read_buf);
+            t->read_buf = lv_malloc(size);
+            LV_ASSERT_MALLOC(t->read_buf);
+            t->read_buf_size = t->read_buf ? size : 0;
+            if(t->read_buf == NULL) {
+                lv_draw_buf_free(tile);
+                return NULL;
+            }
+        }
+        in = t->read_buf;
+    }
+
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_seek(&t->f, pos, LV_FS_SEEK_SET);
+    if(res == LV_FS_RES_OK) res = lv_fs_read(&t->f, in, size, &br);
+    if(res != LV_FS_RES_OK || br != size) {
+        LV_LOG_WARN("Couldn't read a tile");
+        lv_draw_buf_free(tile);
+        return NULL;
+    }
+
+    if(t->compress == LV_TILED_IMAGE_COMPRESS_RLE) {
+        lv_rle_t rle;
+        lv_rle_init(&rle, in, size, px_size);
+        uint32_t y;
+        for(y = 0; y < h; y++) {
+            if(lv_rle_decompress(&rle, tile + y * stride, row_size) != row_size) break;
+        }
+
+        if(y < h || !lv_rle_is_done(&rle)) {
+            LV_LOG_WARN("Invalid RLE data in a tile");
+            lv_draw_buf_free(tile);
+            return NULL;
+        }
+    }
+    else if(!direct) {
+        uint32_t y;
+        for(y = 0; y < h; y++) {
+            lv_memcpy(tile + y * stride, in + y * row_size, row_size);
+        }
+    }
+
+    return tile;
+}
+
+static void release_tile(tiled_dsc_t * t)
+{
+    if(t->tile_cache == NULL) return;
+
+    lv_cache_lock();
+    lv_cache_release(t->tile_cache);
+    lv_cache_unlock();
+    t->tile_cache = NULL;
+}
+
+static uint32_t get_u32(const uint8_t * buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static uint32_t get_u16(const uint8_t * buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8);
+}
+
+#endif /*LV_USE_TILED_IMAGE*/
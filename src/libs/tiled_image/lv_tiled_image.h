@@ -0,0 +1,71 @@
+/**
+ * @file lv_tiled_image.h
+ *
+ */
+
+#ifndef LV_TILED_IMAGE_H
+#define LV_TILED_IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_conf_internal.h"
+#if LV_USE_TILED_IMAGE
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Layout of the tiled image files (*.lvt). All values are little endian.
+ *  0 uint8_t[4]   "LVTI"
+ *  4 uint8_t      version, `LV_TILED_IMAGE_VERSION`
+ *  5 uint8_t      color format, one of A8, RGB565, RGB888, XRGB8888, ARGB8888
+ *  6 uint8_t      compression of the tiles, `lv_tiled_image_compress_t`
+ *  7 uint8_t      number of mip levels (1..`LV_TILED_IMAGE_MAX_LEVELS`)
+ *  8 uint32_t     width of the image
+ * 12 uint32_t     height of the image
+ * 16 uint16_t     width of the tiles
+ * 18 uint16_t     height of the tiles
+ * 20              tile table: for each level and each tile row by row an uint32_t offset and size in the file
+ *
+ *Level `n` is the image downscaled by `2^n`. The tiles in the last column and row are clipped to the level.
+ *The pixels of the tiles are stored row by row without padding.*/
+#define LV_TILED_IMAGE_VERSION      1
+#define LV_TILED_IMAGE_HEADER_SIZE  20
+#define LV_TILED_IMAGE_MAX_LEVELS   16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_TILED_IMAGE_COMPRESS_NONE,
+    /**Run-length encoding of pixels: a control byte `c` is followed by one pixel
+     * to repeat `(c & 0x7F) + 1` times if `c & 0x80`, else by `c + 1` pixels to copy.*/
+    LV_TILED_IMAGE_COMPRESS_RLE,
+} lv_tiled_image_compress_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the decoder of the tiled, mip-mapped image files (*.lvt).
+ * Only the tiles of the visible area are read and decoded, and they are stored in the image cache.
+ */
+void lv_tiled_image_init(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_TILED_IMAGE*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TILED_IMAGE_H*/
@@ -23,6 +23,8 @@
 #define TTF_CACHE_FREE(x)    (lv_free(x))
 #define TTF_MALLOC(x)  (lv_malloc(x))
 #define TTF_FREE(x)    (lv_free(x))
+/*Empty subpixels on both sides of the subpixel glyphs for the LCD filter*/
+#define TTF_SUBPX_PAD 2
 typedef void * ttf_cache_handle_t;
 typedef struct ttf_cache_entry {
     int key;
@@ -215,7 +217,11 @@ static void ttf_cache_clear(ttf_cache_handle_t handle)
 }
 static void ttf_cache_destroy(ttf_cache_handle_t handle)
 {
+    if(handle == NULL) {
+        return;
+    }
     ttf_cache_clear(handle);
+    TTF_CACHE_FREE(((ttf_cache_t *)handle)->buckets);
     TTF_CACHE_FREE((ttf_cache_t *)handle);
 }
 #if LV_TINY_TTF_FILE_SUPPORT !=0
@@ -278,6 +284,57 @@ typedef struct ttf_font_desc {
     int descent;
 } ttf_font_desc_t;
 
+/*The bitmap box of a glyph. With subpixel rendering the x values are in subpixels except `ofs_x`*/
+typedef struct ttf_glyph_box {
+    int w;
+    int h;
+    int ofs_x;
+    int ofs_y;
+    int lead;   /*Number of padding subpixels before the glyph*/
+} ttf_glyph_box_t;
+
+static void ttf_get_glyph_box(const lv_font_t * font, int glyph, ttf_glyph_box_t * box)
+{
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    int x1, y1, x2, y2;
+    if(font->subpx == LV_FONT_SUBPX_HOR) {
+        /*Render with 3 times horizontal resolution and align the box to whole pixels*/
+        stbtt_GetGlyphBitmapBox(&dsc->info, glyph, dsc->scale * 3, dsc->scale, &x1, &y1, &x2, &y2);
+        int sx = x1 - TTF_SUBPX_PAD;
+        box->ofs_x = sx >= 0 ? sx / 3 : -((2 - sx) / 3);
+        box->lead = x1 - box->ofs_x * 3;
+        box->w = ((box->lead + (x2 - x1 + 1) + TTF_SUBPX_PAD + 2) / 3) * 3;
+    }
+    else {
+        stbtt_GetGlyphBitmapBox(&dsc->info, glyph, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+        box->ofs_x = x1;
+        box->lead = 0;
+        box->w = x2 - x1 + 1;
+    }
+    box->h = y2 - y1 + 1;
+    box->ofs_y = -y2;
+}
+
+/*Reduce the color fringes of the subpixel glyphs with FreeType's default 5-tap LCD filter*/
+static void ttf_lcd_filter(uint8_t * buf, int w, int h)
+{
+    int y;
+    for(y = 0; y < h; y++) {
+        uint8_t * row = buf + y * w;
+        uint32_t p1 = 0;    /*The original values of the previous 2 subpixels*/
+        uint32_t p2 = 0;
+        int x;
+        for(x = 0; x < w; x++) {
+            uint32_t c = row[x];
+            uint32_t n1 = x + 1 < w ? row[x + 1] : 0;
+            uint32_t n2 = x + 2 < w ? row[x + 2] : 0;
+            row[x] = (uint8_t)((p2 * 0x08 + p1 * 0x4D + c * 0x56 + n1 * 0x4D + n2 * 0x08) >> 8);
+            p2 = p1;
+            p1 = c;
+        }
+    }
+}
+
 static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                  uint32_t unicode_letter_next)
 {
@@ -295,9 +352,8 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
     }
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
     int g1 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter);
-    int x1, y1, x2, y2;
-
-    stbtt_GetGlyphBitmapBox(&dsc->info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    ttf_glyph_box_t box;
+    ttf_get_glyph_box(font, g1, &box);
     int g2 = 0;
     if(unicode_letter_next != 0) {
         g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next);
@@ -310,10 +366,10 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
 
     dsc_out->adv_w = (uint16_t)floor((((float)advw + (float)k) * dsc->scale) +
                                      0.5f); /*Horizontal space required by the glyph in [px]*/
-    dsc_out->box_w = (x2 - x1 + 1);                                /*width of the bitmap in [px]*/
-    dsc_out->box_h = (y2 - y1 + 1);                                /*height of the bitmap in [px]*/
-    dsc_out->ofs_x = x1;                                           /*X offset of the bitmap in [pf]*/
-    dsc_out->ofs_y = -y2; /*Y offset of the bitmap measured from the as line*/
+    dsc_out->box_w = box.w;                                        /*width of the bitmap in [px]*/
+    dsc_out->box_h = box.h;                                        /*height of the bitmap in [px]*/
+    dsc_out->ofs_x = box.ofs_x;                                    /*X offset of the bitmap in [pf]*/
+    dsc_out->ofs_y = box.ofs_y; /*Y offset of the bitmap measured from the as line*/
     dsc_out->bpp = 8;     /*Bits per pixel: 1/2/4/8*/
     dsc_out->is_placeholder = false;
     return true;          /*true: glyph found; false: glyph was not found*/
@@ -327,18 +383,23 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
     uint8_t * buffer = (uint8_t *)ttf_cache_get(dsc->cache, unicode_letter);
     if(buffer == NULL) {
         int g1 = stbtt_FindGlyphIndex(info, (int)unicode_letter);
-        int x1, y1, x2, y2;
-        stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
-        int w, h;
-        w = x2 - x1 + 1;
-        h = y2 - y1 + 1;
+        ttf_glyph_box_t box;
+        ttf_get_glyph_box(font, g1, &box);
+        int w = box.w;
+        int h = box.h;
         int buffer_size = w * h;
         buffer = ttf_cache_add(dsc->cache, unicode_letter, buffer_size);
         if(buffer == NULL) {
             return NULL;
         }
         memset(buffer, 0, buffer_size);
-        stbtt_MakeGlyphBitmap(info, buffer, w, h, w, dsc->scale, dsc->scale, g1);
+        if(font->subpx == LV_FONT_SUBPX_HOR) {
+            stbtt_MakeGlyphBitmap(info, buffer + box.lead, w - box.lead, h, w, dsc->scale * 3, dsc->scale, g1);
+            ttf_lcd_filter(buffer, w, h);
+        }
+        else {
+            stbtt_MakeGlyphBitmap(info, buffer, w, h, w, dsc->scale, dsc->scale, g1);
+        }
     }
     return buffer; /*Or NULL if not found*/
 }
@@ -408,6 +469,7 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
         LV_LOG_ERROR("tiny_ttf: out of memory\n");
         return NULL;
     }
+    lv_memzero(out_font, sizeof(lv_font_t));
     out_font->line_height = line_height;
     out_font->fallback = NULL;
     out_font->dsc = dsc;
@@ -449,11 +511,26 @@ void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t line_height)
         font->base_line = line_height - (lv_coord_t)(dsc->ascent * dsc->scale);
         font->underline_position = (uint8_t)line_height - dsc->descent;
         ttf_cache_clear(dsc->cache);
+        lv_font_invalidate(font);
     }
 }
+void lv_tiny_ttf_set_subpx(lv_font_t * font, lv_font_subpx_t subpx)
+{
+    if(subpx != LV_FONT_SUBPX_NONE && subpx != LV_FONT_SUBPX_HOR) {
+        LV_LOG_WARN("tiny_ttf: only horizontal subpixel rendering is supported");
+        return;
+    }
+    if(font->subpx == subpx) return;
+
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    font->subpx = subpx;
+    ttf_cache_clear(dsc->cache);
+    lv_font_invalidate(font);
+}
 void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     if(font != NULL) {
+        lv_font_invalidate(font);
         if(font->dsc != NULL) {
             ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
             ttf_cache_destroy(ttf->cache);
@@ -45,6 +45,10 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, lv_c
 /* set the size of the font to a new line_height*/
 void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t line_height);
 
+/* render the font with 3 times horizontal resolution for subpixel rendering (LV_FONT_SUBPX_HOR)
+ * or normally (LV_FONT_SUBPX_NONE)*/
+void lv_tiny_ttf_set_subpx(lv_font_t * font, lv_font_subpx_t subpx);
+
 /* destroy a font previously created with lv_tiny_ttf_create_xxxx()*/
 void lv_tiny_ttf_destroy(lv_font_t * font);
 
@@ -258,6 +258,29 @@
         #endif
     #endif
 
+    /* Max. memory in bytes used to cache the rendered texts of the labels.
+     * A text drawn the second time with the same font, size and settings is rendered into an A8 coverage map,
+     * and later it's drawn with a single blend. The color and opacity can be changed without rendering it again.
+     * 0: to disable caching */
+    #ifndef LV_DRAW_SW_TEXT_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_TEXT_CACHE_SIZE
+            #define LV_DRAW_SW_TEXT_CACHE_SIZE CONFIG_LV_DRAW_SW_TEXT_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_TEXT_CACHE_SIZE                0
+        #endif
+    #endif
+
+    /* 1: Keep the colors of the ARGB8888 layers and the decoded PNG images premultiplied with their alpha.
+     * Blending them needs no division and scaling them doesn't bleed the color of the transparent pixels,
+     * but the opaque colors lose some precision. */
+    #ifndef LV_DRAW_SW_PREMULTIPLIED
+        #ifdef CONFIG_LV_DRAW_SW_PREMULTIPLIED
+            #define LV_DRAW_SW_PREMULTIPLIED CONFIG_LV_DRAW_SW_PREMULTIPLIED
+        #else
+            #define LV_DRAW_SW_PREMULTIPLIED                  0
+        #endif
+    #endif
+
     /* 0: use a simple renderer capable of drawing only simple rectangles with gradient, images, texts, and straight lines only
      * 1: use a complex renderer capable of drawing rounded corners, shadow, skew lines, and arcs too */
     #ifndef LV_DRAW_SW_COMPLEX
@@ -286,13 +309,25 @@
 
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
-        * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+        * radius * 6 bytes are used per circle (the most often used radiuses are saved)
+        * The circles are kept between the refreshes, but the ones not used in a refresh are freed.
         * 0: to disable caching */
         #ifndef LV_DRAW_SW_CIRCLE_CACHE_SIZE
             #ifdef CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
                 #define LV_DRAW_SW_CIRCLE_CACHE_SIZE CONFIG_LV_DRAW_SW_CIRCLE_CACHE_SIZE
             #else
-                #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+                #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 16
+            #endif
+        #endif
+
+        /* Max. memory used by the cached circles in bytes.
+        * If a new circle doesn't fit, the least used circles are freed.
+        * 0: no limit */
+        #ifndef LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES
+            #ifdef CONFIG_LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES
+                #define LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES CONFIG_LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES
+            #else
+                #define LV_DRAW_SW_CIRCLE_CACHE_MAX_BYTES 0
             #endif
         #endif
     #endif
@@ -654,6 +689,25 @@
     #endif
 #endif
 
+/*1: Show the entries, the used size and the hit rate of the image cache
+ * Requires `LV_USE_SYSMON = 1`*/
+#ifndef LV_USE_CACHE_MONITOR
+    #ifdef CONFIG_LV_USE_CACHE_MONITOR
+        #define LV_USE_CACHE_MONITOR CONFIG_LV_USE_CACHE_MONITOR
+    #else
+        #define LV_USE_CACHE_MONITOR 0
+    #endif
+#endif
+#if LV_USE_CACHE_MONITOR
+    #ifndef LV_USE_CACHE_MONITOR_POS
+        #ifdef CONFIG_LV_USE_CACHE_MONITOR_POS
+            #define LV_USE_CACHE_MONITOR_POS CONFIG_LV_USE_CACHE_MONITOR_POS
+        #else
+            #define LV_USE_CACHE_MONITOR_POS LV_ALIGN_TOP_LEFT
+        #endif
+    #endif
+#endif
+
 /*-------------
  * Others
  *-----------*/
@@ -698,6 +752,55 @@
     #endif
 #endif
 
+/*1: Decode the image files of the thread safe decoders which cache their result (e.g. LodePNG, libjpeg-turbo)
+ *in the background. A placeholder is drawn in place of an image until it's decoded, and its area is redrawn when
+ *it's ready. The images which don't fit into the cache, variables and the images drawn on a canvas are still
+ *decoded while drawing.
+ *Requires `LV_USE_OS`*/
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Number of threads decoding the images*/
+    #ifndef LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+        #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+            #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT CONFIG_LV_IMAGE_DECODER_ASYNC_THREAD_CNT
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_THREAD_CNT 1
+        #endif
+    #endif
+
+    /*Stack size of the threads in bytes. The PNG and JPEG decoders run on these stacks.
+     *Ignored by the pthread backend*/
+    #ifndef LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+        #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+            #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE CONFIG_LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (32 * 1024)
+        #endif
+    #endif
+
+    /*Color and opacity of the rectangle drawn in place of the images being decoded. 0: draw nothing*/
+    #ifndef LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR
+        #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR
+            #define LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR CONFIG_LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_COLOR 0xC0C0C0
+        #endif
+    #endif
+    #ifndef LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA
+        #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA
+            #define LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA CONFIG_LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_PLACEHOLDER_OPA 64
+        #endif
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1078,6 +1181,26 @@
     #endif
 #endif
 
+/*Enable subpixel rendering of the fonts with 3 times horizontal resolution (`LV_FONT_SUBPX_HOR`)
+ *on the displays where the subpixel order is set by `lv_display_set_subpx()`*/
+#ifndef LV_USE_FONT_SUBPX
+    #ifdef CONFIG_LV_USE_FONT_SUBPX
+        #define LV_USE_FONT_SUBPX CONFIG_LV_USE_FONT_SUBPX
+    #else
+        #define LV_USE_FONT_SUBPX 0
+    #endif
+#endif
+#if LV_USE_FONT_SUBPX
+    /*1: the new displays use BGR subpixel order. 0: no subpixel order until `lv_display_set_subpx()` is called*/
+    #ifndef LV_FONT_SUBPX_BGR
+        #ifdef CONFIG_LV_FONT_SUBPX_BGR
+            #define LV_FONT_SUBPX_BGR CONFIG_LV_FONT_SUBPX_BGR
+        #else
+            #define LV_FONT_SUBPX_BGR 0
+        #endif
+    #endif
+#endif
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef _LV_KCONFIG_PRESENT
@@ -1091,6 +1214,31 @@
     #endif
 #endif
 
+/*Max. memory in bytes used to cache the decoded bitmaps of the drawn glyphs.
+ *The cached glyphs are drawn without decoding them again (it helps the most with compressed fonts).
+ *If a new glyph doesn't fit, the least recently used glyphs are freed.
+ *0: to disable caching*/
+#ifndef LV_FONT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_GLYPH_CACHE_SIZE
+        #define LV_FONT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Max. memory in bytes used for the lookup tables of the fonts in LVGL's format (lv_font_fmt_txt).
+ *A small cache maps the used letters to glyphs (helps with the sparse cmaps, e.g. CJK fonts),
+ *and a table stores the kerning pairs. They are created when the font is used first.
+ *If the tables of a font don't fit, a smaller cache is used without the kerning table.
+ *0: to disable the lookup tables*/
+#ifndef LV_FONT_FMT_TXT_LUT_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_LUT_SIZE
+        #define LV_FONT_FMT_TXT_LUT_SIZE CONFIG_LV_FONT_FMT_TXT_LUT_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_LUT_SIZE 0
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -1952,6 +2100,15 @@
     #endif
 #endif
 
+/*Decoder of tiled, mip-mapped images (*.lvt) for large, zoomable images*/
+#ifndef LV_USE_TILED_IMAGE
+    #ifdef CONFIG_LV_USE_TILED_IMAGE
+        #define LV_USE_TILED_IMAGE CONFIG_LV_USE_TILED_IMAGE
+    #else
+        #define LV_USE_TILED_IMAGE 0
+    #endif
+#endif
+
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #ifndef LV_USE_TJPGD
@@ -2101,6 +2258,27 @@
             #define LV_FFMPEG_DUMP_FORMAT 0
         #endif
     #endif
+
+    /*Decode the frames of the players in a thread into a queue and show them at their timestamps.
+     *The YUV420 videos are drawn without converting them to RGB first.
+     *Requires `LV_USE_OS`*/
+    #ifndef LV_FFMPEG_DECODE_THREAD
+        #ifdef CONFIG_LV_FFMPEG_DECODE_THREAD
+            #define LV_FFMPEG_DECODE_THREAD CONFIG_LV_FFMPEG_DECODE_THREAD
+        #else
+            #define LV_FFMPEG_DECODE_THREAD 0
+        #endif
+    #endif
+    #if LV_FFMPEG_DECODE_THREAD
+        /*Number of frames decoded ahead*/
+        #ifndef LV_FFMPEG_FRAME_QUEUE_LEN
+            #ifdef CONFIG_LV_FFMPEG_FRAME_QUEUE_LEN
+                #define LV_FFMPEG_FRAME_QUEUE_LEN CONFIG_LV_FFMPEG_FRAME_QUEUE_LEN
+            #else
+                #define LV_FFMPEG_FRAME_QUEUE_LEN 3
+            #endif
+        #endif
+    #endif
 #endif
 
 /*==================
@@ -129,6 +129,26 @@ extern "C" {
 #  define CONFIG_LV_USE_MEM_MONITOR_POS LV_ALIGN_CENTER
 #endif
 
+#ifdef CONFIG_LV_CACHE_MONITOR_ALIGN_TOP_LEFT
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_TOP_LEFT
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_TOP_MID)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_TOP_MID
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_TOP_RIGHT)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_TOP_RIGHT
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_BOTTOM_LEFT)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_BOTTOM_MID)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_BOTTOM_MID
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_BOTTOM_RIGHT)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_BOTTOM_RIGHT
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_LEFT_MID)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_LEFT_MID
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_RIGHT_MID)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_RIGHT_MID
+#elif defined(CONFIG_LV_CACHE_MONITOR_ALIGN_CENTER)
+#  define CONFIG_LV_USE_CACHE_MONITOR_POS LV_ALIGN_CENTER
+#endif
+
 /********************
  * FONT SELECTION
  *******************/
@@ -12,6 +12,7 @@
 #include "indev/lv_indev_private.h"
 #include "layouts/lv_layout.h"
 #include "libs/bmp/lv_bmp.h"
+#include "libs/tiled_image/lv_tiled_image.h"
 #include "libs/ffmpeg/lv_ffmpeg.h"
 #include "libs/freetype/lv_freetype.h"
 #include "libs/fsdrv/lv_fsdrv.h"
@@ -71,6 +72,7 @@ static inline void lv_global_init(lv_global_t * global)
 
     _lv_ll_init(&(global->disp_ll), sizeof(lv_display_t));
     _lv_ll_init(&(global->indev_ll), sizeof(lv_indev_t));
+    _lv_ll_init(&(global->font_invalidate_cb_ll), sizeof(lv_font_invalidate_cb_t));
 
     global->memory_zero = ZERO_MEM_SENTINEL;
     global->style_refresh = true;
@@ -169,6 +171,14 @@ void lv_init(void)
     lv_cache_set_max_size(LV_CACHE_DEF_SIZE);
     lv_cache_unlock();
 
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    _lv_font_glyph_cache_init();
+#endif
+
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    _lv_font_fmt_txt_lut_init();
+#endif
+
     /*Test if the IDE has UTF-8 encoding*/
     const char * txt = "Á";
 
@@ -246,6 +256,10 @@ void lv_init(void)
     lv_bmp_init();
 #endif
 
+#if LV_USE_TILED_IMAGE
+    lv_tiled_image_init();
+#endif
+
     /*Make FFMPEG last because the last converter will be checked first and
      *it's superior to any other */
 #if LV_USE_FFMPEG
@@ -276,6 +290,8 @@ void lv_deinit(void)
 
     lv_display_set_default(NULL);
 
+    _lv_image_decoder_deinit();
+
 #if LV_USE_SPAN != 0
     lv_span_stack_deinit();
 #endif
@@ -296,6 +312,26 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_DRAW_SW && LV_DRAW_SW_COMPLEX
+    _lv_draw_sw_mask_cleanup();
+#endif
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_TEXT_CACHE_SIZE > 0
+    _lv_draw_sw_text_cache_deinit();
+#endif
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    _lv_font_glyph_cache_deinit();
+#endif
+
+#if LV_FONT_FMT_TXT_LUT_SIZE > 0
+    _lv_font_fmt_txt_lut_deinit();
+#endif
+
+    _lv_ll_clear(&LV_GLOBAL_DEFAULT()->font_invalidate_cb_ll);
+
+    _lv_cache_deinit();
+
     lv_mem_deinit();
 
     lv_initialized = false;
@@ -42,6 +42,14 @@ void _lv_cache_init(void)
     lv_mutex_init(&_cache_manager.mutex);
 }
 
+void _lv_cache_deinit(void)
+{
+    if(_cache_manager.deinit_cb) _cache_manager.deinit_cb();
+
+    lv_mutex_delete(&_cache_manager.mutex);
+    lv_memzero(&_cache_manager, sizeof(lv_cache_manager_t));
+}
+
 lv_cache_entry_t * lv_cache_add(size_t size)
 {
     LV_ASSERT(_cache_manager.locked);
@@ -58,6 +66,22 @@ lv_cache_entry_t * lv_cache_find(const void * src_ptr, lv_cache_src_type_t src_t
     return _cache_manager.find_cb(src_ptr, src_type, param1, param2);
 }
 
+lv_cache_entry_t * lv_cache_find_counted(const void * src_ptr, lv_cache_src_type_t src_type, uint32_t param1,
+                                         uint32_t param2)
+{
+    lv_cache_entry_t * entry = lv_cache_find(src_ptr, src_type, param1, param2);
+    if(entry) {
+        _cache_manager.stats.hit_cnt++;
+        if(src_type < _LV_CACHE_SRC_TYPE_LAST) _cache_manager.stats.src_types[src_type].hit_cnt++;
+    }
+    else {
+        _cache_manager.stats.miss_cnt++;
+        if(src_type < _LV_CACHE_SRC_TYPE_LAST) _cache_manager.stats.src_types[src_type].miss_cnt++;
+    }
+
+    return entry;
+}
+
 
 void lv_cache_invalidate(lv_cache_entry_t * entry)
 {
@@ -67,6 +91,16 @@ void lv_cache_invalidate(lv_cache_entry_t * entry)
     _cache_manager.invalidate_cb(entry);
 }
 
+void lv_cache_set_derived(lv_cache_entry_t * base, lv_cache_entry_t * derived)
+{
+    LV_ASSERT(_cache_manager.locked);
+    if(base->temporary || derived->temporary) return;
+
+    if(base->derived) lv_cache_invalidate(base->derived);
+    base->derived = derived;
+    derived->base = base;
+}
+
 const void * lv_cache_get_data(lv_cache_entry_t * entry)
 {
     LV_ASSERT(_cache_manager.locked);
@@ -98,6 +132,52 @@ size_t lv_cache_get_max_size(void)
     return _cache_manager.max_size;
 }
 
+lv_cache_entry_t * lv_cache_get_next_entry(lv_cache_entry_t * entry)
+{
+    LV_ASSERT(_cache_manager.locked);
+    if(_cache_manager.get_next_entry_cb == NULL) return NULL;
+
+    return _cache_manager.get_next_entry_cb(entry);
+}
+
+void lv_cache_get_stats(lv_cache_stats_t * stats)
+{
+    LV_ASSERT(_cache_manager.locked);
+
+    lv_memzero(stats, sizeof(lv_cache_stats_t));
+    stats->hit_cnt = _cache_manager.stats.hit_cnt;
+    stats->miss_cnt = _cache_manager.stats.miss_cnt;
+    stats->evict_cnt = _cache_manager.stats.evict_cnt;
+    stats->temporary_cnt = _cache_manager.stats.temporary_cnt;
+    stats->max_size = _cache_manager.max_size;
+
+    uint32_t i;
+    for(i = 0; i < _LV_CACHE_SRC_TYPE_LAST; i++) {
+        stats->src_types[i].hit_cnt = _cache_manager.stats.src_types[i].hit_cnt;
+        stats->src_types[i].miss_cnt = _cache_manager.stats.src_types[i].miss_cnt;
+    }
+
+    /*Sum up the live entries*/
+    lv_cache_entry_t * entry = lv_cache_get_next_entry(NULL);
+    while(entry) {
+        stats->entry_cnt++;
+        if(entry->usage_count) stats->in_use_cnt++;
+        if(!entry->temporary) stats->cur_size += entry->data_size;
+        if(entry->src_type < _LV_CACHE_SRC_TYPE_LAST) {
+            stats->src_types[entry->src_type].entry_cnt++;
+            stats->src_types[entry->src_type].size += entry->data_size;
+        }
+        entry = lv_cache_get_next_entry(entry);
+    }
+}
+
+void lv_cache_reset_stats(void)
+{
+    LV_ASSERT(_cache_manager.locked);
+
+    lv_memzero(&_cache_manager.stats, sizeof(lv_cache_stats_t));
+}
+
 void lv_cache_lock(void)
 {
     lv_mutex_lock(&_cache_manager.mutex);
@@ -31,7 +31,7 @@ typedef enum {
     _LV_CACHE_SRC_TYPE_LAST,
 } lv_cache_src_type_t;
 
-typedef struct {
+typedef struct _lv_cache_entry_t {
     /**The image source or other source related to the cache content.*/
     const void * src;
 
@@ -47,10 +47,11 @@ typedef struct {
     /** Size of data in bytes*/
     uint32_t data_size;
 
-    /** On access to any cache entry, `life` of each cache entry will be incremented by their own `weight` to keep the entry alive longer*/
+    /** How expensive it is to create the entry again, e.g. the decoding time in milliseconds.
+     * The built-in cache manager keeps an entry as if it was used `weight` uses of other entries later.*/
     uint32_t weight;
 
-    /** The current `life`. Entries with the smallest life will be purged from the cache if a new entry needs to be cached*/
+    /** The current `life` of the entry. The built-in cache manager stores when the entry was used last here.*/
     int32_t life;
 
     /** Count how many times the cached data is being used.
@@ -68,6 +69,13 @@ typedef struct {
      * The entry will be closed and freed in `lv_cache_release` automatically*/
     uint32_t temporary  : 1;
 
+    /** An entry created from the data of this entry, e.g. the image converted to an other color format.
+     * Set it with `lv_cache_set_derived`. The built-in cache manager drops it together with this entry.*/
+    struct _lv_cache_entry_t * derived;
+
+    /** The entry whose `derived` entry this entry is*/
+    struct _lv_cache_entry_t * base;
+
     /**Any user data if needed*/
     void * user_data;
 } lv_cache_entry_t;
@@ -99,6 +107,14 @@ typedef lv_cache_entry_t * (*lv_cache_find_cb)(const void * src_ptr, lv_cache_sr
  */
 typedef void (*lv_cache_invalidate_cb)(lv_cache_entry_t * entry);
 
+/**
+ * Link an entry created from the data of an other entry to it, so it's dropped together with that entry.
+ * Temporary entries are not linked as they are dropped when released.
+ * @param base      the entry whose data was used to create `derived`
+ * @param derived   the new entry. The previous derived entry of `base` is dropped.
+ */
+void lv_cache_set_derived(lv_cache_entry_t * base, lv_cache_entry_t * derived);
+
 /**
  * Get the data of a cache entry.
  * It is considered a cached data access so the cache manager can count that
@@ -121,6 +137,37 @@ typedef void (*lv_cache_release_cb)(lv_cache_entry_t * entry);
  */
 typedef void (*lv_cache_set_max_size_cb)(size_t size);
 
+/**
+ * Iterate over the entries of the cache
+ * @param entry     NULL to get the first entry, else the previous entry
+ * @return          the next entry or NULL if there are no more entries
+ */
+typedef lv_cache_entry_t * (*lv_cache_get_next_entry_cb)(lv_cache_entry_t * entry);
+
+/**
+ * Drop all the entries and free the memory used by the cache manager
+ */
+typedef void (*lv_cache_deinit_cb)(void);
+
+typedef struct {
+    uint32_t entry_cnt;     /**< Number of entries with this source type*/
+    size_t size;            /**< Total size of these entries in bytes*/
+    uint32_t hit_cnt;       /**< `lv_cache_find_counted` found an entry with this source type*/
+    uint32_t miss_cnt;      /**< `lv_cache_find_counted` didn't find an entry with this source type*/
+} lv_cache_src_type_stats_t;
+
+typedef struct {
+    uint32_t hit_cnt;           /**< `lv_cache_find_counted` found an entry*/
+    uint32_t miss_cnt;          /**< `lv_cache_find_counted` didn't find an entry*/
+    uint32_t evict_cnt;         /**< An entry was dropped to make room for a new one or to shrink the cache*/
+    uint32_t temporary_cnt;     /**< A temporary entry was added as the data didn't fit into the cache*/
+    uint32_t entry_cnt;         /**< Number of entries in the cache, including the temporary ones*/
+    uint32_t in_use_cnt;        /**< Number of entries whose data is being used, so they can't be dropped*/
+    size_t cur_size;            /**< Total size of the cached data in bytes, without the temporary entries*/
+    size_t max_size;            /**< The max size of the cache in bytes*/
+    lv_cache_src_type_stats_t src_types[_LV_CACHE_SRC_TYPE_LAST];
+} lv_cache_stats_t;
+
 typedef struct {
     lv_cache_add_cb add_cb;
     lv_cache_find_cb find_cb;
@@ -128,9 +175,12 @@ typedef struct {
     lv_cache_get_data_cb get_data_cb;
     lv_cache_release_cb release_cb;
     lv_cache_set_max_size_cb set_max_size_cb;
+    lv_cache_get_next_entry_cb get_next_entry_cb;   /**< Optional, needed for the iterator and the statistics*/
+    lv_cache_deinit_cb deinit_cb;                   /**< Optional, called by `_lv_cache_deinit`*/
 
     lv_mutex_t mutex;
     size_t max_size;
+    lv_cache_stats_t stats;     /**< Only the counters are stored here, the rest is calculated on request*/
     uint32_t locked     : 1;    /**< Show the mutex state, used to log unlocked cache access*/
 } lv_cache_manager_t;
 
@@ -143,10 +193,17 @@ typedef struct {
  */
 void _lv_cache_init(void);
 
+/**
+ * Deinitialize the cache module. Called by LVGL on deinit.
+ */
+void _lv_cache_deinit(void);
+
 /**
  * Add a new entry to the cache with the given size.
  * It won't allocate any buffers just free enough space to be a new entry
  * with `size` bytes fits.
+ * The source and the parameters of the entry need to be set before the next `lv_cache_find`
+ * and shouldn't be changed later.
  * @param size      the size of the new entry in bytes
  * @return          a handler for the new cache entry
  */
@@ -162,6 +219,19 @@ lv_cache_entry_t * lv_cache_add(size_t size);
  */
 lv_cache_entry_t * lv_cache_find(const void * src, lv_cache_src_type_t src_type, uint32_t param1, uint32_t param2);
 
+/**
+ * Find a cache entry like `lv_cache_find` and count it as a hit or miss in the statistics.
+ * Should be used only when the data is needed to draw an image, and not for the other lookups
+ * (e.g. to invalidate an entry or to check if an image is cached).
+ * @param src_ptr   pointer to the source data
+ * @param src_type  source type (`LV_CACHE_SRC_TYPE_PTR` or `LV_CACHE_SRC_TYPE_STR`)
+ * @param param1    param1, which was set when the cache was added
+ * @param param2    param2, which was set when the cache was added
+ * @return          the cache entry with given source and parameters or NULL if not found
+ */
+lv_cache_entry_t * lv_cache_find_counted(const void * src_ptr, lv_cache_src_type_t src_type, uint32_t param1,
+                                         uint32_t param2);
+
 /**
  * Invalidate (drop) a cache entry
  * @param entry    the entry to invalidate. (can be retrieved by `lv_cache_find()`)
@@ -196,6 +266,28 @@ void lv_cache_set_max_size(size_t size);
  */
 size_t lv_cache_get_max_size(void);
 
+/**
+ * Iterate over the entries of the cache. E.g.
+ * `for(e = lv_cache_get_next_entry(NULL); e; e = lv_cache_get_next_entry(e)) {...}`
+ * The cache shouldn't be modified while iterating.
+ * @param entry     NULL to get the first entry, else the previous entry
+ * @return          the next entry or NULL if there are no more entries (or the cache manager can't iterate)
+ */
+lv_cache_entry_t * lv_cache_get_next_entry(lv_cache_entry_t * entry);
+
+/**
+ * Get the statistics of the cache.
+ * The number of hits, misses, evictions and temporary entries are counted since
+ * the initialization or the last `lv_cache_reset_stats`.
+ * @param stats     store the statistics here
+ */
+void lv_cache_get_stats(lv_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss, evict and temporary counters of the cache
+ */
+void lv_cache_reset_stats(void);
+
 /**
  * Lock the mutex of the cache.
  * Needs to be called manually before any cache operation,
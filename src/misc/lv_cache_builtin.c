@@ -9,7 +9,6 @@
 #include "lv_cache.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
-#include "../misc/lv_ll.h"
 #include "../osal/lv_os.h"
 
 /*********************
@@ -18,10 +17,19 @@
 #define _cache_manager LV_GLOBAL_DEFAULT()->cache_manager
 #define dsc LV_GLOBAL_DEFAULT()->cache_builtin_dsc
 
+#define LRU_TO_NODE(lru_node)   ((cache_node_t *)((uint8_t *)(lru_node) - offsetof(cache_node_t, lru)))
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*The entries are allocated with some extra fields to put them into the hash table*/
+typedef struct _lv_cache_builtin_node_t {
+    lv_cache_entry_t entry;                     /*Must be the first to cast the entries to nodes*/
+    lv_hash_lru_node_t lru;                     /*Indexed in the hash table at the next find*/
+    struct _lv_cache_builtin_node_t * pending_next;
+} cache_node_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -32,7 +40,11 @@ static void invalidate_cb(lv_cache_entry_t * entry);
 static const void * get_data_cb(lv_cache_entry_t * entry);
 static void release_cb(lv_cache_entry_t * entry);
 static void set_max_size_cb(size_t new_size);
-static bool drop_yougest(void);
+static lv_cache_entry_t * get_next_entry_cb(lv_cache_entry_t * entry);
+static bool drop_least_valuable(void);
+static void index_pending(void);
+static void pending_remove(cache_node_t * node);
+static uint32_t get_hash(const void * src, lv_cache_src_type_t src_type, uint32_t param1, uint32_t param2);
 
 /**********************
  *  STATIC VARIABLES
@@ -55,8 +67,24 @@ void _lv_cache_builtin_init(void)
     _cache_manager.get_data_cb = get_data_cb;
     _cache_manager.release_cb = release_cb;
     _cache_manager.set_max_size_cb = set_max_size_cb;
+    _cache_manager.get_next_entry_cb = get_next_entry_cb;
+    _cache_manager.deinit_cb = _lv_cache_builtin_deinit;
+
+    lv_hash_lru_init(&dsc.entries);
+    dsc.pending = NULL;
+    dsc.use_cnt = 0;
+}
+
+void _lv_cache_builtin_deinit(void)
+{
+    /*The entries still in use are dropped too as nothing can use them after deinit.
+     *Dropping an entry might drop its derived entry too, so always start from the head.*/
+    while(dsc.entries.lru_head) {
+        invalidate_cb(&LRU_TO_NODE(dsc.entries.lru_head)->entry);
+    }
 
-    _lv_ll_init(&dsc.entry_ll, sizeof(lv_cache_entry_t));
+    lv_hash_lru_deinit(&dsc.entries);
+    dsc.pending = NULL;
 }
 
 
@@ -72,8 +100,8 @@ static lv_cache_entry_t * add_cb(size_t size)
     bool temporary = size > max_size ? true : false;
     if(!temporary) {
         /*Keep dropping items until there is enough space*/
-        while(dsc.cur_size + size > _cache_manager.max_size) {
-            bool ret = drop_yougest();
+        while(dsc.entries.stats.byte_cnt + size > _cache_manager.max_size) {
+            bool ret = drop_least_valuable();
 
             /*No item could be dropped.
              *It can happen because the usage_count of the remaining items are not zero.*/
@@ -85,18 +113,30 @@ static lv_cache_entry_t * add_cb(size_t size)
 
     }
 
-    lv_cache_entry_t * e = _lv_ll_ins_head(&dsc.entry_ll);
-    lv_memzero(e, sizeof(lv_cache_entry_t));
+    cache_node_t * node = lv_malloc(sizeof(cache_node_t));
+    LV_ASSERT_MALLOC(node);
+    if(node == NULL) return NULL;
+
+    lv_memzero(node, sizeof(cache_node_t));
+    lv_cache_entry_t * e = &node->entry;
     e->data_size = size;
     e->weight = 1;
+    e->life = (int32_t)dsc.use_cnt;
     e->temporary = temporary;
 
+    /*The temporary entries are not counted in the size of the cache*/
+    lv_hash_lru_add(&dsc.entries, &node->lru, temporary ? 0 : size);
+
+    /*The source is set by the caller after adding the entry, so it can be hashed only later*/
+    node->pending_next = dsc.pending;
+    dsc.pending = node;
+
     if(temporary) {
         LV_LOG_USER("cache add temporary: %"LV_PRIu32, (uint32_t)size);
+        _cache_manager.stats.temporary_cnt++;
     }
     else {
         LV_LOG_USER("cache add: %"LV_PRIu32, (uint32_t)size);
-        dsc.cur_size += size;
     }
 
     return e;
@@ -104,15 +144,18 @@ static lv_cache_entry_t * add_cb(size_t size)
 
 static lv_cache_entry_t * find_cb(const void * src, lv_cache_src_type_t src_type, uint32_t param1, uint32_t param2)
 {
-    lv_cache_entry_t * e = _lv_ll_get_head(&dsc.entry_ll);
-    while(e) {
+    index_pending();
+
+    lv_hash_lru_node_t * lru_node = lv_hash_lru_find_first(&dsc.entries, get_hash(src, src_type, param1, param2));
+    while(lru_node) {
+        lv_cache_entry_t * e = &LRU_TO_NODE(lru_node)->entry;
         if(param1 == e->param1 && param2 == e->param2 && src_type == e->src_type &&
            ((src_type == LV_CACHE_SRC_TYPE_PTR && src == e->src) ||
             (src_type == LV_CACHE_SRC_TYPE_STR && strcmp(src, e->src) == 0))) {
             return e;
         }
 
-        e = _lv_ll_get_next(&dsc.entry_ll, e);
+        lru_node = lv_hash_lru_find_next(lru_node);
     }
 
     return NULL;
@@ -122,23 +165,31 @@ static void invalidate_cb(lv_cache_entry_t * entry)
 {
     if(entry == NULL) return;
 
-    dsc.cur_size -= entry->data_size;
     LV_LOG_USER("cache drop %"LV_PRIu32, (uint32_t)entry->data_size);
 
+    cache_node_t * node = (cache_node_t *)entry;
+    if(!node->lru.indexed) pending_remove(node);
+    lv_hash_lru_remove(&dsc.entries, &node->lru);
+
+    /*The data of the derived entry was created from this entry's data*/
+    if(entry->base) entry->base->derived = NULL;
+    if(entry->derived) {
+        entry->derived->base = NULL;
+        invalidate_cb(entry->derived);
+    }
+
     if(entry->free_src) lv_free((void *)entry->src);
     if(entry->free_data) lv_draw_buf_free((void *)entry->data);
 
-    _lv_ll_remove(&dsc.entry_ll, entry);
-    lv_free(entry);
+    lv_free(node);
 }
 
 static const void * get_data_cb(lv_cache_entry_t * entry)
 {
-    lv_cache_entry_t * e = _lv_ll_get_head(&dsc.entry_ll);
-    while(e) {
-        e->life += e->weight;
-        e = _lv_ll_get_next(&dsc.entry_ll, e);
-    }
+    /*It's the most recently used entry now*/
+    lv_hash_lru_touch(&dsc.entries, &((cache_node_t *)entry)->lru);
+    dsc.use_cnt++;
+    entry->life = (int32_t)dsc.use_cnt;
 
     entry->usage_count++;
 
@@ -163,8 +214,8 @@ static void release_cb(lv_cache_entry_t * entry)
 
 static void set_max_size_cb(size_t new_size)
 {
-    while(dsc.cur_size > new_size) {
-        bool ret = drop_yougest();
+    while(dsc.entries.stats.byte_cnt > new_size) {
+        bool ret = drop_least_valuable();
 
         /*No item could be dropped.
          *It can happen because the usage_count of the remaining items are not zero.*/
@@ -172,23 +223,106 @@ static void set_max_size_cb(size_t new_size)
     }
 }
 
-static bool drop_yougest(void)
+static lv_cache_entry_t * get_next_entry_cb(lv_cache_entry_t * entry)
 {
+    lv_hash_lru_node_t * next = entry ? ((cache_node_t *)entry)->lru.lru_next : dsc.entries.lru_head;
+    return next ? &LRU_TO_NODE(next)->entry : NULL;
+}
 
-    int32_t life_min = INT32_MAX;
+/**
+ * Drop the entry whose last use plus weight is the smallest, so the entries which are
+ * expensive to create are kept longer. With equal weights it's the least recently used entry.
+ * @return      false: all the entries are in use
+ */
+static bool drop_least_valuable(void)
+{
+    /*The entries are ordered by their last use, so the ones closer to the head can't be less valuable
+     *than an entry found already if they were used later than its value. Usually only a few entries
+     *are checked. The use counter can overflow, so compare the differences.*/
     lv_cache_entry_t * e_min = NULL;
-
-    lv_cache_entry_t * e = _lv_ll_get_head(&dsc.entry_ll);
-    while(e) {
-        if(e->life < life_min && e->usage_count == 0) e_min = e;
-        e = _lv_ll_get_next(&dsc.entry_ll, e);
+    uint32_t value_min = 0;
+    lv_hash_lru_node_t * lru_node = dsc.entries.lru_tail;
+    while(lru_node) {
+        lv_cache_entry_t * e = &LRU_TO_NODE(lru_node)->entry;
+        if(e_min && (int32_t)((uint32_t)e->life - value_min) >= 0) break;
+
+        /*The entries in use can't be dropped. The derived entry is dropped too, so it can't be in use either.*/
+        if(e->usage_count == 0 && (e->derived == NULL || e->derived->usage_count == 0)) {
+            uint32_t value = (uint32_t)e->life + e->weight;
+            if(e_min == NULL || (int32_t)(value - value_min) < 0) {
+                e_min = e;
+                value_min = value;
+            }
+        }
+        lru_node = lru_node->lru_prev;
     }
 
-    if(e_min == NULL) {
-        return false;
-    }
+    if(e_min == NULL) return false;
 
     invalidate_cb(e_min);
+    _cache_manager.stats.evict_cnt++;
     return true;
+}
+
+/**
+ * Add the new entries to the hash table. The source needs to be set before the next find,
+ * so the entries without a source can't be found at all. They stay only in the list to be dropped sometime.
+ */
+static void index_pending(void)
+{
+    cache_node_t * node = dsc.pending;
+    while(node) {
+        cache_node_t * next = node->pending_next;
+        lv_cache_entry_t * e = &node->entry;
+        node->pending_next = NULL;
+        if(e->src) {
+            lv_hash_lru_index(&dsc.entries, &node->lru, get_hash(e->src, e->src_type, e->param1, e->param2));
+        }
+        node = next;
+    }
+
+    dsc.pending = NULL;
+}
+
+/**
+ * Remove an entry from the pending list
+ * @param node      the node of an entry which is not indexed yet
+ */
+static void pending_remove(cache_node_t * node)
+{
+    cache_node_t ** prev_next = &dsc.pending;
+    while(*prev_next) {
+        if(*prev_next == node) {
+            *prev_next = node->pending_next;
+            return;
+        }
+        prev_next = &(*prev_next)->pending_next;
+    }
+}
+
+static uint32_t get_hash(const void * src, lv_cache_src_type_t src_type, uint32_t param1, uint32_t param2)
+{
+    uint32_t h = 2166136261U;
+    if(src_type == LV_CACHE_SRC_TYPE_STR) {
+        /*FNV-1a*/
+        const uint8_t * s = src;
+        while(*s) {
+            h = (h ^ *s) * 16777619U;
+            s++;
+        }
+    }
+    else {
+        uint64_t v = (uint64_t)(lv_uintptr_t)src;
+        h ^= (uint32_t)(v ^ (v >> 32));
+    }
+
+    h ^= param1 * 2654435761U;
+    h ^= param2 * 2246822519U;
+    h ^= (uint32_t)src_type;
 
+    /*Mix the bits as only the lower bits are used to select the bucket*/
+    h ^= h >> 16;
+    h *= 0x7feb352dU;
+    h ^= h >> 15;
+    return h;
 }
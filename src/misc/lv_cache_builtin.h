@@ -13,7 +13,7 @@ extern "C" {
 /*********************
  *      INCLUDES
  *********************/
-#include "lv_ll.h"
+#include "lv_hash_lru.h"
 
 /*********************
  *      DEFINES
@@ -23,9 +23,13 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+struct _lv_cache_builtin_node_t;
+
 typedef struct {
-    uint32_t cur_size;
-    lv_ll_t entry_ll;
+    lv_hash_lru_t entries;                          /**< The entries by their source and from the most to the least
+                                                     *   recently used. The temporary entries have 0 size in it.*/
+    struct _lv_cache_builtin_node_t * pending;      /**< New entries to add to the hash table at the next find*/
+    uint32_t use_cnt;                               /**< Incremented on every use of an entry to weigh the entries*/
 } lv_cache_builtin_dsc_t;
 
 /**********************
@@ -34,6 +38,12 @@ typedef struct {
 
 void _lv_cache_builtin_init(void);
 
+/**
+ * Drop all the entries and free the hash table of the built-in cache.
+ * Called by `_lv_cache_deinit`.
+ */
+void _lv_cache_builtin_deinit(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -42,6 +42,8 @@ uint8_t lv_color_format_get_size(lv_color_format_t cf)
         case LV_COLOR_FORMAT_L8:
         case LV_COLOR_FORMAT_A8:
         case LV_COLOR_FORMAT_I8:
+        /*Only the Y plane. The U and V planes follow it*/
+        case LV_COLOR_FORMAT_I420:
             return 1;
         case LV_COLOR_FORMAT_RGB565:
             return 2;
@@ -51,6 +53,7 @@ uint8_t lv_color_format_get_size(lv_color_format_t cf)
             return 3;
         case LV_COLOR_FORMAT_ARGB8888:
         case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
             return 4;
 
         case LV_COLOR_FORMAT_UNKNOWN:
@@ -73,6 +76,8 @@ uint8_t lv_color_format_get_bpp(lv_color_format_t cf)
         case LV_COLOR_FORMAT_L8:
         case LV_COLOR_FORMAT_A8:
         case LV_COLOR_FORMAT_I8:
+        /*Only the Y plane. The U and V planes follow it*/
+        case LV_COLOR_FORMAT_I420:
             return 8;
         case LV_COLOR_FORMAT_RGB565:
             return 16;
@@ -82,6 +87,7 @@ uint8_t lv_color_format_get_bpp(lv_color_format_t cf)
             return 24;
         case LV_COLOR_FORMAT_ARGB8888:
         case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
             return 32;
 
         case LV_COLOR_FORMAT_UNKNOWN:
@@ -97,6 +103,7 @@ bool lv_color_format_has_alpha(lv_color_format_t cf)
         case LV_COLOR_FORMAT_I8:
         case LV_COLOR_FORMAT_RGB565A8:
         case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
             return true;
         default:
             return false;
@@ -110,16 +110,20 @@ enum _lv_color_format_t {
 
     /*2 byte (+alpha) formats*/
     LV_COLOR_FORMAT_RGB565            = 0x12,
-    LV_COLOR_FORMAT_RGB565A8          = 0x14    /**< Color array followed by Alpha array*/,
+    LV_COLOR_FORMAT_RGB565A8          = 0x14,   /**< Color array followed by Alpha array*/
 
     /*3 byte (+alpha) formats*/
     LV_COLOR_FORMAT_RGB888            = 0x0F,
     LV_COLOR_FORMAT_ARGB8888          = 0x10,
     LV_COLOR_FORMAT_XRGB8888          = 0x11,
+    LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED = 0x15,  /**< The color channels are multiplied with alpha*/
 
     /*Miscellaneous formats*/
     LV_COLOR_FORMAT_NATIVE_REVERSED   = 0x1A,
 
+    /*YUV formats*/
+    LV_COLOR_FORMAT_I420              = 0x1B,   /**< Y plane followed by the U and V planes in half resolution*/
+
     /*Formats not supported by software renderer but kept here so GPU can use it*/
     LV_COLOR_FORMAT_A1                = 0x0B,
     LV_COLOR_FORMAT_A2                = 0x0C,
@@ -146,6 +150,13 @@ typedef _lv_color_format_t lv_color_format_t;
 typedef uint8_t lv_color_format_t;
 #endif /*DOXYGEN*/
 
+/*The ARGB8888 format of the layers and the images decoded at run-time*/
+#if LV_USE_DRAW_SW && LV_DRAW_SW_PREMULTIPLIED
+#define LV_COLOR_FORMAT_ARGB8888_LAYER LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED
+#else
+#define LV_COLOR_FORMAT_ARGB8888_LAYER LV_COLOR_FORMAT_ARGB8888
+#endif
+
 #define LV_COLOR_FORMAT_IS_INDEXED(cf) ((cf) >= LV_COLOR_FORMAT_I1 && (cf) <= LV_COLOR_FORMAT_I8)
 #define LV_COLOR_INDEXED_PALETTE_SIZE(cf) ((cf) == LV_COLOR_FORMAT_I1 ? 2 :\
                                            (cf) == LV_COLOR_FORMAT_I2 ? 4 :\
@@ -168,14 +179,15 @@ typedef uint8_t lv_color_format_t;
 /**
  * Get the pixel size of a color format in bytes
  * @param src_cf a color format (`LV_COLOR_FORMAT_...`)
- * @return the pixel size in bytes
+ * @return the pixel size in bytes. For `LV_COLOR_FORMAT_I420` it's the size in the Y plane,
+ *         so `stride * h` doesn't include the U and V planes.
  */
 uint8_t lv_color_format_get_size(lv_color_format_t src_cf);
 
 /**
  * Get the pixel size of a color format in bits, bpp
  * @param src_cf a color format (`LV_COLOR_FORMAT_...`)
- * @return the pixel size in bits
+ * @return the pixel size in bits. For `LV_COLOR_FORMAT_I420` it's the size in the Y plane.
  */
 uint8_t lv_color_format_get_bpp(lv_color_format_t cf);
 
@@ -80,6 +80,78 @@ static inline lv_color32_t lv_color_mix32(lv_color32_t fg, lv_color32_t bg)
     return bg;
 }
 
+/**
+ * Multiply the color channels with the alpha channel.
+ * @param c     a color with straight alpha
+ * @return      the color with premultiplied alpha
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color32_t lv_color32_premultiply(lv_color32_t c)
+{
+    if(c.alpha == LV_OPA_COVER) return c;
+
+    c.red = LV_UDIV255((uint32_t)c.red * c.alpha + 127);
+    c.green = LV_UDIV255((uint32_t)c.green * c.alpha + 127);
+    c.blue = LV_UDIV255((uint32_t)c.blue * c.alpha + 127);
+    return c;
+}
+
+/**
+ * Divide the color channels by the alpha channel. It's slow as it needs divisions.
+ * @param c     a color with premultiplied alpha
+ * @return      the color with straight alpha
+ */
+static inline lv_color32_t lv_color32_unpremultiply(lv_color32_t c)
+{
+    if(c.alpha == LV_OPA_COVER) return c;
+    if(c.alpha == 0) {
+        c.red = 0;
+        c.green = 0;
+        c.blue = 0;
+        return c;
+    }
+
+    uint32_t half = c.alpha >> 1;
+    c.red = LV_MIN(((uint32_t)c.red * 255 + half) / c.alpha, 255);
+    c.green = LV_MIN(((uint32_t)c.green * 255 + half) / c.alpha, 255);
+    c.blue = LV_MIN(((uint32_t)c.blue * 255 + half) / c.alpha, 255);
+    return c;
+}
+
+/**
+ * Draw a premultiplied color over an other premultiplied color: `fg + bg * (1 - fg.alpha)`.
+ * @param fg    the foreground color with premultiplied alpha
+ * @param bg    the background color with premultiplied alpha
+ * @return      the result with premultiplied alpha
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color32_t lv_color32_premultiplied_over(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha == 0xFF) return fg;
+    if(fg.alpha == 0) return bg;
+
+    uint32_t inv = 255 - fg.alpha;
+    bg.red = fg.red + LV_UDIV255((uint32_t)bg.red * inv);
+    bg.green = fg.green + LV_UDIV255((uint32_t)bg.green * inv);
+    bg.blue = fg.blue + LV_UDIV255((uint32_t)bg.blue * inv);
+    bg.alpha = fg.alpha + LV_UDIV255((uint32_t)bg.alpha * inv);
+    return bg;
+}
+
+/**
+ * Scale all channels of a premultiplied color, i.e. apply an opacity on it.
+ * @param c     a color with premultiplied alpha
+ * @param opa   the opacity to apply
+ * @return      the scaled color
+ */
+LV_ATTRIBUTE_FAST_MEM static inline lv_color32_t lv_color32_premultiplied_scale(lv_color32_t c, lv_opa_t opa)
+{
+    if(opa >= LV_OPA_MAX) return c;
+
+    c.red = LV_UDIV255((uint32_t)c.red * opa);
+    c.green = LV_UDIV255((uint32_t)c.green * opa);
+    c.blue = LV_UDIV255((uint32_t)c.blue * opa);
+    c.alpha = LV_UDIV255((uint32_t)c.alpha * opa);
+    return c;
+}
 
 //! @endcond
 
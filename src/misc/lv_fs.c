@@ -364,6 +364,46 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, const void ** buf_p, uint32_t * size_p)
+{
+    *buf_p = NULL;
+    *size_p = 0;
+
+    if(file_p->drv == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    /*Memory buffers are already in the memory*/
+    if(file_p->drv->cache_size == LV_FS_CACHE_FROM_BUFFER) {
+        *buf_p = file_p->cache->buffer;
+        *size_p = file_p->cache->end;
+        return LV_FS_RES_OK;
+    }
+
+    if(file_p->drv->map_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    return file_p->drv->map_cb(file_p->drv, file_p->file_d, buf_p, size_p);
+}
+
+lv_fs_res_t lv_fs_unmap(lv_fs_file_t * file_p, const void * buf, uint32_t size)
+{
+    if(file_p->drv == NULL) {
+        return LV_FS_RES_INV_PARAM;
+    }
+
+    if(file_p->drv->cache_size == LV_FS_CACHE_FROM_BUFFER) {
+        return LV_FS_RES_OK;
+    }
+
+    if(file_p->drv->unmap_cb == NULL) {
+        return LV_FS_RES_NOT_IMP;
+    }
+
+    return file_p->drv->unmap_cb(file_p->drv, file_p->file_d, buf, size);
+}
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
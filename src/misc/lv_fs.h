@@ -83,6 +83,7 @@ typedef enum {
 typedef struct _lv_fs_drv_t {
     char letter;
     uint32_t cache_size;
+    bool thread_safe;   /**< The callbacks can be called from more threads at once for different files*/
     bool (*ready_cb)(struct _lv_fs_drv_t * drv);
 
     void * (*open_cb)(struct _lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
@@ -92,6 +93,10 @@ typedef struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    /*Optional: map the whole file into the memory for reading and unmap it*/
+    lv_fs_res_t (*map_cb)(struct _lv_fs_drv_t * drv, void * file_p, const void ** buf_p, uint32_t * size_p);
+    lv_fs_res_t (*unmap_cb)(struct _lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t size);
+
     void * (*dir_open_cb)(struct _lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(struct _lv_fs_drv_t * drv, void * rddir_p, char * fn);
     lv_fs_res_t (*dir_close_cb)(struct _lv_fs_drv_t * drv, void * rddir_p);
@@ -226,6 +231,27 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Map the whole content of a file into the memory for reading, without copying it.
+ * Memory buffers opened with `LV_FS_MEMFS_LETTER` are always mappable,
+ * other drivers need to support it with `map_cb`.
+ * The file needs to be kept open while the mapped memory is used.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf_p     store the address of the file's content here
+ * @param size_p    store the size of the file here
+ * @return          LV_FS_RES_OK, LV_FS_RES_NOT_IMP if the driver can't map files or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_map(lv_fs_file_t * file_p, const void ** buf_p, uint32_t * size_p);
+
+/**
+ * Release the memory mapped by `lv_fs_map`. Needs to be called before closing the file.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       the address returned by `lv_fs_map`
+ * @param size      the size returned by `lv_fs_map`
+ * @return          LV_FS_RES_OK or any error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_unmap(lv_fs_file_t * file_p, const void * buf, uint32_t size);
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
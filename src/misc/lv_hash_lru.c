@@ -0,0 +1,180 @@
+/**
+ * @file lv_hash_lru.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_hash_lru.h"
+#include "lv_assert.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Small, as the buckets are doubled when there are as many entries as buckets anyway.
+ *So the small caches (e.g. a shard of the circle cache) don't allocate more buckets than entries.*/
+#define BUCKET_CNT_MIN  4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lru_unlink(lv_hash_lru_t * hl, lv_hash_lru_node_t * node);
+static void lru_push_head(lv_hash_lru_t * hl, lv_hash_lru_node_t * node);
+static void grow_buckets(lv_hash_lru_t * hl);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_hash_lru_init(lv_hash_lru_t * hl)
+{
+    lv_memzero(hl, sizeof(lv_hash_lru_t));
+}
+
+void lv_hash_lru_deinit(lv_hash_lru_t * hl)
+{
+    lv_free(hl->buckets);
+    lv_memzero(hl, sizeof(lv_hash_lru_t));
+}
+
+void lv_hash_lru_add(lv_hash_lru_t * hl, lv_hash_lru_node_t * node, uint32_t size)
+{
+    node->bucket_next = NULL;
+    node->hash = 0;
+    node->size = size;
+    node->indexed = 0;
+    lru_push_head(hl, node);
+
+    hl->stats.entry_cnt++;
+    hl->stats.byte_cnt += size;
+}
+
+void lv_hash_lru_index(lv_hash_lru_t * hl, lv_hash_lru_node_t * node, uint32_t hash)
+{
+    LV_ASSERT(node->indexed == 0);
+
+    node->hash = hash;
+    if(hl->indexed_cnt >= hl->bucket_cnt) grow_buckets(hl);
+    if(hl->bucket_cnt == 0) return;
+
+    uint32_t b = hash & (hl->bucket_cnt - 1);
+    node->bucket_next = hl->buckets[b];
+    hl->buckets[b] = node;
+    node->indexed = 1;
+    hl->indexed_cnt++;
+}
+
+void lv_hash_lru_remove(lv_hash_lru_t * hl, lv_hash_lru_node_t * node)
+{
+    if(node->indexed) {
+        lv_hash_lru_node_t ** prev_next = &hl->buckets[node->hash & (hl->bucket_cnt - 1)];
+        while(*prev_next != node) prev_next = &(*prev_next)->bucket_next;
+        *prev_next = node->bucket_next;
+        node->bucket_next = NULL;
+        node->indexed = 0;
+        hl->indexed_cnt--;
+    }
+
+    lru_unlink(hl, node);
+
+    hl->stats.entry_cnt--;
+    hl->stats.byte_cnt -= node->size;
+}
+
+void lv_hash_lru_touch(lv_hash_lru_t * hl, lv_hash_lru_node_t * node)
+{
+    if(hl->lru_head == node) return;
+
+    lru_unlink(hl, node);
+    lru_push_head(hl, node);
+}
+
+lv_hash_lru_node_t * lv_hash_lru_find_first(const lv_hash_lru_t * hl, uint32_t hash)
+{
+    if(hl->bucket_cnt == 0) return NULL;
+
+    lv_hash_lru_node_t * node = hl->buckets[hash & (hl->bucket_cnt - 1)];
+    while(node && node->hash != hash) node = node->bucket_next;
+    return node;
+}
+
+lv_hash_lru_node_t * lv_hash_lru_find_next(const lv_hash_lru_node_t * node)
+{
+    lv_hash_lru_node_t * next = node->bucket_next;
+    while(next && next->hash != node->hash) next = next->bucket_next;
+    return next;
+}
+
+void lv_hash_lru_reset_stats(lv_hash_lru_t * hl)
+{
+    hl->stats.hit_cnt = 0;
+    hl->stats.miss_cnt = 0;
+    hl->stats.evict_cnt = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lru_unlink(lv_hash_lru_t * hl, lv_hash_lru_node_t * node)
+{
+    if(node->lru_prev) node->lru_prev->lru_next = node->lru_next;
+    else hl->lru_head = node->lru_next;
+
+    if(node->lru_next) node->lru_next->lru_prev = node->lru_prev;
+    else hl->lru_tail = node->lru_prev;
+
+    node->lru_prev = NULL;
+    node->lru_next = NULL;
+}
+
+static void lru_push_head(lv_hash_lru_t * hl, lv_hash_lru_node_t * node)
+{
+    node->lru_prev = NULL;
+    node->lru_next = hl->lru_head;
+    if(hl->lru_head) hl->lru_head->lru_prev = node;
+    else hl->lru_tail = node;
+    hl->lru_head = node;
+}
+
+/**
+ * Double the number of buckets. Nothing happens if there is no memory for them.
+ */
+static void grow_buckets(lv_hash_lru_t * hl)
+{
+    uint32_t new_cnt = hl->bucket_cnt ? hl->bucket_cnt * 2 : BUCKET_CNT_MIN;
+    lv_hash_lru_node_t ** new_buckets = lv_malloc(new_cnt * sizeof(lv_hash_lru_node_t *));
+    if(new_buckets == NULL) return;
+    lv_memzero(new_buckets, new_cnt * sizeof(lv_hash_lru_node_t *));
+
+    uint32_t i;
+    for(i = 0; i < hl->bucket_cnt; i++) {
+        lv_hash_lru_node_t * node = hl->buckets[i];
+        while(node) {
+            lv_hash_lru_node_t * next = node->bucket_next;
+            uint32_t b = node->hash & (new_cnt - 1);
+            node->bucket_next = new_buckets[b];
+            new_buckets[b] = node;
+            node = next;
+        }
+    }
+
+    lv_free(hl->buckets);
+    hl->buckets = new_buckets;
+    hl->bucket_cnt = new_cnt;
+}
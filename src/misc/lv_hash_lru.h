@@ -0,0 +1,134 @@
+/**
+ * @file lv_hash_lru.h
+ * A hash table and a least recently used list of the entries of a cache.
+ * The nodes are embedded into the entries, so nothing is allocated for them.
+ */
+
+#ifndef LV_HASH_LRU_H
+#define LV_HASH_LRU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Put it as the first field of a cache entry to cast the nodes to entries
+ */
+typedef struct _lv_hash_lru_node_t {
+    struct _lv_hash_lru_node_t * bucket_next;   /**< The next node in the same bucket*/
+    struct _lv_hash_lru_node_t * lru_prev;      /**< The more recently used node*/
+    struct _lv_hash_lru_node_t * lru_next;      /**< The less recently used node*/
+    uint32_t hash;
+    uint32_t size;                              /**< Memory used by the entry in bytes*/
+    uint32_t indexed : 1;                       /**< It's in the hash table, not only in the list*/
+} lv_hash_lru_node_t;
+
+typedef struct {
+    uint32_t hit_cnt;       /**< An entry was found in the cache*/
+    uint32_t miss_cnt;      /**< An entry had to be created*/
+    uint32_t evict_cnt;     /**< An entry was freed to make room for a new one*/
+    uint32_t entry_cnt;     /**< Number of entries in the cache*/
+    uint32_t byte_cnt;      /**< Memory used by the entries*/
+} lv_hash_lru_stats_t;
+
+typedef struct {
+    lv_hash_lru_node_t ** buckets;
+    uint32_t bucket_cnt;                /**< Number of buckets, a power of 2*/
+    uint32_t indexed_cnt;               /**< Number of nodes in the buckets*/
+    lv_hash_lru_node_t * lru_head;      /**< The most recently used node*/
+    lv_hash_lru_node_t * lru_tail;      /**< The least recently used node*/
+    lv_hash_lru_stats_t stats;          /**< Only `entry_cnt` and `byte_cnt` are updated here*/
+} lv_hash_lru_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an empty hash table and list
+ * @param hl        pointer to a hash LRU
+ */
+void lv_hash_lru_init(lv_hash_lru_t * hl);
+
+/**
+ * Free the buckets. The entries need to be freed by the cache.
+ * @param hl        pointer to a hash LRU
+ */
+void lv_hash_lru_deinit(lv_hash_lru_t * hl);
+
+/**
+ * Add a node as the most recently used one. It can't be found until `lv_hash_lru_index` is called.
+ * @param hl        pointer to a hash LRU
+ * @param node      the node of a new entry
+ * @param size      memory used by the entry in bytes
+ */
+void lv_hash_lru_add(lv_hash_lru_t * hl, lv_hash_lru_node_t * node, uint32_t size);
+
+/**
+ * Put an added node into the hash table. The buckets are doubled if there are more nodes than buckets,
+ * but if there is no memory for them the lists in the buckets are longer.
+ * @param hl        pointer to a hash LRU
+ * @param node      an added node
+ * @param hash      the hash of the entry's key
+ */
+void lv_hash_lru_index(lv_hash_lru_t * hl, lv_hash_lru_node_t * node, uint32_t hash);
+
+/**
+ * Remove a node from the hash table and from the list
+ * @param hl        pointer to a hash LRU
+ * @param node      an added node
+ */
+void lv_hash_lru_remove(lv_hash_lru_t * hl, lv_hash_lru_node_t * node);
+
+/**
+ * Mark a node as the most recently used one
+ * @param hl        pointer to a hash LRU
+ * @param node      an added node
+ */
+void lv_hash_lru_touch(lv_hash_lru_t * hl, lv_hash_lru_node_t * node);
+
+/**
+ * Get the first node with a given hash. The key of the entry still needs to be compared.
+ * @param hl        pointer to a hash LRU
+ * @param hash      the hash to find
+ * @return          the first node with `hash` or NULL
+ */
+lv_hash_lru_node_t * lv_hash_lru_find_first(const lv_hash_lru_t * hl, uint32_t hash);
+
+/**
+ * Get the next node with the same hash
+ * @param node      a node returned by `lv_hash_lru_find_first` or `lv_hash_lru_find_next`
+ * @return          the next node with the hash of `node` or NULL
+ */
+lv_hash_lru_node_t * lv_hash_lru_find_next(const lv_hash_lru_node_t * node);
+
+/**
+ * Reset the hit, miss and evict counters
+ * @param hl        pointer to a hash LRU
+ */
+void lv_hash_lru_reset_stats(lv_hash_lru_t * hl);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_HASH_LRU_H*/
@@ -0,0 +1,117 @@
+/**
+ * @file lv_lz4.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_lz4.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MIN_MATCH   4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const uint8_t * read_length(const uint8_t * in, const uint8_t * in_end, uint32_t * len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lv_lz4_decompress(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size)
+{
+    const uint8_t * in_end = in + in_size;
+    uint8_t * out_start = out;
+    uint8_t * out_end = out + out_size;
+
+    while(in < in_end) {
+        /*The token has the length of the literals and the match in its upper and lower 4 bits*/
+        uint8_t token = *in;
+        in++;
+
+        uint32_t lit_len = token >> 4;
+        if(lit_len == 15) {
+            in = read_length(in, in_end, &lit_len);
+            if(in == NULL) return 0;
+        }
+
+        if(lit_len > (uint32_t)(in_end - in) || lit_len > (uint32_t)(out_end - out)) return 0;
+        lv_memcpy(out, in, lit_len);
+        in += lit_len;
+        out += lit_len;
+
+        /*The last sequence has only literals*/
+        if(in == in_end) break;
+
+        if(in_end - in < 2) return 0;
+        uint32_t offset = (uint32_t)in[0] | ((uint32_t)in[1] << 8);
+        in += 2;
+        if(offset == 0 || offset > (uint32_t)(out - out_start)) return 0;
+
+        uint32_t match_len = token & 0x0F;
+        if(match_len == 15) {
+            in = read_length(in, in_end, &match_len);
+            if(in == NULL) return 0;
+        }
+        match_len += MIN_MATCH;
+        if(match_len > (uint32_t)(out_end - out)) return 0;
+
+        /*The match can overlap with the bytes being written, e.g. if a pixel is repeated*/
+        const uint8_t * match = out - offset;
+        if(offset >= match_len) {
+            lv_memcpy(out, match, match_len);
+            out += match_len;
+        }
+        else {
+            uint8_t * match_end = out + match_len;
+            while(out < match_end) {
+                *out = *match;
+                out++;
+                match++;
+            }
+        }
+    }
+
+    return (uint32_t)(out - out_start);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Add the extra bytes of a length to `len`
+ * @param in        pointer to the first extra byte
+ * @param in_end    end of the compressed data
+ * @param len       the length from the token, the extra bytes are added to it
+ * @return          pointer after the last extra byte or NULL if the data is truncated
+ */
+static const uint8_t * read_length(const uint8_t * in, const uint8_t * in_end, uint32_t * len)
+{
+    uint8_t b;
+    do {
+        if(in >= in_end) return NULL;
+        b = *in;
+        in++;
+        *len += b;
+    } while(b == 255);
+
+    return in;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file lv_lz4.h
+ *
+ */
+
+#ifndef LV_LZ4_H
+#define LV_LZ4_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Decompress an LZ4 block (the raw block format of LZ4, without frame header).
+ * The matches refer to the already decompressed data so the whole block is decompressed at once.
+ * @param in        the compressed block
+ * @param in_size   size of the compressed block in bytes
+ * @param out       store the decompressed data here
+ * @param out_size  size of `out` in bytes
+ * @return          number of decompressed bytes or 0 if the data is invalid or doesn't fit into `out`
+ */
+uint32_t lv_lz4_decompress(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_LZ4_H*/
@@ -0,0 +1,62 @@
+/**
+ * @file lv_mem_budget.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_budget.h"
+#include "lv_assert.h"
+#include "../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_budget_init(lv_mem_budget_t * budget, uint32_t size)
+{
+    budget->size = size;
+    budget->used = 0;
+}
+
+void * lv_mem_budget_alloc(lv_mem_budget_t * budget, uint32_t size)
+{
+    if(size > budget->size - budget->used) return NULL;
+
+    /*Not asserted: the callers free some of their blocks and try again when it fails*/
+    void * p = lv_malloc(size);
+    if(p) budget->used += size;
+    return p;
+}
+
+void lv_mem_budget_free(lv_mem_budget_t * budget, void * p, uint32_t size)
+{
+    LV_ASSERT(budget->used >= size);
+    lv_free(p);
+    budget->used -= size;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
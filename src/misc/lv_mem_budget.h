@@ -0,0 +1,70 @@
+/**
+ * @file lv_mem_budget.h
+ * A memory budget for caches. It's not an allocator: the blocks are allocated with `lv_malloc` one by one,
+ * but not more than the size of the budget in total, so the cache can free its old entries to make room.
+ */
+
+#ifndef LV_MEM_BUDGET_H
+#define LV_MEM_BUDGET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t size;          /**< Max. number of bytes to allocate*/
+    uint32_t used;          /**< Number of allocated bytes*/
+} lv_mem_budget_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a memory budget. It doesn't allocate any memory.
+ * @param budget    pointer to a memory budget
+ * @param size      max. number of bytes to allocate within the budget
+ */
+void lv_mem_budget_init(lv_mem_budget_t * budget, uint32_t size);
+
+/**
+ * Allocate a block with `lv_malloc` if it fits into the budget.
+ * Running out of the budget is expected so it's not reported as an error.
+ * @param budget    pointer to a memory budget
+ * @param size      the required size in bytes
+ * @return          pointer to the block or NULL if it doesn't fit into the budget or out of memory
+ */
+void * lv_mem_budget_alloc(lv_mem_budget_t * budget, uint32_t size);
+
+/**
+ * Free a block allocated within a budget
+ * @param budget    pointer to a memory budget
+ * @param p         pointer to the block
+ * @param size      the size passed to `lv_mem_budget_alloc`
+ */
+void lv_mem_budget_free(lv_mem_budget_t * budget, void * p, uint32_t size);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_BUDGET_H*/
@@ -0,0 +1,114 @@
+/**
+ * @file lv_rle.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_rle.h"
+#include "lv_math.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool next_packet(lv_rle_t * rle);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_rle_init(lv_rle_t * rle, const uint8_t * in, uint32_t in_size, uint32_t blk_size)
+{
+    rle->in = in;
+    rle->in_end = in + in_size;
+    rle->blk_size = blk_size;
+    rle->remain = 0;
+    rle->blk = NULL;
+}
+
+uint32_t lv_rle_decompress(lv_rle_t * rle, uint8_t * out, uint32_t out_size)
+{
+    uint32_t done = 0;
+    while(done < out_size) {
+        if(rle->remain == 0 && !next_packet(rle)) break;
+
+        uint32_t n = LV_MIN(rle->remain, out_size - done);
+        if(rle->blk) {
+            if(out && rle->blk_size == 1) {
+                lv_memset(out + done, rle->blk[0], n);
+            }
+            else if(out) {
+                /*Continue the repeated block where the last call stopped*/
+                uint32_t blk_ofs = (rle->blk_size - rle->remain % rle->blk_size) % rle->blk_size;
+                uint32_t i;
+                for(i = 0; i < n; i++) {
+                    out[done + i] = rle->blk[blk_ofs];
+                    blk_ofs++;
+                    if(blk_ofs == rle->blk_size) blk_ofs = 0;
+                }
+            }
+        }
+        else {
+            if(out) lv_memcpy(out + done, rle->in, n);
+            rle->in += n;
+        }
+
+        rle->remain -= n;
+        done += n;
+    }
+
+    return done;
+}
+
+bool lv_rle_is_done(const lv_rle_t * rle)
+{
+    return rle->remain == 0 && rle->in >= rle->in_end;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Start a new packet
+ * @param rle   pointer to a decoder state
+ * @return      true: there is a new valid packet; false: the data is over or truncated
+ */
+static bool next_packet(lv_rle_t * rle)
+{
+    if(rle->in >= rle->in_end) return false;
+
+    uint8_t ctrl = *rle->in;
+    rle->in++;
+    uint32_t cnt = (ctrl & 0x7F) + 1;
+    if(ctrl & 0x80) {
+        if(rle->in + rle->blk_size > rle->in_end) return false;
+        rle->blk = rle->in;
+        rle->in += rle->blk_size;
+    }
+    else {
+        if(rle->in + cnt * rle->blk_size > rle->in_end) return false;
+        rle->blk = NULL;
+    }
+
+    rle->remain = cnt * rle->blk_size;
+    return true;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file lv_rle.h
+ *
+ */
+
+#ifndef LV_RLE_H
+#define LV_RLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * State of a run-length decoder. The data is a series of packets, each starting with a control byte `c`.
+ * If `c & 0x80` one block follows which is repeated `(c & 0x7F) + 1` times, else `c + 1` blocks follow to copy.
+ * The decoder can stop anywhere, even in the middle of a packet or block, and continue later.
+ */
+typedef struct {
+    const uint8_t * in;         /*The next byte to process*/
+    const uint8_t * in_end;
+    uint32_t blk_size;          /*Size of a block (e.g. a pixel) in bytes*/
+    uint32_t remain;            /*Bytes left to output from the current packet*/
+    const uint8_t * blk;        /*The repeated block of the current packet, NULL: the packet is a copy*/
+} lv_rle_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start decoding run-length encoded data
+ * @param rle       pointer to a decoder state to initialize
+ * @param in        the compressed data. It needs to stay available while decoding.
+ * @param in_size   size of the compressed data in bytes
+ * @param blk_size  size of a block in bytes, e.g. the size of a pixel
+ */
+void lv_rle_init(lv_rle_t * rle, const uint8_t * in, uint32_t in_size, uint32_t blk_size);
+
+/**
+ * Decompress the next bytes
+ * @param rle       pointer to an initialized decoder state
+ * @param out       store the decompressed bytes here. NULL: skip the bytes.
+ * @param out_size  number of bytes to decompress
+ * @return          number of decompressed bytes, less than `out_size` only if the data is over or invalid
+ */
+uint32_t lv_rle_decompress(lv_rle_t * rle, uint8_t * out, uint32_t out_size);
+
+/**
+ * Check whether all the data was decompressed
+ * @param rle       pointer to an initialized decoder state
+ * @return          true: no more packets and the last one is finished
+ */
+bool lv_rle_is_done(const lv_rle_t * rle);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_RLE_H*/
@@ -20,13 +20,41 @@
  *********************/
 #define NO_BREAK_FOUND UINT32_MAX
 
+/*Number of letters decoded and measured at once*/
+#define LETTER_RUN_LEN 16
+
+/*Decode 8 ASCII letters at once with a 64 bit load*/
+#if LV_TXT_ENC == LV_TXT_ENC_UTF8
+    #define TEXT_BLOCK_FAST 1
+#else
+    #define TEXT_BLOCK_FAST 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*Some decoded letters of a text with their widths*/
+typedef struct {
+    const char * txt;
+    const lv_font_t * font;
+    uint32_t end;                           /*Measure only the letters starting before this byte index*/
+    uint32_t cnt;                           /*Number of measured letters*/
+    uint32_t pos;                           /*Index of the last used letter*/
+    uint32_t letters[LETTER_RUN_LEN + 1];   /*The measured letters and the letter after them*/
+    uint32_t ofs[LETTER_RUN_LEN + 1];       /*Byte index of the letters and of the letter after them*/
+    uint16_t widths[LETTER_RUN_LEN];
+} letter_run_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if TEXT_BLOCK_FAST
+    static inline uint64_t text_block_load(const char * txt);
+#endif
+static void letter_run_init(letter_run_t * run, const char * txt, const lv_font_t * font, uint32_t end);
+static void letter_run_fill(letter_run_t * run, uint32_t byte_id);
+static bool letter_run_find(letter_run_t * run, uint32_t byte_id, uint32_t * idx);
 
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
     static uint8_t lv_text_utf8_size(const char * str);
@@ -102,11 +130,13 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
 
     uint32_t line_start     = 0;
     uint32_t new_line_start = 0;
+    uint32_t text_len       = lv_strlen(text);
     uint16_t letter_height = lv_font_get_line_height(font);
 
     /*Calc. the height and longest line*/
     while(text[line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+        new_line_start += _lv_text_get_next_line(&text[line_start], text_len - line_start, font, letter_space,
+                                                 max_width, NULL, flag);
 
         if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(lv_coord_t)) {
             LV_LOG_WARN("integer overflow while calculating text height");
@@ -167,16 +197,17 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
  * @param force Force return the fraction of the word that can fit in the provided space.
  * @return the index of the first char of the next word (in byte index not letter index. With UTF-8 they are different)
  */
-static uint32_t lv_text_get_next_word(const char * txt, const lv_font_t * font,
+static uint32_t lv_text_get_next_word(letter_run_t * run, uint32_t start,
                                       lv_coord_t letter_space, lv_coord_t max_width,
                                       lv_text_flag_t flag, uint32_t * word_w_ptr, bool force)
 {
-    if(txt == NULL || txt[0] == '\0') return 0;
-    if(font == NULL) return 0;
+    if(run->txt == NULL || run->font == NULL) return 0;
+    const char * txt = &run->txt[start];
+    if(txt[0] == '\0') return 0;
 
     if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
 
-    uint32_t i = 0, i_next = 0, i_next_next = 0;  /*Iterating index into txt*/
+    uint32_t i = 0, i_next = 0;  /*Iterating index into txt*/
     uint32_t letter = 0;      /*Letter at i*/
     uint32_t letter_next = 0; /*Letter at i_next*/
     lv_coord_t letter_w;
@@ -184,16 +215,16 @@ static uint32_t lv_text_get_next_word(const char * txt, const lv_font_t * font,
     uint32_t word_len = 0;   /*Number of characters in the transversed word*/
     uint32_t break_index = NO_BREAK_FOUND; /*only used for "long" words*/
     uint32_t break_letter_count = 0; /*Number of characters up to the long word break point*/
-
-    letter = _lv_text_encoded_next(txt, &i_next);
-    i_next_next = i_next;
+    uint32_t idx;
 
     /*Obtain the full word, regardless if it fits or not in max_width*/
-    while(txt[i] != '\0') {
-        letter_next = _lv_text_encoded_next(txt, &i_next_next);
+    while(txt[i] != '\0' && letter_run_find(run, start + i, &idx)) {
+        letter = run->letters[idx];
+        letter_next = run->letters[idx + 1];
+        i_next = run->ofs[idx + 1] - start;
         word_len++;
 
-        letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+        letter_w = run->widths[idx];
         cur_w += letter_w;
 
         if(letter_w > 0) {
@@ -226,8 +257,6 @@ static uint32_t lv_text_get_next_word(const char * txt, const lv_font_t * font,
         if(word_w_ptr != NULL && break_index == NO_BREAK_FOUND) *word_w_ptr = cur_w;
 
         i = i_next;
-        i_next = i_next_next;
-        letter = letter_next;
     }
 
     /*Entire Word fits in the provided space*/
@@ -271,7 +300,7 @@ static uint32_t lv_text_get_next_word(const char * txt, const lv_font_t * font,
 #endif
 }
 
-uint32_t _lv_text_get_next_line(const char * txt, const lv_font_t * font,
+uint32_t _lv_text_get_next_line(const char * txt, uint32_t len, const lv_font_t * font,
                                 lv_coord_t letter_space, lv_coord_t max_width,
                                 lv_coord_t * used_width, lv_text_flag_t flag)
 {
@@ -298,9 +327,13 @@ uint32_t _lv_text_get_next_line(const char * txt, const lv_font_t * font,
     if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
     uint32_t i = 0;                                        /*Iterating index into txt*/
 
+    /*Measure the letters in runs instead of one by one*/
+    letter_run_t run;
+    letter_run_init(&run, txt, font, len);
+
     while(txt[i] != '\0' && max_width > 0) {
         uint32_t word_w = 0;
-        uint32_t advance = lv_text_get_next_word(&txt[i], font, letter_space, max_width, flag, &word_w, i == 0);
+        uint32_t advance = lv_text_get_next_word(&run, i, letter_space, max_width, flag, &word_w, i == 0);
         max_width -= word_w;
         line_w += word_w;
 
@@ -344,16 +377,21 @@ lv_coord_t lv_text_get_width(const char * txt, uint32_t length, const lv_font_t
     lv_coord_t width             = 0;
 
     if(length != 0) {
+        letter_run_t run;
+        letter_run_init(&run, txt, font, length);
         while(i < length) {
-            uint32_t letter;
-            uint32_t letter_next;
-            _lv_text_encoded_letter_next_2(txt, &letter, &letter_next, &i);
-
-            lv_coord_t char_width = lv_font_get_glyph_width(font, letter, letter_next);
-            if(char_width > 0) {
-                width += char_width;
-                width += letter_space;
+            letter_run_fill(&run, i);
+            if(run.cnt == 0) break;
+
+            uint32_t k;
+            for(k = 0; k < run.cnt; k++) {
+                lv_coord_t char_width = run.widths[k];
+                if(char_width > 0) {
+                    width += char_width;
+                    width += letter_space;
+                }
             }
+            i = run.ofs[run.cnt];
         }
 
         if(width > 0) {
@@ -450,6 +488,124 @@ void _lv_text_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_
     *letter_next = *letter != '\0' ? _lv_text_encoded_next(&txt[*ofs], NULL) : 0;
 }
 
+uint32_t _lv_text_encoded_next_n(const char * txt, uint32_t * ofs, uint32_t end, uint32_t * letters,
+                                 uint32_t * letter_ofs, uint32_t max_cnt)
+{
+    uint32_t i = *ofs;
+    uint32_t cnt = 0;
+
+    while(cnt < max_cnt && i < end && txt[i] != '\0') {
+#if TEXT_BLOCK_FAST
+        /*Check 8 bytes at once and copy them if they are all ASCII and none of them is the terminating '\0'.
+         *Only if `end` is known, else the bytes after the '\0' might be outside of the text's buffer.*/
+        if(end != UINT32_MAX && end - i >= 8 && max_cnt - cnt >= 8) {
+            uint64_t block = text_block_load(&txt[i]);
+            /*No byte has its MSB set (not ASCII) and no byte is '\0'
+             *(subtracting 1 from a '\0' sets the MSB, but not from 1..127)*/
+            if(((block | (block - 0x0101010101010101ULL)) & 0x8080808080808080ULL) == 0) {
+                uint32_t k;
+                for(k = 0; k < 8; k++) {
+                    if(letter_ofs) letter_ofs[cnt] = i;
+                    letters[cnt] = (uint8_t)txt[i];
+                    cnt++;
+                    i++;
+                }
+                continue;
+            }
+        }
+#endif
+
+#if LV_TXT_ENC == LV_TXT_ENC_UTF8
+        if(letter_ofs) letter_ofs[cnt] = i;
+        if(LV_IS_ASCII(txt[i])) {
+            letters[cnt] = (uint8_t)txt[i];
+            i++;
+        }
+        else {
+            letters[cnt] = lv_text_utf8_next(txt, &i);
+        }
+#else
+        if(letter_ofs) letter_ofs[cnt] = i;
+        letters[cnt] = _lv_text_encoded_next(txt, &i);
+#endif
+        cnt++;
+    }
+
+    *ofs = i;
+    return cnt;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if TEXT_BLOCK_FAST
+/**
+ * Load 8 bytes of a text
+ * @param txt       pointer to a text with at least 8 readable bytes
+ * @return          the bytes in the native byte order
+ */
+static inline uint64_t text_block_load(const char * txt)
+{
+    uint64_t block;
+    lv_memcpy_small(&block, txt, sizeof(block));
+    return block;
+}
+#endif
+
+static void letter_run_init(letter_run_t * run, const char * txt, const lv_font_t * font, uint32_t end)
+{
+    run->txt = txt;
+    run->font = font;
+    run->end = end;
+    run->cnt = 0;
+    run->pos = 0;
+}
+
+/**
+ * Decode and measure the letters from a byte index
+ * @param run       pointer to a letter run
+ * @param byte_id   byte index of the first letter to measure
+ */
+static void letter_run_fill(letter_run_t * run, uint32_t byte_id)
+{
+    uint32_t i = byte_id;
+    run->cnt = _lv_text_encoded_next_n(run->txt, &i, run->end, run->letters, run->ofs, LETTER_RUN_LEN);
+    run->pos = 0;
+    if(run->cnt == 0) return;
+
+    /*The letter after the run is needed only for kerning*/
+    run->ofs[run->cnt] = i;
+    run->letters[run->cnt] = _lv_text_encoded_next(&run->txt[i], NULL);
+    lv_font_get_glyph_widths(run->font, run->letters, run->cnt, run->widths);
+}
+
+/**
+ * Find a measured letter by its byte index and measure the next letters if it's not measured yet
+ * @param run       pointer to a letter run
+ * @param byte_id   byte index of a letter
+ * @param idx       store the letter's index in the run here
+ * @return          false: there is no letter at `byte_id`
+ */
+static bool letter_run_find(letter_run_t * run, uint32_t byte_id, uint32_t * idx)
+{
+    /*The letters are usually needed one after the other*/
+    uint32_t p = run->pos;
+    if(p + 1 < run->cnt && run->ofs[p + 1] == byte_id) p++;
+    else if(p >= run->cnt || run->ofs[p] != byte_id) {
+        for(p = 0; p < run->cnt && run->ofs[p] != byte_id; p++) {}
+        if(p == run->cnt) {
+            letter_run_fill(run, byte_id);
+            if(run->cnt == 0) return false;
+            p = 0;
+        }
+    }
+
+    run->pos = p;
+    *idx = p;
+    return true;
+}
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
 /*******************************
  *   UTF-8 ENCODER/DECODER
@@ -88,6 +88,8 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
 /**
  * Get the next line of text. Check line length and break chars too.
  * @param txt a '\0' terminated string
+ * @param len length of `txt` in bytes or `UINT32_MAX` if not known.
+ *            With the length the ASCII characters can be processed 8 bytes at a time.
  * @param font pointer to a font
  * @param letter_space letter space
  * @param max_width max width of the text (break the lines to fit this size). Set COORD_MAX to avoid
@@ -98,7 +100,7 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
  * @return the index of the first char of the new line (in byte index not letter index. With UTF-8
  * they are different)
  */
-uint32_t _lv_text_get_next_line(const char * txt, const lv_font_t * font, lv_coord_t letter_space,
+uint32_t _lv_text_get_next_line(const char * txt, uint32_t len, const lv_font_t * font, lv_coord_t letter_space,
                                 lv_coord_t max_width, lv_coord_t * used_width, lv_text_flag_t flag);
 
 /**
@@ -149,6 +151,23 @@ char * _lv_text_set_text_vfmt(const char * fmt, va_list ap) LV_FORMAT_ATTRIBUTE(
  */
 void _lv_text_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t * letter_next, uint32_t * ofs);
 
+/**
+ * Decode more encoded characters from a string at once.
+ * It's much faster than calling `_lv_text_encoded_next` for each letter, especially on ASCII texts.
+ * @param txt pointer to '\0' terminated string
+ * @param ofs start index in 'txt' where to start.
+ *                After the call it will point to the first not decoded character in 'txt'.
+ * @param end decode only the characters starting before this byte index. `UINT32_MAX` to decode until the '\0'.
+ *                If the end is known (it must be within the text's buffer), ASCII characters are
+ *                processed 8 bytes at a time while at least 8 bytes are left before it.
+ * @param letters store the decoded Unicode characters here
+ * @param letter_ofs store the byte index of each decoded character here. Can be NULL.
+ * @param max_cnt max number of characters to decode
+ * @return the number of decoded characters. Less than `max_cnt` only at `end` or at the closing '\0'
+ */
+uint32_t _lv_text_encoded_next_n(const char * txt, uint32_t * ofs, uint32_t end, uint32_t * letters,
+                                 uint32_t * letter_ofs, uint32_t max_cnt);
+
 /**
  * Test if char is break char or not (a text can broken here or not)
  * @param letter a letter
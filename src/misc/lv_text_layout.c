@@ -0,0 +1,235 @@
+/**
+ * @file lv_text_layout.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_text_layout.h"
+#include "lv_math.h"
+#include "lv_log.h"
+#include "lv_assert.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ADVANCE_RUN_LEN 32
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool grow(lv_text_layout_t * layout);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_text_layout_init(lv_text_layout_t * layout)
+{
+    lv_memzero(layout, sizeof(lv_text_layout_t));
+    layout->lines = layout->_lines_buf;
+    layout->line_cap = LV_TEXT_LAYOUT_INLINE_LINES;
+}
+
+void lv_text_layout_free(lv_text_layout_t * layout)
+{
+    if(layout->lines != layout->_lines_buf) lv_free(layout->lines);
+    lv_free(layout->advances);
+    lv_text_layout_init(layout);
+}
+
+void lv_text_layout_invalidate(lv_text_layout_t * layout)
+{
+    layout->valid = 0;
+}
+
+bool lv_text_layout_update(lv_text_layout_t * layout, const char * text, const lv_font_t * font,
+                           lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(lv_text_layout_is_valid_for(layout, text, font, letter_space, line_space, max_width, flag)) return true;
+
+    layout->valid = 0;
+    layout->line_cnt = 0;
+    lv_free(layout->advances);
+    layout->advances = NULL;
+    layout->size.x = 0;
+    layout->size.y = 0;
+
+    if(text == NULL) return false;
+    if(font == NULL) return false;
+
+    /*The same as `lv_text_get_size` but save the lines too*/
+    if((flag & LV_TEXT_FLAG_EXPAND) || (flag & LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    uint32_t line_start = 0;
+    uint32_t text_len = lv_strlen(text);
+    uint16_t letter_height = lv_font_get_line_height(font);
+    bool overflow = false;
+    while(text[line_start] != '\0') {
+        if(layout->line_cnt == layout->line_cap && !grow(layout)) return false;
+
+        uint32_t line_end = line_start + _lv_text_get_next_line(&text[line_start], text_len - line_start, font,
+                                                                letter_space, max_width, NULL, flag);
+
+        if((unsigned long)layout->size.y + (unsigned long)letter_height + (unsigned long)line_space >
+           LV_MAX_OF(lv_coord_t)) {
+            if(!overflow) LV_LOG_WARN("integer overflow while calculating text height");
+            overflow = true;
+        }
+        else if(!overflow) {
+            layout->size.y += letter_height + line_space;
+        }
+
+        lv_coord_t line_w = lv_text_get_width(&text[line_start], line_end - line_start, font, letter_space);
+        layout->lines[layout->line_cnt].start = line_start;
+        layout->lines[layout->line_cnt].width = line_w;
+        layout->line_cnt++;
+
+        layout->size.x = LV_MAX(line_w, layout->size.x);
+        line_start = line_end;
+    }
+    layout->lines[layout->line_cnt].start = line_start;
+    layout->lines[layout->line_cnt].width = 0;
+
+    if(!overflow) {
+        /*Make the text one line taller if the last character is '\n' or '\r'*/
+        if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
+            layout->size.y += letter_height + line_space;
+        }
+
+        /*Correction with the last line space or set the height manually if the text is empty*/
+        if(layout->size.y == 0) layout->size.y = letter_height;
+        else layout->size.y -= line_space;
+    }
+
+    layout->text = text;
+    layout->font = font;
+    layout->letter_space = letter_space;
+    layout->line_space = line_space;
+    layout->max_width = max_width;
+    layout->flag = flag;
+    layout->valid = 1;
+
+    return true;
+}
+
+bool lv_text_layout_is_valid_for(const lv_text_layout_t * layout, const char * text, const lv_font_t * font,
+                                 lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width,
+                                 lv_text_flag_t flag)
+{
+    if(layout == NULL || !layout->valid) return false;
+
+    /*The lines are broken only at the new line characters in these cases*/
+    if((flag & LV_TEXT_FLAG_EXPAND) || (flag & LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    return layout->text == text && layout->font == font && layout->letter_space == letter_space &&
+           layout->line_space == line_space && layout->max_width == max_width && layout->flag == flag;
+}
+
+uint32_t lv_text_layout_get_line_of_byte(const lv_text_layout_t * layout, uint32_t byte_id)
+{
+    if(layout->line_cnt == 0) return 0;
+
+    /*Find the last line starting before `byte_id`*/
+    uint32_t min = 0;
+    uint32_t max = layout->line_cnt - 1;
+    while(min < max) {
+        uint32_t mid = (min + max + 1) / 2;
+        if(layout->lines[mid].start <= byte_id) min = mid;
+        else max = mid - 1;
+    }
+
+    return min;
+}
+
+const uint16_t * lv_text_layout_get_advances(lv_text_layout_t * layout)
+{
+    if(!layout->valid) return NULL;
+    if(layout->advances) return layout->advances;
+
+    const char * text = layout->text;
+    uint32_t text_len = layout->lines[layout->line_cnt].start;
+    uint16_t * advances = lv_malloc((text_len + 1) * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(advances);
+    if(advances == NULL) return NULL;
+    lv_memzero(advances, (text_len + 1) * sizeof(uint16_t));
+
+    /*Measure the glyphs in runs. The last letter of a run is kerned with the first one of the next run.*/
+    uint32_t letters[ADVANCE_RUN_LEN + 1];
+    uint32_t letter_ofs[ADVANCE_RUN_LEN];
+    uint16_t widths[ADVANCE_RUN_LEN];
+    uint32_t i = 0;
+    while(i < text_len) {
+        uint32_t cnt = _lv_text_encoded_next_n(text, &i, text_len, letters, letter_ofs, ADVANCE_RUN_LEN);
+        if(cnt == 0) break;
+        letters[cnt] = _lv_text_encoded_next(&text[i], NULL);
+        lv_font_get_glyph_widths(layout->font, letters, cnt, widths);
+
+        uint32_t k;
+        for(k = 0; k < cnt; k++) advances[letter_ofs[k]] = widths[k];
+    }
+
+    layout->advances = advances;
+    return advances;
+}
+
+lv_coord_t lv_text_layout_get_width(const lv_text_layout_t * layout, const uint16_t * advances, uint32_t start,
+                                    uint32_t length)
+{
+    /*Zero width letters (and the inner bytes of the letters) get no letter space, like in `lv_text_get_width`*/
+    int32_t width = 0;
+    uint32_t end = start + length;
+    uint32_t i;
+    for(i = start; i < end; i++) {
+        if(advances[i] > 0) width += advances[i] + layout->letter_space;
+    }
+
+    if(width > 0) width -= layout->letter_space;
+
+    return (lv_coord_t)width;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Double the number of lines the layout can store
+ * @return      false: out of memory
+ */
+static bool grow(lv_text_layout_t * layout)
+{
+    uint32_t new_cap = layout->line_cap < 8 ? 8 : layout->line_cap * 2;
+    size_t new_size = (new_cap + 1) * sizeof(lv_text_layout_line_t);
+
+    lv_text_layout_line_t * lines;
+    if(layout->lines == layout->_lines_buf) {
+        lines = lv_malloc(new_size);
+        if(lines) lv_memcpy(lines, layout->_lines_buf, layout->line_cnt * sizeof(lv_text_layout_line_t));
+    }
+    else {
+        lines = lv_realloc(layout->lines, new_size);
+    }
+    LV_ASSERT_MALLOC(lines);
+    if(lines == NULL) return false;
+
+    layout->lines = lines;
+    layout->line_cap = new_cap;
+
+    return true;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file lv_text_layout.h
+ *
+ */
+
+#ifndef LV_TEXT_LAYOUT_H
+#define LV_TEXT_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_text.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_TEXT_LAYOUT_INLINE_LINES 2
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t start;                 /**< Byte index of the line's first letter*/
+    lv_coord_t width;               /**< Width of the line*/
+} lv_text_layout_line_t;
+
+/**
+ * The line breaks and line widths of a text.
+ * Calculating them requires measuring every glyph of the text, so it's done only once for the same
+ * text and settings and shared by the size calculation, the drawing and the cursor position queries.
+ * As the text is identified by its pointer, the layout needs to be invalidated if the text is changed in place.
+ */
+typedef struct {
+    const char * text;              /**< The text the layout was calculated for*/
+    const lv_font_t * font;
+    lv_coord_t letter_space;
+    lv_coord_t line_space;
+    lv_coord_t max_width;           /**< `LV_COORD_MAX` if the width doesn't matter (expand or fit flag)*/
+    lv_text_flag_t flag;
+
+    lv_point_t size;                /**< Size of the text, the same as `lv_text_get_size` returns*/
+    uint32_t line_cnt;              /**< Number of lines, 0 for empty texts*/
+    lv_text_layout_line_t * lines;  /**< `line_cnt + 1` items, the last one starts at the end of the text*/
+    uint32_t line_cap;              /**< `lines` has space for this many lines (and the closing item)*/
+    uint16_t * advances;            /**< Width of the letters at their first byte's index or NULL if not needed yet.
+                                     *   See `lv_text_layout_get_advances`*/
+    uint32_t valid : 1;
+
+    /*Store the layout of short texts without allocating memory*/
+    lv_text_layout_line_t _lines_buf[LV_TEXT_LAYOUT_INLINE_LINES + 1];
+} lv_text_layout_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a text layout
+ * @param layout        pointer to a text layout
+ */
+void lv_text_layout_init(lv_text_layout_t * layout);
+
+/**
+ * Free the memory allocated by a text layout
+ * @param layout        pointer to a text layout
+ */
+void lv_text_layout_free(lv_text_layout_t * layout);
+
+/**
+ * Mark a layout as outdated, e.g. because its text was modified in place.
+ * The memory allocated for the lines is kept to be reused by the next update.
+ * @param layout        pointer to a text layout
+ */
+void lv_text_layout_invalidate(lv_text_layout_t * layout);
+
+/**
+ * Calculate the layout of a text if it has no valid layout with the same settings yet.
+ * The parameters are the same as `lv_text_get_size`'s.
+ * @param layout        pointer to a text layout
+ * @param text          pointer to a text
+ * @param font          pointer to font of the text
+ * @param letter_space  letter space of the text
+ * @param line_space    line space of the text
+ * @param max_width     max width of the text (break the lines to fit this size)
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              true: the layout is valid; false: out of memory
+ */
+bool lv_text_layout_update(lv_text_layout_t * layout, const char * text, const lv_font_t * font,
+                           lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Check if a layout was calculated for a text with the given settings
+ * @param layout        pointer to a text layout
+ * @param text          pointer to a text
+ * @param font          pointer to font of the text
+ * @param letter_space  letter space of the text
+ * @param line_space    line space of the text
+ * @param max_width     max width of the text
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              true: the layout's lines and size can be used for the text
+ */
+bool lv_text_layout_is_valid_for(const lv_text_layout_t * layout, const char * text, const lv_font_t * font,
+                                 lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_width,
+                                 lv_text_flag_t flag);
+
+/**
+ * Get the line a byte of the text belongs to
+ * @param layout        pointer to a valid text layout
+ * @param byte_id       byte index in the text
+ * @return              index of the line, `line_cnt - 1` for the end of the text
+ */
+uint32_t lv_text_layout_get_line_of_byte(const lv_text_layout_t * layout, uint32_t byte_id);
+
+/**
+ * Get the width of each letter of the text (kerning included) to let the cursor position queries
+ * work without measuring the glyphs again. They are calculated on the first call and kept until
+ * the layout is recalculated.
+ * @param layout        pointer to a valid text layout
+ * @return              an array with the width of each letter at the index of its first byte
+ *                      (0 for the other bytes of a letter) or NULL if out of memory
+ */
+const uint16_t * lv_text_layout_get_advances(lv_text_layout_t * layout);
+
+/**
+ * Get the width of a part of the text from its advances. Same as `lv_text_get_width`.
+ * @param layout        pointer to a valid text layout
+ * @param advances      the advances returned by `lv_text_layout_get_advances`
+ * @param start         byte index of the first letter
+ * @param length        length of the text part in bytes
+ * @return              width of the text part
+ */
+lv_coord_t lv_text_layout_get_width(const lv_text_layout_t * layout, const uint16_t * advances, uint32_t start,
+                                    uint32_t length);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEXT_LAYOUT_H*/
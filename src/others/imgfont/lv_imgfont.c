@@ -76,6 +76,8 @@ void lv_imgfont_destroy(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
 
+    lv_font_invalidate(font);
+
     imgfont_dsc_t * dsc = (imgfont_dsc_t *)font->dsc;
     lv_free(dsc);
 }
@@ -54,6 +54,10 @@ static void sysmon_async_cb(void * user_data);
     static void mem_monitor_init(void);
 #endif
 
+#if LV_USE_CACHE_MONITOR
+    static void cache_monitor_init(void);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -259,6 +263,32 @@ static void mem_monitor_init(void)
 }
 #endif
 
+#if LV_USE_CACHE_MONITOR
+static void cache_monitor_event_cb(lv_event_t * e)
+{
+    lv_obj_t * sysmon = lv_event_get_current_target_obj(e);
+    lv_cache_stats_t stats;
+    lv_cache_lock();
+    lv_cache_get_stats(&stats);
+    lv_cache_unlock();
+
+    uint32_t find_cnt = stats.hit_cnt + stats.miss_cnt;
+    uint32_t hit_pct = find_cnt ? (uint32_t)(((uint64_t)stats.hit_cnt * 100) / find_cnt) : 0;
+    lv_label_set_text_fmt(sysmon,
+                          "%"LV_PRIu32" img, %"LV_PRIu32"/%"LV_PRIu32" kB\n"
+                          "%"LV_PRIu32"%% hit, %"LV_PRIu32" evict, %"LV_PRIu32" tmp",
+                          stats.entry_cnt, (uint32_t)(stats.cur_size / 1024), (uint32_t)(stats.max_size / 1024),
+                          hit_pct, stats.evict_cnt, stats.temporary_cnt);
+}
+
+static void cache_monitor_init(void)
+{
+    lv_obj_t * sysmon = lv_sysmon_create(lv_layer_sys());
+    lv_obj_add_event(sysmon, cache_monitor_event_cb, LV_EVENT_REFRESH, NULL);
+    lv_obj_align(sysmon, LV_USE_CACHE_MONITOR_POS, 0, 0);
+}
+#endif
+
 static void sysmon_async_cb(void * user_data)
 {
     LV_UNUSED(user_data);
@@ -268,6 +298,9 @@ static void sysmon_async_cb(void * user_data)
 #if LV_USE_MEM_MONITOR && LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
     mem_monitor_init();
 #endif
+#if LV_USE_CACHE_MONITOR
+    cache_monitor_init();
+#endif
 }
 
 #endif /*LV_USE_SYSMON*/
@@ -70,7 +70,7 @@ void _lv_sysmon_builtin_deinit(void);
 
 #else
 
-#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR || LV_USE_CACHE_MONITOR
 #warning "lv_sysmon: lv_sysmon is required. Enable it in lv_conf.h (LV_USE_SYSMON  1)"
 #endif
 
@@ -58,6 +58,24 @@ static inline void lv_memzero(void * dst, size_t len)
     lv_memset(dst, 0x00, len);
 }
 
+/**
+ * Copy a few bytes, e.g. to load a value from an unaligned address without breaking the aliasing rules.
+ * Unlike `lv_memcpy` it's inlined, and with a constant `len` it's usually compiled to a single load and store.
+ * @param dst pointer to the destination buffer
+ * @param src pointer to the source buffer
+ * @param len number of bytes to copy
+ */
+static inline void lv_memcpy_small(void * dst, const void * src, size_t len)
+{
+#if defined(__GNUC__)
+    __builtin_memcpy(dst, src, len);
+#else
+    uint8_t * d = dst;
+    const uint8_t * s = src;
+    while(len--) *d++ = *s++;
+#endif
+}
+
 /**
  * @brief Computes the length of the string str up to, but not including the terminating null character.
  * @param str Pointer to the null-terminated byte string to be examined.
@@ -133,6 +133,11 @@ void lv_canvas_set_px(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_color_t col
         buf->blue = color.blue;
         buf->alpha = opa;
     }
+    else if(canvas->dsc.header.cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) {
+        lv_color32_t * buf = (lv_color32_t *)canvas->dsc.data;
+        buf += canvas->dsc.header.w * y + x;
+        *buf = lv_color32_premultiply(lv_color_to_32(color, opa));
+    }
     lv_obj_invalidate(obj);
 }
 
@@ -166,6 +171,9 @@ lv_color32_t lv_canvas_get_px(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
             ret.blue = px[2];
             ret.alpha = px[3];
             break;
+        case LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED:
+            ret = lv_color32_unpremultiply(*(const lv_color32_t *)px);
+            break;
         case LV_COLOR_FORMAT_RGB888:
         case LV_COLOR_FORMAT_XRGB8888:
             ret.red = px[0];
@@ -263,6 +271,15 @@ void lv_canvas_fill_bg(lv_obj_t * obj, lv_color_t color, lv_opa_t opa)
             }
         }
     }
+    else if(dsc->header.cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) {
+        lv_color32_t c32 = lv_color32_premultiply(lv_color_to_32(color, opa));
+        for(y = 0; y < dsc->header.h; y++) {
+            lv_color32_t * buf32 = (lv_color32_t *)(dsc->data + y * dsc->header.w * 4);
+            for(x = 0; x < dsc->header.w; x++) {
+                buf32[x] = c32;
+            }
+        }
+    }
     else if(dsc->header.cf == LV_COLOR_FORMAT_RGB888) {
         for(y = 0; y < dsc->header.h; y++) {
             uint8_t * buf8 = (uint8_t *)(dsc->data + y * dsc->header.w * 3);
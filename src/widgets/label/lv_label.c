@@ -53,8 +53,11 @@ static void set_ofs_y_anim(void * obj, int32_t v);
 static size_t get_text_length(const char * text);
 static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
-static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align, const char * txt,
-                                   uint32_t length, const lv_font_t * font, lv_coord_t letter_space, lv_area_t * txt_coords);
+static lv_text_layout_t * get_text_layout(const lv_obj_t * obj);
+static void get_text_size_unlimited(const lv_label_t * label, const lv_draw_label_dsc_t * dsc, lv_point_t * size);
+static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align, lv_coord_t line_w,
+                                   lv_area_t * txt_coords);
+static bool is_same_text(const char * txt1, const char * txt2, uint32_t length);
 
 /**********************
  *  STATIC VARIABLES
@@ -276,7 +279,6 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(pos);
 
-    lv_label_t * label = (lv_label_t *)obj;
     const char * txt = lv_label_get_text(obj);
     const lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, txt);
 
@@ -298,11 +300,14 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
         return;
     }
 
-    lv_text_flag_t flag = get_label_flags(label);
-    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+    lv_text_layout_t * layout = get_text_layout(obj);
+    if(layout == NULL) {
+        pos->x = 0;
+        pos->y = 0;
+        return;
+    }
 
     const uint32_t byte_id = _lv_text_encoded_get_byte_id(txt, char_id);
-    /*Search the line of the index letter*/
     const lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     const lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
 
@@ -311,25 +316,20 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
-    const lv_coord_t max_w = lv_area_get_width(&txt_coords);
-
-    lv_coord_t y = 0;
-    uint32_t line_start = 0;
-    uint32_t new_line_start = 0;
-    while(txt[new_line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
-    }
+    /*Search the line of the index letter*/
+    const uint32_t line = lv_text_layout_get_line_of_byte(layout, byte_id);
+    lv_coord_t y = (lv_coord_t)line * (letter_height + line_space);
+    uint32_t line_start = layout->lines[line].start;
+    uint32_t new_line_start = layout->lines[line + 1].start;
+    lv_coord_t line_w = layout->lines[line].width;
 
     /*If the last character is line break then go to the next line*/
     if(byte_id > 0) {
         if((txt[byte_id - 1] == '\n' || txt[byte_id - 1] == '\r') && txt[byte_id] == '\0') {
             y += letter_height + line_space;
             line_start = byte_id;
+            line_w = 0;
         }
     }
 
@@ -361,12 +361,22 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     visual_byte_pos = byte_id - line_start;
 #endif
 
-    /*Calculate the x coordinate*/
-    lv_coord_t x = lv_text_get_width(bidi_txt, visual_byte_pos, font, letter_space);
+    /*Calculate the x coordinate. Use the letter widths of the layout if the letters weren't reordered.*/
+    uint32_t length = new_line_start - line_start;
+    const uint16_t * advances = NULL;
+    if(is_same_text(bidi_txt, &txt[line_start], length)) advances = lv_text_layout_get_advances(layout);
+
+    lv_coord_t x;
+    if(advances) {
+        x = lv_text_layout_get_width(layout, advances, line_start, visual_byte_pos);
+    }
+    else {
+        x = lv_text_get_width(bidi_txt, visual_byte_pos, font, letter_space);
+        line_w = lv_text_get_width(bidi_txt, length, font, letter_space);
+    }
     if(char_id != line_start) x += letter_space;
 
-    uint32_t length = new_line_start - line_start;
-    calculate_x_coordinate(&x, align, bidi_txt, length, font, letter_space, &txt_coords);
+    calculate_x_coordinate(&x, align, line_w, &txt_coords);
     pos->x = x;
     pos->y = y;
 
@@ -388,34 +398,33 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
     const char * txt         = lv_label_get_text(obj);
-    uint32_t line_start      = 0;
-    uint32_t new_line_start  = 0;
-    lv_coord_t max_w         = lv_area_get_width(&txt_coords);
     const lv_font_t * font   = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
     const lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     const lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
     const lv_coord_t letter_height = lv_font_get_line_height(font);
     lv_coord_t y = 0;
 
-    lv_text_flag_t flag = get_label_flags(label);
-    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+    lv_text_layout_t * layout = get_text_layout(obj);
+    if(layout == NULL) return 0;
 
-    /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
-            /*Include the NULL terminator in the last line*/
-            uint32_t tmp = new_line_start;
-            uint32_t letter;
-            letter = _lv_text_encoded_prev(txt, &tmp);
-            if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
-        }
+    /*Search the line of the index letter*/
+    uint32_t line = 0;
+    while(line < layout->line_cnt) {
+        if(pos.y <= y + letter_height) break; /*The line is found*/
         y += letter_height + line_space;
+        line++;
+    }
+
+    uint32_t line_start      = layout->lines[line].start;
+    uint32_t new_line_start  = line_start;
+    if(line < layout->line_cnt) {
+        new_line_start = layout->lines[line + 1].start;
 
-        line_start = new_line_start;
+        /*Include the NULL terminator in the last line*/
+        uint32_t tmp = new_line_start;
+        uint32_t letter;
+        letter = _lv_text_encoded_prev(txt, &tmp);
+        if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
     }
 
     char * bidi_txt;
@@ -429,24 +438,37 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     bidi_txt = (char *)txt + line_start;
 #endif
 
+    /*Use the letter widths of the layout if the letters weren't reordered*/
+    uint32_t length = new_line_start - line_start;
+    const uint16_t * advances = NULL;
+    if(is_same_text(bidi_txt, &txt[line_start], length)) advances = lv_text_layout_get_advances(layout);
+
     /*Calculate the x coordinate*/
     lv_coord_t x = 0;
     const lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
-    uint32_t length = new_line_start - line_start;
-    calculate_x_coordinate(&x, align, bidi_txt, length, font, letter_space, &txt_coords);
+    lv_coord_t line_w;
+    if(advances) line_w = lv_text_layout_get_width(layout, advances, line_start, length);
+    else line_w = lv_text_get_width(bidi_txt, length, font, letter_space);
+    calculate_x_coordinate(&x, align, line_w, &txt_coords);
 
     uint32_t i = 0;
     uint32_t i_act = i;
 
     if(new_line_start > 0) {
         while(i + line_start < new_line_start) {
-            /*Get the current letter and the next letter for kerning*/
-            /*Be careful 'i' already points to the next character*/
-            uint32_t letter;
-            uint32_t letter_next;
-            _lv_text_encoded_letter_next_2(bidi_txt, &letter, &letter_next, &i);
-
-            lv_coord_t gw = lv_font_get_glyph_width(font, letter, letter_next);
+            lv_coord_t gw;
+            if(advances) {
+                gw = advances[line_start + i];
+                _lv_text_encoded_next(bidi_txt, &i);
+            }
+            else {
+                /*Get the current letter and the next letter for kerning*/
+                /*Be careful 'i' already points to the next character*/
+                uint32_t letter;
+                uint32_t letter_next;
+                _lv_text_encoded_letter_next_2(bidi_txt, &letter, &letter_next, &i);
+                gw = lv_font_get_glyph_width(font, letter, letter_next);
+            }
 
             /*Finish if the x position or the last char of the next line is reached*/
             if(pos.x < x + gw || i + line_start == new_line_start ||  txt[i_act + line_start] == '\0') {
@@ -489,55 +511,61 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
     lv_obj_get_content_coords(obj, &txt_coords);
     const char * txt         = lv_label_get_text(obj);
     lv_label_t * label     = (lv_label_t *)obj;
-    uint32_t line_start      = 0;
-    uint32_t new_line_start  = 0;
-    const lv_coord_t max_w         = lv_area_get_width(&txt_coords);
     const lv_font_t * font   = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
     const lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     const lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
     const lv_coord_t letter_height    = lv_font_get_line_height(font);
 
-    lv_text_flag_t flag = get_label_flags(label);
-    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+    lv_text_layout_t * layout = get_text_layout(obj);
+    if(layout == NULL) return false;
+    const uint16_t * advances = lv_text_layout_get_advances(layout);
 
     /*Search the line of the index letter*/
     lv_coord_t y = 0;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+    uint32_t line = 0;
+    while(line < layout->line_cnt) {
+        if(pos->y <= y + letter_height) break; /*The line is found*/
         y += letter_height + line_space;
-
-        line_start = new_line_start;
+        line++;
     }
 
+    uint32_t line_start      = layout->lines[line].start;
+    uint32_t new_line_start  = line < layout->line_cnt ? layout->lines[line + 1].start : line_start;
+    const lv_coord_t line_w  = layout->lines[line].width;
+
     /*Calculate the x coordinate*/
     const lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
 
     lv_coord_t x = 0;
     if(align == LV_TEXT_ALIGN_CENTER) {
-        const lv_coord_t line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
         x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
     }
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        const lv_coord_t line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
         x += lv_area_get_width(&txt_coords) - line_w;
     }
 
     lv_coord_t last_x = 0;
+    lv_coord_t letter_w  = 0;
     uint32_t i           = line_start;
     uint32_t i_current   = i;
-    uint32_t letter      = '\0';
-    uint32_t letter_next = '\0';
 
     if(new_line_start > 0) {
         while(i <= new_line_start - 1) {
-            /*Get the current letter and the next letter for kerning*/
-            /*Be careful 'i' already points to the next character*/
-            _lv_text_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+            if(advances) {
+                letter_w = advances[i];
+                _lv_text_encoded_next(txt, &i);
+            }
+            else {
+                /*Get the current letter and the next letter for kerning*/
+                /*Be careful 'i' already points to the next character*/
+                uint32_t letter;
+                uint32_t letter_next;
+                _lv_text_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+                letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+            }
 
             last_x = x;
-            x += lv_font_get_glyph_width(font, letter, letter_next);
+            x += letter_w;
             if(pos->x < x) {
                 i = i_current;
                 break;
@@ -547,7 +575,7 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
         }
     }
 
-    const int32_t max_diff = lv_font_get_glyph_width(font, letter, letter_next) + letter_space + 1;
+    const int32_t max_diff = letter_w + letter_space + 1;
     return (pos->x >= (last_x - letter_space) && pos->x <= (last_x + max_diff));
 }
 
@@ -658,6 +686,7 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 #endif
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
+    label->layout = NULL;
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
@@ -674,6 +703,11 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+    if(label->layout) {
+        lv_text_layout_free(label->layout);
+        lv_free(label->layout);
+        label->layout = NULL;
+    }
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -715,7 +749,13 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
             if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
             else w = lv_obj_get_content_width(obj);
 
-            lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            /*Use the layout's size if the text is wrapped the same way*/
+            if(lv_text_layout_is_valid_for(label->layout, label->text, font, letter_space, line_space, w, flag)) {
+                label->size_cache = label->layout->size;
+            }
+            else {
+                lv_text_get_size(&label->size_cache, label->text, font, letter_space, line_space, w, flag);
+            }
             label->invalid_size_cache = false;
         }
 
@@ -755,6 +795,7 @@ static void draw_main(lv_event_t * e)
 #endif
 
     label_draw_dsc.flag = flag;
+    label_draw_dsc.layout = get_text_layout(obj);
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
@@ -770,8 +811,7 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size_unlimited(label, &label_draw_dsc, &size);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -803,8 +843,7 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size_unlimited(label, &label_draw_dsc, &size);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -864,6 +903,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
     label->invalid_size_cache = true;
+    if(label->layout) lv_text_layout_invalidate(label->layout); /*The text might have been changed in place*/
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
@@ -872,6 +912,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
     lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
 
+    /*Let the fonts loading the glyphs on demand read them now instead of while drawing*/
+    lv_font_prefetch(font, label->text);
+
     /*Calc. the height and longest line*/
     lv_point_t size;
     lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
@@ -879,7 +922,14 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    /*Update the layout only if it's used already, else just measure the text*/
+    if(label->layout &&
+       lv_text_layout_update(label->layout, label->text, font, letter_space, line_space, max_w, flag)) {
+        size = label->layout->size;
+    }
+    else {
+        lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    }
 
     lv_obj_refresh_self_size(obj);
 
@@ -1131,6 +1181,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+                if(label->layout) lv_text_layout_invalidate(label->layout);
             }
         }
     }
@@ -1164,6 +1215,7 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+    if(label->layout) lv_text_layout_invalidate(label->layout);
 }
 
 /**
@@ -1275,16 +1327,64 @@ static lv_text_flag_t get_label_flags(lv_label_t * label)
     return flag;
 }
 
+/**
+ * Get the layout of the label's text with the current size and styles. Calculate it only if it's outdated.
+ * @param obj   pointer to a label object
+ * @return      the layout or NULL if it couldn't be calculated
+ */
+static lv_text_layout_t * get_text_layout(const lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(label->layout == NULL) {
+        label->layout = lv_malloc(sizeof(lv_text_layout_t));
+        LV_ASSERT_MALLOC(label->layout);
+        if(label->layout == NULL) return NULL;
+        lv_text_layout_init(label->layout);
+    }
+
+    lv_area_t txt_coords;
+    lv_obj_get_content_coords(obj, &txt_coords);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    const lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    const lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+
+    lv_text_flag_t flag = get_label_flags(label);
+    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+
+    if(!lv_text_layout_update(label->layout, label->text, font, letter_space, line_space,
+                              lv_area_get_width(&txt_coords), flag)) {
+        return NULL;
+    }
+
+    return label->layout;
+}
+
+/**
+ * Get the size of the label's text without wrapping the lines
+ * @param label     pointer to a label object
+ * @param dsc       the label's draw descriptor
+ * @param size      store the size here
+ */
+static void get_text_size_unlimited(const lv_label_t * label, const lv_draw_label_dsc_t * dsc, lv_point_t * size)
+{
+    if(lv_text_layout_is_valid_for(dsc->layout, label->text, dsc->font, dsc->letter_space, dsc->line_space,
+                                   LV_COORD_MAX, dsc->flag)) {
+        *size = dsc->layout->size;
+    }
+    else {
+        lv_text_get_size(size, label->text, dsc->font, dsc->letter_space, dsc->line_space, LV_COORD_MAX, dsc->flag);
+    }
+}
+
 /* Function created because of this pattern be used in multiple functions */
-static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align, const char * txt, uint32_t length,
-                                   const lv_font_t * font, lv_coord_t letter_space, lv_area_t * txt_coords)
+static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align, lv_coord_t line_w,
+                                   lv_area_t * txt_coords)
 {
     if(align == LV_TEXT_ALIGN_CENTER) {
-        const lv_coord_t line_w = lv_text_get_width(txt, length, font, letter_space);
         *x += lv_area_get_width(txt_coords) / 2 - line_w / 2;
     }
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        const lv_coord_t line_w = lv_text_get_width(txt, length, font, letter_space);
         *x += lv_area_get_width(txt_coords) - line_w;
     }
     else {
@@ -1292,4 +1392,24 @@ static void calculate_x_coordinate(lv_coord_t * x, const lv_text_align_t align,
     }
 }
 
+/**
+ * Check if a part of the text is the same as the other, e.g. it wasn't reordered by BiDi
+ * @param txt1      pointer to a text
+ * @param txt2      pointer to an other text
+ * @param length    number of bytes to compare
+ * @return          true: the texts are the same
+ */
+static bool is_same_text(const char * txt1, const char * txt2, uint32_t length)
+{
+    if(txt1 == txt2) return true;
+
+    uint32_t i;
+    for(i = 0; i < length; i++) {
+        if(txt1[i] != txt2[i]) return false;
+        if(txt1[i] == '\0') break;
+    }
+
+    return true;
+}
+
 #endif
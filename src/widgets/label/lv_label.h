@@ -22,6 +22,7 @@ extern "C" {
 #include "../../font/lv_font.h"
 #include "../../font/lv_symbol_def.h"
 #include "../../misc/lv_text.h"
+#include "../../misc/lv_text_layout.h"
 #include "../../draw/lv_draw.h"
 
 /*********************
@@ -80,6 +81,7 @@ typedef struct {
 #endif
 
     lv_point_t size_cache; /*Text size cache*/
+    lv_text_layout_t * layout; /*Lines and letter widths of the text, allocated on the first draw or position query*/
     lv_point_t offset; /*Text draw position offset*/
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
     uint8_t static_txt : 1;             /*Flag to indicate the text is static*/
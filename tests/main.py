@@ -21,6 +21,9 @@ build_only_options = {
 test_options = {
     'OPTIONS_TEST_SYSHEAP': 'Test config, system heap, 32 bit color depth',
     'OPTIONS_TEST_DEFHEAP': 'Test config, LVGL heap, 32 bit color depth',
+    'OPTIONS_TEST_FFMPEG': 'Test config, FFmpeg player, 32 bit color depth',
+    'OPTIONS_TEST_DECODER_ASYNC': 'Test config, images decoded in the background, 32 bit color depth',
+    'OPTIONS_TEST_PREMULTIPLIED': 'Test config, premultiplied SW rendering, 32 bit color depth',
 }
 
 
@@ -32,6 +32,22 @@ extern "C" {
 #endif
 
 
+#ifdef LVGL_CI_USING_FFMPEG
+#define LV_USE_FFMPEG               1
+#define LV_FFMPEG_DECODE_THREAD     1
+#endif
+
+#ifdef LVGL_CI_USING_DECODER_ASYNC
+#define LV_USE_IMAGE_DECODER_ASYNC  1
+#endif
+
+#ifdef LVGL_CI_USING_PREMULTIPLIED
+#define LV_DRAW_SW_PREMULTIPLIED    1
+/*Blending premultiplied colors rounds differently and the transformed layers have no dark fringes,
+ *so the screens which render differently have their own reference images.*/
+#define LV_TEST_REF_IMGS_VARIANT        "premultiplied"
+#endif
+
 #ifdef MICROPYTHON
 #define LV_USE_BUILTIN_MALLOC   0
 #define LV_USE_BUILTIN_MEMCPY   1
@@ -91,6 +107,7 @@ typedef void * lv_user_data_t;
 /*For screenshots*/
 #undef LV_USE_PERF_MONITOR
 #undef LV_USE_MEM_MONITOR
+#undef LV_USE_CACHE_MONITOR
 #undef LV_DPI_DEF
 #define  LV_DPI_DEF         130
 #endif
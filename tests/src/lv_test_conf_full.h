@@ -7,7 +7,6 @@
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
 #define LV_LOG_PRINTF           1
 #define LV_USE_FONT_SUBPX       1
-#define LV_FONT_SUBPX_BGR       1
 #define LV_USE_ASSERT_NULL      1
 #define LV_USE_ASSERT_MALLOC    1
 #define LV_USE_ASSERT_MEM_INTEGRITY     1
@@ -44,10 +43,14 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_GLYPH_CACHE_SIZE    (32 * 1024)
+#define LV_DRAW_SW_TEXT_CACHE_SIZE  (64 * 1024)
+#define LV_FONT_FMT_TXT_LUT_SIZE    (16 * 1024)
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
+#define LV_USE_CACHE_MONITOR        1
 #define LV_LABEL_TEXT_SELECTION     1
 
 #define LV_USE_FLEX 1
@@ -63,6 +66,7 @@
 
 #define LV_USE_LODEPNG      1
 #define LV_USE_BMP          1
+#define LV_USE_TILED_IMAGE  1
 #define LV_USE_TJPGD        1
 #define LV_USE_LIBJPEG_TURBO   1
 #define LV_USE_GIF          1
@@ -0,0 +1,1190 @@
+#include "../../../lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_ARGB8888_LZ4
+    #define LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_ARGB8888_LZ4
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_ARGB8888_LZ4 uint8_t
+test_image_cogwheel_argb8888_lz4_map[] = {
+    /*LZ4 compressed, 40000 bytes decompressed*/
+    0x1f, 0x00, 0x01, 0x00, 0x0a, 0x10, 0x01, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x42, 0x0f, 0x5a, 0x00,
+    0x29, 0xf0, 0x19, 0xff, 0xff, 0xff, 0x08, 0xad, 0x9b, 0x8f, 0xff, 0x95, 0x7e, 0x6d, 0xff, 0x90,
+    0x7a, 0x67, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x97,
+    0x83, 0x72, 0xff, 0xd1, 0xc7, 0xc0, 0x6d, 0xff, 0xff, 0xff, 0x03, 0x2c, 0x00, 0x0f, 0x01, 0x00,
+    0x15, 0x40, 0xff, 0xff, 0xff, 0x01, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x8a, 0x0f,
+    0xa2, 0x00, 0x05, 0x0f, 0x18, 0x00, 0x05, 0x0f, 0x01, 0x00, 0x14, 0x0f, 0xfc, 0x00, 0x29, 0xf1,
+    0x08, 0xf0, 0xf0, 0xf1, 0x11, 0x9e, 0x8a, 0x79, 0xff, 0x8f, 0x78, 0x65, 0xff, 0x90, 0x79, 0x66,
+    0xff, 0x91, 0x7a, 0x67, 0xff, 0x8e, 0x79, 0x66, 0x90, 0x01, 0xc0, 0x8c, 0x76, 0x64, 0xff, 0x9f,
+    0x8c, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x09, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x00, 0x84, 0x00,
+    0x00, 0xdc, 0x01, 0x00, 0x0c, 0x00, 0x08, 0x01, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x0f,
+    0x01, 0x00, 0x35, 0x0f, 0x4d, 0x00, 0x3a, 0x0f, 0x01, 0x00, 0x12, 0x0f, 0x72, 0x00, 0x27, 0xc0,
+    0xff, 0xff, 0xff, 0x0c, 0xee, 0xee, 0xee, 0x0f, 0xff, 0xff, 0xff, 0x05, 0x10, 0x00, 0x0f, 0x01,
+    0x00, 0x0d, 0x00, 0x2c, 0x01, 0x71, 0xe4, 0xe0, 0xdb, 0x39, 0x9a, 0x85, 0x74, 0x8c, 0x01, 0x71,
+    0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0x08, 0x00, 0xb0, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x76,
+    0x63, 0xff, 0x95, 0x7f, 0x6e, 0x90, 0x01, 0x10, 0x07, 0x30, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x00,
+    0x48, 0x00, 0xf0, 0x05, 0xcb, 0xc2, 0xbb, 0x53, 0xae, 0xa2, 0x96, 0xff, 0xdf, 0xd9, 0xd9, 0x28,
+    0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x0b, 0x1c, 0x00, 0x0f, 0x01, 0x00, 0x4a, 0x0f, 0x2b,
+    0x01, 0x27, 0x0f, 0x01, 0x00, 0x46, 0x03, 0xfc, 0x00, 0xf0, 0x06, 0x0c, 0xe7, 0xe1, 0xdb, 0x2b,
+    0xaf, 0x9a, 0x8b, 0xff, 0x9d, 0x85, 0x73, 0xff, 0xb9, 0xa8, 0x9b, 0xa5, 0xff, 0xff, 0xff, 0x0a,
+    0x20, 0x00, 0x0f, 0x01, 0x00, 0x09, 0x00, 0x48, 0x01, 0xb1, 0xe0, 0xda, 0xd3, 0x4b, 0x9d, 0x88,
+    0x77, 0xff, 0x91, 0x7a, 0x68, 0x8c, 0x01, 0x31, 0x96, 0x80, 0x6e, 0x08, 0x00, 0xf0, 0x01, 0x93,
+    0x7e, 0x6c, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x95, 0x80, 0x6f, 0xff, 0xdc, 0xd6, 0xd6, 0x2c, 0x30,
+    0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x44, 0x00, 0xf1, 0x0b, 0xc6, 0xbd, 0xb3, 0x51, 0x87, 0x74,
+    0x61, 0xff, 0x85, 0x73, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x90, 0x80, 0x6f, 0xff, 0xa7, 0x9a,
+    0x8c, 0xff, 0xdf, 0xdf, 0x9c, 0x01, 0x10, 0x08, 0x24, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0x01, 0x00,
+    0x0b, 0x0f, 0x23, 0x00, 0x10, 0x0f, 0x01, 0x00, 0x8c, 0xff, 0x11, 0xff, 0xff, 0xff, 0x0d, 0xce,
+    0xbf, 0xb6, 0x8c, 0xad, 0x97, 0x87, 0xff, 0xa7, 0x90, 0x7f, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9c,
+    0x83, 0x71, 0xff, 0xa0, 0x89, 0x77, 0xff, 0xc1, 0xb2, 0xa7, 0x99, 0xd8, 0x02, 0x10, 0x81, 0x04,
+    0xc5, 0xb7, 0xad, 0xaa, 0x9c, 0x88, 0x77, 0x38, 0x06, 0x00, 0x88, 0x01, 0x01, 0x04, 0x00, 0x21,
+    0x7e, 0x6c, 0x90, 0x01, 0xb0, 0x90, 0x79, 0x67, 0xfb, 0x92, 0x7e, 0x6e, 0xff, 0x9f, 0x92, 0x89,
+    0x24, 0x03, 0x0f, 0x74, 0x03, 0x02, 0xf0, 0x14, 0xe8, 0xe8, 0xe8, 0x21, 0x9c, 0x8b, 0x7c, 0xff,
+    0x82, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5a, 0xfb, 0x82, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff,
+    0x89, 0x77, 0x65, 0xff, 0x8f, 0x7f, 0x6e, 0xff, 0x9c, 0x8e, 0x7f, 0x3c, 0x00, 0x0f, 0x1c, 0x02,
+    0x0e, 0x0f, 0x01, 0x00, 0xad, 0x00, 0x6c, 0x01, 0xf0, 0x04, 0xc6, 0xb5, 0xa9, 0xb2, 0xa6, 0x8d,
+    0x7b, 0xff, 0x9d, 0x82, 0x6e, 0xff, 0x9f, 0x85, 0x72, 0xff, 0x9f, 0x87, 0x75, 0x8c, 0x01, 0xd0,
+    0xfc, 0x9b, 0x82, 0x6f, 0xff, 0xa5, 0x8e, 0x7d, 0xff, 0xeb, 0xeb, 0xe2, 0x1a, 0x2c, 0x00, 0x0f,
+    0x01, 0x00, 0x05, 0x00, 0x64, 0x01, 0xe2, 0xad, 0x9b, 0x8d, 0xff, 0x9a, 0x84, 0x73, 0xff, 0x94,
+    0x7d, 0x6a, 0xff, 0x95, 0x80, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x90, 0x01, 0x00, 0xa4, 0x01,
+    0x70, 0x91, 0x7c, 0x6c, 0xff, 0x92, 0x82, 0x79, 0x54, 0x01, 0x10, 0x04, 0x34, 0x00, 0x01, 0x01,
+    0x00, 0x03, 0xcb, 0x02, 0x00, 0x14, 0x00, 0xf0, 0x19, 0xaf, 0xa2, 0x96, 0xd6, 0x8a, 0x77, 0x65,
+    0xff, 0x88, 0x73, 0x61, 0xff, 0x88, 0x75, 0x63, 0xff, 0x87, 0x75, 0x63, 0xff, 0x84, 0x72, 0x5f,
+    0xfb, 0x81, 0x6e, 0x5b, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0xe9, 0xe9, 0xe2,
+    0x23, 0x30, 0x00, 0x0f, 0x01, 0x00, 0x1d, 0x03, 0x67, 0x00, 0x0f, 0x01, 0x00, 0x92, 0xf1, 0x04,
+    0xf8, 0xf1, 0xf1, 0x25, 0xaf, 0x99, 0x89, 0xff, 0xa0, 0x84, 0x72, 0xff, 0xa4, 0x89, 0x78, 0xff,
+    0xa3, 0x8a, 0x79, 0x20, 0x03, 0x00, 0x04, 0x00, 0xf0, 0x01, 0x9e, 0x85, 0x73, 0xff, 0xa0, 0x87,
+    0x76, 0xff, 0xc1, 0xb3, 0xa7, 0x6b, 0xff, 0xff, 0xff, 0x02, 0x30, 0x00, 0x0f, 0x01, 0x00, 0x01,
+    0x00, 0x38, 0x09, 0x71, 0xa5, 0x91, 0x82, 0xff, 0x99, 0x83, 0x71, 0x34, 0x06, 0x13, 0x95, 0xac,
+    0x04, 0x00, 0x6c, 0x09, 0x00, 0x10, 0x00, 0xc0, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff,
+    0x8e, 0x7e, 0x74, 0xfb, 0x7c, 0x01, 0x00, 0x34, 0x00, 0x08, 0x01, 0x00, 0xf0, 0x03, 0xef, 0xef,
+    0xef, 0x10, 0x94, 0x83, 0x72, 0xff, 0x84, 0x6e, 0x5b, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76,
+    0x90, 0x01, 0x42, 0x62, 0xff, 0x86, 0x74, 0x04, 0x00, 0xcf, 0x7f, 0x6c, 0x59, 0xff, 0x83, 0x70,
+    0x5e, 0xff, 0xcb, 0xc4, 0xbc, 0x67, 0xb4, 0x04, 0x0d, 0x0f, 0x1d, 0x00, 0x0a, 0x0f, 0x01, 0x00,
+    0x90, 0x00, 0x30, 0x07, 0xf3, 0x02, 0xb4, 0x9f, 0x92, 0xc4, 0xa2, 0x88, 0x77, 0xff, 0xa4, 0x8a,
+    0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa3, 0x90, 0x01, 0xf0, 0x01, 0xa1, 0x88, 0x77, 0xff, 0x9e,
+    0x86, 0x73, 0xff, 0x9f, 0x89, 0x77, 0xff, 0xe1, 0xdb, 0xd4, 0x2a, 0x30, 0x00, 0x0f, 0x01, 0x00,
+    0x01, 0x00, 0x38, 0x09, 0x35, 0xa1, 0x8c, 0x7c, 0x34, 0x06, 0x08, 0x04, 0x00, 0x10, 0x94, 0x44,
+    0x06, 0xf0, 0x00, 0x7d, 0x6b, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x7d, 0x72, 0xff, 0xcf, 0xc7,
+    0xc7, 0x40, 0x34, 0x00, 0x04, 0x01, 0x00, 0xf3, 0x03, 0xff, 0xfe, 0xff, 0x01, 0xbd, 0xb5, 0xab,
+    0x7c, 0x90, 0x7d, 0x6b, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8a, 0x77, 0x90, 0x01, 0x03, 0x8c, 0x01,
+    0x00, 0x04, 0x00, 0xcf, 0x81, 0x6f, 0x5c, 0xff, 0x87, 0x76, 0x66, 0xff, 0xab, 0xa1, 0x99, 0xd4,
+    0x18, 0x02, 0x06, 0x0c, 0x89, 0x01, 0x0c, 0x10, 0x00, 0x0f, 0x01, 0x00, 0x98, 0x40, 0xba, 0xa7,
+    0x99, 0xa2, 0x8c, 0x01, 0x00, 0x20, 0x03, 0x04, 0x90, 0x01, 0x71, 0xa1, 0x8a, 0x77, 0xff, 0xa1,
+    0x89, 0x77, 0xbc, 0x04, 0xc0, 0x9a, 0x81, 0x6e, 0xff, 0xb4, 0xa2, 0x96, 0xbf, 0xff, 0xff, 0xff,
+    0x0e, 0x30, 0x00, 0x04, 0x01, 0x00, 0x00, 0xec, 0x04, 0xb1, 0xe3, 0xd7, 0xd7, 0x2d, 0xbc, 0xaf,
+    0xa3, 0x82, 0x99, 0x83, 0x72, 0x80, 0x01, 0x00, 0x94, 0x01, 0x04, 0x04, 0x00, 0x00, 0x10, 0x00,
+    0x20, 0x95, 0x7f, 0x20, 0x03, 0xf0, 0x03, 0x6c, 0xff, 0x8f, 0x7a, 0x69, 0xfb, 0x8f, 0x7a, 0x6b,
+    0xff, 0x9a, 0x89, 0x7d, 0xff, 0xcc, 0xc5, 0xbd, 0x46, 0xe4, 0x04, 0x00, 0x44, 0x00, 0xf6, 0x08,
+    0xdb, 0xd5, 0xd0, 0x31, 0x92, 0x80, 0x6f, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x8b, 0x76, 0x65, 0xfb,
+    0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x64, 0x90, 0x01, 0xff, 0x00, 0x73, 0x61, 0xff, 0x81, 0x6f,
+    0x5d, 0xfb, 0x86, 0x77, 0x6b, 0xff, 0xa5, 0x9c, 0x98, 0xdc, 0x20, 0x03, 0x0d, 0x0f, 0x01, 0x00,
+    0x02, 0x0f, 0x32, 0x00, 0x1f, 0x0f, 0x01, 0x00, 0x66, 0x00, 0xe0, 0x00, 0x40, 0xbb, 0xa6, 0x99,
+    0xbb, 0x84, 0x01, 0xa6, 0xa3, 0x89, 0x77, 0xfc, 0xa5, 0x8c, 0x7a, 0xff, 0xa4, 0x8b, 0x20, 0x03,
+    0xf1, 0x24, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xb7, 0xa7,
+    0x9a, 0xa9, 0xd4, 0xcb, 0xc2, 0x3b, 0xd3, 0xc9, 0xc4, 0x34, 0xce, 0xc1, 0xba, 0x4e, 0xbc, 0xad,
+    0xa2, 0xac, 0xa6, 0x93, 0x83, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x96, 0x7f, 0x6e, 0xfb, 0x97, 0x80,
+    0x6f, 0xfb, 0x96, 0x80, 0x6f, 0x8c, 0x01, 0x04, 0x04, 0x00, 0x20, 0x94, 0x7e, 0x20, 0x03, 0x00,
+    0x44, 0x06, 0xf1, 0x17, 0x6b, 0xff, 0x90, 0x7b, 0x69, 0xf7, 0x90, 0x7a, 0x68, 0xff, 0x9c, 0x89,
+    0x7b, 0xff, 0xb2, 0xa4, 0x99, 0xa8, 0xc3, 0xba, 0xaf, 0x59, 0x9f, 0x8f, 0x7f, 0xff, 0x89, 0x75,
+    0x62, 0xff, 0x88, 0x74, 0x61, 0xfb, 0x8c, 0x78, 0x66, 0xff, 0x90, 0x01, 0x21, 0x76, 0x64, 0x40,
+    0x06, 0x01, 0x90, 0x01, 0x21, 0x74, 0x60, 0x3c, 0x06, 0x80, 0x86, 0x78, 0x6f, 0xff, 0xac, 0xa4,
+    0xa3, 0xc7, 0xb0, 0x00, 0x00, 0xb8, 0x00, 0x0f, 0x01, 0x00, 0xc5, 0x00, 0xe0, 0x00, 0x50, 0xd0,
+    0xc2, 0xb8, 0x7e, 0xa9, 0x58, 0x09, 0x21, 0x88, 0x76, 0x20, 0x03, 0x11, 0xa4, 0x24, 0x03, 0x45,
+    0x79, 0xff, 0xa2, 0x88, 0x94, 0x01, 0xe0, 0xfb, 0x9e, 0x85, 0x75, 0xf7, 0x9c, 0x84, 0x71, 0xff,
+    0x9e, 0x86, 0x75, 0xff, 0x9e, 0x34, 0x03, 0xf1, 0x07, 0x83, 0x70, 0xff, 0x97, 0x7f, 0x6c, 0xff,
+    0x97, 0x81, 0x6e, 0xf7, 0x99, 0x82, 0x71, 0xf7, 0x98, 0x81, 0x70, 0xff, 0x97, 0x80, 0x6f, 0x04,
+    0x00, 0x00, 0x88, 0x01, 0x02, 0x04, 0x00, 0x00, 0x40, 0x06, 0x00, 0xf4, 0x0a, 0x70, 0x6d, 0xff,
+    0x92, 0x7d, 0x6c, 0xff, 0x91, 0x94, 0x01, 0x70, 0x7a, 0x69, 0xfb, 0x8e, 0x78, 0x66, 0xf3, 0x24,
+    0x0e, 0x00, 0x80, 0x01, 0xf0, 0x00, 0x8a, 0x76, 0x63, 0xff, 0x8c, 0x7a, 0x67, 0xf7, 0x8c, 0x79,
+    0x66, 0xff, 0x8b, 0x78, 0x65, 0x24, 0x03, 0x02, 0x90, 0x01, 0x26, 0x76, 0x64, 0x90, 0x01, 0xb0,
+    0x70, 0x5e, 0xff, 0x84, 0x77, 0x71, 0xff, 0xd9, 0xd4, 0xd4, 0x3c, 0xb4, 0x00, 0x0f, 0x01, 0x00,
+    0xcd, 0x00, 0x00, 0x06, 0x62, 0xb5, 0xa0, 0x92, 0xda, 0xa4, 0x8b, 0x1c, 0x03, 0x00, 0x08, 0x00,
+    0x00, 0x30, 0x03, 0x00, 0xb0, 0x04, 0x01, 0x20, 0x03, 0x10, 0x87, 0x04, 0x00, 0xff, 0x11, 0x75,
+    0xff, 0x9e, 0x85, 0x74, 0xf7, 0x9b, 0x82, 0x70, 0xf3, 0x9a, 0x83, 0x6e, 0xf0, 0x9a, 0x83, 0x70,
+    0xf3, 0x99, 0x82, 0x6f, 0xf7, 0x99, 0x82, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x98, 0x82, 0x90,
+    0x01, 0x01, 0x00, 0x20, 0x03, 0x03, 0x64, 0x09, 0x51, 0x7e, 0x6c, 0xff, 0x91, 0x7b, 0x90, 0x01,
+    0xf1, 0x05, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xf7, 0x8c, 0x76, 0x65, 0xf3, 0x8c,
+    0x77, 0x65, 0xff, 0x8d, 0x79, 0x67, 0x9c, 0x01, 0x11, 0x8c, 0x90, 0x01, 0x00, 0x40, 0x06, 0x44,
+    0x64, 0xff, 0x88, 0x75, 0x90, 0x01, 0xa0, 0x5f, 0xff, 0x83, 0x73, 0x62, 0xff, 0x80, 0x76, 0x73,
+    0xe5, 0x38, 0x08, 0x00, 0xb0, 0x00, 0x0f, 0x01, 0x00, 0x09, 0xcf, 0xe8, 0xe8, 0xe8, 0x16, 0xa8,
+    0x9d, 0x90, 0x95, 0xde, 0xde, 0xd8, 0x2e, 0x6c, 0x06, 0x06, 0x0c, 0x01, 0x00, 0x0f, 0x72, 0x03,
+    0x16, 0x0f, 0x29, 0x00, 0x16, 0x09, 0x01, 0x00, 0x00, 0x9c, 0x05, 0x80, 0xeb, 0xe4, 0xdd, 0x4b,
+    0xf6, 0xf6, 0xf6, 0x1d, 0x10, 0x00, 0x0f, 0x01, 0x00, 0x11, 0xe0, 0xcd, 0xbe, 0xb5, 0x89, 0xa7,
+    0x8e, 0x7c, 0xff, 0xa2, 0x87, 0x76, 0xff, 0xa5, 0x8a, 0x90, 0x01, 0x11, 0x79, 0x44, 0x06, 0x31,
+    0xa0, 0x89, 0x76, 0x10, 0x03, 0x00, 0x90, 0x01, 0x02, 0x9c, 0x01, 0xf1, 0x02, 0x75, 0xff, 0x9d,
+    0x86, 0x73, 0xff, 0x9c, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x73, 0xff, 0x9a, 0x83, 0x72, 0x58, 0x09,
+    0x00, 0x90, 0x01, 0x22, 0x98, 0x80, 0x04, 0x00, 0x08, 0x94, 0x01, 0x0a, 0x90, 0x01, 0x11, 0x6a,
+    0x90, 0x01, 0x23, 0x90, 0x7a, 0x70, 0x09, 0x42, 0x7a, 0x69, 0xff, 0x8d, 0x9c, 0x01, 0x03, 0x90,
+    0x01, 0x11, 0x66, 0x90, 0x01, 0x50, 0x8a, 0x76, 0x65, 0xff, 0x88, 0x24, 0x03, 0x00, 0x90, 0x01,
+    0xbf, 0x73, 0x60, 0xff, 0x84, 0x73, 0x62, 0xff, 0x82, 0x77, 0x70, 0xec, 0x60, 0x01, 0x09, 0xf0,
+    0x09, 0xee, 0xef, 0xee, 0x0f, 0xb5, 0xa9, 0xa0, 0x86, 0x8e, 0x7e, 0x6e, 0xe6, 0x85, 0x75, 0x63,
+    0xff, 0x8a, 0x7c, 0x6b, 0xff, 0xb1, 0xa7, 0x9a, 0x93, 0x0c, 0x01, 0x00, 0x20, 0x00, 0x0f, 0x01,
+    0x00, 0x41, 0x0f, 0x9e, 0x01, 0x11, 0x00, 0x64, 0x07, 0xf0, 0x01, 0xc6, 0xb2, 0xa5, 0xaf, 0xb8,
+    0x9f, 0x8f, 0xff, 0xbd, 0xa5, 0x97, 0xff, 0xea, 0xe4, 0xdf, 0x30, 0x18, 0x00, 0x0f, 0x01, 0x00,
+    0x03, 0x02, 0x52, 0x00, 0x00, 0x9c, 0x0f, 0x70, 0xba, 0xa5, 0x98, 0xd2, 0xa6, 0x8c, 0x7a, 0x44,
+    0x06, 0x01, 0x68, 0x09, 0x00, 0x20, 0x03, 0x04, 0x44, 0x06, 0x00, 0x84, 0x01, 0x04, 0x04, 0x00,
+    0x01, 0x8c, 0x01, 0x61, 0x85, 0x72, 0xff, 0x9b, 0x85, 0x72, 0x38, 0x06, 0x31, 0x9a, 0x84, 0x71,
+    0x20, 0x03, 0x40, 0x99, 0x82, 0x71, 0xff, 0xb4, 0x04, 0x00, 0x90, 0x01, 0x00, 0x88, 0x01, 0x04,
+    0x04, 0x00, 0x08, 0x90, 0x01, 0x00, 0x44, 0x06, 0x00, 0x64, 0x14, 0x00, 0x94, 0x01, 0x71, 0x8f,
+    0x7a, 0x69, 0xff, 0x8e, 0x7a, 0x68, 0x1c, 0x03, 0x00, 0x90, 0x01, 0x10, 0x8d, 0x8c, 0x01, 0x01,
+    0xc0, 0x04, 0x03, 0x20, 0x03, 0x05, 0x90, 0x01, 0xe0, 0x61, 0xff, 0x83, 0x70, 0x5f, 0xff, 0x86,
+    0x77, 0x69, 0xff, 0xb3, 0xa8, 0xa2, 0x87, 0x60, 0x05, 0x00, 0xb4, 0x00, 0x02, 0x01, 0x00, 0x02,
+    0x0b, 0x00, 0x00, 0x24, 0x0a, 0xff, 0x0d, 0xa6, 0x9a, 0x8d, 0xf4, 0x8a, 0x79, 0x68, 0xff, 0x7a,
+    0x69, 0x55, 0xff, 0x7e, 0x6c, 0x59, 0xdc, 0x74, 0x61, 0x4d, 0xff, 0x83, 0x74, 0x62, 0xff, 0xa9,
+    0x9d, 0x92, 0xb1, 0x64, 0x0b, 0x01, 0x0f, 0x01, 0x00, 0x51, 0x00, 0x54, 0x10, 0xff, 0x09, 0xc0,
+    0xa9, 0x9a, 0xcc, 0xb3, 0x96, 0x85, 0xff, 0xab, 0x8c, 0x7a, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xb1,
+    0x96, 0x85, 0xff, 0xdd, 0xd2, 0xcb, 0x4a, 0xec, 0x03, 0x05, 0x00, 0x8c, 0x01, 0x71, 0xc2, 0xaf,
+    0xa2, 0x89, 0xa8, 0x8d, 0x7b, 0x3c, 0x06, 0x13, 0xa5, 0xac, 0x04, 0x00, 0x04, 0x00, 0x35, 0xa2,
+    0x89, 0x78, 0x14, 0x03, 0x04, 0x04, 0x00, 0x31, 0x9e, 0x87, 0x74, 0x04, 0x0b, 0x90, 0x9e, 0x86,
+    0x74, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x9b, 0x94, 0x01, 0x04, 0x8c, 0x01, 0x03, 0x04, 0x00, 0x2b,
+    0x97, 0x81, 0x20, 0x03, 0x01, 0xd0, 0x07, 0x00, 0x40, 0x06, 0x11, 0x6a, 0x24, 0x03, 0x04, 0x04,
+    0x00, 0x02, 0x24, 0x03, 0x02, 0x94, 0x01, 0x40, 0x8c, 0x78, 0x67, 0xff, 0x10, 0x0e, 0x00, 0x90,
+    0x01, 0x00, 0x04, 0x00, 0x10, 0x89, 0x14, 0x0e, 0x00, 0x90, 0x01, 0x20, 0x74, 0x62, 0xa8, 0x0f,
+    0xd8, 0xf7, 0x83, 0x70, 0x5d, 0xff, 0x90, 0x7f, 0x6f, 0xff, 0xb1, 0xa5, 0x9a, 0x83, 0x28, 0x03,
+    0xf0, 0x18, 0xeb, 0xeb, 0xeb, 0x0d, 0x98, 0x8a, 0x7b, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x79, 0x67,
+    0x54, 0xfb, 0x7d, 0x6c, 0x58, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xf7, 0x75, 0x64,
+    0x50, 0xff, 0x7e, 0x6f, 0x5d, 0xff, 0x9e, 0x92, 0x86, 0x1c, 0x0a, 0x10, 0x06, 0x30, 0x00, 0x0f,
+    0x01, 0x00, 0x55, 0x00, 0x8c, 0x01, 0xf0, 0x15, 0xc2, 0xab, 0x9d, 0xc8, 0xb3, 0x97, 0x85, 0xff,
+    0xaf, 0x91, 0x7f, 0xff, 0xaf, 0x92, 0x81, 0xf9, 0xac, 0x8e, 0x7e, 0xf9, 0xac, 0x8d, 0x7d, 0xff,
+    0xb0, 0x94, 0x83, 0xff, 0xc8, 0xb4, 0xa8, 0xbb, 0xf5, 0xf5, 0xf5, 0x19, 0x2c, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xd4, 0x00, 0xf0, 0x05, 0xcc, 0xbd, 0xb2, 0x78, 0xae, 0x96, 0x86, 0xff, 0xa7, 0x8d,
+    0x7b, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa6, 0x8c, 0x7c, 0xf8, 0x90, 0x01, 0x02, 0x20, 0x03, 0x42,
+    0x79, 0xff, 0xa1, 0x89, 0x20, 0x03, 0x00, 0x94, 0x01, 0x20, 0xa0, 0x88, 0xb0, 0x04, 0x02, 0x94,
+    0x01, 0x02, 0x24, 0x03, 0x11, 0x73, 0x8c, 0x01, 0x00, 0x74, 0x01, 0x20, 0x90, 0x7b, 0xf0, 0x02,
+    0x00, 0xb8, 0x12, 0x3b, 0x6e, 0xff, 0x97, 0x90, 0x01, 0x00, 0xf4, 0x0a, 0x00, 0x90, 0x01, 0x00,
+    0x80, 0x0c, 0x00, 0xf8, 0x02, 0x00, 0x8c, 0x04, 0x35, 0x8e, 0x78, 0x67, 0x24, 0x03, 0x11, 0x8d,
+    0x08, 0x16, 0x07, 0x20, 0x03, 0x22, 0x77, 0x65, 0x64, 0x09, 0x07, 0x90, 0x01, 0x30, 0x86, 0x74,
+    0x61, 0xac, 0x0f, 0x10, 0xf7, 0x14, 0x0e, 0x00, 0x44, 0x11, 0xf0, 0x08, 0x8e, 0x7d, 0x6d, 0xff,
+    0xcb, 0xc3, 0xba, 0x6b, 0xdc, 0xdc, 0xd6, 0x2c, 0x8c, 0x7e, 0x6e, 0xf7, 0x80, 0x6f, 0x5d, 0xff,
+    0x7b, 0x67, 0x54, 0x88, 0x01, 0x80, 0xfb, 0x80, 0x6f, 0x5c, 0xff, 0x7f, 0x6e, 0x5b, 0x0c, 0x00,
+    0xfa, 0x02, 0xff, 0x7c, 0x6b, 0x58, 0xf7, 0x73, 0x62, 0x4f, 0xff, 0x7f, 0x6f, 0x5d, 0xff, 0xad,
+    0xa2, 0x96, 0xa7, 0x5c, 0x03, 0x0f, 0x01, 0x00, 0x0c, 0x0f, 0x2a, 0x00, 0x17, 0x0d, 0x01, 0x00,
+    0x00, 0x68, 0x00, 0xf0, 0x04, 0xc8, 0xb4, 0xa8, 0x9f, 0xb4, 0x97, 0x86, 0xff, 0xaf, 0x90, 0x7e,
+    0xff, 0xb0, 0x93, 0x82, 0xf9, 0xb0, 0x93, 0x82, 0x94, 0x01, 0x50, 0xff, 0xae, 0x91, 0x80, 0xf9,
+    0x28, 0x03, 0xc0, 0xaf, 0x93, 0x83, 0xff, 0xc0, 0xaa, 0x9f, 0xe6, 0xef, 0xe7, 0xe7, 0x20, 0x2c,
+    0x02, 0x40, 0xc9, 0xba, 0xaf, 0x76, 0x8c, 0x01, 0xe0, 0xa5, 0x8b, 0x77, 0xff, 0xa5, 0x8c, 0x79,
+    0xff, 0xa7, 0x8e, 0x7d, 0xf8, 0xa6, 0x8c, 0x24, 0x03, 0x16, 0x7a, 0x40, 0x06, 0x12, 0x89, 0x84,
+    0x0c, 0x31, 0xa2, 0x89, 0x77, 0x30, 0x03, 0x00, 0x98, 0x01, 0x71, 0x98, 0x81, 0x6f, 0xff, 0x8f,
+    0x7b, 0x68, 0x24, 0x01, 0xf1, 0x00, 0x7f, 0x6d, 0x5a, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x74, 0x66,
+    0x53, 0xff, 0x7b, 0x6b, 0x58, 0xf0, 0x02, 0x00, 0x48, 0x06, 0x08, 0x90, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x18, 0x03, 0xf3, 0x06, 0x84, 0x73, 0x61, 0xff, 0x78, 0x69, 0x55, 0xff, 0x74, 0x65, 0x52,
+    0xff, 0x78, 0x68, 0x55, 0xff, 0x7c, 0x6c, 0x58, 0xff, 0x81, 0xa4, 0x12, 0x00, 0x34, 0x06, 0x00,
+    0x24, 0x03, 0x00, 0x04, 0x00, 0x01, 0x94, 0x01, 0x07, 0x20, 0x03, 0x10, 0x85, 0x04, 0x00, 0x10,
+    0x73, 0x64, 0x14, 0xf0, 0x13, 0x61, 0xff, 0x83, 0x72, 0x60, 0xf7, 0x7e, 0x6b, 0x58, 0xff, 0x80,
+    0x6e, 0x5c, 0xff, 0x91, 0x82, 0x72, 0xff, 0x90, 0x81, 0x71, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b,
+    0x69, 0x57, 0xff, 0x7f, 0x6d, 0x5b, 0xfb, 0x88, 0x01, 0x00, 0x04, 0x00, 0x00, 0x8c, 0x01, 0x31,
+    0x7d, 0x6c, 0x59, 0x08, 0x00, 0xc0, 0x79, 0x68, 0x54, 0xf7, 0x76, 0x65, 0x52, 0xff, 0x97, 0x89,
+    0x7a, 0xe3, 0x28, 0x01, 0x00, 0x30, 0x01, 0x09, 0x01, 0x00, 0x05, 0x12, 0x00, 0x05, 0x09, 0x00,
+    0x0f, 0x01, 0x00, 0x2e, 0x00, 0x20, 0x09, 0x70, 0xbb, 0xa2, 0x94, 0xd7, 0xad, 0x8f, 0x7d, 0x84,
+    0x01, 0x05, 0x8c, 0x01, 0x00, 0x04, 0x00, 0xf1, 0x08, 0xae, 0x91, 0x80, 0xff, 0xae, 0x90, 0x80,
+    0xfc, 0xaa, 0x8d, 0x7c, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xac, 0x92, 0x81, 0xff, 0xab, 0x91, 0x7f,
+    0x0c, 0x00, 0x01, 0x14, 0x03, 0xb1, 0x8d, 0x7a, 0xf8, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7c,
+    0xff, 0x90, 0x01, 0x10, 0x8a, 0x20, 0x03, 0x12, 0x7a, 0x98, 0x01, 0x21, 0x8c, 0x7a, 0x90, 0x01,
+    0x00, 0x20, 0x06, 0x31, 0x92, 0x7d, 0x6b, 0xe0, 0x02, 0x00, 0x44, 0x01, 0xf1, 0x08, 0x7a, 0x6b,
+    0x57, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x69, 0x5d, 0x49, 0xff, 0x66, 0x5b,
+    0x47, 0xff, 0x71, 0x63, 0x51, 0x50, 0x01, 0x00, 0x70, 0x09, 0x0e, 0x90, 0x01, 0xf2, 0x11, 0x69,
+    0xff, 0x81, 0x70, 0x5c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x67, 0x5c, 0x47, 0xff, 0x6a, 0x5e, 0x49,
+    0xff, 0x6d, 0x60, 0x4b, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x77, 0x68, 0x54, 0xff, 0x7b, 0x6c, 0x64,
+    0x01, 0x31, 0x85, 0x71, 0x60, 0x88, 0x01, 0x01, 0x20, 0x03, 0x03, 0x40, 0x06, 0x00, 0x90, 0x01,
+    0x00, 0xcc, 0x01, 0x35, 0x84, 0x72, 0x60, 0x04, 0x00, 0xa1, 0x80, 0x6e, 0x5c, 0xfb, 0x7c, 0x6a,
+    0x57, 0xff, 0x7d, 0x6b, 0x88, 0x01, 0x01, 0x10, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x90, 0x01, 0x00, 0x04, 0x00, 0x00, 0x90, 0x01, 0x00, 0x04, 0x00, 0x20, 0x78, 0x68, 0x2c, 0x02,
+    0x6f, 0x59, 0xff, 0x9c, 0x8f, 0x84, 0xb9, 0x90, 0x01, 0x02, 0x0f, 0x01, 0x00, 0x40, 0x00, 0xf0,
+    0x02, 0x40, 0xbb, 0xa3, 0x94, 0xc4, 0x08, 0x03, 0x45, 0xae, 0x91, 0x80, 0xfc, 0x88, 0x01, 0x00,
+    0x04, 0x00, 0x21, 0x90, 0x7f, 0x04, 0x00, 0x90, 0xac, 0x91, 0x80, 0xfc, 0xa9, 0x8f, 0x7d, 0xff,
+    0xaa, 0x04, 0x00, 0xb2, 0x90, 0x7e, 0xff, 0xa8, 0x8e, 0x7b, 0xff, 0xa8, 0x8e, 0x7c, 0xfb, 0x8c,
+    0x01, 0x20, 0x7b, 0xff, 0x50, 0x14, 0x00, 0x90, 0x01, 0x00, 0x04, 0x00, 0x31, 0xa5, 0x8c, 0x7b,
+    0x3c, 0x06, 0x31, 0x9c, 0x85, 0x74, 0x88, 0x01, 0xf1, 0x04, 0x84, 0x72, 0x5f, 0xff, 0x75, 0x66,
+    0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0x5c, 0x01, 0x04,
+    0x04, 0x00, 0x31, 0x6b, 0x5e, 0x4a, 0xf8, 0x02, 0x00, 0x90, 0x01, 0x0f, 0x20, 0x03, 0x05, 0xb1,
+    0x83, 0x71, 0x5e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5e, 0x48, 0xc8, 0x01, 0xb3, 0x6b, 0x5f,
+    0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6d, 0x60, 0x4c, 0x50, 0x00, 0x51, 0x4d, 0xff, 0x76, 0x66,
+    0x53, 0x4c, 0x01, 0x00, 0x0c, 0x03, 0x02, 0xa8, 0x04, 0x12, 0x62, 0x94, 0x01, 0x07, 0x90, 0x01,
+    0x31, 0x83, 0x71, 0x5f, 0x90, 0x0c, 0x13, 0x80, 0x78, 0x01, 0x00, 0xa0, 0x04, 0x00, 0x8c, 0x01,
+    0x26, 0x80, 0x6d, 0x90, 0x01, 0x00, 0x18, 0x03, 0x00, 0x8c, 0x01, 0xff, 0x01, 0x7c, 0x6b, 0x57,
+    0xff, 0x77, 0x65, 0x52, 0xff, 0x80, 0x72, 0x65, 0xff, 0xa9, 0xa2, 0x9d, 0xbb, 0x90, 0x01, 0x09,
+    0x0f, 0x19, 0x00, 0x06, 0x0f, 0x01, 0x00, 0x24, 0x40, 0xd6, 0xc6, 0xbf, 0x6f, 0x28, 0x06, 0x81,
+    0xab, 0x8d, 0x7c, 0xff, 0xaf, 0x91, 0x80, 0xfc, 0x8c, 0x01, 0x41, 0x91, 0x80, 0xff, 0xad, 0x8c,
+    0x01, 0x12, 0x7f, 0x14, 0x03, 0x00, 0x04, 0x00, 0x90, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7c, 0xff,
+    0xa9, 0x8e, 0x04, 0x00, 0x22, 0x7d, 0xff, 0x90, 0x01, 0x12, 0x7c, 0x90, 0x01, 0x21, 0x8d, 0x7b,
+    0x9c, 0x01, 0x00, 0xcc, 0x12, 0x00, 0x0c, 0x09, 0x00, 0xdc, 0x00, 0xf1, 0x00, 0x74, 0x65, 0x51,
+    0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6a, 0x5d, 0x4a, 0x90, 0x01, 0x10, 0x6c,
+    0x44, 0x01, 0x12, 0x60, 0x44, 0x01, 0x9f, 0x6f, 0x61, 0x4d, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x75,
+    0x90, 0x01, 0x08, 0x00, 0x4c, 0x00, 0x32, 0x84, 0x71, 0x5f, 0x90, 0x01, 0x44, 0x5d, 0x47, 0xff,
+    0x6b, 0x94, 0x01, 0x44, 0x5e, 0x4a, 0xff, 0x6c, 0x50, 0x00, 0x61, 0x61, 0x4d, 0xff, 0x71, 0x63,
+    0x50, 0xfc, 0x04, 0x00, 0xd0, 0x04, 0x31, 0x7d, 0x6c, 0x5a, 0x34, 0x00, 0x00, 0x94, 0x01, 0x04,
+    0x90, 0x01, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x90, 0x01, 0x31, 0x81, 0x6f, 0x5d, 0x04,
+    0x00, 0x01, 0x8c, 0x01, 0x03, 0x04, 0x00, 0x00, 0x90, 0x01, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x90, 0x01, 0xf0, 0x01, 0x7b, 0x69, 0x55, 0xff, 0x78, 0x67, 0x57, 0xff, 0x84, 0x79, 0x75,
+    0xff, 0xe0, 0xe0, 0xe1, 0x29, 0x28, 0x01, 0x0f, 0x01, 0x00, 0x55, 0x00, 0x1c, 0x18, 0x40, 0xcf,
+    0xbf, 0xb4, 0x8f, 0x90, 0x01, 0x00, 0x28, 0x03, 0x31, 0xaf, 0x92, 0x81, 0x94, 0x01, 0x13, 0xad,
+    0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x01, 0x90, 0x01, 0x00, 0x04,
+    0x00, 0x20, 0x8e, 0x7c, 0x24, 0x03, 0x01, 0x04, 0x00, 0x31, 0xa9, 0x8f, 0x7e, 0x18, 0x03, 0x00,
+    0x40, 0x01, 0x71, 0x85, 0x72, 0x60, 0xff, 0x77, 0x67, 0x54, 0x24, 0x01, 0x13, 0x69, 0x38, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x98, 0x01, 0x00, 0x04, 0x00, 0xf0, 0x0f, 0x6e, 0x60, 0x4b, 0xff, 0x6c,
+    0x5d, 0x49, 0xff, 0x6a, 0x5b, 0x4a, 0xff, 0x6e, 0x61, 0x53, 0xff, 0x74, 0x69, 0x60, 0xff, 0x7c,
+    0x6f, 0x66, 0xff, 0x8f, 0x7a, 0x6a, 0xfb, 0x98, 0x81, 0x34, 0x11, 0x02, 0x88, 0x01, 0x00, 0x04,
+    0x00, 0xf1, 0x0c, 0x97, 0x80, 0x6e, 0xff, 0x8e, 0x79, 0x69, 0xff, 0x78, 0x66, 0x5a, 0xfb, 0x63,
+    0x57, 0x4c, 0xff, 0x69, 0x5e, 0x52, 0xff, 0x76, 0x6b, 0x5b, 0xff, 0x73, 0x67, 0x55, 0xe0, 0x01,
+    0xf1, 0x04, 0x67, 0x58, 0x43, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x73, 0x64,
+    0x51, 0xff, 0x73, 0x64, 0x52, 0x04, 0x00, 0xb1, 0x77, 0x67, 0x55, 0xff, 0x7b, 0x6a, 0x58, 0xff,
+    0x7f, 0x6e, 0x5c, 0x3c, 0x09, 0x00, 0x94, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x90, 0x01, 0x09, 0x00,
+    0x88, 0x01, 0x06, 0x04, 0x00, 0x11, 0x58, 0x70, 0x03, 0x80, 0x7a, 0x6e, 0x66, 0xff, 0x9f, 0x98,
+    0x9a, 0xd2, 0xc0, 0x08, 0x00, 0x28, 0x01, 0x0f, 0x01, 0x00, 0x59, 0x00, 0x94, 0x01, 0xf6, 0x00,
+    0xcd, 0xbb, 0xae, 0x8e, 0xac, 0x8e, 0x7d, 0xff, 0xab, 0x8d, 0x7b, 0xff, 0xad, 0x92, 0x80, 0x1c,
+    0x03, 0x01, 0x88, 0x01, 0x02, 0xac, 0x04, 0x00, 0x08, 0x00, 0x00, 0x18, 0x03, 0x00, 0x08, 0x00,
+    0x00, 0xc0, 0x04, 0x00, 0x08, 0x00, 0x31, 0xa0, 0x88, 0x77, 0x28, 0x09, 0x00, 0x68, 0x07, 0x00,
+    0xb0, 0x02, 0x31, 0x68, 0x5d, 0x49, 0x08, 0x00, 0x02, 0x04, 0x03, 0x11, 0x4c, 0x5c, 0x04, 0x00,
+    0x40, 0x01, 0xf2, 0x10, 0x6c, 0x5e, 0x4e, 0xff, 0x6f, 0x63, 0x55, 0xff, 0x7c, 0x71, 0x67, 0xff,
+    0x91, 0x87, 0x80, 0xff, 0xa7, 0xa0, 0x9b, 0x97, 0xd5, 0xd5, 0xd5, 0x12, 0xc8, 0xc2, 0xc2, 0x2a,
+    0x9c, 0x88, 0x7c, 0x1c, 0x03, 0x01, 0x48, 0x14, 0x02, 0x5c, 0x14, 0xf0, 0x29, 0x97, 0x81, 0x6e,
+    0xff, 0x89, 0x74, 0x65, 0xfb, 0x71, 0x62, 0x5a, 0xff, 0x72, 0x68, 0x68, 0xff, 0xac, 0xa7, 0xa7,
+    0x62, 0xd6, 0xd6, 0xd6, 0x19, 0xd9, 0xd9, 0xcc, 0x14, 0xc1, 0xbb, 0xb6, 0x31, 0x95, 0x8b, 0x7d,
+    0xff, 0x85, 0x79, 0x68, 0xff, 0x72, 0x63, 0x50, 0xff, 0x6e, 0x5d, 0x4a, 0xff, 0x71, 0x60, 0x4d,
+    0xff, 0x75, 0x64, 0x52, 0xfb, 0x90, 0x01, 0x00, 0x04, 0x00, 0x71, 0x79, 0x68, 0x56, 0xff, 0x7e,
+    0x6d, 0x5b, 0x88, 0x01, 0x00, 0x90, 0x01, 0x00, 0x28, 0x03, 0x0f, 0x90, 0x01, 0x0d, 0x01, 0x68,
+    0x08, 0xef, 0x68, 0x55, 0xfb, 0x71, 0x64, 0x5a, 0xff, 0x7e, 0x76, 0x78, 0xff, 0xe5, 0xe5, 0xe5,
+    0x18, 0x0f, 0x16, 0x0f, 0x01, 0x00, 0x3d, 0xf8, 0x01, 0xff, 0xf2, 0xf2, 0x13, 0xb5, 0x9c, 0x8c,
+    0xff, 0xab, 0x8f, 0x7d, 0xff, 0xab, 0x91, 0x7e, 0xfc, 0x8c, 0x01, 0x04, 0x04, 0x00, 0x02, 0x10,
+    0x03, 0x06, 0x9c, 0x01, 0x31, 0xa1, 0x87, 0x76, 0x30, 0x09, 0x31, 0x70, 0x63, 0x4f, 0x84, 0x01,
+    0x31, 0x6c, 0x60, 0x4b, 0x10, 0x03, 0x21, 0x6e, 0x60, 0xa8, 0x04, 0x10, 0xfb, 0x08, 0x00, 0xf3,
+    0x05, 0x6f, 0x62, 0x51, 0xff, 0x74, 0x68, 0x5d, 0xff, 0x80, 0x77, 0x73, 0xff, 0x8f, 0x88, 0x88,
+    0xff, 0xcd, 0xcd, 0xcd, 0x29, 0x64, 0x1f, 0x01, 0x6c, 0x0d, 0x00, 0x9c, 0x05, 0x31, 0xae, 0x9d,
+    0x90, 0xf0, 0x0a, 0x32, 0x94, 0x7d, 0x6b, 0x90, 0x01, 0x00, 0x04, 0x00, 0xfc, 0x00, 0x80, 0x6e,
+    0xff, 0x86, 0x72, 0x62, 0xff, 0x7d, 0x6f, 0x67, 0xff, 0xa9, 0xa3, 0xa3, 0xb2, 0x08, 0x0d, 0x00,
+    0xc0, 0x0e, 0xb1, 0xd0, 0xcb, 0xc6, 0x36, 0x98, 0x8d, 0x81, 0xff, 0x83, 0x75, 0x66, 0xb0, 0x09,
+    0x31, 0x75, 0x65, 0x53, 0x04, 0x00, 0x70, 0x77, 0x67, 0x55, 0xfb, 0x7a, 0x6a, 0x57, 0xb8, 0x0a,
+    0x01, 0x48, 0x09, 0x00, 0x80, 0x01, 0x00, 0x98, 0x01, 0x0f, 0x90, 0x01, 0x0f, 0xe0, 0x59, 0xff,
+    0x71, 0x60, 0x52, 0xff, 0x76, 0x6a, 0x68, 0xff, 0xab, 0xa6, 0xa9, 0x9d, 0x68, 0x00, 0x0f, 0x01,
+    0x00, 0x69, 0x72, 0xec, 0xe6, 0xdf, 0x28, 0xb5, 0x9d, 0x8d, 0x94, 0x04, 0x03, 0x84, 0x01, 0x0c,
+    0x04, 0x00, 0x00, 0x38, 0x03, 0x00, 0x90, 0x01, 0x40, 0x9c, 0x84, 0x72, 0xff, 0x1c, 0x1d, 0x00,
+    0x88, 0x04, 0x31, 0x6a, 0x5f, 0x4a, 0x90, 0x01, 0x00, 0x14, 0x03, 0xf0, 0x09, 0x70, 0x61, 0x4d,
+    0xff, 0x6e, 0x5f, 0x4a, 0xfb, 0x6d, 0x5e, 0x4d, 0xff, 0x70, 0x65, 0x5d, 0xff, 0x84, 0x7c, 0x7a,
+    0xff, 0xbd, 0xba, 0xb7, 0x55, 0x84, 0x01, 0x3d, 0xe8, 0xe8, 0xe8, 0x64, 0x20, 0x00, 0x98, 0x01,
+    0x31, 0xb2, 0xa1, 0x94, 0x40, 0x06, 0x00, 0xf0, 0x18, 0x00, 0x90, 0x01, 0x02, 0x04, 0x00, 0xef,
+    0x6c, 0xff, 0x87, 0x74, 0x64, 0xff, 0x86, 0x78, 0x70, 0xff, 0xf2, 0xe4, 0xe4, 0x13, 0x39, 0x07,
+    0x05, 0x00, 0xd8, 0x0d, 0x00, 0x58, 0x00, 0x71, 0xbb, 0xb2, 0xa8, 0x4f, 0x85, 0x76, 0x66, 0x30,
+    0x05, 0x30, 0x78, 0x67, 0x54, 0x94, 0x07, 0x10, 0xfb, 0x0c, 0x06, 0x00, 0x90, 0x01, 0x00, 0x20,
+    0x06, 0x22, 0x81, 0x6e, 0x88, 0x01, 0x04, 0x04, 0x00, 0x00, 0x88, 0x01, 0x04, 0x04, 0x00, 0x00,
+    0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x14, 0x0e, 0xcf, 0x74, 0x63, 0x54, 0xff, 0x86, 0x7b, 0x75,
+    0xff, 0xed, 0xed, 0xed, 0x0e, 0x73, 0x00, 0x04, 0x0f, 0x01, 0x00, 0x56, 0xb5, 0xff, 0xff, 0xfe,
+    0x0d, 0xb4, 0x9e, 0x8e, 0xff, 0xa7, 0x8d, 0x7a, 0x0c, 0x03, 0x00, 0x04, 0x00, 0x04, 0x0c, 0x00,
+    0x00, 0x8c, 0x01, 0x00, 0x08, 0x00, 0x31, 0x99, 0x83, 0x70, 0xec, 0x19, 0x00, 0xe0, 0x08, 0x00,
+    0x28, 0x06, 0xf0, 0x0d, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x5f, 0x4b, 0xfb,
+    0x6b, 0x5d, 0x4c, 0xff, 0x6f, 0x63, 0x57, 0xff, 0x7f, 0x76, 0x71, 0xff, 0xb7, 0xb3, 0xb3, 0x40,
+    0xc4, 0x09, 0x00, 0x04, 0x03, 0x00, 0x60, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x90, 0x01, 0x72,
+    0xb0, 0x9e, 0x92, 0xff, 0x98, 0x82, 0x71, 0x90, 0x01, 0x00, 0x28, 0x1c, 0x21, 0x7e, 0x6c, 0xa0,
+    0x0f, 0x70, 0x8a, 0x76, 0x67, 0xff, 0x88, 0x7a, 0x72, 0xac, 0x1d, 0x1f, 0x03, 0xca, 0x08, 0x11,
+    0xf0, 0x04, 0xe3, 0xe3, 0xe3, 0x09, 0xb8, 0xae, 0xa5, 0x5e, 0x8b, 0x7c, 0x6c, 0xff, 0x77, 0x64,
+    0x51, 0xff, 0x7b, 0x69, 0x56, 0x70, 0x01, 0x01, 0xec, 0x0d, 0x0f, 0x90, 0x01, 0x01, 0x00, 0xa8,
+    0x01, 0x04, 0x04, 0x00, 0x00, 0x90, 0x01, 0x00, 0x50, 0x03, 0x80, 0x77, 0x66, 0x53, 0xff, 0x8d,
+    0x80, 0x72, 0xff, 0x40, 0x02, 0x00, 0x54, 0x00, 0x0f, 0x01, 0x00, 0x22, 0x0f, 0xab, 0x00, 0x0f,
+    0x0f, 0x01, 0x00, 0x0e, 0x00, 0xb8, 0x06, 0x71, 0xca, 0xb8, 0xad, 0x9e, 0xac, 0x93, 0x82, 0x90,
+    0x01, 0x00, 0x78, 0x01, 0x00, 0x04, 0x00, 0x01, 0x8c, 0x01, 0x40, 0x8e, 0x7c, 0xff, 0xab, 0xd4,
+    0x07, 0x00, 0x8c, 0x01, 0x61, 0x82, 0x6f, 0xff, 0x7e, 0x6e, 0x5a, 0x98, 0x04, 0x00, 0xe4, 0x08,
+    0x00, 0x88, 0x01, 0x00, 0x54, 0x07, 0xf0, 0x05, 0x6e, 0x60, 0x4b, 0xf7, 0x6c, 0x5f, 0x4f, 0xff,
+    0x75, 0x6b, 0x63, 0xff, 0x8b, 0x85, 0x85, 0xff, 0xc3, 0xbf, 0xc3, 0x44, 0x58, 0x00, 0x0f, 0x01,
+    0x00, 0x0d, 0x01, 0x90, 0x01, 0x17, 0x9f, 0x90, 0x01, 0x10, 0x7f, 0xf4, 0x23, 0x03, 0x90, 0x01,
+    0x60, 0x77, 0x68, 0xff, 0x8a, 0x7c, 0x74, 0x90, 0x01, 0x01, 0xdc, 0x04, 0x0f, 0x01, 0x00, 0x15,
+    0x72, 0xc0, 0xb8, 0xb0, 0x61, 0x90, 0x83, 0x73, 0x68, 0x01, 0x70, 0x6b, 0x58, 0xff, 0x81, 0x6f,
+    0x5e, 0xf7, 0xb0, 0x04, 0x00, 0x44, 0x06, 0x00, 0x08, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x1c, 0x00,
+    0x04, 0x04, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x50, 0x03, 0xb0, 0x78, 0x67, 0x53,
+    0xff, 0x83, 0x73, 0x61, 0xff, 0xaa, 0xa0, 0x95, 0x24, 0x05, 0x02, 0x5a, 0x01, 0x02, 0x06, 0x00,
+    0x0f, 0x01, 0x00, 0x5a, 0x00, 0x14, 0x11, 0x31, 0xae, 0x96, 0x85, 0xec, 0x0d, 0x40, 0xa8, 0x8e,
+    0x7c, 0xfc, 0x88, 0x01, 0x04, 0x04, 0x00, 0x04, 0x8c, 0x01, 0x00, 0xe0, 0x0d, 0x31, 0x7e, 0x6e,
+    0x5b, 0x9c, 0x04, 0x20, 0x6c, 0x5f, 0x38, 0x09, 0x11, 0x4e, 0x8c, 0x0a, 0xff, 0x01, 0x6f, 0x60,
+    0x4c, 0xf4, 0x6e, 0x60, 0x52, 0xff, 0x78, 0x6f, 0x6c, 0xff, 0xa8, 0xa4, 0xa6, 0x89, 0x5c, 0x02,
+    0x01, 0x0f, 0xd3, 0x00, 0x05, 0x00, 0x6c, 0x01, 0x02, 0x90, 0x01, 0x04, 0xb0, 0x04, 0x0a, 0x90,
+    0x01, 0x3f, 0x8b, 0x7c, 0x75, 0x90, 0x01, 0x0f, 0x0f, 0x5d, 0x00, 0x00, 0xa2, 0xee, 0xe6, 0xe6,
+    0x1e, 0x9f, 0x91, 0x83, 0xc1, 0x82, 0x70, 0x80, 0x01, 0x00, 0xa4, 0x0f, 0x31, 0x85, 0x74, 0x61,
+    0x60, 0x1f, 0x00, 0x98, 0x01, 0x04, 0x20, 0x03, 0x00, 0x88, 0x01, 0x08, 0x04, 0x00, 0x00, 0xe8,
+    0x04, 0x80, 0x77, 0x66, 0x52, 0xff, 0x81, 0x71, 0x5f, 0xff, 0x08, 0x05, 0x00, 0x4c, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0xb4, 0x02, 0xf0, 0x05, 0xd6, 0xd2, 0xcb, 0x44, 0xa5, 0x9c, 0x90, 0x7c, 0x99,
+    0x8d, 0x80, 0x70, 0x91, 0x83, 0x74, 0x86, 0xe0, 0xd8, 0xd8, 0x21, 0x1c, 0x00, 0x0f, 0x01, 0x00,
+    0x19, 0x00, 0x40, 0x09, 0x00, 0xcc, 0x14, 0x00, 0x0c, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x5c,
+    0x16, 0x40, 0xb9, 0xa7, 0x97, 0xb0, 0x44, 0x0c, 0x00, 0xac, 0x15, 0x00, 0x84, 0x01, 0x04, 0x04,
+    0x00, 0x00, 0x24, 0x03, 0x00, 0x8c, 0x01, 0x00, 0x7c, 0x12, 0x00, 0xf8, 0x03, 0x08, 0x18, 0x03,
+    0x20, 0x71, 0x63, 0xb8, 0x07, 0xe0, 0x4d, 0xf4, 0x6b, 0x5e, 0x53, 0xff, 0x83, 0x7b, 0x7a, 0xff,
+    0xbe, 0xbb, 0xbe, 0x4f, 0x50, 0x00, 0x0f, 0x01, 0x00, 0x19, 0x00, 0x6c, 0x01, 0x31, 0xaf, 0x9f,
+    0x91, 0xd0, 0x07, 0x10, 0x95, 0x64, 0x22, 0x00, 0x3c, 0x1f, 0x00, 0x8c, 0x1a, 0x22, 0x7d, 0x6b,
+    0x90, 0x01, 0x1f, 0x7d, 0x90, 0x01, 0x10, 0x0f, 0x01, 0x00, 0x04, 0x00, 0xe0, 0x02, 0x90, 0xb2,
+    0xa6, 0x9b, 0x70, 0x8e, 0x7d, 0x6c, 0xff, 0x81, 0xc8, 0x0f, 0x40, 0x73, 0x61, 0xf7, 0x89, 0x68,
+    0x1f, 0x20, 0x77, 0x64, 0x0c, 0x00, 0x01, 0x94, 0x01, 0x00, 0x84, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0x1c, 0x03, 0x04, 0x04, 0x00, 0x00, 0x90, 0x01, 0xf0, 0x21, 0x77, 0x67, 0x54, 0xfb, 0x9c, 0x90,
+    0x82, 0xac, 0xb7, 0xad, 0xa5, 0x80, 0xb9, 0xaf, 0xa7, 0x80, 0xae, 0xa6, 0x9b, 0x78, 0xa0, 0x96,
+    0x89, 0x9b, 0x8c, 0x7f, 0x70, 0xff, 0x7d, 0x6e, 0x5d, 0xff, 0x73, 0x63, 0x50, 0xff, 0x70, 0x60,
+    0x4c, 0xff, 0x8d, 0x81, 0x72, 0xff, 0xf1, 0xf1, 0xf1, 0x12, 0x70, 0x00, 0x0f, 0x01, 0x00, 0x11,
+    0xf0, 0x01, 0xf0, 0xe8, 0xe8, 0x22, 0xb3, 0x9d, 0x8f, 0xf3, 0xb5, 0xa0, 0x92, 0xe8, 0xdb, 0xd1,
+    0xc9, 0x64, 0x98, 0x01, 0x00, 0xa8, 0x00, 0x00, 0xec, 0x01, 0x00, 0x20, 0x00, 0x00, 0xec, 0x00,
+    0x42, 0xc6, 0xb7, 0xab, 0x94, 0xa4, 0x15, 0x10, 0x78, 0x80, 0x01, 0x0d, 0x1c, 0x03, 0x71, 0x9f,
+    0x87, 0x74, 0xff, 0x84, 0x73, 0x5f, 0x28, 0x06, 0x31, 0x6b, 0x5e, 0x4b, 0xa0, 0x04, 0x20, 0x70,
+    0x63, 0xd0, 0x0d, 0xe0, 0x4b, 0xf4, 0x6c, 0x60, 0x55, 0xff, 0x84, 0x7c, 0x7d, 0xff, 0xbf, 0xbc,
+    0xc2, 0x54, 0x50, 0x00, 0x00, 0x01, 0x00, 0x0f, 0xaf, 0x02, 0x00, 0x0e, 0x01, 0x00, 0x03, 0x25,
+    0x00, 0x00, 0x80, 0x00, 0x02, 0x90, 0x01, 0x40, 0x6f, 0xff, 0x93, 0x7c, 0x90, 0x01, 0x03, 0x68,
+    0x17, 0x8f, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x68, 0xff, 0x8c, 0x90, 0x01, 0x28, 0x01, 0x01, 0x00,
+    0xe0, 0x01, 0x00, 0x00, 0xb6, 0xab, 0xa1, 0x77, 0x90, 0x7e, 0x6d, 0xff, 0x85, 0x72, 0x5f, 0x50,
+    0x11, 0x10, 0xf7, 0x80, 0x0e, 0x31, 0x8b, 0x77, 0x66, 0x30, 0x0d, 0x00, 0xbc, 0x0e, 0x00, 0x84,
+    0x01, 0x22, 0x7d, 0x6d, 0x8c, 0x01, 0x30, 0x7d, 0x6b, 0x58, 0xc0, 0x0c, 0x01, 0xa0, 0x09, 0x00,
+    0x30, 0x11, 0xf0, 0x18, 0x83, 0x74, 0x63, 0xff, 0x83, 0x75, 0x64, 0xff, 0x7a, 0x6b, 0x59, 0xff,
+    0x73, 0x62, 0x50, 0xff, 0x6f, 0x5f, 0x4c, 0xf7, 0x76, 0x66, 0x54, 0xe6, 0x77, 0x67, 0x56, 0xe8,
+    0x74, 0x65, 0x52, 0xe6, 0x77, 0x69, 0x57, 0xff, 0x9a, 0x90, 0x82, 0xa4, 0x00, 0x0f, 0x6c, 0x26,
+    0x0a, 0x00, 0x01, 0x00, 0xb1, 0xff, 0xf0, 0xf0, 0x11, 0xad, 0x96, 0x86, 0xff, 0xa1, 0x87, 0x75,
+    0xd0, 0x10, 0xf1, 0x0c, 0xaa, 0x91, 0x80, 0xff, 0xa9, 0x8f, 0x80, 0xe2, 0xa9, 0x92, 0x7f, 0xcd,
+    0xb5, 0x9f, 0x90, 0xcf, 0xc8, 0xb7, 0xae, 0xad, 0xc0, 0xae, 0xa0, 0xd5, 0xaf, 0x98, 0x87, 0x34,
+    0x17, 0x40, 0xa6, 0x8c, 0x7b, 0xf9, 0x84, 0x01, 0x00, 0x78, 0x0f, 0x00, 0x2c, 0x03, 0x00, 0x0c,
+    0x00, 0x71, 0xa4, 0x8a, 0x78, 0xff, 0x8a, 0x77, 0x63, 0xe4, 0x0d, 0x24, 0x6a, 0x5e, 0x18, 0x03,
+    0x00, 0x30, 0x06, 0xe0, 0x4d, 0xf4, 0x6a, 0x5e, 0x53, 0xff, 0x85, 0x7e, 0x7e, 0xff, 0xc4, 0xc1,
+    0xc7, 0x4e, 0x70, 0x00, 0x0f, 0x01, 0x00, 0x21, 0x00, 0x6c, 0x01, 0x00, 0xb0, 0x04, 0x00, 0x20,
+    0x03, 0x00, 0x84, 0x01, 0x31, 0x93, 0x7e, 0x6b, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0xd0, 0x07,
+    0x30, 0x8c, 0x7e, 0x76, 0xec, 0x00, 0x09, 0x90, 0x01, 0x03, 0xcb, 0x01, 0x0f, 0x01, 0x00, 0x1a,
+    0x71, 0xb4, 0xa9, 0x9c, 0x77, 0x93, 0x81, 0x70, 0xe4, 0x12, 0x41, 0x8d, 0x79, 0x68, 0xf7, 0x24,
+    0x16, 0x21, 0x79, 0x67, 0xd4, 0x11, 0x22, 0x7e, 0x6d, 0x44, 0x14, 0x00, 0x90, 0x01, 0x00, 0xd4,
+    0x07, 0x70, 0x7c, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0x24, 0x03, 0x20, 0xff, 0x74, 0x6c, 0x0e,
+    0xe1, 0x62, 0x4f, 0xff, 0x72, 0x61, 0x4f, 0xff, 0x72, 0x62, 0x50, 0xff, 0x74, 0x64, 0x52, 0x54,
+    0x0b, 0x31, 0x75, 0x66, 0x54, 0x0c, 0x12, 0x00, 0xe0, 0x0e, 0x75, 0x84, 0x77, 0x67, 0xff, 0xeb,
+    0xeb, 0xe0, 0x04, 0x17, 0x0f, 0x01, 0x00, 0x05, 0xb0, 0xdc, 0xd3, 0xcd, 0x51, 0xa8, 0x8f, 0x7e,
+    0xff, 0xa0, 0x85, 0x72, 0xec, 0x13, 0x10, 0xf9, 0xc4, 0x1b, 0x00, 0x74, 0x15, 0x00, 0x18, 0x17,
+    0x00, 0xd8, 0x0d, 0x91, 0xac, 0x93, 0x83, 0xff, 0xab, 0x92, 0x81, 0xff, 0xa7, 0x80, 0x12, 0x20,
+    0x7c, 0xf9, 0xb4, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x70, 0x0f, 0x10, 0xa7, 0x10, 0x11, 0x21, 0x8c,
+    0x7b, 0xec, 0x0d, 0x00, 0x78, 0x00, 0x00, 0xf0, 0x10, 0x00, 0x94, 0x01, 0x30, 0x71, 0x64, 0x4f,
+    0x30, 0x06, 0xd0, 0xf8, 0x6c, 0x5f, 0x53, 0xff, 0x82, 0x7b, 0x7a, 0xff, 0xc6, 0xc2, 0xc6, 0x50,
+    0x6c, 0x00, 0x0f, 0x01, 0x00, 0x0b, 0x0f, 0x42, 0x01, 0x07, 0x00, 0x6c, 0x01, 0x22, 0xaf, 0x9e,
+    0x20, 0x03, 0x00, 0x84, 0x01, 0x00, 0x30, 0x1f, 0x00, 0xfc, 0x12, 0x7f, 0x92, 0x7b, 0x69, 0xff,
+    0x8a, 0x76, 0x66, 0xb0, 0x04, 0x2a, 0x0c, 0x01, 0x00, 0x80, 0xb7, 0xaa, 0x9f, 0x75, 0x92, 0x7d,
+    0x6d, 0xff, 0xec, 0x1d, 0x00, 0x48, 0x19, 0x00, 0x90, 0x11, 0x00, 0x5c, 0x1c, 0x35, 0x82, 0x71,
+    0x5e, 0x8c, 0x01, 0x10, 0x7b, 0x18, 0x03, 0x03, 0x90, 0x01, 0x91, 0x78, 0x68, 0x57, 0xff, 0x78,
+    0x68, 0x56, 0xff, 0x78, 0x64, 0x0e, 0x73, 0x56, 0xff, 0x77, 0x67, 0x57, 0xff, 0x76, 0x88, 0x01,
+    0x00, 0xa0, 0x11, 0x00, 0x08, 0x00, 0xcf, 0x6d, 0x5e, 0x49, 0xff, 0x75, 0x67, 0x54, 0xff, 0xb8,
+    0xb0, 0xa9, 0x88, 0xa8, 0x00, 0x09, 0x00, 0x2c, 0x26, 0x71, 0xab, 0x95, 0x85, 0xff, 0xa3, 0x89,
+    0x78, 0xe4, 0x02, 0x04, 0x78, 0x15, 0x01, 0x04, 0x00, 0x00, 0xac, 0x18, 0x00, 0xc4, 0x26, 0x22,
+    0x88, 0x76, 0xd8, 0x1b, 0x20, 0x8b, 0x7a, 0x1c, 0x03, 0x02, 0x04, 0x00, 0x01, 0x28, 0x03, 0x02,
+    0x10, 0x00, 0x00, 0x8c, 0x2b, 0x00, 0xe4, 0x0e, 0x00, 0xa4, 0x04, 0x20, 0x6c, 0x61, 0xa4, 0x04,
+    0xf0, 0x03, 0x4f, 0xff, 0x70, 0x62, 0x4c, 0xfc, 0x6c, 0x5f, 0x51, 0xff, 0x79, 0x70, 0x6e, 0xff,
+    0xbf, 0xbc, 0xbc, 0x57, 0x6c, 0x00, 0x0f, 0x01, 0x00, 0x29, 0x00, 0xc4, 0x00, 0x00, 0xb0, 0x04,
+    0x14, 0x96, 0x90, 0x01, 0x03, 0x80, 0x1a, 0x7e, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xd0,
+    0x07, 0x03, 0xdb, 0x01, 0x03, 0x07, 0x00, 0x0f, 0x01, 0x00, 0x1a, 0x00, 0x38, 0x0b, 0xa2, 0xa7,
+    0x96, 0x88, 0xf3, 0x8d, 0x76, 0x64, 0xff, 0x91, 0x7b, 0x78, 0x19, 0x00, 0xac, 0x06, 0x00, 0x34,
+    0x03, 0x00, 0xa8, 0x0c, 0x00, 0x88, 0x01, 0x00, 0x90, 0x01, 0x00, 0xac, 0x04, 0x01, 0x90, 0x01,
+    0x22, 0x69, 0x56, 0x90, 0x01, 0x10, 0x68, 0x8c, 0x01, 0x55, 0x55, 0xff, 0x77, 0x66, 0x55, 0x90,
+    0x01, 0x01, 0x24, 0x03, 0xed, 0x65, 0x53, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x51, 0xff,
+    0x87, 0x7b, 0x6c, 0x00, 0x08, 0x08, 0x01, 0x00, 0x40, 0xef, 0xef, 0xe6, 0x1f, 0x70, 0x23, 0x00,
+    0x04, 0x00, 0x00, 0x94, 0x18, 0x00, 0xfc, 0x21, 0x00, 0x94, 0x04, 0x02, 0x04, 0x00, 0x02, 0xac,
+    0x18, 0x00, 0x88, 0x01, 0x01, 0x0c, 0x00, 0x03, 0xa4, 0x01, 0x00, 0x04, 0x00, 0x01, 0x3c, 0x03,
+    0x21, 0x8d, 0x7b, 0x7c, 0x0f, 0x00, 0xc4, 0x16, 0x31, 0x72, 0x64, 0x52, 0xa0, 0x15, 0x20, 0x70,
+    0x63, 0x78, 0x00, 0x00, 0xd8, 0x13, 0xa0, 0x4c, 0xff, 0x74, 0x6a, 0x65, 0xff, 0xaa, 0xa6, 0xa8,
+    0x87, 0x68, 0x00, 0x0d, 0x01, 0x00, 0x0f, 0x29, 0x01, 0x1c, 0x00, 0x6c, 0x01, 0x31, 0xae, 0x9e,
+    0x91, 0x9c, 0x28, 0x00, 0x94, 0x1d, 0x00, 0x20, 0x03, 0x0a, 0x90, 0x01, 0x0f, 0xf0, 0x0a, 0x1f,
+    0x0f, 0x01, 0x00, 0x09, 0x71, 0xe4, 0xde, 0xd9, 0x2f, 0xa2, 0x8f, 0x7f, 0x60, 0x00, 0x40, 0x94,
+    0x7d, 0x6b, 0xfb, 0x30, 0x1e, 0x00, 0xf8, 0x1a, 0x00, 0x4c, 0x06, 0x33, 0x7d, 0x6b, 0x59, 0x8c,
+    0x01, 0x00, 0x04, 0x00, 0x02, 0x90, 0x01, 0x01, 0x88, 0x01, 0x04, 0x04, 0x00, 0x03, 0x90, 0x01,
+    0x00, 0x1c, 0x03, 0x00, 0x98, 0x16, 0x31, 0x74, 0x65, 0x53, 0x40, 0x18, 0x00, 0x94, 0x01, 0x3f,
+    0x76, 0x69, 0x59, 0x90, 0x01, 0x06, 0x00, 0xc0, 0x00, 0xb1, 0xd3, 0xc7, 0xc1, 0x7b, 0x9d, 0x84,
+    0x72, 0xff, 0x9e, 0x84, 0x72, 0x04, 0x17, 0x00, 0x04, 0x00, 0x00, 0x98, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x74, 0x01, 0x04, 0x04, 0x00, 0x00, 0xa0, 0x01, 0x00, 0xac, 0x01, 0x00, 0x0c, 0x00, 0x04,
+    0x04, 0x00, 0x31, 0xa7, 0x8c, 0x7a, 0xd0, 0x13, 0x00, 0x08, 0x02, 0x01, 0x8c, 0x01, 0x21, 0x62,
+    0x4f, 0x34, 0x06, 0x10, 0x6f, 0x1c, 0x14, 0x60, 0x65, 0x5d, 0xff, 0x92, 0x8c, 0x8f, 0x24, 0x01,
+    0x07, 0xd4, 0x0a, 0x0f, 0x85, 0x01, 0x1c, 0x07, 0x01, 0x00, 0x00, 0xac, 0x00, 0x31, 0xaf, 0x9f,
+    0x92, 0xac, 0x02, 0x00, 0xfc, 0x1b, 0x00, 0x44, 0x04, 0x00, 0x28, 0x03, 0x00, 0xc0, 0x02, 0x6f,
+    0x89, 0x74, 0x66, 0xff, 0x8a, 0x7b, 0x90, 0x01, 0x38, 0x03, 0xa7, 0x00, 0x40, 0xd3, 0xcb, 0xc4,
+    0x45, 0x60, 0x0b, 0x00, 0x34, 0x2c, 0x00, 0x34, 0x1e, 0x00, 0x94, 0x01, 0x00, 0x98, 0x05, 0x00,
+    0x70, 0x09, 0x20, 0x79, 0x69, 0x8c, 0x01, 0x3b, 0x57, 0xff, 0x79, 0x1c, 0x03, 0x00, 0x88, 0x01,
+    0x04, 0x04, 0x00, 0x00, 0x18, 0x01, 0x00, 0x90, 0x01, 0x00, 0xc8, 0x14, 0x10, 0x6f, 0x90, 0x19,
+    0x51, 0x64, 0x53, 0xff, 0x90, 0x87, 0xa8, 0x32, 0x0f, 0xb8, 0x2d, 0x02, 0x00, 0x3c, 0x09, 0x40,
+    0xd2, 0xc6, 0xbd, 0x78, 0x1c, 0x03, 0x31, 0x9d, 0x84, 0x71, 0xa0, 0x1b, 0x00, 0x40, 0x1d, 0x00,
+    0x48, 0x1d, 0x00, 0x6c, 0x20, 0x00, 0x04, 0x00, 0x00, 0x98, 0x01, 0x08, 0x04, 0x00, 0x02, 0x14,
+    0x00, 0x00, 0xb4, 0x23, 0x11, 0x79, 0xec, 0x1e, 0x00, 0x6c, 0x26, 0x31, 0x70, 0x61, 0x4e, 0xdc,
+    0x0a, 0x12, 0x72, 0x34, 0x06, 0xd0, 0xfc, 0x6d, 0x60, 0x52, 0xff, 0x89, 0x81, 0x80, 0xff, 0xdf,
+    0xda, 0xdf, 0x37, 0x68, 0x00, 0x0f, 0x01, 0x00, 0x31, 0x00, 0xac, 0x00, 0x01, 0x90, 0x01, 0x21,
+    0x80, 0x6f, 0x88, 0x1d, 0x02, 0xd8, 0x05, 0x11, 0x69, 0x80, 0x30, 0x52, 0x88, 0x74, 0x66, 0xff,
+    0x89, 0x90, 0x01, 0x01, 0x0c, 0x0a, 0x0f, 0x01, 0x00, 0x05, 0x03, 0x67, 0x01, 0x0f, 0x01, 0x00,
+    0x16, 0x00, 0xb8, 0x04, 0x40, 0xaf, 0xa0, 0x91, 0xfb, 0x58, 0x21, 0x00, 0xb8, 0x14, 0x00, 0x44,
+    0x1e, 0x00, 0x10, 0x1b, 0x00, 0x8c, 0x13, 0x00, 0xb0, 0x04, 0x00, 0x94, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x05, 0x90, 0x01, 0x16, 0x67, 0x90, 0x01, 0x00, 0x64, 0x1f,
+    0x11, 0x71, 0x50, 0x07, 0xa0, 0x57, 0xff, 0x8a, 0x81, 0x7c, 0xff, 0xcf, 0xcb, 0xc8, 0x4f, 0xb8,
+    0x0a, 0x00, 0x60, 0x00, 0x05, 0x01, 0x00, 0x07, 0x0e, 0x00, 0x00, 0x18, 0x1f, 0x40, 0xbe, 0xaf,
+    0xa4, 0x92, 0x80, 0x15, 0x70, 0x99, 0x80, 0x6d, 0xff, 0x9d, 0x85, 0x72, 0x98, 0x01, 0x10, 0xfc,
+    0xb8, 0x1b, 0x05, 0x04, 0x00, 0x01, 0xa4, 0x01, 0x02, 0x04, 0x00, 0x01, 0xb4, 0x01, 0x61, 0x8a,
+    0x77, 0xff, 0xa4, 0x8c, 0x7a, 0x50, 0x07, 0x00, 0x84, 0x00, 0x00, 0x10, 0x14, 0x00, 0xdc, 0x0a,
+    0x11, 0x72, 0x1c, 0x03, 0xa0, 0x4f, 0xff, 0x74, 0x69, 0x65, 0xff, 0xc2, 0xbe, 0xc2, 0x4b, 0x60,
+    0x00, 0x0e, 0x01, 0x00, 0x07, 0x7d, 0x00, 0x0f, 0x01, 0x00, 0x18, 0x74, 0xe8, 0xe0, 0xe0, 0x21,
+    0xa4, 0x91, 0x83, 0xf4, 0x26, 0x01, 0xb4, 0x04, 0x00, 0x04, 0x00, 0x00, 0x90, 0x28, 0xb2, 0x88,
+    0x74, 0x64, 0xff, 0x8d, 0x7c, 0x70, 0xff, 0xd1, 0xc7, 0xc3, 0x00, 0x02, 0x0f, 0x63, 0x00, 0x23,
+    0x0f, 0x01, 0x00, 0x02, 0xb1, 0xe2, 0xdc, 0xdc, 0x2c, 0xa2, 0x8d, 0x7d, 0xff, 0x95, 0x7c, 0x69,
+    0x64, 0x21, 0x00, 0x04, 0x00, 0x00, 0x78, 0x00, 0x00, 0x24, 0x03, 0x00, 0x84, 0x01, 0x04, 0x04,
+    0x00, 0x00, 0x08, 0x01, 0x00, 0x84, 0x01, 0x08, 0x04, 0x00, 0xfd, 0x05, 0x74, 0x64, 0x51, 0xfb,
+    0x6d, 0x5e, 0x50, 0xff, 0x75, 0x69, 0x61, 0xff, 0x98, 0x90, 0x8f, 0xad, 0xe0, 0xda, 0xda, 0x29,
+    0x8c, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x0d, 0xc0, 0xdc, 0xd4, 0xd0, 0x41, 0xb6, 0xa3,
+    0x96, 0xd8, 0xa4, 0x8d, 0x7c, 0xff, 0x08, 0x30, 0x00, 0x30, 0x03, 0x40, 0x9f, 0x87, 0x75, 0xfc,
+    0x80, 0x01, 0x08, 0x04, 0x00, 0x10, 0x9f, 0x90, 0x01, 0x00, 0x9c, 0x01, 0x61, 0x88, 0x77, 0xff,
+    0x88, 0x74, 0x62, 0x80, 0x0f, 0x00, 0x90, 0x01, 0x30, 0x72, 0x64, 0x50, 0x38, 0x17, 0x70, 0xfc,
+    0x72, 0x65, 0x59, 0xff, 0x89, 0x81, 0xa3, 0x21, 0x0f, 0x3c, 0x36, 0x0f, 0x0f, 0x01, 0x00, 0x11,
+    0x40, 0xf0, 0xf0, 0xf0, 0x11, 0x38, 0x04, 0x32, 0xac, 0x9a, 0x8d, 0x1c, 0x03, 0x21, 0x79, 0x68,
+    0x1c, 0x03, 0x00, 0x14, 0x01, 0x31, 0x8f, 0x7b, 0x69, 0xc8, 0x20, 0x00, 0x98, 0x2b, 0x00, 0x04,
+    0x19, 0x52, 0x9c, 0x8b, 0x7d, 0xff, 0xd0, 0xbc, 0x2b, 0x0f, 0xec, 0x21, 0x36, 0x00, 0x74, 0x03,
+    0x71, 0xbe, 0xae, 0xa1, 0xa6, 0x9b, 0x82, 0x70, 0x8c, 0x01, 0x00, 0x04, 0x01, 0x00, 0x24, 0x15,
+    0x00, 0x58, 0x1c, 0x00, 0x84, 0x01, 0x00, 0x04, 0x00, 0x00, 0xe0, 0x1a, 0x00, 0x08, 0x00, 0x00,
+    0x84, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x71, 0x62, 0x51, 0xfb, 0x6a, 0x5d,
+    0x52, 0xff, 0x7b, 0x70, 0x6e, 0xff, 0xa2, 0x9c, 0x9e, 0x11, 0x01, 0x09, 0x78, 0x16, 0x0f, 0x01,
+    0x00, 0x11, 0x00, 0xd8, 0x04, 0x70, 0xc9, 0xb9, 0xb1, 0x7f, 0xa8, 0x91, 0x81, 0x8c, 0x01, 0x50,
+    0xff, 0x9f, 0x87, 0x77, 0xf9, 0x3c, 0x28, 0x00, 0x84, 0x00, 0x04, 0x04, 0x00, 0x13, 0xa1, 0x08,
+    0x00, 0x00, 0x78, 0x0a, 0x00, 0xcc, 0x19, 0x00, 0x2c, 0x14, 0x00, 0x1c, 0x03, 0xf2, 0x00, 0x74,
+    0x65, 0x50, 0xff, 0x6e, 0x60, 0x50, 0xff, 0x79, 0x6e, 0x69, 0xff, 0xcb, 0xc7, 0xc7, 0x94, 0x12,
+    0x0f, 0x0a, 0x02, 0x0e, 0x0f, 0x01, 0x00, 0x0b, 0xb1, 0xd5, 0xd0, 0xca, 0x2b, 0xa3, 0x90, 0x80,
+    0xff, 0x9b, 0x87, 0x76, 0x04, 0x0e, 0x44, 0x91, 0x7c, 0x6a, 0xfb, 0x8c, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0xb8, 0x04, 0x00, 0x90, 0x01, 0x03, 0x04, 0x00, 0x10, 0xf7, 0x68, 0x25, 0xbf, 0x95, 0x82,
+    0x72, 0xff, 0xa3, 0x92, 0x84, 0xff, 0xdc, 0xdc, 0xd3, 0x94, 0x18, 0x17, 0x0f, 0xa8, 0x00, 0x0c,
+    0x71, 0xec, 0xe3, 0xe3, 0x1b, 0xaa, 0x95, 0x85, 0x20, 0x31, 0x00, 0x08, 0x0c, 0x00, 0xd8, 0x08,
+    0x00, 0x48, 0x06, 0x00, 0xac, 0x04, 0x00, 0x88, 0x01, 0x02, 0xe8, 0x0a, 0x00, 0x90, 0x01, 0x00,
+    0x04, 0x00, 0xff, 0x03, 0x54, 0xff, 0x78, 0x69, 0x53, 0xff, 0x69, 0x5b, 0x4f, 0xf4, 0x6c, 0x63,
+    0x65, 0xff, 0xa5, 0x9f, 0xa5, 0x85, 0x14, 0x03, 0x11, 0x0f, 0x01, 0x00, 0x05, 0x00, 0xc8, 0x01,
+    0xf4, 0x01, 0xf4, 0xf4, 0xf4, 0x17, 0xc4, 0xb5, 0xac, 0x79, 0xa6, 0x8f, 0x7f, 0xff, 0x9c, 0x84,
+    0x73, 0xf9, 0x18, 0x02, 0x00, 0xa4, 0x01, 0x00, 0x1c, 0x03, 0x00, 0x08, 0x00, 0x00, 0x0c, 0x2b,
+    0x00, 0x28, 0x05, 0x00, 0xf8, 0x0d, 0x00, 0x38, 0x06, 0x10, 0x73, 0xac, 0x04, 0x9a, 0x62, 0x56,
+    0xff, 0x88, 0x81, 0x82, 0xff, 0xff, 0xed, 0xa8, 0x2e, 0x0f, 0x01, 0x00, 0x1d, 0x00, 0x34, 0x0d,
+    0x40, 0xba, 0xab, 0x9e, 0x8c, 0xb8, 0x05, 0x30, 0x8f, 0x77, 0x64, 0xc4, 0x39, 0x11, 0xf3, 0x88,
+    0x01, 0x00, 0xf0, 0x26, 0x00, 0x98, 0x01, 0x21, 0x7b, 0x68, 0xb4, 0x04, 0x04, 0x90, 0x01, 0x00,
+    0x84, 0x28, 0x00, 0x08, 0x00, 0xf0, 0x09, 0x8c, 0x77, 0x65, 0xfb, 0x85, 0x6f, 0x5d, 0xf7, 0x88,
+    0x72, 0x5f, 0xff, 0x92, 0x7e, 0x6d, 0xff, 0xbc, 0xb1, 0xa5, 0x5b, 0xf2, 0xe6, 0xe6, 0x14, 0x54,
+    0x00, 0x0f, 0x01, 0x00, 0x29, 0x00, 0x50, 0x01, 0x71, 0xc9, 0xbb, 0xaf, 0x6d, 0x9f, 0x85, 0x73,
+    0x18, 0x0c, 0x00, 0x94, 0x0d, 0x00, 0x48, 0x06, 0x00, 0x74, 0x14, 0x04, 0xac, 0x04, 0x00, 0x04,
+    0x00, 0x04, 0x90, 0x01, 0xc0, 0x77, 0x68, 0x53, 0xf7, 0x6d, 0x5f, 0x54, 0xff, 0x90, 0x89, 0x8b,
+    0x8a, 0x60, 0x03, 0x00, 0x44, 0x00, 0x0f, 0x01, 0x00, 0x2d, 0x70, 0xde, 0xd3, 0xcb, 0x45, 0xa7,
+    0x91, 0x81, 0x9c, 0x03, 0x10, 0xf3, 0x60, 0x0c, 0x10, 0x9f, 0xe8, 0x2c, 0x00, 0x88, 0x2e, 0x00,
+    0xb0, 0x03, 0x21, 0x85, 0x73, 0x48, 0x17, 0x00, 0x18, 0x11, 0x60, 0x71, 0x63, 0x4f, 0xff, 0x73,
+    0x65, 0xb4, 0x06, 0x90, 0x4e, 0xff, 0x72, 0x66, 0x5f, 0xff, 0xa8, 0xa3, 0xa7, 0x68, 0x21, 0x1f,
+    0x09, 0x74, 0x02, 0x0d, 0x0f, 0x01, 0x00, 0x05, 0xf0, 0x05, 0xed, 0xe5, 0xe5, 0x1d, 0xa7, 0x96,
+    0x87, 0xff, 0x8c, 0x77, 0x64, 0xff, 0x86, 0x71, 0x5e, 0xf7, 0x90, 0x79, 0x67, 0xf7, 0xa4, 0x12,
+    0x00, 0xa0, 0x0d, 0x00, 0x90, 0x01, 0x02, 0x58, 0x09, 0x00, 0xcc, 0x2e, 0x02, 0x1c, 0x2a, 0x00,
+    0xc0, 0x04, 0x00, 0x18, 0x03, 0x00, 0xf0, 0x26, 0x11, 0x8c, 0xd4, 0x23, 0xa0, 0x66, 0xff, 0x89,
+    0x76, 0x62, 0xef, 0x7f, 0x6b, 0x57, 0xfb, 0xc4, 0x2e, 0x80, 0xa2, 0x94, 0x86, 0xff, 0xea, 0xea,
+    0xea, 0x18, 0x5c, 0x00, 0x0f, 0x01, 0x00, 0x21, 0x04, 0xc7, 0x00, 0xa0, 0xeb, 0xe0, 0xd6, 0x19,
+    0xa3, 0x8a, 0x77, 0xff, 0xa5, 0x8a, 0x2c, 0x12, 0x11, 0x7e, 0x98, 0x02, 0x00, 0xd8, 0x25, 0x22,
+    0x7a, 0x69, 0xfc, 0x0d, 0x04, 0xe4, 0x0a, 0x20, 0x76, 0x65, 0xb0, 0x04, 0x92, 0x53, 0xf0, 0x75,
+    0x67, 0x59, 0xff, 0xbe, 0xb9, 0xb5, 0xd0, 0x06, 0x04, 0x01, 0x00, 0x04, 0x4d, 0x00, 0x0f, 0x01,
+    0x00, 0x20, 0x70, 0xd1, 0xc3, 0xb9, 0x4d, 0x9f, 0x89, 0x76, 0xec, 0x0d, 0x10, 0xf3, 0x88, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x2c, 0x14, 0x00, 0x1c, 0x03, 0x00, 0xac, 0x04, 0x00, 0xec, 0x09, 0x02,
+    0x54, 0x09, 0x11, 0x50, 0x5c, 0x0b, 0x60, 0x6e, 0x60, 0x51, 0xff, 0x82, 0x78, 0xd8, 0x1f, 0x1f,
+    0xe0, 0xd8, 0x1f, 0x26, 0x00, 0xc8, 0x01, 0x70, 0xad, 0x9a, 0x8b, 0xe9, 0x87, 0x72, 0x5e, 0x60,
+    0x0e, 0x50, 0xe2, 0x86, 0x76, 0x65, 0xff, 0xbc, 0x31, 0x00, 0xc0, 0x2e, 0x00, 0x78, 0x01, 0x71,
+    0x8f, 0x79, 0x67, 0xfb, 0x8b, 0x75, 0x63, 0x58, 0x33, 0x31, 0x88, 0x74, 0x61, 0x08, 0x00, 0x70,
+    0x89, 0x72, 0x60, 0xff, 0x8a, 0x75, 0x65, 0x1c, 0x03, 0x50, 0xff, 0x8b, 0x77, 0x64, 0xf7, 0xd8,
+    0x05, 0xc0, 0x82, 0x72, 0x61, 0xff, 0x79, 0x6b, 0x58, 0xff, 0x7a, 0x69, 0x56, 0xde, 0xb4, 0x15,
+    0x4f, 0xaa, 0x9d, 0x90, 0xb6, 0xa8, 0x02, 0x0e, 0x0f, 0x2c, 0x01, 0x0c, 0x00, 0xec, 0x1a, 0x00,
+    0xd8, 0x16, 0x00, 0x8c, 0x10, 0x00, 0x68, 0x1b, 0x00, 0x40, 0x15, 0x00, 0x9c, 0x1c, 0x31, 0x7a,
+    0x69, 0x58, 0x60, 0x0c, 0x02, 0x20, 0x03, 0x11, 0x54, 0xfc, 0x0d, 0xc0, 0x76, 0x66, 0x53, 0xf7,
+    0x71, 0x62, 0x52, 0xff, 0xa2, 0x9b, 0x92, 0x91, 0x9c, 0x07, 0x00, 0x40, 0x00, 0x0f, 0x01, 0x00,
+    0x2d, 0x70, 0xc9, 0xbf, 0xb5, 0x4c, 0x99, 0x81, 0x6e, 0xb4, 0x29, 0x10, 0xf3, 0x50, 0x2b, 0x00,
+    0x24, 0x03, 0x00, 0x90, 0x01, 0x00, 0x58, 0x2b, 0x00, 0xb0, 0x26, 0x00, 0xc4, 0x06, 0x00, 0xc8,
+    0x07, 0x10, 0x74, 0x90, 0x01, 0xcd, 0x63, 0x50, 0xff, 0x6d, 0x60, 0x56, 0xff, 0x9e, 0x98, 0x97,
+    0xc6, 0xfe, 0x5c, 0x0b, 0x0f, 0xe9, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x00, 0x3c, 0x0c, 0x40, 0xc0,
+    0xb0, 0xa4, 0x95, 0x00, 0x11, 0xf1, 0x0c, 0x78, 0x66, 0x52, 0xf4, 0x78, 0x6c, 0x5a, 0xff, 0x9d,
+    0x94, 0x88, 0xd9, 0xac, 0xa2, 0x96, 0xcc, 0x9d, 0x8b, 0x7c, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x86,
+    0x70, 0x5d, 0x6c, 0x1c, 0x00, 0xe4, 0x16, 0xb1, 0x82, 0x72, 0x60, 0xff, 0x87, 0x75, 0x64, 0xff,
+    0x8b, 0x78, 0x68, 0x94, 0x28, 0x50, 0x87, 0x72, 0x5f, 0xff, 0x86, 0x08, 0x14, 0xff, 0x0b, 0x7a,
+    0x6d, 0xff, 0x87, 0x7c, 0x73, 0xeb, 0x84, 0x7b, 0x6c, 0xce, 0x7b, 0x6c, 0x5b, 0xfb, 0x7b, 0x67,
+    0x54, 0xf7, 0x8b, 0x78, 0x67, 0xff, 0xcc, 0xc5, 0xbe, 0xf0, 0x09, 0x04, 0x0f, 0x01, 0x00, 0x17,
+    0x40, 0xd9, 0xcc, 0xc3, 0x3c, 0x60, 0x26, 0x00, 0xe8, 0x19, 0x31, 0xb0, 0x95, 0x83, 0xf0, 0x0b,
+    0x00, 0xac, 0x0f, 0x50, 0x73, 0x63, 0x51, 0xff, 0x77, 0x1c, 0x03, 0x12, 0x67, 0xe4, 0x0a, 0x20,
+    0x76, 0x67, 0xb0, 0x12, 0xa0, 0x4a, 0xfb, 0x8c, 0x82, 0x78, 0xff, 0xe6, 0xe6, 0xe6, 0x1f, 0x3c,
+    0x00, 0x0f, 0x01, 0x00, 0x29, 0x00, 0x44, 0x06, 0x70, 0xbf, 0xb0, 0xa4, 0x78, 0x95, 0x7d, 0x69,
+    0x80, 0x01, 0x41, 0xf6, 0x9b, 0x84, 0x71, 0xbc, 0x29, 0x00, 0xa8, 0x04, 0x31, 0x98, 0x82, 0x6f,
+    0xf0, 0x35, 0x00, 0x68, 0x26, 0x31, 0x6f, 0x62, 0x4f, 0x90, 0x01, 0x00, 0x4c, 0x13, 0x80, 0x72,
+    0x68, 0x63, 0xff, 0xd6, 0xd1, 0xd6, 0x32, 0x40, 0x00, 0x0f, 0x83, 0x01, 0x14, 0x09, 0x01, 0x00,
+    0xf0, 0x05, 0xda, 0xd2, 0xca, 0x3e, 0x9c, 0x86, 0x75, 0xff, 0x8d, 0x75, 0x62, 0xff, 0x7c, 0x6d,
+    0x59, 0xff, 0x8a, 0x82, 0x71, 0xd5, 0xa4, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x28, 0x19, 0xf0, 0x1d,
+    0x9c, 0x8d, 0x7e, 0xff, 0x92, 0x85, 0x75, 0xff, 0x9a, 0x8f, 0x82, 0xe8, 0xa3, 0x9a, 0x92, 0xaf,
+    0xa2, 0x98, 0x90, 0xb5, 0xaa, 0xa0, 0x98, 0xb4, 0xb1, 0xa6, 0x9b, 0xae, 0xa5, 0x96, 0x87, 0xe6,
+    0x94, 0x81, 0x71, 0xff, 0x94, 0x85, 0x79, 0xff, 0xa8, 0xa0, 0x9b, 0xb3, 0xc0, 0x00, 0x00, 0xf4,
+    0x05, 0x71, 0x9c, 0x8d, 0x7f, 0xcb, 0x82, 0x70, 0x5c, 0x20, 0x38, 0x80, 0x92, 0x83, 0x73, 0xff,
+    0xe1, 0xe1, 0xda, 0x22, 0x50, 0x00, 0x0f, 0xa1, 0x00, 0x22, 0x70, 0x00, 0x00, 0x00, 0xea, 0xea,
+    0xdf, 0x18, 0xb0, 0x2c, 0x71, 0xaa, 0x8d, 0x7b, 0xff, 0xb3, 0x96, 0x84, 0x24, 0x0f, 0x00, 0xf8,
+    0x25, 0x20, 0x75, 0x65, 0xa8, 0x04, 0x02, 0xa8, 0x12, 0x00, 0x04, 0x00, 0x00, 0x98, 0x01, 0xc0,
+    0x6f, 0x5f, 0x4b, 0xf7, 0x81, 0x75, 0x68, 0xff, 0xcd, 0xc9, 0xc9, 0x3d, 0x3c, 0x00, 0x0f, 0x01,
+    0x00, 0x29, 0xf0, 0x01, 0xff, 0xff, 0xf5, 0x19, 0xae, 0x9d, 0x8e, 0xed, 0x93, 0x7a, 0x67, 0xff,
+    0x9b, 0x83, 0x71, 0xfc, 0x60, 0x1a, 0x04, 0x90, 0x01, 0x00, 0x78, 0x18, 0x00, 0x84, 0x00, 0x32,
+    0x74, 0x66, 0x51, 0x3c, 0x06, 0x21, 0x64, 0x4f, 0x2c, 0x11, 0x80, 0x7c, 0x73, 0x70, 0xff, 0xdf,
+    0xdf, 0xdf, 0x20, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x1d, 0x72, 0xe9, 0xe2, 0xdb, 0x23, 0xa3, 0x8f,
+    0x80, 0x44, 0x09, 0xb8, 0x7a, 0x69, 0xf8, 0x85, 0x71, 0x5f, 0xff, 0x9b, 0x8f, 0x82, 0xdd, 0x64,
+    0x04, 0x70, 0xf3, 0xf3, 0xf3, 0x15, 0xc6, 0xc2, 0xbc, 0x41, 0x3b, 0x10, 0x0d, 0x10, 0x00, 0x00,
+    0x70, 0x01, 0x00, 0x04, 0x00, 0x03, 0x0c, 0x00, 0x97, 0x0a, 0xc7, 0xbf, 0xb6, 0x77, 0xdc, 0xd8,
+    0xd4, 0x3b, 0x14, 0x00, 0xd1, 0x02, 0xa8, 0x99, 0x8c, 0xdf, 0x84, 0x71, 0x5e, 0xff, 0x7e, 0x6b,
+    0x59, 0xf3, 0xb8, 0x04, 0x3f, 0x9e, 0x93, 0xcb, 0x40, 0x04, 0x19, 0x01, 0x49, 0x00, 0x07, 0x01,
+    0x00, 0x00, 0x68, 0x08, 0xf1, 0x00, 0xb6, 0x9c, 0x8c, 0xff, 0xac, 0x8d, 0x7b, 0xff, 0xb5, 0x97,
+    0x86, 0xff, 0xab, 0x8f, 0x7e, 0x54, 0x08, 0x01, 0xb4, 0x04, 0x10, 0x64, 0x18, 0x11, 0x11, 0x52,
+    0x90, 0x01, 0x00, 0xd4, 0x15, 0x00, 0x1c, 0x11, 0xc0, 0x75, 0x67, 0x55, 0xff, 0x94, 0x8a, 0x80,
+    0xff, 0xd7, 0xd7, 0xd0, 0x26, 0x98, 0x00, 0x00, 0x94, 0x00, 0x03, 0x04, 0x00, 0x00, 0x30, 0x02,
+    0x05, 0xdc, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x04, 0x34, 0x00, 0x71, 0xdf, 0xd8, 0xd2, 0x4f, 0xa8,
+    0x94, 0x85, 0x04, 0x0d, 0x00, 0x8c, 0x01, 0x02, 0x04, 0x00, 0x02, 0xb4, 0x04, 0x00, 0x90, 0x1b,
+    0x00, 0x4c, 0x26, 0x01, 0x38, 0x06, 0x10, 0x65, 0xd0, 0x24, 0x30, 0x51, 0xff, 0x72, 0xdc, 0x1f,
+    0x70, 0x7e, 0x7b, 0xff, 0xec, 0xed, 0xed, 0x1b, 0x48, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x0c, 0xde,
+    0x00, 0x06, 0x01, 0x00, 0x40, 0xd2, 0xca, 0xc2, 0x3f, 0x88, 0x36, 0x40, 0x92, 0x7b, 0x69, 0xf4,
+    0x24, 0x12, 0x00, 0xc8, 0x13, 0x80, 0x9a, 0x88, 0x78, 0xff, 0xcd, 0xc8, 0xc0, 0x61, 0x20, 0x00,
+    0x0f, 0x01, 0x00, 0x21, 0x71, 0xc1, 0xb6, 0xad, 0x88, 0x96, 0x84, 0x74, 0x78, 0x08, 0x00, 0x08,
+    0x09, 0xbf, 0x80, 0x6e, 0x5c, 0xf7, 0x8b, 0x7a, 0x6a, 0xff, 0xd4, 0xca, 0xc5, 0x20, 0x31, 0x08,
+    0x0f, 0x01, 0x00, 0x04, 0x03, 0xbb, 0x00, 0xc0, 0xff, 0xeb, 0xeb, 0x0d, 0xb8, 0x9f, 0x90, 0xff,
+    0xaa, 0x8b, 0x79, 0xff, 0xcc, 0x2c, 0x30, 0xad, 0x91, 0x80, 0x48, 0x37, 0x43, 0xff, 0x7d, 0x6b,
+    0x5a, 0x90, 0x01, 0x00, 0x8c, 0x01, 0x02, 0x04, 0x00, 0x00, 0x9c, 0x01, 0x40, 0x73, 0x65, 0x4f,
+    0xf7, 0xd4, 0x15, 0x10, 0x74, 0xc8, 0x04, 0xf0, 0x04, 0x68, 0x54, 0xd5, 0x76, 0x69, 0x57, 0xdc,
+    0x7a, 0x6b, 0x5b, 0xdf, 0x79, 0x6d, 0x5c, 0xff, 0x8f, 0x85, 0x76, 0xe6, 0x64, 0x21, 0x00, 0x58,
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x40, 0x07, 0x40, 0xff, 0xff, 0xf0, 0x11, 0x7c, 0x1a, 0xf1, 0x04,
+    0xf5, 0xf5, 0xeb, 0x1a, 0xe2, 0xdc, 0xd9, 0x50, 0xc0, 0xb3, 0xa8, 0xb5, 0xa6, 0x92, 0x83, 0xff,
+    0x9b, 0x84, 0x73, 0xdc, 0x2c, 0x00, 0x0c, 0x33, 0x00, 0x04, 0x00, 0x00, 0x94, 0x01, 0x10, 0x9c,
+    0x00, 0x3e, 0x21, 0x7e, 0x6c, 0xe4, 0x00, 0x00, 0xd0, 0x07, 0x01, 0x7c, 0x16, 0x01, 0x74, 0x16,
+    0xa0, 0x5c, 0xff, 0x8d, 0x82, 0x7d, 0xff, 0xd5, 0xd1, 0xd1, 0x42, 0xd0, 0x01, 0x03, 0x00, 0x02,
+    0x50, 0x04, 0xff, 0xff, 0xfe, 0x04, 0x90, 0x02, 0x02, 0x04, 0x00, 0x01, 0x0c, 0x00, 0x04, 0x04,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x24, 0x00, 0xc1, 0x05, 0xf2, 0xf2, 0xf2, 0x13, 0xbc, 0xae, 0xa2,
+    0x81, 0x8f, 0x79, 0x66, 0x34, 0x09, 0x00, 0x90, 0x01, 0x40, 0x93, 0x7b, 0x6a, 0xfb, 0x04, 0x2d,
+    0x00, 0xd4, 0x2c, 0x40, 0xf4, 0xe9, 0xe9, 0x17, 0xac, 0x00, 0x0f, 0x01, 0x00, 0x19, 0x00, 0xd0,
+    0x00, 0x40, 0x9a, 0x88, 0x79, 0xff, 0x68, 0x03, 0x40, 0x83, 0x71, 0x5f, 0xfb, 0xa4, 0x2b, 0xc0,
+    0x83, 0x70, 0x5e, 0xfb, 0x7d, 0x6a, 0x57, 0xff, 0xa6, 0x9a, 0x8d, 0xb1, 0x64, 0x0e, 0x04, 0x80,
+    0x00, 0x0f, 0x04, 0x00, 0x18, 0xc1, 0x02, 0xdc, 0xd6, 0xcd, 0x33, 0xa7, 0x8f, 0x7e, 0xff, 0x9e,
+    0x83, 0x71, 0x6c, 0x18, 0x00, 0x6c, 0x0a, 0x00, 0x08, 0x0d, 0x00, 0x60, 0x14, 0x00, 0x8c, 0x01,
+    0x05, 0x04, 0x00, 0x01, 0x9c, 0x01, 0x30, 0x52, 0xff, 0x72, 0x94, 0x0d, 0x61, 0x5f, 0x4a, 0xf8,
+    0x6b, 0x5c, 0x47, 0x64, 0x29, 0x00, 0xf8, 0x27, 0x00, 0x40, 0x0f, 0xc0, 0x6c, 0x5e, 0x4b, 0xff,
+    0x73, 0x67, 0x54, 0xff, 0x85, 0x7b, 0x69, 0xe2, 0x04, 0x03, 0x00, 0xb4, 0x00, 0x00, 0x88, 0x2e,
+    0xf0, 0x05, 0xb7, 0xa8, 0x9a, 0xdf, 0xaf, 0x9e, 0x90, 0xff, 0xab, 0x99, 0x8a, 0xff, 0xa1, 0x8d,
+    0x7d, 0xff, 0x9c, 0x87, 0x75, 0xff, 0xc8, 0x3a, 0x03, 0xd8, 0x24, 0x10, 0xfc, 0x40, 0x13, 0x04,
+    0x04, 0x00, 0x00, 0x58, 0x13, 0x00, 0x98, 0x01, 0x00, 0x54, 0x08, 0x00, 0xfc, 0x2f, 0x00, 0x5c,
+    0x0a, 0x06, 0x5c, 0x31, 0xf0, 0x30, 0x69, 0xff, 0x93, 0x80, 0x74, 0xff, 0xa5, 0x94, 0x89, 0xff,
+    0xc6, 0xbb, 0xb1, 0x99, 0xd7, 0xcf, 0xc7, 0x65, 0xce, 0xc4, 0xbc, 0x81, 0xcd, 0xc3, 0xbb, 0x80,
+    0xcd, 0xc2, 0xb8, 0x89, 0xca, 0xc1, 0xb7, 0x8b, 0xcb, 0xc2, 0xb6, 0x89, 0xcb, 0xbf, 0xb8, 0x88,
+    0xca, 0xc1, 0xb7, 0x87, 0xcb, 0xc0, 0xb6, 0x89, 0xce, 0xc6, 0xbd, 0x78, 0xbf, 0xb2, 0xa8, 0xaf,
+    0xa7, 0x96, 0x88, 0xff, 0x98, 0x98, 0x44, 0x30, 0x7b, 0x69, 0xfc, 0x5c, 0x0c, 0x00, 0xcc, 0x0a,
+    0x50, 0x94, 0x7d, 0x6c, 0xff, 0x80, 0xcc, 0x2c, 0x70, 0x70, 0x5e, 0xff, 0xc7, 0xc2, 0xbb, 0x6d,
+    0xb0, 0x00, 0x06, 0x01, 0x00, 0x01, 0xbf, 0x00, 0x0f, 0x01, 0x00, 0x0a, 0x00, 0xdc, 0x04, 0x70,
+    0x93, 0x7f, 0x6e, 0xff, 0x82, 0x6d, 0x5a, 0x90, 0x01, 0x01, 0x74, 0x1d, 0x00, 0x08, 0x00, 0xf0,
+    0x12, 0x7f, 0x6d, 0x5a, 0xfb, 0x88, 0x78, 0x67, 0xff, 0x9b, 0x8d, 0x80, 0xff, 0xa7, 0x9a, 0x8d,
+    0xff, 0xa8, 0x9b, 0x8f, 0xff, 0xa5, 0x98, 0x8c, 0xff, 0xa5, 0x98, 0x8b, 0xff, 0xa4, 0x98, 0x8a,
+    0xff, 0xa3, 0x04, 0x00, 0x16, 0x97, 0x04, 0x00, 0x10, 0xa2, 0x04, 0x00, 0x21, 0x96, 0x89, 0x04,
+    0x00, 0x71, 0xa4, 0x99, 0x8c, 0xff, 0x98, 0x8a, 0x7c, 0x98, 0x0f, 0x31, 0x86, 0x72, 0x60, 0x54,
+    0x40, 0x00, 0xcc, 0x33, 0x00, 0xe0, 0x1d, 0x00, 0x84, 0x0c, 0x01, 0xcc, 0x15, 0x00, 0x04, 0x00,
+    0x00, 0xd0, 0x15, 0x00, 0x04, 0x29, 0x21, 0x65, 0x51, 0x44, 0x04, 0x00, 0xd4, 0x05, 0x00, 0x04,
+    0x00, 0x00, 0x84, 0x18, 0xf1, 0x06, 0x6e, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6b, 0x5d,
+    0x4b, 0xfb, 0x65, 0x58, 0x44, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0xfe, 0xa8, 0x43, 0x22, 0xfe, 0x0f,
+    0x48, 0x18, 0x00, 0x7c, 0x42, 0x11, 0x6c, 0x64, 0x01, 0x00, 0x84, 0x01, 0x10, 0x95, 0x28, 0x20,
+    0x00, 0x48, 0x23, 0x30, 0x80, 0x6d, 0xfc, 0x14, 0x36, 0x26, 0x97, 0x81, 0x08, 0x33, 0x00, 0xe4,
+    0x0a, 0x04, 0x04, 0x00, 0x00, 0xa0, 0x01, 0x00, 0xc0, 0x04, 0x00, 0x34, 0x03, 0x04, 0x08, 0x00,
+    0x50, 0x98, 0x80, 0x6e, 0xfc, 0x96, 0x3c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x4c, 0x00, 0x03, 0x6c,
+    0x20, 0x08, 0x04, 0x00, 0x00, 0x48, 0x0c, 0x04, 0x04, 0x00, 0x00, 0x9c, 0x15, 0x00, 0x04, 0x00,
+    0x00, 0x60, 0x02, 0x00, 0xec, 0x0e, 0x33, 0x91, 0x7c, 0x6a, 0x90, 0x01, 0x11, 0x6a, 0x48, 0x06,
+    0xc0, 0x7e, 0x6b, 0x57, 0xff, 0x7d, 0x71, 0x61, 0xff, 0xe3, 0xe3, 0xde, 0x36, 0x64, 0x01, 0x0f,
+    0x01, 0x00, 0x19, 0x00, 0x74, 0x02, 0x80, 0xa7, 0x90, 0x81, 0xb6, 0x8b, 0x76, 0x63, 0xff, 0xbc,
+    0x31, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x51, 0x82, 0x71, 0x5f, 0xfb, 0x80, 0x2c, 0x22, 0x11,
+    0x5a, 0x30, 0x2d, 0x00, 0xcc, 0x18, 0x31, 0x7e, 0x6b, 0x5a, 0xe0, 0x02, 0x00, 0x64, 0x1a, 0x00,
+    0xd4, 0x2e, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x14, 0x31, 0x7a, 0x69, 0x56, 0x08, 0x24, 0x00, 0x10,
+    0x35, 0x13, 0x79, 0x84, 0x0f, 0x00, 0xcc, 0x0a, 0x40, 0x75, 0x65, 0x53, 0xfb, 0x20, 0x06, 0x00,
+    0x74, 0x2a, 0x00, 0x04, 0x00, 0x00, 0x80, 0x01, 0x03, 0x18, 0x00, 0x05, 0xa8, 0x04, 0x00, 0x04,
+    0x00, 0x01, 0xc8, 0x05, 0x12, 0x64, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00,
+    0x09, 0x00, 0x04, 0x00, 0x00, 0x94, 0x01, 0xf0, 0x01, 0x66, 0x58, 0x43, 0xff, 0x71, 0x66, 0x52,
+    0xec, 0xe0, 0xdc, 0xdc, 0x3a, 0xe3, 0xe0, 0xd9, 0x51, 0x84, 0x01, 0x30, 0x8e, 0x76, 0x63, 0xdc,
+    0x40, 0x10, 0xfc, 0x2c, 0x01, 0x00, 0x44, 0x01, 0x00, 0x94, 0x01, 0x00, 0x18, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x78, 0x01, 0x04, 0x04, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x08, 0x00, 0x04, 0x04, 0x00,
+    0x00, 0x2c, 0x03, 0x09, 0x04, 0x00, 0x00, 0xb0, 0x01, 0x01, 0xac, 0x34, 0x11, 0x6b, 0x4c, 0x01,
+    0x04, 0x04, 0x00, 0x00, 0xf0, 0x01, 0x00, 0xc0, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x58, 0x0f, 0x00,
+    0x90, 0x15, 0x00, 0xc8, 0x0d, 0x12, 0x90, 0x50, 0x0c, 0x01, 0x04, 0x00, 0x10, 0x90, 0x18, 0x00,
+    0x01, 0x20, 0x00, 0x00, 0x04, 0x00, 0x00, 0xe8, 0x0d, 0x11, 0x68, 0x2c, 0x01, 0x30, 0x80, 0x75,
+    0x68, 0x2c, 0x18, 0x0f, 0x24, 0x46, 0x06, 0x0f, 0x01, 0x00, 0x05, 0x00, 0x90, 0x01, 0x40, 0xb6,
+    0xa0, 0x91, 0xb3, 0xe0, 0x01, 0x00, 0xf8, 0x1e, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0xd4,
+    0x07, 0x00, 0x08, 0x14, 0x11, 0x7e, 0x68, 0x05, 0x11, 0x57, 0x70, 0x01, 0x22, 0x7b, 0x68, 0x04,
+    0x00, 0x62, 0x7a, 0x67, 0x55, 0xff, 0x7a, 0x68, 0x04, 0x00, 0x10, 0x79, 0x2c, 0x27, 0x22, 0x66,
+    0x53, 0xb0, 0x20, 0x20, 0x65, 0x51, 0x60, 0x2a, 0x41, 0xff, 0x74, 0x63, 0x51, 0xf8, 0x02, 0x00,
+    0x64, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x88,
+    0x01, 0x04, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x1c, 0x03, 0x02, 0x90, 0x01, 0x02, 0x20, 0x03,
+    0x00, 0x50, 0x12, 0x00, 0xc8, 0x10, 0x00, 0x40, 0x0f, 0x02, 0x04, 0x00, 0x11, 0x4d, 0x58, 0x2c,
+    0xf9, 0x04, 0x70, 0x63, 0x50, 0xfb, 0xb6, 0xaf, 0xaa, 0xaf, 0xdf, 0xda, 0xd4, 0x60, 0x99, 0x83,
+    0x73, 0xf3, 0x90, 0x79, 0x67, 0x84, 0x01, 0x00, 0xec, 0x19, 0x00, 0x08, 0x00, 0x04, 0x04, 0x00,
+    0x00, 0x64, 0x16, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x88, 0x01, 0x08, 0x04, 0x00, 0x04,
+    0x14, 0x00, 0x00, 0x28, 0x00, 0x01, 0xcc, 0x01, 0x03, 0x34, 0x00, 0x08, 0x04, 0x00, 0x00, 0x18,
+    0x00, 0x0c, 0x04, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x4c, 0x1a, 0x02, 0xe0, 0x1b, 0x02, 0xf0, 0x37,
+    0x00, 0x04, 0x00, 0x00, 0x24, 0x03, 0x00, 0xa8, 0x01, 0x00, 0xb0, 0x08, 0x00, 0x64, 0x0f, 0xbf,
+    0x7f, 0x6c, 0x5b, 0xff, 0x84, 0x78, 0x6d, 0xff, 0xec, 0xec, 0xec, 0x60, 0x0e, 0x1e, 0x00, 0x90,
+    0x01, 0x40, 0xbf, 0xaa, 0x9c, 0xb7, 0xd0, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x88, 0x01, 0x04, 0x90,
+    0x01, 0x04, 0xe4, 0x26, 0x00, 0x04, 0x00, 0x00, 0xc8, 0x23, 0x04, 0x04, 0x00, 0x00, 0xe0, 0x1c,
+    0x00, 0x1c, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x34, 0x00, 0x00, 0x30, 0x03, 0x22, 0x7b, 0x6b, 0xe4,
+    0x18, 0x00, 0x40, 0x09, 0x00, 0xac, 0x12, 0x00, 0x98, 0x04, 0x00, 0xf8, 0x0d, 0x00, 0x04, 0x00,
+    0x00, 0x94, 0x01, 0x04, 0x04, 0x00, 0x00, 0x88, 0x01, 0x00, 0x04, 0x00, 0x01, 0x18, 0x03, 0x00,
+    0x8c, 0x01, 0x00, 0x04, 0x00, 0x12, 0x64, 0x80, 0x0a, 0x00, 0x14, 0x1a, 0x00, 0x04, 0x00, 0x02,
+    0x88, 0x01, 0x02, 0x04, 0x00, 0x00, 0xb4, 0x2f, 0x40, 0x69, 0x5a, 0x45, 0xfb, 0x0c, 0x00, 0xc8,
+    0x92, 0x89, 0x83, 0xff, 0xee, 0xe9, 0xe5, 0x3b, 0x99, 0x85, 0x73, 0xed, 0x4c, 0x4a, 0x00, 0x60,
+    0x04, 0x02, 0x08, 0x00, 0x02, 0x5c, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x2f, 0x03, 0xa8,
+    0x04, 0x04, 0x04, 0x00, 0x09, 0x88, 0x01, 0x02, 0xac, 0x04, 0x00, 0x04, 0x00, 0x04, 0x88, 0x01,
+    0x02, 0x04, 0x00, 0x00, 0x00, 0x11, 0x11, 0x66, 0x28, 0x28, 0x8f, 0x87, 0x79, 0x6e, 0xff, 0xf0,
+    0xf0, 0xf0, 0x21, 0x32, 0x06, 0x0f, 0x04, 0x01, 0x00, 0x02, 0x2a, 0x00, 0x00, 0x90, 0x01, 0x40,
+    0xbc, 0xa5, 0x98, 0xb8, 0x70, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x84, 0x01, 0x0c, 0x8c, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x88, 0x01, 0x04, 0x04, 0x00, 0x00, 0x88, 0x01, 0x00, 0xb0, 0x20, 0x00, 0x8c,
+    0x01, 0x00, 0x44, 0x22, 0x01, 0x90, 0x01, 0x00, 0x8c, 0x01, 0x12, 0x6b, 0x8c, 0x01, 0x00, 0x04,
+    0x00, 0x04, 0x90, 0x01, 0x00, 0x84, 0x01, 0x25, 0x76, 0x65, 0xc0, 0x04, 0x01, 0x8c, 0x01, 0x00,
+    0x04, 0x00, 0x01, 0x90, 0x01, 0x00, 0xd8, 0x20, 0x04, 0x1c, 0x03, 0x01, 0x8c, 0x01, 0x00, 0x1c,
+    0x03, 0x0a, 0x90, 0x01, 0x00, 0xd4, 0x32, 0xf1, 0x08, 0x66, 0x59, 0x43, 0xfb, 0x6a, 0x5e, 0x4a,
+    0xff, 0x8c, 0x85, 0x7e, 0xff, 0xea, 0xe6, 0xe6, 0x3d, 0x96, 0x81, 0x6f, 0xed, 0x8e, 0x77, 0x64,
+    0x30, 0x01, 0x04, 0x04, 0x00, 0x02, 0x44, 0x01, 0x0f, 0x04, 0x00, 0x07, 0x00, 0x2c, 0x44, 0x00,
+    0x08, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x1c, 0x03, 0x02, 0x64, 0x06, 0x04, 0x04, 0x00, 0x00, 0x84,
+    0x06, 0x00, 0x74, 0x01, 0x02, 0x70, 0x04, 0x00, 0x7c, 0x03, 0x00, 0x08, 0x00, 0x00, 0x90, 0x04,
+    0x31, 0x8f, 0x78, 0x66, 0x60, 0x0f, 0x31, 0x8e, 0x77, 0x65, 0x04, 0x00, 0xb1, 0x8d, 0x77, 0x64,
+    0xff, 0x8d, 0x76, 0x63, 0xff, 0x8d, 0x77, 0x63, 0x10, 0x00, 0x01, 0x0c, 0x11, 0x03, 0x1c, 0x14,
+    0x00, 0x0c, 0x00, 0x00, 0x28, 0x08, 0x00, 0xf4, 0x3a, 0x30, 0x8a, 0x7c, 0x6e, 0xb4, 0x24, 0x10,
+    0x24, 0x64, 0x01, 0x00, 0x01, 0x00, 0x01, 0x6e, 0x01, 0x01, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x0b,
+    0x00, 0x90, 0x01, 0x40, 0xaf, 0x99, 0x8a, 0xb2, 0x18, 0x4b, 0x00, 0xf8, 0x04, 0x00, 0x88, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x4c, 0x06, 0x00, 0x08, 0x00, 0x00, 0x20, 0x0a, 0x00, 0x44, 0x06, 0x00,
+    0x70, 0x09, 0x04, 0xa0, 0x04, 0x31, 0x79, 0x67, 0x53, 0x04, 0x00, 0x31, 0x78, 0x66, 0x52, 0x04,
+    0x00, 0x00, 0xa8, 0x04, 0x20, 0x76, 0x64, 0xac, 0x04, 0x00, 0x38, 0x22, 0x11, 0x50, 0x3c, 0x22,
+    0x00, 0xf8, 0x0e, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x98, 0x04, 0x00, 0x04, 0x00, 0x00,
+    0x88, 0x01, 0x00, 0x04, 0x00, 0x23, 0x74, 0x66, 0x1c, 0x03, 0x00, 0x8c, 0x01, 0x12, 0x63, 0xa8,
+    0x04, 0x00, 0x04, 0x00, 0x00, 0xa4, 0x35, 0x32, 0x70, 0x62, 0x4d, 0xc0, 0x2f, 0xf0, 0x0c, 0x5c,
+    0x47, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69, 0x5d, 0x48, 0xff, 0x66, 0x59, 0x46, 0xff, 0x72, 0x67,
+    0x56, 0xff, 0xb9, 0xb5, 0xb0, 0x8e, 0xee, 0xee, 0xe8, 0x2d, 0x3c, 0x02, 0x30, 0x8b, 0x74, 0x61,
+    0x34, 0x01, 0x01, 0x48, 0x07, 0x00, 0x04, 0x00, 0x04, 0xdc, 0x08, 0x00, 0x94, 0x07, 0x00, 0xa0,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x84, 0x01, 0x00, 0x04, 0x00, 0x04, 0x90, 0x01,
+    0x00, 0x40, 0x03, 0x04, 0x04, 0x00, 0x00, 0x40, 0x1d, 0x00, 0xf4, 0x04, 0x40, 0x94, 0x7e, 0x6b,
+    0xfc, 0x24, 0x06, 0x00, 0x44, 0x00, 0x00, 0x70, 0x12, 0x00, 0x04, 0x00, 0x23, 0x92, 0x7f, 0x88,
+    0x3c, 0x03, 0x18, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x68, 0x00, 0x08, 0x04, 0x00, 0x04, 0x88, 0x01,
+    0x43, 0x8e, 0x79, 0x68, 0xfc, 0x08, 0x00, 0x01, 0xa8, 0x13, 0xc0, 0x85, 0x70, 0x5d, 0xff, 0x8f,
+    0x7e, 0x6d, 0xff, 0xe9, 0xe4, 0xe4, 0x39, 0x64, 0x01, 0x0f, 0x01, 0x00, 0x19, 0x00, 0xf8, 0x4c,
+    0x93, 0x9f, 0x8a, 0x7a, 0xdd, 0x85, 0x71, 0x5e, 0xff, 0x7f, 0x90, 0x2b, 0x00, 0x10, 0x03, 0x00,
+    0x0c, 0x09, 0x00, 0xac, 0x27, 0x00, 0x68, 0x09, 0x10, 0x7f, 0x40, 0x2d, 0x00, 0x4c, 0x06, 0x00,
+    0x04, 0x00, 0x10, 0x6d, 0x04, 0x00, 0x00, 0x24, 0x03, 0x00, 0x64, 0x25, 0x06, 0xe0, 0x07, 0x00,
+    0xb4, 0x38, 0x00, 0xb0, 0x04, 0x01, 0x1c, 0x03, 0x03, 0x5c, 0x17, 0x31, 0x76, 0x66, 0x54, 0xd0,
+    0x07, 0x00, 0xd8, 0x0a, 0x22, 0x75, 0x66, 0x90, 0x01, 0x01, 0x18, 0x03, 0x00, 0x8c, 0x01, 0x0f,
+    0x54, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc4, 0x2f, 0x11, 0x6d, 0xa8, 0x29, 0x00, 0x64, 0x09,
+    0xd0, 0x50, 0xff, 0x70, 0x64, 0x54, 0xff, 0x7a, 0x6f, 0x64, 0xff, 0x8d, 0x86, 0x80, 0x28, 0x1a,
+    0x00, 0xe8, 0x26, 0x50, 0x0b, 0x9e, 0x8a, 0x7b, 0xf6, 0x1c, 0x04, 0x00, 0x58, 0x42, 0x22, 0x8f,
+    0x79, 0xc0, 0x05, 0x04, 0xcc, 0x02, 0x60, 0x91, 0x7c, 0x69, 0xfc, 0x93, 0x7c, 0xec, 0x02, 0x03,
+    0x04, 0x00, 0x01, 0x9c, 0x01, 0x00, 0x8c, 0x01, 0x30, 0x6e, 0xff, 0x8f, 0x1c, 0x36, 0x10, 0x72,
+    0xfc, 0x03, 0x20, 0x5c, 0xff, 0x8c, 0x10, 0x00, 0x08, 0x00, 0xf0, 0x0d, 0x7d, 0x6b, 0x5b, 0xff,
+    0x79, 0x67, 0x5d, 0xff, 0x84, 0x74, 0x6e, 0xff, 0x9a, 0x8c, 0x84, 0xff, 0xc2, 0xba, 0xb3, 0x93,
+    0xdb, 0xd5, 0xd3, 0x56, 0xd8, 0xd2, 0xcd, 0x5b, 0x04, 0x00, 0x40, 0xd5, 0xd0, 0xcb, 0x62, 0x04,
+    0x00, 0xf0, 0x0c, 0xd7, 0xd2, 0xcc, 0x5a, 0xd8, 0xd0, 0xca, 0x5c, 0xd6, 0xcf, 0xc7, 0x64, 0xdd,
+    0xd7, 0xd1, 0x53, 0xc5, 0xba, 0xb5, 0x90, 0xa4, 0x95, 0x8b, 0xff, 0x93, 0x80, 0x71, 0x74, 0x39,
+    0x11, 0xfc, 0x3c, 0x0b, 0x00, 0x04, 0x00, 0x10, 0x78, 0x90, 0x01, 0xa0, 0x5c, 0xff, 0x92, 0x7f,
+    0x6d, 0xff, 0xd0, 0xca, 0xc5, 0x73, 0x64, 0x01, 0x0f, 0x01, 0x00, 0x19, 0x40, 0xde, 0xd7, 0xd1,
+    0x4d, 0xd8, 0x26, 0x30, 0x7c, 0x68, 0x55, 0x14, 0x03, 0x16, 0xfb, 0x90, 0x01, 0xf8, 0x17, 0x5b,
+    0xff, 0x7a, 0x69, 0x59, 0xfb, 0x75, 0x68, 0x5f, 0xff, 0x80, 0x73, 0x6d, 0xff, 0x91, 0x85, 0x7d,
+    0xff, 0xa0, 0x95, 0x8c, 0xff, 0xb8, 0xaf, 0xa7, 0x9f, 0xc2, 0xbc, 0xb3, 0x79, 0xbe, 0xb6, 0xae,
+    0x85, 0xbf, 0xb7, 0xaf, 0x83, 0x04, 0x00, 0xf1, 0x00, 0xbe, 0xb8, 0xb0, 0x7e, 0xbb, 0xb4, 0xac,
+    0x8b, 0xa7, 0x9e, 0x96, 0xdf, 0x91, 0x84, 0x78, 0x48, 0x00, 0x00, 0x10, 0x08, 0x01, 0xcc, 0x01,
+    0x21, 0x6d, 0x5b, 0xd0, 0x20, 0x00, 0x98, 0x33, 0x00, 0x18, 0x03, 0x00, 0x04, 0x00, 0x04, 0x90,
+    0x01, 0x00, 0x5c, 0x09, 0x00, 0x9c, 0x04, 0xf0, 0x05, 0x64, 0x57, 0x4a, 0xf8, 0x67, 0x5b, 0x54,
+    0xff, 0x7b, 0x72, 0x6c, 0xff, 0x94, 0x8c, 0x86, 0xff, 0xc2, 0xbf, 0xba, 0x60, 0xe4, 0x41, 0x00,
+    0x0c, 0x0e, 0x00, 0x9c, 0x1d, 0x00, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0xf3, 0xf3, 0x16,
+    0xc1, 0xb8, 0xae, 0xa1, 0xa8, 0x74, 0x0b, 0xf0, 0x08, 0x91, 0x84, 0xff, 0xa1, 0x8f, 0x81, 0xf9,
+    0x9e, 0x8d, 0x7e, 0xff, 0x98, 0x87, 0x78, 0xff, 0x90, 0x7d, 0x6d, 0xff, 0x90, 0x7c, 0x6b, 0xf9,
+    0xd8, 0x02, 0x01, 0xec, 0x05, 0x00, 0xf4, 0x02, 0x00, 0x38, 0x03, 0x21, 0x7f, 0x6e, 0xa0, 0x3a,
+    0x00, 0x74, 0x0e, 0x10, 0x6e, 0xb4, 0x20, 0x03, 0x88, 0x03, 0xc0, 0x67, 0x5a, 0x4c, 0xff, 0x76,
+    0x6b, 0x6a, 0xff, 0xb3, 0xac, 0xb0, 0x94, 0xb4, 0x41, 0x03, 0xf4, 0x0d, 0x00, 0x18, 0x0e, 0x04,
+    0x04, 0x00, 0x00, 0x7c, 0x0d, 0x00, 0x04, 0x00, 0x26, 0x02, 0xfe, 0x10, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0x68, 0x0d, 0x50, 0x11, 0xbb, 0xb0, 0xa7, 0x71, 0x28, 0x4c, 0x05, 0x94, 0x01, 0xef, 0x77,
+    0x65, 0xfc, 0x87, 0x72, 0x60, 0xff, 0x93, 0x82, 0x76, 0xff, 0xe0, 0xdd, 0xda, 0x08, 0x14, 0x1e,
+    0x00, 0x54, 0x11, 0x40, 0x95, 0x85, 0x77, 0xf8, 0x34, 0x06, 0x31, 0x7e, 0x6c, 0x59, 0x90, 0x01,
+    0x00, 0x1c, 0x03, 0xf3, 0x01, 0x81, 0x6e, 0x5a, 0xf7, 0x7a, 0x6b, 0x61, 0xff, 0x83, 0x7b, 0x7d,
+    0xff, 0xd0, 0xd0, 0xd0, 0x2b, 0x88, 0x00, 0x00, 0x58, 0x2f, 0x00, 0x08, 0x00, 0x00, 0x90, 0x00,
+    0x0f, 0x04, 0x00, 0x0a, 0x70, 0xd1, 0xcc, 0xc7, 0x37, 0x91, 0x7e, 0x6e, 0x08, 0x18, 0x01, 0x08,
+    0x01, 0x31, 0x88, 0x74, 0x63, 0xe8, 0x06, 0x00, 0x10, 0x1c, 0x00, 0x88, 0x01, 0x04, 0x04, 0x00,
+    0x00, 0x90, 0x01, 0xf3, 0x05, 0x73, 0x65, 0x4f, 0xff, 0x6c, 0x5e, 0x4c, 0xff, 0x5f, 0x53, 0x50,
+    0xff, 0x80, 0x78, 0x7c, 0xff, 0xd1, 0xcc, 0xd1, 0x32, 0x68, 0x00, 0x1f, 0x01, 0x74, 0x05, 0x05,
+    0x03, 0x10, 0x01, 0x10, 0x0c, 0x30, 0x03, 0x00, 0xc8, 0x28, 0x00, 0x2c, 0x2d, 0x71, 0xc6, 0xbd,
+    0xb8, 0x90, 0x9d, 0x8d, 0x81, 0x14, 0x03, 0x42, 0x90, 0x7a, 0x68, 0xf9, 0x78, 0x07, 0x02, 0xcc,
+    0x04, 0x00, 0x14, 0x00, 0x00, 0xd8, 0x16, 0x00, 0x54, 0x21, 0x02, 0xa0, 0x2b, 0xff, 0x02, 0x4a,
+    0xff, 0x68, 0x5b, 0x45, 0xff, 0x68, 0x5c, 0x4a, 0xff, 0x95, 0x8d, 0x8b, 0xff, 0xf0, 0xf0, 0xf8,
+    0x60, 0x4d, 0x22, 0xc0, 0xd5, 0xce, 0xca, 0x43, 0x91, 0x7e, 0x6d, 0xff, 0x89, 0x74, 0x62, 0xf6,
+    0x64, 0x44, 0x00, 0x48, 0x17, 0x70, 0x8b, 0x79, 0x6c, 0xff, 0xa3, 0x9b, 0x96, 0x3c, 0x2e, 0x05,
+    0x70, 0x12, 0x00, 0x14, 0x01, 0x00, 0x08, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x01, 0xe8, 0x00, 0x07,
+    0x01, 0x00, 0x71, 0xe1, 0xdc, 0xd8, 0x3b, 0x90, 0x81, 0x72, 0x20, 0x06, 0x00, 0x2c, 0x06, 0xff,
+    0x00, 0x80, 0x6d, 0x5a, 0xf8, 0x7e, 0x6e, 0x5e, 0xff, 0x89, 0x7e, 0x79, 0xff, 0xcf, 0xcf, 0xcf,
+    0x34, 0x11, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0xe6, 0x14, 0x99, 0x86, 0x76, 0xff, 0xf0,
+    0x1a, 0x00, 0x50, 0x04, 0x00, 0x90, 0x25, 0x00, 0x20, 0x04, 0x00, 0x40, 0x14, 0x00, 0x88, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x50, 0x09, 0x00, 0x68, 0x23, 0xc0, 0x6a, 0x5c, 0x4c,
+    0xff, 0x73, 0x6b, 0x6b, 0xff, 0xc1, 0xc1, 0xc5, 0x3e, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x09,
+    0xb6, 0x00, 0x0e, 0x01, 0x00, 0x00, 0xd8, 0x00, 0xc0, 0xd9, 0xd7, 0xcf, 0x50, 0x9d, 0x8b, 0x7b,
+    0xff, 0x8a, 0x73, 0x60, 0xfc, 0x8c, 0x01, 0x00, 0x00, 0x09, 0x00, 0x08, 0x09, 0x00, 0xac, 0x0d,
+    0x00, 0x98, 0x07, 0x00, 0x8c, 0x08, 0x04, 0xa4, 0x06, 0x31, 0x69, 0x5c, 0x45, 0x08, 0x10, 0x7f,
+    0x92, 0x8a, 0x86, 0xff, 0xef, 0xef, 0xef, 0x50, 0x14, 0x23, 0x61, 0xe4, 0xde, 0x2f, 0xa3, 0x93,
+    0x85, 0xa4, 0x4a, 0xb5, 0x87, 0x73, 0x60, 0xf9, 0x80, 0x6d, 0x5a, 0xff, 0x8d, 0x80, 0x73, 0xec,
+    0x0a, 0x00, 0x88, 0x01, 0xb0, 0xcc, 0xc3, 0xbd, 0x78, 0xac, 0x9d, 0x8f, 0xed, 0xdf, 0xd7, 0xd3,
+    0x2c, 0x32, 0x01, 0x68, 0x13, 0x03, 0x04, 0x00, 0xc5, 0x01, 0xf7, 0xef, 0xef, 0x20, 0xc7, 0xb8,
+    0xae, 0x9e, 0xf0, 0xe9, 0xe9, 0x10, 0x02, 0x00, 0x1c, 0x00, 0x40, 0xa3, 0x95, 0x88, 0xd9, 0x4c,
+    0x00, 0x40, 0x7b, 0x68, 0x54, 0xfb, 0x64, 0x0c, 0x72, 0x85, 0x78, 0x6d, 0xff, 0xcc, 0xc7, 0xc7,
+    0x84, 0x16, 0x0f, 0x01, 0x00, 0x20, 0xb1, 0xea, 0xdf, 0xdf, 0x18, 0x98, 0x85, 0x73, 0xff, 0x8a,
+    0x74, 0x62, 0xa0, 0x02, 0x00, 0x90, 0x01, 0x20, 0x7c, 0x6c, 0x2c, 0x11, 0x12, 0x52, 0x8c, 0x01,
+    0x21, 0x64, 0x50, 0x30, 0x06, 0x00, 0x84, 0x26, 0x00, 0x04, 0x39, 0xc0, 0x69, 0x5d, 0x4e, 0xfb,
+    0x86, 0x80, 0x80, 0xff, 0xdd, 0xdd, 0xe6, 0x1e, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x25, 0x00, 0xe4,
+    0x00, 0x70, 0xb7, 0xa9, 0x9c, 0x7c, 0x89, 0x72, 0x61, 0x1c, 0x03, 0x10, 0xf6, 0x90, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0x09, 0x00, 0xc8, 0x40, 0x00, 0x38, 0x08, 0x00, 0x88,
+    0x01, 0x04, 0xd0, 0x3a, 0x7f, 0x84, 0x7a, 0x72, 0xff, 0xe1, 0xe1, 0xe1, 0xe4, 0x4d, 0x06, 0x0f,
+    0x01, 0x00, 0x0d, 0x42, 0xde, 0xd7, 0xd3, 0x46, 0x54, 0x4f, 0x02, 0xa0, 0x05, 0x00, 0x20, 0x2e,
+    0x40, 0xd9, 0xd4, 0xd1, 0x58, 0x50, 0x04, 0xf0, 0x15, 0xe9, 0xe3, 0xe3, 0x2e, 0x95, 0x85, 0x75,
+    0xff, 0x8d, 0x7a, 0x69, 0xff, 0x9c, 0x8a, 0x7c, 0xff, 0xb2, 0xa3, 0x97, 0xbc, 0xb4, 0xa5, 0x96,
+    0xbe, 0xb5, 0xa6, 0x99, 0xc1, 0xba, 0xaa, 0x9c, 0xbc, 0xa9, 0x94, 0x84, 0xfc, 0xec, 0x20, 0x80,
+    0x96, 0x86, 0x77, 0xff, 0xe3, 0xdf, 0xdf, 0x37, 0x8c, 0x01, 0x00, 0xf0, 0x03, 0xf0, 0x05, 0xaf,
+    0x9c, 0x8d, 0xd9, 0x8d, 0x77, 0x65, 0xff, 0x77, 0x64, 0x52, 0xff, 0x87, 0x78, 0x6a, 0xff, 0xc8,
+    0xc5, 0xbd, 0x46, 0x6c, 0x00, 0x0f, 0x01, 0x00, 0x25, 0x71, 0xd3, 0xc8, 0xc1, 0x46, 0x95, 0x81,
+    0x6f, 0xd0, 0x54, 0x00, 0xc0, 0x05, 0x71, 0x8b, 0x77, 0x64, 0xff, 0x78, 0x69, 0x54, 0x50, 0x09,
+    0x01, 0x90, 0x01, 0x03, 0x58, 0x09, 0x00, 0x94, 0x01, 0x02, 0xb0, 0x12, 0x60, 0x51, 0xff, 0x96,
+    0x90, 0x8f, 0xff, 0xa4, 0x13, 0x00, 0x40, 0x00, 0x0f, 0x01, 0x00, 0x12, 0x0f, 0x30, 0x03, 0x04,
+    0x70, 0xc6, 0xbc, 0xb5, 0x48, 0x8c, 0x76, 0x65, 0xe4, 0x13, 0x10, 0xf3, 0x04, 0x09, 0x05, 0x04,
+    0x00, 0x21, 0x79, 0x69, 0xc4, 0x11, 0x00, 0xc0, 0x20, 0x00, 0x78, 0x3f, 0x00, 0x8c, 0x01, 0x00,
+    0x5c, 0x3c, 0x80, 0x79, 0x6f, 0x62, 0xff, 0xe3, 0xdd, 0xdd, 0x25, 0x3c, 0x00, 0x0f, 0x01, 0x00,
+    0x1e, 0x11, 0x01, 0x04, 0x02, 0x50, 0x02, 0xc9, 0xbf, 0xb8, 0x68, 0x5c, 0x00, 0x00, 0x88, 0x0a,
+    0xf0, 0x01, 0x8a, 0x78, 0x67, 0xff, 0x9e, 0x8d, 0x7f, 0xff, 0xa7, 0x97, 0x8a, 0xe8, 0x95, 0x84,
+    0x74, 0xfc, 0xe8, 0x02, 0x40, 0x80, 0x6e, 0x5a, 0xf9, 0x8c, 0x12, 0x00, 0x30, 0x1f, 0x10, 0x90,
+    0x7c, 0x25, 0x21, 0x7d, 0x6b, 0x04, 0x00, 0x00, 0x04, 0x26, 0x00, 0x94, 0x52, 0x00, 0x04, 0x03,
+    0xf0, 0x0c, 0x8f, 0x81, 0x71, 0xff, 0xa7, 0x9c, 0x8e, 0xda, 0xac, 0x9b, 0x8c, 0xd9, 0xa3, 0x8c,
+    0x7c, 0xf8, 0x8a, 0x74, 0x61, 0xff, 0x7d, 0x6c, 0x5b, 0xff, 0xb9, 0xb1, 0xa9, 0xcd, 0x08, 0x03,
+    0x40, 0x07, 0x11, 0x01, 0x03, 0x00, 0x0f, 0x01, 0x00, 0x19, 0x71, 0xf3, 0xe7, 0xe7, 0x15, 0xaa,
+    0x99, 0x8a, 0xec, 0x11, 0x00, 0x2c, 0x04, 0x00, 0x88, 0x0a, 0x00, 0x78, 0x00, 0x00, 0x64, 0x09,
+    0x00, 0x84, 0x01, 0x00, 0x0c, 0x2a, 0x08, 0x90, 0x01, 0x70, 0x69, 0x5b, 0x49, 0xfb, 0x74, 0x69,
+    0x5f, 0x2c, 0x2b, 0x10, 0x54, 0xe0, 0x02, 0x0f, 0x71, 0x00, 0x1e, 0x0b, 0x01, 0x00, 0x40, 0xc9,
+    0xc0, 0xb7, 0x55, 0xe4, 0x19, 0x40, 0x8d, 0x79, 0x67, 0xf3, 0x64, 0x07, 0x02, 0x88, 0x0a, 0x02,
+    0x28, 0x0c, 0x00, 0xa8, 0x03, 0x31, 0x75, 0x67, 0x53, 0x90, 0x01, 0x00, 0xb4, 0x04, 0x00, 0x90,
+    0x01, 0x80, 0x6f, 0x63, 0x53, 0xff, 0xd8, 0xd8, 0xd3, 0x2e, 0x3c, 0x00, 0x0f, 0x01, 0x00, 0x25,
+    0x00, 0xf0, 0x06, 0x70, 0xb9, 0xae, 0xa3, 0x8d, 0x87, 0x74, 0x63, 0xb4, 0x13, 0x10, 0xe8, 0x4c,
+    0x06, 0x34, 0x8c, 0x79, 0x68, 0x10, 0x14, 0x50, 0xfc, 0x84, 0x72, 0x61, 0xfc, 0x7c, 0x19, 0x00,
+    0x9c, 0x07, 0x10, 0x82, 0x5c, 0x36, 0x00, 0xac, 0x3f, 0x00, 0xd0, 0x0d, 0x00, 0xb8, 0x3f, 0x70,
+    0x6e, 0x5c, 0xfc, 0x7e, 0x6b, 0x59, 0xfc, 0xd8, 0x0f, 0x00, 0x6c, 0x4c, 0x00, 0xa8, 0x09, 0xb0,
+    0x86, 0x72, 0x5f, 0xef, 0x86, 0x75, 0x64, 0xff, 0xbb, 0xb4, 0xab, 0x4c, 0x5c, 0x0f, 0x7c, 0x06,
+    0x06, 0x0f, 0x01, 0x00, 0x11, 0x60, 0xe4, 0xe4, 0xd7, 0x13, 0x98, 0x83, 0x34, 0x2a, 0x42, 0x6a,
+    0xff, 0x95, 0x7e, 0xf4, 0x3e, 0x00, 0x98, 0x30, 0x00, 0x78, 0x0c, 0x00, 0x84, 0x01, 0x05, 0xac,
+    0x04, 0x01, 0x04, 0x0e, 0xd5, 0x4f, 0xff, 0x67, 0x5a, 0x48, 0xf8, 0x7d, 0x74, 0x6b, 0xff, 0xdb,
+    0xdb, 0xdb, 0x44, 0x05, 0x0f, 0x01, 0x00, 0x29, 0x80, 0xe6, 0xe2, 0xde, 0x3e, 0xa4, 0x95, 0x87,
+    0xff, 0x40, 0x58, 0x00, 0x4c, 0x08, 0x00, 0xa4, 0x0d, 0x00, 0x98, 0x01, 0x00, 0x90, 0x01, 0x31,
+    0x8c, 0x7a, 0x66, 0xb8, 0x0e, 0x01, 0xd4, 0x07, 0x10, 0x60, 0xb4, 0x04, 0x11, 0x48, 0xe8, 0x0c,
+    0x46, 0xa9, 0xa3, 0x9a, 0xa1, 0x84, 0x02, 0x0f, 0x01, 0x00, 0x23, 0x80, 0xff, 0xff, 0xff, 0x17,
+    0xae, 0xa1, 0x94, 0xee, 0x64, 0x1d, 0xb1, 0x80, 0x6c, 0x59, 0xfc, 0x83, 0x71, 0x5d, 0xf3, 0x83,
+    0x72, 0x5f, 0xa4, 0x4a, 0x22, 0x84, 0x72, 0x90, 0x3c, 0x10, 0x83, 0x94, 0x3c, 0x44, 0x71, 0x5f,
+    0xff, 0x81, 0x74, 0x0f, 0x00, 0x40, 0x09, 0x01, 0x04, 0x00, 0x20, 0x5e, 0xff, 0x58, 0x0c, 0x80,
+    0x7d, 0x6a, 0x57, 0xf5, 0x7a, 0x68, 0x53, 0xf8, 0x68, 0x4c, 0x40, 0xac, 0x9f, 0x96, 0xd9, 0xb0,
+    0x08, 0x00, 0x5c, 0x00, 0x0f, 0x01, 0x00, 0x29, 0x40, 0xd4, 0xce, 0xc8, 0x2a, 0x60, 0x0d, 0x00,
+    0x94, 0x0d, 0x00, 0x00, 0x0f, 0x00, 0x10, 0x01, 0x00, 0x94, 0x14, 0x00, 0x74, 0x0c, 0x01, 0x88,
+    0x01, 0x00, 0x04, 0x00, 0x00, 0xf0, 0x32, 0x00, 0x34, 0x14, 0x10, 0x61, 0x20, 0x03, 0x20, 0x48,
+    0xfb, 0x08, 0x3f, 0x42, 0xb4, 0xb0, 0xa6, 0x6a, 0x20, 0x03, 0x0f, 0x01, 0x00, 0x2b, 0x73, 0xef,
+    0xea, 0xea, 0x30, 0xa1, 0x92, 0x82, 0x90, 0x01, 0x12, 0x65, 0x88, 0x0a, 0x01, 0x98, 0x01, 0x02,
+    0x24, 0x0c, 0x00, 0x68, 0x44, 0x00, 0x8c, 0x00, 0x00, 0x20, 0x03, 0x00, 0xa4, 0x42, 0xbf, 0x67,
+    0x59, 0x44, 0xff, 0x86, 0x7b, 0x6e, 0xff, 0xe2, 0xde, 0xde, 0xa0, 0x1c, 0x2e, 0xb0, 0xf7, 0xf7,
+    0xef, 0x20, 0xc2, 0xb8, 0xb1, 0x6c, 0x92, 0x82, 0x72, 0x18, 0x03, 0x90, 0xff, 0x79, 0x65, 0x52,
+    0xfc, 0x80, 0x6d, 0x5b, 0xf9, 0x8c, 0x01, 0x00, 0x94, 0x01, 0x00, 0x14, 0x00, 0x00, 0xcc, 0x0a,
+    0x00, 0x04, 0x00, 0x02, 0x88, 0x01, 0x04, 0x04, 0x00, 0xff, 0x06, 0x5c, 0xff, 0x80, 0x6c, 0x58,
+    0xf8, 0x7c, 0x69, 0x57, 0xff, 0x81, 0x71, 0x62, 0xff, 0xb8, 0xaf, 0xa6, 0x76, 0xf6, 0xf6, 0xf6,
+    0x24, 0x1b, 0x08, 0x08, 0x01, 0x00, 0x0f, 0x33, 0x01, 0x07, 0x00, 0x8c, 0x06, 0x30, 0xb0, 0x9e,
+    0x90, 0x58, 0x2d, 0x01, 0x9c, 0x10, 0x00, 0xec, 0x23, 0x00, 0x94, 0x46, 0x00, 0x3c, 0x06, 0x00,
+    0x1c, 0x03, 0x10, 0x70, 0x04, 0x35, 0x00, 0x08, 0x00, 0x00, 0x34, 0x14, 0x00, 0xf4, 0x0d, 0x10,
+    0x61, 0x04, 0x0e, 0x11, 0x4c, 0x08, 0x0e, 0xc0, 0x82, 0x77, 0x66, 0xff, 0xb2, 0xac, 0xa3, 0x53,
+    0xff, 0xe3, 0xe3, 0x09, 0x00, 0x04, 0x00, 0x50, 0x00, 0x0f, 0x01, 0x00, 0x19, 0x00, 0x40, 0x07,
+    0xb0, 0xec, 0xec, 0xe7, 0x29, 0xb1, 0xa5, 0x98, 0x90, 0x8f, 0x7b, 0x6a, 0x8c, 0x01, 0x10, 0xf9,
+    0xa0, 0x04, 0x00, 0x8c, 0x01, 0x04, 0x08, 0x00, 0x00, 0x60, 0x12, 0x00, 0x00, 0x18, 0x00, 0xf8,
+    0x0a, 0x13, 0x6b, 0xb0, 0x04, 0xc0, 0x6a, 0x5d, 0x49, 0xff, 0x6f, 0x62, 0x52, 0xff, 0xa1, 0x99,
+    0x8f, 0xed, 0x54, 0x0c, 0x00, 0x4c, 0x00, 0x05, 0x01, 0x00, 0x0f, 0xeb, 0x00, 0x07, 0x0f, 0x1b,
+    0x00, 0x09, 0xc1, 0x00, 0xe5, 0xe0, 0xe0, 0x31, 0xad, 0xa2, 0x95, 0xa4, 0x94, 0x85, 0x76, 0x04,
+    0x49, 0x70, 0x84, 0x72, 0x5f, 0xfc, 0x82, 0x70, 0x5e, 0x04, 0x00, 0x02, 0xd8, 0x20, 0x01, 0x84,
+    0x01, 0x02, 0x04, 0x00, 0x00, 0x84, 0x12, 0xf0, 0x01, 0x7d, 0x6b, 0x5a, 0xf9, 0x7c, 0x6b, 0x5b,
+    0xff, 0x88, 0x7a, 0x6d, 0xff, 0xca, 0xc6, 0xbf, 0x48, 0x44, 0x00, 0x0f, 0x01, 0x00, 0x26, 0x07,
+    0x99, 0x00, 0x71, 0xda, 0xd1, 0xcc, 0x37, 0xa0, 0x8a, 0x79, 0x20, 0x12, 0x00, 0x8c, 0x01, 0x00,
+    0xd4, 0x16, 0x00, 0xa0, 0x33, 0x00, 0x0c, 0x03, 0x00, 0x84, 0x01, 0x00, 0x38, 0x06, 0x00, 0x90,
+    0x01, 0x10, 0x6e, 0x90, 0x01, 0x01, 0xa0, 0x12, 0x04, 0x04, 0x00, 0x20, 0x4c, 0xfb, 0x20, 0x01,
+    0x00, 0xf4, 0x08, 0x80, 0x7b, 0x70, 0x5d, 0xff, 0xb2, 0xac, 0xa0, 0x84, 0x7c, 0x24, 0x00, 0x84,
+    0x56, 0x00, 0x58, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0xb1, 0xff, 0xff, 0xff, 0x13, 0xb6, 0xac, 0xa1,
+    0x90, 0x9a, 0x89, 0x7a, 0xa4, 0x04, 0x40, 0x8a, 0x76, 0x64, 0xfc, 0x84, 0x01, 0x0c, 0x04, 0x00,
+    0x00, 0x94, 0x01, 0x00, 0x04, 0x00, 0x00, 0xf8, 0x0a, 0x02, 0xb4, 0x39, 0x02, 0xe0, 0x3f, 0x31,
+    0x68, 0x5a, 0x47, 0xe0, 0x30, 0x04, 0x50, 0x08, 0x0f, 0xa8, 0x03, 0x01, 0x0d, 0x11, 0x00, 0x0f,
+    0x01, 0x00, 0x0c, 0x00, 0xc4, 0x1c, 0x80, 0xe7, 0xe7, 0xe2, 0x35, 0xc5, 0xbb, 0xb3, 0x65, 0xa0,
+    0x4d, 0x00, 0x78, 0x01, 0x00, 0x08, 0x03, 0x00, 0x84, 0x01, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x54,
+    0x00, 0x28, 0x0f, 0xff, 0x00, 0x79, 0x68, 0x58, 0xf9, 0x76, 0x68, 0x5e, 0xff, 0x87, 0x7c, 0x78,
+    0xff, 0xcc, 0xc9, 0xc9, 0x44, 0x0e, 0x1e, 0x0f, 0x01, 0x00, 0x05, 0x00, 0xa0, 0x02, 0x31, 0xaf,
+    0x9c, 0x8d, 0x5c, 0x53, 0x00, 0x64, 0x53, 0x00, 0xec, 0x19, 0x00, 0x3c, 0x06, 0x00, 0x74, 0x00,
+    0x00, 0x48, 0x2e, 0x00, 0x48, 0x17, 0x01, 0x24, 0x03, 0x10, 0x61, 0x18, 0x03, 0x00, 0x84, 0x01,
+    0x00, 0x04, 0x00, 0x11, 0x4d, 0x04, 0x00, 0x00, 0x98, 0x34, 0xb1, 0x6a, 0x5e, 0x49, 0xfb, 0x68,
+    0x5a, 0x44, 0xff, 0x69, 0x5c, 0x47, 0xb8, 0x1d, 0x7b, 0x86, 0x7b, 0x6a, 0xff, 0xff, 0xe6, 0xe6,
+    0x84, 0x23, 0x0a, 0x01, 0x00, 0x00, 0x48, 0x03, 0x90, 0xd0, 0xca, 0xc1, 0x57, 0x9f, 0x8f, 0x81,
+    0xff, 0x8d, 0xcc, 0x13, 0x21, 0x6e, 0x5b, 0x58, 0x50, 0x00, 0x7c, 0x01, 0x0c, 0x04, 0x00, 0x00,
+    0x5c, 0x23, 0x00, 0x08, 0x00, 0x00, 0x90, 0x01, 0x00, 0x90, 0x45, 0x00, 0xc0, 0x11, 0x00, 0x78,
+    0x00, 0x00, 0x64, 0x19, 0x00, 0x30, 0x13, 0x70, 0x7a, 0x6d, 0x5a, 0xff, 0xc2, 0xba, 0xb2, 0x80,
+    0x38, 0x0f, 0x40, 0x07, 0x2a, 0x0c, 0x01, 0x00, 0x00, 0xb4, 0x20, 0x31, 0x99, 0x8a, 0x7c, 0xa4,
+    0x04, 0x00, 0xe0, 0x0d, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0xd8, 0x07, 0xf0, 0x01, 0x7a,
+    0x69, 0x58, 0xfc, 0x71, 0x63, 0x5a, 0xff, 0x7b, 0x72, 0x71, 0xff, 0xcc, 0xcc, 0xcc, 0x41, 0x30,
+    0x00, 0x0f, 0x01, 0x00, 0x35, 0x40, 0xcd, 0xc0, 0xb6, 0x4d, 0x8c, 0x56, 0x00, 0xfc, 0x24, 0x00,
+    0x20, 0x39, 0x00, 0x6c, 0x23, 0x00, 0xc4, 0x05, 0x00, 0xf8, 0x00, 0x00, 0x1c, 0x03, 0x02, 0x04,
+    0x00, 0x02, 0x68, 0x1a, 0x00, 0x8c, 0x01, 0x00, 0x08, 0x01, 0x00, 0x8c, 0x01, 0x10, 0x6e, 0x24,
+    0x47, 0x01, 0x18, 0x01, 0x00, 0x00, 0x41, 0x00, 0xb4, 0x02, 0xef, 0x4a, 0xff, 0x64, 0x56, 0x40,
+    0xff, 0x65, 0x57, 0x41, 0xff, 0xb9, 0xb3, 0xa8, 0x5b, 0xac, 0x02, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x0f, 0xd0, 0xb9, 0xad, 0xa4, 0x86, 0x8c, 0x7a, 0x69, 0xff, 0x7f, 0x6b, 0x58, 0xff, 0x87,
+    0x64, 0x5e, 0x00, 0xb0, 0x4b, 0x00, 0x04, 0x00, 0x00, 0xb8, 0x51, 0x21, 0x75, 0x63, 0x08, 0x00,
+    0x00, 0x04, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x3c, 0x05, 0x00, 0x04, 0x00, 0x32, 0x88, 0x75, 0x62,
+    0x28, 0x02, 0x10, 0x63, 0x4c, 0x2d, 0x01, 0xd8, 0x17, 0x10, 0xfc, 0xc4, 0x11, 0x30, 0x8a, 0x7e,
+    0x6e, 0x24, 0x03, 0x0f, 0xa8, 0x29, 0x2e, 0x00, 0x01, 0x00, 0x04, 0xb8, 0x00, 0x00, 0x04, 0x05,
+    0x31, 0xa2, 0x94, 0x87, 0x3c, 0x06, 0x00, 0xa0, 0x0c, 0x00, 0x8c, 0x01, 0x00, 0x4c, 0x12, 0x00,
+    0x94, 0x12, 0x00, 0xfc, 0x16, 0x80, 0x76, 0x69, 0x64, 0xff, 0xa4, 0x9d, 0xa0, 0xc4, 0xac, 0x11,
+    0x00, 0x30, 0x00, 0x0f, 0x01, 0x00, 0x31, 0x00, 0x1c, 0x03, 0x31, 0xa8, 0x92, 0x81, 0xb8, 0x2b,
+    0x40, 0x9e, 0x86, 0x74, 0xfb, 0x34, 0x2b, 0x00, 0xc8, 0x16, 0x00, 0xa0, 0x41, 0x00, 0xc4, 0x18,
+    0x00, 0x88, 0x01, 0x00, 0x04, 0x00, 0x00, 0x24, 0x03, 0x02, 0x38, 0x06, 0x00, 0x08, 0x0e, 0x03,
+    0x90, 0x01, 0x03, 0x8c, 0x01, 0x00, 0x88, 0x4b, 0x01, 0x04, 0x00, 0x10, 0x61, 0x40, 0x04, 0x20,
+    0x45, 0xfb, 0x28, 0x03, 0x20, 0x9a, 0x92, 0xd3, 0x2b, 0x0a, 0x70, 0x2e, 0x04, 0xe8, 0x00, 0x40,
+    0xec, 0xec, 0xec, 0x1b, 0x8c, 0x01, 0x00, 0xf8, 0x03, 0x40, 0x85, 0x72, 0x60, 0xfc, 0x14, 0x1e,
+    0x00, 0x84, 0x48, 0x00, 0x6c, 0x29, 0x00, 0x24, 0x06, 0x00, 0x04, 0x00, 0x08, 0x0c, 0x00, 0x02,
+    0x04, 0x00, 0x11, 0x62, 0x08, 0x00, 0x00, 0xb4, 0x01, 0x00, 0xec, 0x08, 0x31, 0x76, 0x67, 0x55,
+    0x94, 0x01, 0x00, 0xa8, 0x28, 0x00, 0x08, 0x43, 0x00, 0xb0, 0x0e, 0x4f, 0xb4, 0xac, 0xa4, 0x7b,
+    0x24, 0x03, 0x0e, 0x01, 0x82, 0x00, 0x0f, 0x01, 0x00, 0x0b, 0x04, 0xa8, 0x00, 0x71, 0xff, 0xff,
+    0xff, 0x12, 0xa0, 0x92, 0x84, 0x20, 0x03, 0x00, 0xa4, 0x18, 0x00, 0xe4, 0x0a, 0x01, 0x04, 0x00,
+    0xf0, 0x00, 0x6d, 0x5a, 0xff, 0x77, 0x66, 0x56, 0xff, 0x7d, 0x71, 0x6a, 0xff, 0xeb, 0xe5, 0xe4,
+    0x27, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0x35, 0x40, 0xcb, 0xc0, 0xb7, 0x59, 0x18, 0x2a, 0x31, 0x9e,
+    0x85, 0x72, 0xf8, 0x32, 0x31, 0x9d, 0x85, 0x74, 0x04, 0x0e, 0x31, 0x76, 0x66, 0x52, 0xf4, 0x02,
+    0x02, 0x8c, 0x01, 0x0c, 0x38, 0x06, 0x00, 0x8c, 0x01, 0x13, 0x4e, 0x1c, 0x03, 0x03, 0x8c, 0x01,
+    0x03, 0x04, 0x00, 0x31, 0x69, 0x5c, 0x46, 0x98, 0x01, 0x40, 0xa7, 0xa0, 0x99, 0xd1, 0x08, 0x03,
+    0x00, 0x64, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x3c, 0x2d, 0x31, 0x94, 0x84, 0x74, 0x84, 0x01, 0x00,
+    0xe8, 0x0b, 0x00, 0x08, 0x00, 0x0f, 0x04, 0x00, 0x15, 0x00, 0xa8, 0x01, 0x00, 0x08, 0x00, 0x31,
+    0x7f, 0x6f, 0x5b, 0x90, 0x0c, 0x00, 0x14, 0x0d, 0x40, 0x73, 0x64, 0x51, 0xfc, 0xbc, 0x0f, 0x70,
+    0x81, 0x73, 0x63, 0xff, 0xba, 0xb1, 0xa9, 0x0d, 0x34, 0x0f, 0x94, 0x01, 0x0b, 0x0f, 0x01, 0x00,
+    0x0c, 0x08, 0x90, 0x01, 0x31, 0x9e, 0x91, 0x83, 0xd4, 0x0a, 0x10, 0x7d, 0x28, 0x49, 0x00, 0x78,
+    0x0c, 0x01, 0x04, 0x00, 0x80, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x73, 0x93, 0x5f, 0x23,
+    0xff, 0x0c, 0x2c, 0x00, 0x01, 0x34, 0x00, 0x0f, 0x01, 0x00, 0x0d, 0x0f, 0x25, 0x00, 0x09, 0x71,
+    0xd9, 0xcf, 0xc8, 0x4a, 0xaa, 0x91, 0x81, 0xc4, 0x59, 0x40, 0xa2, 0x8a, 0x78, 0xfb, 0xf0, 0x32,
+    0x00, 0x6c, 0x18, 0x00, 0x80, 0x17, 0x00, 0xa4, 0x04, 0x00, 0x14, 0x03, 0x01, 0x90, 0x01, 0x00,
+    0x84, 0x01, 0x13, 0x60, 0x04, 0x00, 0x00, 0x84, 0x01, 0x00, 0x9c, 0x04, 0x21, 0x60, 0x4b, 0xe8,
+    0x08, 0x00, 0xa4, 0x04, 0x00, 0x88, 0x01, 0x02, 0x28, 0x03, 0x02, 0x00, 0x19, 0x70, 0x72, 0x66,
+    0x58, 0xff, 0xcb, 0xc5, 0xc2, 0x78, 0x10, 0x0f, 0x7f, 0x00, 0x02, 0x00, 0xcc, 0x09, 0x40, 0xc9,
+    0xbf, 0xb8, 0x84, 0x10, 0x0f, 0x00, 0x5c, 0x0d, 0x00, 0x94, 0x01, 0x0f, 0x04, 0x00, 0x19, 0x00,
+    0x90, 0x01, 0x00, 0xe0, 0x64, 0x00, 0x2c, 0x18, 0x00, 0x18, 0x03, 0x00, 0x5c, 0x13, 0xf0, 0x01,
+    0x76, 0x66, 0x54, 0xf9, 0x70, 0x5f, 0x4c, 0xff, 0x8b, 0x7e, 0x6e, 0xff, 0xc4, 0xc0, 0xb7, 0x79,
+    0x68, 0x00, 0x0f, 0x01, 0x00, 0x25, 0x04, 0xb8, 0x00, 0x00, 0x90, 0x01, 0x11, 0x9f, 0x90, 0x01,
+    0x11, 0x5d, 0x64, 0x24, 0x31, 0x7e, 0x6c, 0x5b, 0xd4, 0x1d, 0x00, 0xbc, 0x04, 0x01, 0x90, 0x01,
+    0x20, 0x74, 0x6c, 0x4c, 0x1c, 0x01, 0xd8, 0x09, 0x04, 0x34, 0x00, 0x01, 0x01, 0x00, 0x06, 0x0a,
+    0x00, 0x0f, 0x01, 0x00, 0x16, 0x71, 0xe7, 0xdd, 0xdd, 0x35, 0xb2, 0x9b, 0x8c, 0x94, 0x61, 0x31,
+    0xa6, 0x8b, 0x7a, 0xe4, 0x4e, 0x00, 0x38, 0x5b, 0x00, 0x18, 0x35, 0x00, 0x08, 0x04, 0x10, 0x6d,
+    0xb4, 0x3a, 0x04, 0x8c, 0x01, 0x00, 0x1c, 0x36, 0x00, 0x8c, 0x01, 0x10, 0x60, 0x3c, 0x06, 0x01,
+    0xd0, 0x13, 0xb0, 0xfb, 0x65, 0x58, 0x43, 0xff, 0x66, 0x58, 0x42, 0xff, 0x67, 0x5a, 0x7c, 0x4b,
+    0x11, 0x48, 0x18, 0x00, 0xf0, 0x01, 0x6a, 0x5c, 0x45, 0xfb, 0x6a, 0x5c, 0x48, 0xff, 0x7e, 0x74,
+    0x6d, 0xff, 0xe7, 0xe7, 0xe7, 0x15, 0x68, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x71, 0xeb, 0xeb, 0xe5,
+    0x27, 0x92, 0x81, 0x71, 0x58, 0x29, 0x13, 0x86, 0x88, 0x61, 0x00, 0x34, 0x42, 0x00, 0x68, 0x01,
+    0x00, 0xd8, 0x09, 0x71, 0x84, 0x72, 0x5e, 0xff, 0x84, 0x71, 0x5d, 0x0c, 0x00, 0x20, 0x85, 0x73,
+    0x80, 0x01, 0x00, 0x1c, 0x00, 0x02, 0x04, 0x00, 0x11, 0x86, 0x10, 0x00, 0x51, 0x62, 0xff, 0x80,
+    0x6e, 0x5d, 0x4c, 0x4a, 0x00, 0xac, 0x19, 0x00, 0xc0, 0x04, 0x00, 0x94, 0x01, 0x00, 0xc8, 0x19,
+    0x30, 0x8c, 0x7f, 0x6f, 0xb8, 0x02, 0x09, 0x2c, 0x05, 0x0f, 0x01, 0x00, 0x19, 0x04, 0x5c, 0x01,
+    0x00, 0x90, 0x01, 0x01, 0x20, 0x03, 0x14, 0x70, 0x90, 0x01, 0x13, 0x5a, 0x04, 0x00, 0x00, 0x50,
+    0x1d, 0x4f, 0x58, 0xff, 0x80, 0x75, 0x90, 0x01, 0x04, 0x0f, 0x01, 0x00, 0x1c, 0x00, 0x34, 0x06,
+    0x71, 0xb3, 0x9c, 0x8c, 0xed, 0xa6, 0x8b, 0x78, 0x20, 0x39, 0x00, 0xcc, 0x2e, 0x00, 0x64, 0x3f,
+    0x00, 0xb4, 0x2c, 0x32, 0x76, 0x68, 0x54, 0x9c, 0x04, 0x00, 0x04, 0x00, 0x16, 0x61, 0x90, 0x01,
+    0x00, 0x18, 0x03, 0xf1, 0x08, 0x6a, 0x5e, 0x4b, 0xf8, 0x68, 0x5c, 0x4c, 0xff, 0x71, 0x66, 0x58,
+    0xff, 0x7d, 0x72, 0x63, 0xff, 0x80, 0x76, 0x64, 0xff, 0x7a, 0x6e, 0x5b, 0xd0, 0x04, 0x31, 0x69,
+    0x5b, 0x46, 0xa0, 0x0d, 0x70, 0x75, 0x69, 0x5a, 0xff, 0x97, 0x90, 0x8d, 0x10, 0x01, 0x0f, 0x14,
+    0x40, 0x00, 0x10, 0x01, 0x7c, 0x00, 0x01, 0xb8, 0x00, 0x00, 0xb0, 0x24, 0x31, 0x9e, 0x90, 0x82,
+    0x28, 0x14, 0x00, 0x14, 0x0f, 0x00, 0x78, 0x0e, 0x00, 0x28, 0x07, 0x30, 0x81, 0x6e, 0x5b, 0x88,
+    0x0d, 0x01, 0x24, 0x04, 0x31, 0x84, 0x71, 0x61, 0x64, 0x06, 0x31, 0x82, 0x70, 0x5e, 0x98, 0x0d,
+    0x00, 0x8c, 0x01, 0x04, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x60, 0x07, 0x04,
+    0x64, 0x1e, 0x00, 0x8c, 0x01, 0x31, 0x77, 0x67, 0x53, 0x30, 0x23, 0x4f, 0xa8, 0x9d, 0x8f, 0x92,
+    0x24, 0x0f, 0x25, 0x04, 0xa4, 0x00, 0x04, 0x90, 0x01, 0x00, 0x8c, 0x0f, 0x00, 0x1c, 0x22, 0x00,
+    0x6c, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x5c, 0x07, 0x20, 0x78, 0x68, 0x90, 0x01, 0x1f, 0x6b, 0x90,
+    0x01, 0x13, 0x0f, 0x1a, 0x00, 0x07, 0x00, 0x38, 0x00, 0x60, 0x06, 0xc0, 0xac, 0x9d, 0x8d, 0xa7,
+    0x9c, 0x45, 0x21, 0x8d, 0x7b, 0x68, 0x4d, 0x00, 0x74, 0x50, 0x00, 0xa8, 0x48, 0x02, 0x1c, 0x47,
+    0x00, 0x3c, 0x4d, 0x00, 0x90, 0x01, 0x03, 0xbc, 0x07, 0x01, 0x04, 0x00, 0x02, 0xd0, 0x4e, 0xff,
+    0x1c, 0x65, 0x58, 0x49, 0xff, 0x65, 0x5b, 0x57, 0xff, 0x88, 0x82, 0x83, 0xe9, 0xcc, 0xc9, 0xc9,
+    0x55, 0xdd, 0xdd, 0xd9, 0x35, 0xa2, 0x9a, 0x8f, 0xca, 0x83, 0x78, 0x69, 0xd6, 0x74, 0x68, 0x57,
+    0xca, 0x73, 0x68, 0x57, 0xdc, 0x8b, 0x82, 0x7b, 0xf8, 0xeb, 0xeb, 0xeb, 0x10, 0x40, 0x03, 0x0b,
+    0x98, 0x00, 0x71, 0xea, 0xea, 0xea, 0x24, 0x91, 0x80, 0x71, 0xb4, 0x04, 0x00, 0xf8, 0x3e, 0x00,
+    0xd4, 0x27, 0xf1, 0x04, 0x88, 0x78, 0x6a, 0xff, 0x8b, 0x7d, 0x73, 0xff, 0x90, 0x85, 0x7e, 0xe8,
+    0x9b, 0x90, 0x8b, 0xc6, 0x8c, 0x7e, 0x72, 0x94, 0x01, 0x70, 0x83, 0x70, 0x5d, 0xfc, 0x84, 0x72,
+    0x60, 0x04, 0x00, 0x01, 0x88, 0x01, 0x00, 0xf4, 0x08, 0x01, 0x08, 0x00, 0x21, 0x72, 0x60, 0x70,
+    0x09, 0x00, 0x90, 0x21, 0x00, 0x18, 0x31, 0x40, 0x7c, 0x6c, 0x58, 0xf9, 0x54, 0x23, 0x00, 0x84,
+    0x07, 0x73, 0xa6, 0x99, 0x8e, 0xc8, 0xf7, 0xf7, 0xf7, 0x54, 0x45, 0x0b, 0x7d, 0x00, 0x0f, 0x01,
+    0x00, 0x08, 0x04, 0x5c, 0x01, 0x00, 0x90, 0x01, 0x20, 0x9d, 0x90, 0x90, 0x01, 0x11, 0x5c, 0x68,
+    0x20, 0x00, 0x8c, 0x01, 0x01, 0x80, 0x20, 0x21, 0x6b, 0x57, 0xc4, 0x50, 0x2f, 0x80, 0x74, 0x90,
+    0x01, 0x14, 0x0f, 0x01, 0x00, 0x04, 0x00, 0x48, 0x07, 0x40, 0xbf, 0xa7, 0x99, 0xce, 0x68, 0x4d,
+    0x00, 0x88, 0x45, 0x40, 0xab, 0x91, 0x80, 0xf7, 0x90, 0x01, 0x00, 0x68, 0x31, 0x00, 0x74, 0x00,
+    0x01, 0x88, 0x01, 0x00, 0xcc, 0x4e, 0x05, 0x8c, 0x01, 0x00, 0xb8, 0x07, 0x00, 0x04, 0x00, 0x00,
+    0xa8, 0x07, 0xa8, 0x47, 0xf8, 0x6e, 0x63, 0x5b, 0xff, 0x92, 0x8d, 0x8e, 0xaa, 0x30, 0x07, 0x00,
+    0x88, 0x00, 0x0b, 0x04, 0x00, 0x05, 0x1c, 0x00, 0x0f, 0x01, 0x00, 0x11, 0xf0, 0x0d, 0xe6, 0xe6,
+    0xe0, 0x29, 0xa7, 0x98, 0x8c, 0xbd, 0xad, 0xa1, 0x96, 0x9b, 0xb1, 0xa7, 0x9d, 0x99, 0xb1, 0xa7,
+    0xa1, 0xa3, 0xbd, 0xb6, 0xb4, 0x93, 0xf1, 0xf1, 0xf1, 0x25, 0xe0, 0x02, 0xb1, 0xc8, 0xc1, 0xbd,
+    0x74, 0x9b, 0x8c, 0x7e, 0xf6, 0x81, 0x70, 0x5d, 0xa4, 0x18, 0x00, 0x88, 0x01, 0x0c, 0x04, 0x00,
+    0x00, 0x54, 0x12, 0x00, 0x48, 0x04, 0x22, 0x7c, 0x6b, 0xac, 0x21, 0x40, 0x7e, 0x6d, 0x5a, 0xf9,
+    0x24, 0x03, 0xb0, 0x83, 0x72, 0x61, 0xff, 0xa3, 0x96, 0x88, 0xd5, 0xed, 0xed, 0xed, 0x98, 0x1b,
+    0x0f, 0x30, 0x01, 0x16, 0x04, 0x2c, 0x00, 0x02, 0x90, 0x01, 0x11, 0x82, 0x1c, 0x01, 0x00, 0x90,
+    0x01, 0x00, 0x5c, 0x00, 0x00, 0x04, 0x00, 0x20, 0x7c, 0x6a, 0x90, 0x03, 0x50, 0x56, 0xff, 0x7f,
+    0x74, 0x6b, 0xfc, 0x20, 0x01, 0xb0, 0x45, 0x04, 0x34, 0x00, 0x0f, 0x01, 0x00, 0x15, 0x00, 0x78,
+    0x64, 0xf1, 0x04, 0xc0, 0xa9, 0x9c, 0xb1, 0xae, 0x91, 0x7f, 0xff, 0xac, 0x8f, 0x7d, 0xff, 0xae,
+    0x92, 0x81, 0xf7, 0xae, 0x93, 0x81, 0x74, 0x33, 0x31, 0x87, 0x74, 0x60, 0x7c, 0x0f, 0x00, 0xe8,
+    0x29, 0x00, 0x34, 0x06, 0x00, 0xa8, 0x04, 0x04, 0x90, 0x01, 0x02, 0x68, 0x50, 0x51, 0x48, 0xfb,
+    0x67, 0x5b, 0x4e, 0x84, 0x42, 0x3f, 0xd9, 0xd9, 0xd9, 0xbc, 0x27, 0x1e, 0x0f, 0x9c, 0x02, 0x01,
+    0x08, 0x12, 0x00, 0x00, 0xcc, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x18, 0x00, 0x04, 0x01, 0x00, 0x60,
+    0xee, 0xee, 0xe8, 0x2c, 0x8e, 0x7e, 0x44, 0x2c, 0x01, 0xd4, 0x56, 0x03, 0xbc, 0x10, 0x02, 0x04,
+    0x00, 0x00, 0x6c, 0x07, 0x04, 0x04, 0x00, 0x00, 0xfc, 0x08, 0x00, 0x98, 0x01, 0x00, 0x08, 0x00,
+    0x40, 0x80, 0x6d, 0x5b, 0xfc, 0xe8, 0x13, 0xb0, 0x7e, 0x6b, 0x59, 0xff, 0x93, 0x84, 0x75, 0xff,
+    0xc5, 0xbf, 0xb5, 0x3d, 0x6b, 0x05, 0x2c, 0x02, 0x0c, 0x64, 0x00, 0x08, 0x01, 0x00, 0x04, 0x1c,
+    0x00, 0x00, 0x90, 0x01, 0x31, 0x9c, 0x90, 0x82, 0xc8, 0x49, 0x00, 0x3c, 0x28, 0x00, 0x80, 0x00,
+    0x02, 0x74, 0x20, 0x3f, 0x56, 0xff, 0x76, 0x90, 0x01, 0x24, 0x00, 0x08, 0x0f, 0xb0, 0xe3, 0xd8,
+    0xd1, 0x48, 0xb6, 0x9b, 0x8c, 0xff, 0xab, 0x8c, 0x7b, 0xa4, 0x53, 0x60, 0xff, 0xb0, 0x94, 0x82,
+    0xfb, 0xb1, 0xdc, 0x4b, 0x20, 0x8b, 0x7a, 0x28, 0x3a, 0x01, 0x0c, 0x11, 0x00, 0xbc, 0x0a, 0x0d,
+    0xa4, 0x04, 0x00, 0x4c, 0x09, 0xf0, 0x00, 0x60, 0x4a, 0xff, 0x67, 0x5b, 0x49, 0xff, 0x71, 0x68,
+    0x65, 0xff, 0xb2, 0xb0, 0xb2, 0x74, 0x54, 0x00, 0x09, 0x4d, 0x01, 0x0f, 0x01, 0x00, 0x50, 0x00,
+    0x48, 0x01, 0x71, 0xb5, 0xac, 0xa1, 0x87, 0x88, 0x77, 0x66, 0xdc, 0x08, 0x00, 0x34, 0x06, 0x00,
+    0x80, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x30, 0x17, 0x04, 0xe8, 0x10, 0x8a, 0x90, 0x7f, 0x6e, 0xff, 0xba, 0xb0, 0xa7, 0x7a, 0xe8, 0x07,
+    0x06, 0xd0, 0x06, 0x08, 0x01, 0x00, 0x31, 0xff, 0xff, 0xfe, 0x14, 0x00, 0x71, 0xff, 0xff, 0xf1,
+    0x12, 0x9b, 0x90, 0x81, 0x10, 0x05, 0x10, 0x79, 0xe4, 0x58, 0x00, 0x60, 0x28, 0x00, 0xb0, 0x23,
+    0x10, 0x6a, 0x44, 0x08, 0x4f, 0x57, 0xff, 0x7f, 0x73, 0x90, 0x01, 0x0b, 0x0c, 0x14, 0x00, 0x00,
+    0xe0, 0x01, 0x80, 0xc9, 0xb7, 0xab, 0x92, 0xb2, 0x97, 0x86, 0xff, 0x18, 0x03, 0x30, 0xb0, 0x92,
+    0x81, 0xd4, 0x31, 0x41, 0xfb, 0xb2, 0x95, 0x83, 0x3c, 0x06, 0x00, 0x68, 0x0c, 0x00, 0xdc, 0x0e,
+    0x00, 0x34, 0x06, 0x01, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x03, 0x88, 0x01, 0x01, 0x04, 0x00, 0xa1,
+    0x62, 0x4c, 0xff, 0x68, 0x5c, 0x48, 0xfb, 0x68, 0x5d, 0x54, 0x90, 0x1f, 0x0f, 0xd8, 0x16, 0x2d,
+    0x0f, 0x01, 0x00, 0x21, 0x04, 0xd4, 0x00, 0x00, 0x48, 0x01, 0x40, 0xaa, 0x9e, 0x91, 0xc8, 0x8c,
+    0x01, 0x00, 0x04, 0x03, 0x00, 0x64, 0x01, 0x0c, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00,
+    0x07, 0x90, 0x01, 0x01, 0xfc, 0x07, 0x40, 0x83, 0x72, 0x60, 0xf9, 0xc8, 0x09, 0xc0, 0x8d, 0x7c,
+    0x6a, 0xff, 0xae, 0xa2, 0x95, 0xcd, 0xe4, 0xdf, 0xdb, 0x38, 0x0c, 0x11, 0x00, 0x58, 0x00, 0x04,
+    0x01, 0x00, 0x08, 0x70, 0x13, 0x05, 0x74, 0x00, 0x61, 0xf2, 0xf2, 0x13, 0x9b, 0x8e, 0x81, 0x70,
+    0x00, 0x31, 0x78, 0x68, 0x54, 0x08, 0x0c, 0x01, 0x90, 0x01, 0x16, 0x69, 0x90, 0x01, 0x0f, 0x38,
+    0x13, 0x09, 0x04, 0x01, 0x00, 0x00, 0x88, 0x0d, 0x80, 0xe2, 0xda, 0xd6, 0x3e, 0xba, 0xa6, 0x97,
+    0xf6, 0x30, 0x30, 0x31, 0xaa, 0x8c, 0x7a, 0x90, 0x01, 0x71, 0xb4, 0x96, 0x86, 0xff, 0xb5, 0x97,
+    0x85, 0x0c, 0x44, 0x00, 0x84, 0x10, 0x00, 0x8c, 0x01, 0x00, 0x9c, 0x13, 0x00, 0x10, 0x03, 0x02,
+    0x34, 0x06, 0x00, 0x04, 0x00, 0x03, 0x8c, 0x01, 0x01, 0x04, 0x00, 0xe0, 0x4c, 0xff, 0x65, 0x58,
+    0x45, 0xff, 0x71, 0x66, 0x5c, 0xff, 0xbc, 0xb7, 0xb7, 0x72, 0x5c, 0x00, 0x0f, 0x01, 0x00, 0x32,
+    0x0f, 0xba, 0x00, 0x06, 0x0e, 0x01, 0x00, 0x04, 0xe8, 0x00, 0x00, 0x94, 0x10, 0x40, 0xbb, 0xb3,
+    0xa8, 0xa8, 0x6c, 0x01, 0x00, 0x38, 0x04, 0x00, 0x78, 0x01, 0x0f, 0x04, 0x00, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0xf4, 0x05, 0x04, 0x90, 0x01, 0x00, 0x6c, 0x1a, 0x40, 0x88, 0x75,
+    0x63, 0xfc, 0xe4, 0x0f, 0x00, 0x64, 0x36, 0x00, 0x48, 0x18, 0xc0, 0xb5, 0xa8, 0x9c, 0xac, 0xea,
+    0xe5, 0xe0, 0x31, 0xf0, 0xf0, 0xe8, 0x22, 0x80, 0x03, 0x00, 0x64, 0x00, 0x04, 0x01, 0x00, 0x05,
+    0x74, 0x00, 0x61, 0xf2, 0xf2, 0x13, 0x9c, 0x8f, 0x81, 0x20, 0x25, 0x00, 0x88, 0x52, 0x00, 0x90,
+    0x01, 0x00, 0x04, 0x00, 0x20, 0x79, 0x68, 0xb4, 0x5d, 0x40, 0x56, 0xff, 0x7d, 0x72, 0x67, 0x18,
+    0x02, 0x70, 0x4e, 0x04, 0x34, 0x00, 0x04, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0xa8, 0x45, 0x00,
+    0x60, 0x1f, 0x40, 0xc8, 0xb9, 0xab, 0x86, 0x68, 0x50, 0x00, 0xd0, 0x0a, 0x00, 0xb4, 0x4b, 0xb1,
+    0xb0, 0x93, 0x82, 0xfb, 0xb3, 0x95, 0x84, 0xff, 0xaf, 0x92, 0x82, 0x54, 0x3f, 0x00, 0x18, 0x4e,
+    0x00, 0x28, 0x06, 0x00, 0x00, 0x44, 0x02, 0x14, 0x03, 0x00, 0x58, 0x0c, 0x00, 0x80, 0x01, 0x06,
+    0xa8, 0x04, 0x00, 0x04, 0x00, 0x00, 0xe8, 0x0d, 0x02, 0xc4, 0x0a, 0x5f, 0x58, 0xff, 0xcb, 0xc7,
+    0xc1, 0x48, 0x4a, 0x26, 0x0f, 0x01, 0x00, 0x31, 0x71, 0xf6, 0xf7, 0xf7, 0x21, 0x99, 0x8c, 0x7d,
+    0xbc, 0x21, 0x00, 0x14, 0x06, 0x00, 0x74, 0x01, 0x00, 0x04, 0x00, 0x00, 0x84, 0x01, 0x00, 0x04,
+    0x00, 0x00, 0x0c, 0x00, 0x08, 0x04, 0x00, 0x00, 0x0c, 0x09, 0x00, 0xa8, 0x0a, 0x00, 0x84, 0x09,
+    0x00, 0x68, 0x11, 0x00, 0xe4, 0x4b, 0x00, 0xfc, 0x1b, 0x00, 0x04, 0x13, 0x00, 0x14, 0x1e, 0x00,
+    0xe4, 0x1a, 0xfc, 0x01, 0x94, 0x7f, 0x6e, 0xff, 0xa1, 0x8e, 0x7f, 0xff, 0xd3, 0xcd, 0xc4, 0x57,
+    0xf5, 0xf5, 0xf5, 0x1a, 0x00, 0x04, 0x00, 0x08, 0x45, 0x71, 0x9b, 0x8e, 0x80, 0xff, 0x7d, 0x6d,
+    0x5b, 0x60, 0x23, 0x04, 0xe4, 0x48, 0x00, 0x0c, 0x00, 0x70, 0x72, 0x63, 0x53, 0xff, 0x7d, 0x71,
+    0x69, 0x50, 0x21, 0x09, 0xac, 0x37, 0x00, 0x34, 0x00, 0x80, 0xf2, 0xec, 0xec, 0x28, 0xd3, 0xc7,
+    0xbd, 0x68, 0xe0, 0x4b, 0x00, 0x10, 0x66, 0x02, 0xb4, 0x4b, 0x50, 0x7a, 0xff, 0xaa, 0x8f, 0x7c,
+    0xb8, 0x07, 0x00, 0x90, 0x01, 0x41, 0xff, 0xac, 0x90, 0x7f, 0xb8, 0x15, 0x00, 0x9c, 0x06, 0x02,
+    0xb8, 0x18, 0x00, 0xcc, 0x24, 0x04, 0xa4, 0x04, 0x03, 0x90, 0x01, 0x00, 0x04, 0x00, 0x00, 0x88,
+    0x01, 0x00, 0x04, 0x00, 0x01, 0x70, 0x0f, 0x00, 0x50, 0x5b, 0x11, 0x47, 0x28, 0x03, 0x80, 0x85,
+    0x7b, 0x69, 0xff, 0xe4, 0xe4, 0xe4, 0x1c, 0x74, 0x00, 0x0f, 0x01, 0x00, 0x31, 0x01, 0x4d, 0x02,
+    0x01, 0x05, 0x00, 0x0f, 0x01, 0x00, 0x0f, 0x00, 0xc0, 0x02, 0x40, 0xb2, 0xa7, 0x9f, 0x9f, 0x18,
+    0x1a, 0x00, 0xb4, 0x1e, 0x00, 0x70, 0x01, 0x01, 0x04, 0x00, 0x02, 0x34, 0x1d, 0x02, 0x0c, 0x00,
+    0x07, 0x04, 0x00, 0x00, 0x8c, 0x01, 0x04, 0x04, 0x00, 0x00, 0x28, 0x03, 0x00, 0x14, 0x16, 0x20,
+    0x89, 0x76, 0xec, 0x4b, 0x00, 0x6c, 0x1c, 0x02, 0xec, 0x2e, 0x00, 0xb4, 0x22, 0x00, 0x84, 0x76,
+    0x00, 0xb8, 0x79, 0x40, 0x9e, 0x8b, 0x7a, 0xff, 0xfc, 0x71, 0xc0, 0xc6, 0xb9, 0xb1, 0x75, 0xd8,
+    0xcf, 0xcb, 0x3b, 0xe6, 0xe1, 0xdc, 0x33, 0xec, 0x05, 0x71, 0xf2, 0xf2, 0xf2, 0x26, 0x91, 0x84,
+    0x75, 0x4c, 0x0b, 0x00, 0xe0, 0x0c, 0x02, 0x8c, 0x01, 0x00, 0x4c, 0x47, 0xf1, 0x1e, 0x54, 0xff,
+    0x72, 0x62, 0x51, 0xff, 0x7d, 0x70, 0x65, 0xff, 0xbf, 0xb6, 0xb1, 0x97, 0xe9, 0xe5, 0xe5, 0x3b,
+    0xe8, 0xe3, 0xdd, 0x2d, 0xdb, 0xd2, 0xce, 0x39, 0xbd, 0xae, 0xa3, 0xa3, 0xad, 0x99, 0x89, 0xff,
+    0xa5, 0x8d, 0x7c, 0xff, 0x9f, 0x85, 0x74, 0xff, 0xa1, 0x86, 0x74, 0xf4, 0x37, 0x32, 0xaa, 0x8f,
+    0x7e, 0xcc, 0x59, 0x21, 0x90, 0x7f, 0xa0, 0x48, 0x00, 0x1c, 0x02, 0x00, 0xc4, 0x5f, 0x00, 0x84,
+    0x01, 0x00, 0x48, 0x09, 0x00, 0x84, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x90, 0x01, 0x01, 0x04, 0x00, 0x07, 0x8c, 0x01, 0x04, 0x04, 0x00, 0xb0, 0x6a, 0x5d, 0x47,
+    0xf8, 0x6f, 0x62, 0x4c, 0xff, 0x91, 0x88, 0x7a, 0xbc, 0x39, 0x0f, 0x48, 0x22, 0x2a, 0x0f, 0x01,
+    0x00, 0x21, 0x40, 0xcd, 0xc7, 0xc0, 0x4d, 0x20, 0x0e, 0x00, 0x90, 0x2f, 0x4c, 0x7e, 0x6d, 0x5a,
+    0xfc, 0x74, 0x01, 0x00, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x90, 0x0a, 0x00,
+    0x08, 0x00, 0x04, 0x04, 0x00, 0x01, 0x10, 0x00, 0x30, 0x6e, 0x5a, 0xff, 0x3c, 0x52, 0x00, 0x04,
+    0x10, 0x00, 0xb4, 0x17, 0x00, 0x44, 0x24, 0x01, 0xfc, 0x28, 0x00, 0x7c, 0x2a, 0x21, 0x80, 0x6e,
+    0xa0, 0x1e, 0x71, 0x91, 0x79, 0x67, 0xff, 0x91, 0x78, 0x66, 0x88, 0x2a, 0xf0, 0x01, 0xa6, 0x92,
+    0x82, 0xff, 0xc2, 0xb2, 0xa7, 0xc6, 0xbb, 0xad, 0xa2, 0xac, 0x85, 0x75, 0x64, 0xfc, 0xfc, 0x0f,
+    0x01, 0x88, 0x01, 0x03, 0x04, 0x00, 0x00, 0x50, 0x2b, 0xf1, 0x04, 0x76, 0x66, 0x54, 0xfc, 0x80,
+    0x6f, 0x5f, 0xfc, 0x9a, 0x89, 0x7b, 0xff, 0xaa, 0x98, 0x8b, 0xff, 0xa5, 0x90, 0x80, 0x20, 0x17,
+    0x01, 0x70, 0x37, 0x21, 0x81, 0x6e, 0xe0, 0x65, 0x00, 0x0c, 0x47, 0x00, 0x3c, 0x4d, 0x31, 0xaa,
+    0x90, 0x7f, 0xd0, 0x3f, 0x00, 0xb8, 0x3d, 0x00, 0x18, 0x61, 0x00, 0xd8, 0x1a, 0x31, 0x73, 0x66,
+    0x52, 0x1c, 0x33, 0x00, 0x00, 0x03, 0x00, 0xac, 0x04, 0x08, 0x8c, 0x01, 0x00, 0x14, 0x00, 0x01,
+    0x88, 0x01, 0x00, 0x04, 0x00, 0x0b, 0x8c, 0x01, 0x01, 0xac, 0x12, 0x20, 0x5f, 0x4a, 0x1c, 0x11,
+    0x90, 0xf8, 0x74, 0x68, 0x54, 0xff, 0x9b, 0x93, 0x86, 0xb3, 0x24, 0x01, 0x0f, 0x01, 0x00, 0x55,
+    0x71, 0xda, 0xd7, 0xd0, 0x4c, 0x91, 0x83, 0x73, 0x58, 0x01, 0x40, 0x7c, 0x6b, 0x58, 0xf9, 0x64,
+    0x01, 0x0f, 0x04, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0xa0, 0x0a, 0x04, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x80, 0x11,
+    0x00, 0x98, 0x36, 0x00, 0x78, 0x2d, 0x10, 0x94, 0x4c, 0x6d, 0x12, 0x80, 0xf0, 0x19, 0x00, 0xe4,
+    0x33, 0x10, 0x9b, 0x04, 0x00, 0x00, 0xb8, 0x68, 0x61, 0x83, 0x70, 0xff, 0x9e, 0x84, 0x71, 0xac,
+    0x2d, 0x00, 0x84, 0x03, 0x40, 0x76, 0x67, 0x54, 0xfc, 0x88, 0x01, 0x04, 0x04, 0x00, 0x00, 0x60,
+    0x2e, 0x00, 0x2c, 0x03, 0x00, 0x9c, 0x36, 0x00, 0x70, 0x32, 0x00, 0x50, 0x1d, 0x00, 0x68, 0x37,
+    0x00, 0x80, 0x3a, 0x00, 0xcc, 0x0d, 0x00, 0x54, 0x36, 0x00, 0x90, 0x48, 0x00, 0xe8, 0x42, 0x00,
+    0x30, 0x17, 0x00, 0x04, 0x39, 0x00, 0xd8, 0x27, 0x00, 0xe0, 0x19, 0x00, 0x04, 0x15, 0x00, 0x54,
+    0x01, 0x00, 0x00, 0x11, 0x00, 0x20, 0x14, 0x00, 0x08, 0x00, 0x01, 0x04, 0x00, 0x01, 0x88, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0xa4, 0x04, 0x04, 0x84, 0x01, 0x04, 0x08, 0x00, 0x0a, 0x04, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0xdc, 0x23, 0x8c, 0x63, 0x56, 0x3f, 0xff, 0x82, 0x79, 0x65, 0xba, 0x9c, 0x08,
+    0x0f, 0x01, 0x00, 0x06, 0x0f, 0x90, 0x04, 0x0a, 0x0f, 0x1d, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x00,
+    0xc4, 0x07, 0x40, 0xa2, 0x95, 0x88, 0xe8, 0x14, 0x01, 0x40, 0x7a, 0x69, 0x55, 0xf9, 0x08, 0x00,
+    0x00, 0x54, 0x01, 0x08, 0x04, 0x00, 0x00, 0x74, 0x01, 0x00, 0xac, 0x2f, 0x01, 0x38, 0x0f, 0x21,
+    0x6c, 0x58, 0x10, 0x00, 0x04, 0x18, 0x00, 0x00, 0x84, 0x01, 0x08, 0x04, 0x00, 0x00, 0x80, 0x14,
+    0x00, 0x60, 0x31, 0x00, 0x0c, 0x00, 0x00, 0xcc, 0x2e, 0x00, 0x2c, 0x03, 0x00, 0x4c, 0x23, 0x00,
+    0xdc, 0x33, 0x10, 0x99, 0x60, 0x3d, 0x00, 0xf4, 0x3e, 0x04, 0x28, 0x4d, 0x00, 0x24, 0x64, 0x21,
+    0x82, 0x70, 0xf0, 0x04, 0x01, 0x10, 0x03, 0x03, 0x8c, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x64, 0x2e,
+    0x20, 0x78, 0x67, 0x90, 0x01, 0x11, 0x60, 0xe0, 0x1e, 0x00, 0x28, 0x00, 0x00, 0xc0, 0x35, 0x00,
+    0x90, 0x01, 0x00, 0x7c, 0x01, 0x00, 0x40, 0x00, 0x00, 0x48, 0x00, 0x00, 0xfc, 0x2d, 0x01, 0x58,
+    0x32, 0x00, 0x54, 0x61, 0x03, 0x14, 0x22, 0x01, 0xb8, 0x26, 0x00, 0x80, 0x01, 0x00, 0x04, 0x00,
+    0x01, 0x80, 0x01, 0x06, 0x04, 0x00, 0x02, 0x10, 0x03, 0x10, 0x4b, 0x8c, 0x1e, 0x32, 0xfb, 0x69,
+    0x5c, 0xb0, 0x21, 0x00, 0xbc, 0x18, 0x00, 0x14, 0x00, 0x00, 0xc4, 0x01, 0x01, 0x08, 0x00, 0x04,
+    0x90, 0x01, 0xe9, 0x5f, 0x4a, 0xff, 0x60, 0x52, 0x3b, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xdf, 0xdf,
+    0xdb, 0x20, 0x74, 0x0f, 0x01, 0x00, 0x45, 0x00, 0xcc, 0x16, 0x40, 0x94, 0x86, 0x77, 0xee, 0xa8,
+    0x04, 0x40, 0x79, 0x68, 0x54, 0xfc, 0x64, 0x01, 0x08, 0x04, 0x00, 0x00, 0x90, 0x0f, 0x00, 0x5c,
+    0x01, 0x01, 0x04, 0x00, 0x10, 0x6a, 0x70, 0x34, 0x00, 0xc4, 0x2f, 0x11, 0x54, 0x90, 0x0a, 0x00,
+    0x98, 0x0a, 0x00, 0x18, 0x00, 0x00, 0x08, 0x00, 0x04, 0x04, 0x00, 0x00, 0x88, 0x2c, 0x00, 0xe4,
+    0x12, 0x00, 0xdc, 0x02, 0x00, 0x54, 0x3f, 0x00, 0x58, 0x0c, 0x00, 0x70, 0x01, 0x00, 0xf4, 0x07,
+    0x00, 0x1c, 0x45, 0x31, 0x92, 0x7e, 0x6b, 0xa8, 0x1e, 0x00, 0x58, 0x04, 0x00, 0x30, 0x53, 0x00,
+    0x58, 0x48, 0x00, 0x74, 0x0e, 0x10, 0x74, 0x90, 0x01, 0x03, 0x04, 0x00, 0x00, 0x1c, 0x03, 0x02,
+    0x90, 0x01, 0x11, 0x55, 0x90, 0x01, 0x00, 0xe0, 0x04, 0x00, 0x88, 0x3a, 0x00, 0x68, 0x03, 0x00,
+    0x7c, 0x2c, 0x00, 0xd4, 0x29, 0x00, 0x2c, 0x3f, 0x00, 0x4c, 0x08, 0x00, 0x00, 0x02, 0x31, 0x77,
+    0x68, 0x55, 0xb8, 0x26, 0x00, 0x44, 0x01, 0x00, 0xc0, 0x1b, 0x00, 0x98, 0x04, 0x04, 0x04, 0x00,
+    0x01, 0x84, 0x01, 0x01, 0xa4, 0x15, 0x00, 0xbc, 0x07, 0x00, 0x70, 0x01, 0x00, 0x0c, 0x2b, 0xf0,
+    0x02, 0x48, 0xfb, 0x67, 0x5c, 0x50, 0xff, 0x6f, 0x65, 0x5a, 0xff, 0x6d, 0x62, 0x51, 0xff, 0x68,
+    0x5b, 0x44, 0x2c, 0x61, 0x10, 0xf9, 0x88, 0x01, 0x02, 0x04, 0x00, 0x00, 0x28, 0x00, 0x00, 0x30,
+    0x11, 0x90, 0x45, 0xf9, 0x69, 0x5c, 0x49, 0xff, 0x85, 0x7b, 0x6d, 0xa0, 0x39, 0x09, 0x34, 0x3b,
+    0x0f, 0x01, 0x00, 0x2a, 0x0f, 0x27, 0x03, 0x08, 0x00, 0x6c, 0x13, 0x40, 0xa4, 0x99, 0x8c, 0xd2,
+    0xa0, 0x2f, 0x30, 0x76, 0x63, 0x50, 0x10, 0x58, 0x10, 0xf9, 0xe4, 0x00, 0x05, 0x04, 0x00, 0x00,
+    0x74, 0x01, 0xf1, 0x03, 0x6a, 0x55, 0xfc, 0x77, 0x66, 0x53, 0xfc, 0x72, 0x63, 0x58, 0xff, 0x7a,
+    0x6c, 0x62, 0xff, 0x7e, 0x6f, 0x5f, 0xc8, 0x59, 0x30, 0x75, 0x64, 0x4f, 0x98, 0x01, 0x10, 0xf9,
+    0x18, 0x55, 0x00, 0x88, 0x01, 0x01, 0xa8, 0x0a, 0x00, 0x74, 0x34, 0x00, 0x94, 0x01, 0x01, 0x0c,
+    0x00, 0x40, 0x57, 0xff, 0x77, 0x68, 0x68, 0x0f, 0x02, 0xf8, 0x02, 0x00, 0x84, 0x29, 0x00, 0x7c,
+    0x01, 0x00, 0x1c, 0x1b, 0x00, 0x1c, 0x1e, 0x31, 0x90, 0x7c, 0x6a, 0x44, 0x21, 0x00, 0x08, 0x30,
+    0x04, 0x88, 0x01, 0x04, 0x04, 0x00, 0x00, 0xe4, 0x17, 0x00, 0xd4, 0x07, 0x00, 0x9c, 0x0e, 0x00,
+    0x84, 0x04, 0x00, 0xb0, 0x0a, 0x00, 0x08, 0x05, 0x00, 0xdc, 0x01, 0x00, 0x1c, 0x0b, 0x00, 0x80,
+    0x09, 0x00, 0xe8, 0x1e, 0x00, 0x7c, 0x04, 0x00, 0x94, 0x04, 0x00, 0xfc, 0x10, 0x02, 0x2c, 0x25,
+    0x15, 0x50, 0x88, 0x01, 0x0a, 0x04, 0x00, 0x00, 0xa0, 0x56, 0x51, 0x4a, 0xf9, 0x69, 0x5c, 0x4b,
+    0xe4, 0x4e, 0xf1, 0x00, 0x81, 0x79, 0x78, 0xff, 0xb6, 0xb0, 0xb0, 0x8b, 0xc3, 0xbf, 0xb8, 0x73,
+    0x8b, 0x81, 0x71, 0x80, 0x01, 0x00, 0x4c, 0x17, 0x00, 0x3c, 0x22, 0x00, 0x0c, 0x00, 0x00, 0x8c,
+    0x01, 0xc0, 0x65, 0x58, 0x42, 0xff, 0x7e, 0x74, 0x69, 0xff, 0xb0, 0xa8, 0xa6, 0x8a, 0x2c, 0x01,
+    0x0f, 0x01, 0x00, 0x55, 0x00, 0x3c, 0x23, 0x40, 0x92, 0x84, 0x75, 0xeb, 0x84, 0x04, 0x30, 0x75,
+    0x63, 0x50, 0x64, 0x01, 0x10, 0xfc, 0x3c, 0x01, 0x00, 0x34, 0x14, 0x40, 0x78, 0x66, 0x51, 0xfc,
+    0x34, 0x65, 0xf0, 0x06, 0x78, 0x6b, 0x61, 0xff, 0x7d, 0x74, 0x75, 0xff, 0x94, 0x8d, 0x8d, 0xdd,
+    0x9f, 0x95, 0x8a, 0xd2, 0x8e, 0x80, 0x71, 0xe3, 0x82, 0xdc, 0x69, 0x20, 0x68, 0x55, 0xdc, 0x32,
+    0x50, 0xfc, 0x79, 0x69, 0x57, 0xfc, 0x94, 0x01, 0x00, 0x84, 0x01, 0x04, 0x04, 0x00, 0x00, 0x24,
+    0x03, 0x06, 0xc0, 0x0a, 0x10, 0x55, 0x24, 0x06, 0x02, 0x04, 0x00, 0x00, 0xec, 0x40, 0x03, 0x0c,
+    0x03, 0x08, 0x04, 0x00, 0x00, 0xd4, 0x17, 0x00, 0x8c, 0x01, 0x00, 0xc4, 0x1e, 0x08, 0x04, 0x00,
+    0x00, 0x9c, 0x01, 0x00, 0x00, 0x03, 0x00, 0x68, 0x3c, 0x13, 0x72, 0x8c, 0x31, 0x01, 0xcc, 0x29,
+    0x03, 0x00, 0x22, 0x05, 0x04, 0x00, 0x05, 0x14, 0x03, 0x00, 0x04, 0x00, 0x00, 0x84, 0x01, 0x00,
+    0x04, 0x00, 0x02, 0x2c, 0x06, 0xf0, 0x05, 0x6a, 0x5e, 0x4c, 0xf6, 0x69, 0x5c, 0x4f, 0xff, 0x73,
+    0x68, 0x63, 0xff, 0x8e, 0x87, 0x89, 0xfc, 0xd1, 0xd1, 0xd4, 0x4e, 0x58, 0x11, 0x00, 0x00, 0x01,
+    0xb1, 0xdb, 0xdb, 0xd7, 0x39, 0x8e, 0x85, 0x75, 0xff, 0x72, 0x65, 0x52, 0xec, 0x1b, 0x00, 0x88,
+    0x01, 0x00, 0x34, 0x0e, 0x00, 0xe8, 0x38, 0x4f, 0xa3, 0x9b, 0x98, 0xbd, 0x3c, 0x06, 0x02, 0x0f,
+    0xe4, 0x02, 0x08, 0x0f, 0x01, 0x00, 0x31, 0x00, 0xac, 0x57, 0xb0, 0x92, 0x84, 0x76, 0xe6, 0x7f,
+    0x6f, 0x5e, 0xff, 0x74, 0x62, 0x4f, 0x44, 0x34, 0xf0, 0x05, 0xf9, 0x75, 0x63, 0x4f, 0xff, 0x7a,
+    0x6b, 0x5a, 0xff, 0x82, 0x77, 0x6d, 0xff, 0x8d, 0x87, 0x87, 0xe8, 0xdc, 0xd8, 0xdc, 0x88, 0x3e,
+    0x01, 0x70, 0x24, 0x00, 0xe8, 0x04, 0x40, 0xb8, 0xaf, 0xa4, 0x93, 0x9c, 0x1a, 0x02, 0x60, 0x34,
+    0x02, 0x80, 0x07, 0x0c, 0x04, 0x00, 0x00, 0x88, 0x01, 0x04, 0x04, 0x00, 0x01, 0x74, 0x01, 0x00,
+    0x70, 0x01, 0x03, 0x04, 0x00, 0x00, 0xfc, 0x32, 0x00, 0x6c, 0x01, 0x00, 0x0c, 0x00, 0x01, 0x04,
+    0x00, 0x07, 0x80, 0x01, 0x08, 0x04, 0x00, 0x00, 0x54, 0x0f, 0x00, 0x7c, 0x01, 0x01, 0x04, 0x00,
+    0x01, 0x50, 0x2b, 0x00, 0x68, 0x2e, 0x04, 0x10, 0x03, 0x04, 0x8c, 0x01, 0x00, 0xe8, 0x1f, 0x00,
+    0x80, 0x01, 0x02, 0x04, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x08, 0x00, 0x00, 0xb4, 0x0a, 0xf0, 0x00,
+    0x69, 0x5d, 0x49, 0xf9, 0x63, 0x58, 0x4e, 0xff, 0x75, 0x6d, 0x6d, 0xff, 0xb1, 0xac, 0xae, 0xa1,
+    0x5f, 0x0d, 0xa8, 0x18, 0xf0, 0x09, 0xff, 0xff, 0xff, 0x10, 0xb6, 0xb2, 0xa8, 0x66, 0x70, 0x64,
+    0x51, 0xf6, 0x71, 0x64, 0x50, 0xd8, 0x80, 0x76, 0x69, 0xe6, 0xb7, 0xb4, 0xae, 0x8b, 0x70, 0x15,
+    0x00, 0x20, 0x00, 0x0e, 0x01, 0x00, 0x0f, 0x91, 0x01, 0x4c, 0x02, 0x94, 0x00, 0x81, 0x0f, 0xa4,
+    0x9a, 0x8d, 0xd0, 0x84, 0x75, 0x64, 0x84, 0x1a, 0xa1, 0x85, 0x77, 0x69, 0xff, 0x96, 0x8c, 0x84,
+    0xf6, 0xd8, 0xd8, 0x4c, 0x02, 0x0d, 0x98, 0x00, 0x00, 0x30, 0x0f, 0x71, 0xec, 0xe8, 0xe8, 0x37,
+    0x97, 0x8a, 0x7c, 0xa0, 0x04, 0x00, 0x80, 0x46, 0x00, 0x78, 0x01, 0x04, 0x04, 0x00, 0x00, 0x80,
+    0x01, 0x0f, 0x04, 0x00, 0x09, 0x00, 0x7c, 0x01, 0x0c, 0x04, 0x00, 0x00, 0x94, 0x07, 0x00, 0x84,
+    0x01, 0x04, 0x04, 0x00, 0x00, 0x9c, 0x27, 0x01, 0x04, 0x00, 0x01, 0x34, 0x1e, 0x06, 0x90, 0x01,
+    0x01, 0x84, 0x01, 0x00, 0x6c, 0x3c, 0x00, 0x04, 0x00, 0x07, 0x44, 0x1a, 0x02, 0x28, 0x06, 0x00,
+    0x14, 0x03, 0x02, 0x04, 0x00, 0xf7, 0x00, 0x6d, 0x61, 0x4b, 0xff, 0x63, 0x57, 0x48, 0xff, 0x70,
+    0x67, 0x65, 0xff, 0xb2, 0xae, 0xb2, 0xfc, 0x1f, 0x02, 0x50, 0x01, 0x0c, 0xc4, 0x11, 0x00, 0x68,
+    0x02, 0x00, 0x08, 0x01, 0x00, 0xc8, 0x05, 0x00, 0x10, 0x00, 0x00, 0x18, 0x00, 0x0f, 0x01, 0x00,
+    0x69, 0x00, 0xa4, 0x0d, 0xf9, 0x00, 0xb5, 0xad, 0xa1, 0x9b, 0xa7, 0x9e, 0x93, 0xa0, 0xbc, 0xb5,
+    0xb0, 0x91, 0xf7, 0xf7, 0xf7, 0x1c, 0x0f, 0x0c, 0x01, 0x00, 0x00, 0x6c, 0x02, 0x70, 0xb4, 0xaa,
+    0xa2, 0xdd, 0x80, 0x71, 0x60, 0x4c, 0x5b, 0x01, 0x68, 0x01, 0x00, 0x8c, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x0c, 0x00, 0x0f, 0x04, 0x00, 0x05, 0x01, 0x9c, 0x04, 0x03, 0x84, 0x01, 0x08, 0x04, 0x00,
+    0x00, 0x84, 0x01, 0x04, 0x04, 0x00, 0x00, 0x88, 0x01, 0x01, 0xa4, 0x04, 0x00, 0x20, 0x03, 0x05,
+    0x8c, 0x01, 0x00, 0x14, 0x03, 0x06, 0x04, 0x00, 0x20, 0x6f, 0x62, 0xc8, 0x07, 0x13, 0x4f, 0x58,
+    0x1d, 0x00, 0x3c, 0x09, 0x04, 0x88, 0x01, 0x02, 0x04, 0x00, 0xb0, 0x6b, 0x5f, 0x48, 0xff, 0x68,
+    0x5c, 0x4e, 0xff, 0x87, 0x7f, 0x7c, 0xe4, 0x79, 0x0d, 0x54, 0x02, 0x0f, 0x01, 0x00, 0x0e, 0x0f,
+    0x92, 0x01, 0x21, 0x0f, 0x34, 0x00, 0x0e, 0x0f, 0x21, 0x00, 0x0e, 0x09, 0x01, 0x00, 0x0f, 0x2e,
+    0x00, 0x19, 0x00, 0xc0, 0x04, 0x80, 0xa9, 0x9d, 0x91, 0xe6, 0x7f, 0x70, 0x5f, 0xff, 0x5c, 0x1f,
+    0x00, 0x78, 0x04, 0x00, 0x70, 0x01, 0x0e, 0x04, 0x00, 0x12, 0x53, 0x2c, 0x47, 0x01, 0x6c, 0x01,
+    0x11, 0x51, 0x70, 0x01, 0x0f, 0x04, 0x00, 0x05, 0x02, 0x0c, 0x03, 0x02, 0x04, 0x00, 0x02, 0x84,
+    0x01, 0x00, 0xa0, 0x04, 0x00, 0x08, 0x00, 0x11, 0x50, 0x98, 0x04, 0x00, 0x70, 0x01, 0x01, 0x2c,
+    0x09, 0x10, 0x5f, 0xb8, 0x0a, 0x22, 0x4b, 0xfc, 0x84, 0x01, 0x02, 0x90, 0x01, 0x00, 0x1c, 0x00,
+    0x00, 0x88, 0x01, 0x01, 0x04, 0x00, 0x20, 0x60, 0x4c, 0x38, 0x09, 0x8f, 0xff, 0x6d, 0x61, 0x50,
+    0xff, 0x93, 0x8b, 0x82, 0xd8, 0x71, 0x1b, 0x01, 0x01, 0x00, 0x0f, 0x2f, 0x00, 0x1c, 0x0f, 0x01,
+    0x00, 0x1e, 0x0f, 0x60, 0x00, 0x3f, 0x00, 0xe0, 0x03, 0x40, 0x8a, 0x7d, 0x6d, 0xee, 0xc0, 0x07,
+    0x00, 0xb0, 0x3a, 0x05, 0x90, 0x01, 0x01, 0x7c, 0x01, 0x00, 0xf4, 0x02, 0x00, 0x8c, 0x01, 0x00,
+    0x04, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x64, 0x01, 0xa0, 0x50, 0xf9, 0x72, 0x63, 0x4f, 0xf9, 0x72,
+    0x63, 0x50, 0xf9, 0xb4, 0x22, 0x00, 0x80, 0x01, 0x00, 0x04, 0x00, 0x00, 0x0c, 0x03, 0x01, 0x04,
+    0x00, 0x03, 0x84, 0x01, 0x01, 0x2c, 0x06, 0x03, 0x84, 0x01, 0x02, 0x90, 0x01, 0x03, 0x94, 0x04,
+    0xb0, 0x60, 0x4c, 0xf9, 0x6c, 0x5f, 0x4a, 0xf9, 0x6c, 0x5e, 0x4b, 0xf7, 0xcc, 0x2a, 0x10, 0x69,
+    0xbc, 0x6d, 0x30, 0x5e, 0x4c, 0xfc, 0x88, 0x01, 0x04, 0x04, 0x00, 0x08, 0x48, 0x0c, 0x00, 0x38,
+    0x31, 0x00, 0x68, 0x29, 0x32, 0x8e, 0x85, 0x77, 0x90, 0x01, 0x0f, 0x03, 0x01, 0x3f, 0x0f, 0x01,
+    0x00, 0x7a, 0x00, 0x08, 0x07, 0x40, 0x79, 0x6a, 0x58, 0xf1, 0xe8, 0x40, 0x00, 0x70, 0x04, 0x02,
+    0x40, 0x09, 0x06, 0x8c, 0x04, 0x00, 0xc4, 0x4b, 0x00, 0x70, 0x01, 0xf1, 0x04, 0x6d, 0x5e, 0x4f,
+    0xf9, 0x68, 0x5b, 0x50, 0xff, 0x76, 0x6a, 0x61, 0xff, 0x82, 0x76, 0x6a, 0xff, 0x7f, 0x72, 0x63,
+    0x74, 0x0c, 0x80, 0x72, 0x63, 0x50, 0xfc, 0x74, 0x65, 0x51, 0xfc, 0x8c, 0x01, 0x02, 0x88, 0x01,
+    0x00, 0x74, 0x31, 0x00, 0x84, 0x01, 0x02, 0x04, 0x00, 0x00, 0x24, 0x06, 0x00, 0x64, 0x01, 0xf0,
+    0x10, 0x6b, 0x5d, 0x4b, 0xf9, 0x69, 0x5b, 0x4c, 0xff, 0x72, 0x66, 0x5b, 0xff, 0x7a, 0x6f, 0x67,
+    0xff, 0x82, 0x79, 0x73, 0xff, 0x90, 0x88, 0x81, 0xff, 0x94, 0x8b, 0x81, 0xff, 0x79, 0x6d, 0x5d,
+    0xa8, 0x42, 0x41, 0xfc, 0x6d, 0x60, 0x4b, 0x98, 0x01, 0x00, 0x88, 0x01, 0x00, 0x04, 0x00, 0x00,
+    0x58, 0x09, 0x00, 0x84, 0x2c, 0x20, 0x67, 0x5a, 0x14, 0x2e, 0x20, 0x6c, 0xcf, 0x64, 0x2f, 0x00,
+    0xb4, 0x00, 0x0f, 0x01, 0x00, 0x63, 0x0f, 0x09, 0x02, 0x44, 0x07, 0x57, 0x00, 0x00, 0x70, 0x02,
+    0x40, 0xd4, 0xd1, 0xcb, 0x53, 0x84, 0x01, 0x32, 0x70, 0x60, 0x4d, 0x8c, 0x01, 0x00, 0x84, 0x48,
+    0x00, 0x0c, 0x03, 0x03, 0x34, 0x3c, 0x00, 0xd8, 0x32, 0xf1, 0x10, 0x6f, 0x5f, 0x4d, 0xfc, 0x68,
+    0x5b, 0x55, 0xff, 0x7f, 0x76, 0x77, 0xff, 0xb9, 0xb4, 0xb4, 0x66, 0xd7, 0xd3, 0xd3, 0x3a, 0xcc,
+    0xc9, 0xc2, 0x50, 0xa5, 0x9c, 0x92, 0xaf, 0x78, 0x6b, 0x58, 0x50, 0x0f, 0x04, 0x84, 0x01, 0x00,
+    0x80, 0x01, 0x00, 0x0c, 0x03, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x9c, 0x07, 0xb0, 0x67,
+    0x5a, 0x4b, 0xf9, 0x6e, 0x64, 0x5a, 0xff, 0x81, 0x78, 0x74, 0x94, 0x18, 0xf0, 0x06, 0x58, 0xd3,
+    0xcf, 0xcf, 0x40, 0xce, 0xcb, 0xce, 0x4e, 0xe3, 0xe3, 0xe3, 0x3f, 0xf4, 0xee, 0xee, 0x2e, 0xa9,
+    0xa3, 0x97, 0x7f, 0x04, 0x03, 0x00, 0xd8, 0x35, 0x00, 0x88, 0x01, 0x06, 0x04, 0x00, 0x02, 0x64,
+    0x0f, 0x31, 0x65, 0x57, 0x40, 0x64, 0x0f, 0x30, 0xc7, 0xc3, 0xbd, 0xd0, 0x07, 0x07, 0xc2, 0x00,
+    0x0f, 0x01, 0x00, 0xbb, 0x00, 0x3c, 0x17, 0x31, 0xa1, 0x97, 0x8a, 0x00, 0x03, 0x40, 0x6e, 0x5e,
+    0x4a, 0xf9, 0x9c, 0x04, 0x00, 0x84, 0x01, 0x00, 0x10, 0x00, 0x04, 0x04, 0x00, 0x40, 0x72, 0x63,
+    0x4e, 0xfc, 0x84, 0x51, 0x80, 0x78, 0x6f, 0x6e, 0xff, 0xcb, 0xc6, 0xcb, 0x59, 0x38, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x14, 0x40, 0x51, 0x83, 0x78, 0x66, 0xff, 0x70, 0xe4, 0x57, 0x00, 0xd8, 0x71,
+    0x02, 0x84, 0x01, 0x00, 0x44, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x2c, 0x06, 0xff, 0x00, 0x6b, 0x5d,
+    0x4b, 0xff, 0x65, 0x5a, 0x51, 0xff, 0x7f, 0x78, 0x77, 0xff, 0xdb, 0xd7, 0xd7, 0x98, 0x36, 0x02,
+    0x71, 0xec, 0xec, 0xe6, 0x29, 0x8c, 0x82, 0x72, 0xf8, 0x10, 0x00, 0x9c, 0x26, 0x00, 0x18, 0x03,
+    0x02, 0x90, 0x01, 0x00, 0xa4, 0x01, 0x00, 0xa4, 0x3f, 0xa6, 0x41, 0xfa, 0x76, 0x6a, 0x59, 0xff,
+    0x9b, 0x93, 0x8d, 0xc2, 0x60, 0x09, 0x0f, 0x01, 0x00, 0x3c, 0x0f, 0xe6, 0x01, 0x05, 0x0f, 0x18,
+    0x00, 0x05, 0x0f, 0x01, 0x00, 0x40, 0x00, 0x10, 0x1a, 0x40, 0xb2, 0xaa, 0xa0, 0xc1, 0x68, 0x50,
+    0x31, 0x6b, 0x5a, 0x47, 0xfc, 0x05, 0x00, 0x84, 0x01, 0x04, 0x04, 0x00, 0x00, 0xa0, 0x0a, 0x00,
+    0x74, 0x18, 0x80, 0x77, 0x6c, 0x63, 0xff, 0xae, 0xab, 0xab, 0xa0, 0x30, 0x00, 0x03, 0x38, 0x00,
+    0x01, 0xa6, 0x00, 0x00, 0x7c, 0x06, 0x40, 0x8b, 0x81, 0x71, 0xf9, 0x20, 0x2e, 0x31, 0x6d, 0x5f,
+    0x4a, 0x80, 0x01, 0x00, 0x88, 0x01, 0x04, 0x78, 0x12, 0x00, 0xa4, 0x01, 0x31, 0x69, 0x5c, 0x4a,
+    0x50, 0x0f, 0x44, 0xa2, 0x9d, 0x9d, 0xce, 0x40, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x54, 0x08, 0x40,
+    0xb6, 0xb1, 0xa5, 0x82, 0xa8, 0x3d, 0x00, 0x0c, 0x03, 0x00, 0x88, 0x01, 0x31, 0x6c, 0x5f, 0x49,
+    0xb4, 0x26, 0x00, 0x84, 0x2e, 0xb5, 0x66, 0x59, 0x43, 0xff, 0x7e, 0x73, 0x65, 0xff, 0xd4, 0xd1,
+    0xd1, 0x34, 0x66, 0x0f, 0x01, 0x00, 0x33, 0x01, 0xc7, 0x00, 0x0f, 0x01, 0x00, 0x23, 0x0f, 0x3b,
+    0x00, 0x28, 0x0f, 0x01, 0x00, 0x09, 0x00, 0x18, 0x1a, 0x90, 0x92, 0x86, 0x78, 0xff, 0x7a, 0x6c,
+    0x5b, 0xff, 0x6d, 0x5c, 0x07, 0x00, 0xa0, 0x02, 0x00, 0x5c, 0x01, 0x40, 0x61, 0x4c, 0xfc, 0x6d,
+    0x40, 0x73, 0xa1, 0x63, 0x55, 0xff, 0x8c, 0x85, 0x83, 0xff, 0xf3, 0xf3, 0xf3, 0x54, 0x3b, 0x08,
+    0x01, 0x00, 0x00, 0x7c, 0x06, 0x80, 0x9b, 0x91, 0x84, 0xff, 0x77, 0x6a, 0x57, 0xff, 0xdc, 0x13,
+    0x00, 0xfc, 0x05, 0x04, 0x8c, 0x01, 0x00, 0x04, 0x00, 0x00, 0x40, 0x09, 0x31, 0x6a, 0x5d, 0x4b,
+    0x24, 0x6c, 0x4f, 0xda, 0xd7, 0xd7, 0x52, 0xdc, 0x02, 0x01, 0x04, 0xdc, 0x01, 0x71, 0xe9, 0xe9,
+    0xe4, 0x2f, 0x8c, 0x81, 0x71, 0x68, 0x2e, 0x31, 0x63, 0x55, 0x3f, 0xe4, 0x1b, 0xf0, 0x01, 0x6c,
+    0x5f, 0x4d, 0xff, 0x74, 0x68, 0x5b, 0xff, 0x86, 0x7d, 0x73, 0xff, 0xcc, 0xc9, 0xc4, 0x68, 0x9c,
+    0x0b, 0x00, 0x2c, 0x00, 0x0f, 0x01, 0x00, 0xcd, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0x23, 0xbe, 0xb7,
+    0xaf, 0x95, 0x92, 0x88, 0x7a, 0xff, 0x84, 0x77, 0x66, 0xff, 0x14, 0x06, 0x00, 0x34, 0x0c, 0xb5,
+    0x7a, 0x6c, 0x5a, 0xff, 0x90, 0x87, 0x7e, 0xff, 0xd2, 0xcf, 0xcf, 0xb4, 0x65, 0x04, 0x40, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xec, 0x0c, 0x40, 0xa5, 0x9d, 0x91, 0xff, 0x74, 0x54, 0x40, 0x67, 0x5a,
+    0x46, 0xfc, 0x84, 0x01, 0x01, 0x4c, 0x0c, 0x00, 0x04, 0x00, 0x01, 0x50, 0x4a, 0x11, 0x4a, 0x58,
+    0x0c, 0x30, 0x77, 0x6c, 0x66, 0xd0, 0x01, 0x10, 0x16, 0x34, 0x00, 0x0f, 0x01, 0x00, 0x05, 0x00,
+    0x3c, 0x05, 0xf3, 0x09, 0xd0, 0xce, 0xc7, 0x68, 0x93, 0x89, 0x7a, 0xff, 0x81, 0x75, 0x64, 0xff,
+    0x8c, 0x81, 0x73, 0xff, 0x9b, 0x93, 0x89, 0xff, 0xca, 0xc5, 0xc3, 0x6a, 0xd8, 0x24, 0x0f, 0x8c,
+    0x01, 0xce, 0x0b, 0x5c, 0x01, 0x10, 0x0a, 0x34, 0x01, 0xf0, 0x01, 0xe9, 0xe4, 0xe0, 0x39, 0xa4,
+    0x9b, 0x90, 0xeb, 0x8b, 0x80, 0x72, 0xff, 0xc1, 0xbc, 0xb2, 0x63, 0x90, 0x26, 0x04, 0xd8, 0x02,
+    0x08, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x08, 0x0f, 0xb1, 0xab, 0xa2, 0x97, 0xee, 0x75, 0x68,
+    0x56, 0xff, 0x64, 0x56, 0x41, 0x90, 0x07, 0x04, 0x04, 0x00, 0x00, 0x88, 0x07, 0x40, 0x69, 0x5b,
+    0x44, 0xfc, 0xf8, 0x10, 0x30, 0x81, 0x78, 0x73, 0xe8, 0x21, 0x01, 0x14, 0x27, 0x0f, 0x01, 0x00,
+    0x01, 0x04, 0x58, 0x00, 0x00, 0x3c, 0x18, 0x80, 0xf6, 0xf6, 0xf6, 0x1e, 0xf6, 0xf6, 0xee, 0x1e,
+    0xc8, 0x0e, 0x40, 0xf6, 0xf6, 0xf6, 0x1c, 0x68, 0x0f, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x00, 0x04,
+    0x28, 0x00, 0x0f, 0x01, 0x00, 0x3b, 0x0f, 0x53, 0x00, 0x40, 0x0f, 0x01, 0x00, 0x3c, 0x00, 0xf8,
+    0x02, 0x03, 0x2c, 0x1f, 0x05, 0xb4, 0x31, 0x0f, 0x0c, 0x01, 0x05, 0x71, 0xe9, 0xe4, 0xe4, 0x2f,
+    0x7b, 0x6f, 0x5c, 0x94, 0x0a, 0x00, 0x9c, 0x0a, 0x00, 0x8c, 0x01, 0x01, 0x04, 0x00, 0x12, 0x5d,
+    0xbc, 0x38, 0x70, 0x74, 0x68, 0x59, 0xff, 0x97, 0x90, 0x8c, 0x90, 0x01, 0x10, 0x10, 0x30, 0x00,
+    0x0f, 0x01, 0x00, 0x05, 0x0f, 0x60, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x05, 0x09, 0x00, 0x0f, 0x01, 0x00, 0x45, 0x0f, 0x61,
+    0x00, 0x4e, 0x0f, 0x01, 0x00, 0x08, 0x03, 0x7c, 0x00, 0x00, 0xf0, 0x00, 0x04, 0x08, 0x03, 0x08,
+    0x01, 0x00, 0x0f, 0x14, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x18, 0x00, 0x00, 0x58, 0x03, 0xf0,
+    0x0c, 0xb1, 0xaa, 0x9f, 0xb8, 0x8a, 0x80, 0x6f, 0xff, 0x89, 0x7e, 0x6f, 0xe7, 0x89, 0x80, 0x6f,
+    0xe2, 0x88, 0x7e, 0x6f, 0xe4, 0x87, 0x7b, 0x6d, 0xe7, 0x83, 0x78, 0x6a, 0x60, 0x0c, 0x50, 0xf7,
+    0xec, 0xec, 0xec, 0x28, 0x2c, 0x00, 0x0d, 0x01, 0x00, 0x03, 0x7c, 0x00, 0x04, 0x01, 0x00, 0x03,
+    0x84, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x0f, 0x01, 0x00, 0x4d, 0x0c, 0x65, 0x00, 0x0c,
+    0x10, 0x00, 0x0f, 0x01, 0x00, 0x69, 0x00, 0x04, 0x01, 0x04, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x01, 0x00, 0x05, 0x09, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x2c, 0x16, 0x00, 0x34, 0x16, 0x00, 0xc8,
+    0x13, 0x00, 0x04, 0x00, 0x00, 0x74, 0x45, 0x50, 0x10, 0xff, 0xf4, 0xf4, 0x18, 0x68, 0x03, 0x00,
+    0x10, 0x00, 0x00, 0x28, 0x00, 0x00, 0x01, 0x00, 0x08, 0x50, 0x00, 0x0f, 0x01, 0x00, 0x8c, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t test_image_cogwheel_argb8888_lz4 = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.always_zero = 0,
+    .header.compress = LV_IMAGE_COMPRESS_LZ4,
+    .header.w = 100,
+    .header.h = 100,
+    .data_size = 18645,
+    .data = test_image_cogwheel_argb8888_lz4_map,
+};
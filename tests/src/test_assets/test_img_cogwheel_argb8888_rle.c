@@ -0,0 +1,1491 @@
+#include "../../../lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_ARGB8888_RLE
+    #define LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_ARGB8888_RLE
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_ARGB8888_RLE uint8_t
+test_image_cogwheel_argb8888_rle_map[] = {
+    /*RLE compressed, 40000 bytes decompressed*/
+    0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x08, 0xad, 0x9b,
+    0x8f, 0xff, 0x95, 0x7e, 0x6d, 0xff, 0x90, 0x7a, 0x67, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7b,
+    0x69, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x97, 0x83, 0x72, 0xff, 0xd1, 0xc7, 0xc0, 0x6d, 0xff, 0xff,
+    0xff, 0x03, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0x01, 0xa7, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xf0, 0xf0, 0xf1, 0x11, 0x9e, 0x8a, 0x79, 0xff, 0x8f, 0x78, 0x65, 0xff, 0x90, 0x79, 0x66, 0xff,
+    0x91, 0x7a, 0x67, 0xff, 0x8e, 0x79, 0x66, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x8c, 0x76, 0x64, 0xff,
+    0x9f, 0x8c, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x09, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
+    0xff, 0x01, 0xff, 0xff, 0xff, 0x08, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01,
+    0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x0c, 0xee, 0xee,
+    0xee, 0x0f, 0xff, 0xff, 0xff, 0x05, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x01,
+    0xe4, 0xe0, 0xdb, 0x39, 0x9a, 0x85, 0x74, 0xff, 0x90, 0x79, 0x66, 0xff, 0x94, 0x7e, 0x6c, 0xff,
+    0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x76, 0x63, 0xff,
+    0x95, 0x7f, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x07, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff,
+    0xff, 0x01, 0xcb, 0xc2, 0xbb, 0x53, 0xae, 0xa2, 0x96, 0xff, 0xdf, 0xd9, 0xd9, 0x28, 0xff, 0xff,
+    0xff, 0x06, 0xff, 0xff, 0xff, 0x0b, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xa3, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x0c, 0xe7, 0xe1,
+    0xdb, 0x2b, 0xaf, 0x9a, 0x8b, 0xff, 0x9d, 0x85, 0x73, 0xff, 0xb9, 0xa8, 0x9b, 0xa5, 0xff, 0xff,
+    0xff, 0x0a, 0x87, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x01, 0xe0, 0xda, 0xd3, 0x4b,
+    0x9d, 0x88, 0x77, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff,
+    0x95, 0x7f, 0x6d, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x95, 0x80, 0x6f, 0xff,
+    0xdc, 0xd6, 0xd6, 0x2c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x01, 0xc6, 0xbd,
+    0xb3, 0x51, 0x87, 0x74, 0x61, 0xff, 0x85, 0x73, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x90, 0x80,
+    0x6f, 0xff, 0xa7, 0x9a, 0x8c, 0xff, 0xdf, 0xdf, 0xd9, 0x28, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff,
+    0xff, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xaf, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xff, 0xff, 0xff, 0x0d, 0xce, 0xbf, 0xb6, 0x8c, 0xad, 0x97, 0x87, 0xff, 0xa7, 0x90,
+    0x7f, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9c, 0x83, 0x71, 0xff, 0xa0, 0x89, 0x77, 0xff, 0xc1, 0xb2,
+    0xa7, 0x99, 0xff, 0xff, 0xff, 0x07, 0x86, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x04,
+    0xc5, 0xb7, 0xad, 0xaa, 0x9c, 0x88, 0x77, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x81, 0x95, 0x7f, 0x6d,
+    0xff, 0x05, 0x95, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x90, 0x79, 0x67, 0xfb, 0x92, 0x7e,
+    0x6e, 0xff, 0x9f, 0x92, 0x89, 0xff, 0xff, 0xff, 0xff, 0x05, 0x84, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xe8, 0xe8, 0xe8, 0x21, 0x9c, 0x8b, 0x7c, 0xff, 0x82, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5a, 0xfb,
+    0x82, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x89, 0x77, 0x65, 0xff, 0x8f, 0x7f, 0x6e, 0xff,
+    0x9c, 0x8e, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff,
+    0xff, 0x07, 0xc6, 0xb5, 0xa9, 0xb2, 0xa6, 0x8d, 0x7b, 0xff, 0x9d, 0x82, 0x6e, 0xff, 0x9f, 0x85,
+    0x72, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x89, 0x77, 0xfc, 0x9b, 0x82, 0x6f, 0xff, 0xa5, 0x8e,
+    0x7d, 0xff, 0xeb, 0xeb, 0xe2, 0x1a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x05,
+    0xad, 0x9b, 0x8d, 0xff, 0x9a, 0x84, 0x73, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x95, 0x80, 0x6d, 0xff,
+    0x81, 0x95, 0x7e, 0x6c, 0xff, 0x04, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7c,
+    0x6c, 0xff, 0x92, 0x82, 0x79, 0xff, 0xff, 0xff, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x04, 0xaf, 0xa2, 0x96, 0xd6,
+    0x8a, 0x77, 0x65, 0xff, 0x88, 0x73, 0x61, 0xff, 0x88, 0x75, 0x63, 0xff, 0x87, 0x75, 0x63, 0xff,
+    0x84, 0x72, 0x5f, 0xfb, 0x81, 0x6e, 0x5b, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x82, 0x6f, 0x5d, 0xff,
+    0xe9, 0xe9, 0xe2, 0x23, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xf8, 0xf1, 0xf1, 0x25, 0xaf, 0x99, 0x89, 0xff, 0xa0, 0x84, 0x72, 0xff,
+    0xa4, 0x89, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0x81, 0xa2, 0x8a, 0x78, 0xff, 0x03, 0x9e, 0x85,
+    0x73, 0xff, 0xa0, 0x87, 0x76, 0xff, 0xc1, 0xb3, 0xa7, 0x6b, 0xff, 0xff, 0xff, 0x02, 0x85, 0x00,
+    0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x03, 0xa5, 0x91, 0x82, 0xff, 0x99, 0x83, 0x71, 0xff,
+    0x94, 0x7e, 0x6c, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7e, 0x6d, 0xff,
+    0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8e, 0x7e, 0x74, 0xfb,
+    0xff, 0xff, 0xff, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x05, 0xef, 0xef, 0xef, 0x10, 0x94, 0x83,
+    0x72, 0xff, 0x84, 0x6e, 0x5b, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76, 0x63, 0xff, 0x87, 0x75,
+    0x62, 0xff, 0x81, 0x86, 0x74, 0x62, 0xff, 0x03, 0x7f, 0x6c, 0x59, 0xff, 0x83, 0x70, 0x5e, 0xff,
+    0xcb, 0xc4, 0xbc, 0x67, 0xff, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x0b, 0xb4, 0x9f, 0x92, 0xc4,
+    0xa2, 0x88, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff,
+    0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x9e, 0x86, 0x73, 0xff, 0x9f, 0x89, 0x77, 0xff,
+    0xe1, 0xdb, 0xd4, 0x2a, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x09, 0xa1, 0x8c,
+    0x7c, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x83, 0x95, 0x7f, 0x6d, 0xff, 0x04, 0x94, 0x7f, 0x6d, 0xff,
+    0x93, 0x7d, 0x6b, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x7d, 0x72, 0xff, 0xcf, 0xc7, 0xc7, 0x40,
+    0x82, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xfe, 0xff, 0x01, 0xbd, 0xb5, 0xab, 0x7c, 0x90, 0x7d,
+    0x6b, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8a, 0x77, 0x64, 0xff, 0x89, 0x76, 0x63, 0xff, 0x87, 0x74,
+    0x62, 0xff, 0x81, 0x86, 0x74, 0x62, 0xff, 0x03, 0x81, 0x6f, 0x5c, 0xff, 0x87, 0x76, 0x66, 0xff,
+    0xab, 0xa1, 0x99, 0xd4, 0xff, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0xba, 0xa7, 0x99, 0xa2, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa5, 0x8b,
+    0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9f, 0x87,
+    0x75, 0xff, 0x9a, 0x81, 0x6e, 0xff, 0xb4, 0xa2, 0x96, 0xbf, 0xff, 0xff, 0xff, 0x0e, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x07, 0xe3, 0xd7, 0xd7, 0x2d, 0xbc, 0xaf, 0xa3, 0x82,
+    0x99, 0x83, 0x72, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x15, 0x95, 0x7f,
+    0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8f, 0x7a, 0x69, 0xfb, 0x8f, 0x7a,
+    0x6b, 0xff, 0x9a, 0x89, 0x7d, 0xff, 0xcc, 0xc5, 0xbd, 0x46, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xdb, 0xd5, 0xd0, 0x31, 0x92, 0x80, 0x6f, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x8b, 0x76,
+    0x65, 0xfb, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74,
+    0x62, 0xff, 0x86, 0x73, 0x61, 0xff, 0x81, 0x6f, 0x5d, 0xfb, 0x86, 0x77, 0x6b, 0xff, 0xa5, 0x9c,
+    0x98, 0xdc, 0xff, 0xff, 0xff, 0x01, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xa9, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xff, 0xff, 0x01, 0xbb, 0xa6, 0x99, 0xbb, 0xa3, 0x8a,
+    0x78, 0xff, 0xa3, 0x89, 0x77, 0xfc, 0xa5, 0x8c, 0x7a, 0xff, 0xa4, 0x8b, 0x78, 0xff, 0xa2, 0x8a,
+    0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa1, 0x8a,
+    0x79, 0xff, 0xb7, 0xa7, 0x9a, 0xa9, 0xd4, 0xcb, 0xc2, 0x3b, 0xd3, 0xc9, 0xc4, 0x34, 0xce, 0xc1,
+    0xba, 0x4e, 0xbc, 0xad, 0xa2, 0xac, 0xa6, 0x93, 0x83, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x96, 0x7f,
+    0x6e, 0xfb, 0x97, 0x80, 0x6f, 0xfb, 0x96, 0x80, 0x6f, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x14,
+    0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x90, 0x7b, 0x69, 0xf7,
+    0x90, 0x7a, 0x68, 0xff, 0x9c, 0x89, 0x7b, 0xff, 0xb2, 0xa4, 0x99, 0xa8, 0xc3, 0xba, 0xaf, 0x59,
+    0x9f, 0x8f, 0x7f, 0xff, 0x89, 0x75, 0x62, 0xff, 0x88, 0x74, 0x61, 0xfb, 0x8c, 0x78, 0x66, 0xff,
+    0x8b, 0x77, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x75, 0x63, 0xff, 0x86, 0x74, 0x62, 0xff,
+    0x86, 0x74, 0x60, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x86, 0x78, 0x6f, 0xff, 0xac, 0xa4, 0xa3, 0xc7,
+    0xff, 0xff, 0xff, 0x01, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x01, 0xd0, 0xc2,
+    0xb8, 0x7e, 0xa9, 0x90, 0x7f, 0xff, 0xa2, 0x88, 0x76, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa4, 0x8b,
+    0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x88, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88,
+    0x76, 0xfb, 0x9e, 0x85, 0x75, 0xf7, 0x9c, 0x84, 0x71, 0xff, 0x9e, 0x86, 0x75, 0xff, 0x9e, 0x87,
+    0x75, 0xff, 0x9a, 0x83, 0x70, 0xff, 0x97, 0x7f, 0x6c, 0xff, 0x97, 0x81, 0x6e, 0xf7, 0x99, 0x82,
+    0x71, 0xf7, 0x98, 0x81, 0x70, 0xff, 0x81, 0x97, 0x80, 0x6f, 0xff, 0x81, 0x96, 0x80, 0x6e, 0xff,
+    0x14, 0x96, 0x80, 0x6d, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x92, 0x7d, 0x6c,
+    0xff, 0x91, 0x7c, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xfb, 0x8e, 0x78, 0x66, 0xf3, 0x8c, 0x76, 0x64,
+    0xff, 0x8c, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x63, 0xff, 0x8c, 0x7a, 0x67, 0xf7, 0x8c, 0x79, 0x66,
+    0xff, 0x8b, 0x78, 0x65, 0xff, 0x8b, 0x76, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x76, 0x64,
+    0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x84, 0x77, 0x71,
+    0xff, 0xd9, 0xd4, 0xd4, 0x3c, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x09, 0xb5,
+    0xa0, 0x92, 0xda, 0xa4, 0x8b, 0x7a, 0xff, 0xa4, 0x8b, 0x78, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0xa3,
+    0x8a, 0x78, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x76, 0xff, 0x9f,
+    0x87, 0x75, 0xff, 0x9e, 0x85, 0x74, 0xf7, 0x9b, 0x82, 0x70, 0xf3, 0x9a, 0x83, 0x6e, 0xf0, 0x9a,
+    0x83, 0x70, 0xf3, 0x99, 0x82, 0x6f, 0xf7, 0x99, 0x82, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x98,
+    0x82, 0x70, 0xff, 0x81, 0x97, 0x80, 0x6f, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x13, 0x94, 0x7e,
+    0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x91, 0x7b, 0x6b, 0xff, 0x90, 0x7a,
+    0x69, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xf7, 0x8c, 0x76, 0x65, 0xf3, 0x8c, 0x77,
+    0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8b, 0x76,
+    0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x75, 0x64, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74,
+    0x5f, 0xff, 0x83, 0x73, 0x62, 0xff, 0x80, 0x76, 0x73, 0xe5, 0xff, 0xff, 0xff, 0x03, 0x87, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xe8, 0xe8, 0xe8, 0x16, 0xa8, 0x9d, 0x90, 0x95, 0xde, 0xde, 0xd8, 0x2e,
+    0xff, 0xff, 0xff, 0x02, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x88, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff,
+    0xff, 0x05, 0xeb, 0xe4, 0xdd, 0x4b, 0xf6, 0xf6, 0xf6, 0x1d, 0x89, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xcd, 0xbe, 0xb5, 0x89, 0xa7, 0x8e, 0x7c, 0xff, 0xa2, 0x87, 0x76, 0xff, 0xa5, 0x8a, 0x7a, 0xff,
+    0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa0, 0x89, 0x76, 0xff, 0x9e, 0x87, 0x75, 0xff,
+    0x9f, 0x87, 0x75, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff,
+    0x9c, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x73, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x99, 0x83, 0x71, 0xff,
+    0x98, 0x82, 0x70, 0xff, 0x81, 0x98, 0x80, 0x70, 0xff, 0x00, 0x97, 0x80, 0x6f, 0xff, 0x81, 0x96,
+    0x80, 0x6e, 0xff, 0x09, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff,
+    0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x90, 0x7a, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff,
+    0x8e, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x81, 0x8c, 0x78, 0x66,
+    0xff, 0x07, 0x8b, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x65, 0xff, 0x88, 0x76, 0x64, 0xff, 0x87, 0x74,
+    0x62, 0xff, 0x86, 0x73, 0x60, 0xff, 0x84, 0x73, 0x62, 0xff, 0x82, 0x77, 0x70, 0xec, 0xff, 0xff,
+    0xff, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x06, 0xee, 0xef, 0xee, 0x0f, 0xb5, 0xa9, 0xa0, 0x86,
+    0x8e, 0x7e, 0x6e, 0xe6, 0x85, 0x75, 0x63, 0xff, 0x8a, 0x7c, 0x6b, 0xff, 0xb1, 0xa7, 0x9a, 0x93,
+    0xff, 0xff, 0xff, 0x05, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x87, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x07, 0xc6, 0xb2, 0xa5, 0xaf, 0xb8, 0x9f, 0x8f, 0xff,
+    0xbd, 0xa5, 0x97, 0xff, 0xea, 0xe4, 0xdf, 0x30, 0x85, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0xba, 0xa5, 0x98, 0xd2, 0xa6, 0x8c,
+    0x7a, 0xff, 0xa3, 0x89, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x8a,
+    0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x82, 0x9f, 0x87, 0x75, 0xff, 0x08, 0x9d, 0x86, 0x73, 0xff,
+    0x9c, 0x85, 0x72, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x9a, 0x84, 0x71, 0xff,
+    0x9a, 0x83, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff,
+    0x82, 0x96, 0x80, 0x6e, 0xff, 0x14, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e,
+    0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a,
+    0x69, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x8d, 0x78,
+    0x66, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x76,
+    0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x73, 0x61, 0xff, 0x83, 0x70, 0x5f, 0xff, 0x86, 0x77,
+    0x69, 0xff, 0xb3, 0xa8, 0xa2, 0x87, 0xff, 0xff, 0xff, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xa6, 0x9a, 0x8d, 0xf4,
+    0x8a, 0x79, 0x68, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x7e, 0x6c, 0x59, 0xdc, 0x74, 0x61, 0x4d, 0xff,
+    0x83, 0x74, 0x62, 0xff, 0xa9, 0x9d, 0x92, 0xb1, 0xff, 0xff, 0xff, 0x04, 0x9c, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xff, 0xff, 0xff, 0x08, 0xc0, 0xa9, 0x9a, 0xcc, 0xb3, 0x96, 0x85, 0xff, 0xab, 0x8c,
+    0x7a, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xb1, 0x96, 0x85, 0xff, 0xdd, 0xd2, 0xcb, 0x4a, 0xff, 0xff,
+    0xff, 0x03, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 0xc2, 0xaf, 0xa2, 0x89,
+    0xa8, 0x8d, 0x7b, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0x81, 0xa3, 0x8a, 0x78,
+    0xff, 0x01, 0xa2, 0x89, 0x78, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x82, 0x9f, 0x87, 0x75, 0xff, 0x05,
+    0x9e, 0x87, 0x74, 0xff, 0x9e, 0x86, 0x73, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x74, 0xff,
+    0x9b, 0x84, 0x72, 0xff, 0x9a, 0x82, 0x71, 0xff, 0x82, 0x98, 0x81, 0x70, 0xff, 0x00, 0x97, 0x81,
+    0x6f, 0xff, 0x81, 0x96, 0x80, 0x6e, 0xff, 0x03, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff,
+    0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x82, 0x91, 0x7b, 0x6a, 0xff, 0x04, 0x90, 0x7b,
+    0x6a, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x67, 0xff, 0x8a, 0x77,
+    0x65, 0xff, 0x81, 0x8a, 0x76, 0x64, 0xff, 0x07, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff,
+    0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xf7, 0x83, 0x70, 0x5d, 0xff, 0x90, 0x7f, 0x6f, 0xff,
+    0xb1, 0xa5, 0x9a, 0x83, 0xff, 0xff, 0xff, 0x02, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xeb, 0xeb,
+    0xeb, 0x0d, 0x98, 0x8a, 0x7b, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x79, 0x67, 0x54, 0xfb, 0x7d, 0x6c,
+    0x58, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xf7, 0x75, 0x64, 0x50, 0xff, 0x7e, 0x6f,
+    0x5d, 0xff, 0x9e, 0x92, 0x86, 0xbf, 0xff, 0xff, 0xff, 0x06, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xff, 0xff, 0xff, 0x08, 0xc2, 0xab, 0x9d, 0xc8, 0xb3, 0x97, 0x85, 0xff, 0xaf, 0x91, 0x7f, 0xff,
+    0xaf, 0x92, 0x81, 0xf9, 0xac, 0x8e, 0x7e, 0xf9, 0xac, 0x8d, 0x7d, 0xff, 0xb0, 0x94, 0x83, 0xff,
+    0xc8, 0xb4, 0xa8, 0xbb, 0xf5, 0xf5, 0xf5, 0x19, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff,
+    0xff, 0x02, 0xcc, 0xbd, 0xb2, 0x78, 0xae, 0x96, 0x86, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8c,
+    0x79, 0xff, 0xa6, 0x8c, 0x7c, 0xf8, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa3, 0x8a,
+    0x79, 0xff, 0xa1, 0x89, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x81, 0xa0,
+    0x88, 0x75, 0xff, 0x09, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x85, 0x73, 0xff,
+    0x9b, 0x84, 0x72, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8f, 0x7a, 0x68, 0xff,
+    0x95, 0x7f, 0x6e, 0xff, 0x97, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x81, 0x96, 0x80, 0x6e,
+    0xff, 0x23, 0x95, 0x7f, 0x6d, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x89, 0x76,
+    0x64, 0xff, 0x8a, 0x76, 0x65, 0xff, 0x8e, 0x78, 0x67, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a,
+    0x69, 0xff, 0x8d, 0x7a, 0x67, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x8b, 0x78,
+    0x66, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74,
+    0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x61, 0xff, 0x84, 0x72, 0x5f, 0xf7, 0x83, 0x70,
+    0x5e, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8e, 0x7d, 0x6d, 0xff, 0xcb, 0xc3, 0xba, 0x6b, 0xdc, 0xdc,
+    0xd6, 0x2c, 0x8c, 0x7e, 0x6e, 0xf7, 0x80, 0x6f, 0x5d, 0xff, 0x7b, 0x67, 0x54, 0xff, 0x7e, 0x6d,
+    0x5a, 0xfb, 0x80, 0x6f, 0x5c, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b,
+    0x58, 0xf7, 0x73, 0x62, 0x4f, 0xff, 0x7f, 0x6f, 0x5d, 0xff, 0xad, 0xa2, 0x96, 0xa7, 0xff, 0xff,
+    0xff, 0x01, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+    0x00, 0x15, 0xff, 0xff, 0xff, 0x01, 0xc8, 0xb4, 0xa8, 0x9f, 0xb4, 0x97, 0x86, 0xff, 0xaf, 0x90,
+    0x7e, 0xff, 0xb0, 0x93, 0x82, 0xf9, 0xb0, 0x93, 0x82, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xae, 0x91,
+    0x80, 0xf9, 0xac, 0x8e, 0x7c, 0xff, 0xaf, 0x93, 0x83, 0xff, 0xc0, 0xaa, 0x9f, 0xe6, 0xef, 0xe7,
+    0xe7, 0x20, 0xff, 0xff, 0xff, 0x06, 0xc9, 0xba, 0xaf, 0x76, 0xae, 0x96, 0x86, 0xff, 0xa5, 0x8b,
+    0x77, 0xff, 0xa5, 0x8c, 0x79, 0xff, 0xa7, 0x8e, 0x7d, 0xf8, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8b,
+    0x7a, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0x81, 0xa1, 0x89, 0x77, 0xff, 0x0c,
+    0xa2, 0x89, 0x77, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x98, 0x81, 0x6f, 0xff,
+    0x8f, 0x7b, 0x68, 0xff, 0x86, 0x74, 0x61, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x79, 0x6a, 0x57, 0xff,
+    0x74, 0x66, 0x53, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x98, 0x82, 0x70, 0xff,
+    0x97, 0x81, 0x6f, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x08, 0x91, 0x7c, 0x6a, 0xff, 0x84, 0x73,
+    0x61, 0xff, 0x78, 0x69, 0x55, 0xff, 0x74, 0x65, 0x52, 0xff, 0x78, 0x68, 0x55, 0xff, 0x7c, 0x6c,
+    0x58, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x81, 0x8d,
+    0x79, 0x67, 0xff, 0x04, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff,
+    0x87, 0x74, 0x62, 0xff, 0x85, 0x74, 0x62, 0xff, 0x81, 0x85, 0x73, 0x61, 0xff, 0x07, 0x83, 0x72,
+    0x60, 0xf7, 0x7e, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x91, 0x82, 0x72, 0xff, 0x90, 0x81,
+    0x71, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x69, 0x57, 0xff, 0x7f, 0x6d, 0x5b, 0xfb, 0x81, 0x7f,
+    0x6e, 0x5b, 0xff, 0x06, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff,
+    0x79, 0x68, 0x54, 0xf7, 0x76, 0x65, 0x52, 0xff, 0x97, 0x89, 0x7a, 0xe3, 0xff, 0xff, 0xff, 0x01,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x09, 0xbb, 0xa2, 0x94, 0xd7,
+    0xad, 0x8f, 0x7d, 0xff, 0xaf, 0x92, 0x81, 0xf9, 0xb0, 0x93, 0x82, 0xff, 0x81, 0xaf, 0x92, 0x81,
+    0xff, 0x1d, 0xae, 0x91, 0x80, 0xff, 0xae, 0x90, 0x80, 0xfc, 0xaa, 0x8d, 0x7c, 0xff, 0xaa, 0x90,
+    0x7e, 0xff, 0xac, 0x92, 0x81, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa6, 0x8c,
+    0x79, 0xff, 0xa6, 0x8d, 0x7a, 0xf8, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa6, 0x8c,
+    0x7b, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa4, 0x8a, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c,
+    0x7a, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x89, 0x76,
+    0x64, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6b, 0x5e,
+    0x49, 0xff, 0x69, 0x5d, 0x49, 0xff, 0x66, 0x5b, 0x47, 0xff, 0x71, 0x63, 0x51, 0xff, 0x8d, 0x79,
+    0x67, 0xff, 0x99, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x10,
+    0x91, 0x7c, 0x69, 0xff, 0x81, 0x70, 0x5c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x67, 0x5c, 0x47, 0xff,
+    0x6a, 0x5e, 0x49, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x77, 0x68, 0x54, 0xff,
+    0x7b, 0x6c, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x85, 0x71, 0x60, 0xff, 0x89, 0x75, 0x63, 0xff,
+    0x8b, 0x77, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x74, 0x62, 0xff,
+    0x84, 0x73, 0x61, 0xff, 0x82, 0x84, 0x72, 0x60, 0xff, 0x06, 0x80, 0x6e, 0x5c, 0xfb, 0x7c, 0x6a,
+    0x57, 0xff, 0x7d, 0x6b, 0x57, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xfb, 0x80, 0x6e,
+    0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x7f, 0x6e, 0x5b, 0xff, 0x81, 0x7d, 0x6c, 0x59, 0xff,
+    0x03, 0x78, 0x68, 0x53, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0x9c, 0x8f, 0x84, 0xb9, 0xff, 0xff, 0xff,
+    0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 0xbb, 0xa3, 0x94, 0xc4, 0xac,
+    0x8e, 0x7c, 0xff, 0xae, 0x91, 0x80, 0xfc, 0xaf, 0x92, 0x81, 0xff, 0x81, 0xae, 0x91, 0x80, 0xff,
+    0x81, 0xae, 0x90, 0x7f, 0xff, 0x08, 0xac, 0x91, 0x80, 0xfc, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f,
+    0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa8, 0x8e, 0x7b, 0xff, 0xa8, 0x8e, 0x7c, 0xfb, 0xa8, 0x8e,
+    0x7d, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0x81, 0xa6, 0x8c, 0x7b, 0xff, 0x08,
+    0xa5, 0x8c, 0x7b, 0xff, 0xa2, 0x89, 0x78, 0xff, 0x9c, 0x85, 0x74, 0xff, 0x92, 0x7d, 0x6b, 0xff,
+    0x84, 0x72, 0x5f, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6b, 0x5f, 0x4b, 0xff,
+    0x6d, 0x61, 0x4c, 0xff, 0x82, 0x6e, 0x61, 0x4c, 0xff, 0x04, 0x6b, 0x5e, 0x4a, 0xff, 0x74, 0x65,
+    0x52, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x82, 0x96,
+    0x80, 0x6e, 0xff, 0x0c, 0x91, 0x7c, 0x6a, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x71, 0x63, 0x4e, 0xff,
+    0x6a, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5f, 0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff,
+    0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x76, 0x66, 0x53, 0xff,
+    0x7f, 0x6e, 0x5b, 0xff, 0x85, 0x73, 0x61, 0xff, 0x81, 0x86, 0x74, 0x62, 0xff, 0x01, 0x87, 0x74,
+    0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x81, 0x84, 0x72, 0x60, 0xff, 0x0f, 0x83, 0x71, 0x5f, 0xff,
+    0x82, 0x70, 0x5e, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff,
+    0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6d, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff,
+    0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x57, 0xff, 0x77, 0x65, 0x52, 0xff,
+    0x80, 0x72, 0x65, 0xff, 0xa9, 0xa2, 0x9d, 0xbb, 0xff, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd6, 0xc6, 0xbf, 0x6f,
+    0xb0, 0x94, 0x83, 0xff, 0xab, 0x8d, 0x7c, 0xff, 0xaf, 0x91, 0x80, 0xfc, 0x81, 0xae, 0x91, 0x80,
+    0xff, 0x09, 0xad, 0x90, 0x7f, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x91,
+    0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7c, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xa9, 0x8e,
+    0x7d, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0x81, 0xa6, 0x8d, 0x7b, 0xff, 0x11,
+    0xa7, 0x8d, 0x7b, 0xff, 0xa2, 0x88, 0x77, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x7f, 0x6e, 0x5b, 0xff,
+    0x74, 0x65, 0x51, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6a, 0x5d, 0x4a, 0xff,
+    0x6b, 0x5f, 0x4b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff,
+    0x6f, 0x61, 0x4d, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x75, 0x65, 0x52, 0xff, 0x8d, 0x79, 0x67, 0xff,
+    0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x11, 0x92, 0x7c,
+    0x6b, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6b, 0x5e,
+    0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6c, 0x60,
+    0x4c, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x71, 0x63, 0x50, 0xff, 0x74, 0x66, 0x53, 0xff, 0x78, 0x68,
+    0x55, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73,
+    0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x81, 0x83, 0x71, 0x5f, 0xff, 0x00, 0x82, 0x70, 0x5e, 0xff,
+    0x81, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x80, 0x6e, 0x5c, 0xff, 0x00, 0x7f, 0x6d, 0x5b, 0xff, 0x81,
+    0x7e, 0x6d, 0x5a, 0xff, 0x04, 0x7d, 0x6c, 0x59, 0xff, 0x7b, 0x69, 0x55, 0xff, 0x78, 0x67, 0x57,
+    0xff, 0x84, 0x79, 0x75, 0xff, 0xe0, 0xe0, 0xe1, 0x29, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff,
+    0xff, 0xff, 0x0a, 0xcf, 0xbf, 0xb4, 0x8f, 0xab, 0x8d, 0x7c, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xaf,
+    0x92, 0x81, 0xfc, 0xae, 0x91, 0x80, 0xff, 0xad, 0x91, 0x7f, 0xff, 0x81, 0xab, 0x91, 0x7f, 0xff,
+    0x81, 0xaa, 0x90, 0x7e, 0xff, 0x81, 0xa9, 0x8f, 0x7c, 0xff, 0x00, 0xa9, 0x8e, 0x7c, 0xff, 0x81,
+    0xa8, 0x8e, 0x7c, 0xff, 0x08, 0xa9, 0x8f, 0x7e, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0x96, 0x80, 0x6e,
+    0xff, 0x85, 0x72, 0x60, 0xff, 0x77, 0x67, 0x54, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x69, 0x5e, 0x49,
+    0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x81, 0x6f, 0x62, 0x4d, 0xff, 0x07, 0x6e,
+    0x60, 0x4b, 0xff, 0x6c, 0x5d, 0x49, 0xff, 0x6a, 0x5b, 0x4a, 0xff, 0x6e, 0x61, 0x53, 0xff, 0x74,
+    0x69, 0x60, 0xff, 0x7c, 0x6f, 0x66, 0xff, 0x8f, 0x7a, 0x6a, 0xfb, 0x98, 0x81, 0x6f, 0xfb, 0x82,
+    0x96, 0x80, 0x6e, 0xff, 0x0b, 0x97, 0x80, 0x6e, 0xff, 0x8e, 0x79, 0x69, 0xff, 0x78, 0x66, 0x5a,
+    0xfb, 0x63, 0x57, 0x4c, 0xff, 0x69, 0x5e, 0x52, 0xff, 0x76, 0x6b, 0x5b, 0xff, 0x73, 0x67, 0x55,
+    0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x67, 0x58, 0x43, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x70, 0x62, 0x4e,
+    0xff, 0x73, 0x64, 0x51, 0xff, 0x81, 0x73, 0x64, 0x52, 0xff, 0x03, 0x77, 0x67, 0x55, 0xff, 0x7b,
+    0x6a, 0x58, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x81, 0x85, 0x73, 0x61, 0xff,
+    0x01, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x80,
+    0x6e, 0x5c, 0xff, 0x82, 0x7e, 0x6d, 0x5a, 0xff, 0x04, 0x7e, 0x6d, 0x58, 0xff, 0x76, 0x66, 0x53,
+    0xff, 0x7a, 0x6e, 0x66, 0xff, 0x9f, 0x98, 0x9a, 0xd2, 0xff, 0xff, 0xff, 0x02, 0x9b, 0x00, 0x00,
+    0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0x0a, 0xcd, 0xbb, 0xae, 0x8e, 0xac, 0x8e, 0x7d, 0xff, 0xab,
+    0x8d, 0x7b, 0xff, 0xad, 0x92, 0x80, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa,
+    0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8,
+    0x8e, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa0,
+    0x88, 0x77, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x7c, 0x6c, 0x58, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x68,
+    0x5d, 0x49, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4c, 0xff, 0x6c,
+    0x5f, 0x4a, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x6c, 0x5e, 0x4e, 0xff, 0x6f, 0x63, 0x55, 0xff, 0x7c,
+    0x71, 0x67, 0xff, 0x91, 0x87, 0x80, 0xff, 0xa7, 0xa0, 0x9b, 0x97, 0xd5, 0xd5, 0xd5, 0x12, 0xc8,
+    0xc2, 0xc2, 0x2a, 0x9c, 0x88, 0x7c, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x95,
+    0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x89, 0x74, 0x65, 0xfb, 0x71,
+    0x62, 0x5a, 0xff, 0x72, 0x68, 0x68, 0xff, 0xac, 0xa7, 0xa7, 0x62, 0xd6, 0xd6, 0xd6, 0x19, 0xd9,
+    0xd9, 0xcc, 0x14, 0xc1, 0xbb, 0xb6, 0x31, 0x95, 0x8b, 0x7d, 0xff, 0x85, 0x79, 0x68, 0xff, 0x72,
+    0x63, 0x50, 0xff, 0x6e, 0x5d, 0x4a, 0xff, 0x71, 0x60, 0x4d, 0xff, 0x75, 0x64, 0x52, 0xfb, 0x81,
+    0x77, 0x67, 0x55, 0xff, 0x05, 0x79, 0x68, 0x56, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x83, 0x71, 0x5f,
+    0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x81, 0x6f,
+    0x5d, 0xff, 0x82, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x7e, 0x6d, 0x5a, 0xff, 0x04, 0x7f, 0x6d, 0x5a,
+    0xff, 0x79, 0x68, 0x55, 0xfb, 0x71, 0x64, 0x5a, 0xff, 0x7e, 0x76, 0x78, 0xff, 0xe5, 0xe5, 0xe5,
+    0x1d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xf2, 0xf2, 0x13, 0xb5, 0x9c, 0x8c, 0xff, 0xab,
+    0x8f, 0x7d, 0xff, 0xab, 0x91, 0x7e, 0xfc, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0x82,
+    0xa9, 0x8f, 0x7d, 0xff, 0x1f, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e,
+    0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x86, 0x74, 0x61, 0xff, 0x70, 0x63, 0x4f,
+    0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x60, 0x4d,
+    0xff, 0x6d, 0x5f, 0x4b, 0xfb, 0x6e, 0x60, 0x4d, 0xff, 0x6f, 0x62, 0x51, 0xff, 0x74, 0x68, 0x5d,
+    0xff, 0x80, 0x77, 0x73, 0xff, 0x8f, 0x88, 0x88, 0xff, 0xcd, 0xcd, 0xcd, 0x29, 0xee, 0xee, 0xee,
+    0x0f, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xae, 0x9d, 0x90,
+    0xff, 0x97, 0x81, 0x70, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6d,
+    0xff, 0x96, 0x80, 0x6e, 0xff, 0x86, 0x72, 0x62, 0xff, 0x7d, 0x6f, 0x67, 0xff, 0xa9, 0xa3, 0xa3,
+    0xb2, 0xff, 0xff, 0xff, 0x03, 0x82, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x07, 0xd0,
+    0xcb, 0xc6, 0x36, 0x98, 0x8d, 0x81, 0xff, 0x83, 0x75, 0x66, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x81,
+    0x75, 0x65, 0x53, 0xff, 0x06, 0x77, 0x67, 0x55, 0xfb, 0x7a, 0x6a, 0x57, 0xff, 0x7c, 0x6b, 0x58,
+    0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e,
+    0xff, 0x81, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x7e, 0x6d, 0x5a, 0xff,
+    0x03, 0x7f, 0x6d, 0x59, 0xff, 0x71, 0x60, 0x52, 0xff, 0x76, 0x6a, 0x68, 0xff, 0xab, 0xa6, 0xa9,
+    0x9d, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0xec, 0xe6, 0xdf, 0x28, 0xb5, 0x9d, 0x8d, 0xff, 0xa9,
+    0x8f, 0x7c, 0xff, 0x85, 0xa9, 0x8f, 0x7d, 0xff, 0x0f, 0xac, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e,
+    0xff, 0x9c, 0x84, 0x72, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6a, 0x5f, 0x4a,
+    0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x6e, 0x5f, 0x4a,
+    0xfb, 0x6d, 0x5e, 0x4d, 0xff, 0x70, 0x65, 0x5d, 0xff, 0x84, 0x7c, 0x7a, 0xff, 0xbd, 0xba, 0xb7,
+    0x55, 0xee, 0xee, 0xee, 0x0f, 0xe8, 0xe8, 0xe8, 0x0b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
+    0xff, 0xff, 0x04, 0xb2, 0xa1, 0x94, 0xff, 0x98, 0x82, 0x70, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x81,
+    0x95, 0x7f, 0x6d, 0xff, 0x04, 0x95, 0x7f, 0x6c, 0xff, 0x87, 0x74, 0x64, 0xff, 0x86, 0x78, 0x70,
+    0xff, 0xf2, 0xe4, 0xe4, 0x13, 0x00, 0x01, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xeb,
+    0xeb, 0xeb, 0x0d, 0xe8, 0xe8, 0xe8, 0x0b, 0xbb, 0xb2, 0xa8, 0x4f, 0x85, 0x76, 0x66, 0xff, 0x77,
+    0x67, 0x54, 0xff, 0x78, 0x67, 0x54, 0xff, 0x7c, 0x6b, 0x57, 0xfb, 0x7d, 0x6c, 0x59, 0xff, 0x7e,
+    0x6c, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x82, 0x81, 0x6f, 0x5d, 0xff,
+    0x82, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x7e, 0x6d, 0x5a, 0xff, 0x04, 0x7d, 0x6c, 0x58, 0xff, 0x74,
+    0x63, 0x54, 0xff, 0x86, 0x7b, 0x75, 0xff, 0xed, 0xed, 0xed, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x9e,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x0d, 0xb4, 0x9e, 0x8e, 0xff, 0xa7, 0x8d, 0x7a,
+    0xff, 0xa8, 0x8e, 0x7c, 0xff, 0x81, 0xa9, 0x8f, 0x7d, 0xff, 0x10, 0xa8, 0x8e, 0x7c, 0xff, 0xa9,
+    0x8f, 0x7d, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0x99, 0x83, 0x70, 0xff, 0x81,
+    0x6f, 0x5c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x69, 0x5e, 0x49, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f,
+    0x62, 0x4e, 0xff, 0x6e, 0x5f, 0x4b, 0xfb, 0x6b, 0x5d, 0x4c, 0xff, 0x6f, 0x63, 0x57, 0xff, 0x7f,
+    0x76, 0x71, 0xff, 0xb7, 0xb3, 0xb3, 0x40, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x01, 0x85,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x04, 0xb0, 0x9e, 0x92, 0xff, 0x98, 0x82, 0x71,
+    0xff, 0x93, 0x7d, 0x6b, 0xff, 0x81, 0x95, 0x7e, 0x6c, 0xff, 0x04, 0x94, 0x7e, 0x6c, 0xff, 0x8a,
+    0x76, 0x67, 0xff, 0x88, 0x7a, 0x72, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x01, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xe3, 0xe3, 0xe3, 0x09, 0xb8, 0xae, 0xa5, 0x5e, 0x8b, 0x7c, 0x6c,
+    0xff, 0x77, 0x64, 0x51, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x80, 0x6e, 0x5c, 0xfb, 0x80, 0x6f, 0x5c,
+    0xff, 0x81, 0x6e, 0x5d, 0xff, 0x82, 0x81, 0x6f, 0x5d, 0xff, 0x00, 0x80, 0x6e, 0x5c, 0xff, 0x82,
+    0x7f, 0x6d, 0x5b, 0xff, 0x04, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x77, 0x66, 0x53,
+    0xff, 0x8d, 0x80, 0x72, 0xff, 0xee, 0xee, 0xee, 0x0f, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x02, 0xca, 0xb8, 0xad,
+    0x9e, 0xac, 0x93, 0x82, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0x81, 0xa9, 0x8f, 0x7d, 0xff, 0x0e, 0xa8,
+    0x8e, 0x7c, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x99,
+    0x82, 0x6f, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6f,
+    0x62, 0x4e, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x60, 0x4b, 0xf7, 0x6c, 0x5f, 0x4f, 0xff, 0x75,
+    0x6b, 0x63, 0xff, 0x8b, 0x85, 0x85, 0xff, 0xc3, 0xbf, 0xc3, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xff, 0xff, 0xff, 0x04, 0xb0, 0x9f, 0x92, 0xff, 0x98, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6b,
+    0xff, 0x81, 0x95, 0x7f, 0x6c, 0xff, 0x03, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8a,
+    0x7c, 0x74, 0xff, 0xff, 0xff, 0xff, 0x04, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc0, 0xb8, 0xb0,
+    0x61, 0x90, 0x83, 0x73, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6b, 0x58, 0xff, 0x81, 0x6f, 0x5e,
+    0xf7, 0x83, 0x71, 0x5f, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e,
+    0xff, 0x82, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x7e, 0x6d, 0x5a, 0xff, 0x06, 0x7d, 0x6c, 0x59, 0xff,
+    0x78, 0x67, 0x53, 0xff, 0x83, 0x73, 0x61, 0xff, 0xaa, 0xa0, 0x95, 0xb2, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf5, 0xf5,
+    0xf5, 0x19, 0xae, 0x96, 0x85, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa8, 0x8e, 0x7c, 0xfc, 0x82, 0xa8,
+    0x8e, 0x7c, 0xff, 0x0c, 0xab, 0x90, 0x7e, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x9a, 0x83, 0x71, 0xff,
+    0x7e, 0x6e, 0x5b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4e, 0xff,
+    0x71, 0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4c, 0xf4, 0x6e, 0x60, 0x52, 0xff, 0x78, 0x6f, 0x6c, 0xff,
+    0xa8, 0xa4, 0xa6, 0x89, 0xee, 0xee, 0xee, 0x0f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x04, 0xb0, 0x9f, 0x92, 0xff,
+    0x98, 0x82, 0x70, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x81, 0x95, 0x7f, 0x6c, 0xff, 0x03, 0x94, 0x7e,
+    0x6c, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8b, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff, 0x04, 0x86, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x09, 0xee, 0xe6,
+    0xe6, 0x1e, 0x9f, 0x91, 0x83, 0xc1, 0x82, 0x70, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x83, 0x72,
+    0x60, 0xf7, 0x85, 0x74, 0x61, 0xff, 0x87, 0x75, 0x62, 0xff, 0x84, 0x72, 0x60, 0xff, 0x80, 0x6e,
+    0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x83, 0x7e, 0x6d, 0x5a, 0xff, 0x03, 0x7c, 0x6b, 0x57, 0xfb,
+    0x77, 0x66, 0x52, 0xff, 0x81, 0x71, 0x5f, 0xff, 0xe8, 0xe8, 0xe8, 0x0b, 0x82, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xff, 0xff, 0xff, 0x02, 0xd6, 0xd2, 0xcb, 0x44, 0xa5, 0x9c, 0x90, 0x7c, 0x99, 0x8d,
+    0x80, 0x70, 0x91, 0x83, 0x74, 0x86, 0xe0, 0xd8, 0xd8, 0x21, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0x0b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+    0xff, 0x05, 0xb9, 0xa7, 0x97, 0xb0, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0x82, 0xa8,
+    0x8e, 0x7c, 0xff, 0x0b, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x9d, 0x86, 0x73, 0xff,
+    0x80, 0x6f, 0x5c, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff,
+    0x71, 0x63, 0x4d, 0xff, 0x6d, 0x5f, 0x4d, 0xf4, 0x6b, 0x5e, 0x53, 0xff, 0x83, 0x7b, 0x7a, 0xff,
+    0xbe, 0xbb, 0xbe, 0x4f, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x04, 0xaf, 0x9f,
+    0x91, 0xff, 0x97, 0x81, 0x70, 0xff, 0x95, 0x7d, 0x6a, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e,
+    0x6d, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8b, 0x7d, 0x75, 0xff, 0xff, 0xff,
+    0xff, 0x04, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xb2, 0xa6, 0x9b, 0x70,
+    0x8e, 0x7d, 0x6c, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x85, 0x73, 0x61, 0xf7, 0x81, 0x89, 0x77, 0x64,
+    0xff, 0x01, 0x85, 0x73, 0x61, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x7e, 0x6d, 0x5a, 0xff, 0x82,
+    0x7d, 0x6c, 0x59, 0xff, 0x0c, 0x77, 0x66, 0x52, 0xff, 0x77, 0x67, 0x54, 0xfb, 0x9c, 0x90, 0x82,
+    0xac, 0xb7, 0xad, 0xa5, 0x80, 0xb9, 0xaf, 0xa7, 0x80, 0xae, 0xa6, 0x9b, 0x78, 0xa0, 0x96, 0x89,
+    0x9b, 0x8c, 0x7f, 0x70, 0xff, 0x7d, 0x6e, 0x5d, 0xff, 0x73, 0x63, 0x50, 0xff, 0x70, 0x60, 0x4c,
+    0xff, 0x8d, 0x81, 0x72, 0xff, 0xf1, 0xf1, 0xf1, 0x12, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf0,
+    0xe8, 0xe8, 0x22, 0xb3, 0x9d, 0x8f, 0xf3, 0xb5, 0xa0, 0x92, 0xe8, 0xdb, 0xd1, 0xc9, 0x64, 0xff,
+    0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0x04, 0xc6, 0xb7, 0xab, 0x94, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x78, 0xff, 0xa9,
+    0x8f, 0x7d, 0xfc, 0x82, 0xa8, 0x8e, 0x7c, 0xff, 0x0a, 0xab, 0x90, 0x7e, 0xff, 0x9f, 0x87, 0x74,
+    0xff, 0x84, 0x73, 0x5f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6b, 0x5e, 0x4b, 0xff, 0x70, 0x62, 0x4e,
+    0xff, 0x70, 0x63, 0x4d, 0xff, 0x6c, 0x5e, 0x4b, 0xf4, 0x6c, 0x60, 0x55, 0xff, 0x84, 0x7c, 0x7d,
+    0xff, 0xbf, 0xbc, 0xc2, 0x54, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x04, 0xaf, 0x9f, 0x91, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x95, 0x7f, 0x6c,
+    0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x68, 0xff, 0x8c, 0x7d, 0x75,
+    0xff, 0xff, 0xff, 0xff, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x01, 0x00, 0x00, 0xb6,
+    0xab, 0xa1, 0x77, 0x90, 0x7e, 0x6d, 0xff, 0x85, 0x72, 0x5f, 0xff, 0x89, 0x76, 0x64, 0xf7, 0x8d,
+    0x79, 0x67, 0xff, 0x8b, 0x77, 0x66, 0xff, 0x85, 0x72, 0x60, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7d,
+    0x6c, 0x59, 0xff, 0x7d, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x7b,
+    0x6a, 0x58, 0xfb, 0x7a, 0x6a, 0x57, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0x83, 0x74, 0x63, 0xff, 0x83,
+    0x75, 0x64, 0xff, 0x7a, 0x6b, 0x59, 0xff, 0x73, 0x62, 0x50, 0xff, 0x6f, 0x5f, 0x4c, 0xf7, 0x76,
+    0x66, 0x54, 0xe6, 0x77, 0x67, 0x56, 0xe8, 0x74, 0x65, 0x52, 0xe6, 0x77, 0x69, 0x57, 0xff, 0x9a,
+    0x90, 0x82, 0xff, 0xff, 0xff, 0xff, 0x07, 0x87, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xf0, 0xf0,
+    0x11, 0xad, 0x96, 0x86, 0xff, 0xa1, 0x87, 0x75, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xaa, 0x91, 0x80,
+    0xff, 0xa9, 0x8f, 0x80, 0xe2, 0xa9, 0x92, 0x7f, 0xcd, 0xb5, 0x9f, 0x90, 0xcf, 0xc8, 0xb7, 0xae,
+    0xad, 0xc0, 0xae, 0xa0, 0xd5, 0xaf, 0x98, 0x87, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa6, 0x8c, 0x7b,
+    0xf9, 0xa8, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa8, 0x8e, 0x7c,
+    0xff, 0xa4, 0x8a, 0x78, 0xff, 0x8a, 0x77, 0x63, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6a, 0x5e, 0x4b,
+    0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6e, 0x60, 0x4d, 0xf4, 0x6a, 0x5e, 0x53,
+    0xff, 0x85, 0x7e, 0x7e, 0xff, 0xc4, 0xc1, 0xc7, 0x4e, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
+    0xff, 0xff, 0x04, 0xb0, 0x9f, 0x92, 0xff, 0x97, 0x81, 0x70, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x81,
+    0x93, 0x7e, 0x6b, 0xff, 0x03, 0x92, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x67, 0xff, 0x8c, 0x7e, 0x76,
+    0xff, 0xff, 0xff, 0xff, 0x04, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8b,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xb4, 0xa9, 0x9c, 0x77, 0x93, 0x81, 0x70, 0xff, 0x8b, 0x77, 0x65,
+    0xff, 0x8d, 0x79, 0x68, 0xf7, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x84, 0x72, 0x5f,
+    0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58,
+    0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x77, 0x67, 0x54, 0xff, 0x74, 0x64, 0x51,
+    0xff, 0x73, 0x62, 0x4f, 0xff, 0x72, 0x61, 0x4f, 0xff, 0x72, 0x62, 0x50, 0xff, 0x74, 0x64, 0x52,
+    0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6c, 0x5d, 0x49,
+    0xff, 0x84, 0x77, 0x67, 0xff, 0xeb, 0xeb, 0xe0, 0x19, 0x87, 0x00, 0x00, 0x00, 0x00, 0x19, 0xdc,
+    0xd3, 0xcd, 0x51, 0xa8, 0x8f, 0x7e, 0xff, 0xa0, 0x85, 0x72, 0xff, 0xa4, 0x8a, 0x7a, 0xf9, 0xa2,
+    0x87, 0x76, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xac,
+    0x93, 0x83, 0xff, 0xab, 0x92, 0x81, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xa6, 0x8c, 0x7c, 0xf9, 0xa6,
+    0x8c, 0x7b, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa7, 0x8e, 0x7d, 0xff, 0xa7,
+    0x8c, 0x7b, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6d,
+    0x61, 0x4d, 0xff, 0x71, 0x64, 0x4f, 0xff, 0x6f, 0x60, 0x4c, 0xf8, 0x6c, 0x5f, 0x53, 0xff, 0x82,
+    0x7b, 0x7a, 0xff, 0xc6, 0xc2, 0xc6, 0x50, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x04, 0xaf, 0x9e, 0x91, 0xff, 0x97,
+    0x81, 0x6f, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x92,
+    0x7b, 0x69, 0xff, 0x8a, 0x76, 0x66, 0xff, 0x8b, 0x7d, 0x75, 0xff, 0xff, 0xff, 0xff, 0x04, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xb7, 0xaa, 0x9f, 0x75, 0x92, 0x7d, 0x6d, 0xff, 0x8c, 0x77, 0x65,
+    0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x82, 0x71, 0x5e,
+    0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x58,
+    0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x67, 0x55,
+    0xff, 0x77, 0x67, 0x56, 0xff, 0x77, 0x67, 0x57, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53,
+    0xff, 0x74, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6d, 0x5e, 0x49, 0xff, 0x75, 0x67, 0x54,
+    0xff, 0xb8, 0xb0, 0xa9, 0x88, 0xff, 0xff, 0xff, 0x04, 0x85, 0x00, 0x00, 0x00, 0x00, 0x04, 0xef,
+    0xef, 0xef, 0x10, 0xab, 0x95, 0x85, 0xff, 0xa3, 0x89, 0x78, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0xa5,
+    0x8b, 0x7a, 0xff, 0x81, 0xa5, 0x8c, 0x7a, 0xff, 0x04, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x89, 0x78,
+    0xff, 0xa3, 0x88, 0x76, 0xff, 0xa3, 0x89, 0x77, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0x81, 0xa6, 0x8c,
+    0x7b, 0xff, 0x0b, 0xa6, 0x8b, 0x79, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0x9d,
+    0x85, 0x73, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x6b, 0x5e, 0x4b, 0xff, 0x6c, 0x61, 0x4e, 0xff, 0x70,
+    0x63, 0x4f, 0xff, 0x70, 0x62, 0x4c, 0xfc, 0x6c, 0x5f, 0x51, 0xff, 0x79, 0x70, 0x6e, 0xff, 0xbf,
+    0xbc, 0xbc, 0x57, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x04, 0xaf, 0x9f, 0x91,
+    0xff, 0x96, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6a,
+    0xff, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x8b, 0x7c, 0x75, 0xff, 0xff, 0xff, 0xff,
+    0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x03, 0xa7, 0x96, 0x88,
+    0xf3, 0x8d, 0x76, 0x64, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x94, 0x7e, 0x6d,
+    0xff, 0x8b, 0x77, 0x65, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7b, 0x6a, 0x57,
+    0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x69, 0x56, 0xff, 0x81, 0x78, 0x68,
+    0x56, 0xff, 0x03, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75,
+    0x66, 0x53, 0xff, 0x81, 0x75, 0x65, 0x53, 0xff, 0x03, 0x71, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x51,
+    0xff, 0x87, 0x7b, 0x6c, 0xff, 0xe8, 0xe8, 0xe8, 0x0b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef,
+    0xef, 0xe6, 0x1f, 0x81, 0x9f, 0x86, 0x74, 0xff, 0x01, 0xa3, 0x8a, 0x79, 0xff, 0xa4, 0x8b, 0x79,
+    0xff, 0x81, 0xa5, 0x8b, 0x79, 0xff, 0x04, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa4,
+    0x8b, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0x81, 0xa5, 0x8b, 0x7a, 0xff,
+    0x0a, 0xa4, 0x8a, 0x79, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x89, 0x75, 0x63,
+    0xff, 0x72, 0x64, 0x52, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x72, 0x64, 0x4e,
+    0xff, 0x6a, 0x5d, 0x4c, 0xff, 0x74, 0x6a, 0x65, 0xff, 0xaa, 0xa6, 0xa8, 0x87, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff,
+    0x04, 0xae, 0x9e, 0x91, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x92, 0x7d, 0x6c,
+    0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x8b, 0x7c, 0x74,
+    0xff, 0xff, 0xff, 0xff, 0x04, 0x91, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe4, 0xde, 0xd9, 0x2f, 0xa2,
+    0x8f, 0x7f, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x94, 0x7d, 0x6b, 0xfb, 0x99, 0x82, 0x71, 0xff, 0x93,
+    0x7d, 0x6c, 0xff, 0x85, 0x72, 0x60, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x81, 0x7a, 0x6a, 0x57, 0xff,
+    0x01, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x69, 0x56, 0xff, 0x82, 0x77, 0x67, 0x55, 0xff, 0x08, 0x77,
+    0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74,
+    0x65, 0x53, 0xff, 0x73, 0x64, 0x50, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x76, 0x69, 0x59, 0xff, 0xe8,
+    0xe8, 0xe8, 0x0b, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x04, 0xd3, 0xc7, 0xc1,
+    0x7b, 0x9d, 0x84, 0x72, 0xff, 0x9e, 0x84, 0x72, 0xff, 0x81, 0xa2, 0x89, 0x78, 0xff, 0x81, 0xa3,
+    0x8a, 0x79, 0xff, 0x82, 0xa4, 0x8a, 0x79, 0xff, 0x01, 0xa5, 0x8b, 0x79, 0xff, 0xa4, 0x8b, 0x79,
+    0xff, 0x82, 0xa4, 0x8a, 0x79, 0xff, 0x09, 0xa7, 0x8c, 0x7a, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x75,
+    0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6f,
+    0x60, 0x4c, 0xff, 0x6f, 0x65, 0x5d, 0xff, 0x92, 0x8c, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff,
+    0xff, 0xff, 0x04, 0xaf, 0x9f, 0x92, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x92,
+    0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x89, 0x74, 0x66, 0xff, 0x8a,
+    0x7b, 0x74, 0xff, 0xff, 0xff, 0xff, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xcb, 0xc4, 0x45, 0x98, 0x82, 0x70, 0xff, 0x94, 0x7d, 0x6a,
+    0xff, 0x9a, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x80, 0x6e, 0x5c,
+    0xff, 0x79, 0x69, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x56, 0xff, 0x81, 0x78, 0x68,
+    0x56, 0xff, 0x00, 0x77, 0x67, 0x55, 0xff, 0x82, 0x76, 0x66, 0x54, 0xff, 0x06, 0x75, 0x66, 0x53,
+    0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6f, 0x60, 0x4b, 0xff, 0x72, 0x64, 0x53,
+    0xff, 0x90, 0x87, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x84, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff,
+    0xff, 0xff, 0x02, 0xd2, 0xc6, 0xbd, 0x78, 0x9f, 0x86, 0x74, 0xff, 0x9d, 0x84, 0x71, 0xff, 0xa0,
+    0x88, 0x76, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa1, 0x89, 0x78, 0xff, 0x81, 0xa2, 0x8a, 0x78, 0xff,
+    0x83, 0xa3, 0x8a, 0x79, 0xff, 0x0b, 0xa2, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa4, 0x8b,
+    0x79, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x89, 0x75, 0x62, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6c, 0x5f,
+    0x4b, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x6f, 0x60, 0x4c, 0xfc, 0x6d, 0x60, 0x52, 0xff, 0x89, 0x81,
+    0x80, 0xff, 0xdf, 0xda, 0xdf, 0x37, 0x91, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x02,
+    0xaf, 0x9f, 0x92, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff,
+    0x92, 0x7c, 0x69, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x88, 0x74, 0x66, 0xff, 0x89, 0x7b, 0x74, 0xff,
+    0xff, 0xff, 0xff, 0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8a, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x03, 0xaf, 0xa0, 0x91, 0xfb, 0x9a, 0x84, 0x72, 0xff,
+    0x97, 0x81, 0x6e, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x99, 0x82, 0x70, 0xff, 0x86, 0x74, 0x61, 0xff,
+    0x7b, 0x6a, 0x57, 0xff, 0x81, 0x79, 0x69, 0x57, 0xff, 0x81, 0x78, 0x68, 0x56, 0xff, 0x0a, 0x77,
+    0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75,
+    0x66, 0x53, 0xff, 0x75, 0x64, 0x50, 0xff, 0x71, 0x61, 0x4d, 0xff, 0x71, 0x64, 0x57, 0xff, 0x8a,
+    0x81, 0x7c, 0xff, 0xcf, 0xcb, 0xc8, 0x4f, 0xff, 0xff, 0xff, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x08, 0xbe,
+    0xaf, 0xa4, 0x92, 0xa0, 0x88, 0x77, 0xff, 0x99, 0x80, 0x6d, 0xff, 0x9d, 0x85, 0x72, 0xff, 0xa0,
+    0x88, 0x76, 0xfc, 0x82, 0xa1, 0x89, 0x77, 0xff, 0x00, 0xa1, 0x88, 0x77, 0xff, 0x81, 0xa1, 0x89,
+    0x77, 0xff, 0x0a, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa4, 0x8c, 0x7a, 0xff, 0x92,
+    0x7d, 0x6b, 0xff, 0x77, 0x67, 0x55, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x72,
+    0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4f, 0xff, 0x74, 0x69, 0x65, 0xff, 0xc2, 0xbe, 0xc2, 0x4b, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8,
+    0xe0, 0xe0, 0x21, 0xa4, 0x91, 0x83, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x81,
+    0x91, 0x7b, 0x69, 0xff, 0x05, 0x90, 0x7a, 0x68, 0xff, 0x88, 0x74, 0x64, 0xff, 0x8d, 0x7c, 0x70,
+    0xff, 0xd1, 0xc7, 0xc3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xe2, 0xdc, 0xdc, 0x2c, 0xa2, 0x8d, 0x7d, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x81,
+    0x9e, 0x86, 0x74, 0xff, 0x01, 0x91, 0x7b, 0x69, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x82, 0x78, 0x68,
+    0x56, 0xff, 0x00, 0x77, 0x67, 0x55, 0xff, 0x83, 0x76, 0x66, 0x54, 0xff, 0x05, 0x74, 0x64, 0x51,
+    0xfb, 0x6d, 0x5e, 0x50, 0xff, 0x75, 0x69, 0x61, 0xff, 0x98, 0x90, 0x8f, 0xad, 0xe0, 0xda, 0xda,
+    0x29, 0xff, 0xff, 0xff, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x05, 0xdc,
+    0xd4, 0xd0, 0x41, 0xb6, 0xa3, 0x96, 0xd8, 0xa4, 0x8d, 0x7c, 0xff, 0x9b, 0x82, 0x6f, 0xff, 0x9d,
+    0x84, 0x71, 0xff, 0x9f, 0x87, 0x75, 0xfc, 0x83, 0xa0, 0x88, 0x76, 0xff, 0x0a, 0x9f, 0x88, 0x76,
+    0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x88, 0x74, 0x62, 0xff, 0x6c, 0x5f, 0x4c,
+    0xff, 0x6e, 0x60, 0x4d, 0xff, 0x72, 0x64, 0x50, 0xff, 0x6f, 0x61, 0x4c, 0xfc, 0x72, 0x65, 0x59,
+    0xff, 0x89, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf0,
+    0xf0, 0xf0, 0x11, 0xd3, 0xcb, 0xc4, 0x45, 0xac, 0x9a, 0x8d, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x8f,
+    0x79, 0x68, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8f, 0x7b, 0x69, 0xff, 0x8e,
+    0x79, 0x68, 0xff, 0x8b, 0x76, 0x65, 0xfb, 0x8e, 0x79, 0x69, 0xff, 0x9c, 0x8b, 0x7d, 0xff, 0xd0,
+    0xc5, 0xbd, 0x46, 0xff, 0xff, 0xff, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff,
+    0x02, 0xbe, 0xae, 0xa1, 0xa6, 0x9b, 0x82, 0x70, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa0, 0x88, 0x76,
+    0xff, 0x9c, 0x84, 0x72, 0xff, 0x87, 0x74, 0x62, 0xff, 0x81, 0x77, 0x67, 0x55, 0xff, 0x01, 0x78,
+    0x68, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x81, 0x76, 0x66, 0x54, 0xff, 0x05, 0x77, 0x67, 0x54,
+    0xff, 0x71, 0x62, 0x51, 0xfb, 0x6a, 0x5d, 0x52, 0xff, 0x7b, 0x70, 0x6e, 0xff, 0xa2, 0x9c, 0x9e,
+    0x83, 0xff, 0xff, 0xff, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x0a, 0xc9,
+    0xb9, 0xb1, 0x7f, 0xa8, 0x91, 0x81, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x77, 0xf9, 0x9f,
+    0x87, 0x76, 0xff, 0x82, 0xa0, 0x88, 0x76, 0xff, 0x0b, 0xa1, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76,
+    0xff, 0x97, 0x81, 0x6f, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x70, 0x62, 0x4e,
+    0xff, 0x74, 0x65, 0x50, 0xff, 0x6e, 0x60, 0x50, 0xff, 0x79, 0x6e, 0x69, 0xff, 0xcb, 0xc7, 0xc7,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x05, 0xd5,
+    0xd0, 0xca, 0x2b, 0xa3, 0x90, 0x80, 0xff, 0x9b, 0x87, 0x76, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x91,
+    0x7c, 0x6a, 0xfb, 0x91, 0x7b, 0x6a, 0xff, 0x81, 0x91, 0x7b, 0x69, 0xff, 0x00, 0x8f, 0x7a, 0x69,
+    0xff, 0x81, 0x8e, 0x79, 0x68, 0xff, 0x04, 0x8e, 0x79, 0x68, 0xf7, 0x8d, 0x78, 0x67, 0xff, 0x95,
+    0x82, 0x72, 0xff, 0xa3, 0x92, 0x84, 0xff, 0xdc, 0xdc, 0xd3, 0x1d, 0x89, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x10, 0xec, 0xe3, 0xe3, 0x1b, 0xaa,
+    0x95, 0x85, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0x90,
+    0x7b, 0x69, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x67, 0x55, 0xff, 0x77,
+    0x67, 0x55, 0xff, 0x76, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x78, 0x69, 0x53, 0xff, 0x69,
+    0x5b, 0x4f, 0xf4, 0x6c, 0x63, 0x65, 0xff, 0xa5, 0x9f, 0xa5, 0x85, 0xff, 0xff, 0xff, 0x01, 0x8d,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x03, 0xf4, 0xf4, 0xf4, 0x17, 0xc4, 0xb5, 0xac,
+    0x79, 0xa6, 0x8f, 0x7f, 0xff, 0x9c, 0x84, 0x73, 0xf9, 0x9e, 0x86, 0x74, 0xff, 0xa0, 0x88, 0x76,
+    0xff, 0x9f, 0x87, 0x75, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x8b, 0x78, 0x65,
+    0xff, 0x76, 0x67, 0x54, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x73, 0x63, 0x4e,
+    0xff, 0x6f, 0x62, 0x56, 0xff, 0x88, 0x81, 0x82, 0xff, 0xff, 0xed, 0xff, 0x0e, 0x8e, 0x00, 0x00,
+    0x00, 0x00, 0x13, 0xeb, 0xeb, 0xe0, 0x19, 0xba, 0xab, 0x9e, 0x8c, 0x9a, 0x84, 0x72, 0xff, 0x8f,
+    0x77, 0x64, 0xff, 0x8f, 0x78, 0x65, 0xf3, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91,
+    0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e,
+    0x79, 0x68, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8c, 0x77, 0x65, 0xfb, 0x85,
+    0x6f, 0x5d, 0xf7, 0x88, 0x72, 0x5f, 0xff, 0x92, 0x7e, 0x6d, 0xff, 0xbc, 0xb1, 0xa5, 0x5b, 0xf2,
+    0xe6, 0xe6, 0x14, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x01, 0xc9, 0xbb, 0xaf,
+    0x6d, 0x9f, 0x85, 0x73, 0xff, 0xa3, 0x89, 0x78, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x99, 0x82, 0x70,
+    0xff, 0x83, 0x71, 0x5f, 0xff, 0x78, 0x68, 0x56, 0xff, 0x81, 0x77, 0x67, 0x55, 0xff, 0x05, 0x76,
+    0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x68, 0x53, 0xf7, 0x6d, 0x5f, 0x54, 0xff, 0x90,
+    0x89, 0x8b, 0x8a, 0xff, 0xff, 0xff, 0x02, 0x90, 0x00, 0x00, 0x00, 0x00, 0x10, 0xde, 0xd3, 0xcb,
+    0x45, 0xa7, 0x91, 0x81, 0xff, 0x9c, 0x84, 0x72, 0xf3, 0x9d, 0x85, 0x73, 0xff, 0x9f, 0x86, 0x75,
+    0xff, 0x9e, 0x86, 0x74, 0xff, 0xa1, 0x88, 0x76, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x81, 0x6f, 0x5c,
+    0xff, 0x6e, 0x61, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x65, 0x50, 0xff, 0x71, 0x61, 0x4e,
+    0xff, 0x72, 0x66, 0x5f, 0xff, 0xa8, 0xa3, 0xa7, 0xb9, 0xff, 0xff, 0xff, 0x09, 0x00, 0x01, 0x00,
+    0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xed, 0xe5, 0xe5, 0x1d, 0xa7, 0x96, 0x87, 0xff, 0x8c,
+    0x77, 0x64, 0xff, 0x86, 0x71, 0x5e, 0xf7, 0x90, 0x79, 0x67, 0xf7, 0x93, 0x7d, 0x6b, 0xff, 0x92,
+    0x7d, 0x6d, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x81, 0x92, 0x7c, 0x6b, 0xff, 0x0b, 0x90, 0x7b, 0x6a,
+    0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x8c, 0x78, 0x67,
+    0xff, 0x8c, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x89, 0x76, 0x62, 0xef, 0x7f, 0x6b, 0x57,
+    0xfb, 0x87, 0x75, 0x63, 0xff, 0xa2, 0x94, 0x86, 0xff, 0xea, 0xea, 0xea, 0x18, 0x8d, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xe0, 0xd6, 0x19, 0xa3,
+    0x8a, 0x77, 0xff, 0xa5, 0x8a, 0x78, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x8e,
+    0x79, 0x67, 0xff, 0x7a, 0x69, 0x57, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76,
+    0x66, 0x54, 0xff, 0x76, 0x65, 0x54, 0xff, 0x77, 0x67, 0x53, 0xf0, 0x75, 0x67, 0x59, 0xff, 0xbe,
+    0xb9, 0xb5, 0x37, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8d, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0xd1, 0xc3, 0xb9, 0x4d, 0x9f, 0x89, 0x76, 0xff, 0x9d, 0x85, 0x73, 0xf3, 0x81,
+    0x9e, 0x86, 0x74, 0xff, 0x09, 0x9d, 0x86, 0x73, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x97, 0x81, 0x6f,
+    0xff, 0x7a, 0x6a, 0x57, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x72, 0x64, 0x50, 0xff, 0x73, 0x64, 0x50,
+    0xff, 0x6e, 0x60, 0x51, 0xff, 0x82, 0x78, 0x75, 0xff, 0xe0, 0xe0, 0xe0, 0x29, 0x8d, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0x09, 0xad, 0x9a, 0x8b, 0xe9, 0x87, 0x72, 0x5e, 0xff, 0x7e,
+    0x6d, 0x5b, 0xe2, 0x86, 0x76, 0x65, 0xff, 0x92, 0x80, 0x6f, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x8f,
+    0x79, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xfb, 0x8b, 0x75, 0x63, 0xff, 0x88, 0x73, 0x60, 0xff, 0x88,
+    0x74, 0x61, 0xff, 0x88, 0x73, 0x60, 0xff, 0x89, 0x72, 0x60, 0xff, 0x8a, 0x75, 0x65, 0xff, 0x8c,
+    0x77, 0x65, 0xff, 0x8b, 0x77, 0x64, 0xf7, 0x87, 0x74, 0x62, 0xff, 0x82, 0x72, 0x61, 0xff, 0x79,
+    0x6b, 0x58, 0xff, 0x7a, 0x69, 0x56, 0xde, 0x82, 0x70, 0x5e, 0xff, 0xaa, 0x9d, 0x90, 0xb6, 0xff,
+    0xff, 0xff, 0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x86, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0xf2, 0xe4, 0xe4, 0x13, 0xae, 0x96, 0x85, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xaa,
+    0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x74,
+    0x65, 0x53, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76,
+    0x66, 0x53, 0xf7, 0x71, 0x62, 0x52, 0xff, 0xa2, 0x9b, 0x92, 0x91, 0xff, 0xff, 0xff, 0x05, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0xc9, 0xbf, 0xb5, 0x4c, 0x99, 0x81, 0x6e, 0xff, 0x9d, 0x86, 0x74,
+    0xf3, 0x9c, 0x85, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x72,
+    0xff, 0x8f, 0x7b, 0x68, 0xff, 0x78, 0x68, 0x55, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x74, 0x64, 0x50,
+    0xff, 0x73, 0x63, 0x50, 0xff, 0x6d, 0x60, 0x56, 0xff, 0x9e, 0x98, 0x97, 0xc6, 0xfe, 0xff, 0xff,
+    0x0a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xff, 0xff, 0xff, 0x04, 0xc0, 0xb0, 0xa4, 0x95, 0x92, 0x7b, 0x69, 0xff, 0x78, 0x66, 0x52,
+    0xf4, 0x78, 0x6c, 0x5a, 0xff, 0x9d, 0x94, 0x88, 0xd9, 0xac, 0xa2, 0x96, 0xcc, 0x9d, 0x8b, 0x7c,
+    0xff, 0x8e, 0x78, 0x66, 0xff, 0x86, 0x70, 0x5d, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x81, 0x71, 0x5f,
+    0xff, 0x82, 0x72, 0x60, 0xff, 0x87, 0x75, 0x64, 0xff, 0x8b, 0x78, 0x68, 0xff, 0x8a, 0x76, 0x65,
+    0xff, 0x87, 0x72, 0x5f, 0xff, 0x86, 0x72, 0x5f, 0xff, 0x89, 0x7a, 0x6d, 0xff, 0x87, 0x7c, 0x73,
+    0xeb, 0x84, 0x7b, 0x6c, 0xce, 0x7b, 0x6c, 0x5b, 0xfb, 0x7b, 0x67, 0x54, 0xf7, 0x8b, 0x78, 0x67,
+    0xff, 0xcc, 0xc5, 0xbe, 0x4b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd9, 0xcc, 0xc3, 0x3c, 0xac,
+    0x92, 0x81, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xb0, 0x95, 0x83, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x7b,
+    0x6a, 0x58, 0xff, 0x73, 0x63, 0x51, 0xff, 0x77, 0x66, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x75,
+    0x66, 0x53, 0xff, 0x76, 0x67, 0x53, 0xff, 0x6c, 0x5d, 0x4a, 0xfb, 0x8c, 0x82, 0x78, 0xff, 0xe6,
+    0xe6, 0xe6, 0x1f, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xb0, 0xa4,
+    0x78, 0x95, 0x7d, 0x69, 0xff, 0x9b, 0x85, 0x72, 0xf6, 0x9b, 0x84, 0x71, 0xff, 0x9b, 0x84, 0x72,
+    0xff, 0x9c, 0x85, 0x73, 0xff, 0x98, 0x82, 0x6f, 0xff, 0x89, 0x76, 0x63, 0xff, 0x77, 0x68, 0x54,
+    0xff, 0x6f, 0x62, 0x4f, 0xff, 0x74, 0x64, 0x50, 0xff, 0x74, 0x64, 0x51, 0xff, 0x72, 0x68, 0x63,
+    0xff, 0xd6, 0xd1, 0xd6, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0xda, 0xd2, 0xca, 0x3e, 0x9c, 0x86, 0x75, 0xff, 0x8d, 0x75, 0x62, 0xff, 0x7c,
+    0x6d, 0x59, 0xff, 0x8a, 0x82, 0x71, 0xd5, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0xee,
+    0xee, 0xee, 0x0f, 0x9c, 0x8d, 0x7e, 0xff, 0x92, 0x85, 0x75, 0xff, 0x9a, 0x8f, 0x82, 0xe8, 0xa3,
+    0x9a, 0x92, 0xaf, 0xa2, 0x98, 0x90, 0xb5, 0xaa, 0xa0, 0x98, 0xb4, 0xb1, 0xa6, 0x9b, 0xae, 0xa5,
+    0x96, 0x87, 0xe6, 0x94, 0x81, 0x71, 0xff, 0x94, 0x85, 0x79, 0xff, 0xa8, 0xa0, 0x9b, 0xb3, 0xff,
+    0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x01, 0x9c, 0x8d, 0x7f, 0xcb, 0x82, 0x70, 0x5c, 0xff, 0x7f,
+    0x6c, 0x59, 0xff, 0x92, 0x83, 0x73, 0xff, 0xe1, 0xe1, 0xda, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xea, 0xea, 0xdf, 0x18, 0xb1, 0x96, 0x85,
+    0xff, 0xaa, 0x8d, 0x7b, 0xff, 0xb3, 0x96, 0x84, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0x83, 0x71, 0x5e,
+    0xff, 0x75, 0x65, 0x54, 0xff, 0x76, 0x65, 0x53, 0xff, 0x81, 0x75, 0x66, 0x53, 0xff, 0x03, 0x76,
+    0x67, 0x54, 0xff, 0x6f, 0x5f, 0x4b, 0xf7, 0x81, 0x75, 0x68, 0xff, 0xcd, 0xc9, 0xc9, 0x3d, 0x8f,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xf5, 0x19, 0xae, 0x9d, 0x8e, 0xed, 0x93, 0x7a, 0x67,
+    0xff, 0x9b, 0x83, 0x71, 0xfc, 0x9a, 0x83, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9c, 0x85, 0x73,
+    0xff, 0x95, 0x7f, 0x6d, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x74, 0x66, 0x51, 0xff, 0x71, 0x63, 0x4f,
+    0xff, 0x73, 0x64, 0x4f, 0xff, 0x72, 0x64, 0x52, 0xff, 0x7c, 0x73, 0x70, 0xff, 0xdf, 0xdf, 0xdf,
+    0x20, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe9, 0xe2, 0xdb, 0x23, 0xa3, 0x8f, 0x80, 0xff, 0x93,
+    0x7c, 0x6a, 0xff, 0x91, 0x7a, 0x69, 0xf8, 0x85, 0x71, 0x5f, 0xff, 0x9b, 0x8f, 0x82, 0xdd, 0xff,
+    0xff, 0xff, 0x02, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf3, 0xf3, 0xf3, 0x15, 0xc6, 0xc2, 0xbc,
+    0x79, 0xff, 0xff, 0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0x01, 0x0c, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0a, 0xc7, 0xbf, 0xb6, 0x77, 0xdc, 0xd8, 0xd4, 0x3b, 0xff,
+    0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xa8, 0x99, 0x8c, 0xdf, 0x84,
+    0x71, 0x5e, 0xff, 0x7e, 0x6b, 0x59, 0xf3, 0x82, 0x70, 0x5e, 0xff, 0xaa, 0x9e, 0x93, 0xcb, 0xff,
+    0xff, 0xff, 0x05, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0xeb, 0xeb, 0xe0, 0x19, 0xb6, 0x9c, 0x8c, 0xff, 0xac, 0x8d, 0x7b, 0xff, 0xb5,
+    0x97, 0x86, 0xff, 0xab, 0x8f, 0x7e, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x74,
+    0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x71,
+    0x62, 0x4e, 0xff, 0x75, 0x67, 0x55, 0xff, 0x94, 0x8a, 0x80, 0xff, 0xd7, 0xd7, 0xd0, 0x26, 0xff,
+    0xff, 0xff, 0x01, 0x81, 0xff, 0xff, 0xff, 0x02, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff,
+    0x02, 0x87, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0xdf,
+    0xd8, 0xd2, 0x4f, 0xa8, 0x94, 0x85, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x81, 0x9a, 0x83, 0x71, 0xff,
+    0x09, 0x9a, 0x83, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x7d, 0x6c, 0x5a,
+    0xff, 0x72, 0x64, 0x50, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x54,
+    0xff, 0x86, 0x7e, 0x7b, 0xff, 0xec, 0xed, 0xed, 0x1b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd2, 0xca, 0xc2, 0x3f, 0x96, 0x80, 0x6f,
+    0xff, 0x92, 0x7b, 0x69, 0xf4, 0x93, 0x7d, 0x6c, 0xff, 0x8d, 0x76, 0x64, 0xff, 0x9a, 0x88, 0x78,
+    0xff, 0xcd, 0xc8, 0xc0, 0x61, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc1, 0xb6, 0xad, 0x88, 0x96,
+    0x84, 0x74, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x80, 0x6e, 0x5c, 0xf7, 0x8b,
+    0x7a, 0x6a, 0xff, 0xd4, 0xca, 0xc5, 0x30, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xeb, 0xeb, 0x0d, 0xb8, 0x9f, 0x90, 0xff, 0xaa, 0x8b, 0x79,
+    0xff, 0xb4, 0x97, 0x86, 0xff, 0xad, 0x91, 0x80, 0xff, 0x96, 0x7f, 0x6e, 0xff, 0x7d, 0x6b, 0x5a,
+    0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x53, 0xff, 0x81, 0x75, 0x66, 0x53, 0xff, 0x09, 0x74,
+    0x65, 0x52, 0xff, 0x73, 0x65, 0x4f, 0xf7, 0x75, 0x67, 0x54, 0xff, 0x74, 0x67, 0x54, 0xff, 0x75,
+    0x68, 0x54, 0xd5, 0x76, 0x69, 0x57, 0xdc, 0x7a, 0x6b, 0x5b, 0xdf, 0x79, 0x6d, 0x5c, 0xff, 0x8f,
+    0x85, 0x76, 0xe6, 0xeb, 0xeb, 0xeb, 0x0d, 0x82, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff,
+    0x09, 0xff, 0xff, 0xf0, 0x11, 0xff, 0xff, 0xff, 0x0b, 0xf5, 0xf5, 0xeb, 0x1a, 0xe2, 0xdc, 0xd9,
+    0x50, 0xc0, 0xb3, 0xa8, 0xb5, 0xa6, 0x92, 0x83, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x98, 0x81, 0x6f,
+    0xff, 0x81, 0x99, 0x83, 0x71, 0xff, 0x0d, 0x9a, 0x83, 0x71, 0xff, 0x9c, 0x84, 0x73, 0xff, 0x94,
+    0x7e, 0x6c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c,
+    0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x5c, 0xff, 0x8d, 0x82, 0x7d, 0xff, 0xd5, 0xd1, 0xd1, 0x42, 0xff,
+    0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xfe, 0x04, 0x81,
+    0xff, 0xff, 0xff, 0x05, 0x00, 0xff, 0xff, 0xfe, 0x04, 0x81, 0xff, 0xff, 0xff, 0x04, 0x0b, 0xff,
+    0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x05, 0xf2, 0xf2, 0xf2, 0x13, 0xbc,
+    0xae, 0xa2, 0x81, 0x8f, 0x79, 0x66, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93,
+    0x7b, 0x6a, 0xfb, 0x8b, 0x76, 0x64, 0xff, 0x91, 0x82, 0x72, 0xff, 0xf4, 0xe9, 0xe9, 0x17, 0x8b,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x0b, 0x9a, 0x88, 0x79, 0xff, 0x85, 0x71, 0x5f,
+    0xff, 0x83, 0x71, 0x5f, 0xfb, 0x85, 0x74, 0x62, 0xff, 0x83, 0x70, 0x5e, 0xfb, 0x7d, 0x6a, 0x57,
+    0xff, 0xa6, 0x9a, 0x8d, 0xb1, 0xf0, 0xf0, 0xf0, 0x11, 0xff, 0xff, 0xff, 0x03, 0x8a, 0xff, 0xff,
+    0xff, 0x05, 0x07, 0xff, 0xff, 0xff, 0x02, 0xdc, 0xd6, 0xcd, 0x33, 0xa7, 0x8f, 0x7e, 0xff, 0x9e,
+    0x83, 0x71, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa1, 0x88, 0x76, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x7d,
+    0x6b, 0x59, 0xff, 0x82, 0x74, 0x65, 0x53, 0xff, 0x15, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52,
+    0xff, 0x72, 0x65, 0x50, 0xff, 0x6e, 0x5f, 0x4a, 0xf8, 0x6b, 0x5c, 0x47, 0xff, 0x6c, 0x5e, 0x4a,
+    0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6c, 0x5e, 0x4b, 0xff, 0x73, 0x67, 0x54,
+    0xff, 0x85, 0x7b, 0x69, 0xe2, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xef, 0xe7, 0xe7,
+    0x20, 0xb7, 0xa8, 0x9a, 0xdf, 0xaf, 0x9e, 0x90, 0xff, 0xab, 0x99, 0x8a, 0xff, 0xa1, 0x8d, 0x7d,
+    0xff, 0x9c, 0x87, 0x75, 0xff, 0x99, 0x83, 0x72, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e,
+    0xfc, 0x82, 0x99, 0x82, 0x71, 0xff, 0x1e, 0x98, 0x82, 0x70, 0xff, 0x99, 0x83, 0x71, 0xff, 0x96,
+    0x80, 0x6e, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d,
+    0x79, 0x67, 0xff, 0x8c, 0x78, 0x69, 0xff, 0x93, 0x80, 0x74, 0xff, 0xa5, 0x94, 0x89, 0xff, 0xc6,
+    0xbb, 0xb1, 0x99, 0xd7, 0xcf, 0xc7, 0x65, 0xce, 0xc4, 0xbc, 0x81, 0xcd, 0xc3, 0xbb, 0x80, 0xcd,
+    0xc2, 0xb8, 0x89, 0xca, 0xc1, 0xb7, 0x8b, 0xcb, 0xc2, 0xb6, 0x89, 0xcb, 0xbf, 0xb8, 0x88, 0xca,
+    0xc1, 0xb7, 0x87, 0xcb, 0xc0, 0xb6, 0x89, 0xce, 0xc6, 0xbd, 0x78, 0xbf, 0xb2, 0xa8, 0xaf, 0xa7,
+    0x96, 0x88, 0xff, 0x98, 0x85, 0x74, 0xff, 0x90, 0x7b, 0x69, 0xfc, 0x91, 0x7c, 0x6a, 0xff, 0x92,
+    0x7c, 0x6b, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x80, 0x6b, 0x57, 0xff, 0x7f, 0x70, 0x5e, 0xff, 0xc7,
+    0xc2, 0xbb, 0x6d, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x87, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0xf3, 0xf3, 0xf3, 0x15, 0x93, 0x7f, 0x6e, 0xff, 0x82, 0x6d, 0x5a, 0xff, 0x83,
+    0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x7f, 0x6d, 0x5a, 0xfb, 0x88,
+    0x78, 0x67, 0xff, 0x9b, 0x8d, 0x80, 0xff, 0xa7, 0x9a, 0x8d, 0xff, 0xa8, 0x9b, 0x8f, 0xff, 0xa5,
+    0x98, 0x8c, 0xff, 0xa5, 0x98, 0x8b, 0xff, 0xa4, 0x98, 0x8a, 0xff, 0xa3, 0x98, 0x8a, 0xff, 0x82,
+    0xa3, 0x97, 0x8a, 0xff, 0x00, 0xa2, 0x97, 0x8a, 0xff, 0x81, 0xa2, 0x96, 0x89, 0xff, 0x07, 0xa4,
+    0x99, 0x8c, 0xff, 0x98, 0x8a, 0x7c, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x72, 0x60, 0xff, 0x88,
+    0x75, 0x63, 0xff, 0x86, 0x73, 0x61, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x81,
+    0x74, 0x66, 0x53, 0xff, 0x03, 0x74, 0x65, 0x52, 0xff, 0x74, 0x64, 0x52, 0xff, 0x73, 0x65, 0x51,
+    0xff, 0x72, 0x64, 0x50, 0xff, 0x81, 0x71, 0x63, 0x4f, 0xff, 0x11, 0x70, 0x63, 0x4f, 0xff, 0x6e,
+    0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6b, 0x5d, 0x4b, 0xfb, 0x65, 0x58, 0x44, 0xff, 0x6c,
+    0x61, 0x4c, 0xff, 0xfe, 0xff, 0xff, 0x08, 0xff, 0xff, 0xfe, 0x0f, 0x96, 0x81, 0x6f, 0xff, 0x92,
+    0x7c, 0x69, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x95,
+    0x7d, 0x6b, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x80, 0x6d, 0xfc, 0x97, 0x80, 0x6f, 0xff, 0x97,
+    0x81, 0x71, 0xff, 0x81, 0x98, 0x81, 0x70, 0xff, 0x82, 0x97, 0x81, 0x6f, 0xff, 0x09, 0x99, 0x82,
+    0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9a, 0x83,
+    0x71, 0xff, 0x98, 0x80, 0x6e, 0xfc, 0x96, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7f,
+    0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x83, 0x94, 0x7e, 0x6c, 0xff, 0x82, 0x93, 0x7d, 0x6b, 0xff,
+    0x81, 0x92, 0x7c, 0x6a, 0xff, 0x08, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x91, 0x7c,
+    0x6a, 0xfc, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x7e, 0x6b,
+    0x57, 0xff, 0x7d, 0x71, 0x61, 0xff, 0xe3, 0xe3, 0xde, 0x36, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xff, 0xff, 0xff, 0x01, 0xa7, 0x90, 0x81, 0xb6, 0x8b, 0x76, 0x63, 0xff, 0x80, 0x6f, 0x5d, 0xff,
+    0x81, 0x83, 0x71, 0x5f, 0xff, 0x07, 0x82, 0x71, 0x5f, 0xfb, 0x80, 0x6d, 0x5b, 0xff, 0x7f, 0x6d,
+    0x5a, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6b, 0x5a, 0xff, 0x7d, 0x6b,
+    0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x81, 0x7c, 0x6a, 0x57, 0xff, 0x08, 0x7b, 0x6a, 0x57, 0xff,
+    0x7a, 0x69, 0x56, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x79, 0x67, 0x55, 0xff,
+    0x78, 0x67, 0x55, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xfb, 0x75, 0x66, 0x54, 0xff,
+    0x81, 0x73, 0x64, 0x52, 0xff, 0x00, 0x74, 0x65, 0x52, 0xff, 0x81, 0x75, 0x65, 0x53, 0xff, 0x00,
+    0x75, 0x66, 0x53, 0xff, 0x81, 0x74, 0x65, 0x52, 0xff, 0x01, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64,
+    0x4f, 0xff, 0x81, 0x71, 0x63, 0x4f, 0xff, 0x00, 0x70, 0x63, 0x4f, 0xff, 0x81, 0x6f, 0x62, 0x4f,
+    0xff, 0x0a, 0x6d, 0x60, 0x4d, 0xff, 0x66, 0x58, 0x43, 0xff, 0x71, 0x66, 0x52, 0xec, 0xe0, 0xdc,
+    0xdc, 0x3a, 0xe3, 0xe0, 0xd9, 0x51, 0x96, 0x80, 0x6e, 0xff, 0x8e, 0x76, 0x63, 0xff, 0x93, 0x7d,
+    0x6a, 0xfc, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x81, 0x96,
+    0x80, 0x6e, 0xff, 0x82, 0x97, 0x81, 0x6f, 0xff, 0x00, 0x96, 0x81, 0x6f, 0xff, 0x82, 0x97, 0x81,
+    0x6f, 0xff, 0x83, 0x98, 0x82, 0x70, 0xff, 0x02, 0x98, 0x81, 0x70, 0xff, 0x97, 0x80, 0x6e, 0xff,
+    0x94, 0x7e, 0x6b, 0xff, 0x82, 0x93, 0x7c, 0x6a, 0xff, 0x00, 0x92, 0x7c, 0x69, 0xff, 0x82, 0x92,
+    0x7b, 0x69, 0xff, 0x03, 0x91, 0x7b, 0x68, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x90, 0x7a, 0x69, 0xff,
+    0x90, 0x79, 0x68, 0xff, 0x81, 0x8f, 0x79, 0x67, 0xff, 0x00, 0x90, 0x7b, 0x68, 0xff, 0x81, 0x91,
+    0x7b, 0x69, 0xff, 0x04, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x7e, 0x6c, 0x5a, 0xff,
+    0x80, 0x75, 0x68, 0xff, 0xe8, 0xe8, 0xe8, 0x2c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+    0xff, 0x01, 0xb6, 0xa0, 0x91, 0xb3, 0x91, 0x7c, 0x6a, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x81, 0x83,
+    0x71, 0x5f, 0xff, 0x04, 0x82, 0x70, 0x5e, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff,
+    0x7c, 0x6a, 0x57, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x81, 0x7b, 0x68, 0x56, 0xff, 0x00, 0x7a, 0x67,
+    0x55, 0xff, 0x81, 0x7a, 0x68, 0x55, 0xff, 0x06, 0x79, 0x67, 0x54, 0xff, 0x78, 0x66, 0x53, 0xff,
+    0x77, 0x66, 0x52, 0xff, 0x77, 0x65, 0x51, 0xff, 0x75, 0x64, 0x52, 0xff, 0x74, 0x63, 0x51, 0xff,
+    0x74, 0x64, 0x52, 0xff, 0x81, 0x76, 0x66, 0x54, 0xff, 0x02, 0x75, 0x65, 0x53, 0xff, 0x74, 0x64,
+    0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x82, 0x75, 0x66, 0x53, 0xff, 0x06, 0x74, 0x64, 0x52, 0xff,
+    0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff,
+    0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x07, 0x6e, 0x61,
+    0x4d, 0xff, 0x67, 0x58, 0x43, 0xff, 0x70, 0x63, 0x50, 0xfb, 0xb6, 0xaf, 0xaa, 0xaf, 0xdf, 0xda,
+    0xd4, 0x60, 0x99, 0x83, 0x73, 0xf3, 0x90, 0x79, 0x67, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x81, 0x96,
+    0x80, 0x6e, 0xff, 0x00, 0x95, 0x80, 0x6e, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x00, 0x97, 0x81,
+    0x6e, 0xff, 0x81, 0x96, 0x81, 0x6f, 0xff, 0x83, 0x97, 0x81, 0x6f, 0xff, 0x03, 0x96, 0x81, 0x6f,
+    0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x84, 0x96, 0x80,
+    0x6e, 0xff, 0x84, 0x95, 0x7f, 0x6d, 0xff, 0x03, 0x94, 0x7e, 0x6c, 0xff, 0x92, 0x7d, 0x6c, 0xff,
+    0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x81, 0x91, 0x7b, 0x69, 0xff, 0x06, 0x90, 0x7b,
+    0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x7f, 0x6c,
+    0x5b, 0xff, 0x84, 0x78, 0x6d, 0xff, 0xec, 0xec, 0xec, 0x29, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xff, 0xff, 0xff, 0x01, 0xbf, 0xaa, 0x9c, 0xb7, 0x95, 0x80, 0x6e, 0xff, 0x7d, 0x6c, 0x59, 0xff,
+    0x82, 0x70, 0x5e, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff,
+    0x81, 0x80, 0x6e, 0x5c, 0xff, 0x82, 0x7f, 0x6d, 0x5b, 0xff, 0x00, 0x7e, 0x6d, 0x5b, 0xff, 0x81,
+    0x7e, 0x6d, 0x5a, 0xff, 0x06, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x57,
+    0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56,
+    0xff, 0x81, 0x77, 0x67, 0x55, 0xff, 0x82, 0x76, 0x66, 0x54, 0xff, 0x81, 0x75, 0x66, 0x53, 0xff,
+    0x00, 0x74, 0x65, 0x52, 0xff, 0x81, 0x73, 0x65, 0x51, 0xff, 0x01, 0x73, 0x64, 0x51, 0xff, 0x71,
+    0x63, 0x4f, 0xff, 0x81, 0x70, 0x62, 0x4f, 0xff, 0x82, 0x6e, 0x61, 0x4e, 0xff, 0x09, 0x6f, 0x61,
+    0x4d, 0xff, 0x69, 0x5a, 0x45, 0xfb, 0x6e, 0x61, 0x4e, 0xff, 0x92, 0x89, 0x83, 0xff, 0xee, 0xe9,
+    0xe5, 0x3b, 0x99, 0x85, 0x73, 0xed, 0x90, 0x79, 0x66, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f,
+    0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x81, 0x95, 0x7f, 0x6d, 0xff, 0x00, 0x96, 0x80, 0x6e, 0xff,
+    0x90, 0x95, 0x7f, 0x6d, 0xff, 0x01, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x81, 0x93,
+    0x7e, 0x6c, 0xff, 0x03, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff,
+    0x91, 0x7b, 0x6a, 0xff, 0x81, 0x91, 0x7b, 0x69, 0xff, 0x00, 0x90, 0x7a, 0x69, 0xff, 0x81, 0x8f,
+    0x7a, 0x69, 0xff, 0x05, 0x8f, 0x7a, 0x68, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x81, 0x6e, 0x5d, 0xff,
+    0x87, 0x79, 0x6e, 0xff, 0xf0, 0xf0, 0xf0, 0x21, 0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xbc, 0xa5,
+    0x98, 0xb8, 0x93, 0x7d, 0x6c, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x70,
+    0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x80, 0x6e, 0x5c, 0xff, 0x82, 0x7f, 0x6d, 0x5b, 0xff,
+    0x06, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6d, 0x59,
+    0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6b, 0x58, 0xff, 0x81, 0x79, 0x69,
+    0x57, 0xff, 0x03, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76,
+    0x65, 0x55, 0xff, 0x81, 0x75, 0x65, 0x53, 0xff, 0x81, 0x75, 0x66, 0x53, 0xff, 0x00, 0x74, 0x65,
+    0x52, 0xff, 0x81, 0x73, 0x64, 0x51, 0xff, 0x03, 0x72, 0x64, 0x50, 0xff, 0x71, 0x62, 0x4f, 0xff,
+    0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x82, 0x6e, 0x61, 0x4e, 0xff, 0x06, 0x6e, 0x61,
+    0x4c, 0xff, 0x66, 0x59, 0x43, 0xfb, 0x6a, 0x5e, 0x4a, 0xff, 0x8c, 0x85, 0x7e, 0xff, 0xea, 0xe6,
+    0xe6, 0x3d, 0x96, 0x81, 0x6f, 0xed, 0x8e, 0x77, 0x64, 0xff, 0x82, 0x94, 0x7e, 0x6c, 0xff, 0x87,
+    0x95, 0x7f, 0x6d, 0xff, 0x04, 0x94, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x97, 0x80, 0x6e,
+    0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x81, 0x97, 0x81, 0x6f, 0xff, 0x08, 0x97,
+    0x81, 0x6e, 0xff, 0x96, 0x7f, 0x6c, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x90,
+    0x79, 0x67, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x78, 0x66, 0xff, 0x8e,
+    0x78, 0x66, 0xff, 0x81, 0x8e, 0x77, 0x65, 0xff, 0x0b, 0x8d, 0x77, 0x64, 0xff, 0x8d, 0x76, 0x63,
+    0xff, 0x8d, 0x77, 0x63, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8f, 0x7a, 0x69,
+    0xff, 0x8e, 0x79, 0x68, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x83, 0x70, 0x5f,
+    0xff, 0x8a, 0x7c, 0x6e, 0xff, 0xf1, 0xf1, 0xf1, 0x24, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
+    0x01, 0xaf, 0x99, 0x8a, 0xb2, 0x8d, 0x78, 0x65, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x81, 0x6f,
+    0x5d, 0xff, 0x06, 0x80, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7f,
+    0x6d, 0x5a, 0xff, 0x7d, 0x6a, 0x57, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x79, 0x67, 0x54, 0xff, 0x81,
+    0x79, 0x67, 0x53, 0xff, 0x81, 0x78, 0x66, 0x52, 0xff, 0x07, 0x77, 0x65, 0x51, 0xff, 0x76, 0x64,
+    0x51, 0xff, 0x75, 0x64, 0x51, 0xff, 0x73, 0x62, 0x50, 0xff, 0x73, 0x62, 0x4f, 0xff, 0x74, 0x64,
+    0x51, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x54, 0xff, 0x81, 0x74, 0x64, 0x52, 0xff, 0x81,
+    0x75, 0x66, 0x53, 0xff, 0x03, 0x74, 0x66, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51,
+    0xff, 0x72, 0x63, 0x50, 0xff, 0x81, 0x71, 0x63, 0x4f, 0xff, 0x0c, 0x72, 0x63, 0x4f, 0xff, 0x70,
+    0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69,
+    0x5d, 0x48, 0xff, 0x66, 0x59, 0x46, 0xff, 0x72, 0x67, 0x56, 0xff, 0xb9, 0xb5, 0xb0, 0x8e, 0xee,
+    0xee, 0xe8, 0x2d, 0x93, 0x7d, 0x6c, 0xff, 0x8b, 0x74, 0x61, 0xff, 0x90, 0x7a, 0x68, 0xfc, 0x81,
+    0x91, 0x7c, 0x6a, 0xff, 0x02, 0x92, 0x7c, 0x6b, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x95, 0x7e, 0x6c,
+    0xff, 0x81, 0x94, 0x7e, 0x6c, 0xff, 0x00, 0x95, 0x7e, 0x6c, 0xff, 0x81, 0x95, 0x7f, 0x6d, 0xff,
+    0x01, 0x94, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x82, 0x96, 0x80, 0x6e, 0xff, 0x04, 0x95,
+    0x7f, 0x6e, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6b, 0xfc, 0x92, 0x7b, 0x69, 0xff, 0x92,
+    0x7c, 0x6b, 0xff, 0x81, 0x93, 0x7e, 0x6d, 0xff, 0x04, 0x92, 0x7f, 0x6c, 0xff, 0x92, 0x7e, 0x6c,
+    0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x83, 0x91, 0x7c,
+    0x6a, 0xff, 0x02, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xfc, 0x81,
+    0x8e, 0x79, 0x68, 0xff, 0x03, 0x8e, 0x79, 0x67, 0xff, 0x85, 0x70, 0x5d, 0xff, 0x8f, 0x7e, 0x6d,
+    0xff, 0xe9, 0xe4, 0xe4, 0x39, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x0c, 0x9f,
+    0x8a, 0x7a, 0xdd, 0x85, 0x71, 0x5e, 0xff, 0x7f, 0x6e, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80,
+    0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7f, 0x6d, 0x5a, 0xfb, 0x7f,
+    0x6c, 0x5a, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x7e, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5c, 0xff, 0x81,
+    0x7e, 0x6d, 0x5b, 0xff, 0x0d, 0x7d, 0x6c, 0x5a, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58,
+    0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x69, 0x57,
+    0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xfb, 0x75, 0x66, 0x54, 0xff, 0x74, 0x65, 0x53,
+    0xff, 0x75, 0x66, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x81, 0x73, 0x65,
+    0x51, 0xff, 0x00, 0x72, 0x64, 0x50, 0xff, 0x81, 0x71, 0x63, 0x4f, 0xff, 0x81, 0x70, 0x63, 0x4f,
+    0xff, 0x06, 0x6d, 0x5f, 0x4b, 0xfb, 0x6d, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62,
+    0x50, 0xff, 0x70, 0x64, 0x54, 0xff, 0x7a, 0x6f, 0x64, 0xff, 0x8d, 0x86, 0x80, 0xff, 0x81, 0xff,
+    0xff, 0xff, 0x0b, 0x08, 0x9e, 0x8a, 0x7b, 0xf6, 0x8f, 0x7a, 0x68, 0xff, 0x8c, 0x76, 0x64, 0xff,
+    0x8f, 0x79, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x78, 0x66, 0xff,
+    0x91, 0x7c, 0x69, 0xfc, 0x93, 0x7c, 0x6c, 0xff, 0x81, 0x93, 0x7d, 0x6c, 0xff, 0x0d, 0x93, 0x7e,
+    0x6c, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x8f, 0x7c, 0x6a, 0xff, 0x83, 0x72,
+    0x5e, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x82, 0x70, 0x5c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7d, 0x6b,
+    0x5b, 0xff, 0x79, 0x67, 0x5d, 0xff, 0x84, 0x74, 0x6e, 0xff, 0x9a, 0x8c, 0x84, 0xff, 0xc2, 0xba,
+    0xb3, 0x93, 0xdb, 0xd5, 0xd3, 0x56, 0x81, 0xd8, 0xd2, 0xcd, 0x5b, 0x81, 0xd5, 0xd0, 0xcb, 0x62,
+    0x0d, 0xd7, 0xd2, 0xcc, 0x5a, 0xd8, 0xd0, 0xca, 0x5c, 0xd6, 0xcf, 0xc7, 0x64, 0xdd, 0xd7, 0xd1,
+    0x53, 0xc5, 0xba, 0xb5, 0x90, 0xa4, 0x95, 0x8b, 0xff, 0x93, 0x80, 0x71, 0xff, 0x8b, 0x76, 0x64,
+    0xfc, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x67, 0xff, 0x85, 0x70, 0x5c,
+    0xff, 0x92, 0x7f, 0x6d, 0xff, 0xd0, 0xca, 0xc5, 0x73, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xde,
+    0xd7, 0xd1, 0x4d, 0x90, 0x7e, 0x6d, 0xff, 0x7c, 0x68, 0x55, 0xff, 0x80, 0x6f, 0x5d, 0xfb, 0x81,
+    0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x7a, 0x69, 0x59, 0xfb, 0x75,
+    0x68, 0x5f, 0xff, 0x80, 0x73, 0x6d, 0xff, 0x91, 0x85, 0x7d, 0xff, 0xa0, 0x95, 0x8c, 0xff, 0xb8,
+    0xaf, 0xa7, 0x9f, 0xc2, 0xbc, 0xb3, 0x79, 0xbe, 0xb6, 0xae, 0x85, 0x83, 0xbf, 0xb7, 0xaf, 0x83,
+    0x09, 0xbe, 0xb8, 0xb0, 0x7e, 0xbb, 0xb4, 0xac, 0x8b, 0xa7, 0x9e, 0x96, 0xdf, 0x91, 0x84, 0x78,
+    0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5b,
+    0xff, 0x7a, 0x6a, 0x58, 0xff, 0x76, 0x66, 0x53, 0xff, 0x81, 0x73, 0x64, 0x51, 0xff, 0x0b, 0x72,
+    0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x64,
+    0x57, 0x4a, 0xf8, 0x67, 0x5b, 0x54, 0xff, 0x7b, 0x72, 0x6c, 0xff, 0x94, 0x8c, 0x86, 0xff, 0xc2,
+    0xbf, 0xba, 0x60, 0xe8, 0xe8, 0xe8, 0x16, 0xeb, 0xeb, 0xeb, 0x0d, 0xff, 0xff, 0xff, 0x08, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xf3, 0xf3, 0xf3, 0x16, 0xc1, 0xb8, 0xae, 0xa1, 0xa8, 0x98, 0x8a,
+    0xff, 0xa3, 0x91, 0x84, 0xff, 0xa1, 0x8f, 0x81, 0xf9, 0x9e, 0x8d, 0x7e, 0xff, 0x98, 0x87, 0x78,
+    0xff, 0x90, 0x7d, 0x6d, 0xff, 0x90, 0x7c, 0x6b, 0xf9, 0x92, 0x7d, 0x6c, 0xff, 0x81, 0x91, 0x7c,
+    0x6b, 0xff, 0x0b, 0x93, 0x7d, 0x6c, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x75,
+    0x67, 0x54, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x67,
+    0x5a, 0x4c, 0xff, 0x76, 0x6b, 0x6a, 0xff, 0xb3, 0xac, 0xb0, 0x94, 0xf6, 0xf6, 0xf6, 0x1d, 0xff,
+    0xff, 0xff, 0x04, 0x82, 0xff, 0xff, 0xff, 0x02, 0x81, 0xff, 0xff, 0xff, 0x03, 0x0d, 0xff, 0xff,
+    0xff, 0x02, 0xfe, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+    0xff, 0x05, 0xff, 0xff, 0xff, 0x11, 0xbb, 0xb0, 0xa7, 0x71, 0x88, 0x73, 0x61, 0xff, 0x8b, 0x76,
+    0x64, 0xfc, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x77, 0x65, 0xfc, 0x87, 0x72, 0x60, 0xff, 0x93, 0x82,
+    0x76, 0xff, 0xe0, 0xdd, 0xda, 0x4b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x0d,
+    0x95, 0x85, 0x77, 0xf8, 0x82, 0x70, 0x5e, 0xff, 0x7e, 0x6c, 0x59, 0xfb, 0x81, 0x6f, 0x5d, 0xff,
+    0x81, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5a, 0xf7, 0x7a, 0x6b, 0x61, 0xff, 0x83, 0x7b, 0x7d, 0xff,
+    0xd0, 0xd0, 0xd0, 0x2b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x03,
+    0x88, 0xff, 0xff, 0xff, 0x02, 0x06, 0xd1, 0xcc, 0xc7, 0x37, 0x91, 0x7e, 0x6e, 0xff, 0x86, 0x71,
+    0x5e, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x88, 0x74, 0x63, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x77, 0x67,
+    0x54, 0xff, 0x82, 0x72, 0x64, 0x50, 0xff, 0x08, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x65, 0x4f, 0xff,
+    0x6c, 0x5e, 0x4c, 0xff, 0x5f, 0x53, 0x50, 0xff, 0x80, 0x78, 0x7c, 0xff, 0xd1, 0xcc, 0xd1, 0x32,
+    0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff,
+    0xff, 0x07, 0xf5, 0xf5, 0xf5, 0x19, 0xc6, 0xbd, 0xb8, 0x90, 0x9d, 0x8d, 0x81, 0xff, 0x93, 0x7e,
+    0x6c, 0xff, 0x90, 0x7a, 0x68, 0xf9, 0x81, 0x91, 0x7b, 0x6a, 0xff, 0x09, 0x92, 0x7c, 0x6b, 0xff,
+    0x93, 0x7e, 0x6c, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x79, 0x69, 0x56, 0xff, 0x6d, 0x60, 0x4c, 0xff,
+    0x6c, 0x5f, 0x4a, 0xff, 0x68, 0x5b, 0x45, 0xff, 0x68, 0x5c, 0x4a, 0xff, 0x95, 0x8d, 0x8b, 0xff,
+    0xf0, 0xf0, 0xf8, 0x23, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd5, 0xce, 0xca, 0x43, 0x91, 0x7e,
+    0x6d, 0xff, 0x89, 0x74, 0x62, 0xf6, 0x8c, 0x78, 0x65, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8b, 0x79,
+    0x6c, 0xff, 0xa3, 0x9b, 0x96, 0xb2, 0xff, 0xff, 0xff, 0x05, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xe1, 0xdc, 0xd8, 0x3b, 0x90, 0x81, 0x72, 0xff, 0x7a, 0x68, 0x55, 0xff,
+    0x7f, 0x6d, 0x5a, 0xff, 0x80, 0x6d, 0x5a, 0xf8, 0x7e, 0x6e, 0x5e, 0xff, 0x89, 0x7e, 0x79, 0xff,
+    0xcf, 0xcf, 0xcf, 0x30, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe6, 0xe6, 0xe6, 0x14, 0x99, 0x86,
+    0x76, 0xff, 0x88, 0x72, 0x5f, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x81, 0x6f,
+    0x5c, 0xff, 0x76, 0x67, 0x54, 0xff, 0x81, 0x72, 0x64, 0x50, 0xff, 0x05, 0x71, 0x63, 0x4f, 0xff,
+    0x70, 0x62, 0x4f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5c, 0x4c, 0xff, 0x73, 0x6b, 0x6b, 0xff,
+    0xc1, 0xc1, 0xc5, 0x3e, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x86, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x01, 0xd9, 0xd7, 0xcf, 0x50, 0x9d, 0x8b, 0x7b, 0xff,
+    0x8a, 0x73, 0x60, 0xfc, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff,
+    0x92, 0x7c, 0x6a, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x70, 0x62, 0x4d, 0xff,
+    0x6c, 0x5f, 0x4a, 0xff, 0x69, 0x5c, 0x45, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x92, 0x8a, 0x86, 0xff,
+    0xef, 0xef, 0xef, 0x20, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe9, 0xe4, 0xde, 0x2f, 0xa3, 0x93,
+    0x85, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x87, 0x73, 0x60, 0xf9, 0x80, 0x6d, 0x5a, 0xff, 0x8d, 0x80,
+    0x73, 0xff, 0xec, 0xec, 0xec, 0x29, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xcc, 0xc3,
+    0xbd, 0x78, 0xac, 0x9d, 0x8f, 0xed, 0xdf, 0xd7, 0xd3, 0x40, 0xff, 0xff, 0xff, 0x01, 0x81, 0xff,
+    0xff, 0xff, 0x02, 0x03, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xef, 0xef, 0x20, 0xc7, 0xb8, 0xae, 0x9e,
+    0xf0, 0xe9, 0xe9, 0x23, 0x81, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x02, 0xa3, 0x95,
+    0x88, 0xd9, 0x80, 0x6d, 0x5a, 0xff, 0x7b, 0x68, 0x54, 0xfb, 0x7b, 0x68, 0x56, 0xff, 0x85, 0x78,
+    0x6d, 0xff, 0xcc, 0xc7, 0xc7, 0x32, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xea, 0xdf, 0xdf, 0x18,
+    0x98, 0x85, 0x73, 0xff, 0x8a, 0x74, 0x62, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8b, 0x77, 0x65, 0xff,
+    0x7c, 0x6c, 0x59, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x64, 0x50, 0xff,
+    0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x69, 0x5d, 0x4e, 0xfb,
+    0x86, 0x80, 0x80, 0xff, 0xdd, 0xdd, 0xe6, 0x1e, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+    0xff, 0x01, 0xb7, 0xa9, 0x9c, 0x7c, 0x89, 0x72, 0x61, 0xff, 0x91, 0x7b, 0x6a, 0xf6, 0x81, 0x90,
+    0x7a, 0x69, 0xff, 0x08, 0x91, 0x7b, 0x6a, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x83, 0x70, 0x5e, 0xff,
+    0x72, 0x63, 0x4f, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6b, 0x5e, 0x48, 0xff,
+    0x84, 0x7a, 0x72, 0xff, 0xe1, 0xe1, 0xe1, 0x2a, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x19, 0xde, 0xd7,
+    0xd3, 0x46, 0x94, 0x83, 0x72, 0xff, 0x84, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x8c, 0x7f,
+    0x70, 0xff, 0xd9, 0xd4, 0xd1, 0x58, 0xff, 0xff, 0xff, 0x06, 0xe9, 0xe3, 0xe3, 0x2e, 0x95, 0x85,
+    0x75, 0xff, 0x8d, 0x7a, 0x69, 0xff, 0x9c, 0x8a, 0x7c, 0xff, 0xb2, 0xa3, 0x97, 0xbc, 0xb4, 0xa5,
+    0x96, 0xbe, 0xb5, 0xa6, 0x99, 0xc1, 0xba, 0xaa, 0x9c, 0xbc, 0xa9, 0x94, 0x84, 0xfc, 0x95, 0x80,
+    0x6f, 0xff, 0x96, 0x86, 0x77, 0xff, 0xe3, 0xdf, 0xdf, 0x37, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+    0xff, 0x07, 0xaf, 0x9c, 0x8d, 0xd9, 0x8d, 0x77, 0x65, 0xff, 0x77, 0x64, 0x52, 0xff, 0x87, 0x78,
+    0x6a, 0xff, 0xc8, 0xc5, 0xbd, 0x46, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xd3, 0xc8, 0xc1, 0x46,
+    0x95, 0x81, 0x6f, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8b, 0x77, 0x64, 0xff,
+    0x78, 0x69, 0x54, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff,
+    0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x51, 0xff,
+    0x96, 0x90, 0x8f, 0xff, 0xf2, 0xf2, 0xf2, 0x13, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xbc, 0xb5, 0x48, 0x8c, 0x76, 0x65, 0xff,
+    0x90, 0x7b, 0x6a, 0xf3, 0x82, 0x8f, 0x7a, 0x69, 0xff, 0x07, 0x8f, 0x79, 0x69, 0xff, 0x87, 0x74,
+    0x62, 0xff, 0x74, 0x65, 0x50, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6b, 0x5e,
+    0x49, 0xff, 0x79, 0x6f, 0x62, 0xff, 0xe3, 0xdd, 0xdd, 0x25, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x0d,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xc9, 0xbf, 0xb8, 0x68, 0x87, 0x74, 0x62, 0xff,
+    0x7d, 0x6a, 0x57, 0xff, 0x8a, 0x78, 0x67, 0xff, 0x9e, 0x8d, 0x7f, 0xff, 0xa7, 0x97, 0x8a, 0xe8,
+    0x95, 0x84, 0x74, 0xfc, 0x80, 0x6d, 0x5a, 0xff, 0x80, 0x6e, 0x5a, 0xf9, 0x85, 0x73, 0x61, 0xff,
+    0x8d, 0x79, 0x68, 0xff, 0x90, 0x7c, 0x69, 0xff, 0x81, 0x91, 0x7d, 0x6b, 0xff, 0x0d, 0x89, 0x75,
+    0x62, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x8f, 0x81, 0x71, 0xff, 0xa7, 0x9c,
+    0x8e, 0xda, 0xac, 0x9b, 0x8c, 0xd9, 0xa3, 0x8c, 0x7c, 0xf8, 0x8a, 0x74, 0x61, 0xff, 0x7d, 0x6c,
+    0x5b, 0xff, 0xb9, 0xb1, 0xa9, 0x80, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf3, 0xe7, 0xe7, 0x15,
+    0xaa, 0x99, 0x8a, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x94, 0x7d, 0x6c, 0xff,
+    0x89, 0x75, 0x62, 0xff, 0x75, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x51, 0xff,
+    0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x69, 0x5b, 0x49, 0xfb,
+    0x74, 0x69, 0x5f, 0xff, 0xbf, 0xbc, 0xbc, 0x54, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x8e, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc9, 0xc0, 0xb7, 0x55, 0x94, 0x81, 0x71, 0xff, 0x8d, 0x79,
+    0x67, 0xf3, 0x8d, 0x79, 0x67, 0xff, 0x81, 0x8e, 0x79, 0x68, 0xff, 0x07, 0x8f, 0x7a, 0x69, 0xff,
+    0x8b, 0x77, 0x65, 0xff, 0x75, 0x67, 0x53, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff,
+    0x6b, 0x5e, 0x49, 0xff, 0x6f, 0x63, 0x53, 0xff, 0xd8, 0xd8, 0xd3, 0x2e, 0x8e, 0x00, 0x00, 0x00,
+    0x00, 0x17, 0xff, 0xff, 0xff, 0x03, 0xb9, 0xae, 0xa3, 0x8d, 0x87, 0x74, 0x63, 0xff, 0x86, 0x72,
+    0x60, 0xe8, 0x8c, 0x78, 0x65, 0xff, 0x8c, 0x79, 0x68, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71,
+    0x5f, 0xfc, 0x84, 0x72, 0x61, 0xfc, 0x83, 0x71, 0x5e, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x82, 0x6f,
+    0x5c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6e,
+    0x5c, 0xfc, 0x7e, 0x6b, 0x59, 0xfc, 0x7f, 0x6c, 0x5b, 0xff, 0x87, 0x76, 0x64, 0xff, 0x8c, 0x79,
+    0x67, 0xff, 0x86, 0x72, 0x5f, 0xef, 0x86, 0x75, 0x64, 0xff, 0xbb, 0xb4, 0xab, 0x6d, 0xff, 0xff,
+    0xff, 0x02, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe4, 0xe4, 0xd7, 0x13, 0x98, 0x83, 0x71, 0xff,
+    0x93, 0x7d, 0x6a, 0xff, 0x95, 0x7e, 0x6e, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x85, 0x72, 0x5f, 0xff,
+    0x74, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff,
+    0x81, 0x70, 0x62, 0x4f, 0xff, 0x02, 0x67, 0x5a, 0x48, 0xf8, 0x7d, 0x74, 0x6b, 0xff, 0xdb, 0xdb,
+    0xdb, 0x23, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe6, 0xe2, 0xde, 0x3e, 0xa4, 0x95, 0x87, 0xff,
+    0x87, 0x74, 0x61, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff,
+    0x8f, 0x7a, 0x69, 0xff, 0x8c, 0x7a, 0x66, 0xff, 0x7a, 0x6b, 0x58, 0xff, 0x6d, 0x60, 0x4c, 0xff,
+    0x6c, 0x60, 0x4a, 0xff, 0x6a, 0x5d, 0x48, 0xff, 0x68, 0x5b, 0x46, 0xff, 0xa9, 0xa3, 0x9a, 0xa1,
+    0xff, 0xff, 0xff, 0x08, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0x17, 0xae, 0xa1,
+    0x94, 0xee, 0x8b, 0x78, 0x67, 0xff, 0x80, 0x6c, 0x59, 0xfc, 0x83, 0x71, 0x5d, 0xf3, 0x83, 0x72,
+    0x5f, 0xff, 0x84, 0x73, 0x62, 0xff, 0x84, 0x72, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x72,
+    0x60, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x81, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6f,
+    0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7f, 0x6c, 0x5a, 0xff, 0x7d, 0x6a,
+    0x57, 0xf5, 0x7a, 0x68, 0x53, 0xf8, 0x83, 0x73, 0x62, 0xff, 0xac, 0x9f, 0x96, 0xd9, 0xff, 0xff,
+    0xff, 0x0b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd4, 0xce, 0xc8, 0x2a, 0x92, 0x7b, 0x69, 0xff,
+    0x94, 0x7e, 0x6c, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x80, 0x6e, 0x5b, 0xff,
+    0x73, 0x65, 0x51, 0xff, 0x81, 0x70, 0x63, 0x4f, 0xff, 0x06, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62,
+    0x4f, 0xff, 0x6f, 0x61, 0x4f, 0xff, 0x69, 0x5b, 0x48, 0xfb, 0x76, 0x6b, 0x5b, 0xff, 0xb4, 0xb0,
+    0xa6, 0x6a, 0xff, 0xff, 0xff, 0x01, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xef, 0xea, 0xea, 0x30,
+    0xa1, 0x92, 0x82, 0xff, 0x87, 0x74, 0x61, 0xff, 0x8b, 0x78, 0x65, 0xfc, 0x8d, 0x79, 0x67, 0xff,
+    0x8c, 0x78, 0x66, 0xff, 0x8e, 0x7a, 0x67, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x81, 0x70, 0x5d, 0xff,
+    0x73, 0x65, 0x51, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5e, 0x48, 0xff, 0x67, 0x59, 0x44, 0xff,
+    0x86, 0x7b, 0x6e, 0xff, 0xe2, 0xde, 0xde, 0x3d, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf7, 0xf7,
+    0xef, 0x20, 0xc2, 0xb8, 0xb1, 0x6c, 0x92, 0x82, 0x72, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x79, 0x65,
+    0x52, 0xfc, 0x80, 0x6d, 0x5b, 0xf9, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x61, 0xff, 0x83, 0x71,
+    0x5f, 0xff, 0x81, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x81, 0x6f, 0x5d, 0xff, 0x05, 0x81, 0x6f, 0x5c,
+    0xff, 0x80, 0x6c, 0x58, 0xf8, 0x7c, 0x69, 0x57, 0xff, 0x81, 0x71, 0x62, 0xff, 0xb8, 0xaf, 0xa6,
+    0x76, 0xf6, 0xf6, 0xf6, 0x1b, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x85,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0xff, 0x07, 0xb0, 0x9e, 0x90, 0xff, 0x94, 0x7d, 0x6b,
+    0xff, 0x97, 0x80, 0x6e, 0xff, 0x99, 0x82, 0x70, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x78, 0x69, 0x54,
+    0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e,
+    0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6d, 0x5f, 0x4b,
+    0xfb, 0x82, 0x77, 0x66, 0xff, 0xb2, 0xac, 0xa3, 0x53, 0xff, 0xe3, 0xe3, 0x09, 0xff, 0xff, 0xff,
+    0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff, 0x06, 0xec, 0xec, 0xe7, 0x29, 0xb1,
+    0xa5, 0x98, 0x90, 0x8f, 0x7b, 0x6a, 0xff, 0x8b, 0x78, 0x65, 0xf9, 0x8b, 0x77, 0x65, 0xff, 0x8c,
+    0x78, 0x66, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x88,
+    0x75, 0x63, 0xff, 0x79, 0x69, 0x56, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6a,
+    0x5d, 0x49, 0xff, 0x6f, 0x62, 0x52, 0xff, 0xa1, 0x99, 0x8f, 0xed, 0xff, 0xff, 0xff, 0x11, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe5, 0xe0, 0xe0, 0x31, 0xad, 0xa2, 0x95,
+    0xa4, 0x94, 0x85, 0x76, 0xff, 0x8e, 0x7d, 0x6d, 0xff, 0x84, 0x72, 0x5f, 0xfc, 0x82, 0x70, 0x5e,
+    0xfc, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x82, 0x81, 0x6f, 0x5d, 0xff, 0x04, 0x7f,
+    0x6d, 0x5b, 0xff, 0x7d, 0x6b, 0x5a, 0xf9, 0x7c, 0x6b, 0x5b, 0xff, 0x88, 0x7a, 0x6d, 0xff, 0xca,
+    0xc6, 0xbf, 0x48, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x00, 0x00, 0x0a, 0xda, 0xd1, 0xcc, 0x37, 0xa0, 0x8a, 0x79, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x99,
+    0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70,
+    0x62, 0x4e, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x82,
+    0x6e, 0x61, 0x4e, 0xff, 0x06, 0x6e, 0x61, 0x4c, 0xfb, 0x6b, 0x5f, 0x4a, 0xff, 0x6a, 0x5d, 0x47,
+    0xff, 0x7b, 0x70, 0x5d, 0xff, 0xb2, 0xac, 0xa0, 0x84, 0xea, 0xea, 0xea, 0x18, 0xff, 0xfe, 0xff,
+    0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x13, 0xb6, 0xac, 0xa1, 0x90, 0x9a,
+    0x89, 0x7a, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xfc, 0x84, 0x8b, 0x77, 0x65, 0xff,
+    0x81, 0x8c, 0x78, 0x66, 0xff, 0x08, 0x7e, 0x6d, 0x5a, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x5f,
+    0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x68, 0x5a, 0x47, 0xff, 0x87, 0x7b, 0x6c, 0xff, 0xf2, 0xf2,
+    0xf2, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x09, 0xe7, 0xe7,
+    0xe2, 0x35, 0xc5, 0xbb, 0xb3, 0x65, 0x8a, 0x79, 0x68, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f,
+    0x5c, 0xff, 0x81, 0x81, 0x6f, 0x5d, 0xff, 0x05, 0x82, 0x6f, 0x5d, 0xff, 0x7e, 0x6d, 0x5b, 0xff,
+    0x79, 0x68, 0x58, 0xf9, 0x76, 0x68, 0x5e, 0xff, 0x87, 0x7c, 0x78, 0xff, 0xcc, 0xc9, 0xc9, 0x4b,
+    0x91, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x06, 0xaf, 0x9c, 0x8d, 0xff, 0x97, 0x7f,
+    0x6c, 0xff, 0x9a, 0x83, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x7e, 0x6d,
+    0x5b, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x61,
+    0x4f, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4d, 0xff, 0x06, 0x6d, 0x61, 0x4d,
+    0xff, 0x6a, 0x5e, 0x49, 0xfb, 0x68, 0x5a, 0x44, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x74, 0x67, 0x54,
+    0xff, 0x86, 0x7b, 0x6a, 0xff, 0xff, 0xe6, 0xe6, 0x0a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff,
+    0xff, 0xff, 0x03, 0xd0, 0xca, 0xc1, 0x57, 0x9f, 0x8f, 0x81, 0xff, 0x8d, 0x7a, 0x68, 0xff, 0x83,
+    0x6e, 0x5b, 0xff, 0x86, 0x73, 0x60, 0xff, 0x84, 0x8b, 0x77, 0x65, 0xff, 0x0a, 0x8a, 0x76, 0x65,
+    0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x75, 0x66, 0x53,
+    0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x7a, 0x6d, 0x5a,
+    0xff, 0xc2, 0xba, 0xb2, 0x64, 0xff, 0xff, 0xff, 0x02, 0x92, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
+    0xff, 0xff, 0x0a, 0x99, 0x8a, 0x7c, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x81,
+    0x81, 0x6f, 0x5d, 0xff, 0x04, 0x82, 0x6f, 0x5c, 0xff, 0x7a, 0x69, 0x58, 0xfc, 0x71, 0x63, 0x5a,
+    0xff, 0x7b, 0x72, 0x71, 0xff, 0xcc, 0xcc, 0xcc, 0x41, 0x92, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcd,
+    0xc0, 0xb6, 0x4d, 0xa1, 0x8a, 0x79, 0xff, 0x99, 0x81, 0x6e, 0xff, 0x9f, 0x87, 0x74, 0xff, 0x9b,
+    0x84, 0x71, 0xff, 0x87, 0x74, 0x61, 0xff, 0x75, 0x66, 0x53, 0xff, 0x81, 0x70, 0x62, 0x4e, 0xff,
+    0x0d, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d,
+    0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c,
+    0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x64, 0x56, 0x40, 0xff, 0x65, 0x57, 0x41,
+    0xff, 0xb9, 0xb3, 0xa8, 0x5b, 0xff, 0xff, 0xff, 0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff,
+    0xff, 0xff, 0x05, 0xb9, 0xad, 0xa4, 0x86, 0x8c, 0x7a, 0x69, 0xff, 0x7f, 0x6b, 0x58, 0xff, 0x87,
+    0x73, 0x61, 0xff, 0x81, 0x89, 0x76, 0x64, 0xff, 0x01, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x75, 0x63,
+    0xff, 0x81, 0x89, 0x75, 0x63, 0xff, 0x01, 0x8a, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x81,
+    0x8a, 0x76, 0x64, 0xff, 0x07, 0x88, 0x75, 0x62, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x70, 0x63, 0x50,
+    0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xfc, 0x73, 0x64, 0x51, 0xff, 0x8a, 0x7e, 0x6e,
+    0xff, 0xf2, 0xf2, 0xf2, 0x14, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x11, 0xa2, 0x94, 0x87, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x7e,
+    0x6c, 0x59, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x76,
+    0x65, 0x55, 0xff, 0x76, 0x69, 0x64, 0xff, 0xa4, 0x9d, 0xa0, 0xc4, 0xff, 0xff, 0xff, 0x04, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x06, 0xa8, 0x92, 0x81, 0xff, 0x9e, 0x85, 0x73,
+    0xff, 0x9e, 0x86, 0x74, 0xfb, 0xa0, 0x88, 0x76, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x7d, 0x6c, 0x58,
+    0xff, 0x6f, 0x61, 0x4d, 0xff, 0x81, 0x70, 0x62, 0x4f, 0xff, 0x03, 0x6f, 0x62, 0x4e, 0xff, 0x6e,
+    0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x81, 0x6e, 0x61, 0x4d, 0xff,
+    0x00, 0x6d, 0x60, 0x4c, 0xff, 0x81, 0x6d, 0x60, 0x4b, 0xff, 0x04, 0x6d, 0x61, 0x4c, 0xff, 0x68,
+    0x5a, 0x45, 0xfb, 0x69, 0x5c, 0x47, 0xff, 0x9a, 0x92, 0x85, 0xff, 0xff, 0xff, 0xff, 0x09, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xec, 0xec, 0xec,
+    0x1b, 0x8c, 0x7a, 0x69, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x85, 0x72, 0x60, 0xfc, 0x86, 0x73, 0x61,
+    0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x75, 0x63, 0xff, 0x81, 0x88, 0x75, 0x63, 0xff, 0x00, 0x87,
+    0x75, 0x63, 0xff, 0x82, 0x88, 0x75, 0x63, 0xff, 0x0a, 0x88, 0x75, 0x62, 0xff, 0x88, 0x75, 0x63,
+    0xff, 0x89, 0x76, 0x64, 0xff, 0x83, 0x72, 0x60, 0xff, 0x76, 0x67, 0x55, 0xff, 0x70, 0x63, 0x50,
+    0xff, 0x73, 0x64, 0x50, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x74, 0x65, 0x52, 0xff, 0xb4, 0xac, 0xa4,
+    0x7b, 0xff, 0xff, 0xff, 0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x87,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x12, 0xa0, 0x92, 0x84, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x81, 0x7f, 0x6e,
+    0x5b, 0xff, 0x03, 0x7f, 0x6d, 0x5a, 0xff, 0x77, 0x66, 0x56, 0xff, 0x7d, 0x71, 0x6a, 0xff, 0xeb,
+    0xe5, 0xe4, 0x27, 0x92, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xcb, 0xc0, 0xb7, 0x59, 0xa1, 0x89, 0x77,
+    0xff, 0x9e, 0x85, 0x72, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9d, 0x85, 0x74, 0xff, 0x8b, 0x77, 0x64,
+    0xff, 0x76, 0x66, 0x52, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f,
+    0xff, 0x6e, 0x62, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x02, 0x6e, 0x61, 0x4d, 0xff, 0x6e,
+    0x61, 0x4e, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x83, 0x6d, 0x60, 0x4b, 0xff, 0x03, 0x69, 0x5c, 0x46,
+    0xff, 0x6d, 0x61, 0x4c, 0xff, 0xa7, 0xa0, 0x99, 0xd1, 0xff, 0xff, 0xff, 0x05, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xf4, 0xf4, 0xf4, 0x17, 0x94, 0x84, 0x74, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85,
+    0x73, 0x61, 0xff, 0x8a, 0x86, 0x74, 0x62, 0xff, 0x09, 0x87, 0x75, 0x63, 0xff, 0x86, 0x74, 0x62,
+    0xff, 0x7f, 0x6f, 0x5b, 0xff, 0x75, 0x67, 0x53, 0xff, 0x72, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51,
+    0xfc, 0x72, 0x63, 0x4f, 0xff, 0x81, 0x73, 0x63, 0xff, 0xba, 0xb1, 0xa9, 0x7d, 0xff, 0xff, 0xff,
+    0x02, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0x12, 0x9e, 0x91, 0x83, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7d, 0x6a, 0x58, 0xff, 0x81,
+    0x7f, 0x6d, 0x5b, 0xff, 0x05, 0x7f, 0x6d, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x73, 0x6b,
+    0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd9, 0xcf, 0xc8,
+    0x4a, 0xaa, 0x91, 0x81, 0xff, 0xa2, 0x88, 0x76, 0xff, 0xa2, 0x8a, 0x78, 0xfb, 0xa4, 0x8c, 0x7a,
+    0xff, 0x95, 0x7f, 0x6d, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e,
+    0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x81, 0x6e, 0x60, 0x4e, 0xff, 0x0b, 0x6e,
+    0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6c,
+    0x5f, 0x4a, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6a,
+    0x5c, 0x47, 0xff, 0x72, 0x66, 0x58, 0xff, 0xcb, 0xc5, 0xc2, 0x58, 0xff, 0xff, 0xff, 0x01, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x07, 0xc9, 0xbf, 0xb8, 0x84, 0x8a, 0x78, 0x67,
+    0xff, 0x80, 0x6d, 0x5b, 0xff, 0x8b, 0x85, 0x73, 0x61, 0xff, 0x08, 0x86, 0x74, 0x62, 0xff, 0x85,
+    0x73, 0x60, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x74, 0x65, 0x52, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76,
+    0x66, 0x54, 0xf9, 0x70, 0x5f, 0x4c, 0xff, 0x8b, 0x7e, 0x6e, 0xff, 0xc4, 0xc0, 0xb7, 0x79, 0x8e,
+    0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x12, 0x9f, 0x91, 0x83, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7e, 0x6c, 0x5b,
+    0xff, 0x7f, 0x6c, 0x5b, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x74, 0x6c,
+    0xff, 0xf0, 0xf0, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x81, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe7, 0xdd, 0xdd,
+    0x35, 0xb2, 0x9b, 0x8c, 0xff, 0xa0, 0x84, 0x72, 0xff, 0xa6, 0x8b, 0x7a, 0xfb, 0xa8, 0x8e, 0x7d,
+    0xff, 0x9e, 0x86, 0x75, 0xff, 0x86, 0x74, 0x61, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6d, 0x61, 0x4e,
+    0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6c, 0x60, 0x4e,
+    0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x69, 0x5c, 0x45, 0xfb, 0x65, 0x58, 0x43,
+    0xff, 0x66, 0x58, 0x42, 0xff, 0x67, 0x5a, 0x43, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x6d, 0x60, 0x4a,
+    0xff, 0x6a, 0x5c, 0x45, 0xfb, 0x6a, 0x5c, 0x48, 0xff, 0x7e, 0x74, 0x6d, 0xff, 0xe7, 0xe7, 0xe7,
+    0x15, 0x86, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xeb, 0xeb, 0xe5, 0x27, 0x92, 0x81, 0x71, 0xff, 0x7f,
+    0x6c, 0x59, 0xff, 0x86, 0x75, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x74, 0x61, 0xff, 0x85,
+    0x73, 0x60, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x84, 0x72, 0x5e, 0xff, 0x84, 0x71, 0x5d, 0xff, 0x84,
+    0x72, 0x5f, 0xff, 0x85, 0x73, 0x62, 0xff, 0x82, 0x85, 0x73, 0x61, 0xff, 0x09, 0x86, 0x73, 0x62,
+    0xff, 0x85, 0x73, 0x62, 0xff, 0x80, 0x6e, 0x5d, 0xff, 0x79, 0x68, 0x56, 0xff, 0x75, 0x66, 0x54,
+    0xff, 0x76, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xf9, 0x79, 0x69, 0x57, 0xff, 0x8c, 0x7f, 0x6f,
+    0xff, 0xff, 0xff, 0xff, 0x09, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x12, 0x9e, 0x91, 0x83, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x7c,
+    0x6a, 0x58, 0xff, 0x81, 0x7e, 0x6c, 0x5a, 0xff, 0x05, 0x7e, 0x6c, 0x58, 0xff, 0x79, 0x69, 0x58,
+    0xff, 0x80, 0x75, 0x6c, 0xff, 0xf0, 0xf0, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x01, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x06, 0xb3, 0x9c, 0x8c, 0xed, 0xa6,
+    0x8b, 0x78, 0xff, 0xa7, 0x8c, 0x7a, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0x8f,
+    0x7b, 0x68, 0xff, 0x76, 0x68, 0x54, 0xff, 0x81, 0x6e, 0x62, 0x4e, 0xff, 0x0f, 0x6e, 0x61, 0x4f,
+    0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6a, 0x5e, 0x4b,
+    0xf8, 0x68, 0x5c, 0x4c, 0xff, 0x71, 0x66, 0x58, 0xff, 0x7d, 0x72, 0x63, 0xff, 0x80, 0x76, 0x64,
+    0xff, 0x7a, 0x6e, 0x5b, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x69, 0x5b, 0x46, 0xff, 0x67, 0x59, 0x44,
+    0xff, 0x75, 0x69, 0x5a, 0xff, 0x97, 0x90, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x07, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf3,
+    0xf3, 0xf3, 0x15, 0x9e, 0x90, 0x82, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x80, 0x6c, 0x59, 0xfc, 0x80,
+    0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5b, 0xfc, 0x80, 0x6d, 0x5b, 0xff, 0x81,
+    0x6f, 0x5e, 0xff, 0x84, 0x71, 0x61, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x82, 0x70, 0x5e, 0xf9, 0x84,
+    0x72, 0x60, 0xff, 0x82, 0x85, 0x73, 0x61, 0xff, 0x81, 0x84, 0x72, 0x60, 0xff, 0x07, 0x80, 0x6e,
+    0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x67,
+    0x53, 0xff, 0x7a, 0x69, 0x55, 0xff, 0xa8, 0x9d, 0x8f, 0x92, 0xff, 0xff, 0xff, 0x0b, 0x8c, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x12,
+    0x9e, 0x91, 0x83, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x81, 0x7e, 0x6d, 0x5a,
+    0xff, 0x05, 0x7d, 0x6c, 0x58, 0xff, 0x78, 0x68, 0x58, 0xff, 0x80, 0x75, 0x6b, 0xff, 0xf0, 0xf0,
+    0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x06, 0xc0, 0xac,
+    0x9d, 0x8d, 0xa7, 0x8c, 0x79, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xa9, 0x8e,
+    0x7d, 0xff, 0x99, 0x83, 0x70, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6f, 0x61,
+    0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x0c, 0x6e, 0x61, 0x4d, 0xff,
+    0x6e, 0x60, 0x4b, 0xff, 0x65, 0x58, 0x49, 0xff, 0x65, 0x5b, 0x57, 0xff, 0x88, 0x82, 0x83, 0xe9,
+    0xcc, 0xc9, 0xc9, 0x55, 0xdd, 0xdd, 0xd9, 0x35, 0xa2, 0x9a, 0x8f, 0xca, 0x83, 0x78, 0x69, 0xd6,
+    0x74, 0x68, 0x57, 0xca, 0x73, 0x68, 0x57, 0xdc, 0x8b, 0x82, 0x7b, 0xf8, 0xeb, 0xeb, 0xeb, 0x19,
+    0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x0c,
+    0xea, 0xea, 0xea, 0x24, 0x91, 0x80, 0x71, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x82, 0x71, 0x5e, 0xff,
+    0x85, 0x74, 0x62, 0xff, 0x88, 0x78, 0x6a, 0xff, 0x8b, 0x7d, 0x73, 0xff, 0x90, 0x85, 0x7e, 0xe8,
+    0x9b, 0x90, 0x8b, 0xc6, 0x8c, 0x7e, 0x72, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x83, 0x70, 0x5d, 0xfc,
+    0x84, 0x72, 0x60, 0xfc, 0x81, 0x84, 0x72, 0x60, 0xff, 0x0c, 0x83, 0x71, 0x5f, 0xff, 0x84, 0x72,
+    0x60, 0xff, 0x83, 0x72, 0x60, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x7a, 0x69,
+    0x57, 0xff, 0x7c, 0x6c, 0x58, 0xf9, 0x7b, 0x69, 0x56, 0xff, 0x82, 0x70, 0x5e, 0xff, 0xa6, 0x99,
+    0x8e, 0xc8, 0xf7, 0xf7, 0xf7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x89, 0x00,
+    0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x12,
+    0x9d, 0x90, 0x83, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7e, 0x6d, 0x5a, 0xff,
+    0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6b, 0x57, 0xff, 0x78, 0x67, 0x57, 0xff, 0x80, 0x74, 0x6b, 0xff,
+    0xf0, 0xf0, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x8b, 0x00, 0x00, 0x00,
+    0x00, 0x0b, 0xf4, 0xf4, 0xf4, 0x17, 0xbf, 0xa7, 0x99, 0xce, 0xab, 0x8f, 0x7d, 0xff, 0xaa, 0x8f,
+    0x7d, 0xff, 0xab, 0x91, 0x80, 0xf7, 0xab, 0x91, 0x7f, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x80, 0x6f,
+    0x5c, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61,
+    0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4d, 0xff, 0x04, 0x6e, 0x61, 0x4b, 0xff, 0x69, 0x5c, 0x47, 0xf8,
+    0x6e, 0x63, 0x5b, 0xff, 0x92, 0x8d, 0x8e, 0xaa, 0xff, 0xff, 0xff, 0x02, 0x81, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0xff, 0xff, 0xff, 0x01, 0x00, 0xff, 0xff, 0xff, 0x02, 0x8a, 0x00, 0x00, 0x00, 0x00,
+    0x0b, 0xe6, 0xe6, 0xe0, 0x29, 0xa7, 0x98, 0x8c, 0xbd, 0xad, 0xa1, 0x96, 0x9b, 0xb1, 0xa7, 0x9d,
+    0x99, 0xb1, 0xa7, 0xa1, 0xa3, 0xbd, 0xb6, 0xb4, 0x93, 0xf1, 0xf1, 0xf1, 0x25, 0xff, 0xff, 0xff,
+    0x0b, 0xc8, 0xc1, 0xbd, 0x74, 0x9b, 0x8c, 0x7e, 0xf6, 0x81, 0x70, 0x5d, 0xf9, 0x80, 0x6d, 0x5a,
+    0xff, 0x84, 0x83, 0x71, 0x5f, 0xff, 0x09, 0x81, 0x70, 0x5e, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7c,
+    0x6b, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xf9, 0x7a, 0x69, 0x55, 0xff, 0x83,
+    0x72, 0x61, 0xff, 0xa3, 0x96, 0x88, 0xd5, 0xed, 0xed, 0xed, 0x2b, 0xff, 0xff, 0xff, 0x01, 0x89,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x12, 0x9d, 0x90, 0x82, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x81, 0x7d, 0x6c,
+    0x59, 0xff, 0x05, 0x7c, 0x6a, 0x56, 0xff, 0x77, 0x67, 0x56, 0xff, 0x7f, 0x74, 0x6b, 0xff, 0xf1,
+    0xf1, 0xf1, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x8a, 0x00, 0x00, 0x00, 0x00,
+    0x12, 0xff, 0xff, 0xff, 0x0e, 0xc0, 0xa9, 0x9c, 0xb1, 0xae, 0x91, 0x7f, 0xff, 0xac, 0x8f, 0x7d,
+    0xff, 0xae, 0x92, 0x81, 0xf7, 0xae, 0x93, 0x81, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x87, 0x74, 0x60,
+    0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f,
+    0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x48,
+    0xfb, 0x67, 0x5b, 0x4e, 0xff, 0x82, 0x7b, 0x7a, 0xff, 0xd9, 0xd9, 0xd9, 0x36, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xff, 0xff, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xee, 0xee, 0xe8, 0x2c, 0x8e, 0x7e, 0x6e, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c,
+    0xfc, 0x82, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x81, 0x6f, 0x5d, 0xff, 0x08, 0x7f, 0x6d, 0x5b, 0xff,
+    0x7e, 0x6c, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6d, 0x5b, 0xfc, 0x7f, 0x6c, 0x5a, 0xff,
+    0x7e, 0x6b, 0x59, 0xff, 0x93, 0x84, 0x75, 0xff, 0xc5, 0xbf, 0xb5, 0x7f, 0xff, 0xff, 0xff, 0x02,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 0x0d,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x12, 0x9c, 0x90, 0x82, 0xff,
+    0x7e, 0x6e, 0x5b, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff,
+    0x7b, 0x6b, 0x56, 0xff, 0x76, 0x67, 0x56, 0xff, 0x7f, 0x74, 0x6b, 0xff, 0xf1, 0xf1, 0xf1, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff,
+    0xff, 0x03, 0xe3, 0xd8, 0xd1, 0x48, 0xb6, 0x9b, 0x8c, 0xff, 0xab, 0x8c, 0x7b, 0xff, 0xaf, 0x92,
+    0x81, 0xff, 0xb0, 0x94, 0x82, 0xfb, 0xb1, 0x93, 0x82, 0xff, 0xa7, 0x8b, 0x7a, 0xff, 0x8b, 0x76,
+    0x65, 0xff, 0x71, 0x63, 0x50, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x81, 0x6e,
+    0x61, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4d, 0xff, 0x05, 0x6d, 0x60, 0x4a, 0xff, 0x67, 0x5b, 0x49,
+    0xff, 0x71, 0x68, 0x65, 0xff, 0xb2, 0xb0, 0xb2, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x02, 0xb5, 0xac, 0xa1, 0x87, 0x88,
+    0x77, 0x66, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x85, 0x81, 0x6f, 0x5d, 0xff,
+    0x81, 0x7f, 0x6d, 0x5b, 0xff, 0x06, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xfc, 0x81, 0x6f,
+    0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x90, 0x7f, 0x6e, 0xff, 0xba, 0xb0, 0xa7, 0x7a, 0xff, 0xff,
+    0xff, 0x09, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0xff, 0xff, 0xff, 0x01,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0xf1, 0x12, 0x9b, 0x90, 0x81, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x79, 0x68, 0x54, 0xff, 0x81, 0x7b,
+    0x6a, 0x57, 0xff, 0x05, 0x7a, 0x6a, 0x56, 0xff, 0x75, 0x66, 0x57, 0xff, 0x7f, 0x73, 0x6b, 0xff,
+    0xf1, 0xf1, 0xf1, 0x12, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x83, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x12,
+    0xc9, 0xb7, 0xab, 0x92, 0xb2, 0x97, 0x86, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xb0, 0x92, 0x81, 0xff,
+    0xb3, 0x96, 0x84, 0xfb, 0xb2, 0x95, 0x83, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0x8b, 0x77, 0x64, 0xff,
+    0x73, 0x64, 0x51, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x81, 0x6e, 0x62, 0x4f, 0xff, 0x82, 0x6e, 0x61,
+    0x4d, 0xff, 0x04, 0x6e, 0x62, 0x4c, 0xff, 0x68, 0x5c, 0x48, 0xfb, 0x68, 0x5d, 0x54, 0xff, 0x83,
+    0x7b, 0x7d, 0xff, 0xff, 0xff, 0xff, 0x08, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x09, 0xaa, 0x9e, 0x91, 0xc8, 0x80, 0x6e, 0x5c,
+    0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x84, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x80, 0x6e, 0x5c, 0xff, 0x09,
+    0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff,
+    0x83, 0x72, 0x60, 0xf9, 0x7f, 0x6c, 0x59, 0xff, 0x8d, 0x7c, 0x6a, 0xff, 0xae, 0xa2, 0x95, 0xcd,
+    0xe4, 0xdf, 0xdb, 0x38, 0xff, 0xff, 0xff, 0x0a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe,
+    0xff, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xf2, 0xf2, 0x13, 0x9b, 0x8e, 0x81, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x78, 0x68, 0x54, 0xff,
+    0x7a, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x75, 0x66, 0x57, 0xff,
+    0x7f, 0x73, 0x6b, 0xff, 0xf2, 0xf2, 0xf2, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01,
+    0x85, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x05, 0xe2, 0xda, 0xd6, 0x3e, 0xba, 0xa6,
+    0x97, 0xf6, 0xad, 0x91, 0x80, 0xff, 0xaa, 0x8c, 0x7a, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xb4, 0x96,
+    0x86, 0xff, 0xb5, 0x97, 0x85, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0x89, 0x75, 0x63, 0xff, 0x73, 0x64,
+    0x51, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61,
+    0x4f, 0xff, 0x82, 0x6e, 0x61, 0x4d, 0xff, 0x03, 0x6e, 0x61, 0x4c, 0xff, 0x65, 0x58, 0x45, 0xff,
+    0x71, 0x66, 0x5c, 0xff, 0xbc, 0xb7, 0xb7, 0x72, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x04, 0xbb, 0xb3, 0xa8, 0xa8, 0x7f, 0x6d, 0x5b, 0xff, 0x7d, 0x6b, 0x58, 0xff,
+    0x85, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x7f, 0x6d, 0x5b, 0xff, 0x0b, 0x80, 0x6f, 0x5c, 0xff, 0x83,
+    0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x87, 0x74, 0x63, 0xff, 0x88, 0x75, 0x63, 0xfc, 0x88,
+    0x75, 0x62, 0xff, 0x87, 0x72, 0x5f, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0xb5, 0xa8, 0x9c, 0xac, 0xea,
+    0xe5, 0xe0, 0x31, 0xf0, 0xf0, 0xe8, 0x22, 0xff, 0xff, 0xff, 0x02, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf2, 0xf2, 0x13, 0x9c, 0x8f, 0x81,
+    0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x78, 0x67, 0x54, 0xff, 0x81, 0x7a, 0x6a, 0x57, 0xff, 0x05, 0x79,
+    0x68, 0x55, 0xff, 0x74, 0x65, 0x56, 0xff, 0x7d, 0x72, 0x6a, 0xff, 0xff, 0xff, 0xee, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x82, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0xff,
+    0x05, 0xef, 0xef, 0xe6, 0x1f, 0xf0, 0xe9, 0xe9, 0x23, 0xc8, 0xb9, 0xab, 0x86, 0xa7, 0x8d, 0x7a,
+    0xff, 0xa6, 0x8b, 0x78, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xb0, 0x93, 0x82, 0xfb, 0xb3, 0x95, 0x84,
+    0xff, 0xaf, 0x92, 0x82, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x87, 0x75, 0x62, 0xff, 0x70, 0x62, 0x4f,
+    0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d,
+    0xff, 0x6e, 0x61, 0x4e, 0xff, 0x82, 0x6e, 0x61, 0x4d, 0xff, 0x03, 0x6d, 0x60, 0x4b, 0xff, 0x67,
+    0x59, 0x44, 0xff, 0x75, 0x69, 0x58, 0xff, 0xcb, 0xc7, 0xc1, 0x4e, 0x9e, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xf6, 0xf7, 0xf7, 0x21, 0x99, 0x8c, 0x7d, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7e, 0x6b, 0x59,
+    0xff, 0x81, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x80, 0x6e, 0x5c, 0xff, 0x83, 0x7f, 0x6d, 0x5b, 0xff,
+    0x0d, 0x7e, 0x6d, 0x5a, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x84, 0x72, 0x60, 0xff, 0x88, 0x75, 0x63,
+    0xff, 0x8b, 0x77, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8c, 0x76, 0x65,
+    0xff, 0x8f, 0x7a, 0x69, 0xff, 0x94, 0x7f, 0x6e, 0xff, 0xa1, 0x8e, 0x7f, 0xff, 0xd3, 0xcd, 0xc4,
+    0x57, 0xf5, 0xf5, 0xf5, 0x1a, 0xff, 0xff, 0xff, 0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff,
+    0xff, 0xff, 0x0f, 0x9b, 0x8e, 0x80, 0xff, 0x7d, 0x6d, 0x5b, 0xff, 0x77, 0x67, 0x54, 0xff, 0x78,
+    0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x54, 0xff, 0x72, 0x63, 0x53, 0xff, 0x7d,
+    0x71, 0x69, 0xff, 0xef, 0xef, 0xef, 0x1f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff,
+    0x0f, 0xf2, 0xec, 0xec, 0x28, 0xd3, 0xc7, 0xbd, 0x68, 0xad, 0x96, 0x86, 0xff, 0xa7, 0x8e, 0x7c,
+    0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xaa, 0x8f, 0x7c, 0xff, 0xae, 0x92, 0x81,
+    0xff, 0xb0, 0x93, 0x82, 0xff, 0xac, 0x90, 0x7f, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x7e, 0x6e, 0x5b,
+    0xff, 0x81, 0x6d, 0x5f, 0x4c, 0xff, 0x0c, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e,
+    0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d,
+    0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6e,
+    0x61, 0x4c, 0xff, 0x85, 0x7b, 0x69, 0xff, 0xe4, 0xe4, 0xe4, 0x1c, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
+    0xff, 0xff, 0x02, 0xb2, 0xa7, 0x9f, 0x9f, 0x84, 0x72, 0x61, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x81,
+    0x7f, 0x6d, 0x5b, 0xff, 0x01, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x83, 0x7f, 0x6d,
+    0x5b, 0xff, 0x82, 0x7e, 0x6d, 0x5a, 0xff, 0x2b, 0x80, 0x6f, 0x5c, 0xff, 0x84, 0x71, 0x5f, 0xff,
+    0x89, 0x76, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x90, 0x7a, 0x69, 0xff,
+    0x8e, 0x78, 0x66, 0xff, 0x8c, 0x76, 0x63, 0xff, 0x90, 0x7a, 0x67, 0xff, 0x9e, 0x8b, 0x7a, 0xff,
+    0xad, 0x9b, 0x8d, 0xff, 0xc6, 0xb9, 0xb1, 0x75, 0xd8, 0xcf, 0xcb, 0x3b, 0xe6, 0xe1, 0xdc, 0x33,
+    0xff, 0xff, 0xff, 0x12, 0xf2, 0xf2, 0xf2, 0x26, 0x91, 0x84, 0x75, 0xff, 0x7a, 0x69, 0x58, 0xff,
+    0x77, 0x67, 0x55, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x54, 0xff,
+    0x72, 0x62, 0x51, 0xff, 0x7d, 0x70, 0x65, 0xff, 0xbf, 0xb6, 0xb1, 0x97, 0xe9, 0xe5, 0xe5, 0x3b,
+    0xe8, 0xe3, 0xdd, 0x2d, 0xdb, 0xd2, 0xce, 0x39, 0xbd, 0xae, 0xa3, 0xa3, 0xad, 0x99, 0x89, 0xff,
+    0xa5, 0x8d, 0x7c, 0xff, 0x9f, 0x85, 0x74, 0xff, 0xa1, 0x86, 0x74, 0xff, 0xa5, 0x8b, 0x79, 0xff,
+    0xaa, 0x8f, 0x7e, 0xff, 0xad, 0x92, 0x80, 0xff, 0xac, 0x90, 0x7f, 0xff, 0xa1, 0x87, 0x76, 0xff,
+    0x8c, 0x78, 0x65, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6c, 0x5f, 0x4c, 0xff,
+    0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x81, 0x6d, 0x60,
+    0x4d, 0xff, 0x01, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x82, 0x6d, 0x60, 0x4b, 0xff,
+    0x03, 0x6a, 0x5d, 0x47, 0xf8, 0x6f, 0x62, 0x4c, 0xff, 0x91, 0x88, 0x7a, 0xff, 0xe6, 0xe6, 0xe6,
+    0x1e, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcd, 0xc7, 0xc0, 0x4d, 0x81, 0x6f, 0x5e, 0xff, 0x78,
+    0x66, 0x53, 0xff, 0x7e, 0x6d, 0x5a, 0xfc, 0x7f, 0x6d, 0x5b, 0xff, 0x82, 0x7e, 0x6d, 0x5a, 0xff,
+    0x81, 0x7f, 0x6d, 0x5b, 0xff, 0x01, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x82, 0x7e,
+    0x6d, 0x5a, 0xff, 0x06, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x82, 0x70, 0x5f, 0xff,
+    0x86, 0x74, 0x62, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x94, 0x7e, 0x6d, 0xff,
+    0x81, 0x95, 0x80, 0x6e, 0xff, 0x08, 0x93, 0x7d, 0x6a, 0xff, 0x91, 0x79, 0x67, 0xff, 0x91, 0x78,
+    0x66, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0xa6, 0x92, 0x82, 0xff, 0xc2, 0xb2, 0xa7, 0xc6, 0xbb, 0xad,
+    0xa2, 0xac, 0x85, 0x75, 0x64, 0xfc, 0x76, 0x67, 0x55, 0xff, 0x82, 0x77, 0x67, 0x55, 0xff, 0x15,
+    0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xfc, 0x80, 0x6f, 0x5f, 0xfc, 0x9a, 0x89, 0x7b, 0xff,
+    0xaa, 0x98, 0x8b, 0xff, 0xa5, 0x90, 0x80, 0xff, 0x99, 0x81, 0x6e, 0xff, 0x95, 0x7c, 0x69, 0xff,
+    0x9a, 0x81, 0x6e, 0xff, 0x9e, 0x86, 0x73, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa7, 0x8e, 0x7d, 0xff,
+    0xaa, 0x90, 0x7f, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x91, 0x7c, 0x69, 0xff,
+    0x82, 0x70, 0x5d, 0xff, 0x73, 0x66, 0x52, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff,
+    0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x00, 0x6e, 0x61,
+    0x4d, 0xff, 0x81, 0x6d, 0x61, 0x4d, 0xff, 0x00, 0x6d, 0x60, 0x4c, 0xff, 0x82, 0x6d, 0x60, 0x4b,
+    0xff, 0x04, 0x6d, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x66, 0x58, 0x42, 0xf8, 0x74, 0x68,
+    0x54, 0xff, 0x9b, 0x93, 0x86, 0xb3, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x03, 0xda, 0xd7, 0xd0, 0x4c,
+    0x91, 0x83, 0x73, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xf9, 0x86, 0x7e, 0x6d, 0x5a,
+    0xff, 0x81, 0x7d, 0x6c, 0x59, 0xff, 0x81, 0x7e, 0x6d, 0x5a, 0xff, 0x00, 0x7d, 0x6c, 0x59, 0xff,
+    0x82, 0x7c, 0x6b, 0x58, 0xff, 0x0e, 0x7e, 0x6d, 0x5a, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x8b, 0x76,
+    0x64, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x94, 0x7f, 0x6c, 0xff, 0x97, 0x80, 0x70, 0xff, 0x9a, 0x83,
+    0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9b, 0x83, 0x72, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x9b, 0x83,
+    0x70, 0xff, 0x9e, 0x84, 0x71, 0xff, 0x96, 0x7f, 0x6c, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x76, 0x67,
+    0x54, 0xfc, 0x82, 0x77, 0x67, 0x55, 0xff, 0x12, 0x75, 0x65, 0x53, 0xff, 0x78, 0x68, 0x56, 0xff,
+    0x85, 0x71, 0x5f, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x98, 0x81, 0x6f, 0xff,
+    0x9b, 0x84, 0x72, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa1, 0x88, 0x76, 0xff, 0xa3, 0x8a, 0x78, 0xff,
+    0xa2, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x93, 0x7e, 0x6c, 0xff,
+    0x86, 0x73, 0x60, 0xff, 0x75, 0x67, 0x53, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x62, 0x4e, 0xff,
+    0x6f, 0x62, 0x4e, 0xff, 0x81, 0x6e, 0x62, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x03, 0x6e,
+    0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x84,
+    0x6d, 0x60, 0x4b, 0xff, 0x04, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x63, 0x56, 0x3f,
+    0xff, 0x82, 0x79, 0x65, 0xba, 0xff, 0xff, 0xff, 0x0a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x87, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x04, 0xa2, 0x95, 0x88, 0xe8, 0x7f, 0x6e, 0x5b, 0xff, 0x7a,
+    0x69, 0x55, 0xf9, 0x7f, 0x6e, 0x5b, 0xff, 0x83, 0x7e, 0x6d, 0x5a, 0xff, 0x06, 0x7d, 0x6c, 0x59,
+    0xff, 0x7d, 0x6d, 0x59, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x7d, 0x6c, 0x59,
+    0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x83, 0x7c, 0x6b, 0x58, 0xff, 0x21, 0x7b,
+    0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x83, 0x70, 0x5f, 0xff, 0x8c,
+    0x78, 0x66, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x98, 0x81, 0x70, 0xff, 0x99, 0x84, 0x71, 0xff, 0x9b,
+    0x85, 0x72, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa3, 0x89, 0x77, 0xff, 0x9a,
+    0x82, 0x70, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x67, 0x55, 0xff, 0x77,
+    0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x64, 0x52, 0xff, 0x78, 0x67, 0x56, 0xff, 0x85,
+    0x71, 0x60, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x9a, 0x82, 0x70, 0xff, 0x99, 0x82, 0x71, 0xff, 0x9b,
+    0x84, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9f, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x96,
+    0x80, 0x6e, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x74, 0x66, 0x52, 0xff, 0x71,
+    0x63, 0x4f, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x81, 0x6e, 0x62, 0x4e, 0xff, 0x83, 0x6e, 0x61, 0x4e,
+    0xff, 0x07, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5e, 0x49, 0xfb, 0x69, 0x5c,
+    0x48, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61,
+    0x4c, 0xff, 0x81, 0x6d, 0x60, 0x4b, 0xff, 0x04, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff,
+    0x60, 0x52, 0x3b, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xdf, 0xdf, 0xdb, 0x40, 0x98, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xff, 0xff, 0xff, 0x0c, 0x94, 0x86, 0x77, 0xee, 0x78, 0x66, 0x53, 0xff, 0x79, 0x68,
+    0x54, 0xfc, 0x83, 0x7d, 0x6c, 0x59, 0xff, 0x00, 0x7c, 0x6b, 0x59, 0xff, 0x81, 0x7c, 0x6b, 0x58,
+    0xff, 0x05, 0x7c, 0x6a, 0x56, 0xff, 0x7a, 0x67, 0x54, 0xff, 0x79, 0x67, 0x54, 0xff, 0x7a, 0x69,
+    0x56, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x82, 0x7b, 0x6a, 0x57, 0xff, 0x0e,
+    0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x7b, 0x6a, 0x58, 0xff,
+    0x7e, 0x6d, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x84, 0x72, 0x60, 0xff, 0x8b, 0x78, 0x65, 0xff,
+    0x92, 0x7e, 0x6b, 0xff, 0x98, 0x82, 0x70, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa8, 0x8e, 0x7c, 0xff,
+    0x9f, 0x88, 0x76, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x74, 0x66, 0x54, 0xff, 0x81, 0x76, 0x66, 0x54,
+    0xff, 0x0f, 0x75, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x78, 0x67, 0x55, 0xff, 0x85, 0x71,
+    0x60, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x97, 0x80, 0x70, 0xff, 0x92, 0x7d,
+    0x6c, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x89, 0x76, 0x63, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7b, 0x6b,
+    0x58, 0xff, 0x77, 0x68, 0x55, 0xff, 0x72, 0x64, 0x50, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x62,
+    0x4d, 0xff, 0x82, 0x6f, 0x62, 0x4f, 0xff, 0x0a, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff,
+    0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x68, 0x5b, 0x48, 0xfb,
+    0x67, 0x5c, 0x50, 0xff, 0x6f, 0x65, 0x5a, 0xff, 0x6d, 0x62, 0x51, 0xff, 0x68, 0x5b, 0x44, 0xff,
+    0x6b, 0x5d, 0x47, 0xf9, 0x81, 0x6d, 0x60, 0x4b, 0xff, 0x05, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60,
+    0x4b, 0xff, 0x69, 0x5c, 0x45, 0xf9, 0x69, 0x5c, 0x49, 0xff, 0x85, 0x7b, 0x6d, 0xe2, 0xff, 0xff,
+    0xff, 0x0d, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 0xa4, 0x99, 0x8c, 0xd2, 0x7e, 0x6e, 0x5c, 0xff, 0x76, 0x63,
+    0x50, 0xff, 0x7c, 0x6b, 0x57, 0xf9, 0x82, 0x7b, 0x6b, 0x58, 0xff, 0x1a, 0x7b, 0x6a, 0x57, 0xff,
+    0x7c, 0x6a, 0x55, 0xfc, 0x77, 0x66, 0x53, 0xfc, 0x72, 0x63, 0x58, 0xff, 0x7a, 0x6c, 0x62, 0xff,
+    0x7e, 0x6f, 0x5f, 0xff, 0x78, 0x67, 0x53, 0xff, 0x75, 0x64, 0x4f, 0xff, 0x7a, 0x69, 0x56, 0xf9,
+    0x7b, 0x6b, 0x59, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x58, 0xff,
+    0x79, 0x6a, 0x58, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x68, 0x56, 0xff,
+    0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x7c, 0x6c, 0x59, 0xff, 0x82, 0x70, 0x5e, 0xff,
+    0x86, 0x73, 0x61, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x90, 0x7c, 0x6a, 0xff, 0x8d, 0x78, 0x66, 0xff,
+    0x7d, 0x6b, 0x59, 0xff, 0x76, 0x66, 0x54, 0xff, 0x82, 0x75, 0x65, 0x53, 0xff, 0x0f, 0x74, 0x65,
+    0x52, 0xff, 0x77, 0x66, 0x54, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x86, 0x73, 0x60, 0xff, 0x87, 0x75,
+    0x62, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x77, 0x67,
+    0x54, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x63,
+    0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x83, 0x6e,
+    0x61, 0x4e, 0xff, 0x0f, 0x6e, 0x61, 0x4d, 0xff, 0x6c, 0x5e, 0x4a, 0xf9, 0x69, 0x5c, 0x4b, 0xff,
+    0x6f, 0x65, 0x5d, 0xff, 0x81, 0x79, 0x78, 0xff, 0xb6, 0xb0, 0xb0, 0x8b, 0xc3, 0xbf, 0xb8, 0x73,
+    0x8b, 0x81, 0x71, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x66, 0x58, 0x42, 0xff, 0x6d, 0x5f, 0x4b, 0xfb,
+    0x6d, 0x60, 0x4b, 0xff, 0x69, 0x5c, 0x45, 0xf9, 0x65, 0x58, 0x42, 0xff, 0x7e, 0x74, 0x69, 0xff,
+    0xb0, 0xa8, 0xa6, 0x8a, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x12, 0xf6, 0xf6, 0xf6, 0x1b, 0x92, 0x84,
+    0x75, 0xeb, 0x7e, 0x6d, 0x5a, 0xff, 0x75, 0x63, 0x50, 0xff, 0x7a, 0x69, 0x56, 0xfc, 0x7c, 0x6c,
+    0x59, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x78, 0x66, 0x51, 0xfc, 0x75, 0x65, 0x52, 0xff, 0x78, 0x6b,
+    0x61, 0xff, 0x7d, 0x74, 0x75, 0xff, 0x94, 0x8d, 0x8d, 0xdd, 0x9f, 0x95, 0x8a, 0xd2, 0x8e, 0x80,
+    0x71, 0xe3, 0x82, 0x73, 0x61, 0xff, 0x78, 0x68, 0x55, 0xff, 0x75, 0x64, 0x51, 0xfc, 0x79, 0x69,
+    0x57, 0xfc, 0x7a, 0x6a, 0x58, 0xff, 0x82, 0x79, 0x69, 0x57, 0xff, 0x03, 0x78, 0x68, 0x56, 0xff,
+    0x78, 0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x81, 0x76, 0x67, 0x54,
+    0xff, 0x00, 0x76, 0x66, 0x53, 0xff, 0x84, 0x76, 0x66, 0x54, 0xff, 0x01, 0x75, 0x66, 0x54, 0xff,
+    0x75, 0x65, 0x53, 0xff, 0x83, 0x75, 0x66, 0x53, 0xff, 0x04, 0x74, 0x65, 0x52, 0xff, 0x72, 0x64,
+    0x50, 0xff, 0x72, 0x65, 0x50, 0xff, 0x72, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x81, 0x72,
+    0x63, 0x50, 0xff, 0x82, 0x70, 0x63, 0x4f, 0xff, 0x02, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f,
+    0xff, 0x6e, 0x61, 0x4f, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x11, 0x6e, 0x61, 0x4d, 0xff, 0x6e,
+    0x61, 0x4c, 0xff, 0x6a, 0x5e, 0x4c, 0xf6, 0x69, 0x5c, 0x4f, 0xff, 0x73, 0x68, 0x63, 0xff, 0x8e,
+    0x87, 0x89, 0xfc, 0xd1, 0xd1, 0xd4, 0x4e, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdb,
+    0xdb, 0xd7, 0x39, 0x8e, 0x85, 0x75, 0xff, 0x72, 0x65, 0x52, 0xff, 0x69, 0x5c, 0x46, 0xff, 0x65,
+    0x58, 0x42, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x80, 0x75, 0x68, 0xff, 0xa3, 0x9b, 0x98, 0xbd, 0xff,
+    0xff, 0xff, 0x0a, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x96, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xff, 0xf0, 0xf0, 0x11, 0x92, 0x84, 0x76, 0xe6, 0x7f, 0x6f, 0x5e, 0xff, 0x74,
+    0x62, 0x4f, 0xff, 0x76, 0x64, 0x51, 0xf9, 0x75, 0x63, 0x4f, 0xff, 0x7a, 0x6b, 0x5a, 0xff, 0x82,
+    0x77, 0x6d, 0xff, 0x8d, 0x87, 0x87, 0xe8, 0xdc, 0xd8, 0xdc, 0x42, 0xff, 0xff, 0xff, 0x09, 0xff,
+    0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x0c, 0xb8, 0xaf, 0xa4, 0x93, 0x8b, 0x7e, 0x6e, 0xff, 0x74,
+    0x64, 0x51, 0xff, 0x76, 0x66, 0x53, 0xff, 0x84, 0x78, 0x68, 0x56, 0xff, 0x82, 0x77, 0x67, 0x55,
+    0xff, 0x00, 0x76, 0x66, 0x54, 0xff, 0x82, 0x75, 0x65, 0x53, 0xff, 0x01, 0x74, 0x65, 0x53, 0xff,
+    0x74, 0x65, 0x52, 0xff, 0x81, 0x75, 0x65, 0x53, 0xff, 0x81, 0x75, 0x66, 0x53, 0xff, 0x83, 0x74,
+    0x65, 0x52, 0xff, 0x00, 0x73, 0x64, 0x51, 0xff, 0x81, 0x72, 0x63, 0x50, 0xff, 0x00, 0x72, 0x64,
+    0x50, 0xff, 0x81, 0x71, 0x63, 0x4f, 0xff, 0x00, 0x71, 0x64, 0x50, 0xff, 0x81, 0x70, 0x63, 0x4f,
+    0xff, 0x01, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x07,
+    0x6d, 0x60, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4c, 0xff, 0x69, 0x5d, 0x49, 0xf9,
+    0x63, 0x58, 0x4e, 0xff, 0x75, 0x6d, 0x6d, 0xff, 0xb1, 0xac, 0xae, 0x72, 0xff, 0xff, 0xff, 0x07,
+    0x83, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x10, 0xb6, 0xb2, 0xa8, 0x66, 0x70, 0x64,
+    0x51, 0xf6, 0x71, 0x64, 0x50, 0xd8, 0x80, 0x76, 0x69, 0xe6, 0xb7, 0xb4, 0xae, 0x8b, 0xff, 0xff,
+    0xff, 0x0b, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x97, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xff, 0xff, 0xff, 0x0f, 0xa4, 0x9a, 0x8d, 0xd0, 0x84, 0x75, 0x64, 0xff, 0x79, 0x68,
+    0x56, 0xff, 0x85, 0x77, 0x69, 0xff, 0x96, 0x8c, 0x84, 0xf6, 0xd8, 0xd8, 0xd4, 0x4e, 0xff, 0xff,
+    0xff, 0x0b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xec, 0xe8, 0xe8, 0x37,
+    0x97, 0x8a, 0x7c, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x73, 0x63, 0x50, 0xff, 0x82, 0x77, 0x67, 0x55,
+    0xff, 0x87, 0x76, 0x66, 0x54, 0xff, 0x84, 0x75, 0x66, 0x53, 0xff, 0x00, 0x74, 0x66, 0x52, 0xff,
+    0x82, 0x74, 0x65, 0x52, 0xff, 0x81, 0x73, 0x65, 0x51, 0xff, 0x03, 0x73, 0x64, 0x51, 0xff, 0x73,
+    0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x81, 0x70, 0x63, 0x4f, 0xff,
+    0x05, 0x6f, 0x63, 0x4f, 0xff, 0x6f, 0x61, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e,
+    0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x81, 0x6e, 0x61, 0x4d, 0xff, 0x08, 0x6d,
+    0x61, 0x4b, 0xff, 0x63, 0x57, 0x48, 0xff, 0x70, 0x67, 0x65, 0xff, 0xb2, 0xae, 0xb2, 0x7b, 0xff,
+    0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xfe, 0xff, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff,
+    0x0c, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x06, 0xff, 0xff, 0xff, 0x01, 0x9f, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x12, 0xb5, 0xad, 0xa1, 0x9b, 0xa7, 0x9e, 0x93, 0xa0, 0xbc,
+    0xb5, 0xb0, 0x91, 0xf7, 0xf7, 0xf7, 0x1f, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,
+    0x07, 0xb4, 0xaa, 0xa2, 0xdd, 0x80, 0x71, 0x60, 0xff, 0x6f, 0x5f, 0x4c, 0xff, 0x76, 0x66, 0x54,
+    0xff, 0x81, 0x77, 0x67, 0x55, 0xff, 0x86, 0x76, 0x66, 0x54, 0xff, 0x00, 0x75, 0x66, 0x54, 0xff,
+    0x84, 0x75, 0x66, 0x53, 0xff, 0x82, 0x74, 0x65, 0x52, 0xff, 0x02, 0x73, 0x65, 0x51, 0xff, 0x72,
+    0x65, 0x50, 0xff, 0x72, 0x64, 0x51, 0xff, 0x81, 0x72, 0x64, 0x50, 0xff, 0x00, 0x71, 0x63, 0x50,
+    0xff, 0x82, 0x70, 0x63, 0x50, 0xff, 0x02, 0x6f, 0x62, 0x50, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e,
+    0x60, 0x4e, 0xff, 0x81, 0x6d, 0x60, 0x4d, 0xff, 0x00, 0x6e, 0x61, 0x4d, 0xff, 0x81, 0x6d, 0x61,
+    0x4d, 0xff, 0x03, 0x6b, 0x5f, 0x48, 0xff, 0x68, 0x5c, 0x4e, 0xff, 0x87, 0x7f, 0x7c, 0xc7, 0xff,
+    0xff, 0xff, 0x0b, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xff, 0xff, 0xff, 0x09, 0xa9, 0x9d, 0x91, 0xe6, 0x7f, 0x70, 0x5f, 0xff, 0x70, 0x5f, 0x4c,
+    0xff, 0x75, 0x65, 0x53, 0xff, 0x84, 0x76, 0x66, 0x54, 0xff, 0x03, 0x76, 0x66, 0x53, 0xff, 0x76,
+    0x65, 0x53, 0xff, 0x75, 0x65, 0x52, 0xff, 0x74, 0x65, 0x51, 0xff, 0x86, 0x74, 0x65, 0x52, 0xff,
+    0x82, 0x73, 0x64, 0x51, 0xff, 0x01, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x81, 0x71,
+    0x63, 0x50, 0xff, 0x08, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x60, 0x4c, 0xff,
+    0x6d, 0x5f, 0x4b, 0xff, 0x6b, 0x5e, 0x4b, 0xfc, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff,
+    0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x81, 0x6d, 0x61, 0x4d, 0xff, 0x04, 0x6d, 0x60,
+    0x4c, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x6d, 0x61, 0x50, 0xff, 0x93, 0x8b, 0x82, 0xa7, 0xff, 0xff,
+    0xff, 0x01, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x96, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x0c,
+    0x8a, 0x7d, 0x6d, 0xee, 0x79, 0x69, 0x57, 0xff, 0x73, 0x62, 0x50, 0xff, 0x75, 0x65, 0x53, 0xff,
+    0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff,
+    0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x74, 0x65, 0x51, 0xff, 0x73, 0x64, 0x50, 0xf9,
+    0x72, 0x63, 0x4f, 0xf9, 0x72, 0x63, 0x50, 0xf9, 0x73, 0x64, 0x51, 0xfc, 0x81, 0x74, 0x65, 0x52,
+    0xff, 0x81, 0x73, 0x65, 0x51, 0xff, 0x01, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x81,
+    0x72, 0x63, 0x50, 0xff, 0x00, 0x71, 0x63, 0x50, 0xff, 0x81, 0x71, 0x63, 0x4f, 0xff, 0x06, 0x6f,
+    0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4c, 0xf9, 0x6c, 0x5f, 0x4a, 0xf9, 0x6c, 0x5e, 0x4b, 0xf7, 0x6a,
+    0x5d, 0x49, 0xff, 0x69, 0x5d, 0x4a, 0xff, 0x6b, 0x5e, 0x4c, 0xfc, 0x82, 0x6e, 0x61, 0x4d, 0xff,
+    0x00, 0x6d, 0x61, 0x4c, 0xff, 0x81, 0x6d, 0x60, 0x4b, 0xff, 0x04, 0x6b, 0x5e, 0x48, 0xff, 0x6c,
+    0x5f, 0x4b, 0xff, 0x8e, 0x85, 0x77, 0xa7, 0xff, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x00, 0xb6,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x10, 0x79, 0x6a, 0x58, 0xf1, 0x74, 0x63, 0x51,
+    0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x81, 0x75, 0x66,
+    0x53, 0xff, 0x0d, 0x76, 0x67, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x6d, 0x5e, 0x4f, 0xf9, 0x68,
+    0x5b, 0x50, 0xff, 0x76, 0x6a, 0x61, 0xff, 0x82, 0x76, 0x6a, 0xff, 0x7f, 0x72, 0x63, 0xff, 0x74,
+    0x66, 0x54, 0xff, 0x72, 0x63, 0x50, 0xfc, 0x74, 0x65, 0x51, 0xfc, 0x73, 0x65, 0x51, 0xff, 0x72,
+    0x64, 0x50, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x50, 0xff, 0x81, 0x71, 0x63, 0x50, 0xff,
+    0x0c, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6b, 0x5d, 0x4b, 0xf9, 0x69, 0x5b, 0x4c,
+    0xff, 0x72, 0x66, 0x5b, 0xff, 0x7a, 0x6f, 0x67, 0xff, 0x82, 0x79, 0x73, 0xff, 0x90, 0x88, 0x81,
+    0xff, 0x94, 0x8b, 0x81, 0xff, 0x79, 0x6d, 0x5d, 0xff, 0x66, 0x58, 0x43, 0xfc, 0x6d, 0x60, 0x4b,
+    0xfc, 0x6e, 0x61, 0x4d, 0xff, 0x81, 0x6d, 0x60, 0x4b, 0xff, 0x04, 0x6e, 0x61, 0x4c, 0xff, 0x6b,
+    0x5e, 0x49, 0xff, 0x67, 0x5a, 0x44, 0xff, 0x86, 0x7b, 0x6c, 0xcf, 0xff, 0xff, 0xff, 0x17, 0x9d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x01, 0xd4, 0xd1, 0xcb,
+    0x53, 0x76, 0x67, 0x54, 0xff, 0x70, 0x60, 0x4d, 0xff, 0x81, 0x76, 0x67, 0x54, 0xff, 0x10, 0x75,
+    0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x52, 0xff, 0x6f,
+    0x5f, 0x4d, 0xfc, 0x68, 0x5b, 0x55, 0xff, 0x7f, 0x76, 0x77, 0xff, 0xb9, 0xb4, 0xb4, 0x66, 0xd7,
+    0xd3, 0xd3, 0x3a, 0xcc, 0xc9, 0xc2, 0x50, 0xa5, 0x9c, 0x92, 0xaf, 0x78, 0x6b, 0x58, 0xff, 0x70,
+    0x63, 0x4e, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x71,
+    0x63, 0x4f, 0xff, 0x81, 0x70, 0x63, 0x4f, 0xff, 0x0b, 0x6e, 0x60, 0x4d, 0xff, 0x67, 0x5a, 0x4b,
+    0xf9, 0x6e, 0x64, 0x5a, 0xff, 0x81, 0x78, 0x74, 0xff, 0xbc, 0xb7, 0xb7, 0x58, 0xd3, 0xcf, 0xcf,
+    0x40, 0xce, 0xcb, 0xce, 0x4e, 0xe3, 0xe3, 0xe3, 0x3f, 0xf4, 0xee, 0xee, 0x2e, 0xa9, 0xa3, 0x97,
+    0x7f, 0x6c, 0x5f, 0x4b, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x82, 0x6d, 0x60, 0x4b, 0xff, 0x05, 0x6d,
+    0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x65, 0x57, 0x40, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xc7,
+    0xc3, 0xbd, 0x7b, 0xff, 0xff, 0xff, 0x01, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff,
+    0x08, 0xa1, 0x97, 0x8a, 0xff, 0x74, 0x65, 0x52, 0xff, 0x6e, 0x5e, 0x4a, 0xf9, 0x75, 0x66, 0x54,
+    0xff, 0x75, 0x66, 0x53, 0xff, 0x82, 0x74, 0x65, 0x52, 0xff, 0x03, 0x72, 0x63, 0x4e, 0xfc, 0x6e,
+    0x60, 0x51, 0xff, 0x78, 0x6f, 0x6e, 0xff, 0xcb, 0xc6, 0xcb, 0x59, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xf1, 0xf1, 0xf1, 0x24, 0x83, 0x78, 0x66, 0xff, 0x70, 0x64, 0x50, 0xff, 0x6f, 0x61, 0x4d,
+    0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x81, 0x6f, 0x62, 0x4f, 0xff, 0x04, 0x70,
+    0x62, 0x4e, 0xff, 0x6b, 0x5d, 0x4b, 0xff, 0x65, 0x5a, 0x51, 0xff, 0x7f, 0x78, 0x77, 0xff, 0xdb,
+    0xd7, 0xd7, 0x46, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0xec, 0xec, 0xe6, 0x29, 0x8c, 0x82, 0x72,
+    0xff, 0x69, 0x5c, 0x47, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x81, 0x6d, 0x60,
+    0x4b, 0xff, 0x04, 0x6b, 0x5e, 0x48, 0xff, 0x66, 0x59, 0x41, 0xfa, 0x76, 0x6a, 0x59, 0xff, 0x9b,
+    0x93, 0x8d, 0xc2, 0xff, 0xff, 0xff, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xff, 0xff, 0xff, 0x05, 0xb2, 0xaa, 0xa0, 0xc1, 0x73, 0x63, 0x51, 0xff, 0x6b, 0x5a, 0x47,
+    0xff, 0x73, 0x64, 0x51, 0xff, 0x82, 0x74, 0x65, 0x52, 0xff, 0x14, 0x73, 0x64, 0x50, 0xff, 0x6d,
+    0x5f, 0x4c, 0xff, 0x77, 0x6c, 0x63, 0xff, 0xae, 0xab, 0xab, 0xa0, 0xff, 0xff, 0xff, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0c, 0x8b,
+    0x81, 0x71, 0xf9, 0x74, 0x67, 0x54, 0xff, 0x6d, 0x5f, 0x4a, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f,
+    0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x69,
+    0x5c, 0x4a, 0xff, 0x6f, 0x65, 0x5d, 0xff, 0xa2, 0x9d, 0x9d, 0xce, 0xff, 0xff, 0xff, 0x05, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0x09, 0xb6, 0xb1, 0xa5, 0x82, 0x6f, 0x62, 0x4d,
+    0xff, 0x65, 0x57, 0x40, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6c, 0x5f, 0x49, 0xff, 0x6b, 0x5d, 0x48,
+    0xff, 0x68, 0x5a, 0x44, 0xff, 0x66, 0x59, 0x43, 0xff, 0x7e, 0x73, 0x65, 0xff, 0xd4, 0xd1, 0xd1,
+    0x54, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf2, 0xec, 0xec, 0x28, 0x92,
+    0x86, 0x78, 0xff, 0x7a, 0x6c, 0x5b, 0xff, 0x6d, 0x5d, 0x4a, 0xff, 0x6b, 0x5c, 0x47, 0xff, 0x6e,
+    0x5f, 0x4a, 0xff, 0x70, 0x61, 0x4c, 0xfc, 0x6d, 0x5d, 0x47, 0xff, 0x70, 0x63, 0x55, 0xff, 0x8c,
+    0x85, 0x83, 0xff, 0xf3, 0xf3, 0xf3, 0x29, 0x83, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff,
+    0x10, 0x9b, 0x91, 0x84, 0xff, 0x77, 0x6a, 0x57, 0xff, 0x69, 0x5c, 0x48, 0xff, 0x6e, 0x61, 0x4d,
+    0xff, 0x6e, 0x62, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4e, 0xff, 0x04, 0x6d, 0x5f, 0x4b, 0xff, 0x6a,
+    0x5d, 0x4b, 0xff, 0x75, 0x6b, 0x63, 0xff, 0xda, 0xd7, 0xd7, 0x52, 0xff, 0xff, 0xff, 0x02, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe9, 0xe4,
+    0x2f, 0x8c, 0x81, 0x71, 0xff, 0x65, 0x57, 0x41, 0xff, 0x63, 0x55, 0x3f, 0xff, 0x67, 0x59, 0x44,
+    0xff, 0x6c, 0x5f, 0x4d, 0xff, 0x74, 0x68, 0x5b, 0xff, 0x86, 0x7d, 0x73, 0xff, 0xcc, 0xc9, 0xc4,
+    0x68, 0xff, 0xff, 0xff, 0x07, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0xf0, 0xf0, 0x23, 0xbe,
+    0xb7, 0xaf, 0x95, 0x92, 0x88, 0x7a, 0xff, 0x84, 0x77, 0x66, 0xff, 0x78, 0x6b, 0x58, 0xff, 0x72,
+    0x64, 0x51, 0xff, 0x7a, 0x6c, 0x5a, 0xff, 0x90, 0x87, 0x7e, 0xff, 0xd2, 0xcf, 0xcf, 0x50, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff,
+    0xff, 0xff, 0x12, 0xa5, 0x9d, 0x91, 0xff, 0x78, 0x6c, 0x5a, 0xff, 0x67, 0x5a, 0x46, 0xfc, 0x6e,
+    0x61, 0x4e, 0xff, 0x81, 0x6e, 0x61, 0x4f, 0xff, 0x04, 0x6e, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4a,
+    0xff, 0x6e, 0x60, 0x4e, 0xff, 0x77, 0x6c, 0x66, 0xff, 0xf3, 0xf3, 0xf3, 0x16, 0x86, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x08, 0xd0, 0xce, 0xc7, 0x68, 0x93, 0x89, 0x7a, 0xff, 0x81,
+    0x75, 0x64, 0xff, 0x8c, 0x81, 0x73, 0xff, 0x9b, 0x93, 0x89, 0xff, 0xca, 0xc5, 0xc3, 0x6a, 0xf1,
+    0xf1, 0xf1, 0x25, 0xff, 0xff, 0xff, 0x07, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0x0a, 0xf3, 0xf3, 0xf3, 0x16, 0xe9,
+    0xe4, 0xe0, 0x39, 0xa4, 0x9b, 0x90, 0xeb, 0x8b, 0x80, 0x72, 0xff, 0xc1, 0xbc, 0xb2, 0x63, 0xf4,
+    0xf4, 0xf4, 0x17, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x0f, 0xab, 0xa2, 0x97, 0xee, 0x75, 0x68, 0x56,
+    0xff, 0x64, 0x56, 0x41, 0xff, 0x82, 0x6b, 0x5e, 0x4a, 0xff, 0x04, 0x6c, 0x5f, 0x4a, 0xff, 0x69,
+    0x5b, 0x44, 0xfc, 0x6d, 0x60, 0x4e, 0xff, 0x81, 0x78, 0x73, 0xff, 0xff, 0xff, 0xff, 0x11, 0x85,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x04, 0xf6, 0xf6, 0xf6, 0x1e, 0xf6, 0xf6, 0xee, 0x1e, 0xf7, 0xf7, 0xf7, 0x1f, 0xf6, 0xf6, 0xf6,
+    0x1c, 0xff, 0xff, 0xff, 0x06, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x93,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+    0xff, 0xff, 0x12, 0xf5, 0xf5, 0xf5, 0x1a, 0xff, 0xff, 0xff, 0x04, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0x01, 0x84, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe9, 0xe4, 0xe4, 0x2f, 0x7b,
+    0x6f, 0x5c, 0xff, 0x67, 0x5a, 0x44, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x81, 0x6b, 0x5e, 0x4a, 0xff,
+    0x04, 0x6b, 0x5d, 0x48, 0xff, 0x67, 0x59, 0x44, 0xff, 0x74, 0x68, 0x59, 0xff, 0x97, 0x90, 0x8c,
+    0xff, 0xff, 0xff, 0xff, 0x10, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x85,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff,
+    0xff, 0xff, 0x02, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0a, 0xb1,
+    0xaa, 0x9f, 0xb8, 0x8a, 0x80, 0x6f, 0xff, 0x89, 0x7e, 0x6f, 0xe7, 0x89, 0x80, 0x6f, 0xe2, 0x88,
+    0x7e, 0x6f, 0xe4, 0x87, 0x7b, 0x6d, 0xe7, 0x83, 0x78, 0x6a, 0xff, 0x94, 0x8b, 0x81, 0xf7, 0xec,
+    0xec, 0xec, 0x28, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x82, 0x00, 0x00,
+    0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x00,
+    0x82, 0xff, 0xff, 0xff, 0x01, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x09, 0x81, 0xff, 0xff,
+    0xff, 0x0c, 0x04, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x10, 0xff, 0xf4, 0xf4, 0x18, 0xff,
+    0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0x0b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x00,
+};
+
+const lv_image_dsc_t test_image_cogwheel_argb8888_rle = {
+    .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.always_zero = 0,
+    .header.compress = LV_IMAGE_COMPRESS_RLE,
+    .header.w = 100,
+    .header.h = 100,
+    .data_size = 23462,
+    .data = test_image_cogwheel_argb8888_rle_map,
+};
@@ -0,0 +1,478 @@
+#include "../../../lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_RGB565_LZ4
+    #define LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_RGB565_LZ4
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_RGB565_LZ4 uint8_t
+test_image_cogwheel_rgb565_lz4_map[] = {
+    /*LZ4 compressed, 20000 bytes decompressed*/
+    0x2f, 0x1c, 0xe7, 0x02, 0x00, 0x47, 0x60, 0xf6, 0x94, 0x13, 0x74, 0xf2, 0x6b, 0x02, 0x00, 0x60,
+    0xb2, 0x63, 0x33, 0x74, 0xbb, 0xd6, 0x14, 0x00, 0x0f, 0x02, 0x00, 0xa1, 0xf0, 0x01, 0x74, 0x7c,
+    0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xb2, 0x63, 0xd2, 0x6b, 0x74, 0x84, 0x14, 0x00,
+    0x0f, 0x02, 0x00, 0xa1, 0x60, 0x33, 0x7c, 0xd2, 0x6b, 0x13, 0x74, 0x02, 0x00, 0x60, 0xf2, 0x6b,
+    0xd2, 0x63, 0x13, 0x74, 0x14, 0x00, 0x0a, 0x02, 0x00, 0x60, 0xbb, 0xd6, 0x36, 0x9d, 0xfc, 0xe6,
+    0x0a, 0x00, 0x0f, 0x02, 0x00, 0x6d, 0x60, 0xf6, 0x8c, 0x34, 0x74, 0xf9, 0xb5, 0x0a, 0x00, 0x0c,
+    0x02, 0x00, 0x53, 0xfc, 0xde, 0x54, 0x7c, 0xf2, 0xc8, 0x00, 0x20, 0x12, 0x74, 0xd2, 0x00, 0x0c,
+    0xb2, 0x00, 0xcc, 0xbb, 0xd6, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x12, 0x74, 0xf5, 0x94, 0x1c,
+    0x00, 0x0f, 0x02, 0x00, 0x57, 0xe0, 0x7b, 0xce, 0xd6, 0x8c, 0x95, 0x84, 0x74, 0x7c, 0x34, 0x74,
+    0x54, 0x7c, 0x3a, 0xc6, 0x12, 0x00, 0x0a, 0x02, 0x00, 0x28, 0x3a, 0xc6, 0xc8, 0x00, 0x60, 0xf2,
+    0x6b, 0x12, 0x74, 0xb4, 0x8c, 0x18, 0x00, 0x06, 0x02, 0x00, 0xff, 0x00, 0x74, 0x84, 0x90, 0x5b,
+    0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0x12, 0x74, 0x94, 0x78, 0x02, 0x62, 0x60, 0x1a,
+    0xbe, 0x75, 0x7c, 0x34, 0x74, 0xc4, 0x00, 0x5f, 0x74, 0x7c, 0x33, 0x74, 0x95, 0x84, 0x00, 0x00,
+    0x57, 0xf6, 0x94, 0x33, 0x74, 0xf3, 0xc8, 0x00, 0x40, 0xf2, 0x73, 0x32, 0x7c, 0x18, 0x00, 0x04,
+    0x02, 0x00, 0x40, 0x77, 0xa5, 0xd1, 0x6b, 0x90, 0x01, 0x00, 0x02, 0x00, 0x60, 0x90, 0x5b, 0x50,
+    0x5b, 0x90, 0x63, 0x16, 0x00, 0x0f, 0x02, 0x00, 0x5d, 0x71, 0xd6, 0x8c, 0x34, 0x74, 0x55, 0x7c,
+    0x74, 0x02, 0x00, 0x00, 0xce, 0x00, 0x20, 0x7a, 0xce, 0x16, 0x00, 0x08, 0x02, 0x00, 0x31, 0x95,
+    0x84, 0x33, 0xc4, 0x00, 0x02, 0x02, 0x00, 0x00, 0xb6, 0x04, 0x19, 0x12, 0xc8, 0x00, 0x71, 0x33,
+    0x74, 0x91, 0x5b, 0xd1, 0x6b, 0xd1, 0xc8, 0x00, 0x6f, 0xb1, 0x63, 0x70, 0x5b, 0x90, 0x63, 0xd2,
+    0x04, 0x61, 0x71, 0x78, 0xa5, 0x54, 0x7c, 0x75, 0x7c, 0x75, 0xc8, 0x00, 0x6c, 0x54, 0x7c, 0x54,
+    0x74, 0x54, 0x7c, 0xe2, 0x02, 0x20, 0x74, 0x84, 0xc0, 0x00, 0x04, 0x02, 0x00, 0x00, 0xb6, 0x04,
+    0x40, 0xf2, 0x73, 0xdb, 0xde, 0x1a, 0x00, 0x00, 0x02, 0x00, 0x40, 0x5a, 0xce, 0xf2, 0x6b, 0x50,
+    0x02, 0x04, 0xc8, 0x00, 0x60, 0x90, 0x63, 0xd1, 0x6b, 0x76, 0xad, 0x1a, 0x00, 0x0f, 0x02, 0x00,
+    0x5b, 0x56, 0xf9, 0xb5, 0x75, 0x7c, 0x55, 0xc8, 0x00, 0x47, 0x7c, 0x13, 0x74, 0x98, 0x86, 0x00,
+    0x48, 0xfc, 0xe6, 0x5a, 0xc6, 0x8e, 0x01, 0x40, 0x13, 0x74, 0xf2, 0x73, 0x92, 0x01, 0x22, 0x53,
+    0x84, 0xca, 0x00, 0xb3, 0xfc, 0xde, 0x12, 0x74, 0xb1, 0x63, 0xd2, 0x6b, 0xd1, 0x6b, 0xb1, 0x5c,
+    0x02, 0x00, 0xc8, 0x00, 0x20, 0x36, 0xa5, 0x1c, 0x00, 0x0f, 0x02, 0x00, 0x5b, 0x20, 0xb9, 0xad,
+    0xc2, 0x00, 0x02, 0x92, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x28, 0x03, 0xb9, 0xd9, 0xb5, 0xdb, 0xde,
+    0xdb, 0xde, 0xbb, 0xd6, 0xf9, 0xbd, 0xb5, 0x54, 0x02, 0x00, 0x02, 0x00, 0x00, 0xc8, 0x00, 0x00,
+    0x26, 0x03, 0x80, 0x54, 0x7c, 0xd8, 0xb5, 0x9b, 0xd6, 0x94, 0x84, 0xbc, 0x00, 0x00, 0xc8, 0x00,
+    0x04, 0x24, 0x03, 0x5f, 0x90, 0x63, 0xd1, 0x73, 0x97, 0xf8, 0x04, 0x02, 0x0f, 0x02, 0x00, 0x4b,
+    0x44, 0x9b, 0xce, 0x95, 0x84, 0x5a, 0x02, 0x00, 0xc6, 0x00, 0x00, 0x02, 0x00, 0x00, 0x28, 0x03,
+    0x20, 0x54, 0x7c, 0xc2, 0x00, 0x40, 0x33, 0x74, 0x33, 0x7c, 0xbe, 0x00, 0x06, 0x02, 0x00, 0x11,
+    0x12, 0xca, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1c, 0x07, 0x20, 0xd1, 0x63, 0x08, 0x00, 0x00, 0xc6,
+    0x00, 0x00, 0x02, 0x00, 0x04, 0xc8, 0x00, 0x11, 0xfc, 0xac, 0x01, 0x0f, 0x02, 0x00, 0x5d, 0x20,
+    0x57, 0xa5, 0xc6, 0x00, 0x08, 0xc8, 0x00, 0x04, 0x02, 0x00, 0x10, 0x33, 0xc8, 0x00, 0x10, 0x74,
+    0xd0, 0x00, 0x06, 0x02, 0x00, 0x10, 0x12, 0xca, 0x00, 0x01, 0xc6, 0x00, 0x02, 0x06, 0x00, 0x02,
+    0x02, 0x00, 0x01, 0xc6, 0x00, 0x01, 0xc8, 0x00, 0x3f, 0xb0, 0x63, 0x11, 0xf4, 0x04, 0x00, 0x4c,
+    0x1c, 0xe7, 0xd8, 0xb5, 0x78, 0x03, 0x0f, 0x02, 0x00, 0x3d, 0x13, 0x7b, 0x92, 0x01, 0x00, 0x60,
+    0x02, 0x00, 0xbe, 0x00, 0x03, 0x02, 0x00, 0x21, 0x74, 0x54, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0xc0, 0x00, 0x04, 0x02, 0x00, 0x04, 0xc8, 0x00, 0x02, 0x02, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0xc8, 0x00, 0x02, 0x90, 0x01, 0x39, 0xb1, 0x63, 0x11, 0xce, 0x04, 0x00, 0x02, 0x00,
+    0xa0, 0x39, 0xc6, 0x53, 0x7c, 0xb1, 0x63, 0xf1, 0x6b, 0x19, 0xbe, 0x0e, 0x00, 0x0f, 0x02, 0x00,
+    0x2b, 0x60, 0x1a, 0xbe, 0x17, 0x95, 0x38, 0x9d, 0x0a, 0x00, 0x0c, 0x02, 0x00, 0x4d, 0x98, 0xad,
+    0x75, 0x7c, 0xc8, 0x00, 0x21, 0x74, 0x34, 0xc2, 0x00, 0x02, 0x02, 0x00, 0x00, 0xc0, 0x00, 0x04,
+    0x02, 0x00, 0x0f, 0xc8, 0x00, 0x01, 0x00, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc6, 0x00, 0x00,
+    0xe8, 0x03, 0x19, 0x19, 0x4e, 0x07, 0xd7, 0xf5, 0x94, 0xd1, 0x6b, 0x4f, 0x5b, 0xf1, 0x6b, 0x0f,
+    0x53, 0xb0, 0x63, 0x97, 0x44, 0x04, 0x0f, 0x02, 0x00, 0x21, 0xac, 0xb9, 0xad, 0xd6, 0x8c, 0x75,
+    0x7c, 0x96, 0x84, 0xd6, 0x8c, 0xbc, 0x02, 0x20, 0x3a, 0xc6, 0x54, 0x02, 0x0b, 0xc6, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x24, 0x03, 0x0a, 0xc6, 0x00, 0x01, 0xe8, 0x03, 0x03, 0x20, 0x03, 0x02, 0x02,
+    0x00, 0x06, 0xc8, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x82, 0x05, 0x00, 0xa0, 0x08, 0x06, 0x7a, 0x01,
+    0x80, 0x73, 0x7c, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x58, 0x06, 0x5f, 0x2f, 0x53, 0x90, 0x63,
+    0x36, 0x4c, 0x01, 0x02, 0x0f, 0x02, 0x00, 0x13, 0xf5, 0x00, 0xd9, 0xad, 0xd6, 0x8c, 0x96, 0x84,
+    0xb6, 0x84, 0x96, 0x84, 0x76, 0x84, 0xb6, 0x84, 0x1a, 0x64, 0x00, 0x20, 0x9b, 0xce, 0xde, 0x00,
+    0x40, 0x75, 0x7c, 0x95, 0x84, 0x06, 0x00, 0x0c, 0xc8, 0x00, 0x00, 0x92, 0x01, 0x00, 0x30, 0x06,
+    0x04, 0x94, 0x08, 0x02, 0x02, 0x00, 0x22, 0xf2, 0x73, 0xb8, 0x00, 0x02, 0x20, 0x03, 0x0e, 0xc8,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0xa2, 0x08, 0x80, 0xf2, 0x73, 0xbb, 0xd6, 0xfc, 0xe6, 0x12, 0x74,
+    0xc6, 0x00, 0x00, 0xb4, 0x08, 0x11, 0x90, 0xca, 0x00, 0x5f, 0x2e, 0x53, 0x90, 0x63, 0xd8, 0xce,
+    0x04, 0x24, 0x30, 0x3a, 0xc6, 0xd7, 0xc6, 0x00, 0x21, 0x8c, 0xb6, 0xca, 0x00, 0x00, 0xd0, 0x00,
+    0x02, 0x22, 0x06, 0x00, 0x58, 0x09, 0x00, 0xc0, 0x00, 0x02, 0xc6, 0x00, 0x06, 0xc8, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x9c, 0x07, 0x80, 0x6f, 0x5b, 0x4f, 0x53, 0x6f, 0x5b, 0xf2,
+    0x6b, 0xd2, 0x00, 0x02, 0x02, 0x00, 0x00, 0x18, 0x00, 0x40, 0x4f, 0x5b, 0x2f, 0x53, 0x64, 0x01,
+    0x00, 0xb0, 0x00, 0x00, 0xd2, 0x00, 0x02, 0xca, 0x00, 0x00, 0xc2, 0x00, 0x04, 0x02, 0x00, 0x00,
+    0x1c, 0x00, 0x61, 0x32, 0x74, 0x12, 0x74, 0x70, 0x5b, 0xc6, 0x00, 0x10, 0x5b, 0xc6, 0x00, 0x02,
+    0x02, 0x00, 0x2c, 0x2f, 0x53, 0x9e, 0x09, 0x0f, 0x02, 0x00, 0x15, 0x20, 0x78, 0xa5, 0xbc, 0x00,
+    0x02, 0x02, 0x00, 0x00, 0xc8, 0x00, 0x80, 0x75, 0x84, 0x95, 0x84, 0xb6, 0x84, 0x95, 0x84, 0xc0,
+    0x00, 0x01, 0x06, 0x00, 0x03, 0xc8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x4a, 0x02, 0x20, 0xf2, 0x6b,
+    0x1c, 0x02, 0xd9, 0x6f, 0x5b, 0x2e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x2e, 0x53, 0xd2,
+    0xc8, 0x00, 0xf1, 0x04, 0x90, 0x63, 0x0e, 0x53, 0xed, 0x4a, 0x0d, 0x4b, 0x0e, 0x4b, 0x2e, 0x53,
+    0x4f, 0x5b, 0x6f, 0x5b, 0x90, 0x63, 0x91, 0xd0, 0x00, 0x0a, 0xca, 0x00, 0x20, 0x90, 0x63, 0xb6,
+    0x00, 0x00, 0xd0, 0x00, 0x00, 0x0a, 0x00, 0x04, 0xca, 0x00, 0x00, 0x16, 0x01, 0x0f, 0x26, 0x07,
+    0x25, 0x20, 0x98, 0xad, 0xbe, 0x00, 0x02, 0xc4, 0x00, 0x02, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x32,
+    0x95, 0x84, 0x95, 0xc6, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x41, 0x54, 0x7c, 0x34, 0x7c,
+    0x6e, 0x01, 0x72, 0x53, 0x0d, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x02, 0x00, 0x3d, 0x0d, 0x4b, 0x2f,
+    0xc8, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x02, 0x00, 0x13, 0x0e, 0x26, 0x00, 0x40, 0x4f, 0x53, 0x90,
+    0x5b, 0xbc, 0x00, 0x06, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x08, 0x00, 0x11,
+    0x70, 0xc8, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x8e, 0x01, 0x3f, 0xb0, 0x6b, 0xb7, 0x58, 0x02, 0x24,
+    0x51, 0xbb, 0xd6, 0xb6, 0x84, 0x75, 0xc0, 0x00, 0x02, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x06, 0x02,
+    0x00, 0x04, 0x8e, 0x01, 0x00, 0x9c, 0x0b, 0x81, 0x90, 0x5b, 0x2f, 0x53, 0x2e, 0x53, 0x0e, 0x4b,
+    0x6e, 0x01, 0x01, 0xa2, 0x00, 0x3d, 0x0e, 0x53, 0x0e, 0xc8, 0x00, 0x31, 0x91, 0x63, 0x2e, 0x90,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0xca, 0x00, 0x31, 0x2e, 0x53, 0x4f, 0x68, 0x02, 0x00, 0x98, 0x01,
+    0x00, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x08, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x02, 0x00, 0x6f,
+    0x4f, 0x5b, 0x4f, 0x5b, 0xd1, 0x7b, 0x48, 0x06, 0x27, 0x20, 0x7b, 0xce, 0xc8, 0x00, 0x02, 0x92,
+    0x01, 0x00, 0xbc, 0x00, 0x0c, 0x02, 0x00, 0x40, 0x75, 0x7c, 0x13, 0x74, 0xf6, 0x02, 0x00, 0x7e,
+    0x01, 0x00, 0xc2, 0x00, 0x11, 0x2e, 0xce, 0x00, 0xa8, 0xee, 0x4a, 0xed, 0x4a, 0x0e, 0x53, 0x4f,
+    0x63, 0x90, 0x6b, 0x20, 0x03, 0xf0, 0x01, 0xd2, 0x6b, 0x4f, 0x63, 0xcc, 0x52, 0x0d, 0x53, 0x6f,
+    0x5b, 0x4e, 0x5b, 0xed, 0x4a, 0xcd, 0x42, 0x78, 0x02, 0x02, 0x02, 0x00, 0x02, 0x64, 0x02, 0x00,
+    0x34, 0x03, 0x0c, 0xca, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x51, 0x4f, 0x53, 0x8f, 0x6b,
+    0x35, 0x9c, 0x03, 0x0f, 0x02, 0x00, 0x25, 0x60, 0x5a, 0xc6, 0x96, 0x84, 0x75, 0x7c, 0xca, 0x00,
+    0x00, 0xb8, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x8a, 0x01, 0x20, 0x70, 0x5b, 0xf4, 0x02, 0x00, 0x5c,
+    0x01, 0x00, 0x82, 0x01, 0x00, 0x0a, 0x00, 0xd7, 0x2e, 0x5b, 0x90, 0x6b, 0x52, 0x84, 0xd8, 0xbd,
+    0xfc, 0xe6, 0xdb, 0xde, 0x54, 0xf2, 0x0a, 0xa0, 0xb1, 0x6b, 0x2e, 0x5b, 0x4e, 0x6b, 0x59, 0xce,
+    0xfc, 0xe6, 0x1a, 0x00, 0xb1, 0x73, 0x84, 0xd1, 0x6b, 0x2e, 0x53, 0xee, 0x4a, 0x0e, 0x53, 0x2f,
+    0x6e, 0x01, 0x00, 0x96, 0x01, 0x0e, 0xca, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x8e, 0x01, 0x40, 0x2e,
+    0x5b, 0xd0, 0x7b, 0x8e, 0x00, 0x0f, 0x02, 0x00, 0x29, 0x20, 0xf7, 0x94, 0xb4, 0x00, 0x0e, 0x02,
+    0x00, 0x51, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0xbe, 0x00, 0x01, 0xc4, 0x00, 0x02, 0x26, 0x02, 0x65,
+    0x63, 0xd0, 0x73, 0x52, 0x8c, 0xfb, 0x6a, 0x06, 0x00, 0x30, 0x11, 0x04, 0x4a, 0x0d, 0x60, 0xb1,
+    0x63, 0x90, 0x6b, 0xb7, 0xbd, 0x16, 0x00, 0x02, 0x02, 0x00, 0xa0, 0xfb, 0xde, 0x73, 0x84, 0xb0,
+    0x6b, 0x6f, 0x5b, 0x2f, 0x53, 0xc4, 0x04, 0x11, 0x6f, 0xb2, 0x00, 0x00, 0xbc, 0x00, 0x08, 0x02,
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x2a, 0x01, 0x40, 0x6f, 0x6b, 0xf8, 0xc5, 0x34, 0x00, 0x0f, 0x02,
+    0x00, 0x2b, 0x0c, 0xca, 0x00, 0x00, 0x9c, 0x01, 0x22, 0x34, 0x74, 0xb6, 0x03, 0x00, 0xc0, 0x00,
+    0x02, 0x02, 0x00, 0x5b, 0x2e, 0x63, 0xf1, 0x7b, 0x9a, 0x08, 0x0d, 0x20, 0x16, 0x9d, 0xc6, 0x04,
+    0x00, 0xc6, 0x00, 0x00, 0x90, 0x01, 0x20, 0xd1, 0x73, 0x14, 0x00, 0x0a, 0x02, 0x00, 0x20, 0x9a,
+    0xd6, 0xb4, 0x07, 0x00, 0x8e, 0x01, 0x02, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x06, 0x02, 0x00, 0x00,
+    0x12, 0x00, 0x5f, 0x70, 0x5b, 0x2f, 0x5b, 0xf1, 0x8e, 0x01, 0x2e, 0x00, 0x02, 0x00, 0x22, 0x17,
+    0x95, 0x68, 0x05, 0x02, 0x02, 0x00, 0x00, 0xc6, 0x00, 0x20, 0x33, 0x74, 0x44, 0x05, 0x00, 0xc6,
+    0x00, 0x00, 0x92, 0x01, 0x6f, 0xed, 0x52, 0x2e, 0x5b, 0xd0, 0x73, 0xcc, 0x0d, 0x01, 0x26, 0x16,
+    0x95, 0xc8, 0x00, 0x3f, 0xd1, 0x6b, 0xf1, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x7a, 0xce,
+    0xf1, 0x73, 0x94, 0x01, 0x00, 0xba, 0x00, 0x06, 0x02, 0x00, 0x00, 0xc2, 0x00, 0x02, 0x02, 0x00,
+    0x3f, 0x4f, 0x53, 0x12, 0x6a, 0x11, 0x00, 0x0f, 0x02, 0x00, 0x1d, 0x33, 0x5a, 0xc6, 0xb6, 0x30,
+    0x06, 0x04, 0x02, 0x00, 0x40, 0x33, 0x74, 0x90, 0x5b, 0x50, 0x02, 0x00, 0xa4, 0x03, 0x00, 0xc8,
+    0x00, 0x42, 0x6f, 0x63, 0x31, 0x8c, 0x1e, 0x0d, 0x0c, 0x02, 0x00, 0x0b, 0xc8, 0x00, 0x0f, 0x56,
+    0x01, 0x06, 0x40, 0x9a, 0xd6, 0x32, 0x74, 0xb2, 0x00, 0x11, 0xb0, 0xee, 0x03, 0x0a, 0xc6, 0x00,
+    0x00, 0xc8, 0x00, 0x3f, 0xb0, 0x63, 0xb7, 0xe6, 0x03, 0x2a, 0x00, 0x02, 0x00, 0x00, 0xbc, 0x07,
+    0x00, 0xbe, 0x00, 0x04, 0x02, 0x00, 0x03, 0xc6, 0x00, 0x01, 0xc4, 0x00, 0x00, 0xc6, 0x00, 0x39,
+    0x8f, 0x73, 0x18, 0xde, 0x09, 0x08, 0x02, 0x00, 0x0f, 0xc8, 0x00, 0x15, 0x00, 0x02, 0x00, 0x20,
+    0x36, 0x9d, 0xc0, 0x00, 0x00, 0xea, 0x03, 0x00, 0x02, 0x00, 0x0c, 0xca, 0x00, 0x08, 0x84, 0x10,
+    0x8f, 0xfb, 0xde, 0xf8, 0xbd, 0xf8, 0xbd, 0x97, 0xad, 0x88, 0x05, 0x19, 0x20, 0xd9, 0xb5, 0x24,
+    0x06, 0x00, 0xc0, 0x00, 0x02, 0x02, 0x00, 0x11, 0x54, 0x52, 0x02, 0x04, 0x8c, 0x01, 0x4f, 0x0d,
+    0x53, 0xf0, 0x7b, 0x50, 0x02, 0x01, 0x04, 0x02, 0x00, 0x24, 0x16, 0x95, 0xe8, 0x03, 0x00, 0xec,
+    0x07, 0x0f, 0xc8, 0x00, 0x0b, 0x00, 0xa6, 0x0b, 0x20, 0xf2, 0x73, 0xf6, 0x0a, 0x00, 0x02, 0x00,
+    0x0a, 0xca, 0x00, 0x00, 0x66, 0x06, 0xa0, 0x56, 0xa5, 0x39, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x97,
+    0xad, 0x7c, 0x09, 0x00, 0x42, 0x01, 0x0f, 0x6e, 0x02, 0x07, 0x57, 0x17, 0x95, 0x37, 0x9d, 0xdc,
+    0x22, 0x02, 0x11, 0x5a, 0xd4, 0x0a, 0x00, 0xc0, 0x00, 0x02, 0x02, 0x00, 0x00, 0xa4, 0x04, 0x00,
+    0x18, 0x03, 0x00, 0xc4, 0x00, 0x77, 0x2e, 0x53, 0x0e, 0x5b, 0xf1, 0x83, 0xbb, 0x2e, 0x00, 0x0e,
+    0x02, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x90, 0x01, 0x00, 0xb2, 0x0b, 0x3f, 0xd1, 0x6b, 0xf2, 0xc8,
+    0x00, 0x0c, 0x40, 0x1c, 0xe7, 0x59, 0xc6, 0xb6, 0x0f, 0x00, 0x7a, 0x09, 0x01, 0xca, 0x00, 0x01,
+    0xc4, 0x00, 0x02, 0x02, 0x00, 0x60, 0x6f, 0x5b, 0x6f, 0x5b, 0xb0, 0x63, 0xe0, 0x04, 0x00, 0x7a,
+    0x00, 0x00, 0xba, 0x01, 0x00, 0x48, 0x0a, 0x1f, 0x93, 0x7a, 0x0d, 0x02, 0x20, 0xd6, 0x8c, 0x4e,
+    0x0c, 0xa2, 0x95, 0x84, 0xd6, 0x8c, 0x16, 0x95, 0x78, 0xa5, 0x3a, 0xc6, 0xb4, 0x0b, 0x00, 0x56,
+    0x09, 0x00, 0xbc, 0x07, 0x00, 0xf6, 0x06, 0x17, 0xd1, 0xc6, 0x00, 0x4f, 0x0d, 0x53, 0x11, 0x84,
+    0xc6, 0x00, 0x0b, 0x04, 0xc8, 0x00, 0x40, 0x12, 0x6c, 0x12, 0x6c, 0xc8, 0x00, 0x0a, 0xf6, 0x11,
+    0x0f, 0x02, 0x00, 0x03, 0x53, 0x39, 0xc6, 0x12, 0x74, 0xd1, 0x10, 0x0b, 0x00, 0x36, 0x0a, 0x04,
+    0x02, 0x00, 0x20, 0x6f, 0x5b, 0x64, 0x0a, 0x00, 0x86, 0x01, 0x22, 0x2e, 0x53, 0xaa, 0x05, 0x60,
+    0x4f, 0x53, 0xee, 0x4a, 0xd1, 0x6b, 0x34, 0x00, 0x0a, 0x02, 0x00, 0x20, 0xfc, 0xde, 0x4e, 0x05,
+    0x20, 0x75, 0x84, 0xba, 0x0a, 0x00, 0xb6, 0x00, 0x30, 0xb6, 0x84, 0xb5, 0x7a, 0x08, 0x00, 0x04,
+    0x00, 0x01, 0x10, 0x00, 0x53, 0x75, 0x7c, 0xf2, 0x6b, 0x4f, 0xa4, 0x04, 0x00, 0x50, 0x00, 0x2f,
+    0xf0, 0x7b, 0xc6, 0x00, 0x0d, 0x04, 0xc8, 0x00, 0x02, 0x78, 0x0c, 0x0f, 0x58, 0x02, 0x0f, 0x02,
+    0x02, 0x00, 0x20, 0x5a, 0xc6, 0xe2, 0x0b, 0x00, 0x32, 0x00, 0x22, 0xd2, 0x6b, 0x5c, 0x02, 0x00,
+    0x8c, 0x01, 0x00, 0xc8, 0x00, 0x07, 0x02, 0x00, 0x00, 0xd0, 0x08, 0x6d, 0x53, 0x0e, 0x4b, 0x4f,
+    0x5b, 0x59, 0x9c, 0x03, 0x11, 0xb5, 0x8e, 0x01, 0x04, 0x02, 0x00, 0x11, 0x55, 0x8a, 0x0b, 0x00,
+    0x0a, 0x00, 0x04, 0x02, 0x00, 0x46, 0x34, 0x74, 0x70, 0x5b, 0xc6, 0x00, 0x3f, 0x8f, 0x73, 0xba,
+    0x18, 0x03, 0x08, 0x04, 0x02, 0x00, 0x08, 0xc8, 0x00, 0x1f, 0xb1, 0xc8, 0x00, 0x14, 0x40, 0x1c,
+    0xe7, 0xd5, 0x94, 0xc8, 0x00, 0x00, 0x56, 0x03, 0x24, 0xd1, 0x6b, 0xc6, 0x00, 0x0c, 0xc8, 0x00,
+    0x00, 0x94, 0x01, 0x00, 0x8a, 0x00, 0x0e, 0xcc, 0x05, 0x00, 0xb8, 0x00, 0x02, 0xc8, 0x11, 0x0f,
+    0x02, 0x00, 0x01, 0x00, 0x1a, 0x03, 0x00, 0x4c, 0x02, 0x00, 0x3c, 0x00, 0x4f, 0xed, 0x52, 0x6f,
+    0x6b, 0xa4, 0x04, 0x07, 0x08, 0x02, 0x00, 0x0f, 0xc8, 0x00, 0x23, 0x40, 0x1c, 0xe7, 0x94, 0x84,
+    0xc8, 0x00, 0x40, 0x33, 0x74, 0xf2, 0x73, 0x5c, 0x02, 0x00, 0xc6, 0x00, 0x0f, 0xc8, 0x00, 0x05,
+    0x20, 0x4f, 0x5b, 0x30, 0x00, 0x06, 0x02, 0x00, 0x22, 0xbb, 0xd6, 0xac, 0x15, 0x00, 0xcc, 0x00,
+    0x0f, 0xce, 0x00, 0x01, 0x20, 0x13, 0x74, 0x96, 0x0b, 0x00, 0x3a, 0x00, 0x00, 0xba, 0x07, 0x20,
+    0x72, 0x94, 0x34, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x03, 0xc8, 0x00, 0x01, 0x02, 0x00, 0x0f, 0xc8,
+    0x00, 0x19, 0x20, 0xdb, 0xde, 0x1a, 0x16, 0x00, 0x1c, 0x0f, 0x00, 0xee, 0x0b, 0x00, 0xb6, 0x08,
+    0x01, 0xbe, 0x00, 0x06, 0x02, 0x00, 0x01, 0xc6, 0x00, 0x00, 0x36, 0x05, 0x1b, 0x52, 0xea, 0x03,
+    0x24, 0xbb, 0xd6, 0x7e, 0x12, 0x02, 0xca, 0x00, 0x08, 0x02, 0x00, 0x02, 0x8e, 0x01, 0x02, 0x6e,
+    0x05, 0x00, 0x3a, 0x06, 0x2f, 0x11, 0x84, 0xba, 0x05, 0x15, 0x0f, 0xc8, 0x00, 0x25, 0x00, 0x3a,
+    0x00, 0x00, 0x2a, 0x0b, 0x00, 0x22, 0x0f, 0x2d, 0xb1, 0x63, 0xc6, 0x00, 0x01, 0xc8, 0x00, 0x00,
+    0x92, 0x0a, 0x13, 0x11, 0x9e, 0x14, 0x08, 0x02, 0x00, 0x00, 0xe6, 0x17, 0x00, 0x3a, 0x00, 0x00,
+    0xca, 0x00, 0x08, 0x02, 0x00, 0x00, 0xc8, 0x00, 0x20, 0xf2, 0x6b, 0x9c, 0x0b, 0x02, 0x8e, 0x01,
+    0x2f, 0x4f, 0x6b, 0xe0, 0x03, 0x0f, 0x04, 0x02, 0x00, 0x20, 0x95, 0x84, 0xc2, 0x00, 0x02, 0x02,
+    0x00, 0x19, 0xb1, 0xde, 0x15, 0x0f, 0x02, 0x00, 0x0f, 0x40, 0x74, 0x84, 0xf3, 0x6b, 0x80, 0x00,
+    0x02, 0x92, 0x01, 0x0a, 0x02, 0x00, 0x00, 0xc6, 0x00, 0x3f, 0x4f, 0x63, 0x56, 0x0a, 0x07, 0x04,
+    0x7f, 0xfc, 0xde, 0x78, 0xa5, 0x75, 0x84, 0x33, 0xcc, 0x00, 0x00, 0x01, 0x8e, 0x01, 0x01, 0xc8,
+    0x00, 0x00, 0x04, 0x01, 0x00, 0x2c, 0x00, 0x0f, 0x02, 0x00, 0x0f, 0x20, 0xdb, 0xde, 0xee, 0x0a,
+    0x00, 0xb2, 0x03, 0x00, 0x02, 0x00, 0x00, 0x8c, 0x0f, 0x00, 0x5a, 0x1b, 0x0f, 0xca, 0x00, 0x17,
+    0x31, 0x19, 0xbe, 0x33, 0x88, 0x00, 0x11, 0x34, 0xe2, 0x0c, 0x08, 0x02, 0x00, 0x00, 0xa2, 0x03,
+    0x2f, 0x8f, 0x73, 0x02, 0x0b, 0x0b, 0x11, 0x7a, 0x5c, 0x13, 0x0a, 0x02, 0x00, 0x11, 0x13, 0xc4,
+    0x07, 0x00, 0xb8, 0x05, 0x4f, 0x0e, 0x53, 0x8f, 0x6b, 0x8a, 0x00, 0x11, 0x60, 0xfc, 0xde, 0x94,
+    0x84, 0x53, 0x7c, 0xc0, 0x00, 0x04, 0x02, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x06, 0x00, 0x4f, 0x33,
+    0x74, 0xb4, 0x8c, 0x46, 0x01, 0x03, 0x0e, 0x02, 0x00, 0x20, 0xb5, 0x8c, 0x52, 0x01, 0x02, 0x0e,
+    0x02, 0x07, 0x02, 0x00, 0x4f, 0x53, 0x0e, 0x5b, 0x2e, 0xc8, 0x0b, 0x12, 0x0c, 0xcc, 0x00, 0x00,
+    0x5a, 0x0b, 0x01, 0x8c, 0x01, 0x0f, 0x8e, 0x01, 0x14, 0x35, 0x39, 0xbe, 0x33, 0x88, 0x01, 0x04,
+    0x02, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3c, 0x09, 0x2e, 0x12, 0x74, 0x2c, 0x19,
+    0x0f, 0x02, 0x00, 0x01, 0x20, 0x9b, 0xce, 0xc8, 0x00, 0x01, 0xd2, 0x09, 0x07, 0x92, 0x01, 0x4f,
+    0x6f, 0x5b, 0x0e, 0x5b, 0xd0, 0x16, 0x13, 0x00, 0x12, 0x07, 0x00, 0xd0, 0x01, 0x00, 0xc4, 0x00,
+    0x00, 0x08, 0x00, 0x02, 0x8e, 0x01, 0x00, 0x1c, 0x03, 0x28, 0x4e, 0x63, 0x0a, 0x0d, 0x0f, 0x02,
+    0x00, 0x03, 0x20, 0xd5, 0x8c, 0xae, 0x00, 0x00, 0xbc, 0x00, 0x02, 0x70, 0x05, 0x02, 0x02, 0x00,
+    0x00, 0xc4, 0x00, 0x02, 0x02, 0x00, 0x00, 0x44, 0x0e, 0x2f, 0xb1, 0x63, 0xc4, 0x11, 0x13, 0x00,
+    0x9c, 0x03, 0x00, 0x8c, 0x00, 0x15, 0xd2, 0x92, 0x01, 0x6f, 0x2f, 0x5b, 0x90, 0x5b, 0x4f, 0x5b,
+    0x14, 0x02, 0x11, 0x40, 0x1c, 0xe7, 0xdb, 0xd6, 0xc0, 0x00, 0x01, 0x02, 0x00, 0x10, 0x74, 0x56,
+    0x02, 0x20, 0x6f, 0x5b, 0xaa, 0x04, 0x00, 0xc8, 0x00, 0x0f, 0x5e, 0x0e, 0x0f, 0x20, 0x16, 0x95,
+    0x20, 0x09, 0x00, 0xee, 0x1b, 0x00, 0xda, 0x1c, 0x00, 0x46, 0x11, 0x05, 0x02, 0x00, 0x01, 0xc4,
+    0x00, 0x00, 0x90, 0x16, 0x20, 0x6f, 0x5b, 0x20, 0x12, 0x0f, 0xea, 0x14, 0x11, 0x00, 0x18, 0x09,
+    0x00, 0xd8, 0x09, 0x20, 0x13, 0x74, 0xdc, 0x03, 0x01, 0xc8, 0x00, 0x10, 0x53, 0x1c, 0x02, 0x1f,
+    0xd7, 0x90, 0x01, 0x12, 0x40, 0xbb, 0xd6, 0x13, 0x74, 0x2c, 0x1b, 0x11, 0x34, 0x72, 0x16, 0x00,
+    0x9e, 0x02, 0x12, 0x0e, 0xb0, 0x05, 0x2f, 0x5b, 0x56, 0x7c, 0x00, 0x0c, 0x20, 0x39, 0xc6, 0x6e,
+    0x01, 0xb1, 0x6f, 0x5b, 0x15, 0x9d, 0x97, 0xad, 0x74, 0x84, 0xd2, 0x6b, 0x91, 0xd0, 0x09, 0x33,
+    0xb0, 0x63, 0xb1, 0xc4, 0x0a, 0x80, 0xb1, 0x63, 0xf1, 0x73, 0x32, 0x7c, 0x73, 0x84, 0xd2, 0x11,
+    0x1f, 0xd1, 0x6a, 0x03, 0x10, 0x20, 0xfc, 0xde, 0x30, 0x13, 0x40, 0xb6, 0x84, 0x54, 0x7c, 0x20,
+    0x0a, 0x00, 0xc8, 0x00, 0x01, 0x90, 0x08, 0x1a, 0x53, 0x68, 0x1c, 0x0f, 0x02, 0x00, 0x05, 0x20,
+    0x5a, 0xc6, 0xf2, 0x04, 0x00, 0x86, 0x06, 0x00, 0xc0, 0x05, 0x20, 0xd1, 0x63, 0x02, 0x01, 0x00,
+    0x40, 0x07, 0x2f, 0x4e, 0x63, 0xa2, 0x03, 0x0b, 0x00, 0x68, 0x1e, 0x35, 0xb2, 0x63, 0x70, 0x86,
+    0x0a, 0xf2, 0x05, 0x74, 0x84, 0x32, 0x7c, 0xd4, 0x8c, 0x97, 0xad, 0x76, 0xad, 0xb7, 0xad, 0xd8,
+    0xb5, 0xf5, 0x94, 0x13, 0x74, 0x33, 0x7c, 0x84, 0x12, 0x20, 0xf5, 0x94, 0x3a, 0x09, 0x1f, 0x32,
+    0x78, 0x0b, 0x06, 0x06, 0x02, 0x00, 0x00, 0x92, 0x01, 0x00, 0x04, 0x00, 0x30, 0x90, 0x63, 0x2f,
+    0x8c, 0x01, 0x00, 0x02, 0x00, 0x4f, 0x5b, 0x2e, 0x53, 0xb0, 0x04, 0x01, 0x10, 0x00, 0x1c, 0x02,
+    0x00, 0xb0, 0x11, 0x00, 0x02, 0x00, 0x20, 0x34, 0x74, 0xac, 0x04, 0x11, 0x4f, 0x1e, 0x03, 0x3d,
+    0x2e, 0x53, 0xb0, 0xcc, 0x08, 0x0a, 0x02, 0x00, 0x00, 0x4e, 0x08, 0x55, 0xf2, 0x73, 0x91, 0x63,
+    0xd4, 0xee, 0x07, 0x0a, 0xb0, 0x0f, 0x24, 0x9a, 0xce, 0xec, 0x16, 0x22, 0x16, 0x9d, 0xaa, 0x01,
+    0x1f, 0x77, 0x22, 0x14, 0x0e, 0x60, 0xf7, 0x94, 0x76, 0x7c, 0xd7, 0x8c, 0x88, 0x06, 0x00, 0x54,
+    0x02, 0x01, 0xca, 0x00, 0x01, 0x9a, 0x01, 0x1f, 0x73, 0x8c, 0x07, 0x0e, 0x42, 0xfc, 0xde, 0xb5,
+    0x8c, 0x14, 0x08, 0x02, 0xc8, 0x00, 0x16, 0x70, 0xac, 0x04, 0x0f, 0xce, 0x01, 0x0a, 0x20, 0xdb,
+    0xde, 0xda, 0x09, 0x00, 0xac, 0x0a, 0x2f, 0x53, 0x7c, 0x5c, 0x0d, 0x09, 0x00, 0xf0, 0x01, 0x20,
+    0x33, 0x7c, 0xc6, 0x00, 0x46, 0x90, 0x63, 0xf1, 0x6b, 0x5c, 0x11, 0x0f, 0x02, 0x00, 0x03, 0x00,
+    0x1c, 0x10, 0x00, 0x66, 0x16, 0x00, 0x88, 0x00, 0x03, 0xc8, 0x00, 0x00, 0x06, 0x00, 0x00, 0x62,
+    0x02, 0x20, 0x5b, 0xf1, 0x44, 0x0b, 0x43, 0x6b, 0x6f, 0x63, 0x73, 0x00, 0x02, 0x06, 0x02, 0x00,
+    0x42, 0xfc, 0xe6, 0x19, 0xbe, 0xda, 0x1b, 0x00, 0xc6, 0x00, 0x02, 0xc8, 0x00, 0x00, 0xb2, 0x15,
+    0x01, 0x3e, 0x0b, 0x3f, 0x63, 0x32, 0x84, 0x76, 0x00, 0x09, 0x20, 0x3a, 0xc6, 0xc8, 0x03, 0x6f,
+    0xf2, 0x73, 0xf3, 0x6b, 0xd1, 0x6b, 0x32, 0x02, 0x0b, 0x22, 0x53, 0x7c, 0x40, 0x14, 0x4f, 0x91,
+    0x63, 0x70, 0x5b, 0xee, 0x03, 0x0b, 0x00, 0x3a, 0x05, 0x20, 0x34, 0x74, 0x18, 0x09, 0x00, 0x78,
+    0x03, 0x00, 0xc8, 0x00, 0x02, 0x02, 0x00, 0x00, 0x58, 0x01, 0x31, 0xed, 0x4a, 0x0e, 0xfc, 0x13,
+    0x53, 0x0e, 0x4b, 0x4e, 0x5b, 0x52, 0x62, 0x01, 0x80, 0x97, 0xa5, 0x16, 0x95, 0xd5, 0x8c, 0x74,
+    0x84, 0x16, 0x03, 0x00, 0x56, 0x01, 0x00, 0xc4, 0x00, 0x02, 0x02, 0x00, 0x00, 0x20, 0x09, 0x00,
+    0xa0, 0x00, 0x00, 0x32, 0x05, 0xf1, 0x02, 0x12, 0x7c, 0xb5, 0x8c, 0x5a, 0xc6, 0xdb, 0xde, 0x9b,
+    0xd6, 0x9b, 0xd6, 0x9b, 0xce, 0x7a, 0xce, 0x9a, 0x02, 0x00, 0x93, 0x7a, 0xce, 0xbb, 0xd6, 0x19,
+    0xbe, 0xd5, 0x8c, 0x33, 0xf8, 0x06, 0x20, 0xf3, 0x73, 0xbe, 0x11, 0x0f, 0x92, 0x01, 0x09, 0x00,
+    0x4e, 0x17, 0x00, 0x8a, 0x0f, 0x00, 0x92, 0x01, 0xf9, 0x00, 0xd1, 0x6b, 0x73, 0x84, 0xf5, 0x94,
+    0xf5, 0x94, 0xd5, 0x94, 0xd5, 0x8c, 0xd5, 0x8c, 0xd4, 0x02, 0x00, 0x31, 0xd5, 0x94, 0x73, 0x0e,
+    0x1d, 0x00, 0x02, 0x00, 0x01, 0x42, 0x06, 0x01, 0x8c, 0x01, 0x02, 0xc6, 0x00, 0x04, 0x02, 0x00,
+    0x00, 0x68, 0x08, 0x40, 0xcd, 0x4a, 0x0e, 0x53, 0x58, 0x00, 0x00, 0xac, 0x00, 0x00, 0xbe, 0x00,
+    0x04, 0x4c, 0x0f, 0x0a, 0x02, 0x00, 0x00, 0xce, 0x00, 0x02, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x0a,
+    0x02, 0x00, 0x00, 0xb8, 0x00, 0x0e, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x58, 0x00, 0x0f, 0x02,
+    0x00, 0x05, 0x31, 0x57, 0x9d, 0xd1, 0xc4, 0x00, 0x00, 0xca, 0x04, 0x00, 0xea, 0x01, 0x08, 0xc0,
+    0x0e, 0x00, 0xee, 0x04, 0x00, 0x34, 0x02, 0x02, 0x02, 0x00, 0x02, 0x42, 0x02, 0x00, 0xb0, 0x00,
+    0x00, 0xc0, 0x00, 0x00, 0x56, 0x02, 0x00, 0x06, 0x00, 0x00, 0x10, 0x00, 0x06, 0x02, 0x00, 0x51,
+    0x0e, 0x53, 0xcd, 0x42, 0x8f, 0x82, 0x04, 0x60, 0x13, 0x74, 0xd2, 0x63, 0x12, 0x6c, 0x98, 0x00,
+    0x0f, 0x02, 0x00, 0x01, 0x00, 0xc2, 0x00, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x13, 0x6c,
+    0xa8, 0x00, 0x0c, 0x02, 0x00, 0x00, 0xac, 0x01, 0x00, 0xb4, 0x01, 0x04, 0x02, 0x00, 0x3f, 0x70,
+    0x5b, 0xb0, 0x70, 0x0e, 0x00, 0x06, 0x02, 0x00, 0x20, 0x98, 0xad, 0xda, 0x16, 0x00, 0xc8, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0xbc, 0x00, 0x00, 0xae, 0x00, 0x07, 0x02, 0x00, 0x03, 0xb0, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x0a, 0xc6,
+    0x00, 0x00, 0x8e, 0x01, 0x00, 0xc8, 0x00, 0x40, 0x2e, 0x53, 0xf8, 0xbd, 0x2e, 0x05, 0x00, 0x8c,
+    0x23, 0x0f, 0x02, 0x00, 0x25, 0x0e, 0x30, 0x1b, 0x2f, 0x70, 0x5b, 0x3a, 0x14, 0x01, 0x06, 0x02,
+    0x00, 0x20, 0xd9, 0xb5, 0xb6, 0x03, 0x00, 0xc4, 0x00, 0x04, 0x02, 0x00, 0x00, 0xcc, 0x00, 0x08,
+    0x02, 0x00, 0x0d, 0x38, 0x0d, 0x00, 0x02, 0x00, 0x0f, 0xc6, 0x00, 0x04, 0x02, 0x60, 0x16, 0x00,
+    0x88, 0x0c, 0x00, 0xee, 0x25, 0x00, 0x92, 0x00, 0x0f, 0x02, 0x00, 0x1b, 0x00, 0xb2, 0x07, 0x0c,
+    0xc4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x56, 0x0f, 0x0f, 0xc8, 0x00, 0x0b, 0x31, 0xb9, 0xad, 0xf2,
+    0x44, 0x03, 0x06, 0x02, 0x00, 0x00, 0xbc, 0x00, 0x08, 0x02, 0x00, 0x0a, 0xc8, 0x00, 0x00, 0x3a,
+    0x06, 0x02, 0x90, 0x01, 0x0f, 0xc8, 0x00, 0x05, 0x40, 0x0d, 0x4b, 0x32, 0x84, 0x40, 0x04, 0x0f,
+    0xc8, 0x00, 0x17, 0x02, 0xaa, 0x00, 0x00, 0x04, 0x00, 0x07, 0x02, 0x00, 0x30, 0x63, 0xd2, 0x63,
+    0x08, 0x00, 0x02, 0x16, 0x00, 0x00, 0x30, 0x0c, 0x0e, 0x36, 0x0f, 0x08, 0x02, 0x00, 0x20, 0x78,
+    0xa5, 0xb4, 0x01, 0x00, 0xc0, 0x00, 0x02, 0x02, 0x00, 0x00, 0xba, 0x00, 0x00, 0xb0, 0x00, 0x00,
+    0xaa, 0x00, 0x00, 0x02, 0x00, 0x00, 0xb6, 0x00, 0x02, 0xb2, 0x00, 0x00, 0x58, 0x02, 0x06, 0xc6,
+    0x00, 0x04, 0xc8, 0x06, 0x04, 0x02, 0x00, 0x00, 0xe0, 0x17, 0x00, 0x02, 0x00, 0x80, 0xcd, 0x4a,
+    0x4e, 0x5b, 0x59, 0xce, 0x1c, 0xe7, 0x06, 0x0f, 0x00, 0xa0, 0x00, 0x00, 0x02, 0x00, 0x20, 0xf3,
+    0x73, 0xae, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x88, 0x01, 0x00, 0x02, 0x00,
+    0x0c, 0x8c, 0x01, 0x00, 0xc2, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x8e, 0x08, 0x0f, 0x22, 0x13, 0x07,
+    0x00, 0x02, 0x00, 0x22, 0xb5, 0x8c, 0x06, 0x07, 0x04, 0x02, 0x00, 0x02, 0xd4, 0x00, 0x00, 0xac,
+    0x08, 0x04, 0x02, 0x00, 0x0b, 0x90, 0x01, 0x01, 0xc4, 0x00, 0x02, 0xda, 0x00, 0x06, 0x02, 0x00,
+    0x00, 0x8a, 0x01, 0x00, 0x08, 0x00, 0x40, 0x2e, 0x5b, 0x8f, 0x6b, 0x56, 0x02, 0x00, 0x40, 0x08,
+    0x02, 0x82, 0x00, 0x04, 0x06, 0x00, 0x01, 0xa2, 0x00, 0x23, 0x73, 0x12, 0xba, 0x00, 0x00, 0x74,
+    0x15, 0x00, 0x02, 0x00, 0xc0, 0x70, 0x5b, 0x4f, 0x63, 0xb1, 0x73, 0x73, 0x8c, 0x5a, 0xce, 0xfc,
+    0xde, 0x46, 0x22, 0x06, 0x02, 0x00, 0x60, 0xfc, 0xde, 0x5a, 0xce, 0xb5, 0x8c, 0x78, 0x12, 0x00,
+    0x40, 0x00, 0x02, 0xc8, 0x00, 0x0f, 0x78, 0x05, 0x07, 0x00, 0x22, 0x23, 0x00, 0x6c, 0x25, 0x01,
+    0x02, 0x00, 0x00, 0xb0, 0x00, 0xc5, 0x63, 0xb0, 0x73, 0x32, 0x84, 0xb4, 0x94, 0x19, 0xbe, 0x7a,
+    0xce, 0x5a, 0x02, 0x00, 0x80, 0x7a, 0xce, 0x59, 0xc6, 0x56, 0xa5, 0x32, 0x7c, 0x78, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x38, 0x1d, 0x01, 0xb6, 0x00, 0x01, 0x02, 0x00, 0x00, 0x1c, 0x17, 0x6a, 0xed,
+    0x5a, 0xaf, 0x73, 0x73, 0x8c, 0x32, 0x08, 0x90, 0x5a, 0xc6, 0xd5, 0x8c, 0x94, 0x8c, 0x94, 0x84,
+    0x74, 0xfe, 0x0c, 0x11, 0x73, 0x6c, 0x01, 0x01, 0xd0, 0x00, 0x00, 0x7a, 0x11, 0x00, 0x26, 0x0a,
+    0x01, 0xc4, 0x01, 0x2b, 0x52, 0x6f, 0xa8, 0x1f, 0x0a, 0x02, 0x00, 0x20, 0x5a, 0xce, 0xea, 0x0a,
+    0x00, 0xc8, 0x00, 0x3d, 0xb1, 0x63, 0x32, 0xc4, 0x24, 0x08, 0x02, 0x00, 0x13, 0x53, 0x9e, 0x00,
+    0x00, 0x02, 0x00, 0x4f, 0x6f, 0x63, 0xf0, 0x83, 0x5e, 0x07, 0x07, 0x60, 0xdb, 0xde, 0x12, 0x74,
+    0x91, 0x63, 0x62, 0x0a, 0x00, 0x40, 0x06, 0x00, 0xc2, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x0e, 0x53,
+    0xac, 0x52, 0xd0, 0x38, 0x00, 0x08, 0x00, 0x44, 0x0d, 0x20, 0x74, 0x84, 0xc6, 0x14, 0x02, 0x02,
+    0x00, 0x00, 0x7c, 0x0b, 0x00, 0xc8, 0x00, 0x02, 0x8a, 0x02, 0x1f, 0x73, 0x34, 0x0c, 0x0a, 0x00,
+    0x74, 0x00, 0x02, 0xc6, 0x00, 0x0f, 0xb8, 0x23, 0x0d, 0x00, 0x1e, 0x1f, 0x00, 0xf2, 0x18, 0x00,
+    0xc8, 0x00, 0x2f, 0x11, 0x7c, 0x8e, 0x00, 0x09, 0x00, 0xf4, 0x00, 0x00, 0xf4, 0x02, 0x00, 0xe8,
+    0x0b, 0x08, 0xc8, 0x00, 0x3f, 0xed, 0x52, 0x6e, 0x2a, 0x0a, 0x0e, 0x31, 0xfc, 0xde, 0x74, 0x3c,
+    0x00, 0x02, 0x02, 0x00, 0x00, 0x92, 0x03, 0x01, 0x8e, 0x01, 0x4f, 0x4a, 0x0d, 0x4b, 0x72, 0xc8,
+    0x00, 0x0a, 0x40, 0x1c, 0xe7, 0xb4, 0x8c, 0x7a, 0x07, 0x24, 0x70, 0x5b, 0x1e, 0x03, 0x44, 0x9b,
+    0xd6, 0x16, 0x9d, 0x1a, 0x0a, 0x00, 0x02, 0x00, 0x15, 0x5a, 0xce, 0x01, 0x50, 0x15, 0x9d, 0x70,
+    0x5b, 0x50, 0xbc, 0x1c, 0x0f, 0x7a, 0x10, 0x0e, 0x00, 0x30, 0x11, 0x00, 0xc8, 0x00, 0x00, 0x96,
+    0x08, 0x00, 0xc2, 0x00, 0x00, 0x02, 0x00, 0x20, 0x0e, 0x4b, 0x94, 0x15, 0x00, 0x1e, 0x00, 0x0f,
+    0x02, 0x00, 0x0b, 0x20, 0x39, 0xc6, 0x7c, 0x0e, 0x00, 0xc6, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xdc,
+    0x16, 0x00, 0x10, 0x1f, 0x2f, 0x0d, 0x4b, 0x86, 0x04, 0x0b, 0x00, 0x02, 0x01, 0x20, 0x33, 0x74,
+    0x34, 0x09, 0x22, 0x12, 0x74, 0xbe, 0x00, 0x00, 0xaa, 0x08, 0x40, 0x74, 0x84, 0xb8, 0xad, 0x02,
+    0x00, 0x73, 0xd8, 0xb5, 0xb5, 0x8c, 0x13, 0x74, 0x53, 0x08, 0x09, 0x6f, 0x37, 0x9d, 0xd2, 0x6b,
+    0x2f, 0x53, 0x82, 0x0c, 0x0f, 0x00, 0x7c, 0x0a, 0x00, 0x46, 0x27, 0x00, 0xde, 0x02, 0x00, 0xc2,
+    0x00, 0x02, 0x02, 0x00, 0x00, 0xc8, 0x00, 0x15, 0x93, 0x54, 0x0b, 0x0f, 0x02, 0x00, 0x07, 0x31,
+    0xbb, 0xd6, 0xd2, 0xf2, 0x25, 0x00, 0x02, 0x00, 0x00, 0x28, 0x02, 0x11, 0x2f, 0x8e, 0x1d, 0x3f,
+    0x0d, 0x4b, 0x8f, 0x6e, 0x08, 0x0a, 0x00, 0x02, 0x00, 0x20, 0x9b, 0xd6, 0x90, 0x01, 0x80, 0xd1,
+    0x6b, 0x74, 0x84, 0xf5, 0x94, 0x33, 0x7c, 0x3a, 0x02, 0x00, 0x2c, 0x26, 0x00, 0x48, 0x00, 0x00,
+    0x0a, 0x0e, 0x00, 0x82, 0x01, 0x80, 0x12, 0x74, 0x36, 0x9d, 0x36, 0x9d, 0x95, 0x84, 0x28, 0x00,
+    0x0e, 0x9c, 0x15, 0x0c, 0x02, 0x00, 0x20, 0xd5, 0x8c, 0x3a, 0x00, 0x20, 0xf3, 0x73, 0x9c, 0x1f,
+    0x00, 0xc2, 0x00, 0x02, 0x02, 0x00, 0x3f, 0xed, 0x4a, 0x4f, 0xc0, 0x09, 0x0a, 0x04, 0x02, 0x00,
+    0x00, 0x10, 0x0e, 0x00, 0x80, 0x0b, 0x00, 0x02, 0x00, 0x00, 0xd4, 0x01, 0x01, 0x9e, 0x16, 0x10,
+    0x4b, 0x68, 0x17, 0x0f, 0xbe, 0x03, 0x09, 0x02, 0x02, 0x00, 0x00, 0xcc, 0x01, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x04, 0x03, 0x00, 0x02, 0x00, 0x00, 0x46, 0x09, 0x00,
+    0x06, 0x00, 0x00, 0xe6, 0x00, 0x01, 0x16, 0x18, 0x1f, 0x6b, 0x6c, 0x10, 0x11, 0x00, 0x8e, 0x0e,
+    0x00, 0x34, 0x05, 0x0b, 0xc8, 0x00, 0x3f, 0x52, 0xb0, 0x6b, 0x8a, 0x00, 0x0f, 0x00, 0x02, 0x00,
+    0x20, 0xb5, 0x8c, 0x7c, 0x04, 0x00, 0x90, 0x00, 0x00, 0x10, 0x01, 0x15, 0x6f, 0xea, 0x03, 0x0f,
+    0xaa, 0x22, 0x11, 0x20, 0x36, 0x9d, 0xce, 0x02, 0x10, 0xd1, 0xce, 0x0e, 0x01, 0x02, 0x00, 0x04,
+    0xb8, 0x05, 0x02, 0x02, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x40, 0x1b, 0x1f, 0x56, 0x42, 0x0d, 0x0e,
+    0x00, 0xa8, 0x02, 0x00, 0xc6, 0x00, 0x00, 0xc8, 0x00, 0x18, 0x90, 0x56, 0x02, 0x5f, 0x53, 0xed,
+    0x4a, 0x6f, 0x5b, 0x06, 0x01, 0x11, 0x40, 0x1c, 0xe7, 0xb4, 0x84, 0xc8, 0x00, 0x00, 0x56, 0x01,
+    0x00, 0xcc, 0x00, 0x00, 0x22, 0x03, 0x00, 0x90, 0x01, 0x2f, 0xcd, 0x4a, 0x22, 0x03, 0x0d, 0x02,
+    0x02, 0x00, 0x31, 0x9a, 0xce, 0x32, 0x46, 0x0e, 0x00, 0x56, 0x02, 0x06, 0x92, 0x01, 0x03, 0x02,
+    0x00, 0x01, 0xa8, 0x2b, 0x1f, 0x5a, 0x86, 0x00, 0x12, 0x20, 0x16, 0x95, 0x80, 0x0b, 0x11, 0x33,
+    0xfc, 0x05, 0x00, 0xc2, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x0e, 0x53, 0xd0, 0x6b,
+    0x9a, 0x44, 0x00, 0x0e, 0x20, 0xf9, 0xbd, 0x86, 0x01, 0x00, 0xc8, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x22, 0x02, 0x20, 0x4f, 0x5b, 0x20, 0x03, 0x00, 0x82, 0x20, 0x20, 0xf5, 0x9c, 0x22, 0x00, 0x0f,
+    0x02, 0x00, 0x0f, 0x40, 0xd8, 0xb5, 0x33, 0x7c, 0x28, 0x08, 0x01, 0xbc, 0x00, 0x03, 0x02, 0x00,
+    0x20, 0x70, 0x5b, 0xb4, 0x07, 0x1f, 0xf1, 0xa4, 0x04, 0x0e, 0x02, 0x02, 0x00, 0x00, 0x38, 0x05,
+    0x00, 0xc6, 0x00, 0x00, 0xb2, 0x04, 0x00, 0xc0, 0x00, 0x02, 0x02, 0x00, 0x00, 0xc4, 0x00, 0x00,
+    0xd0, 0x06, 0x00, 0x8e, 0x00, 0x3f, 0x8f, 0x63, 0x39, 0x62, 0x03, 0x06, 0x40, 0x19, 0xbe, 0x53,
+    0x7c, 0xdc, 0x10, 0x06, 0x02, 0x00, 0x00, 0xca, 0x00, 0x00, 0x8c, 0x1f, 0x00, 0xf0, 0x1f, 0x1f,
+    0xed, 0x92, 0x01, 0x14, 0x02, 0x02, 0x00, 0x20, 0x9b, 0xd6, 0x62, 0x02, 0x00, 0xc2, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x94, 0x07, 0x3f, 0x63, 0xf1, 0x7b, 0xc6, 0x00, 0x13, 0x02, 0x44, 0x20, 0x00,
+    0xc6, 0x00, 0x00, 0x08, 0x0c, 0x00, 0xba, 0x00, 0x04, 0xc4, 0x00, 0x02, 0x02, 0x00, 0x00, 0xc8,
+    0x00, 0x20, 0xed, 0x4a, 0xdc, 0x0e, 0x00, 0x2c, 0x00, 0x0a, 0x02, 0x00, 0x20, 0xdb, 0xde, 0x2a,
+    0x10, 0x00, 0x82, 0x23, 0x00, 0xc0, 0x00, 0x06, 0x02, 0x00, 0x00, 0x6a, 0x08, 0x00, 0x6e, 0x11,
+    0x00, 0xc8, 0x00, 0x2a, 0x6f, 0x5b, 0x0a, 0x08, 0x0f, 0x02, 0x00, 0x0b, 0x20, 0x73, 0x84, 0xc0,
+    0x00, 0x00, 0xc6, 0x00, 0x00, 0x1e, 0x0f, 0x3f, 0x2e, 0x5b, 0xaf, 0x8c, 0x01, 0x14, 0x00, 0x6c,
+    0x04, 0x00, 0x8e, 0x01, 0x00, 0xa0, 0x0e, 0x08, 0xe4, 0x03, 0x00, 0x84, 0x00, 0x00, 0xd4, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x5a, 0x01, 0x4c, 0xcd, 0x42, 0xcd, 0x42, 0x60, 0x02, 0x02, 0x7c, 0x12,
+    0x02, 0xc4, 0x00, 0x00, 0xd8, 0x02, 0x04, 0x02, 0x00, 0x02, 0x10, 0x00, 0x01, 0x0e, 0x07, 0x01,
+    0x4c, 0x00, 0x13, 0x11, 0xe6, 0x06, 0x0f, 0x02, 0x00, 0x11, 0x25, 0xb4, 0x8c, 0xc8, 0x00, 0x6f,
+    0x5b, 0x2f, 0x5b, 0x4f, 0x6b, 0x76, 0x28, 0x04, 0x10, 0x02, 0x02, 0x00, 0x22, 0xb5, 0x84, 0xd0,
+    0x14, 0x00, 0xaa, 0x0c, 0x02, 0x78, 0x00, 0x00, 0x02, 0x00, 0x01, 0xbe, 0x00, 0x02, 0x02, 0x00,
+    0x01, 0x32, 0x24, 0x00, 0x94, 0x01, 0x1b, 0xb3, 0x9e, 0x07, 0x00, 0x70, 0x0b, 0x00, 0xb8, 0x00,
+    0x0f, 0x02, 0x00, 0x01, 0x33, 0xd1, 0x6b, 0xb0, 0x18, 0x08, 0x00, 0x92, 0x13, 0x0f, 0x96, 0x02,
+    0x07, 0x0c, 0x02, 0x00, 0x03, 0xc8, 0x00, 0x01, 0xba, 0x0e, 0x3f, 0x4f, 0x5b, 0x90, 0x04, 0x02,
+    0x00, 0x0f, 0x02, 0x00, 0x03, 0x02, 0x8e, 0x19, 0x30, 0x74, 0x7c, 0x34, 0x5c, 0x16, 0x03, 0x40,
+    0x01, 0x00, 0x7c, 0x00, 0x05, 0x02, 0x00, 0x00, 0xc6, 0x00, 0x10, 0x4b, 0x44, 0x05, 0x2c, 0x0e,
+    0x53, 0x4c, 0x2e, 0x20, 0x33, 0x7c, 0xb2, 0x00, 0x0f, 0x02, 0x00, 0x07, 0x11, 0x90, 0x72, 0x0a,
+    0x00, 0x1e, 0x08, 0x1f, 0xb0, 0x70, 0x04, 0x14, 0x00, 0xd2, 0x12, 0x00, 0xc8, 0x00, 0x02, 0x02,
+    0x00, 0x1f, 0x4f, 0xee, 0x0e, 0x0c, 0x06, 0x02, 0x00, 0x11, 0xdc, 0x60, 0x16, 0x00, 0xdc, 0x15,
+    0x00, 0x94, 0x15, 0x00, 0xc2, 0x00, 0x0a, 0xc4, 0x00, 0x00, 0xce, 0x06, 0x00, 0x8e, 0x01, 0x00,
+    0xc8, 0x00, 0x2c, 0x4e, 0x5b, 0x8e, 0x19, 0x20, 0x9a, 0xce, 0x96, 0x03, 0x00, 0xb2, 0x00, 0x0f,
+    0x02, 0x00, 0x05, 0x00, 0x9c, 0x23, 0x00, 0x10, 0x0c, 0x4c, 0x0e, 0x53, 0x11, 0x74, 0x96, 0x02,
+    0x0f, 0x02, 0x00, 0x03, 0x0b, 0xc8, 0x00, 0x0f, 0x24, 0x04, 0x14, 0x20, 0xf6, 0x94, 0xec, 0x11,
+    0x00, 0xcc, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x8e, 0x01, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0xfe, 0x05, 0x52, 0x42, 0xcd, 0x42, 0xed, 0x42, 0xf6, 0x11, 0x2f, 0xed, 0x4a, 0x54, 0x00, 0x01,
+    0x00, 0x90, 0x11, 0x00, 0xb0, 0x00, 0x04, 0x02, 0x00, 0x02, 0x66, 0x12, 0x06, 0x02, 0x00, 0x00,
+    0x74, 0x0a, 0x04, 0x02, 0x00, 0x04, 0x0c, 0x0a, 0x0f, 0x02, 0x00, 0x0b, 0x0f, 0xc8, 0x00, 0x21,
+    0x00, 0x7a, 0x13, 0x00, 0xc6, 0x00, 0x02, 0xf8, 0x18, 0x0a, 0x8c, 0x01, 0x90, 0xed, 0x52, 0x4e,
+    0x5b, 0xb0, 0x63, 0xd0, 0x6b, 0x8f, 0xcc, 0x19, 0x5f, 0x4a, 0xcd, 0x4a, 0x4f, 0x5b, 0x68, 0x09,
+    0x01, 0x02, 0x76, 0x00, 0x00, 0xce, 0x02, 0x01, 0x08, 0x00, 0x10, 0x63, 0xb6, 0x0d, 0x00, 0xc0,
+    0x00, 0x06, 0x02, 0x00, 0x05, 0xca, 0x00, 0x3f, 0x53, 0x4f, 0x5b, 0xdc, 0x07, 0x11, 0x02, 0x52,
+    0x00, 0x02, 0x02, 0x00, 0x0f, 0x58, 0x02, 0x13, 0x00, 0x1e, 0x33, 0x00, 0xc6, 0x00, 0x01, 0xf6,
+    0x18, 0x00, 0xee, 0x05, 0x06, 0xc8, 0x00, 0xf0, 0x04, 0x4b, 0xcd, 0x4a, 0xed, 0x5a, 0x52, 0x8c,
+    0xdb, 0xde, 0xfc, 0xe6, 0x56, 0xa5, 0x52, 0x7c, 0x11, 0x74, 0xd0, 0x6b, 0x96, 0x0f, 0x0f, 0x02,
+    0x00, 0x01, 0x00, 0x92, 0x01, 0x00, 0xbc, 0x00, 0x00, 0x64, 0x24, 0x40, 0x73, 0x8c, 0x15, 0xa5,
+    0xca, 0x21, 0x04, 0x96, 0x01, 0x00, 0x18, 0x00, 0x00, 0x70, 0x12, 0x00, 0xc8, 0x00, 0x00, 0x84,
+    0x18, 0x1f, 0x90, 0x5c, 0x08, 0x10, 0x00, 0xc8, 0x00, 0x02, 0x8e, 0x14, 0x00, 0x38, 0x00, 0x0f,
+    0xc8, 0x00, 0x0f, 0x20, 0x99, 0xad, 0xc2, 0x00, 0x00, 0x64, 0x17, 0x20, 0x54, 0x7c, 0x76, 0x19,
+    0x08, 0xc6, 0x00, 0x5b, 0x0e, 0x4b, 0x2e, 0x5b, 0x55, 0xd4, 0x03, 0x0f, 0x02, 0x00, 0x07, 0x40,
+    0x77, 0xa5, 0xd8, 0xb5, 0x4e, 0x23, 0x00, 0xb8, 0x0f, 0x00, 0x68, 0x16, 0x20, 0x94, 0x84, 0xbc,
+    0x00, 0x01, 0x3a, 0x05, 0x03, 0x02, 0x00, 0x00, 0x94, 0x00, 0x00, 0x12, 0x00, 0x5f, 0x4f, 0x5b,
+    0xb0, 0x63, 0x16, 0xe4, 0x2c, 0x0c, 0x0f, 0xc8, 0x00, 0x1b, 0x20, 0xd9, 0xb5, 0x08, 0x29, 0x00,
+    0x66, 0x2b, 0x0f, 0x1a, 0x03, 0x01, 0x3f, 0xed, 0x52, 0xf0, 0x6a, 0x29, 0x28, 0x04, 0xa4, 0x01,
+    0x08, 0x02, 0x00, 0x00, 0x96, 0x00, 0x00, 0x14, 0x00, 0x00, 0x06, 0x00, 0x2f, 0x32, 0x7c, 0xf2,
+    0x03, 0x09, 0x20, 0x94, 0x84, 0xba, 0x01, 0x00, 0x28, 0x00, 0x00, 0x38, 0x10, 0x0f, 0xc8, 0x00,
+    0x09, 0x40, 0xfc, 0xde, 0xf7, 0x94, 0x08, 0x29, 0x00, 0x02, 0x00, 0x20, 0x75, 0x7c, 0xbc, 0x28,
+    0x0b, 0xc6, 0x00, 0x10, 0x4a, 0xdc, 0x28, 0x00, 0x2a, 0x00, 0x0f, 0x02, 0x00, 0x25, 0x20, 0x39,
+    0xc6, 0xc8, 0x04, 0x00, 0xc0, 0x00, 0x06, 0x02, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x68, 0x02, 0x00,
+    0x0c, 0x00, 0x26, 0x12, 0x74, 0xe8, 0x0d, 0x0c, 0x02, 0x00, 0x20, 0x93, 0x84, 0x88, 0x01, 0x00,
+    0xfe, 0x10, 0x0f, 0xc8, 0x00, 0x0b, 0x22, 0x5a, 0xc6, 0x80, 0x2e, 0x28, 0xd6, 0x8c, 0xc6, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x01, 0x4e, 0x09, 0x30, 0x5a, 0xf0, 0x83, 0x2a, 0x00, 0x0f,
+    0x02, 0x00, 0x29, 0x20, 0x77, 0xa5, 0xba, 0x00, 0x00, 0xb4, 0x00, 0x06, 0x02, 0x00, 0x02, 0x10,
+    0x00, 0x00, 0x38, 0x03, 0x4f, 0x70, 0x5b, 0xf2, 0x6b, 0xc8, 0x18, 0x05, 0x06, 0xc8, 0x00, 0x00,
+    0x56, 0x03, 0x0f, 0xc8, 0x00, 0x03, 0x40, 0xfc, 0xde, 0x57, 0x9d, 0x94, 0x2a, 0x73, 0x96, 0x84,
+    0xd7, 0x8c, 0xd7, 0x8c, 0x75, 0x52, 0x02, 0x00, 0xbe, 0x00, 0x00, 0x06, 0x00, 0x02, 0x02, 0x00,
+    0x5f, 0xcd, 0x4a, 0x4e, 0x63, 0x7a, 0x10, 0x09, 0x18, 0x0f, 0x02, 0x00, 0x03, 0x22, 0x19, 0xbe,
+    0x80, 0x01, 0x06, 0x02, 0x00, 0x04, 0x10, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xb6, 0x08, 0x00, 0x3c,
+    0x0d, 0x0f, 0xc0, 0x04, 0x01, 0x17, 0x94, 0xc8, 0x00, 0x1f, 0x2f, 0xc8, 0x00, 0x02, 0x13, 0x7a,
+    0xe2, 0x25, 0x11, 0xb6, 0x48, 0x2f, 0x02, 0x18, 0x03, 0x00, 0x00, 0x22, 0x00, 0xbe, 0x00, 0x05,
+    0x02, 0x00, 0x10, 0x4b, 0x62, 0x05, 0x0f, 0x9a, 0x09, 0x15, 0x0f, 0x02, 0x00, 0x07, 0x22, 0x73,
+    0x84, 0xe4, 0x02, 0x02, 0xbc, 0x00, 0x00, 0x08, 0x00, 0x02, 0x02, 0x00, 0x04, 0xc8, 0x00, 0x02,
+    0xe0, 0x0b, 0x00, 0xf4, 0x0c, 0x1b, 0x94, 0xe8, 0x1f, 0x02, 0x90, 0x01, 0x02, 0x02, 0x00, 0x2a,
+    0x2e, 0x53, 0x98, 0x08, 0x20, 0xbb, 0xd6, 0x46, 0x39, 0x00, 0x18, 0x25, 0x01, 0xc6, 0x00, 0x27,
+    0x84, 0x96, 0x6a, 0x05, 0x0c, 0xc8, 0x00, 0x00, 0x80, 0x08, 0x0f, 0xda, 0x0a, 0x01, 0x0f, 0x02,
+    0x00, 0x19, 0x20, 0xf8, 0xbd, 0x5a, 0x0f, 0x01, 0xb8, 0x00, 0x03, 0xdc, 0x03, 0x06, 0x02, 0x00,
+    0x00, 0x96, 0x05, 0x02, 0xc4, 0x00, 0x00, 0x70, 0x0d, 0x95, 0xd2, 0x63, 0xf2, 0x6b, 0x74, 0x7c,
+    0xf6, 0x94, 0x7a, 0x40, 0x1b, 0x20, 0x32, 0x7c, 0xc2, 0x00, 0x02, 0x02, 0x00, 0x00, 0xc8, 0x00,
+    0x02, 0x92, 0x0f, 0x91, 0xfc, 0xde, 0x19, 0xbe, 0xd6, 0x8c, 0x75, 0x84, 0x34, 0x1a, 0x25, 0x00,
+    0xc6, 0x00, 0x11, 0x96, 0x5c, 0x1e, 0x00, 0x84, 0x08, 0x00, 0xb8, 0x00, 0x02, 0x06, 0x00, 0x05,
+    0x02, 0x00, 0x00, 0x84, 0x08, 0x00, 0x76, 0x05, 0x14, 0x53, 0xae, 0x19, 0x0f, 0x02, 0x00, 0x21,
+    0x21, 0xdb, 0xde, 0xda, 0x0d, 0x01, 0xb6, 0x00, 0x0f, 0x02, 0x00, 0x01, 0x00, 0xdc, 0x00, 0x02,
+    0x4c, 0x10, 0x00, 0x82, 0x0e, 0x00, 0x84, 0x0e, 0x00, 0xb0, 0x0c, 0x80, 0x13, 0x74, 0xb5, 0x84,
+    0xf9, 0xb5, 0xf9, 0xbd, 0xca, 0x0d, 0x06, 0x02, 0x00, 0x60, 0x90, 0x63, 0x53, 0x7c, 0xd5, 0x8c,
+    0x46, 0x1e, 0x00, 0xe8, 0x0d, 0x31, 0x54, 0x74, 0x74, 0xf0, 0x06, 0x00, 0x2c, 0x06, 0x00, 0xa4,
+    0x0a, 0x10, 0x4e, 0xb4, 0x00, 0x0f, 0x8c, 0x01, 0x00, 0x01, 0x02, 0x00, 0x01, 0x94, 0x01, 0x00,
+    0xa4, 0x28, 0x00, 0x94, 0x00, 0x0f, 0x02, 0x00, 0x1f, 0x22, 0xfc, 0xde, 0x90, 0x2a, 0x0f, 0x02,
+    0x00, 0x0d, 0x00, 0x5e, 0x02, 0x02, 0xca, 0x00, 0x00, 0xfa, 0x0c, 0x02, 0x02, 0x00, 0x01, 0x94,
+    0x1b, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x9a, 0x09, 0x24, 0x91, 0x63, 0x24, 0x00, 0x00,
+    0x92, 0x0b, 0x00, 0x2e, 0x32, 0x00, 0xd6, 0x0a, 0x00, 0x92, 0x28, 0x06, 0xd4, 0x0a, 0x07, 0xc6,
+    0x00, 0x01, 0xbe, 0x00, 0x05, 0x02, 0x00, 0x5c, 0x53, 0x0e, 0x4b, 0xcc, 0x42, 0xa4, 0x0b, 0x0f,
+    0x02, 0x00, 0x15, 0x20, 0xf5, 0x94, 0x8a, 0x01, 0x00, 0x04, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x00,
+    0xc8, 0x03, 0x00, 0x64, 0x02, 0x02, 0x96, 0x01, 0x00, 0xc4, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x04,
+    0x0d, 0x00, 0x2e, 0x07, 0x02, 0x02, 0x00, 0x02, 0xc8, 0x00, 0x06, 0x40, 0x1d, 0x00, 0x20, 0x00,
+    0x00, 0x9c, 0x12, 0x02, 0x46, 0x0b, 0x02, 0x02, 0x00, 0x01, 0xbe, 0x00, 0x02, 0x02, 0x00, 0x01,
+    0x94, 0x0b, 0x00, 0x02, 0x00, 0x02, 0xc2, 0x00, 0x02, 0x06, 0x00, 0x3f, 0xac, 0x3a, 0xb0, 0x7a,
+    0x12, 0x0e, 0x0f, 0x02, 0x00, 0x03, 0x20, 0x73, 0x84, 0x4a, 0x09, 0x00, 0xac, 0x00, 0x08, 0x02,
+    0x00, 0x00, 0x98, 0x00, 0x00, 0x86, 0x04, 0x02, 0xc2, 0x00, 0x00, 0x02, 0x00, 0x04, 0x10, 0x00,
+    0x00, 0x64, 0x02, 0x40, 0xd1, 0x6b, 0x12, 0x6c, 0xca, 0x00, 0x00, 0x30, 0x02, 0x04, 0xc8, 0x00,
+    0x01, 0xfa, 0x17, 0x30, 0x5b, 0x91, 0x63, 0xe6, 0x00, 0x00, 0x54, 0x12, 0x20, 0xf2, 0x6b, 0x5a,
+    0x1b, 0x00, 0x38, 0x00, 0x00, 0xbe, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x01, 0xc2, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0xc4, 0x00, 0x21, 0x52, 0x2e, 0x0c, 0x0a, 0x01, 0xc4, 0x00, 0x01, 0xc6,
+    0x00, 0x00, 0xde, 0x0a, 0x0f, 0x22, 0x03, 0x25, 0x00, 0x1c, 0x2c, 0x26, 0x2f, 0x53, 0xb0, 0x00,
+    0x00, 0xc4, 0x00, 0x30, 0x2e, 0x5b, 0x6f, 0x30, 0x0a, 0x16, 0x53, 0x18, 0x00, 0x00, 0xc4, 0x00,
+    0x00, 0x06, 0x00, 0x02, 0x02, 0x00, 0x04, 0xce, 0x00, 0x00, 0x2a, 0x03, 0x00, 0x30, 0x00, 0x00,
+    0xc4, 0x00, 0x00, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x3e, 0x07, 0x00, 0x18,
+    0x00, 0x00, 0xb2, 0x00, 0x00, 0xbe, 0x00, 0x02, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x04, 0x02, 0x00,
+    0xc0, 0xed, 0x4a, 0x2e, 0x63, 0xd0, 0x7b, 0x39, 0xce, 0x9a, 0xd6, 0x11, 0x74, 0xbc, 0x0e, 0x02,
+    0xc6, 0x00, 0x3f, 0xcd, 0x42, 0xb0, 0x28, 0x17, 0x0a, 0x0f, 0x02, 0x00, 0x0b, 0x20, 0x73, 0x84,
+    0x5a, 0x15, 0x02, 0xc2, 0x00, 0x00, 0xbc, 0x00, 0xa0, 0x6f, 0x63, 0xb0, 0x7b, 0xd4, 0x9c, 0x15,
+    0x9d, 0x73, 0x84, 0x22, 0x0e, 0x00, 0x1a, 0x00, 0x06, 0xc2, 0x00, 0x07, 0x02, 0x00, 0x01, 0xa8,
+    0x0c, 0x04, 0x02, 0x00, 0x02, 0xc0, 0x18, 0x00, 0x02, 0x00, 0x00, 0x86, 0x0d, 0x0f, 0x02, 0x00,
+    0x01, 0x00, 0xbe, 0x00, 0x02, 0x02, 0x00, 0x00, 0x66, 0x13, 0x20, 0x4e, 0x63, 0xd6, 0x0a, 0x00,
+    0x7e, 0x00, 0x40, 0xfc, 0xe6, 0x32, 0x7c, 0x96, 0x01, 0x00, 0xcc, 0x00, 0x1f, 0xb0, 0x46, 0x3c,
+    0x2c, 0x00, 0x2c, 0x10, 0x00, 0x4e, 0x01, 0x00, 0xb4, 0x00, 0x35, 0xd0, 0x73, 0x93, 0xb8, 0x3f,
+    0x41, 0x39, 0xc6, 0x11, 0x74, 0xa2, 0x00, 0x01, 0xac, 0x00, 0x08, 0x02, 0x00, 0x00, 0x7e, 0x01,
+    0x06, 0x02, 0x00, 0x02, 0xc0, 0x00, 0x02, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x0c, 0x02, 0x00, 0x00,
+    0xbe, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x07, 0x4a, 0xcc, 0x52, 0x6f, 0x73, 0x48, 0x09, 0x8a,
+    0x7a, 0xce, 0x4e, 0x5b, 0xd0, 0x6b, 0x11, 0x7c, 0x16, 0x00, 0x0f, 0x02, 0x00, 0x21, 0x9d, 0x56,
+    0x9d, 0xb1, 0x6b, 0x4f, 0x5b, 0xd1, 0x6b, 0x93, 0x44, 0x38, 0x20, 0x73, 0x84, 0xf4, 0x05, 0x00,
+    0xbc, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x01, 0xc2, 0x00, 0x02, 0x02, 0x00, 0x00, 0xc4, 0x00, 0x0f,
+    0xc6, 0x00, 0x01, 0x00, 0xbe, 0x00, 0x07, 0x02, 0x00, 0x2f, 0x4b, 0xcc, 0x0e, 0x0a, 0x2e, 0x0f,
+    0x02, 0x00, 0x0b, 0x42, 0x19, 0xbe, 0xb7, 0xb5, 0xc4, 0x06, 0x0a, 0x02, 0x00, 0x20, 0x97, 0xad,
+    0x26, 0x0c, 0x01, 0xb6, 0x00, 0x0e, 0x02, 0x00, 0x01, 0xc2, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc4,
+    0x00, 0x0f, 0xc6, 0x00, 0x01, 0x0c, 0xc8, 0x00, 0x5f, 0x0d, 0x4b, 0xed, 0x52, 0xb3, 0xe0, 0x0d,
+    0x00, 0x0f, 0x02, 0x00, 0x4f, 0x00, 0x08, 0x04, 0x00, 0x42, 0x11, 0x01, 0xb8, 0x00, 0x02, 0x02,
+    0x00, 0x01, 0xb4, 0x00, 0x0c, 0x02, 0x00, 0x00, 0xb4, 0x00, 0x08, 0x02, 0x00, 0x00, 0xb6, 0x00,
+    0x01, 0x86, 0x04, 0x09, 0x02, 0x00, 0x00, 0x7e, 0x08, 0x0f, 0xea, 0x06, 0x25, 0x0f, 0x02, 0x00,
+    0x2b, 0x00, 0x78, 0x08, 0x00, 0x44, 0x11, 0x02, 0x14, 0x03, 0x04, 0xc8, 0x00, 0x00, 0x04, 0x00,
+    0x04, 0x02, 0x00, 0x00, 0xb6, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x08, 0x03, 0x00, 0x04, 0x00, 0x01,
+    0x1e, 0x06, 0x01, 0xc0, 0x00, 0x01, 0x02, 0x00, 0x01, 0xd2, 0x17, 0x3f, 0x0e, 0x4b, 0x35, 0x9a,
+    0x0d, 0x0c, 0x0f, 0x02, 0x00, 0x43, 0x01, 0x02, 0x04, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x8a, 0x29, 0x53, 0xed, 0x52, 0x6f, 0x63, 0xd0, 0xf0, 0x12, 0x06, 0xe4, 0x06, 0x02, 0x02, 0x00,
+    0x00, 0xb2, 0x00, 0x00, 0x2c, 0x10, 0xa0, 0x8f, 0x6b, 0xd0, 0x73, 0x52, 0x84, 0x73, 0x84, 0x6f,
+    0x63, 0x1c, 0x22, 0x02, 0xc6, 0x00, 0x01, 0x58, 0x02, 0x1e, 0x4a, 0xbc, 0x23, 0x0f, 0x02, 0x00,
+    0x4f, 0x20, 0xdb, 0xde, 0x06, 0x06, 0x06, 0xc6, 0x00, 0x00, 0x5e, 0x08, 0x60, 0xed, 0x5a, 0xd0,
+    0x7b, 0x7a, 0xd6, 0xd2, 0x1d, 0x20, 0x97, 0xad, 0x04, 0x04, 0x08, 0x02, 0x00, 0x00, 0xc4, 0x00,
+    0x00, 0x7a, 0x36, 0x42, 0x9a, 0xd6, 0xfb, 0xde, 0x58, 0x05, 0x22, 0x18, 0xbe, 0x86, 0x01, 0x01,
+    0x02, 0x00, 0x00, 0xa0, 0x0b, 0x3f, 0x42, 0xb0, 0x63, 0x78, 0x15, 0x19, 0x0f, 0x02, 0x00, 0x33,
+    0x20, 0xd4, 0x8c, 0x80, 0x01, 0x00, 0xc6, 0x00, 0x00, 0x42, 0x02, 0x00, 0x44, 0x02, 0x00, 0xc0,
+    0x2f, 0x06, 0x18, 0x13, 0x15, 0xd0, 0xd8, 0x0d, 0x02, 0x02, 0x00, 0x00, 0xa6, 0x07, 0x1b, 0xd0,
+    0x64, 0x0f, 0x23, 0x32, 0x74, 0x60, 0x02, 0x01, 0x58, 0x02, 0x00, 0x40, 0x16, 0x1f, 0x35, 0x22,
+    0x03, 0x5e, 0x20, 0xd8, 0xb5, 0x9c, 0x00, 0x00, 0x20, 0x03, 0x00, 0x02, 0x00, 0x00, 0xb4, 0x00,
+    0x28, 0x6f, 0x63, 0x58, 0x2b, 0x33, 0x32, 0x74, 0x4f, 0xa2, 0x29, 0x00, 0x1c, 0x00, 0x00, 0xc8,
+    0x03, 0x2c, 0x2e, 0x63, 0xe2, 0x28, 0x60, 0x59, 0xc6, 0x2e, 0x53, 0xcd, 0x42, 0xc6, 0x00, 0x00,
+    0xd0, 0x00, 0x00, 0xb4, 0x07, 0x02, 0xaa, 0x01, 0x0f, 0x02, 0x00, 0x5b, 0x41, 0x52, 0x7c, 0x6f,
+    0x5b, 0xbe, 0x39, 0x10, 0x4b, 0xd4, 0x38, 0x2a, 0x2e, 0x5b, 0x50, 0x12, 0x40, 0x93, 0x8c, 0x6f,
+    0x5b, 0x6c, 0x01, 0x02, 0xc6, 0x00, 0x00, 0xaa, 0x00, 0x11, 0x6f, 0x60, 0x24, 0x0a, 0x02, 0x00,
+    0x60, 0x12, 0x74, 0xcd, 0x42, 0xac, 0x42, 0x28, 0x03, 0x3f, 0x4f, 0x5b, 0xf1, 0xf6, 0x36, 0x02,
+    0x0f, 0x02, 0x00, 0x51, 0x51, 0x59, 0xc6, 0x52, 0x7c, 0xd1, 0x02, 0x0d, 0x3b, 0x6f, 0x5b, 0x52,
+    0x0e, 0x0e, 0x22, 0xf5, 0x94, 0xc8, 0x00, 0x00, 0x02, 0x00, 0x00, 0xd2, 0x1a, 0x00, 0xd0, 0x38,
+    0x00, 0x18, 0x00, 0x0a, 0x02, 0x00, 0xaf, 0xdb, 0xde, 0x52, 0x7c, 0xb0, 0x6b, 0x12, 0x74, 0xb3,
+    0x8c, 0xc4, 0x00, 0x65, 0x06, 0x02, 0x00, 0x4e, 0x15, 0x9d, 0x11, 0x74, 0xa0, 0x03, 0x60, 0x56,
+    0x9d, 0x4f, 0x5b, 0xcd, 0x42, 0xca, 0x1a, 0x00, 0xcc, 0x03, 0x00, 0xd2, 0x00, 0x1f, 0xd0, 0x1a,
+    0x15, 0x12, 0x0f, 0x02, 0x00, 0x7f, 0x20, 0x8f, 0x63, 0x78, 0x1f, 0x00, 0x02, 0x00, 0x0f, 0x8e,
+    0x15, 0x07, 0x0f, 0x02, 0x00, 0x91, 0x60, 0xd8, 0xb5, 0x11, 0x74, 0x52, 0x7c, 0x02, 0x00, 0x4f,
+    0x32, 0x7c, 0xd0, 0x6b, 0x1c, 0x06, 0x61, 0x0f, 0x02, 0x00, 0x9a, 0x50, 0xe7, 0x1c, 0xe7, 0x1c,
+    0xe7,
+};
+
+const lv_image_dsc_t test_image_cogwheel_rgb565_lz4 = {
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.always_zero = 0,
+    .header.compress = LV_IMAGE_COMPRESS_LZ4,
+    .header.w = 100,
+    .header.h = 100,
+    .data_size = 7249,
+    .data = test_image_cogwheel_rgb565_lz4_map,
+};
@@ -0,0 +1,550 @@
+#include "../../../lvgl.h"
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_RGB565_RLE
+    #define LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_RGB565_RLE
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_TEST_IMAGE_COGWHEEL_RGB565_RLE uint8_t
+test_image_cogwheel_rgb565_rle_map[] = {
+    /*RLE compressed, 20000 bytes decompressed*/
+    0xad, 0x1c, 0xe7, 0x01, 0xf6, 0x94, 0x13, 0x74, 0x82, 0xf2, 0x6b, 0x02, 0xb2, 0x63, 0x33, 0x74,
+    0xbb, 0xd6, 0xdb, 0x1c, 0xe7, 0x00, 0x74, 0x7c, 0x81, 0xd2, 0x6b, 0x04, 0xf2, 0x6b, 0xd2, 0x6b,
+    0xb2, 0x63, 0xd2, 0x6b, 0x74, 0x84, 0xdb, 0x1c, 0xe7, 0x01, 0x33, 0x7c, 0xd2, 0x6b, 0x82, 0x13,
+    0x74, 0x02, 0xf2, 0x6b, 0xd2, 0x63, 0x13, 0x74, 0x88, 0x1c, 0xe7, 0x02, 0xbb, 0xd6, 0x36, 0x9d,
+    0xfc, 0xe6, 0xc1, 0x1c, 0xe7, 0x02, 0xf6, 0x8c, 0x34, 0x74, 0xf9, 0xb5, 0x89, 0x1c, 0xe7, 0x02,
+    0xfc, 0xde, 0x54, 0x7c, 0xf2, 0x6b, 0x82, 0x13, 0x74, 0x03, 0x12, 0x74, 0xd2, 0x6b, 0x13, 0x74,
+    0xfc, 0xe6, 0x86, 0x1c, 0xe7, 0x00, 0xbb, 0xd6, 0x81, 0xb1, 0x63, 0x03, 0x90, 0x63, 0x12, 0x74,
+    0xf5, 0x94, 0xfc, 0xe6, 0xbb, 0x1c, 0xe7, 0x06, 0x7b, 0xce, 0xd6, 0x8c, 0x95, 0x84, 0x74, 0x7c,
+    0x34, 0x74, 0x54, 0x7c, 0x3a, 0xc6, 0x88, 0x1c, 0xe7, 0x02, 0x3a, 0xc6, 0x54, 0x7c, 0xf2, 0x6b,
+    0x82, 0x13, 0x74, 0x03, 0x12, 0x74, 0xf2, 0x6b, 0x12, 0x74, 0xb4, 0x8c, 0x86, 0x1c, 0xe7, 0x01,
+    0x74, 0x84, 0x90, 0x5b, 0x81, 0x90, 0x63, 0x03, 0xb1, 0x63, 0xd1, 0x6b, 0x12, 0x74, 0x94, 0x84,
+    0xb9, 0x1c, 0xe7, 0x01, 0x1a, 0xbe, 0x75, 0x7c, 0x81, 0x34, 0x74, 0x03, 0x54, 0x7c, 0x74, 0x7c,
+    0x33, 0x74, 0x95, 0x84, 0x88, 0x1c, 0xe7, 0x02, 0xf6, 0x94, 0x33, 0x74, 0xf3, 0x6b, 0x82, 0x13,
+    0x74, 0x03, 0x12, 0x74, 0xf2, 0x6b, 0xf2, 0x73, 0x32, 0x7c, 0x85, 0x1c, 0xe7, 0x01, 0x77, 0xa5,
+    0xd1, 0x6b, 0x83, 0xb1, 0x63, 0x02, 0x90, 0x5b, 0x50, 0x5b, 0x90, 0x63, 0xb9, 0x1c, 0xe7, 0x02,
+    0xd6, 0x8c, 0x34, 0x74, 0x55, 0x7c, 0x82, 0x74, 0x7c, 0x02, 0x34, 0x74, 0x54, 0x7c, 0x7a, 0xce,
+    0x87, 0x1c, 0xe7, 0x01, 0x95, 0x84, 0x33, 0x74, 0x84, 0x13, 0x74, 0x81, 0xf2, 0x6b, 0x00, 0x12,
+    0x7c, 0x85, 0x1c, 0xe7, 0x03, 0x33, 0x74, 0x91, 0x5b, 0xd1, 0x6b, 0xd1, 0x63, 0x82, 0xb1, 0x63,
+    0x02, 0x70, 0x5b, 0x90, 0x63, 0xbb, 0xd6, 0xb8, 0x1c, 0xe7, 0x01, 0x78, 0xa5, 0x54, 0x7c, 0x81,
+    0x75, 0x7c, 0x81, 0x74, 0x7c, 0x03, 0x54, 0x7c, 0x54, 0x74, 0x54, 0x7c, 0xfc, 0xe6, 0x86, 0x1c,
+    0xe7, 0x00, 0x74, 0x84, 0x85, 0x13, 0x74, 0x03, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x73, 0xdb, 0xde,
+    0x83, 0x1c, 0xe7, 0x04, 0x5a, 0xce, 0xf2, 0x6b, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x63, 0x82, 0xb1,
+    0x63, 0x02, 0x90, 0x63, 0xd1, 0x6b, 0x76, 0xad, 0xb8, 0x1c, 0xe7, 0x03, 0xf9, 0xb5, 0x75, 0x7c,
+    0x55, 0x7c, 0x75, 0x7c, 0x81, 0x74, 0x7c, 0x81, 0x54, 0x7c, 0x01, 0x13, 0x74, 0x98, 0xad, 0x84,
+    0x1c, 0xe7, 0x02, 0xfc, 0xe6, 0x5a, 0xc6, 0x33, 0x74, 0x85, 0x13, 0x74, 0x00, 0xf2, 0x73, 0x81,
+    0xf2, 0x6b, 0x01, 0x53, 0x84, 0xdb, 0xde, 0x81, 0x1c, 0xe7, 0x05, 0xfc, 0xde, 0x12, 0x74, 0xb1,
+    0x63, 0xd2, 0x6b, 0xd1, 0x6b, 0xb1, 0x6b, 0x82, 0xb1, 0x63, 0x02, 0x90, 0x63, 0xd1, 0x6b, 0x36,
+    0xa5, 0xb8, 0x1c, 0xe7, 0x00, 0xb9, 0xad, 0x81, 0x74, 0x7c, 0x81, 0x75, 0x7c, 0x00, 0x74, 0x7c,
+    0x82, 0x54, 0x7c, 0x01, 0x74, 0x7c, 0xd9, 0xb5, 0x81, 0xdb, 0xde, 0x03, 0xbb, 0xd6, 0xf9, 0xbd,
+    0xb5, 0x84, 0x33, 0x74, 0x86, 0x13, 0x74, 0x07, 0xf2, 0x73, 0xf2, 0x6b, 0x12, 0x74, 0xf2, 0x6b,
+    0x54, 0x7c, 0xd8, 0xb5, 0x9b, 0xd6, 0x94, 0x84, 0x81, 0xb1, 0x63, 0x00, 0xd2, 0x6b, 0x81, 0xd1,
+    0x6b, 0x82, 0xb1, 0x63, 0x02, 0x90, 0x63, 0xd1, 0x73, 0x97, 0xb5, 0xb8, 0x1c, 0xe7, 0x02, 0x9b,
+    0xce, 0x95, 0x84, 0x54, 0x7c, 0x81, 0x75, 0x7c, 0x00, 0x74, 0x7c, 0x83, 0x54, 0x7c, 0x00, 0x34,
+    0x74, 0x81, 0x54, 0x7c, 0x03, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x7c, 0x86, 0x13, 0x74,
+    0x01, 0x12, 0x74, 0xf2, 0x73, 0x82, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x02, 0xd1, 0x63, 0xf2, 0x6b,
+    0xd2, 0x6b, 0x83, 0xd1, 0x6b, 0x81, 0xb1, 0x63, 0x02, 0x90, 0x63, 0xd1, 0x73, 0xfc, 0xde, 0xb9,
+    0x1c, 0xe7, 0x00, 0x57, 0xa5, 0x82, 0x75, 0x7c, 0x00, 0x74, 0x7c, 0x87, 0x54, 0x7c, 0x83, 0x33,
+    0x74, 0x85, 0x13, 0x74, 0x81, 0x12, 0x74, 0x81, 0xf2, 0x6b, 0x00, 0xd2, 0x6b, 0x81, 0xf2, 0x6b,
+    0x83, 0xd2, 0x6b, 0x81, 0xd1, 0x6b, 0x00, 0xb1, 0x6b, 0x81, 0xb1, 0x63, 0x01, 0xb0, 0x63, 0x11,
+    0x84, 0x89, 0x1c, 0xe7, 0x01, 0xd8, 0xb5, 0xfc, 0xe6, 0xae, 0x1c, 0xe7, 0x03, 0x7b, 0xce, 0x95,
+    0x84, 0x54, 0x7c, 0x75, 0x7c, 0x81, 0x74, 0x7c, 0x84, 0x54, 0x7c, 0x81, 0x54, 0x74, 0x83, 0x33,
+    0x74, 0x85, 0x13, 0x74, 0x81, 0x12, 0x74, 0x84, 0xf2, 0x6b, 0x83, 0xd2, 0x6b, 0x82, 0xd1, 0x6b,
+    0x82, 0xb1, 0x63, 0x00, 0x11, 0x7c, 0x87, 0x1c, 0xe7, 0x04, 0x39, 0xc6, 0x53, 0x7c, 0xb1, 0x63,
+    0xf1, 0x6b, 0x19, 0xbe, 0xa0, 0x1c, 0xe7, 0x02, 0x1a, 0xbe, 0x17, 0x95, 0x38, 0x9d, 0x89, 0x1c,
+    0xe7, 0x03, 0x98, 0xad, 0x75, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x81, 0x74, 0x7c, 0x83, 0x54, 0x7c,
+    0x01, 0x54, 0x74, 0x34, 0x74, 0x84, 0x33, 0x74, 0x85, 0x13, 0x74, 0x81, 0x12, 0x74, 0x84, 0xf2,
+    0x6b, 0x82, 0xd2, 0x6b, 0x83, 0xd1, 0x6b, 0x81, 0xb1, 0x63, 0x02, 0x90, 0x63, 0xd1, 0x6b, 0x19,
+    0xc6, 0x85, 0x1c, 0xe7, 0x06, 0xf5, 0x94, 0xd1, 0x6b, 0x4f, 0x5b, 0xf1, 0x6b, 0x0f, 0x53, 0xb0,
+    0x63, 0x97, 0xad, 0x9e, 0x1c, 0xe7, 0x05, 0xb9, 0xad, 0xd6, 0x8c, 0x75, 0x7c, 0x96, 0x84, 0xd6,
+    0x8c, 0xfc, 0xde, 0x86, 0x1c, 0xe7, 0x00, 0x3a, 0xc6, 0x82, 0x75, 0x7c, 0x81, 0x74, 0x7c, 0x85,
+    0x54, 0x7c, 0x00, 0x54, 0x74, 0x81, 0x54, 0x7c, 0x81, 0x33, 0x74, 0x86, 0x13, 0x74, 0x81, 0xf2,
+    0x73, 0x85, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x82, 0xd1, 0x6b, 0x82, 0xb1, 0x63, 0x03, 0xd1, 0x6b,
+    0x90, 0x63, 0x12, 0x74, 0x19, 0xbe, 0x83, 0x1c, 0xe7, 0x02, 0x73, 0x7c, 0x90, 0x63, 0x4f, 0x5b,
+    0x81, 0x70, 0x5b, 0x03, 0x90, 0x63, 0x2f, 0x53, 0x90, 0x63, 0x36, 0x9d, 0x9c, 0x1c, 0xe7, 0x07,
+    0xd9, 0xad, 0xd6, 0x8c, 0x96, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x76, 0x84, 0xb6, 0x84, 0x1a, 0xbe,
+    0x83, 0x1c, 0xe7, 0x01, 0x9b, 0xce, 0xd6, 0x8c, 0x81, 0x75, 0x7c, 0x00, 0x95, 0x84, 0x81, 0x75,
+    0x7c, 0x00, 0x74, 0x7c, 0x85, 0x54, 0x7c, 0x03, 0x54, 0x74, 0x34, 0x74, 0x33, 0x74, 0x13, 0x74,
+    0x81, 0xf2, 0x6b, 0x85, 0x13, 0x74, 0x01, 0xf2, 0x73, 0xd2, 0x6b, 0x81, 0xd1, 0x6b, 0x00, 0xd2,
+    0x6b, 0x82, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x82, 0xd1, 0x6b, 0x84, 0xb1, 0x63, 0x07, 0x90, 0x63,
+    0xb1, 0x63, 0xf2, 0x73, 0xbb, 0xd6, 0xfc, 0xe6, 0x12, 0x74, 0x90, 0x63, 0x4f, 0x5b, 0x81, 0x90,
+    0x63, 0x05, 0x90, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x2e, 0x53, 0x90, 0x63, 0xd8, 0xb5, 0x9a, 0x1c,
+    0xe7, 0x03, 0x3a, 0xc6, 0xd7, 0x8c, 0x96, 0x84, 0xb6, 0x8c, 0x81, 0xb6, 0x84, 0x81, 0x96, 0x84,
+    0x01, 0xb6, 0x84, 0x98, 0xad, 0x81, 0x1c, 0xe7, 0x01, 0x7b, 0xce, 0xd6, 0x8c, 0x81, 0x75, 0x7c,
+    0x00, 0x95, 0x84, 0x82, 0x75, 0x7c, 0x00, 0x74, 0x7c, 0x82, 0x54, 0x7c, 0x0a, 0x74, 0x7c, 0x54,
+    0x7c, 0x13, 0x74, 0xf2, 0x6b, 0xb1, 0x63, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x53, 0x6f, 0x5b, 0xf2,
+    0x6b, 0x33, 0x74, 0x83, 0x13, 0x74, 0x08, 0xf2, 0x6b, 0xb1, 0x63, 0x4f, 0x5b, 0x2f, 0x53, 0x4f,
+    0x5b, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0x81, 0xd2, 0x6b, 0x81, 0xd1, 0x6b, 0x85,
+    0xb1, 0x63, 0x06, 0x70, 0x5b, 0x90, 0x63, 0x32, 0x74, 0x12, 0x74, 0x70, 0x5b, 0x4f, 0x5b, 0x90,
+    0x63, 0x81, 0x90, 0x5b, 0x83, 0x70, 0x5b, 0x01, 0x2f, 0x53, 0xb4, 0x8c, 0x9a, 0x1c, 0xe7, 0x01,
+    0x78, 0xa5, 0x96, 0x84, 0x83, 0xb6, 0x84, 0x81, 0x96, 0x84, 0x02, 0x75, 0x84, 0x95, 0x84, 0xb6,
+    0x84, 0x81, 0x95, 0x84, 0x00, 0x75, 0x7c, 0x81, 0x95, 0x84, 0x00, 0x75, 0x84, 0x84, 0x75, 0x7c,
+    0x07, 0x54, 0x7c, 0x33, 0x74, 0xf2, 0x6b, 0xd1, 0x6b, 0x90, 0x63, 0x6f, 0x5b, 0x2e, 0x53, 0x0d,
+    0x4b, 0x81, 0xed, 0x4a, 0x02, 0x2e, 0x53, 0xd2, 0x6b, 0x33, 0x74, 0x83, 0x13, 0x74, 0x0b, 0xf2,
+    0x6b, 0x90, 0x63, 0x0e, 0x53, 0xed, 0x4a, 0x0d, 0x4b, 0x0e, 0x4b, 0x2e, 0x53, 0x4f, 0x5b, 0x6f,
+    0x5b, 0x90, 0x63, 0x91, 0x63, 0xb1, 0x63, 0x81, 0xd1, 0x6b, 0x85, 0xb1, 0x63, 0x00, 0x90, 0x63,
+    0x82, 0x70, 0x5b, 0x81, 0x90, 0x63, 0x00, 0x70, 0x5b, 0x81, 0x90, 0x5b, 0x81, 0x70, 0x5b, 0x02,
+    0x4f, 0x53, 0x6f, 0x5b, 0x36, 0xa5, 0x9a, 0x1c, 0xe7, 0x00, 0x98, 0xad, 0x81, 0x96, 0x84, 0x00,
+    0xb6, 0x84, 0x84, 0x96, 0x84, 0x82, 0x95, 0x84, 0x00, 0x95, 0x7c, 0x81, 0x95, 0x84, 0x84, 0x75,
+    0x7c, 0x06, 0x54, 0x7c, 0x34, 0x7c, 0xf2, 0x6b, 0xb1, 0x63, 0x4f, 0x53, 0x0d, 0x53, 0x0d, 0x4b,
+    0x83, 0x0e, 0x53, 0x03, 0x0d, 0x4b, 0x2f, 0x53, 0xd2, 0x6b, 0x33, 0x74, 0x83, 0x13, 0x74, 0x02,
+    0xf2, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0x82, 0x0d, 0x4b, 0x00, 0x0e, 0x4b, 0x82, 0x0e, 0x53, 0x01,
+    0x4f, 0x53, 0x90, 0x5b, 0x86, 0xb1, 0x63, 0x81, 0x90, 0x63, 0x81, 0x90, 0x5b, 0x81, 0x90, 0x63,
+    0x02, 0x70, 0x63, 0x70, 0x5b, 0x90, 0x5b, 0x82, 0x70, 0x5b, 0x02, 0x2f, 0x53, 0xb0, 0x6b, 0xb7,
+    0xb5, 0x9a, 0x1c, 0xe7, 0x02, 0xbb, 0xd6, 0xb6, 0x84, 0x75, 0x84, 0x84, 0x96, 0x84, 0x86, 0x95,
+    0x84, 0x00, 0x75, 0x84, 0x82, 0x75, 0x7c, 0x07, 0x54, 0x7c, 0xf2, 0x6b, 0x90, 0x5b, 0x2f, 0x53,
+    0x2e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x0d, 0x4b, 0x83, 0x0e, 0x53, 0x03, 0x0e, 0x4b, 0x2f, 0x53,
+    0xd2, 0x6b, 0x33, 0x74, 0x83, 0x13, 0x74, 0x03, 0xf2, 0x6b, 0x91, 0x63, 0x2e, 0x53, 0xed, 0x4a,
+    0x82, 0x0d, 0x4b, 0x00, 0x0e, 0x4b, 0x81, 0x0e, 0x53, 0x04, 0x2e, 0x53, 0x4f, 0x53, 0x4f, 0x5b,
+    0x70, 0x5b, 0x91, 0x63, 0x82, 0xb1, 0x63, 0x87, 0x90, 0x63, 0x83, 0x70, 0x5b, 0x81, 0x4f, 0x5b,
+    0x01, 0xd1, 0x7b, 0xfc, 0xe6, 0x9b, 0x1c, 0xe7, 0x03, 0x7b, 0xce, 0x75, 0x84, 0x96, 0x84, 0xb6,
+    0x84, 0x81, 0x96, 0x84, 0x89, 0x95, 0x84, 0x04, 0x75, 0x7c, 0x13, 0x74, 0xb1, 0x63, 0x4f, 0x5b,
+    0x0e, 0x53, 0x81, 0x0d, 0x4b, 0x00, 0x0e, 0x53, 0x81, 0x2e, 0x53, 0x07, 0x0e, 0x4b, 0xee, 0x4a,
+    0xed, 0x4a, 0x0e, 0x53, 0x4f, 0x63, 0x90, 0x6b, 0xf2, 0x6b, 0x33, 0x74, 0x83, 0x13, 0x74, 0x08,
+    0xd2, 0x6b, 0x4f, 0x63, 0xcc, 0x52, 0x0d, 0x53, 0x6f, 0x5b, 0x4e, 0x5b, 0xed, 0x4a, 0xcd, 0x42,
+    0xed, 0x4a, 0x83, 0x2e, 0x53, 0x01, 0x4f, 0x5b, 0x6f, 0x5b, 0x81, 0x90, 0x63, 0x81, 0xb1, 0x63,
+    0x86, 0x90, 0x63, 0x83, 0x70, 0x5b, 0x02, 0x4f, 0x53, 0x8f, 0x6b, 0x35, 0xad, 0x9d, 0x1c, 0xe7,
+    0x04, 0x5a, 0xc6, 0x96, 0x84, 0x75, 0x7c, 0xb6, 0x84, 0x96, 0x84, 0x88, 0x95, 0x84, 0x04, 0x54,
+    0x7c, 0xf2, 0x6b, 0x70, 0x5b, 0x0e, 0x53, 0xed, 0x4a, 0x82, 0x0e, 0x53, 0x09, 0x0e, 0x4b, 0xed,
+    0x4a, 0x0e, 0x53, 0x2e, 0x5b, 0x90, 0x6b, 0x52, 0x84, 0xd8, 0xbd, 0xfc, 0xe6, 0xdb, 0xde, 0x54,
+    0x84, 0x84, 0x13, 0x74, 0x03, 0xb1, 0x6b, 0x2e, 0x5b, 0x4e, 0x6b, 0x59, 0xce, 0x81, 0xfc, 0xe6,
+    0x06, 0xdb, 0xde, 0x73, 0x84, 0xd1, 0x6b, 0x2e, 0x53, 0xee, 0x4a, 0x0e, 0x53, 0x2f, 0x5b, 0x82,
+    0x4f, 0x5b, 0x01, 0x70, 0x5b, 0x90, 0x63, 0x81, 0xb1, 0x63, 0x85, 0x90, 0x63, 0x82, 0x70, 0x5b,
+    0x02, 0x4f, 0x5b, 0x2e, 0x5b, 0xd0, 0x7b, 0x9f, 0x1c, 0xe7, 0x00, 0xf7, 0x94, 0x8a, 0x95, 0x84,
+    0x04, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x83, 0x0e, 0x53, 0x04, 0x2e,
+    0x53, 0x4f, 0x63, 0xd0, 0x73, 0x52, 0x8c, 0xfb, 0xde, 0x83, 0x1c, 0xe7, 0x02, 0xf6, 0x94, 0x13,
+    0x74, 0xf3, 0x6b, 0x82, 0x13, 0x74, 0x02, 0xb1, 0x63, 0x90, 0x6b, 0xb7, 0xbd, 0x84, 0x1c, 0xe7,
+    0x03, 0xfb, 0xde, 0x73, 0x84, 0xb0, 0x6b, 0x6f, 0x5b, 0x81, 0x2f, 0x53, 0x01, 0x4f, 0x5b, 0x6f,
+    0x5b, 0x81, 0x70, 0x5b, 0x87, 0x90, 0x63, 0x82, 0x70, 0x5b, 0x02, 0x0e, 0x53, 0x6f, 0x6b, 0xf8,
+    0xc5, 0xa0, 0x1c, 0xe7, 0x00, 0xf7, 0x94, 0x86, 0x95, 0x84, 0x05, 0x96, 0x84, 0x95, 0x84, 0x34,
+    0x74, 0x90, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0x84, 0x0e, 0x53, 0x02, 0x2e, 0x63, 0xf1, 0x7b, 0x9a,
+    0xd6, 0x86, 0x1c, 0xe7, 0x02, 0x16, 0x9d, 0x33, 0x74, 0xf2, 0x6b, 0x82, 0x13, 0x74, 0x01, 0xb1,
+    0x6b, 0xd1, 0x73, 0x88, 0x1c, 0xe7, 0x01, 0x9a, 0xd6, 0xd1, 0x6b, 0x81, 0x4f, 0x5b, 0x83, 0x70,
+    0x5b, 0x86, 0x90, 0x63, 0x82, 0x70, 0x5b, 0x01, 0x2f, 0x5b, 0xf1, 0x7b, 0xa1, 0x1c, 0xe7, 0x01,
+    0x17, 0x95, 0x75, 0x7c, 0x84, 0x95, 0x84, 0x0c, 0x96, 0x84, 0x95, 0x84, 0x33, 0x74, 0x90, 0x63,
+    0x0e, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0xed, 0x52, 0x2e, 0x5b, 0xd0, 0x73,
+    0xbb, 0xd6, 0x88, 0x1c, 0xe7, 0x02, 0x16, 0x95, 0x33, 0x74, 0xf2, 0x6b, 0x82, 0x13, 0x74, 0x01,
+    0xd1, 0x6b, 0xf1, 0x73, 0x8a, 0x1c, 0xe7, 0x03, 0x7a, 0xce, 0xf1, 0x73, 0x2f, 0x53, 0x4f, 0x5b,
+    0x86, 0x90, 0x63, 0x84, 0x70, 0x5b, 0x01, 0x4f, 0x53, 0x12, 0x74, 0xa0, 0x1c, 0xe7, 0x02, 0x5a,
+    0xc6, 0xb6, 0x84, 0x75, 0x7c, 0x85, 0x95, 0x84, 0x03, 0x33, 0x74, 0x90, 0x5b, 0x0e, 0x53, 0x0e,
+    0x4b, 0x82, 0x2e, 0x53, 0x03, 0x0e, 0x53, 0x6f, 0x63, 0x31, 0x8c, 0xdb, 0xde, 0x89, 0x1c, 0xe7,
+    0x02, 0x16, 0x95, 0x33, 0x74, 0xf2, 0x6b, 0x82, 0x13, 0x74, 0x01, 0xd1, 0x6b, 0xf1, 0x7b, 0x8b,
+    0x1c, 0xe7, 0x01, 0x9a, 0xd6, 0x32, 0x74, 0x81, 0x70, 0x5b, 0x02, 0xb0, 0x63, 0x90, 0x63, 0xb1,
+    0x63, 0x81, 0x90, 0x63, 0x85, 0x70, 0x5b, 0x02, 0x4f, 0x53, 0xb0, 0x63, 0xb7, 0xad, 0x9f, 0x1c,
+    0xe7, 0x01, 0xd6, 0x8c, 0x75, 0x7c, 0x85, 0x95, 0x84, 0x01, 0x33, 0x74, 0x90, 0x5b, 0x81, 0x0e,
+    0x53, 0x82, 0x2e, 0x53, 0x02, 0x0e, 0x53, 0x8f, 0x73, 0x18, 0xc6, 0x8b, 0x1c, 0xe7, 0x02, 0x16,
+    0x95, 0x33, 0x74, 0xf2, 0x6b, 0x82, 0x13, 0x74, 0x01, 0xd1, 0x6b, 0xf1, 0x7b, 0x8d, 0x1c, 0xe7,
+    0x00, 0x36, 0x9d, 0x81, 0x90, 0x63, 0x83, 0xb1, 0x63, 0x00, 0x90, 0x63, 0x85, 0x70, 0x5b, 0x01,
+    0x4f, 0x53, 0x90, 0x63, 0x84, 0x1c, 0xe7, 0x00, 0xfb, 0xde, 0x81, 0xf8, 0xbd, 0x01, 0x97, 0xad,
+    0xfc, 0xe6, 0x94, 0x1c, 0xe7, 0x00, 0xd9, 0xb5, 0x81, 0x75, 0x7c, 0x84, 0x95, 0x84, 0x03, 0x54,
+    0x74, 0x90, 0x63, 0x0e, 0x53, 0x0e, 0x4b, 0x82, 0x2e, 0x53, 0x02, 0x0d, 0x53, 0xf0, 0x7b, 0xbb,
+    0xd6, 0x8c, 0x1c, 0xe7, 0x02, 0x16, 0x95, 0x13, 0x74, 0xf3, 0x6b, 0x81, 0x13, 0x74, 0x02, 0xf2,
+    0x6b, 0xd1, 0x6b, 0xf1, 0x7b, 0x8e, 0x1c, 0xe7, 0x02, 0x39, 0xc6, 0xf2, 0x73, 0x90, 0x63, 0x82,
+    0xd1, 0x6b, 0x01, 0xb1, 0x63, 0x90, 0x63, 0x84, 0x70, 0x5b, 0x0b, 0x4f, 0x53, 0x4f, 0x5b, 0x56,
+    0xa5, 0x39, 0xc6, 0x59, 0xc6, 0x39, 0xc6, 0x97, 0xad, 0x12, 0x74, 0x90, 0x63, 0x2e, 0x53, 0x0e,
+    0x53, 0x12, 0x74, 0x8b, 0x1c, 0xe7, 0x02, 0x17, 0x95, 0x37, 0x9d, 0xdc, 0xde, 0x84, 0x1c, 0xe7,
+    0x00, 0x5a, 0xc6, 0x81, 0x75, 0x7c, 0x84, 0x95, 0x84, 0x03, 0x54, 0x7c, 0xb1, 0x63, 0x0e, 0x53,
+    0x0d, 0x4b, 0x82, 0x2e, 0x53, 0x02, 0x0e, 0x5b, 0xf1, 0x83, 0xbb, 0xde, 0x8d, 0x1c, 0xe7, 0x07,
+    0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0x12, 0x74, 0xf2, 0x6b, 0xd1, 0x6b, 0xf2, 0x7b,
+    0x8f, 0x1c, 0xe7, 0x07, 0x59, 0xc6, 0x12, 0x74, 0xb1, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b,
+    0xb1, 0x63, 0x90, 0x5b, 0x84, 0x70, 0x5b, 0x81, 0x6f, 0x5b, 0x02, 0xb0, 0x63, 0xb0, 0x6b, 0x6f,
+    0x5b, 0x81, 0x2e, 0x53, 0x82, 0x90, 0x63, 0x01, 0x4f, 0x5b, 0x93, 0x84, 0x89, 0x1c, 0xe7, 0x13,
+    0xd6, 0x8c, 0x54, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0xd6, 0x8c, 0x16, 0x95, 0x78, 0xa5, 0x3a, 0xc6,
+    0xb9, 0xad, 0xd6, 0x8c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x75, 0x84, 0x75, 0x7c, 0x95, 0x84,
+    0x75, 0x7c, 0xd1, 0x63, 0x0e, 0x53, 0x0d, 0x4b, 0x82, 0x2e, 0x53, 0x02, 0x0d, 0x53, 0x11, 0x84,
+    0xbb, 0xde, 0x8e, 0x1c, 0xe7, 0x02, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x81, 0x12, 0x6c, 0x02,
+    0xf2, 0x6b, 0xd1, 0x6b, 0x12, 0x7c, 0x90, 0x1c, 0xe7, 0x02, 0x39, 0xc6, 0x12, 0x74, 0xd1, 0x6b,
+    0x81, 0xf2, 0x6b, 0x01, 0xd2, 0x6b, 0xb1, 0x63, 0x84, 0x70, 0x5b, 0x05, 0x6f, 0x5b, 0x4f, 0x5b,
+    0x2f, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x81, 0x2f, 0x53, 0x03, 0x4f, 0x5b, 0x4f, 0x53,
+    0xee, 0x4a, 0xd1, 0x6b, 0x88, 0x1c, 0xe7, 0x03, 0xfc, 0xde, 0x95, 0x84, 0x34, 0x74, 0x75, 0x84,
+    0x81, 0x54, 0x7c, 0x05, 0x75, 0x7c, 0x95, 0x84, 0xb6, 0x84, 0xb5, 0x84, 0x75, 0x7c, 0x75, 0x84,
+    0x82, 0x75, 0x7c, 0x05, 0x95, 0x84, 0x75, 0x7c, 0xf2, 0x6b, 0x4f, 0x53, 0x0d, 0x4b, 0x0e, 0x53,
+    0x81, 0x2e, 0x53, 0x02, 0x0e, 0x53, 0xf0, 0x7b, 0xbb, 0xde, 0x8f, 0x1c, 0xe7, 0x03, 0x16, 0x95,
+    0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x73, 0x81, 0xf2, 0x6b, 0x01, 0xd1, 0x6b, 0xf1, 0x7b, 0x91, 0x1c,
+    0xe7, 0x02, 0x5a, 0xc6, 0xf2, 0x73, 0xd2, 0x6b, 0x81, 0xf2, 0x6b, 0x01, 0xd2, 0x6b, 0x90, 0x63,
+    0x81, 0x70, 0x5b, 0x82, 0x6f, 0x5b, 0x85, 0x4f, 0x5b, 0x82, 0x4f, 0x53, 0x02, 0x0e, 0x4b, 0x4f,
+    0x5b, 0x59, 0xc6, 0x87, 0x1c, 0xe7, 0x01, 0xb5, 0x8c, 0x54, 0x7c, 0x84, 0x75, 0x7c, 0x00, 0x55,
+    0x7c, 0x81, 0x54, 0x7c, 0x85, 0x75, 0x7c, 0x03, 0x34, 0x74, 0x70, 0x5b, 0x0d, 0x4b, 0x0e, 0x53,
+    0x81, 0x2e, 0x53, 0x02, 0x0e, 0x53, 0x8f, 0x73, 0xba, 0xd6, 0x90, 0x1c, 0xe7, 0x03, 0x16, 0x95,
+    0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x73, 0x81, 0xf2, 0x6b, 0x01, 0xb1, 0x6b, 0xf1, 0x7b, 0x92, 0x1c,
+    0xe7, 0x02, 0xd5, 0x94, 0xd2, 0x6b, 0xf2, 0x6b, 0x81, 0x13, 0x74, 0x01, 0xd1, 0x6b, 0x70, 0x5b,
+    0x83, 0x6f, 0x5b, 0x85, 0x4f, 0x5b, 0x00, 0x4f, 0x53, 0x81, 0x2f, 0x53, 0x81, 0x2e, 0x53, 0x00,
+    0xf1, 0x73, 0x87, 0x1c, 0xe7, 0x81, 0x54, 0x7c, 0x00, 0x74, 0x7c, 0x8b, 0x75, 0x7c, 0x03, 0x54,
+    0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0d, 0x53, 0x81, 0x2e, 0x53, 0x02, 0xed, 0x52, 0x6f, 0x6b, 0x18,
+    0xc6, 0x91, 0x1c, 0xe7, 0x03, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x73, 0x81, 0xf2, 0x6b,
+    0x01, 0xb1, 0x6b, 0xf1, 0x7b, 0x93, 0x1c, 0xe7, 0x06, 0x94, 0x84, 0xf2, 0x6b, 0x13, 0x74, 0x33,
+    0x74, 0xf2, 0x73, 0xb1, 0x63, 0x70, 0x5b, 0x82, 0x6f, 0x5b, 0x85, 0x4f, 0x5b, 0x00, 0x4f, 0x53,
+    0x81, 0x2f, 0x53, 0x81, 0x2e, 0x53, 0x00, 0x4f, 0x5b, 0x86, 0x1c, 0xe7, 0x00, 0xbb, 0xd6, 0x81,
+    0x34, 0x74, 0x81, 0x54, 0x7c, 0x81, 0x74, 0x7c, 0x88, 0x75, 0x7c, 0x02, 0x13, 0x74, 0x4f, 0x53,
+    0x0d, 0x53, 0x81, 0x2e, 0x53, 0x02, 0x0e, 0x53, 0x2e, 0x63, 0x72, 0x94, 0x92, 0x1c, 0xe7, 0x01,
+    0x16, 0x95, 0x13, 0x74, 0x83, 0xf2, 0x6b, 0x01, 0xb1, 0x6b, 0xf1, 0x7b, 0x93, 0x1c, 0xe7, 0x02,
+    0xdb, 0xde, 0x33, 0x74, 0xf3, 0x6b, 0x81, 0x33, 0x74, 0x03, 0xf2, 0x6b, 0x90, 0x63, 0x4f, 0x5b,
+    0x6f, 0x5b, 0x86, 0x4f, 0x5b, 0x05, 0x4f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x2e, 0x53,
+    0x52, 0x84, 0x86, 0x1c, 0xe7, 0x02, 0xbb, 0xd6, 0x54, 0x7c, 0x34, 0x74, 0x82, 0x54, 0x7c, 0x87,
+    0x74, 0x7c, 0x05, 0x75, 0x7c, 0x54, 0x7c, 0xb1, 0x63, 0x0e, 0x53, 0x0e, 0x4b, 0x2e, 0x53, 0x81,
+    0x0e, 0x53, 0x01, 0x11, 0x84, 0xfc, 0xe6, 0x92, 0x1c, 0xe7, 0x01, 0x16, 0x95, 0x13, 0x74, 0x83,
+    0xf2, 0x6b, 0x01, 0xb1, 0x6b, 0xf1, 0x7b, 0x94, 0x1c, 0xe7, 0x06, 0x16, 0x95, 0x33, 0x74, 0x13,
+    0x74, 0x34, 0x74, 0x33, 0x74, 0xb1, 0x63, 0x6f, 0x5b, 0x87, 0x4f, 0x5b, 0x05, 0x4f, 0x53, 0x2f,
+    0x53, 0x0e, 0x53, 0x2e, 0x5b, 0x11, 0x84, 0xdb, 0xde, 0x87, 0x1c, 0xe7, 0x03, 0x3a, 0xc6, 0x54,
+    0x7c, 0x13, 0x74, 0x34, 0x74, 0x87, 0x54, 0x7c, 0x04, 0x74, 0x7c, 0x75, 0x7c, 0xf2, 0x6b, 0x4f,
+    0x5b, 0x0e, 0x53, 0x81, 0x2e, 0x53, 0x02, 0x0e, 0x53, 0x4f, 0x6b, 0xbb, 0xde, 0x93, 0x1c, 0xe7,
+    0x00, 0x95, 0x84, 0x84, 0xf2, 0x6b, 0x02, 0xb1, 0x6b, 0xf2, 0x73, 0xdb, 0xde, 0x94, 0x1c, 0xe7,
+    0x01, 0x74, 0x84, 0xf3, 0x6b, 0x81, 0x54, 0x7c, 0x01, 0xf2, 0x6b, 0x90, 0x63, 0x87, 0x4f, 0x5b,
+    0x04, 0x2f, 0x53, 0x0e, 0x53, 0x4f, 0x63, 0x56, 0xad, 0xfc, 0xe6, 0x89, 0x1c, 0xe7, 0x04, 0xfc,
+    0xde, 0x78, 0xa5, 0x75, 0x84, 0x33, 0x74, 0x34, 0x74, 0x87, 0x54, 0x7c, 0x00, 0xb1, 0x63, 0x81,
+    0x0e, 0x53, 0x81, 0x2e, 0x53, 0x01, 0x2e, 0x5b, 0x11, 0x84, 0x92, 0x1c, 0xe7, 0x03, 0xdb, 0xde,
+    0xf6, 0x94, 0x13, 0x74, 0xd2, 0x6b, 0x82, 0xf2, 0x6b, 0x82, 0xd2, 0x6b, 0x01, 0x74, 0x84, 0xdb,
+    0xde, 0x93, 0x1c, 0xe7, 0x01, 0x19, 0xbe, 0x33, 0x74, 0x81, 0x54, 0x7c, 0x01, 0x34, 0x74, 0xb1,
+    0x63, 0x86, 0x4f, 0x5b, 0x03, 0x2e, 0x53, 0xed, 0x52, 0x8f, 0x73, 0xf8, 0xc5, 0x8d, 0x1c, 0xe7,
+    0x01, 0x7a, 0xce, 0x95, 0x84, 0x87, 0x54, 0x7c, 0x07, 0x13, 0x74, 0x90, 0x63, 0x0e, 0x53, 0x2e,
+    0x53, 0x2f, 0x53, 0x0e, 0x53, 0x8f, 0x6b, 0xdb, 0xde, 0x90, 0x1c, 0xe7, 0x02, 0xfc, 0xde, 0x94,
+    0x84, 0x53, 0x7c, 0x85, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x04, 0xf2, 0x6b, 0xd2, 0x6b, 0x33, 0x74,
+    0xb4, 0x8c, 0xfc, 0xe6, 0x92, 0x1c, 0xe7, 0x04, 0xb5, 0x8c, 0x34, 0x74, 0x54, 0x7c, 0x75, 0x7c,
+    0xf2, 0x6b, 0x85, 0x4f, 0x5b, 0x03, 0x4f, 0x53, 0x0e, 0x5b, 0x2e, 0x6b, 0xf8, 0xc5, 0x90, 0x1c,
+    0xe7, 0x01, 0x7a, 0xce, 0x95, 0x84, 0x85, 0x54, 0x7c, 0x01, 0xd1, 0x6b, 0x4f, 0x5b, 0x82, 0x2e,
+    0x53, 0x01, 0x2e, 0x5b, 0x11, 0x84, 0x90, 0x1c, 0xe7, 0x02, 0x39, 0xbe, 0x33, 0x74, 0xd2, 0x6b,
+    0x86, 0xf2, 0x6b, 0x83, 0xd2, 0x6b, 0x81, 0xb1, 0x63, 0x01, 0x12, 0x74, 0x7a, 0xce, 0x91, 0x1c,
+    0xe7, 0x05, 0x9b, 0xce, 0x34, 0x74, 0x54, 0x7c, 0x95, 0x84, 0x33, 0x74, 0x90, 0x63, 0x84, 0x4f,
+    0x5b, 0x02, 0x6f, 0x5b, 0x0e, 0x5b, 0x97, 0xb5, 0x91, 0x1c, 0xe7, 0x03, 0xfc, 0xde, 0x95, 0x84,
+    0x54, 0x7c, 0x34, 0x74, 0x82, 0x54, 0x7c, 0x02, 0x34, 0x74, 0x90, 0x63, 0x0e, 0x53, 0x81, 0x2e,
+    0x53, 0x02, 0x0e, 0x53, 0x4e, 0x63, 0xb7, 0xbd, 0x8f, 0x1c, 0xe7, 0x02, 0xd5, 0x8c, 0xd2, 0x6b,
+    0xb1, 0x63, 0x81, 0xf2, 0x6b, 0x00, 0xf2, 0x73, 0x84, 0xf2, 0x6b, 0x84, 0xd2, 0x6b, 0x03, 0xf2,
+    0x6b, 0x70, 0x5b, 0xb1, 0x63, 0xb4, 0x8c, 0x91, 0x1c, 0xe7, 0x04, 0x74, 0x7c, 0x75, 0x7c, 0x95,
+    0x84, 0x54, 0x7c, 0xd2, 0x6b, 0x83, 0x4f, 0x5b, 0x03, 0x2f, 0x5b, 0x90, 0x5b, 0x4f, 0x5b, 0xdb,
+    0xde, 0x91, 0x1c, 0xe7, 0x00, 0xdb, 0xd6, 0x83, 0x54, 0x7c, 0x04, 0x54, 0x74, 0x54, 0x7c, 0x13,
+    0x74, 0x6f, 0x5b, 0x0e, 0x4b, 0x81, 0x2e, 0x53, 0x01, 0x0e, 0x53, 0xd0, 0x7b, 0x8f, 0x1c, 0xe7,
+    0x01, 0x16, 0x95, 0xb1, 0x63, 0x81, 0xd1, 0x6b, 0x81, 0x12, 0x74, 0x01, 0xd2, 0x6b, 0xf2, 0x6b,
+    0x84, 0xb1, 0x63, 0x08, 0xb1, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0xb0, 0x63, 0x6f, 0x5b,
+    0xd1, 0x6b, 0x90, 0x63, 0x97, 0xad, 0x90, 0x1c, 0xe7, 0x01, 0xd6, 0x8c, 0x75, 0x7c, 0x81, 0x95,
+    0x84, 0x02, 0x13, 0x74, 0x4f, 0x5b, 0x2f, 0x53, 0x81, 0x4f, 0x5b, 0x03, 0x2f, 0x53, 0x4f, 0x5b,
+    0x2e, 0x53, 0xd7, 0xb5, 0x91, 0x1c, 0xe7, 0x02, 0xbb, 0xd6, 0x13, 0x74, 0x74, 0x7c, 0x81, 0x34,
+    0x74, 0x08, 0x54, 0x74, 0x33, 0x74, 0xf2, 0x6b, 0x4f, 0x5b, 0x0e, 0x53, 0x2f, 0x53, 0x2e, 0x53,
+    0x0e, 0x5b, 0x56, 0xad, 0x8e, 0x1c, 0xe7, 0x08, 0x39, 0xc6, 0xf2, 0x6b, 0x70, 0x5b, 0x6f, 0x5b,
+    0x15, 0x9d, 0x97, 0xad, 0x74, 0x84, 0xd2, 0x6b, 0x91, 0x63, 0x81, 0x90, 0x63, 0x01, 0xb0, 0x63,
+    0xb1, 0x6b, 0x81, 0xd1, 0x6b, 0x81, 0xb1, 0x63, 0x06, 0xf1, 0x73, 0x32, 0x7c, 0x73, 0x84, 0x70,
+    0x63, 0x70, 0x5b, 0xd1, 0x6b, 0xdb, 0xde, 0x8f, 0x1c, 0xe7, 0x06, 0xfc, 0xde, 0xb6, 0x84, 0x95,
+    0x84, 0xb6, 0x84, 0x54, 0x7c, 0x6f, 0x5b, 0x2e, 0x53, 0x81, 0x4f, 0x5b, 0x81, 0x4f, 0x53, 0x01,
+    0x0e, 0x53, 0x32, 0x7c, 0x91, 0x1c, 0xe7, 0x02, 0x5a, 0xc6, 0xf3, 0x6b, 0x54, 0x7c, 0x81, 0x33,
+    0x74, 0x04, 0x34, 0x74, 0x33, 0x74, 0xd1, 0x63, 0x4f, 0x5b, 0x2e, 0x53, 0x81, 0x2f, 0x53, 0x01,
+    0x4e, 0x63, 0xfc, 0xe6, 0x8d, 0x1c, 0xe7, 0x04, 0xfc, 0xde, 0x54, 0x7c, 0xb2, 0x63, 0x70, 0x5b,
+    0x93, 0x84, 0x82, 0x1c, 0xe7, 0x0a, 0x74, 0x84, 0x32, 0x7c, 0xd4, 0x8c, 0x97, 0xad, 0x76, 0xad,
+    0xb7, 0xad, 0xd8, 0xb5, 0xf5, 0x94, 0x13, 0x74, 0x33, 0x7c, 0xb7, 0xb5, 0x81, 0x1c, 0xe7, 0x03,
+    0xf5, 0x94, 0x90, 0x63, 0x70, 0x5b, 0x32, 0x74, 0x90, 0x1c, 0xe7, 0x06, 0xd6, 0x8c, 0x75, 0x7c,
+    0xd6, 0x8c, 0x75, 0x7c, 0x90, 0x63, 0x2f, 0x5b, 0x2f, 0x53, 0x81, 0x4f, 0x53, 0x03, 0x4f, 0x5b,
+    0x2e, 0x53, 0xb0, 0x6b, 0xdb, 0xde, 0x90, 0x1c, 0xe7, 0x01, 0x16, 0x95, 0xf2, 0x6b, 0x82, 0x33,
+    0x74, 0x03, 0x34, 0x74, 0x13, 0x74, 0x90, 0x63, 0x4f, 0x53, 0x82, 0x2e, 0x53, 0x00, 0xb0, 0x73,
+    0x8e, 0x1c, 0xe7, 0x04, 0x94, 0x84, 0xf2, 0x6b, 0xf2, 0x73, 0x91, 0x63, 0xd4, 0x94, 0x83, 0x1c,
+    0xe7, 0x00, 0x9a, 0xd6, 0x85, 0x1c, 0xe7, 0x01, 0x9a, 0xce, 0xfc, 0xde, 0x82, 0x1c, 0xe7, 0x01,
+    0x16, 0x9d, 0x91, 0x63, 0x81, 0x90, 0x63, 0x00, 0x77, 0xa5, 0x8f, 0x1c, 0xe7, 0x05, 0xf7, 0x94,
+    0x76, 0x7c, 0xd7, 0x8c, 0x95, 0x84, 0xf2, 0x6b, 0x4f, 0x5b, 0x81, 0x2f, 0x53, 0x05, 0x4f, 0x53,
+    0x4f, 0x5b, 0x2e, 0x53, 0x4f, 0x5b, 0x73, 0x84, 0xfc, 0xe6, 0x8e, 0x1c, 0xe7, 0x02, 0xfc, 0xde,
+    0xb5, 0x8c, 0xf3, 0x6b, 0x82, 0x33, 0x74, 0x02, 0x34, 0x74, 0x13, 0x74, 0x70, 0x5b, 0x82, 0x2e,
+    0x53, 0x01, 0x2e, 0x5b, 0x11, 0x7c, 0x8d, 0x1c, 0xe7, 0x00, 0xdb, 0xde, 0x81, 0x13, 0x74, 0x03,
+    0xf2, 0x73, 0xd2, 0x6b, 0x53, 0x7c, 0xbb, 0xd6, 0x8d, 0x1c, 0xe7, 0x01, 0x5a, 0xc6, 0x33, 0x7c,
+    0x82, 0x90, 0x63, 0x01, 0xf1, 0x6b, 0xfb, 0xde, 0x8e, 0x1c, 0xe7, 0x05, 0x17, 0x95, 0x75, 0x7c,
+    0xd7, 0x8c, 0x96, 0x84, 0x13, 0x74, 0x70, 0x5b, 0x81, 0x2f, 0x53, 0x81, 0x4f, 0x53, 0x00, 0x2f,
+    0x53, 0x82, 0x4f, 0x5b, 0x04, 0xf1, 0x6b, 0xd1, 0x6b, 0xf1, 0x6b, 0x6f, 0x63, 0x73, 0x84, 0x87,
+    0x1c, 0xe7, 0x04, 0xfc, 0xe6, 0x19, 0xbe, 0xb5, 0x84, 0x33, 0x74, 0x13, 0x74, 0x82, 0x33, 0x74,
+    0x03, 0x34, 0x74, 0x13, 0x74, 0x90, 0x63, 0x6f, 0x5b, 0x81, 0x70, 0x5b, 0x02, 0x6f, 0x63, 0x32,
+    0x84, 0xfb, 0xde, 0x8c, 0x1c, 0xe7, 0x06, 0x3a, 0xc6, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0xf3,
+    0x6b, 0xd1, 0x6b, 0x32, 0x74, 0x8d, 0x1c, 0xe7, 0x01, 0x53, 0x7c, 0x91, 0x63, 0x81, 0xb1, 0x63,
+    0x02, 0x91, 0x63, 0x70, 0x5b, 0x97, 0xad, 0x8d, 0x1c, 0xe7, 0x06, 0xfc, 0xde, 0x95, 0x84, 0x34,
+    0x74, 0x75, 0x7c, 0x54, 0x7c, 0xf2, 0x6b, 0x70, 0x5b, 0x84, 0x2f, 0x53, 0x81, 0x2e, 0x53, 0x06,
+    0xed, 0x4a, 0x0e, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x4b, 0x4e, 0x5b, 0x52, 0x7c, 0x82, 0x1c,
+    0xe7, 0x05, 0x97, 0xa5, 0x16, 0x95, 0xd5, 0x8c, 0x74, 0x84, 0x54, 0x7c, 0x33, 0x74, 0x81, 0x13,
+    0x74, 0x84, 0x33, 0x74, 0x03, 0x13, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0x81, 0xd2, 0x6b,
+    0x03, 0x12, 0x7c, 0xb5, 0x8c, 0x5a, 0xc6, 0xdb, 0xde, 0x81, 0x9b, 0xd6, 0x01, 0x9b, 0xce, 0x7a,
+    0xce, 0x82, 0x9a, 0xce, 0x04, 0x7a, 0xce, 0xbb, 0xd6, 0x19, 0xbe, 0xd5, 0x8c, 0x33, 0x7c, 0x82,
+    0xf2, 0x6b, 0x03, 0xf3, 0x73, 0x70, 0x5b, 0x90, 0x63, 0xbb, 0xd6, 0x8c, 0x1c, 0xe7, 0x03, 0x12,
+    0x74, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0x81, 0x90, 0x63, 0x01, 0xd1, 0x6b, 0x73, 0x84, 0x81,
+    0xf5, 0x94, 0x00, 0xd5, 0x94, 0x81, 0xd5, 0x8c, 0x86, 0xd4, 0x8c, 0x01, 0xd5, 0x94, 0x73, 0x84,
+    0x83, 0xb1, 0x63, 0x01, 0x90, 0x63, 0x4f, 0x5b, 0x81, 0x4f, 0x53, 0x81, 0x2f, 0x53, 0x85, 0x2e,
+    0x53, 0x81, 0x0e, 0x53, 0x01, 0xcd, 0x4a, 0x0e, 0x53, 0x81, 0x1c, 0xe7, 0x01, 0x13, 0x74, 0xf2,
+    0x6b, 0x82, 0x13, 0x74, 0x00, 0xf3, 0x6b, 0x88, 0x13, 0x74, 0x84, 0x33, 0x74, 0x88, 0x13, 0x74,
+    0x8a, 0xf2, 0x6b, 0x01, 0x70, 0x5b, 0x90, 0x63, 0x8d, 0x1c, 0xe7, 0x01, 0x57, 0x9d, 0xd1, 0x63,
+    0x82, 0x90, 0x63, 0x00, 0xb0, 0x63, 0x81, 0x70, 0x5b, 0x00, 0x90, 0x5b, 0x85, 0x70, 0x5b, 0x00,
+    0x6f, 0x5b, 0x84, 0x4f, 0x5b, 0x00, 0x2f, 0x53, 0x81, 0x4f, 0x5b, 0x81, 0x2e, 0x53, 0x82, 0x2f,
+    0x53, 0x00, 0x4f, 0x53, 0x81, 0x2f, 0x53, 0x86, 0x2e, 0x53, 0x07, 0x0e, 0x53, 0xcd, 0x42, 0x8f,
+    0x63, 0xfc, 0xe6, 0x1c, 0xe7, 0x13, 0x74, 0xd2, 0x63, 0x12, 0x6c, 0x8b, 0x13, 0x74, 0x83, 0x33,
+    0x74, 0x81, 0x13, 0x74, 0x00, 0x13, 0x6c, 0x89, 0xf2, 0x6b, 0x82, 0xd2, 0x6b, 0x84, 0xf2, 0x6b,
+    0x01, 0x70, 0x5b, 0xb0, 0x6b, 0x8d, 0x1c, 0xe7, 0x02, 0x98, 0xad, 0xf2, 0x6b, 0x90, 0x5b, 0x83,
+    0x90, 0x63, 0x81, 0x70, 0x5b, 0x86, 0x4f, 0x5b, 0x81, 0x4f, 0x53, 0x83, 0x2f, 0x53, 0x81, 0x4f,
+    0x5b, 0x82, 0x2f, 0x53, 0x82, 0x4f, 0x53, 0x00, 0x2f, 0x53, 0x85, 0x2e, 0x53, 0x82, 0x0e, 0x53,
+    0x05, 0xcd, 0x42, 0x2e, 0x53, 0xf8, 0xbd, 0xfc, 0xde, 0x54, 0x7c, 0xd2, 0x6b, 0x9c, 0x13, 0x74,
+    0x81, 0xf2, 0x73, 0x85, 0xf2, 0x6b, 0x02, 0xd2, 0x6b, 0x70, 0x5b, 0xd1, 0x73, 0x8d, 0x1c, 0xe7,
+    0x02, 0xd9, 0xb5, 0x13, 0x74, 0x70, 0x5b, 0x85, 0x90, 0x63, 0x87, 0x70, 0x5b, 0x81, 0x6f, 0x5b,
+    0x87, 0x4f, 0x5b, 0x81, 0x4f, 0x53, 0x00, 0x2f, 0x53, 0x85, 0x2e, 0x53, 0x83, 0x0e, 0x53, 0x05,
+    0xed, 0x4a, 0x0e, 0x53, 0x52, 0x84, 0x1c, 0xe7, 0x74, 0x7c, 0xd2, 0x6b, 0x98, 0x13, 0x74, 0x81,
+    0x12, 0x74, 0x81, 0xf2, 0x73, 0x87, 0xf2, 0x6b, 0x02, 0xd2, 0x6b, 0x90, 0x63, 0xd1, 0x73, 0x8d,
+    0x1c, 0xe7, 0x02, 0xb9, 0xad, 0xf2, 0x73, 0x70, 0x5b, 0x85, 0x90, 0x63, 0x87, 0x70, 0x5b, 0x81,
+    0x6f, 0x5b, 0x84, 0x4f, 0x5b, 0x00, 0x2f, 0x5b, 0x81, 0x2f, 0x53, 0x81, 0x4f, 0x53, 0x00, 0x2f,
+    0x53, 0x85, 0x2e, 0x53, 0x83, 0x0e, 0x53, 0x05, 0xed, 0x4a, 0x0d, 0x4b, 0x32, 0x84, 0x1c, 0xe7,
+    0x53, 0x7c, 0xd2, 0x6b, 0x93, 0x13, 0x74, 0x81, 0xf2, 0x6b, 0x01, 0xd2, 0x6b, 0xf2, 0x6b, 0x85,
+    0xd2, 0x6b, 0x81, 0xd2, 0x63, 0x81, 0xd2, 0x6b, 0x00, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x02, 0xf2,
+    0x6b, 0x90, 0x63, 0xf1, 0x73, 0x8d, 0x1c, 0xe7, 0x02, 0x78, 0xa5, 0xd2, 0x6b, 0x70, 0x5b, 0x84,
+    0x90, 0x63, 0x81, 0x70, 0x5b, 0x81, 0x4f, 0x5b, 0x83, 0x4f, 0x53, 0x82, 0x2f, 0x53, 0x81, 0x2e,
+    0x53, 0x02, 0x2f, 0x53, 0x4f, 0x5b, 0x2f, 0x5b, 0x81, 0x2f, 0x53, 0x82, 0x4f, 0x53, 0x86, 0x2e,
+    0x53, 0x00, 0x0e, 0x4b, 0x82, 0xed, 0x4a, 0x05, 0xcd, 0x4a, 0x4e, 0x5b, 0x59, 0xce, 0x1c, 0xe7,
+    0xf2, 0x73, 0xb1, 0x63, 0x83, 0xf2, 0x6b, 0x00, 0xf3, 0x73, 0x8d, 0x13, 0x74, 0x81, 0xf2, 0x6b,
+    0x83, 0x12, 0x74, 0x81, 0xf2, 0x73, 0x85, 0xf2, 0x6b, 0x01, 0xd2, 0x6b, 0xf2, 0x6b, 0x82, 0xd2,
+    0x6b, 0x01, 0x91, 0x63, 0x12, 0x74, 0x8d, 0x1c, 0xe7, 0x01, 0xb5, 0x8c, 0x91, 0x63, 0x85, 0x90,
+    0x63, 0x00, 0x70, 0x5b, 0x81, 0x90, 0x63, 0x00, 0x70, 0x63, 0x84, 0x70, 0x5b, 0x81, 0x6f, 0x5b,
+    0x84, 0x4f, 0x5b, 0x00, 0x2f, 0x53, 0x81, 0x4f, 0x53, 0x00, 0x2f, 0x53, 0x86, 0x2e, 0x53, 0x81,
+    0x0e, 0x53, 0x81, 0x2e, 0x53, 0x02, 0x2e, 0x5b, 0x8f, 0x6b, 0x52, 0x84, 0x81, 0x1c, 0xe7, 0x01,
+    0x74, 0x84, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x00, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x00, 0xf2, 0x6b,
+    0x82, 0xf2, 0x73, 0x00, 0x12, 0x74, 0x81, 0x13, 0x74, 0x01, 0xf2, 0x6b, 0xb0, 0x63, 0x82, 0x90,
+    0x63, 0x05, 0x70, 0x5b, 0x4f, 0x63, 0xb1, 0x73, 0x73, 0x8c, 0x5a, 0xce, 0xfc, 0xde, 0x86, 0xdb,
+    0xde, 0x04, 0xfc, 0xde, 0x5a, 0xce, 0xb5, 0x8c, 0x12, 0x74, 0xd1, 0x6b, 0x82, 0xd2, 0x6b, 0x02,
+    0x91, 0x63, 0x12, 0x74, 0xbb, 0xd6, 0x8b, 0x1c, 0xe7, 0x02, 0xfc, 0xde, 0x12, 0x74, 0x50, 0x5b,
+    0x82, 0x90, 0x63, 0x07, 0x90, 0x5b, 0x6f, 0x5b, 0x4f, 0x63, 0xb0, 0x73, 0x32, 0x84, 0xb4, 0x94,
+    0x19, 0xbe, 0x7a, 0xce, 0x84, 0x5a, 0xce, 0x09, 0x7a, 0xce, 0x59, 0xc6, 0x56, 0xa5, 0x32, 0x7c,
+    0x90, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x53, 0x84, 0x2e, 0x53, 0x05,
+    0x0e, 0x53, 0xed, 0x52, 0xed, 0x5a, 0xaf, 0x73, 0x73, 0x8c, 0x9a, 0xd6, 0x85, 0x1c, 0xe7, 0x08,
+    0x5a, 0xc6, 0xd5, 0x8c, 0x94, 0x8c, 0x94, 0x84, 0x74, 0x84, 0x53, 0x7c, 0xf2, 0x73, 0x12, 0x74,
+    0xf2, 0x73, 0x81, 0xf2, 0x6b, 0x09, 0xf2, 0x73, 0x13, 0x74, 0xd1, 0x6b, 0x4f, 0x5b, 0x0e, 0x53,
+    0x2e, 0x53, 0x0e, 0x4b, 0xed, 0x52, 0x6f, 0x6b, 0x19, 0xc6, 0x8c, 0x1c, 0xe7, 0x02, 0x5a, 0xce,
+    0xb1, 0x63, 0xd1, 0x6b, 0x81, 0xd2, 0x6b, 0x02, 0xb1, 0x63, 0x32, 0x7c, 0xfc, 0xe6, 0x8c, 0x1c,
+    0xe7, 0x02, 0x53, 0x7c, 0x90, 0x63, 0x70, 0x5b, 0x82, 0x90, 0x63, 0x02, 0x6f, 0x63, 0xf0, 0x83,
+    0xfb, 0xde, 0x8b, 0x1c, 0xe7, 0x06, 0xdb, 0xde, 0x12, 0x74, 0x91, 0x63, 0xd1, 0x6b, 0xb1, 0x63,
+    0x90, 0x63, 0x4f, 0x5b, 0x84, 0x2e, 0x53, 0x03, 0x0e, 0x53, 0xac, 0x52, 0xd0, 0x83, 0xfb, 0xde,
+    0x8c, 0x1c, 0xe7, 0x02, 0x7a, 0xce, 0x74, 0x84, 0x12, 0x74, 0x83, 0xf2, 0x6b, 0x04, 0x12, 0x74,
+    0xd2, 0x6b, 0x4f, 0x5b, 0x0e, 0x53, 0x0e, 0x4b, 0x81, 0xed, 0x4a, 0x00, 0x73, 0x8c, 0x8d, 0x1c,
+    0xe7, 0x01, 0xdb, 0xde, 0x12, 0x74, 0x81, 0xd2, 0x6b, 0x02, 0xb1, 0x63, 0xd1, 0x73, 0x97, 0xb5,
+    0x8d, 0x1c, 0xe7, 0x03, 0xfc, 0xe6, 0x12, 0x74, 0x4f, 0x5b, 0x70, 0x5b, 0x81, 0x90, 0x63, 0x01,
+    0x11, 0x7c, 0xfb, 0xde, 0x8d, 0x1c, 0xe7, 0x05, 0x53, 0x7c, 0xb1, 0x63, 0xf2, 0x6b, 0xd1, 0x6b,
+    0x90, 0x63, 0x4f, 0x5b, 0x84, 0x2e, 0x53, 0x02, 0xed, 0x52, 0x6e, 0x6b, 0xdb, 0xde, 0x8e, 0x1c,
+    0xe7, 0x02, 0xfc, 0xde, 0x74, 0x7c, 0xb1, 0x63, 0x83, 0xf2, 0x6b, 0x06, 0xd2, 0x6b, 0x70, 0x5b,
+    0x2e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x0d, 0x4b, 0x72, 0x8c, 0x8e, 0x1c, 0xe7, 0x00, 0xb4, 0x8c,
+    0x81, 0xb1, 0x63, 0x01, 0x70, 0x5b, 0x12, 0x74, 0x82, 0x1c, 0xe7, 0x02, 0x9b, 0xd6, 0x16, 0x9d,
+    0xfc, 0xde, 0x84, 0x1c, 0xe7, 0x00, 0x5a, 0xc6, 0x83, 0x1c, 0xe7, 0x05, 0x15, 0x9d, 0x70, 0x5b,
+    0x50, 0x5b, 0x4f, 0x5b, 0xd1, 0x73, 0xdb, 0xde, 0x8e, 0x1c, 0xe7, 0x05, 0x33, 0x74, 0xb1, 0x63,
+    0xf2, 0x6b, 0xd1, 0x6b, 0x70, 0x5b, 0x2f, 0x53, 0x83, 0x2e, 0x53, 0x02, 0x0e, 0x4b, 0x0d, 0x53,
+    0x11, 0x84, 0x90, 0x1c, 0xe7, 0x02, 0x39, 0xc6, 0xb1, 0x63, 0x12, 0x74, 0x82, 0xf2, 0x6b, 0x06,
+    0xd2, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0x0d, 0x4b, 0xf1, 0x73, 0x8e, 0x1c,
+    0xe7, 0x05, 0xfc, 0xde, 0x33, 0x74, 0x91, 0x63, 0x70, 0x5b, 0x12, 0x74, 0xfc, 0xde, 0x81, 0x1c,
+    0xe7, 0x02, 0x33, 0x7c, 0xf2, 0x6b, 0x74, 0x84, 0x82, 0xb8, 0xad, 0x03, 0xd8, 0xb5, 0xb5, 0x8c,
+    0x13, 0x74, 0x53, 0x7c, 0x82, 0x1c, 0xe7, 0x04, 0x37, 0x9d, 0xd2, 0x6b, 0x2f, 0x53, 0xd1, 0x6b,
+    0xdb, 0xde, 0x8e, 0x1c, 0xe7, 0x05, 0xdb, 0xde, 0x13, 0x74, 0xd2, 0x6b, 0xf2, 0x73, 0xd1, 0x6b,
+    0x4f, 0x5b, 0x84, 0x2e, 0x53, 0x02, 0x0e, 0x4b, 0x0d, 0x53, 0x93, 0x94, 0x90, 0x1c, 0xe7, 0x02,
+    0xbb, 0xd6, 0xd2, 0x6b, 0x12, 0x74, 0x82, 0xf2, 0x6b, 0x02, 0xd2, 0x6b, 0xb1, 0x63, 0x2f, 0x53,
+    0x82, 0x0d, 0x4b, 0x00, 0x8f, 0x63, 0x8f, 0x1c, 0xe7, 0x0a, 0x9b, 0xd6, 0xb1, 0x63, 0x70, 0x5b,
+    0xd1, 0x6b, 0x74, 0x84, 0xf5, 0x94, 0x33, 0x7c, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd2, 0x6b,
+    0x82, 0xf2, 0x6b, 0x03, 0xb1, 0x63, 0x50, 0x5b, 0x4f, 0x5b, 0x12, 0x74, 0x81, 0x36, 0x9d, 0x03,
+    0x95, 0x84, 0xb1, 0x63, 0x70, 0x5b, 0x59, 0xc6, 0x8f, 0x1c, 0xe7, 0x00, 0xd5, 0x8c, 0x81, 0xf2,
+    0x6b, 0x02, 0xf3, 0x73, 0xb1, 0x63, 0x4f, 0x53, 0x84, 0x2e, 0x53, 0x02, 0xed, 0x4a, 0x4f, 0x63,
+    0xbb, 0xd6, 0x90, 0x1c, 0xe7, 0x02, 0xbb, 0xd6, 0x13, 0x74, 0xf2, 0x73, 0x82, 0xd2, 0x6b, 0x07,
+    0xf2, 0x6b, 0xd1, 0x6b, 0x4f, 0x53, 0x0d, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0x2e, 0x53, 0xfc, 0xe6,
+    0x8f, 0x1c, 0xe7, 0x02, 0x39, 0xc6, 0xb1, 0x63, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x82, 0xb1, 0x63,
+    0x83, 0x90, 0x63, 0x02, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x63, 0x81, 0x70, 0x5b, 0x04, 0xd1, 0x6b,
+    0xd2, 0x6b, 0xd1, 0x6b, 0xb1, 0x6b, 0x7a, 0xce, 0x90, 0x1c, 0xe7, 0x05, 0x33, 0x74, 0xf2, 0x6b,
+    0x13, 0x74, 0xf2, 0x6b, 0xb1, 0x63, 0x4f, 0x53, 0x84, 0x2e, 0x53, 0x02, 0xed, 0x52, 0xb0, 0x6b,
+    0xfc, 0xe6, 0x91, 0x1c, 0xe7, 0x04, 0xb5, 0x8c, 0xb1, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b,
+    0x81, 0xf2, 0x6b, 0x02, 0x6f, 0x5b, 0x0e, 0x53, 0x0e, 0x4b, 0x81, 0xed, 0x4a, 0x00, 0xd8, 0xb5,
+    0x90, 0x1c, 0xe7, 0x04, 0x36, 0x9d, 0xd1, 0x6b, 0x70, 0x5b, 0xd1, 0x63, 0xb0, 0x63, 0x82, 0xb1,
+    0x63, 0x00, 0xb0, 0x63, 0x85, 0x90, 0x63, 0x04, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0xb0, 0x63,
+    0x56, 0xa5, 0x90, 0x1c, 0xe7, 0x01, 0xfc, 0xde, 0xf2, 0x6b, 0x81, 0x13, 0x74, 0x01, 0xf2, 0x6b,
+    0x90, 0x5b, 0x84, 0x2e, 0x53, 0x03, 0x0e, 0x53, 0xed, 0x4a, 0x6f, 0x5b, 0x7a, 0xce, 0x91, 0x1c,
+    0xe7, 0x02, 0xb4, 0x84, 0xb1, 0x63, 0xd1, 0x6b, 0x81, 0xd2, 0x6b, 0x07, 0xf2, 0x6b, 0xd2, 0x6b,
+    0x90, 0x63, 0x2e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0xcd, 0x4a, 0xf1, 0x73, 0x91, 0x1c, 0xe7, 0x04,
+    0x9a, 0xce, 0x32, 0x74, 0x90, 0x63, 0x4f, 0x53, 0x90, 0x63, 0x81, 0xb1, 0x63, 0x86, 0x90, 0x63,
+    0x03, 0x90, 0x5b, 0x50, 0x5b, 0x90, 0x63, 0x5a, 0xce, 0x91, 0x1c, 0xe7, 0x05, 0x16, 0x95, 0xf3,
+    0x6b, 0x13, 0x74, 0x33, 0x74, 0xd1, 0x6b, 0x4f, 0x5b, 0x84, 0x2e, 0x53, 0x82, 0x0e, 0x53, 0x01,
+    0xd0, 0x6b, 0x9a, 0xce, 0x8f, 0x1c, 0xe7, 0x00, 0xf9, 0xbd, 0x81, 0xf2, 0x6b, 0x02, 0xd1, 0x6b,
+    0xd2, 0x6b, 0xd1, 0x6b, 0x81, 0xd2, 0x6b, 0x01, 0xb1, 0x63, 0x4f, 0x5b, 0x81, 0x0d, 0x4b, 0x02,
+    0xed, 0x4a, 0x2e, 0x53, 0xf5, 0x9c, 0x92, 0x1c, 0xe7, 0x03, 0xd8, 0xb5, 0x33, 0x7c, 0xf2, 0x73,
+    0xb1, 0x63, 0x85, 0x90, 0x63, 0x04, 0x70, 0x5b, 0x70, 0x63, 0x70, 0x5b, 0xf1, 0x73, 0xdb, 0xde,
+    0x91, 0x1c, 0xe7, 0x02, 0xfc, 0xde, 0x74, 0x7c, 0x13, 0x74, 0x81, 0x33, 0x74, 0x00, 0xb1, 0x63,
+    0x84, 0x2e, 0x53, 0x82, 0x0e, 0x53, 0x04, 0x2e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0x8f, 0x63, 0x39,
+    0xc6, 0x8b, 0x1c, 0xe7, 0x01, 0x19, 0xbe, 0x53, 0x7c, 0x86, 0xd1, 0x6b, 0x81, 0xd2, 0x6b, 0x05,
+    0x70, 0x5b, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0xed, 0x4a, 0xf1, 0x73, 0x94, 0x1c, 0xe7, 0x02,
+    0x9b, 0xd6, 0xd1, 0x6b, 0x70, 0x5b, 0x83, 0x90, 0x63, 0x04, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x63,
+    0xf1, 0x7b, 0xdb, 0xde, 0x92, 0x1c, 0xe7, 0x01, 0xf6, 0x94, 0x13, 0x74, 0x81, 0x33, 0x74, 0x02,
+    0xf2, 0x6b, 0x70, 0x5b, 0x0e, 0x53, 0x81, 0x2e, 0x53, 0x85, 0x0e, 0x53, 0x00, 0x0d, 0x4b, 0x81,
+    0xed, 0x4a, 0x01, 0x4f, 0x5b, 0xf1, 0x6b, 0x88, 0x1c, 0xe7, 0x04, 0xdb, 0xde, 0x94, 0x84, 0xf2,
+    0x6b, 0x90, 0x5b, 0xb1, 0x63, 0x86, 0xd1, 0x6b, 0x02, 0xd2, 0x6b, 0x91, 0x63, 0x4f, 0x53, 0x81,
+    0x0e, 0x53, 0x02, 0xed, 0x4a, 0x6f, 0x5b, 0x9a, 0xd6, 0x94, 0x1c, 0xe7, 0x02, 0x73, 0x84, 0x90,
+    0x63, 0x70, 0x5b, 0x82, 0x90, 0x63, 0x03, 0x6f, 0x5b, 0x2e, 0x5b, 0xaf, 0x73, 0xdb, 0xde, 0x92,
+    0x1c, 0xe7, 0x06, 0xbb, 0xd6, 0x74, 0x7c, 0x13, 0x74, 0x54, 0x7c, 0x33, 0x74, 0xb1, 0x63, 0x4f,
+    0x53, 0x83, 0x2e, 0x53, 0x82, 0x0e, 0x53, 0x00, 0x2e, 0x53, 0x82, 0x0e, 0x53, 0x00, 0x0e, 0x4b,
+    0x81, 0xcd, 0x42, 0x00, 0x9a, 0xce, 0x86, 0x1c, 0xe7, 0x03, 0x39, 0xc6, 0xf2, 0x6b, 0x70, 0x5b,
+    0xb1, 0x63, 0x81, 0xd1, 0x6b, 0x85, 0xb1, 0x63, 0x81, 0xd1, 0x6b, 0x03, 0xb1, 0x63, 0x70, 0x5b,
+    0x2e, 0x53, 0x0e, 0x53, 0x81, 0x2e, 0x53, 0x00, 0x11, 0x74, 0x94, 0x1c, 0xe7, 0x02, 0xb4, 0x8c,
+    0x90, 0x63, 0x70, 0x5b, 0x81, 0x90, 0x63, 0x03, 0x90, 0x5b, 0x2f, 0x5b, 0x4f, 0x6b, 0x76, 0xb5,
+    0x93, 0x1c, 0xe7, 0x01, 0xb5, 0x84, 0x34, 0x74, 0x81, 0x54, 0x7c, 0x02, 0x13, 0x74, 0x70, 0x5b,
+    0x0e, 0x53, 0x83, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x81, 0x0e, 0x4b, 0x00, 0x0e, 0x53, 0x81, 0xed,
+    0x4a, 0x00, 0xb3, 0x8c, 0x86, 0x1c, 0xe7, 0x01, 0xf2, 0x6b, 0x90, 0x63, 0x8b, 0xb1, 0x63, 0x02,
+    0xd1, 0x6b, 0xb0, 0x63, 0x4f, 0x5b, 0x81, 0x2e, 0x53, 0x02, 0x0e, 0x53, 0x2f, 0x53, 0x39, 0xc6,
+    0x93, 0x1c, 0xe7, 0x02, 0xb4, 0x8c, 0x90, 0x63, 0x70, 0x5b, 0x81, 0x90, 0x5b, 0x02, 0x70, 0x5b,
+    0x4f, 0x5b, 0x90, 0x6b, 0x93, 0x1c, 0xe7, 0x07, 0xbb, 0xd6, 0x54, 0x7c, 0x34, 0x74, 0x74, 0x7c,
+    0x34, 0x7c, 0xd1, 0x6b, 0x4f, 0x53, 0x0e, 0x53, 0x82, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x83, 0x0e,
+    0x4b, 0x02, 0xed, 0x4a, 0x0e, 0x53, 0x76, 0xad, 0x86, 0x1c, 0xe7, 0x00, 0x33, 0x7c, 0x8e, 0xb1,
+    0x63, 0x06, 0x90, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0xb0, 0x63, 0x5a, 0xce,
+    0x92, 0x1c, 0xe7, 0x01, 0x94, 0x84, 0x90, 0x63, 0x83, 0x70, 0x5b, 0x01, 0x4f, 0x5b, 0xb0, 0x6b,
+    0x92, 0x1c, 0xe7, 0x06, 0xdc, 0xde, 0x95, 0x84, 0x54, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x13, 0x74,
+    0x6f, 0x5b, 0x82, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x01, 0x0e, 0x4b, 0x0d, 0x4b, 0x81, 0x0e, 0x4b,
+    0x04, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x4e, 0x5b, 0xbb, 0xde, 0x86, 0x1c, 0xe7, 0x02, 0x9a,
+    0xce, 0xd1, 0x6b, 0x70, 0x5b, 0x8d, 0xb1, 0x63, 0x01, 0x6f, 0x5b, 0x2f, 0x53, 0x81, 0x4f, 0x5b,
+    0x02, 0x0e, 0x53, 0x11, 0x74, 0x9a, 0xce, 0x91, 0x1c, 0xe7, 0x01, 0x94, 0x84, 0x90, 0x63, 0x83,
+    0x70, 0x5b, 0x01, 0x4f, 0x5b, 0xb0, 0x73, 0x92, 0x1c, 0xe7, 0x08, 0xf6, 0x94, 0x34, 0x74, 0x75,
+    0x7c, 0x95, 0x84, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x83, 0x0e, 0x53,
+    0x01, 0x0e, 0x4b, 0x0d, 0x4b, 0x81, 0xcd, 0x42, 0x05, 0xed, 0x42, 0xed, 0x4a, 0x0e, 0x4b, 0x0d,
+    0x4b, 0xed, 0x4a, 0xb0, 0x73, 0x88, 0x1c, 0xe7, 0x01, 0x12, 0x74, 0x70, 0x5b, 0x85, 0xb1, 0x63,
+    0x00, 0x91, 0x63, 0x86, 0xb1, 0x63, 0x00, 0x90, 0x63, 0x84, 0x4f, 0x5b, 0x00, 0x12, 0x74, 0x91,
+    0x1c, 0xe7, 0x01, 0x94, 0x84, 0x90, 0x63, 0x83, 0x70, 0x5b, 0x01, 0x4f, 0x5b, 0xb0, 0x73, 0x91,
+    0x1c, 0xe7, 0x00, 0x17, 0x95, 0x81, 0x75, 0x7c, 0x03, 0x95, 0x84, 0x75, 0x7c, 0xf2, 0x6b, 0x4f,
+    0x5b, 0x81, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x09, 0xed, 0x52, 0x4e, 0x5b, 0xb0, 0x63, 0xd0, 0x6b,
+    0x8f, 0x5b, 0x2e, 0x53, 0xed, 0x4a, 0xcd, 0x4a, 0x4f, 0x5b, 0x93, 0x94, 0x88, 0x1c, 0xe7, 0x02,
+    0x94, 0x84, 0x90, 0x63, 0x70, 0x5b, 0x81, 0x90, 0x5b, 0x04, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x63,
+    0x91, 0x63, 0x90, 0x63, 0x86, 0xb1, 0x63, 0x00, 0x90, 0x63, 0x82, 0x4f, 0x5b, 0x02, 0x4f, 0x53,
+    0x4f, 0x5b, 0xd8, 0xb5, 0x90, 0x1c, 0xe7, 0x01, 0x94, 0x84, 0x90, 0x63, 0x83, 0x70, 0x5b, 0x01,
+    0x4f, 0x5b, 0xb0, 0x6b, 0x90, 0x1c, 0xe7, 0x00, 0x1a, 0xbe, 0x81, 0x75, 0x7c, 0x81, 0x95, 0x84,
+    0x01, 0x33, 0x74, 0x90, 0x5b, 0x81, 0x0e, 0x53, 0x00, 0x2e, 0x53, 0x82, 0x0e, 0x53, 0x0a, 0x0e,
+    0x4b, 0xcd, 0x4a, 0xed, 0x5a, 0x52, 0x8c, 0xdb, 0xde, 0xfc, 0xe6, 0x56, 0xa5, 0x52, 0x7c, 0x11,
+    0x74, 0xd0, 0x6b, 0x32, 0x84, 0x8a, 0x1c, 0xe7, 0x0a, 0x12, 0x74, 0x70, 0x5b, 0x90, 0x63, 0xb1,
+    0x63, 0xd1, 0x6b, 0xf1, 0x73, 0x73, 0x8c, 0x15, 0xa5, 0x12, 0x74, 0x90, 0x63, 0x91, 0x63, 0x82,
+    0xb1, 0x63, 0x03, 0x90, 0x63, 0xb1, 0x63, 0xb0, 0x63, 0x70, 0x5b, 0x81, 0x4f, 0x5b, 0x03, 0x90,
+    0x5b, 0x4f, 0x5b, 0x90, 0x63, 0x56, 0xa5, 0x8f, 0x1c, 0xe7, 0x02, 0x94, 0x84, 0x90, 0x63, 0x6f,
+    0x5b, 0x82, 0x70, 0x5b, 0x01, 0x4f, 0x5b, 0xb0, 0x6b, 0x8f, 0x1c, 0xe7, 0x00, 0x99, 0xad, 0x81,
+    0x95, 0x84, 0x03, 0xb6, 0x84, 0x95, 0x84, 0x54, 0x7c, 0x90, 0x63, 0x81, 0x0e, 0x53, 0x00, 0x2e,
+    0x53, 0x82, 0x0e, 0x53, 0x81, 0x0e, 0x4b, 0x01, 0x2e, 0x5b, 0x55, 0xad, 0x93, 0x1c, 0xe7, 0x01,
+    0x77, 0xa5, 0xd8, 0xb5, 0x81, 0xf8, 0xbd, 0x00, 0x59, 0xce, 0x81, 0x1c, 0xe7, 0x03, 0x9a, 0xd6,
+    0x94, 0x84, 0xb0, 0x63, 0x70, 0x5b, 0x85, 0x90, 0x63, 0x82, 0x70, 0x5b, 0x03, 0x90, 0x63, 0x4f,
+    0x5b, 0xb0, 0x63, 0x16, 0x9d, 0x8e, 0x1c, 0xe7, 0x02, 0x94, 0x84, 0x90, 0x63, 0x6f, 0x5b, 0x82,
+    0x70, 0x5b, 0x01, 0x4f, 0x5b, 0xb0, 0x6b, 0x8e, 0x1c, 0xe7, 0x00, 0xd9, 0xb5, 0x81, 0x96, 0x84,
+    0x81, 0xb6, 0x84, 0x04, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x83, 0x0e,
+    0x53, 0x03, 0x0e, 0x4b, 0xed, 0x52, 0xf0, 0x7b, 0xfc, 0xe6, 0x9c, 0x1c, 0xe7, 0x01, 0x12, 0x74,
+    0x70, 0x5b, 0x86, 0x90, 0x63, 0x82, 0x70, 0x5b, 0x00, 0x90, 0x63, 0x81, 0x70, 0x5b, 0x01, 0x32,
+    0x7c, 0x9a, 0xce, 0x8c, 0x1c, 0xe7, 0x02, 0x94, 0x84, 0x90, 0x5b, 0x4f, 0x5b, 0x81, 0x70, 0x5b,
+    0x02, 0x6f, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x8c, 0x1c, 0xe7, 0x02, 0xfc, 0xde, 0xf7, 0x94, 0x75,
+    0x7c, 0x82, 0xb6, 0x84, 0x04, 0x75, 0x7c, 0xd1, 0x6b, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x83,
+    0x0e, 0x53, 0x03, 0x0e, 0x4b, 0xed, 0x4a, 0x4e, 0x6b, 0x59, 0xce, 0x9d, 0x1c, 0xe7, 0x02, 0x39,
+    0xc6, 0xd1, 0x6b, 0x70, 0x5b, 0x86, 0x90, 0x63, 0x81, 0x70, 0x5b, 0x01, 0x90, 0x63, 0xb1, 0x63,
+    0x81, 0x90, 0x63, 0x01, 0x12, 0x74, 0x5a, 0xc6, 0x8b, 0x1c, 0xe7, 0x02, 0x93, 0x84, 0x70, 0x5b,
+    0x4f, 0x5b, 0x82, 0x6f, 0x5b, 0x01, 0x4f, 0x5b, 0xb0, 0x6b, 0x8b, 0x1c, 0xe7, 0x09, 0x5a, 0xc6,
+    0xd6, 0x8c, 0x96, 0x84, 0xb6, 0x84, 0xd6, 0x8c, 0xb6, 0x84, 0x75, 0x7c, 0xd1, 0x6b, 0x2e, 0x53,
+    0x0e, 0x53, 0x81, 0x2e, 0x53, 0x82, 0x0e, 0x53, 0x03, 0x2e, 0x53, 0x0d, 0x4b, 0xed, 0x5a, 0xf0,
+    0x83, 0x9f, 0x1c, 0xe7, 0x02, 0x77, 0xa5, 0x90, 0x63, 0x70, 0x5b, 0x86, 0x90, 0x63, 0x00, 0x70,
+    0x5b, 0x81, 0x90, 0x63, 0x81, 0xb1, 0x63, 0x02, 0x70, 0x5b, 0xf2, 0x6b, 0x77, 0xa5, 0x8a, 0x1c,
+    0xe7, 0x02, 0x93, 0x84, 0x70, 0x5b, 0x4f, 0x5b, 0x81, 0x6f, 0x5b, 0x81, 0x4f, 0x5b, 0x00, 0xb0,
+    0x6b, 0x89, 0x1c, 0xe7, 0x04, 0xfc, 0xde, 0x57, 0x9d, 0x96, 0x84, 0x75, 0x7c, 0x96, 0x84, 0x81,
+    0xd7, 0x8c, 0x02, 0x75, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x81, 0x0e, 0x53, 0x00, 0x2e, 0x53, 0x84,
+    0x0e, 0x53, 0x02, 0xcd, 0x4a, 0x4e, 0x63, 0x7a, 0xd6, 0x9f, 0x1c, 0xe7, 0x00, 0x19, 0xbe, 0x81,
+    0x70, 0x5b, 0x85, 0x90, 0x63, 0x81, 0x70, 0x5b, 0x81, 0x90, 0x63, 0x81, 0xb1, 0x63, 0x00, 0xd1,
+    0x6b, 0x81, 0xb1, 0x63, 0x01, 0xf2, 0x6b, 0xd8, 0xb5, 0x88, 0x1c, 0xe7, 0x02, 0x94, 0x84, 0x70,
+    0x5b, 0x4f, 0x5b, 0x81, 0x6f, 0x5b, 0x02, 0x4f, 0x5b, 0x2f, 0x5b, 0xb0, 0x6b, 0x88, 0x1c, 0xe7,
+    0x00, 0x7a, 0xc6, 0x81, 0x75, 0x7c, 0x08, 0x95, 0x84, 0xb6, 0x84, 0xb6, 0x8c, 0xb6, 0x84, 0x54,
+    0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0d, 0x53, 0x2e, 0x53, 0x85, 0x0e, 0x53, 0x03, 0x0e, 0x4b, 0xcd,
+    0x4a, 0x4f, 0x5b, 0xdb, 0xde, 0x9f, 0x1c, 0xe7, 0x01, 0x73, 0x84, 0x4f, 0x5b, 0x82, 0x70, 0x5b,
+    0x81, 0x90, 0x63, 0x84, 0x70, 0x5b, 0x00, 0x90, 0x63, 0x81, 0xb1, 0x63, 0x07, 0xd1, 0x6b, 0xd2,
+    0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x94, 0x84, 0xdb, 0xde, 0x85, 0x1c, 0xe7,
+    0x01, 0x93, 0x84, 0x70, 0x5b, 0x83, 0x4f, 0x5b, 0x01, 0x2e, 0x53, 0x90, 0x6b, 0x85, 0x1c, 0xe7,
+    0x05, 0xbb, 0xd6, 0xd6, 0x8c, 0x95, 0x84, 0x75, 0x84, 0x75, 0x7c, 0x95, 0x84, 0x81, 0xb6, 0x84,
+    0x02, 0x96, 0x84, 0x33, 0x74, 0x90, 0x5b, 0x81, 0x0e, 0x53, 0x81, 0x2e, 0x53, 0x85, 0x0e, 0x53,
+    0x03, 0x0e, 0x4b, 0xed, 0x4a, 0x0e, 0x53, 0xf1, 0x6b, 0x9e, 0x1c, 0xe7, 0x02, 0xf8, 0xbd, 0xb1,
+    0x63, 0x50, 0x5b, 0x81, 0x70, 0x5b, 0x01, 0x90, 0x5b, 0x90, 0x63, 0x86, 0x70, 0x5b, 0x03, 0x90,
+    0x63, 0x91, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0x81, 0xf2, 0x6b, 0x06, 0xd2, 0x6b, 0xd2, 0x63, 0xf2,
+    0x6b, 0x74, 0x7c, 0xf6, 0x94, 0x7a, 0xce, 0xfc, 0xde, 0x82, 0x1c, 0xe7, 0x00, 0x32, 0x7c, 0x84,
+    0x4f, 0x5b, 0x02, 0x2e, 0x53, 0x90, 0x6b, 0x59, 0xc6, 0x81, 0x1c, 0xe7, 0x0d, 0xfc, 0xde, 0x19,
+    0xbe, 0xd6, 0x8c, 0x75, 0x84, 0x34, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0xb6, 0x84, 0x96,
+    0x84, 0x54, 0x7c, 0xd2, 0x6b, 0x6f, 0x5b, 0x2e, 0x53, 0x81, 0x0e, 0x53, 0x00, 0x2e, 0x53, 0x85,
+    0x0e, 0x53, 0x83, 0x0e, 0x4b, 0x01, 0x2e, 0x53, 0x52, 0x7c, 0x9c, 0x1c, 0xe7, 0x03, 0xdb, 0xde,
+    0x90, 0x63, 0x4f, 0x53, 0x90, 0x5b, 0x8b, 0x70, 0x5b, 0x04, 0x90, 0x5b, 0x90, 0x63, 0xb1, 0x63,
+    0xd2, 0x6b, 0xf2, 0x6b, 0x82, 0x13, 0x74, 0x00, 0xf2, 0x6b, 0x81, 0xd2, 0x6b, 0x04, 0x13, 0x74,
+    0xb5, 0x84, 0xf9, 0xb5, 0xf9, 0xbd, 0xd1, 0x6b, 0x85, 0x4f, 0x5b, 0x08, 0x90, 0x63, 0x53, 0x7c,
+    0xd5, 0x8c, 0x95, 0x84, 0x13, 0x74, 0xf3, 0x6b, 0x13, 0x74, 0x54, 0x74, 0x74, 0x7c, 0x82, 0x95,
+    0x84, 0x03, 0x54, 0x7c, 0xf2, 0x6b, 0x90, 0x63, 0x4e, 0x53, 0x81, 0x0e, 0x53, 0x81, 0x2e, 0x53,
+    0x85, 0x0e, 0x53, 0x82, 0x0e, 0x4b, 0x04, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x4f, 0x5b, 0x56,
+    0xa5, 0x9a, 0x1c, 0xe7, 0x01, 0xfc, 0xde, 0x32, 0x74, 0x91, 0x70, 0x5b, 0x02, 0xb1, 0x63, 0xd1,
+    0x6b, 0xf2, 0x6b, 0x81, 0x13, 0x74, 0x84, 0x33, 0x74, 0x02, 0x34, 0x74, 0x13, 0x74, 0x90, 0x5b,
+    0x83, 0x4f, 0x5b, 0x03, 0x2f, 0x53, 0x4f, 0x5b, 0x91, 0x63, 0xf2, 0x6b, 0x81, 0x13, 0x74, 0x00,
+    0x33, 0x74, 0x81, 0x54, 0x7c, 0x00, 0x74, 0x7c, 0x81, 0x54, 0x7c, 0x04, 0x34, 0x74, 0x12, 0x74,
+    0xb1, 0x63, 0x4f, 0x53, 0x0e, 0x53, 0x83, 0x2e, 0x53, 0x83, 0x0e, 0x53, 0x01, 0x0e, 0x4b, 0x0e,
+    0x53, 0x84, 0x0e, 0x4b, 0x03, 0x0e, 0x53, 0x0e, 0x4b, 0xcc, 0x42, 0xb3, 0x8c, 0x9a, 0x1c, 0xe7,
+    0x03, 0xf5, 0x94, 0x90, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x8e, 0x70, 0x5b, 0x81, 0x6f, 0x5b, 0x04,
+    0x70, 0x5b, 0x90, 0x63, 0xd2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x81, 0x33, 0x74, 0x82, 0x54, 0x7c,
+    0x01, 0x33, 0x74, 0x90, 0x63, 0x83, 0x4f, 0x5b, 0x03, 0x2f, 0x53, 0x4f, 0x5b, 0x91, 0x63, 0xf3,
+    0x6b, 0x82, 0x33, 0x74, 0x00, 0x34, 0x74, 0x81, 0x54, 0x7c, 0x03, 0x13, 0x74, 0xd2, 0x6b, 0x90,
+    0x5b, 0x4f, 0x53, 0x83, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x81, 0x0e, 0x4b, 0x82, 0xed, 0x4a, 0x01,
+    0x0e, 0x4b, 0x0e, 0x53, 0x81, 0x0e, 0x4b, 0x03, 0x0e, 0x53, 0x0e, 0x4b, 0xac, 0x3a, 0xb0, 0x63,
+    0x9a, 0x1c, 0xe7, 0x02, 0x73, 0x84, 0x4f, 0x53, 0x4f, 0x5b, 0x87, 0x70, 0x5b, 0x82, 0x4f, 0x5b,
+    0x01, 0x6f, 0x5b, 0x70, 0x5b, 0x83, 0x6f, 0x5b, 0x81, 0x4f, 0x5b, 0x0a, 0x6f, 0x5b, 0x70, 0x5b,
+    0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0x12, 0x6c, 0x33, 0x74, 0x54, 0x7c, 0x95, 0x84, 0x54, 0x7c,
+    0x90, 0x63, 0x82, 0x4f, 0x5b, 0x81, 0x2f, 0x53, 0x0c, 0x4f, 0x5b, 0x91, 0x63, 0x13, 0x74, 0x33,
+    0x74, 0x13, 0x74, 0xf2, 0x73, 0xf2, 0x6b, 0xd1, 0x63, 0x90, 0x63, 0x6f, 0x5b, 0x4f, 0x5b, 0x2e,
+    0x53, 0x0e, 0x53, 0x83, 0x2e, 0x53, 0x83, 0x0e, 0x53, 0x05, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x52,
+    0x2e, 0x5b, 0x2e, 0x53, 0xed, 0x4a, 0x82, 0x0e, 0x4b, 0x04, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b,
+    0xed, 0x4a, 0x52, 0x7c, 0x9a, 0x1c, 0xe7, 0x03, 0x36, 0x9d, 0x90, 0x63, 0x2f, 0x53, 0x70, 0x5b,
+    0x83, 0x6f, 0x5b, 0x07, 0x70, 0x5b, 0x4f, 0x5b, 0x2e, 0x5b, 0x6f, 0x63, 0x90, 0x63, 0x4f, 0x53,
+    0x2f, 0x53, 0x70, 0x5b, 0x82, 0x6f, 0x5b, 0x00, 0x4f, 0x5b, 0x81, 0x6f, 0x5b, 0x83, 0x4f, 0x5b,
+    0x07, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x70, 0x5b, 0x4f,
+    0x5b, 0x83, 0x2f, 0x53, 0x01, 0x4f, 0x5b, 0x70, 0x5b, 0x82, 0xb1, 0x63, 0x02, 0x90, 0x63, 0x70,
+    0x5b, 0x4f, 0x5b, 0x81, 0x0e, 0x53, 0x84, 0x2e, 0x53, 0x85, 0x0e, 0x53, 0x0d, 0xed, 0x4a, 0x2e,
+    0x63, 0xd0, 0x7b, 0x39, 0xce, 0x9a, 0xd6, 0x11, 0x74, 0x0e, 0x4b, 0xcd, 0x42, 0x0e, 0x53, 0x0e,
+    0x4b, 0x0d, 0x4b, 0xcd, 0x42, 0xb0, 0x6b, 0x19, 0xc6, 0x9b, 0x1c, 0xe7, 0x0f, 0x73, 0x84, 0x70,
+    0x5b, 0x2f, 0x53, 0x6f, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x6f, 0x63, 0xb0,
+    0x7b, 0xd4, 0x9c, 0x15, 0x9d, 0x73, 0x84, 0xb0, 0x63, 0x4f, 0x5b, 0x2f, 0x53, 0x81, 0x6f, 0x5b,
+    0x88, 0x4f, 0x5b, 0x00, 0x4f, 0x53, 0x85, 0x4f, 0x5b, 0x00, 0x2f, 0x53, 0x83, 0x4f, 0x53, 0x00,
+    0x2f, 0x53, 0x8a, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x04, 0x2e, 0x53, 0xed, 0x52, 0x4e, 0x63, 0x52,
+    0x8c, 0xdb, 0xde, 0x81, 0x1c, 0xe7, 0x07, 0xfc, 0xe6, 0x32, 0x7c, 0x2e, 0x53, 0xed, 0x4a, 0xcd,
+    0x42, 0x0e, 0x53, 0xb0, 0x6b, 0x76, 0xad, 0x9d, 0x1c, 0xe7, 0x08, 0x73, 0x84, 0x90, 0x63, 0x2f,
+    0x53, 0x4f, 0x5b, 0x2f, 0x53, 0x6f, 0x5b, 0xd0, 0x73, 0x93, 0x94, 0xfc, 0xe6, 0x82, 0x1c, 0xe7,
+    0x03, 0x39, 0xc6, 0x11, 0x74, 0x2f, 0x53, 0x4f, 0x53, 0x88, 0x4f, 0x5b, 0x86, 0x2f, 0x53, 0x81,
+    0x4f, 0x53, 0x83, 0x2f, 0x53, 0x89, 0x2e, 0x53, 0x84, 0x0e, 0x53, 0x04, 0x2e, 0x53, 0x0d, 0x53,
+    0xcc, 0x52, 0x6f, 0x73, 0x59, 0xce, 0x85, 0x1c, 0xe7, 0x04, 0x7a, 0xce, 0x4e, 0x5b, 0xd0, 0x6b,
+    0x11, 0x7c, 0x59, 0xce, 0x9f, 0x1c, 0xe7, 0x05, 0x56, 0x9d, 0xb1, 0x6b, 0x4f, 0x5b, 0xd1, 0x6b,
+    0x93, 0x8c, 0xfc, 0xde, 0x86, 0x1c, 0xe7, 0x02, 0x73, 0x84, 0x6f, 0x5b, 0x2e, 0x53, 0x8a, 0x4f,
+    0x5b, 0x85, 0x4f, 0x53, 0x82, 0x2f, 0x53, 0x88, 0x2e, 0x53, 0x86, 0x0e, 0x53, 0x03, 0x0e, 0x4b,
+    0xcc, 0x4a, 0x4e, 0x6b, 0x59, 0xce, 0xac, 0x1c, 0xe7, 0x02, 0x19, 0xbe, 0xb7, 0xb5, 0x59, 0xc6,
+    0x88, 0x1c, 0xe7, 0x02, 0x97, 0xad, 0x90, 0x63, 0x0e, 0x53, 0x8a, 0x4f, 0x5b, 0x84, 0x4f, 0x53,
+    0x82, 0x2f, 0x53, 0x89, 0x2e, 0x53, 0x86, 0x0e, 0x53, 0x02, 0x0d, 0x4b, 0xed, 0x52, 0xb3, 0x94,
+    0xb9, 0x1c, 0xe7, 0x03, 0x36, 0x9d, 0x90, 0x63, 0x0e, 0x53, 0x2f, 0x53, 0x84, 0x4f, 0x5b, 0x00,
+    0x4f, 0x53, 0x89, 0x2f, 0x53, 0x87, 0x2e, 0x53, 0x81, 0x0e, 0x53, 0x00, 0x0e, 0x4b, 0x87, 0x0e,
+    0x53, 0x02, 0xed, 0x4a, 0x0e, 0x53, 0x56, 0xa5, 0xb9, 0x1c, 0xe7, 0x04, 0x32, 0x7c, 0x4f, 0x5b,
+    0x2e, 0x53, 0x2f, 0x53, 0x4f, 0x5b, 0x81, 0x2f, 0x53, 0x81, 0x4f, 0x5b, 0x02, 0x4f, 0x53, 0x2f,
+    0x53, 0x4f, 0x53, 0x84, 0x2f, 0x53, 0x88, 0x2e, 0x53, 0x03, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53,
+    0x2e, 0x53, 0x81, 0xed, 0x4a, 0x84, 0x0e, 0x53, 0x81, 0x0e, 0x4b, 0x02, 0x0d, 0x4b, 0x0e, 0x4b,
+    0x35, 0x9d, 0xb9, 0x1c, 0xe7, 0x02, 0x90, 0x63, 0x2f, 0x53, 0x4f, 0x53, 0x81, 0x4f, 0x5b, 0x82,
+    0x4f, 0x53, 0x08, 0x2f, 0x53, 0x0e, 0x53, 0xed, 0x52, 0x6f, 0x63, 0xd0, 0x6b, 0xb0, 0x63, 0x4f,
+    0x5b, 0x2e, 0x53, 0x4f, 0x53, 0x86, 0x2e, 0x53, 0x81, 0x0e, 0x53, 0x07, 0xed, 0x52, 0x4e, 0x5b,
+    0x8f, 0x6b, 0xd0, 0x73, 0x52, 0x84, 0x73, 0x84, 0x6f, 0x63, 0xcd, 0x4a, 0x81, 0x0e, 0x53, 0x81,
+    0x0e, 0x4b, 0x03, 0x0e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0x73, 0x84, 0xb8, 0x1c, 0xe7, 0x02, 0xdb,
+    0xde, 0x4f, 0x5b, 0x0e, 0x53, 0x81, 0x4f, 0x5b, 0x83, 0x4f, 0x53, 0x07, 0x0e, 0x53, 0xed, 0x5a,
+    0xd0, 0x7b, 0x7a, 0xd6, 0xfc, 0xde, 0xdb, 0xde, 0x97, 0xad, 0x6f, 0x5b, 0x86, 0x2e, 0x53, 0x06,
+    0x0e, 0x53, 0xed, 0x52, 0x2e, 0x5b, 0xd0, 0x7b, 0x9a, 0xd6, 0xfb, 0xde, 0xdb, 0xde, 0x81, 0x1c,
+    0xe7, 0x02, 0x18, 0xbe, 0x0e, 0x4b, 0x0d, 0x4b, 0x82, 0x0e, 0x4b, 0x04, 0x0e, 0x53, 0x0e, 0x4b,
+    0xcd, 0x42, 0xb0, 0x63, 0x9a, 0xd6, 0xb7, 0x1c, 0xe7, 0x04, 0xd4, 0x8c, 0x2f, 0x53, 0x0e, 0x53,
+    0x4f, 0x5b, 0x4f, 0x53, 0x82, 0x2f, 0x53, 0x03, 0x2e, 0x53, 0x0e, 0x53, 0x8f, 0x73, 0xbb, 0xde,
+    0x83, 0x1c, 0xe7, 0x02, 0xd0, 0x6b, 0x2e, 0x53, 0x0e, 0x53, 0x84, 0x2e, 0x53, 0x03, 0xed, 0x4a,
+    0xed, 0x52, 0xd0, 0x7b, 0xfc, 0xe6, 0x85, 0x1c, 0xe7, 0x00, 0x32, 0x74, 0x81, 0xed, 0x4a, 0x00,
+    0x0e, 0x53, 0x81, 0x0e, 0x4b, 0x03, 0x0d, 0x4b, 0xed, 0x4a, 0x6f, 0x5b, 0x35, 0xa5, 0xb7, 0x1c,
+    0xe7, 0x03, 0xd8, 0xb5, 0x2e, 0x53, 0xed, 0x4a, 0x2e, 0x53, 0x82, 0x2f, 0x53, 0x03, 0x2e, 0x53,
+    0x0e, 0x53, 0x6f, 0x63, 0xf8, 0xc5, 0x84, 0x1c, 0xe7, 0x02, 0x32, 0x74, 0x4f, 0x5b, 0x0e, 0x4b,
+    0x82, 0x2e, 0x53, 0x81, 0x0e, 0x53, 0x02, 0xed, 0x4a, 0x2e, 0x63, 0x56, 0xad, 0x86, 0x1c, 0xe7,
+    0x02, 0x59, 0xc6, 0x2e, 0x53, 0xcd, 0x42, 0x81, 0x0e, 0x4b, 0x81, 0xed, 0x4a, 0x02, 0xcd, 0x42,
+    0xb0, 0x6b, 0xdb, 0xde, 0xb8, 0x1c, 0xe7, 0x08, 0x52, 0x7c, 0x6f, 0x5b, 0xee, 0x4a, 0xed, 0x4a,
+    0x0e, 0x4b, 0x2e, 0x53, 0xee, 0x4a, 0x2e, 0x5b, 0x32, 0x84, 0x85, 0x1c, 0xe7, 0x04, 0x93, 0x8c,
+    0x6f, 0x5b, 0xed, 0x4a, 0x0e, 0x53, 0x2e, 0x53, 0x81, 0x0e, 0x53, 0x03, 0x0e, 0x4b, 0xed, 0x4a,
+    0x6f, 0x63, 0xfc, 0xe6, 0x87, 0x1c, 0xe7, 0x07, 0x12, 0x74, 0xcd, 0x42, 0xac, 0x42, 0xcd, 0x4a,
+    0x0e, 0x53, 0x4f, 0x5b, 0xf1, 0x73, 0xbb, 0xd6, 0xba, 0x1c, 0xe7, 0x07, 0x59, 0xc6, 0x52, 0x7c,
+    0xd1, 0x6b, 0x6f, 0x5b, 0x2e, 0x53, 0x6f, 0x5b, 0x52, 0x84, 0xdb, 0xde, 0x85, 0x1c, 0xe7, 0x02,
+    0xf5, 0x94, 0x6f, 0x5b, 0xed, 0x4a, 0x82, 0x0e, 0x53, 0x03, 0x2e, 0x53, 0x0e, 0x4b, 0x0e, 0x53,
+    0x6f, 0x6b, 0x88, 0x1c, 0xe7, 0x05, 0xdb, 0xde, 0x52, 0x7c, 0xb0, 0x6b, 0x12, 0x74, 0xb3, 0x8c,
+    0xbb, 0xd6, 0xbf, 0x1c, 0xe7, 0x02, 0x15, 0x9d, 0x11, 0x74, 0x9a, 0xd6, 0x87, 0x1c, 0xe7, 0x02,
+    0x56, 0x9d, 0x4f, 0x5b, 0xcd, 0x42, 0x82, 0x0d, 0x4b, 0x03, 0x0e, 0x4b, 0xed, 0x4a, 0x0e, 0x53,
+    0xd0, 0x73, 0xda, 0x1c, 0xe7, 0x01, 0x8f, 0x63, 0xed, 0x4a, 0x82, 0x0d, 0x4b, 0x03, 0xed, 0x4a,
+    0xcd, 0x4a, 0x4f, 0x5b, 0x93, 0x94, 0xda, 0x1c, 0xe7, 0x01, 0xd8, 0xb5, 0x11, 0x74, 0x82, 0x52,
+    0x7c, 0x02, 0x32, 0x7c, 0xd0, 0x6b, 0x73, 0x84, 0xff, 0x1c, 0xe7, 0x91, 0x1c, 0xe7,
+};
+
+const lv_image_dsc_t test_image_cogwheel_rgb565_rle = {
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.always_zero = 0,
+    .header.compress = LV_IMAGE_COMPRESS_RLE,
+    .header.w = 100,
+    .header.h = 100,
+    .data_size = 8414,
+    .data = test_image_cogwheel_rgb565_rle_map,
+};
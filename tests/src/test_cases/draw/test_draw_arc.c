@@ -123,4 +123,24 @@ void test_image_arc(void)
     draw_arcs(&arc_dsc, "image");
 }
 
+void test_image_arc_from_file(void)
+{
+    /*Uncompressed binary image files are decoded part by part. The arcs need to look the same.*/
+    LV_IMAGE_DECLARE(test_arc_bg);
+    lv_image_header_t header = test_arc_bg.header;
+    header.stride = header.w * lv_color_format_get_size(header.cf);
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:test_arc_bg.bin", LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, &header, sizeof(header), NULL));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, test_arc_bg.data, header.stride * header.h, NULL));
+    lv_fs_close(&f);
+
+    lv_draw_arc_dsc_t arc_dsc;
+    lv_draw_arc_dsc_init(&arc_dsc);
+    arc_dsc.img_src = "A:test_arc_bg.bin";
+
+    draw_arcs(&arc_dsc, "image");
+}
+
 #endif
@@ -0,0 +1,214 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_draw_path_t path;
+
+void setUp(void)
+{
+    lv_draw_path_init(&path);
+}
+
+void tearDown(void)
+{
+    lv_draw_path_reset(&path);
+    lv_obj_clean(lv_scr_act());
+}
+
+static void move_to(lv_coord_t x, lv_coord_t y)
+{
+    lv_point_t p = {x, y};
+    lv_draw_path_move_to(&path, &p);
+}
+
+static void line_to(lv_coord_t x, lv_coord_t y)
+{
+    lv_point_t p = {x, y};
+    lv_draw_path_line_to(&path, &p);
+}
+
+static void star(lv_coord_t x, lv_coord_t y)
+{
+    move_to(x + 40, y);
+    line_to(x + 64, y + 75);
+    line_to(x, y + 28);
+    line_to(x + 80, y + 28);
+    line_to(x + 16, y + 75);
+    lv_draw_path_close(&path);
+}
+
+static void polyline(lv_coord_t x, lv_coord_t y)
+{
+    move_to(x, y + 40);
+    line_to(x + 30, y);
+    line_to(x + 60, y + 40);
+    line_to(x + 90, y + 10);
+    line_to(x + 100, y + 40);
+}
+
+void test_draw_path_api(void)
+{
+    move_to(10, 20);
+    line_to(30, 40);
+    lv_point_t cp = {50, 0};
+    lv_point_t p = {70, 40};
+    lv_draw_path_quad_to(&path, &cp, &p);
+    lv_draw_path_close(&path);
+
+    TEST_ASSERT_EQUAL_UINT32(4, path.op_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, path.point_cnt);
+    TEST_ASSERT_EQUAL(LV_DRAW_PATH_OP_QUAD_TO, path.ops[2]);
+
+    lv_area_t a;
+    TEST_ASSERT_TRUE(lv_draw_path_get_area(&path, &a));
+    TEST_ASSERT_EQUAL_INT32(10, a.x1);
+    TEST_ASSERT_EQUAL_INT32(0, a.y1);
+    TEST_ASSERT_EQUAL_INT32(70, a.x2);
+    TEST_ASSERT_EQUAL_INT32(40, a.y2);
+
+    lv_draw_path_reset(&path);
+    TEST_ASSERT_EQUAL_UINT32(0, path.op_cnt);
+    TEST_ASSERT_FALSE(lv_draw_path_get_area(&path, &a));
+}
+
+void test_draw_path(void)
+{
+    static uint8_t canvas_buf[760 * 440 * 4];
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_obj_center(canvas);
+    lv_canvas_set_buffer(canvas, canvas_buf, 760, 440, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_palette_lighten(LV_PALETTE_RED, 2), LV_OPA_50);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_path_dsc_t dsc;
+    lv_draw_path_dsc_init(&dsc);
+    dsc.path = &path;
+
+    /*Fill rules*/
+    dsc.fill_color = lv_palette_main(LV_PALETTE_BLUE);
+    star(10, 10);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    dsc.fill_rule = LV_DRAW_PATH_FILL_EVENODD;
+    star(110, 10);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    /*Fill and stroke with opacity*/
+    dsc.fill_rule = LV_DRAW_PATH_FILL_NONZERO;
+    dsc.fill_opa = LV_OPA_50;
+    dsc.stroke_width = 3;
+    dsc.stroke_opa = LV_OPA_70;
+    dsc.stroke_color = lv_palette_darken(LV_PALETTE_BLUE, 3);
+    star(210, 10);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    /*Curves with gradient*/
+    dsc.fill_opa = LV_OPA_COVER;
+    dsc.stroke_width = 0;
+    dsc.fill_grad.dir = LV_GRAD_DIR_VER;
+    dsc.fill_grad.stops[0].color = lv_palette_main(LV_PALETTE_GREEN);
+    dsc.fill_grad.stops[0].opa = LV_OPA_COVER;
+    dsc.fill_grad.stops[1].color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc.fill_grad.stops[1].opa = LV_OPA_20;
+    lv_point_t cp1 = {340, -20};
+    lv_point_t cp2 = {380, 150};
+    lv_point_t end = {420, 85};
+    move_to(310, 85);
+    lv_draw_path_cubic_to(&path, &cp1, &cp2, &end);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    dsc.fill_grad.dir = LV_GRAD_DIR_HOR;
+    lv_point_t cp = {485, -40};
+    lv_point_t qend = {540, 85};
+    move_to(430, 85);
+    lv_draw_path_quad_to(&path, &cp, &qend);
+    lv_draw_path_close(&path);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    /*A ring with a hole. The inner circle is drawn in the other direction*/
+    dsc.fill_grad.dir = LV_GRAD_DIR_NONE;
+    dsc.fill_color = lv_palette_main(LV_PALETTE_ORANGE);
+    lv_point_t c[] = {
+        {650, 10}, {690, 10}, {690, 50}, {690, 90}, {650, 90}, {610, 90}, {610, 50}, {610, 10}, {650, 10},
+        {650, 30}, {630, 30}, {630, 50}, {630, 70}, {650, 70}, {670, 70}, {670, 50}, {670, 30}, {650, 30},
+    };
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_point_t * cc = &c[i * 9];
+        lv_draw_path_move_to(&path, &cc[0]);
+        lv_draw_path_quad_to(&path, &cc[1], &cc[2]);
+        lv_draw_path_quad_to(&path, &cc[3], &cc[4]);
+        lv_draw_path_quad_to(&path, &cc[5], &cc[6]);
+        lv_draw_path_quad_to(&path, &cc[7], &cc[8]);
+        lv_draw_path_close(&path);
+    }
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    /*Strokes with all the joins and caps*/
+    dsc.fill_opa = LV_OPA_TRANSP;
+    dsc.stroke_opa = LV_OPA_COVER;
+    dsc.stroke_width = 9;
+    lv_draw_path_join_t joins[] = {LV_DRAW_PATH_JOIN_MITER, LV_DRAW_PATH_JOIN_BEVEL, LV_DRAW_PATH_JOIN_ROUND};
+    lv_draw_path_cap_t caps[] = {LV_DRAW_PATH_CAP_BUTT, LV_DRAW_PATH_CAP_SQUARE, LV_DRAW_PATH_CAP_ROUND};
+    uint32_t j;
+    for(i = 0; i < 3; i++) {
+        for(j = 0; j < 3; j++) {
+            dsc.stroke_join = joins[i];
+            dsc.stroke_cap = caps[j];
+            polyline(20 + j * 130, 130 + i * 70);
+            lv_draw_path(&layer, &dsc);
+            lv_draw_path_reset(&path);
+        }
+    }
+
+    /*Thin strokes are sharp if horizontal or vertical*/
+    dsc.stroke_width = 1;
+    dsc.stroke_cap = LV_DRAW_PATH_CAP_BUTT;
+    dsc.stroke_join = LV_DRAW_PATH_JOIN_MITER;
+    move_to(420, 130);
+    line_to(520, 130);
+    line_to(520, 180);
+    line_to(420, 230);
+    lv_draw_path_close(&path);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    /*Closed stroke with round joins and dots*/
+    dsc.stroke_width = 6;
+    dsc.stroke_join = LV_DRAW_PATH_JOIN_ROUND;
+    dsc.stroke_cap = LV_DRAW_PATH_CAP_ROUND;
+    dsc.stroke_color = lv_palette_main(LV_PALETTE_PURPLE);
+    star(560, 130);
+    move_to(680, 140);
+    line_to(680, 140);
+    move_to(700, 140);
+    line_to(700, 140);
+    lv_draw_path(&layer, &dsc);
+    lv_draw_path_reset(&path);
+
+    /*Chart-like series as one path*/
+    dsc.stroke_width = 2;
+    dsc.stroke_join = LV_DRAW_PATH_JOIN_BEVEL;
+    dsc.stroke_color = lv_palette_main(LV_PALETTE_TEAL);
+    move_to(420, 400);
+    for(i = 1; i <= 60; i++) {
+        line_to(420 + i * 5, 340 + (lv_trigo_sin(i * 18) * 50 >> LV_TRIGO_SHIFT));
+    }
+    lv_draw_path(&layer, &dsc);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/path.png");
+}
+
+#endif
@@ -0,0 +1,155 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    100
+#define CANVAS_H    100
+
+static uint8_t straight_buf[CANVAS_W * CANVAS_H * 4];
+static uint8_t premult_buf[CANVAS_W * CANVAS_H * 4];
+
+void setUp(void)
+{
+    lv_obj_set_flex_flow(lv_scr_act(), LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(lv_scr_act(), LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_EVENLY);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+/*Semi-transparent shapes, text and an image on a transparent background*/
+static lv_obj_t * canvas_render(lv_color_format_t cf, uint8_t * buf)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, buf, CANVAS_W, CANVAS_H, cf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.radius = 15;
+    rect_dsc.bg_color = lv_palette_main(LV_PALETTE_RED);
+    rect_dsc.bg_opa = LV_OPA_70;
+    rect_dsc.border_color = lv_palette_main(LV_PALETTE_BLUE);
+    rect_dsc.border_width = 5;
+    rect_dsc.border_opa = LV_OPA_50;
+    rect_dsc.shadow_color = lv_palette_main(LV_PALETTE_GREEN);
+    rect_dsc.shadow_width = 15;
+    lv_area_t area = {15, 15, 84, 64};
+    lv_draw_rect(&layer, &rect_dsc, &area);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = lv_palette_main(LV_PALETTE_YELLOW);
+    label_dsc.text = "Premult";
+    lv_area_t label_area = {20, 30, 99, 50};
+    lv_draw_label(&layer, &label_dsc, &label_area);
+
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = &test_image_cogwheel_argb8888;
+    img_dsc.opa = LV_OPA_80;
+    img_dsc.rotation = 300;
+    img_dsc.pivot.x = test_image_cogwheel_argb8888.header.w / 2;
+    img_dsc.pivot.y = test_image_cogwheel_argb8888.header.h / 2;
+    lv_area_t img_area = {50, 50, 50 + test_image_cogwheel_argb8888.header.w - 1,
+                          50 + test_image_cogwheel_argb8888.header.h - 1
+                         };
+    lv_draw_image(&layer, &img_dsc, &img_area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    return canvas;
+}
+
+void test_premultiplied_color_op(void)
+{
+    lv_color32_t c = {.red = 200, .green = 100, .blue = 10, .alpha = 128};
+    lv_color32_t p = lv_color32_premultiply(c);
+    TEST_ASSERT_EQUAL_UINT8(100, p.red);
+    TEST_ASSERT_EQUAL_UINT8(50, p.green);
+    TEST_ASSERT_EQUAL_UINT8(5, p.blue);
+    TEST_ASSERT_EQUAL_UINT8(128, p.alpha);
+
+    lv_color32_t u = lv_color32_unpremultiply(p);
+    TEST_ASSERT_UINT8_WITHIN(1, c.red, u.red);
+    TEST_ASSERT_UINT8_WITHIN(1, c.green, u.green);
+    TEST_ASSERT_UINT8_WITHIN(1, c.blue, u.blue);
+    TEST_ASSERT_EQUAL_UINT8(c.alpha, u.alpha);
+
+    /*Opaque colors are not changed*/
+    c.alpha = 0xff;
+    p = lv_color32_premultiply(c);
+    TEST_ASSERT_EQUAL_UINT8(200, p.red);
+    TEST_ASSERT_EQUAL_UINT8(100, p.green);
+    TEST_ASSERT_EQUAL_UINT8(10, p.blue);
+
+    /*Half transparent white over opaque black*/
+    lv_color32_t fg = {.red = 255, .green = 255, .blue = 255, .alpha = 128};
+    fg = lv_color32_premultiply(fg);
+    lv_color32_t bg = {.red = 0, .green = 0, .blue = 0, .alpha = 255};
+    lv_color32_t res = lv_color32_premultiplied_over(fg, bg);
+    TEST_ASSERT_EQUAL_UINT8(128, res.red);
+    TEST_ASSERT_EQUAL_UINT8(255, res.alpha);
+}
+
+void test_premultiplied_canvas_matches_straight(void)
+{
+    canvas_render(LV_COLOR_FORMAT_ARGB8888, straight_buf);
+    canvas_render(LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED, premult_buf);
+
+    const lv_color32_t * straight = (const lv_color32_t *)straight_buf;
+    const lv_color32_t * premult = (const lv_color32_t *)premult_buf;
+    uint32_t i;
+    for(i = 0; i < CANVAS_W * CANVAS_H; i++) {
+        /*Compare the premultiplied colors as they are what's visible after blending.
+         *The rounding is different, so the anti-aliased edges of the overlapping shapes can differ a little.*/
+        lv_color32_t expected = lv_color32_premultiply(straight[i]);
+        TEST_ASSERT_UINT8_WITHIN(8, expected.alpha, premult[i].alpha);
+        TEST_ASSERT_UINT8_WITHIN(8, expected.red, premult[i].red);
+        TEST_ASSERT_UINT8_WITHIN(8, expected.green, premult[i].green);
+        TEST_ASSERT_UINT8_WITHIN(8, expected.blue, premult[i].blue);
+
+        /*The color channels can't be larger than the alpha*/
+        TEST_ASSERT_LESS_OR_EQUAL_UINT8(premult[i].alpha, premult[i].red);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT8(premult[i].alpha, premult[i].green);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT8(premult[i].alpha, premult[i].blue);
+    }
+}
+
+void test_premultiplied_canvas_draw(void)
+{
+    /*The same canvas drawn normally, with opacity, rotated and scaled*/
+    lv_obj_t * canvas = canvas_render(LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED, premult_buf);
+
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, premult_buf, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_obj_set_style_image_opa(canvas, LV_OPA_50, 0);
+
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, premult_buf, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_image_set_rotation(canvas, 450);
+
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, premult_buf, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_image_set_scale(canvas, 180);
+
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, premult_buf, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_image_set_scale(canvas, 400);
+
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, premult_buf, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_obj_set_style_image_recolor(canvas, lv_palette_main(LV_PALETTE_PURPLE), 0);
+    lv_obj_set_style_image_recolor_opa(canvas, LV_OPA_50, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/premultiplied_1.png");
+}
+
+#endif
@@ -0,0 +1,131 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/draw/sw/lv_draw_sw_mask.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_draw_sw_mask_circle_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_circle_cache_hit_and_miss(void)
+{
+    lv_area_t a = {0, 0, 99, 99};
+    lv_draw_sw_mask_radius_param_t p1;
+    lv_draw_sw_mask_radius_param_t p2;
+
+    /*Use a radius which is not used by other tests to be sure it's not cached yet*/
+    lv_draw_sw_mask_radius_init(&p1, &a, 37, false);
+    lv_draw_sw_mask_radius_init(&p2, &a, 37, true);
+    TEST_ASSERT_EQUAL_PTR(p1.circle, p2.circle);
+
+    lv_draw_sw_mask_circle_cache_stats_t stats;
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(37 * 6, stats.byte_cnt);
+
+    lv_draw_sw_mask_free_param(&p1);
+    lv_draw_sw_mask_free_param(&p2);
+
+    /*The circle is kept after the masks are freed*/
+    lv_draw_sw_mask_radius_init(&p1, &a, 37, false);
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+    lv_draw_sw_mask_free_param(&p1);
+
+    lv_draw_sw_mask_circle_cache_reset_stats();
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+}
+
+void test_circle_cache_trim(void)
+{
+    lv_area_t a = {0, 0, 99, 99};
+    lv_draw_sw_mask_radius_param_t p1;
+    lv_draw_sw_mask_radius_param_t p2;
+    lv_draw_sw_mask_radius_init(&p1, &a, 33, false);
+    lv_draw_sw_mask_radius_init(&p2, &a, 34, false);
+    lv_draw_sw_mask_free_param(&p1);
+
+    /*The circles used in the last refresh are kept*/
+    _lv_draw_sw_mask_circle_cache_trim();
+    lv_draw_sw_mask_radius_init(&p1, &a, 33, false);
+    lv_draw_sw_mask_free_param(&p1);
+    lv_draw_sw_mask_circle_cache_stats_t stats;
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+
+    /*The circles not used for a whole refresh are freed, but not the ones which are in use*/
+    _lv_draw_sw_mask_circle_cache_trim();
+    _lv_draw_sw_mask_circle_cache_trim();
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(34 * 6 + 6, stats.byte_cnt);
+
+    /*It was in use in the last refresh so it's freed only after the next one*/
+    lv_draw_sw_mask_free_param(&p2);
+    _lv_draw_sw_mask_circle_cache_trim();
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+    _lv_draw_sw_mask_circle_cache_trim();
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+}
+
+void test_circle_cache_many_radii(void)
+{
+    /*More circles are in use than the cache size: the rest are allocated temporarily*/
+    lv_area_t a = {0, 0, 199, 199};
+    static lv_draw_sw_mask_radius_param_t p[LV_DRAW_SW_CIRCLE_CACHE_SIZE + 4];
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE + 4; i++) {
+        lv_draw_sw_mask_radius_init(&p[i], &a, 40 + i, false);
+        TEST_ASSERT_NOT_NULL(p[i].circle);
+    }
+
+    lv_draw_sw_mask_circle_cache_stats_t stats;
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_CIRCLE_CACHE_SIZE + 4, stats.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(4, stats.temp_cnt);
+
+    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE + 4; i++) {
+        lv_draw_sw_mask_free_param(&p[i]);
+    }
+}
+
+void test_circle_cache_replace_not_used_circles(void)
+{
+    lv_area_t a = {0, 0, 999, 999};
+    lv_draw_sw_mask_radius_param_t p;
+
+    /*Use a circle very often*/
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        lv_draw_sw_mask_radius_init(&p, &a, 10, false);
+        lv_draw_sw_mask_free_param(&p);
+    }
+
+    /*It's replaced after it's not used for a while*/
+    for(i = 0; i < 300; i++) {
+        lv_draw_sw_mask_radius_init(&p, &a, 100 + i, false);
+        lv_draw_sw_mask_free_param(&p);
+    }
+
+    lv_draw_sw_mask_circle_cache_stats_t stats;
+    lv_draw_sw_mask_circle_cache_reset_stats();
+    lv_draw_sw_mask_radius_init(&p, &a, 10, false);
+    lv_draw_sw_mask_free_param(&p);
+    lv_draw_sw_mask_circle_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+}
+
+#endif
@@ -0,0 +1,95 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/draw/sw/lv_draw_sw_mask.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_mask_span_rounded_line(void)
+{
+    /*Typical line of a rounded rectangle: transparent, anti-aliased edge, covered, anti-aliased edge, transparent*/
+    lv_opa_t mask[100];
+    lv_memset(mask, 0x00, 10);
+    mask[10] = 30;
+    mask[11] = 120;
+    mask[12] = 220;
+    lv_memset(&mask[13], 0xff, 74);
+    mask[87] = 220;
+    mask[88] = 120;
+    mask[89] = 30;
+    lv_memset(&mask[90], 0x00, 10);
+
+    lv_draw_sw_mask_span_t spans[8];
+    uint32_t cnt = lv_draw_sw_mask_get_spans(mask, 100, spans, 8);
+
+    TEST_ASSERT_EQUAL_UINT32(5, cnt);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_TRANSP, spans[0].res);
+    TEST_ASSERT_EQUAL_INT32(0, spans[0].x);
+    TEST_ASSERT_EQUAL_INT32(10, spans[0].len);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, spans[1].res);
+    TEST_ASSERT_EQUAL_INT32(10, spans[1].x);
+    TEST_ASSERT_EQUAL_INT32(3, spans[1].len);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_FULL_COVER, spans[2].res);
+    TEST_ASSERT_EQUAL_INT32(13, spans[2].x);
+    TEST_ASSERT_EQUAL_INT32(74, spans[2].len);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, spans[3].res);
+    TEST_ASSERT_EQUAL_INT32(87, spans[3].x);
+    TEST_ASSERT_EQUAL_INT32(3, spans[3].len);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_TRANSP, spans[4].res);
+    TEST_ASSERT_EQUAL_INT32(90, spans[4].x);
+    TEST_ASSERT_EQUAL_INT32(10, spans[4].len);
+}
+
+void test_mask_span_short_runs_are_merged(void)
+{
+    /*Runs shorter than LV_DRAW_SW_MASK_SPAN_MIN_LEN are kept in the partial span*/
+    lv_opa_t mask[32];
+    uint32_t i;
+    for(i = 0; i < 32; i++) mask[i] = (i & 0x1) ? 0xff : 0x80;
+
+    lv_draw_sw_mask_span_t spans[4];
+    uint32_t cnt = lv_draw_sw_mask_get_spans(mask, 32, spans, 4);
+
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, spans[0].res);
+    TEST_ASSERT_EQUAL_INT32(0, spans[0].x);
+    TEST_ASSERT_EQUAL_INT32(32, spans[0].len);
+}
+
+void test_mask_span_limit(void)
+{
+    /*Alternating long runs. With only 2 spans the remaining pixels go to the last span*/
+    lv_opa_t mask[64];
+    lv_memset(&mask[0], 0x00, 16);
+    lv_memset(&mask[16], 0xff, 16);
+    lv_memset(&mask[32], 0x00, 16);
+    lv_memset(&mask[48], 0xff, 16);
+
+    lv_draw_sw_mask_span_t spans[2];
+    uint32_t cnt = lv_draw_sw_mask_get_spans(mask, 64, spans, 2);
+
+    TEST_ASSERT_EQUAL_UINT32(2, cnt);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_TRANSP, spans[0].res);
+    TEST_ASSERT_EQUAL_INT32(16, spans[0].len);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, spans[1].res);
+    TEST_ASSERT_EQUAL_INT32(16, spans[1].x);
+    TEST_ASSERT_EQUAL_INT32(48, spans[1].len);
+
+    /*A single run covering the whole line is always reported*/
+    lv_memset(mask, 0xff, 64);
+    cnt = lv_draw_sw_mask_get_spans(mask, 3, spans, 2);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_FULL_COVER, spans[0].res);
+    TEST_ASSERT_EQUAL_INT32(3, spans[0].len);
+}
+
+#endif
@@ -0,0 +1,104 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/draw/sw/lv_draw_sw_raster.h"
+
+#include "unity/unity.h"
+
+static lv_draw_sw_raster_t raster;
+
+void setUp(void)
+{
+    lv_draw_sw_raster_init(&raster);
+}
+
+void tearDown(void)
+{
+    lv_draw_sw_raster_deinit(&raster);
+}
+
+void test_raster_rectangle(void)
+{
+    /*A pixel aligned rectangle covers the pixels fully without anti-aliasing*/
+    lv_point_t p[4] = {{2, 1}, {6, 1}, {6, 3}, {2, 3}};
+    lv_draw_sw_raster_add_polygon(&raster, p, 4);
+
+    lv_area_t a;
+    TEST_ASSERT_TRUE(lv_draw_sw_raster_get_area(&raster, &a));
+    TEST_ASSERT_EQUAL_INT32(2, a.x1);
+    TEST_ASSERT_EQUAL_INT32(1, a.y1);
+    TEST_ASSERT_EQUAL_INT32(5, a.x2);
+    TEST_ASSERT_EQUAL_INT32(2, a.y2);
+
+    lv_area_t area = {0, 0, 7, 3};
+    lv_draw_sw_raster_start(&raster, &area, LV_DRAW_SW_RASTER_FILL_NONZERO);
+
+    lv_opa_t buf[8];
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_TRANSP, lv_draw_sw_raster_get_line(&raster, 0, buf));
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, lv_draw_sw_raster_get_line(&raster, 1, buf));
+    const lv_opa_t exp[8] = {0, 0, 255, 255, 255, 255, 0, 0};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(exp, buf, 8);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, lv_draw_sw_raster_get_line(&raster, 2, buf));
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_TRANSP, lv_draw_sw_raster_get_line(&raster, 3, buf));
+}
+
+void test_raster_diagonal(void)
+{
+    /*The diagonal of a square halves the pixels on it*/
+    lv_point_t p[3] = {{0, 0}, {4, 4}, {0, 4}};
+    lv_draw_sw_raster_add_polygon(&raster, p, 3);
+
+    lv_area_t area = {0, 0, 3, 3};
+    lv_draw_sw_raster_start(&raster, &area, LV_DRAW_SW_RASTER_FILL_NONZERO);
+
+    lv_opa_t buf[4];
+    lv_coord_t y;
+    for(y = 0; y < 4; y++) {
+        TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, lv_draw_sw_raster_get_line(&raster, y, buf));
+        lv_coord_t x;
+        for(x = 0; x < 4; x++) {
+            if(x < y) TEST_ASSERT_EQUAL_UINT8(255, buf[x]);
+            else if(x == y) TEST_ASSERT_UINT8_WITHIN(1, 127, buf[x]);
+            else TEST_ASSERT_EQUAL_UINT8(0, buf[x]);
+        }
+    }
+}
+
+void test_raster_clipped(void)
+{
+    /*Only the middle of a wide rectangle is rendered. The coverage shouldn't change*/
+    lv_point_t p[4] = {{-100, 0}, {100, 0}, {100, 2}, {-100, 2}};
+    lv_draw_sw_raster_add_polygon(&raster, p, 4);
+
+    lv_area_t area = {10, 0, 19, 1};
+    lv_draw_sw_raster_start(&raster, &area, LV_DRAW_SW_RASTER_FILL_NONZERO);
+
+    lv_opa_t buf[10];
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_FULL_COVER, lv_draw_sw_raster_get_line(&raster, 0, buf));
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_FULL_COVER, lv_draw_sw_raster_get_line(&raster, 1, buf));
+}
+
+void test_raster_fill_rule(void)
+{
+    /*Two overlapping squares in the same direction*/
+    lv_point_t p1[4] = {{0, 0}, {4, 0}, {4, 1}, {0, 1}};
+    lv_point_t p2[4] = {{2, 0}, {6, 0}, {6, 1}, {2, 1}};
+    const lv_opa_t exp_nonzero[6] = {255, 255, 255, 255, 255, 255};
+    const lv_opa_t exp_evenodd[6] = {255, 255, 0, 0, 255, 255};
+    lv_area_t area = {0, 0, 5, 0};
+    lv_opa_t buf[6];
+
+    lv_draw_sw_raster_add_polygon(&raster, p1, 4);
+    lv_draw_sw_raster_add_polygon(&raster, p2, 4);
+    lv_draw_sw_raster_start(&raster, &area, LV_DRAW_SW_RASTER_FILL_NONZERO);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_FULL_COVER, lv_draw_sw_raster_get_line(&raster, 0, buf));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(exp_nonzero, buf, 6);
+
+    lv_draw_sw_raster_deinit(&raster);
+    lv_draw_sw_raster_add_polygon(&raster, p1, 4);
+    lv_draw_sw_raster_add_polygon(&raster, p2, 4);
+    lv_draw_sw_raster_start(&raster, &area, LV_DRAW_SW_RASTER_FILL_EVENODD);
+    TEST_ASSERT_EQUAL(LV_DRAW_SW_MASK_RES_CHANGED, lv_draw_sw_raster_get_line(&raster, 0, buf));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(exp_evenodd, buf, 6);
+}
+
+#endif
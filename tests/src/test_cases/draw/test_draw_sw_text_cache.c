@@ -0,0 +1,172 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_draw_sw_text_cache_invalidate_font(&lv_font_montserrat_28_compressed);
+    lv_draw_sw_text_cache_invalidate_font(&lv_font_montserrat_14);
+    lv_draw_sw_text_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static lv_obj_t * label_create(const char * text)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, text);
+    lv_obj_center(label);
+    return label;
+}
+
+static void redraw(lv_obj_t * label)
+{
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+}
+
+void test_draw_sw_text_cache_second_draw(void)
+{
+    lv_obj_t * label = label_create("Hello world");
+    lv_draw_sw_text_cache_stats_t stats;
+
+    /*The first time the text is only remembered*/
+    redraw(label);
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    /*The second time it's rendered into the cache*/
+    redraw(label);
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    /*Then it's drawn from the cache*/
+    redraw(label);
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+}
+
+void test_draw_sw_text_cache_same_rendering(void)
+{
+    /*Same as the glyph cache's test, so the cached text must look the same*/
+    lv_obj_t * label = label_create("Hello world");
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_glyph_cache.png");
+    lv_obj_invalidate(label);
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_glyph_cache.png");
+    lv_obj_invalidate(label);
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_glyph_cache.png");
+
+    lv_draw_sw_text_cache_stats_t stats;
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+}
+
+void test_draw_sw_text_cache_recolor(void)
+{
+    lv_obj_t * label = label_create("Recolor");
+    redraw(label);
+    redraw(label);
+
+    /*The cache stores coverage so the color and opacity can be changed freely*/
+    lv_obj_set_style_text_color(label, lv_palette_main(LV_PALETTE_RED), 0);
+    redraw(label);
+    lv_obj_set_style_text_opa(label, LV_OPA_50, 0);
+    redraw(label);
+
+    lv_draw_sw_text_cache_stats_t stats;
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+}
+
+void test_draw_sw_text_cache_changing_text(void)
+{
+    lv_obj_t * label = label_create("");
+
+    /*Texts which are drawn only once are never rendered into the cache*/
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_label_set_text_fmt(label, "%" LV_PRIu32, i);
+        lv_refr_now(NULL);
+    }
+
+    lv_draw_sw_text_cache_stats_t stats;
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+}
+
+void test_draw_sw_text_cache_changing_text_keeps_rendered(void)
+{
+    lv_obj_t * label_static = label_create("Static");
+    redraw(label_static);
+    redraw(label_static);
+
+    /*Many texts drawn once use more memory than the cache size, but they can free only each other*/
+    lv_obj_t * label = label_create("");
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        lv_label_set_text_fmt(label, "Value: %" LV_PRIu32, i);
+        lv_refr_now(NULL);
+    }
+
+    redraw(label_static);
+
+    lv_draw_sw_text_cache_stats_t stats;
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+}
+
+void test_draw_sw_text_cache_key(void)
+{
+    lv_obj_t * label = label_create("Key");
+    redraw(label);
+    redraw(label);
+
+    /*A different font or letter space is a different text*/
+    lv_obj_set_style_text_letter_space(label, 3, 0);
+    redraw(label);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_14, 0);
+    redraw(label);
+
+    lv_draw_sw_text_cache_stats_t stats;
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.entry_cnt);
+}
+
+void test_draw_sw_text_cache_font_invalidate(void)
+{
+    lv_obj_t * label = label_create("Invalidate");
+    redraw(label);
+    redraw(label);
+
+    /*The renderer drops the texts of a font when the font module invalidates it*/
+    lv_draw_sw_text_cache_stats_t stats;
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    lv_font_invalidate(&lv_font_montserrat_14);
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.entry_cnt);
+
+    lv_font_invalidate(&lv_font_montserrat_28_compressed);
+    lv_draw_sw_text_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+}
+
+#endif
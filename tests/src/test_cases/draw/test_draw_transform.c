@@ -161,6 +161,7 @@ void create_test_screen(lv_color_format_t render_cf, const char * name)
     static uint8_t canvas_buf_small[100 * 100 * 4];
 
     lv_image_dsc_t img;
+    lv_memzero(&img, sizeof(img));
     img.data = canvas_buf_small;
     img.header.cf = render_cf;
     img.header.w = 100;
@@ -204,4 +205,80 @@ void test_draw_transform_argb8888(void)
     create_test_screen(LV_COLOR_FORMAT_ARGB8888, "argb8888");
 }
 
+static void draw_scaled_images(lv_layer_t * layer, lv_image_dsc_t * img, lv_coord_t y)
+{
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = img;
+    dsc.pivot.x = 0;
+    dsc.pivot.y = 0;
+
+    /*Box filter*/
+    lv_area_t area = {10, y, 109, y + 99};
+    dsc.zoom = 40;
+    lv_draw_image(layer, &dsc, &area);
+
+    lv_area_move(&area, 60, 0);
+    dsc.zoom = 100;
+    lv_draw_image(layer, &dsc, &area);
+
+    /*Bilinear*/
+    lv_area_move(&area, 120, 0);
+    dsc.zoom = 200;
+    lv_draw_image(layer, &dsc, &area);
+
+    /*Nearest*/
+    dsc.antialias = 0;
+    lv_area_move(&area, 100, 0);
+    dsc.zoom = 40;
+    lv_draw_image(layer, &dsc, &area);
+
+    lv_area_move(&area, 60, 0);
+    dsc.zoom = 100;
+    lv_draw_image(layer, &dsc, &area);
+
+    lv_area_move(&area, 120, 0);
+    dsc.zoom = 200;
+    lv_draw_image(layer, &dsc, &area);
+}
+
+void test_draw_transform_scale(void)
+{
+    static uint8_t canvas_buf_large[760 * 440 * 4];
+    static uint8_t canvas_buf_small[4][100 * 100 * 4];
+    static const lv_color_format_t cfs[4] = {LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888,
+                                             LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888
+                                            };
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, canvas_buf_large, 760, 440, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_palette_lighten(LV_PALETTE_BLUE_GREY, 2), LV_OPA_50);
+
+    lv_image_dsc_t img[4];
+    lv_memzero(img, sizeof(img));
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        canvas_basic_render(cfs[i], canvas_buf_small[i]);
+        img[i].data = canvas_buf_small[i];
+        img[i].header.cf = cfs[i];
+        img[i].header.w = 100;
+        img[i].header.h = 100;
+        img[i].header.stride = 100 * lv_color_format_get_size(cfs[i]);
+        img[i].header.always_zero = 0;
+    }
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    for(i = 0; i < 4; i++) {
+        draw_scaled_images(&layer, &img[i], 5 + i * 110);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("/draw/transform_scale.png");
+
+    lv_obj_del(canvas);
+}
+
 #endif
@@ -0,0 +1,213 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W       63
+#define IMG_H       41
+#define CANVAS_W    80
+#define CANVAS_H    60
+
+/*Y plane followed by the U and V planes with (IMG_W + 1) / 2 stride and (IMG_H + 1) / 2 rows*/
+#define UV_STRIDE   ((IMG_W + 1) / 2)
+#define UV_H        ((IMG_H + 1) / 2)
+static uint8_t yuv_buf[IMG_W * IMG_H + 2 * UV_STRIDE * UV_H];
+static lv_image_dsc_t yuv_img;
+
+static uint8_t canvas_buf[CANVAS_W * CANVAS_H * 4];
+
+void setUp(void)
+{
+    /*A grey gradient horizontally, changing hue vertically and horizontally*/
+    uint8_t * y_plane = yuv_buf;
+    uint8_t * u_plane = y_plane + IMG_W * IMG_H;
+    uint8_t * v_plane = u_plane + UV_STRIDE * UV_H;
+    int32_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            y_plane[y * IMG_W + x] = 16 + x * 219 / (IMG_W - 1);
+        }
+    }
+    for(y = 0; y < UV_H; y++) {
+        for(x = 0; x < UV_STRIDE; x++) {
+            u_plane[y * UV_STRIDE + x] = 16 + x * 224 / (UV_STRIDE - 1);
+            v_plane[y * UV_STRIDE + x] = 240 - y * 224 / (UV_H - 1);
+        }
+    }
+
+    lv_memzero(&yuv_img, sizeof(yuv_img));
+    yuv_img.header.cf = LV_COLOR_FORMAT_I420;
+    yuv_img.header.w = IMG_W;
+    yuv_img.header.h = IMG_H;
+    yuv_img.header.stride = IMG_W;
+    yuv_img.data = yuv_buf;
+    yuv_img.data_size = sizeof(yuv_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static lv_color32_t yuv_px_get(int32_t x, int32_t y)
+{
+    lv_draw_sw_blend_yuv_planes_t planes;
+    lv_draw_sw_blend_yuv_planes_init(&planes, yuv_buf, IMG_W, IMG_H);
+    lv_color32_t c;
+    lv_draw_sw_blend_yuv_convert(&planes, x, y, 1, &c, LV_COLOR_FORMAT_XRGB8888);
+    return c;
+}
+
+static lv_color32_t canvas_px_get(lv_color_format_t cf, int32_t x, int32_t y)
+{
+    lv_color32_t c;
+    if(cf == LV_COLOR_FORMAT_RGB565) {
+        uint16_t c16 = ((uint16_t *)canvas_buf)[y * CANVAS_W + x];
+        c.red = (c16 >> 8) & 0xF8;
+        c.green = (c16 >> 3) & 0xFC;
+        c.blue = (c16 << 3) & 0xF8;
+        c.alpha = 0xff;
+    }
+    else if(cf == LV_COLOR_FORMAT_RGB888) {
+        const uint8_t * px = &canvas_buf[(y * CANVAS_W + x) * 3];
+        c.blue = px[0];
+        c.green = px[1];
+        c.red = px[2];
+        c.alpha = 0xff;
+    }
+    else {
+        c = ((lv_color32_t *)canvas_buf)[y * CANVAS_W + x];
+    }
+    return c;
+}
+
+/*Draw the image on a black canvas to x = -3 to start with an odd pixel whose U and V are shared with the clipped one*/
+static void canvas_draw(lv_color_format_t cf, lv_opa_t opa)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, canvas_buf, CANVAS_W, CANVAS_H, cf);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = &yuv_img;
+    img_dsc.opa = opa;
+    lv_area_t area = {-3, 5, -3 + IMG_W - 1, 5 + IMG_H - 1};
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+static void canvas_check(lv_color_format_t cf, lv_opa_t opa)
+{
+    /*Opaque images are converted into the layer, else they are blended*/
+    canvas_draw(cf, opa);
+
+    uint32_t tolerance = cf == LV_COLOR_FORMAT_RGB565 ? 8 : 2;
+    int32_t x, y;
+    for(y = 0; y < CANVAS_H; y++) {
+        for(x = 0; x < CANVAS_W; x++) {
+            lv_color32_t expected = {.red = 0, .green = 0, .blue = 0, .alpha = 0xff};
+            int32_t img_x = x + 3;
+            int32_t img_y = y - 5;
+            if(img_x < IMG_W && img_y >= 0 && img_y < IMG_H) {
+                expected = yuv_px_get(img_x, img_y);
+                expected.red = LV_UDIV255(expected.red * opa);
+                expected.green = LV_UDIV255(expected.green * opa);
+                expected.blue = LV_UDIV255(expected.blue * opa);
+            }
+
+            lv_color32_t c = canvas_px_get(cf, x, y);
+            TEST_ASSERT_UINT8_WITHIN(tolerance, expected.red, c.red);
+            TEST_ASSERT_UINT8_WITHIN(tolerance, expected.green, c.green);
+            TEST_ASSERT_UINT8_WITHIN(tolerance, expected.blue, c.blue);
+            if(cf == LV_COLOR_FORMAT_ARGB8888) TEST_ASSERT_EQUAL_UINT8(0xff, c.alpha);
+        }
+    }
+}
+
+void test_draw_yuv_convert(void)
+{
+    lv_draw_sw_blend_yuv_planes_t planes;
+    uint8_t px[3];
+    lv_color32_t c;
+
+    /*White, black and red in limited range*/
+    const uint8_t white[3] = {235, 128, 128};
+    lv_draw_sw_blend_yuv_planes_init(&planes, white, 1, 1);
+    lv_draw_sw_blend_yuv_convert(&planes, 0, 0, 1, &c, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_EQUAL_HEX32(0xffffffff, *(uint32_t *)&c);
+
+    const uint8_t black[3] = {16, 128, 128};
+    lv_draw_sw_blend_yuv_planes_init(&planes, black, 1, 1);
+    lv_draw_sw_blend_yuv_convert(&planes, 0, 0, 1, &c, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_EQUAL_HEX32(0xff000000, *(uint32_t *)&c);
+
+    const uint8_t red[3] = {81, 90, 240};
+    lv_draw_sw_blend_yuv_planes_init(&planes, red, 1, 1);
+    lv_draw_sw_blend_yuv_convert(&planes, 0, 0, 1, px, LV_COLOR_FORMAT_RGB888);
+    TEST_ASSERT_UINT8_WITHIN(2, 0, px[0]);
+    TEST_ASSERT_UINT8_WITHIN(2, 0, px[1]);
+    TEST_ASSERT_UINT8_WITHIN(2, 255, px[2]);
+
+    uint16_t c16;
+    lv_draw_sw_blend_yuv_convert(&planes, 0, 0, 1, &c16, LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_EQUAL_HEX16(0xF800, c16);
+
+    /*The planes follow each other*/
+    lv_draw_sw_blend_yuv_planes_init(&planes, yuv_buf, IMG_W, IMG_H);
+    TEST_ASSERT_EQUAL_PTR(yuv_buf + IMG_W * IMG_H, planes.u);
+    TEST_ASSERT_EQUAL_PTR(planes.u + UV_STRIDE * UV_H, planes.v);
+    TEST_ASSERT_EQUAL(UV_STRIDE, planes.uv_stride);
+}
+
+void test_draw_yuv_to_canvas(void)
+{
+    canvas_check(LV_COLOR_FORMAT_XRGB8888, LV_OPA_COVER);
+    canvas_check(LV_COLOR_FORMAT_ARGB8888, LV_OPA_COVER);
+    canvas_check(LV_COLOR_FORMAT_RGB888, LV_OPA_COVER);
+    canvas_check(LV_COLOR_FORMAT_RGB565, LV_OPA_COVER);
+
+    canvas_check(LV_COLOR_FORMAT_XRGB8888, LV_OPA_50);
+    canvas_check(LV_COLOR_FORMAT_ARGB8888, LV_OPA_50);
+    canvas_check(LV_COLOR_FORMAT_RGB888, LV_OPA_50);
+    canvas_check(LV_COLOR_FORMAT_RGB565, LV_OPA_50);
+}
+
+void test_draw_yuv_image(void)
+{
+    lv_obj_set_flex_flow(lv_scr_act(), LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(lv_scr_act(), LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_EVENLY);
+
+    /*The same image drawn normally, with opacity, rotated, scaled up, recolored and scaled down*/
+    lv_obj_t * img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &yuv_img);
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &yuv_img);
+    lv_obj_set_style_image_opa(img, LV_OPA_50, 0);
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &yuv_img);
+    lv_image_set_rotation(img, 300);
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &yuv_img);
+    lv_image_set_scale(img, 400);
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &yuv_img);
+    lv_obj_set_style_image_recolor(img, lv_palette_main(LV_PALETTE_PURPLE), 0);
+    lv_obj_set_style_image_recolor_opa(img, LV_OPA_50, 0);
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &yuv_img);
+    lv_image_set_scale(img, 180);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/yuv_1.png");
+}
+
+#endif
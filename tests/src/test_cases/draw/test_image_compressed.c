@@ -0,0 +1,328 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include "lv_test_indev.h"
+
+#define BIN_PATH    "A:src/test_files/binimages/"
+
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565)
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565_rle)
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565_lz4)
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888)
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888_rle)
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888_lz4)
+
+static size_t max_size_ori;
+
+static void set_max_size(size_t size)
+{
+    lv_cache_lock();
+    lv_cache_set_max_size(size);
+    lv_cache_unlock();
+}
+
+void setUp(void)
+{
+    max_size_ori = lv_cache_get_max_size();
+
+    lv_obj_set_flex_flow(lv_scr_act(), LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_align(lv_scr_act(), LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_SPACE_EVENLY);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+
+    /*Drop all the entries*/
+    set_max_size(0);
+    set_max_size(max_size_ori);
+}
+
+static bool is_cached(const void * src)
+{
+    lv_cache_src_type_t src_type = lv_image_src_get_type(src) == LV_IMAGE_SRC_FILE ?
+                                   LV_CACHE_SRC_TYPE_STR : LV_CACHE_SRC_TYPE_PTR;
+    lv_cache_lock();
+    bool cached = lv_cache_find(src, src_type, 0, 0) != NULL;
+    lv_cache_unlock();
+    return cached;
+}
+
+static uint32_t get_entry_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_get_next_entry(NULL);
+    while(e) {
+        cnt++;
+        e = lv_cache_get_next_entry(e);
+    }
+    lv_cache_unlock();
+    return cnt;
+}
+
+/*Wait for the images decompressed in the background and check that all of them are cached*/
+static void wait_cached(void)
+{
+    lv_image_decoder_flush();
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(lv_scr_act()); i++) {
+        lv_obj_t * img = lv_obj_get_child(lv_obj_get_child(lv_scr_act(), i), 0);
+        TEST_ASSERT_TRUE(is_cached(lv_image_get_src(img)));
+    }
+
+    /*Redraw the images which were drawn as placeholders*/
+    lv_refr_now(NULL);
+}
+
+static void img_create(const char * name, const void * img_src, bool rotate)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 120, LV_SIZE_CONTENT);
+    lv_obj_set_style_bg_color(cont, lv_palette_main(LV_PALETTE_LIGHT_BLUE), 0);
+    lv_obj_set_style_pad_all(cont, 5, 0);
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    lv_obj_t * img = lv_image_create(cont);
+    lv_image_set_src(img, img_src);
+    lv_obj_set_style_image_recolor(img, lv_palette_main(LV_PALETTE_RED), 0);   /*For A8*/
+    if(rotate) lv_image_set_angle(img, 450);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, name);
+}
+
+static void create_images(bool rotate)
+{
+    img_create("RGB565 RLE", &test_image_cogwheel_rgb565_rle, rotate);
+    img_create("RGB565 LZ4", &test_image_cogwheel_rgb565_lz4, rotate);
+    img_create("ARGB8888 RLE", &test_image_cogwheel_argb8888_rle, rotate);
+    img_create("ARGB8888 LZ4", &test_image_cogwheel_argb8888_lz4, rotate);
+
+    static const char * cfs[] = {"I1", "I4", "A8", "RGB565", "RGB565A8", "RGB888", "ARGB8888"};
+    static const char * methods[] = {"rle", "lz4"};
+    static char names[2][7][32];
+    static char paths[2][7][64];
+    uint32_t m;
+    uint32_t i;
+    for(m = 0; m < 2; m++) {
+        for(i = 0; i < 7; i++) {
+            lv_snprintf(names[m][i], sizeof(names[m][i]), "bin%s %s", cfs[i], methods[m]);
+            lv_snprintf(paths[m][i], sizeof(paths[m][i]), BIN_PATH "cogwheel.%s.%s.bin", cfs[i], methods[m]);
+            img_create(names[m][i], paths[m][i], rotate);
+        }
+    }
+}
+
+/*Compare the decompressed pixels of an area with the uncompressed image*/
+static void check_area(const lv_image_dsc_t * raw, const void * src, const lv_area_t * area)
+{
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, lv_color_black(), 0));
+
+    uint32_t px_size = lv_color_format_get_size(raw->header.cf);
+    uint32_t raw_stride = raw->header.w * px_size;
+    uint32_t row_size = lv_area_get_width(area) * px_size;
+
+    if(dsc.img_data) {
+        lv_coord_t y;
+        for(y = area->y1; y <= area->y2; y++) {
+            uint32_t ofs = y * raw_stride + area->x1 * px_size;
+            TEST_ASSERT_EQUAL_MEMORY(raw->data + ofs, dsc.img_data + ofs, row_size);
+        }
+    }
+    else {
+        lv_area_t decoded_area;
+        decoded_area.y1 = LV_COORD_MIN;
+        lv_coord_t next_y = area->y1;
+        while(lv_image_decoder_get_area(&dsc, area, &decoded_area) == LV_RESULT_OK) {
+            TEST_ASSERT_EQUAL(next_y, decoded_area.y1);
+            TEST_ASSERT_EQUAL(area->x1, decoded_area.x1);
+            TEST_ASSERT_EQUAL(area->x2, decoded_area.x2);
+            lv_coord_t y;
+            for(y = decoded_area.y1; y <= decoded_area.y2; y++) {
+                const uint8_t * row = dsc.img_data + (y - decoded_area.y1) * dsc.header.stride;
+                TEST_ASSERT_EQUAL_MEMORY(raw->data + y * raw_stride + area->x1 * px_size, row, row_size);
+            }
+            next_y = decoded_area.y2 + 1;
+        }
+        TEST_ASSERT_EQUAL(area->y2 + 1, next_y);
+    }
+
+    lv_image_decoder_close(&dsc);
+}
+
+void test_image_compressed_info(void)
+{
+    lv_image_header_t header;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info(BIN_PATH "cogwheel.RGB565.lz4.bin", &header));
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565, header.cf);
+    TEST_ASSERT_EQUAL(LV_IMAGE_COMPRESS_LZ4, header.compress);
+    TEST_ASSERT_EQUAL(100, header.w);
+    TEST_ASSERT_EQUAL(100, header.h);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info(&test_image_cogwheel_argb8888_rle, &header));
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, header.cf);
+    TEST_ASSERT_EQUAL(LV_IMAGE_COMPRESS_RLE, header.compress);
+}
+
+void test_image_compressed_decode(void)
+{
+    /*Decompressed while drawing*/
+    create_images(false);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_compressed.png");
+
+    uint32_t mem_before = lv_test_get_free_mem();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(mem_before, lv_test_get_free_mem());
+
+    /*Decompressed into the cache*/
+    set_max_size(1024 * 1024);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    wait_cached();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_compressed.png");
+}
+
+void test_image_compressed_decode_rotate(void)
+{
+    create_images(true);
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_compressed_rotated.png");
+
+    set_max_size(1024 * 1024);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    wait_cached();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_compressed_rotated.png");
+}
+
+void test_image_compressed_same_as_raw(void)
+{
+    lv_area_t full_area = {0, 0, 99, 99};
+    lv_area_t part_area = {10, 20, 59, 79};
+
+    /*RLE is decompressed row by row, LZ4 at once*/
+    check_area(&test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565_rle, &full_area);
+    check_area(&test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565_rle, &part_area);
+    check_area(&test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565_lz4, &full_area);
+    check_area(&test_image_cogwheel_argb8888, &test_image_cogwheel_argb8888_rle, &part_area);
+    check_area(&test_image_cogwheel_argb8888, &test_image_cogwheel_argb8888_lz4, &part_area);
+
+    /*Both from the cache*/
+    set_max_size(1024 * 1024);
+    check_area(&test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565_rle, &full_area);
+    check_area(&test_image_cogwheel_argb8888, &test_image_cogwheel_argb8888_lz4, &full_area);
+}
+
+void test_image_compressed_rle_checkpoints(void)
+{
+    /*The cache is large enough only for the checkpoints, not for the decompressed image*/
+    set_max_size(1024);
+    uint32_t entry_cnt = get_entry_cnt();
+
+    /*Draw the image in bands from the bottom to the top, so every band starts before the last one.
+     *The rows are decompressed from the checkpoints saved while the earlier bands were decompressed.*/
+    lv_coord_t y;
+    for(y = 90; y >= 0; y -= 10) {
+        lv_area_t band = {10, y, 89, y + 9};
+        check_area(&test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565_rle, &band);
+        check_area(&test_image_cogwheel_argb8888, &test_image_cogwheel_argb8888_rle, &band);
+    }
+
+    /*One entry per image, the image is not cached*/
+    TEST_ASSERT_EQUAL(entry_cnt + 2, get_entry_cnt());
+    TEST_ASSERT_FALSE(is_cached(&test_image_cogwheel_rgb565_rle));
+
+    /*Changed data at the same address doesn't use the old checkpoints*/
+    lv_image_dsc_t img = test_image_cogwheel_rgb565_rle;
+    lv_area_t last_band = {0, 90, 99, 99};
+    check_area(&test_image_cogwheel_rgb565, &img, &last_band);
+    img.data_size = 1;
+    lv_image_decoder_dsc_t dsc;
+    lv_area_t decoded_area;
+    decoded_area.y1 = LV_COORD_MIN;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &img, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &last_band, &decoded_area));
+    lv_image_decoder_close(&dsc);
+}
+
+void test_image_compressed_cache(void)
+{
+    set_max_size(1024 * 1024);
+
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &test_image_cogwheel_rgb565_lz4, lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    lv_image_decoder_close(&dsc);
+
+    lv_cache_lock();
+    lv_cache_reset_stats();
+    lv_cache_unlock();
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &test_image_cogwheel_rgb565_lz4, lv_color_black(), 0));
+    lv_image_decoder_close(&dsc);
+
+    lv_cache_stats_t stats;
+    lv_cache_lock();
+    lv_cache_get_stats(&stats);
+    lv_cache_unlock();
+    TEST_ASSERT_EQUAL(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL(0, stats.miss_cnt);
+
+    /*The indexed images are cached with their palette and indices*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, BIN_PATH "cogwheel.I4.lz4.bin", lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_I4, dsc.header.cf);
+    TEST_ASSERT_EQUAL(100 / 2, dsc.header.stride);
+    TEST_ASSERT_EQUAL(16, dsc.palette_size);
+    TEST_ASSERT_EQUAL_PTR(dsc.palette + 16, dsc.img_data);
+    lv_image_decoder_close(&dsc);
+}
+
+void test_image_compressed_invalid_data(void)
+{
+    /*Truncated data can't be decompressed*/
+    lv_image_dsc_t img = test_image_cogwheel_rgb565_lz4;
+    img.data_size /= 2;
+
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_open(&dsc, &img, lv_color_black(), 0));
+
+    img = test_image_cogwheel_rgb565_rle;
+    img.data_size /= 2;
+    lv_area_t full_area = {0, 0, 99, 99};
+    lv_area_t decoded_area;
+    decoded_area.y1 = LV_COORD_MIN;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, &img, lv_color_black(), 0));
+    lv_result_t res;
+    do {
+        res = lv_image_decoder_get_area(&dsc, &full_area, &decoded_area);
+    } while(res == LV_RESULT_OK && decoded_area.y2 < full_area.y2);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, res);
+    lv_image_decoder_close(&dsc);
+}
+
+/*The compressed images are smaller and can be decompressed*/
+void test_image_compressed_size(void)
+{
+    const lv_image_dsc_t * imgs[] = {
+        &test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565_rle, &test_image_cogwheel_rgb565_lz4,
+        &test_image_cogwheel_argb8888, &test_image_cogwheel_argb8888_rle, &test_image_cogwheel_argb8888_lz4,
+    };
+
+    uint32_t raw_size = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(imgs) / sizeof(imgs[0]); i++) {
+        if(imgs[i]->header.compress == LV_IMAGE_COMPRESS_NONE) raw_size = imgs[i]->data_size;
+        else TEST_ASSERT_LESS_THAN(raw_size, imgs[i]->data_size);
+
+        lv_image_decoder_dsc_t dsc;
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, imgs[i], lv_color_black(), 0));
+        lv_image_decoder_close(&dsc);
+    }
+}
+
+#endif
@@ -0,0 +1,327 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+#include <unistd.h>
+#include <string.h>
+#include <pthread.h>
+
+#define PNG_FILE    "A:src/test_assets/test_img_lvgl_logo.png"
+
+LV_IMAGE_DECLARE(test_img_lvgl_logo_png)
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888)
+
+static size_t max_size_ori;
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+static volatile uint32_t broken_open_cnt;
+
+#define BROKEN_FILE "A:broken.fail"
+
+/*A decoder which recognizes `BROKEN_FILE` but can't open it*/
+static lv_result_t broken_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE || strcmp(src, BROKEN_FILE) != 0) return LV_RESULT_INVALID;
+
+    lv_memzero(header, sizeof(lv_image_header_t));
+    header->cf = LV_COLOR_FORMAT_ARGB8888;
+    header->w = 10;
+    header->h = 10;
+    header->stride = 10 * 4;
+    return LV_RESULT_OK;
+}
+
+static pthread_t main_thread;
+static volatile uint32_t other_thread_info_cnt;
+
+/*A not thread safe decoder which doesn't recognize any image, but notices if it's called from other threads*/
+static lv_result_t spy_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header)
+{
+    LV_UNUSED(decoder);
+    LV_UNUSED(src);
+    LV_UNUSED(header);
+    if(!pthread_equal(pthread_self(), main_thread)) other_thread_info_cnt++;
+    return LV_RESULT_INVALID;
+}
+
+static lv_result_t spy_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    LV_UNUSED(dsc);
+    return LV_RESULT_INVALID;
+}
+
+static lv_result_t broken_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    LV_UNUSED(dsc);
+    broken_open_cnt++;
+    return LV_RESULT_INVALID;
+}
+
+static volatile bool slow_open_started;
+static volatile bool slow_open_release;
+static volatile bool slow_open_finished;
+
+/*A decoder which recognizes the "A:slow..." files and opens them only when `slow_open_release` is set*/
+static lv_result_t slow_info(lv_image_decoder_t * decoder, const void * src, lv_image_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE || strncmp(src, "A:slow", 6) != 0) return LV_RESULT_INVALID;
+
+    lv_memzero(header, sizeof(lv_image_header_t));
+    header->cf = LV_COLOR_FORMAT_ARGB8888;
+    header->w = 100;
+    header->h = 50;
+    header->stride = 100 * 4;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t slow_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    LV_UNUSED(dsc);
+    slow_open_started = true;
+    while(!slow_open_release) {
+        usleep(1000);
+    }
+    slow_open_finished = true;
+    return LV_RESULT_INVALID;
+}
+
+static lv_image_decoder_t * slow_decoder_create(void)
+{
+    slow_open_started = false;
+    slow_open_release = false;
+    slow_open_finished = false;
+
+    lv_image_decoder_t * decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, slow_info);
+    lv_image_decoder_set_open_cb(decoder, slow_open);
+    lv_image_decoder_set_cached(decoder, true);
+    lv_image_decoder_set_thread_safe(decoder, true);
+    return decoder;
+}
+
+static void wait_slow_open_started(void)
+{
+    uint32_t i;
+    for(i = 0; i < 5000 && !slow_open_started; i++) {
+        usleep(1000);
+    }
+}
+
+static void * slow_open_release_later(void * arg)
+{
+    LV_UNUSED(arg);
+    usleep(50000);
+    slow_open_release = true;
+    return NULL;
+}
+#endif
+
+static void set_max_size(size_t size)
+{
+    lv_cache_lock();
+    lv_cache_set_max_size(size);
+    lv_cache_unlock();
+}
+
+static bool is_cached(const void * src)
+{
+    lv_cache_src_type_t src_type = lv_image_src_get_type(src) == LV_IMAGE_SRC_FILE ?
+                                   LV_CACHE_SRC_TYPE_STR : LV_CACHE_SRC_TYPE_PTR;
+    lv_cache_lock();
+    bool cached = lv_cache_find(src, src_type, 0, 0) != NULL;
+    lv_cache_unlock();
+    return cached;
+}
+
+/*Wait for the decoding threads and redraw the decoded images*/
+static bool wait_cached(const void * src)
+{
+    lv_image_decoder_flush();
+    lv_refr_now(NULL);
+    return is_cached(src);
+}
+
+void setUp(void)
+{
+    max_size_ori = lv_cache_get_max_size();
+    set_max_size(1024 * 1024);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+
+    /*Drop all the entries*/
+    set_max_size(0);
+    set_max_size(max_size_ori);
+}
+
+void test_image_decoder_prefetch(void)
+{
+    TEST_ASSERT_FALSE(is_cached(PNG_FILE));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(PNG_FILE));
+    TEST_ASSERT_TRUE(wait_cached(PNG_FILE));
+
+    /*Already cached*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(PNG_FILE));
+
+    /*The variables are decoded right away as they might be freed while being decoded in the background*/
+    TEST_ASSERT_FALSE(is_cached(&test_img_lvgl_logo_png));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(&test_img_lvgl_logo_png));
+    TEST_ASSERT_TRUE(is_cached(&test_img_lvgl_logo_png));
+
+    /*The built-in decoder doesn't cache the images*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(&test_image_cogwheel_argb8888));
+
+    /*It wouldn't fit into the cache*/
+    set_max_size(0);
+    set_max_size(1024);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(PNG_FILE));
+}
+
+void test_image_decoder_only_open_in_background(void)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC
+    main_thread = pthread_self();
+    lv_image_decoder_t * decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, spy_info);
+    lv_image_decoder_set_open_cb(decoder, spy_open);
+
+    /*The decoder of the image is found on this thread, the decoding thread only opens it*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(PNG_FILE));
+    TEST_ASSERT_TRUE(wait_cached(PNG_FILE));
+    TEST_ASSERT_EQUAL(0, other_thread_info_cnt);
+
+    lv_image_decoder_delete(decoder);
+#endif
+}
+
+void test_image_decoder_failed_not_queued_again(void)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_t * decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, broken_info);
+    lv_image_decoder_set_open_cb(decoder, broken_open);
+    lv_image_decoder_set_cached(decoder, true);
+    lv_image_decoder_set_thread_safe(decoder, true);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch(BROKEN_FILE));
+
+    /*It's queued or being decoded until it fails*/
+    lv_image_decoder_flush();
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(BROKEN_FILE));
+
+    /*Not queued again after the failure was reported and the job is freed*/
+    lv_image_decoder_flush();
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(BROKEN_FILE));
+    TEST_ASSERT_EQUAL(1, broken_open_cnt);
+    TEST_ASSERT_NULL(_lv_ll_get_head(&LV_GLOBAL_DEFAULT()->img_decoder_async.job_ll));
+
+    /*Not thread safe decoders are called only from LVGL's thread*/
+    lv_image_decoder_set_thread_safe(decoder, false);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_prefetch(BROKEN_FILE));
+    TEST_ASSERT_EQUAL(2, broken_open_cnt);
+
+    lv_image_decoder_delete(decoder);
+#endif
+}
+
+void test_image_decoder_draw_on_canvas(void)
+{
+    /*Nothing would redraw the canvas once the image is decoded, so it's decoded right away*/
+    static uint8_t canvas_buf[120 * 40 * 4];
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, canvas_buf, 120, 40, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+    lv_refr_now(NULL);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = PNG_FILE;
+    lv_area_t area = {0, 0, 104, 32};
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(canvas_buf); i += 4) {
+        if(canvas_buf[i + 3]) cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, cnt);
+}
+
+void test_image_decoder_draw_when_decoded(void)
+{
+    lv_obj_t * img;
+    lv_obj_t * label;
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, &test_img_lvgl_logo_png);
+    lv_obj_align(img, LV_ALIGN_CENTER, -100, -20);
+
+    label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "Array");
+    lv_obj_align(label, LV_ALIGN_CENTER, -100, 20);
+
+    img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, PNG_FILE);
+    lv_obj_align(img, LV_ALIGN_CENTER, 100, -20);
+
+    label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "File");
+    lv_obj_align(label, LV_ALIGN_CENTER, 100, 20);
+
+    /*The images are decoded in the background and their areas are redrawn when they are ready*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(wait_cached(&test_img_lvgl_logo_png));
+    TEST_ASSERT_TRUE(wait_cached(PNG_FILE));
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/png_1.png");
+}
+
+void test_image_decoder_placeholder(void)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_t * decoder = slow_decoder_create();
+
+    lv_obj_t * img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, "A:slow_placeholder");
+    lv_obj_center(img);
+
+    /*The decoder is waiting for the release, so the placeholder is drawn for sure*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_decoder_async_placeholder.png");
+
+    slow_open_release = true;
+    lv_image_decoder_delete(decoder);
+#endif
+}
+
+void test_image_decoder_delete_while_decoding(void)
+{
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_t * decoder = slow_decoder_create();
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_prefetch("A:slow_delete"));
+    wait_slow_open_started();
+    TEST_ASSERT_TRUE(slow_open_started);
+
+    /*The decoder can be freed only when the thread has returned from its `open_cb`*/
+    pthread_t releaser;
+    pthread_create(&releaser, NULL, slow_open_release_later, NULL);
+    lv_image_decoder_delete(decoder);
+    TEST_ASSERT_TRUE(slow_open_finished);
+    pthread_join(releaser, NULL);
+#endif
+}
+
+#endif
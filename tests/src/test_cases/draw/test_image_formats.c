@@ -145,7 +145,89 @@ void test_image_built_in_decode_rotate_and_recolor(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_format_rotate_and_recolor.png");
 }
 
+void test_image_built_in_decode_rotate_file(void)
+{
+    /*These are decoded part by part and collected into one buffer for the transformation*/
+    img_create("binI1", "A:src/test_files/binimages/cogwheel.I1.bin", true, false);
+    img_create("binI2", "A:src/test_files/binimages/cogwheel.I2.bin", true, false);
+    img_create("binI4", "A:src/test_files/binimages/cogwheel.I4.bin", true, false);
+    img_create("binI8", "A:src/test_files/binimages/cogwheel.I8.bin", true, false);
+    img_create("binRGB565A8", "A:src/test_files/binimages/cogwheel.RGB565A8.bin", true, false);
+    img_create("binRGB565", "A:src/test_files/binimages/cogwheel.RGB565.bin", true, false);
+    img_create("binRGB888", "A:src/test_files/binimages/cogwheel.RGB888.bin", true, false);
+    img_create("binXRGB8888", "A:src/test_files/binimages/cogwheel.XRGB8888.bin", true, false);
+    img_create("binARGB8888", "A:src/test_files/binimages/cogwheel.ARGB8888.bin", true, false);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/image_format_rotated_file.png");
+}
 
+static void indexed_canvas_draw(uint8_t * buf, lv_color_format_t cf, const void * img_src, bool recolor)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, buf, 100, 100, cf);
+    lv_canvas_fill_bg(canvas, lv_palette_main(LV_PALETTE_LIGHT_BLUE), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = img_src;
+    img_dsc.opa = LV_OPA_80;
+    if(recolor) {
+        img_dsc.recolor = lv_palette_main(LV_PALETTE_RED);
+        img_dsc.recolor_opa = LV_OPA_70;
+    }
+    lv_area_t area = {0, 0, 99, 99};
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
 
+void test_image_built_in_decode_indexed_palette(void)
+{
+    /*The decompressed images are blended through the converted palette,
+     *the uncompressed files are read row by row and converted to ARGB8888. They should look the same.*/
+    static uint8_t buf_palette[100 * 100 * 4];
+    static uint8_t buf_rows[100 * 100 * 4];
+
+    const char * palette_srcs[] = {"A:src/test_files/binimages/cogwheel.I4.lz4.bin",
+                                   "A:src/test_files/binimages/cogwheel.I1.lz4.bin"
+                                  };
+    const char * row_srcs[] = {"A:src/test_files/binimages/cogwheel.I4.bin",
+                               "A:src/test_files/binimages/cogwheel.I1.bin"
+                              };
+    lv_color_format_t cfs[] = {LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888};
+
+    uint32_t i;
+    for(i = 0; i < sizeof(palette_srcs) / sizeof(palette_srcs[0]); i++) {
+        uint32_t c;
+        for(c = 0; c < sizeof(cfs) / sizeof(cfs[0]); c++) {
+            uint32_t r;
+            for(r = 0; r < 2; r++) {
+                indexed_canvas_draw(buf_palette, cfs[c], palette_srcs[i], r);
+                indexed_canvas_draw(buf_rows, cfs[c], row_srcs[i], r);
+
+                /*The rounding of the alpha blending can differ a little*/
+                uint32_t j;
+                if(cfs[c] == LV_COLOR_FORMAT_RGB565) {
+                    const uint16_t * px_palette = (const uint16_t *)buf_palette;
+                    const uint16_t * px_rows = (const uint16_t *)buf_rows;
+                    for(j = 0; j < 100 * 100; j++) {
+                        TEST_ASSERT_UINT8_WITHIN(1, px_rows[j] >> 11, px_palette[j] >> 11);
+                        TEST_ASSERT_UINT8_WITHIN(1, (px_rows[j] >> 5) & 0x3F, (px_palette[j] >> 5) & 0x3F);
+                        TEST_ASSERT_UINT8_WITHIN(1, px_rows[j] & 0x1F, px_palette[j] & 0x1F);
+                    }
+                }
+                else {
+                    for(j = 0; j < 100 * 100 * 4; j++) {
+                        TEST_ASSERT_UINT8_WITHIN(1, buf_rows[j], buf_palette[j]);
+                    }
+                }
+                lv_obj_clean(lv_scr_act());
+            }
+        }
+    }
+}
 
 #endif
@@ -0,0 +1,134 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define BIN_PATH    "A:src/test_files/binimages/"
+
+static size_t max_size_ori;
+
+static void set_max_size(size_t size)
+{
+    lv_cache_lock();
+    lv_cache_set_max_size(size);
+    lv_cache_unlock();
+}
+
+void setUp(void)
+{
+    max_size_ori = lv_cache_get_max_size();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+
+    /*Drop all the entries*/
+    set_max_size(0);
+    set_max_size(max_size_ori);
+}
+
+static uint32_t get_entry_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_get_next_entry(NULL);
+    while(e) {
+        cnt++;
+        e = lv_cache_get_next_entry(e);
+    }
+    lv_cache_unlock();
+    return cnt;
+}
+
+static void draw_to_canvas(uint8_t * buf, const void * src, int32_t w, int32_t h, int32_t rotation)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, buf, w, h, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = src;
+    img_dsc.rotation = rotation;
+    img_dsc.pivot.x = w / 2;
+    img_dsc.pivot.y = h / 2;
+    lv_area_t area = {0, 0, w - 1, h - 1};
+    lv_draw_image(&layer, &img_dsc, &area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_del(canvas);
+}
+
+void test_image_indexed_convert_once(void)
+{
+    static uint8_t buf[100 * 100 * 4];
+    set_max_size(1024 * 1024);
+
+    /*The rotated image needs the indices converted to ARGB8888*/
+    draw_to_canvas(buf, BIN_PATH "cogwheel.I4.lz4.bin", 100, 100, 300);
+
+    lv_cache_lock();
+    lv_cache_entry_t * base = lv_cache_find(BIN_PATH "cogwheel.I4.lz4.bin", LV_CACHE_SRC_TYPE_STR, 0, 0);
+    TEST_ASSERT_NOT_NULL(base);
+    lv_cache_entry_t * derived = base->derived;
+    TEST_ASSERT_NOT_NULL(derived);
+    TEST_ASSERT_EQUAL_PTR(base, derived->base);
+    TEST_ASSERT_EQUAL(100 * 100 * 4, derived->data_size);
+    const void * converted = derived->data;
+    lv_cache_unlock();
+
+    /*The converted image and the converted palette are reused. The palette converted to ARGB8888
+     *for the rotated image is used to blend the not rotated image to the ARGB8888 canvas too.*/
+    uint32_t entry_cnt = get_entry_cnt();
+    draw_to_canvas(buf, BIN_PATH "cogwheel.I4.lz4.bin", 100, 100, 600);
+    draw_to_canvas(buf, BIN_PATH "cogwheel.I4.lz4.bin", 100, 100, 0);
+    draw_to_canvas(buf, BIN_PATH "cogwheel.I4.lz4.bin", 100, 100, 0);
+    TEST_ASSERT_EQUAL(entry_cnt, get_entry_cnt());
+
+    lv_cache_lock();
+    TEST_ASSERT_EQUAL_PTR(derived, base->derived);
+    TEST_ASSERT_EQUAL_PTR(converted, derived->data);
+
+    /*The converted image is dropped with the indices*/
+    lv_cache_invalidate(base);
+    lv_cache_unlock();
+    TEST_ASSERT_EQUAL(entry_cnt - 2, get_entry_cnt());
+}
+
+void test_image_indexed_palette_changed(void)
+{
+    static uint8_t buf[8 * 8 * 4];
+    static uint8_t data[2 * 4 + 8];
+    set_max_size(1024 * 1024);
+
+    /*The first column uses the second color of the palette*/
+    lv_color32_t * palette = (lv_color32_t *)data;
+    lv_color32_t black = {.blue = 0x00, .green = 0x00, .red = 0x00, .alpha = 0xff};
+    lv_color32_t red = {.blue = 0x00, .green = 0x00, .red = 0xff, .alpha = 0xff};
+    lv_color32_t blue = {.blue = 0xff, .green = 0x00, .red = 0x00, .alpha = 0xff};
+    palette[0] = black;
+    palette[1] = red;
+    lv_memset(data + 2 * 4, 0x80, 8);
+
+    lv_image_dsc_t img = {0};
+    img.header.cf = LV_COLOR_FORMAT_I1;
+    img.header.w = 8;
+    img.header.h = 8;
+    img.header.stride = 1;
+    img.data = data;
+    img.data_size = sizeof(data);
+
+    draw_to_canvas(buf, &img, 8, 8, 0);
+    TEST_ASSERT_EQUAL_HEX32(0xffff0000, *(uint32_t *)buf);
+
+    /*The palette converted earlier for the same address is not used*/
+    palette[1] = blue;
+    draw_to_canvas(buf, &img, 8, 8, 0);
+    TEST_ASSERT_EQUAL_HEX32(0xff0000ff, *(uint32_t *)buf);
+}
+
+#endif
@@ -0,0 +1,133 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include <unistd.h>
+
+#if LV_USE_FFMPEG && LV_FFMPEG_DECODE_THREAD
+
+/*10 frames of 32x24 YUV420 pixels at 10 FPS. The luma of the i-th frame is 16 + i * 20.*/
+#define VIDEO_FILE          "src/test_assets/test_video_10fps.y4m"
+#define VIDEO_FRAME_CNT     10
+#define VIDEO_PERIOD        100
+
+static lv_obj_t * player_obj;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+    player_obj = NULL;
+}
+
+static int32_t get_shown_frame(void)
+{
+    lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)player_obj;
+    return (((const uint8_t *)player->imgdsc.data)[0] - 16) / 20;
+}
+
+/*Run the player's timer until a new frame is shown. The decoder thread might need some time for it.*/
+static bool wait_new_frame(void)
+{
+    lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)player_obj;
+    const uint8_t * data = player->imgdsc.data;
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        player->timer->timer_cb(player->timer);
+        if(player->imgdsc.data != data) return true;
+        usleep(1000);
+    }
+
+    return false;
+}
+
+static void create_player(void)
+{
+    player_obj = lv_ffmpeg_player_create(lv_scr_act());
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_ffmpeg_player_set_src(player_obj, VIDEO_FILE));
+    lv_ffmpeg_player_set_cmd(player_obj, LV_FFMPEG_PLAYER_CMD_START);
+
+    /*The first frame starts the clock*/
+    TEST_ASSERT_TRUE(wait_new_frame());
+    TEST_ASSERT_EQUAL(0, get_shown_frame());
+}
+
+void test_ffmpeg_deliver_all_frames(void)
+{
+    create_player();
+    lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)player_obj;
+
+    /*Every frame is shown at its time*/
+    int32_t i;
+    for(i = 1; i < VIDEO_FRAME_CNT; i++) {
+        lv_tick_inc(VIDEO_PERIOD);
+        TEST_ASSERT_TRUE(wait_new_frame());
+        TEST_ASSERT_EQUAL(i, get_shown_frame());
+    }
+
+    TEST_ASSERT_EQUAL(0, lv_ffmpeg_player_get_dropped_frames(player_obj));
+
+    /*The player stops at the end of the video*/
+    lv_tick_inc(VIDEO_PERIOD);
+    for(i = 0; i < 1000 && !player->timer->paused; i++) {
+        player->timer->timer_cb(player->timer);
+        usleep(1000);
+    }
+    TEST_ASSERT_TRUE(player->timer->paused);
+
+    /*Restarting rewinds to the first frame*/
+    lv_ffmpeg_player_set_cmd(player_obj, LV_FFMPEG_PLAYER_CMD_START);
+    TEST_ASSERT_TRUE(wait_new_frame());
+    TEST_ASSERT_EQUAL(0, get_shown_frame());
+}
+
+void test_ffmpeg_drop_late_frames(void)
+{
+    create_player();
+
+    /*Let the thread fill the queue*/
+    usleep(100000);
+
+    /*Only the last due frame is shown, the ones before it are dropped*/
+    lv_tick_inc(3 * VIDEO_PERIOD);
+    TEST_ASSERT_TRUE(wait_new_frame());
+    TEST_ASSERT_EQUAL(3, get_shown_frame());
+    TEST_ASSERT_EQUAL(2, lv_ffmpeg_player_get_dropped_frames(player_obj));
+
+    /*The next frame comes in time again*/
+    lv_tick_inc(VIDEO_PERIOD);
+    TEST_ASSERT_TRUE(wait_new_frame());
+    TEST_ASSERT_EQUAL(4, get_shown_frame());
+    TEST_ASSERT_EQUAL(2, lv_ffmpeg_player_get_dropped_frames(player_obj));
+
+    /*Setting the source again resets the counter*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_ffmpeg_player_set_src(player_obj, VIDEO_FILE));
+    TEST_ASSERT_EQUAL(0, lv_ffmpeg_player_get_dropped_frames(player_obj));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_ffmpeg_deliver_all_frames(void)
+{
+}
+
+void test_ffmpeg_drop_late_frames(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,108 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/display/lv_display_private.h"
+
+#include "unity/unity.h"
+
+#define GIF_SRC "A:src/test_assets/test_img_bulb.gif"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_gif_dirty_area(void)
+{
+    gd_GIF * gif = gd_open_gif_file(GIF_SRC);
+    TEST_ASSERT_NOT_NULL(gif);
+
+    uint32_t px_cnt = gif->width * gif->height;
+    uint32_t * prev = lv_malloc(px_cnt * sizeof(uint32_t));
+    TEST_ASSERT_NOT_NULL(prev);
+    const uint32_t * canvas = (const uint32_t *)gif->canvas;
+
+    /*Only the pixels in the changed area of the frames can change*/
+    uint32_t partial_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_memcpy(prev, canvas, px_cnt * sizeof(uint32_t));
+        if(gd_get_frame(gif) != 1) break;
+        gd_render_frame(gif, gif->canvas);
+
+        TEST_ASSERT_LESS_OR_EQUAL(gif->width, gif->dx + gif->dw);
+        TEST_ASSERT_LESS_OR_EQUAL(gif->height, gif->dy + gif->dh);
+        if(gif->dw * gif->dh < px_cnt) partial_cnt++;
+
+        uint16_t x, y;
+        for(y = 0; y < gif->height; y++) {
+            for(x = 0; x < gif->width; x++) {
+                bool in_dirty = x >= gif->dx && x < gif->dx + gif->dw && y >= gif->dy && y < gif->dy + gif->dh;
+                if(!in_dirty) TEST_ASSERT_EQUAL_HEX32(prev[y * gif->width + x], canvas[y * gif->width + x]);
+            }
+        }
+    }
+
+    /*The frames of the bulb change only a part of the image*/
+    TEST_ASSERT_GREATER_THAN(0, partial_cnt);
+
+    lv_free(prev);
+    gd_close_gif(gif);
+}
+
+void test_gif_invalidate_frame_area(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_gif_set_src(obj, GIF_SRC);
+    lv_obj_center(obj);
+    lv_refr_now(NULL);
+
+    lv_gif_t * gifobj = (lv_gif_t *)obj;
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t full_size = lv_area_get_size(&obj->coords);
+    uint32_t partial_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_tick_inc(gifobj->gif->gce.delay * 10);
+        gifobj->timer->timer_cb(gifobj->timer);
+        if(gifobj->gif->dw == 0) continue;
+
+        /*Only the changed area of the frame is invalidated*/
+        TEST_ASSERT_EQUAL(1, disp->inv_p);
+        TEST_ASSERT_EQUAL(obj->coords.x1 + gifobj->gif->dx, disp->inv_areas[0].x1);
+        TEST_ASSERT_EQUAL(obj->coords.y1 + gifobj->gif->dy, disp->inv_areas[0].y1);
+        TEST_ASSERT_EQUAL(gifobj->gif->dw, lv_area_get_width(&disp->inv_areas[0]));
+        TEST_ASSERT_EQUAL(gifobj->gif->dh, lv_area_get_height(&disp->inv_areas[0]));
+        if(lv_area_get_size(&disp->inv_areas[0]) < full_size) partial_cnt++;
+        lv_refr_now(NULL);
+    }
+
+    /*The frames of the bulb change only a part of the image*/
+    TEST_ASSERT_GREATER_THAN(0, partial_cnt);
+
+    /*The whole object with its transformed image is invalidated if the image is zoomed*/
+    lv_image_set_scale(obj, 512);
+    lv_refr_now(NULL);
+    for(i = 0; i < 50 && disp->inv_p == 0; i++) {
+        lv_tick_inc(gifobj->gif->gce.delay * 10);
+        gifobj->timer->timer_cb(gifobj->timer);
+    }
+
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    int32_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&area, ext_size, ext_size);
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_EQUAL(area.x1, disp->inv_areas[0].x1);
+    TEST_ASSERT_EQUAL(area.y1, disp->inv_areas[0].y1);
+    TEST_ASSERT_EQUAL(area.x2, disp->inv_areas[0].x2);
+    TEST_ASSERT_EQUAL(area.y2, disp->inv_areas[0].y2);
+    TEST_ASSERT_GREATER_THAN(full_size, lv_area_get_size(&disp->inv_areas[0]));
+}
+
+#endif
@@ -0,0 +1,177 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include <string.h>
+
+#define MAP_FILE    "A:src/test_assets/test_img_tiled_map.lvt"
+#define ALPHA_FILE  "A:src/test_assets/test_img_tiled_alpha.lvt"
+#define BAD_FILE    "A:test_img_tiled_bad.lvt"
+
+static size_t max_size_ori;
+
+static void set_max_size(size_t size)
+{
+    lv_cache_lock();
+    lv_cache_set_max_size(size);
+    lv_cache_unlock();
+}
+
+static lv_obj_t * img_create(const char * src, uint32_t scale, int32_t rotation, lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t * img = lv_image_create(lv_scr_act());
+    lv_image_set_src(img, src);
+    lv_image_set_scale(img, scale);
+    lv_image_set_rotation(img, rotation);
+    lv_obj_set_pos(img, x, y);
+    return img;
+}
+
+static void count_tiles(uint32_t * tile_cnt, size_t * size)
+{
+    *tile_cnt = 0;
+    *size = 0;
+
+    lv_cache_lock();
+    lv_cache_entry_t * entry = lv_cache_get_next_entry(NULL);
+    while(entry) {
+        if(entry->src_type == LV_CACHE_SRC_TYPE_STR && strcmp(entry->src, MAP_FILE) == 0) {
+            (*tile_cnt)++;
+            *size += entry->data_size;
+        }
+        entry = lv_cache_get_next_entry(entry);
+    }
+    lv_cache_unlock();
+}
+
+void setUp(void)
+{
+    max_size_ori = lv_cache_get_max_size();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+
+    /*Drop all the entries*/
+    set_max_size(0);
+    set_max_size(max_size_ori);
+}
+
+void test_tiled_image_info(void)
+{
+    lv_image_header_t header;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info(MAP_FILE, &header));
+    TEST_ASSERT_EQUAL(640, header.w);
+    TEST_ASSERT_EQUAL(400, header.h);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565, header.cf);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info(ALPHA_FILE, &header));
+    TEST_ASSERT_EQUAL(100, header.w);
+    TEST_ASSERT_EQUAL(60, header.h);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, header.cf);
+}
+
+void test_tiled_image_draw(void)
+{
+    /*Level 0 without transformation*/
+    lv_obj_t * img = img_create(MAP_FILE, LV_SCALE_NONE, 0, 0, 0);
+    lv_obj_center(img);
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/tiled_image_1.png");
+
+    uint32_t mem_before = lv_test_get_free_mem();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(mem_before, lv_test_get_free_mem());
+}
+
+void test_tiled_image_draw_mip_levels(void)
+{
+    /*The images are placed by the pivot in their middle, so the top left corner of the original image is moved*/
+    lv_obj_t * img;
+    img = img_create(MAP_FILE, 128, 0, -160, -100);         /*Level 1 without transformation*/
+    img = img_create(MAP_FILE, 96, 0, 150, -115);           /*Level 1 scaled*/
+    img = img_create(MAP_FILE, 100, 300, -120, 140);        /*Level 1 scaled and rotated*/
+    img = img_create(MAP_FILE, 40, 0, 360, -160);           /*Downscaled more than the last level*/
+
+    img = img_create(ALPHA_FILE, LV_SCALE_NONE, 0, 640, 90);
+    img = img_create(ALPHA_FILE, 64, 0, 700, 160);          /*Level 2 without transformation*/
+    img = img_create(ALPHA_FILE, 512, 450, 600, 330);       /*Level 0 upscaled and rotated*/
+    LV_UNUSED(img);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("libs/tiled_image_2.png");
+
+    uint32_t mem_before = lv_test_get_free_mem();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(mem_before, lv_test_get_free_mem());
+}
+
+void test_tiled_image_cache_visible_tiles(void)
+{
+    set_max_size(1024 * 1024);
+
+    /*Only the top left 4 tiles are visible*/
+    lv_obj_t * img = img_create(MAP_FILE, LV_SCALE_NONE, 0, 800 - 100, 480 - 100);
+    lv_refr_now(NULL);
+
+    uint32_t tile_cnt;
+    size_t size;
+    count_tiles(&tile_cnt, &size);
+    TEST_ASSERT_EQUAL(4, tile_cnt);
+    TEST_ASSERT_EQUAL(4 * 64 * 64 * 2, size);
+
+    /*The tiles are taken from the cache*/
+    lv_cache_lock();
+    lv_cache_reset_stats();
+    lv_cache_unlock();
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+
+    lv_cache_stats_t stats;
+    lv_cache_lock();
+    lv_cache_get_stats(&stats);
+    lv_cache_unlock();
+    TEST_ASSERT_EQUAL(0, stats.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(4, stats.hit_cnt);
+
+    /*The whole image is visible on level 2 in 6 tiles*/
+    lv_image_set_scale(img, 64);
+    lv_obj_set_pos(img, 0, 0);
+    lv_refr_now(NULL);
+    count_tiles(&tile_cnt, &size);
+    TEST_ASSERT_EQUAL(4 + 6, tile_cnt);
+}
+
+void test_tiled_image_invalid_tile_size(void)
+{
+    /*Copy the RLE compressed map with a huge size for its first tile*/
+    static uint8_t buf[1024];
+    lv_fs_file_t f;
+    uint32_t size;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, MAP_FILE, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &size));
+    lv_fs_close(&f);
+
+    buf[24] = 0xF0;
+    buf[25] = 0xFF;
+    buf[26] = 0xFF;
+    buf[27] = 0x7F;
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, BAD_FILE, LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, buf, size, NULL));
+    lv_fs_close(&f);
+
+    /*The tile is rejected without trying to read it*/
+    uint32_t mem_before = lv_test_get_free_mem();
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, BAD_FILE, lv_color_black(), 0));
+    lv_area_t full_area = {0, 0, 63, 63};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    lv_image_decoder_close(&dsc);
+    TEST_ASSERT_EQUAL(mem_before, lv_test_get_free_mem());
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 
 void setUp(void)
 {
@@ -11,6 +12,8 @@ void setUp(void)
 void tearDown(void)
 {
     /* Function run after every test */
+    lv_display_set_subpx(NULL, LV_DISPLAY_SUBPX_NONE);
+    lv_obj_clean(lv_scr_act());
 }
 
 void test_tiny_ttf_rendering_test(void)
@@ -44,4 +47,86 @@ void test_tiny_ttf_rendering_test(void)
 #endif
 }
 
+void test_tiny_ttf_set_size(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 16);
+    lv_font_t * font_ref = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 32);
+
+    /*Cache the bitmap of the glyph with the original size*/
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, 'A', NULL));
+
+    /*After resizing the bitmap needs to be rendered again with the new size*/
+    lv_tiny_ttf_set_size(font, 32);
+    lv_font_glyph_dsc_t dsc;
+    lv_font_glyph_dsc_t dsc_ref;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &dsc, 'A', 0));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font_ref, &dsc_ref, 'A', 0));
+    TEST_ASSERT_EQUAL(dsc_ref.box_w, dsc.box_w);
+    TEST_ASSERT_EQUAL(dsc_ref.box_h, dsc.box_h);
+
+    const uint8_t * bitmap = lv_font_get_glyph_bitmap(font, 'A', NULL);
+    const uint8_t * bitmap_ref = lv_font_get_glyph_bitmap(font_ref, 'A', NULL);
+    TEST_ASSERT_NOT_NULL(bitmap);
+    TEST_ASSERT_NOT_NULL(bitmap_ref);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmap_ref, bitmap, dsc.box_w * dsc.box_h);
+
+    lv_tiny_ttf_destroy(font);
+    lv_tiny_ttf_destroy(font_ref);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_destroy_frees_all(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    uint32_t free_mem = lv_test_get_free_mem();
+
+    /*Add a glyph to the cache of the font too, to check that the whole cache is freed with the font*/
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 16);
+    TEST_ASSERT_NOT_NULL(lv_font_get_glyph_bitmap(font, 'A', NULL));
+    lv_tiny_ttf_destroy(font);
+
+    LV_HEAP_CHECK(TEST_ASSERT_EQUAL_UINT32(free_mem, lv_test_get_free_mem()));
+    LV_UNUSED(free_mem);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_subpx(void)
+{
+#if LV_USE_TINY_TTF && LV_USE_FONT_SUBPX
+    extern const uint8_t ubuntu_font[];
+    extern size_t ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(ubuntu_font, ubuntu_font_size, 16);
+    lv_tiny_ttf_set_subpx(font, LV_FONT_SUBPX_HOR);
+
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "Subpixel rendering with Tiny TTF\n"
+                      "The quick brown fox jumps over the lazy dog");
+    lv_obj_center(label);
+
+    /*The 3 coverage values are averaged if the display doesn't use subpixel rendering*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_subpx_off.png");
+
+    lv_display_set_subpx(NULL, LV_DISPLAY_SUBPX_RGB);
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_subpx_rgb.png");
+
+    lv_display_set_subpx(NULL, LV_DISPLAY_SUBPX_BGR);
+    TEST_ASSERT_EQUAL_SCREENSHOT("tiny_ttf_subpx_bgr.png");
+
+    lv_obj_del(label);
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
 #endif
@@ -0,0 +1,400 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/misc/lv_cache_builtin.h"
+
+#include "unity/unity.h"
+
+static size_t max_size_ori;
+
+/*Lock the cache only around the operations so that a failing assertion can't leave it locked*/
+static lv_cache_entry_t * add_entry(const void * src, lv_cache_src_type_t src_type, uint32_t param1, size_t size)
+{
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_add(size);
+    if(e) {
+        e->src = src;
+        e->src_type = src_type;
+        e->param1 = param1;
+    }
+    lv_cache_unlock();
+    return e;
+}
+
+static lv_cache_entry_t * find(const void * src, lv_cache_src_type_t src_type, uint32_t param1)
+{
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_find_counted(src, src_type, param1, 0);
+    lv_cache_unlock();
+    return e;
+}
+
+static void use(lv_cache_entry_t * e)
+{
+    lv_cache_lock();
+    lv_cache_get_data(e);
+    lv_cache_unlock();
+}
+
+static void release(lv_cache_entry_t * e)
+{
+    lv_cache_lock();
+    lv_cache_release(e);
+    lv_cache_unlock();
+}
+
+static void set_max_size(size_t size)
+{
+    lv_cache_lock();
+    lv_cache_set_max_size(size);
+    lv_cache_unlock();
+}
+
+static void get_stats(lv_cache_stats_t * stats)
+{
+    lv_cache_lock();
+    lv_cache_get_stats(stats);
+    lv_cache_unlock();
+}
+
+void setUp(void)
+{
+    max_size_ori = lv_cache_get_max_size();
+    lv_cache_lock();
+    lv_cache_reset_stats();
+    lv_cache_unlock();
+}
+
+void tearDown(void)
+{
+    /*Drop all the entries*/
+    set_max_size(0);
+    set_max_size(max_size_ori);
+}
+
+void test_cache_find(void)
+{
+    static const int src1;
+    static const int src2;
+    char path[32];
+    lv_strcpy(path, "A:path/to/image.png");
+
+    set_max_size(1000);
+    lv_cache_entry_t * e1 = add_entry(&src1, LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e2 = add_entry(&src2, LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e2_frame = add_entry(&src2, LV_CACHE_SRC_TYPE_PTR, 1, 10);
+    lv_cache_entry_t * e_str = add_entry("A:path/to/image.png", LV_CACHE_SRC_TYPE_STR, 0, 10);
+
+    TEST_ASSERT_EQUAL_PTR(e1, find(&src1, LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_EQUAL_PTR(e2, find(&src2, LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_EQUAL_PTR(e2_frame, find(&src2, LV_CACHE_SRC_TYPE_PTR, 1));
+    TEST_ASSERT_NULL(find(&src2, LV_CACHE_SRC_TYPE_PTR, 2));
+
+    /*Strings are compared by their content*/
+    TEST_ASSERT_EQUAL_PTR(e_str, find(path, LV_CACHE_SRC_TYPE_STR, 0));
+    TEST_ASSERT_NULL(find("A:path/to/other.png", LV_CACHE_SRC_TYPE_STR, 0));
+
+    lv_cache_lock();
+    lv_cache_invalidate(e2);
+    lv_cache_unlock();
+    TEST_ASSERT_NULL(find(&src2, LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_EQUAL_PTR(e2_frame, find(&src2, LV_CACHE_SRC_TYPE_PTR, 1));
+}
+
+void test_cache_drop_least_recently_used(void)
+{
+    static const int src[4];
+
+    set_max_size(30);
+    lv_cache_entry_t * e0 = add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+
+    /*Use the oldest entry so the second one becomes the least recently used*/
+    use(e0);
+    release(e0);
+
+    add_entry(&src[3], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    TEST_ASSERT_NOT_NULL(find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NULL(find(&src[1], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NOT_NULL(find(&src[2], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NOT_NULL(find(&src[3], LV_CACHE_SRC_TYPE_PTR, 0));
+}
+
+void test_cache_keep_expensive_entries(void)
+{
+    static const int src[5];
+
+    set_max_size(30);
+    lv_cache_entry_t * e0 = add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e1 = add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e2 = add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+
+    /*The least recently used entry was slow to create, so it's kept instead of the next one*/
+    e0->weight = 3;
+    use(e1);
+    release(e1);
+    use(e2);
+    release(e2);
+
+    add_entry(&src[3], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    TEST_ASSERT_EQUAL_PTR(e0, find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NULL(find(&src[1], LV_CACHE_SRC_TYPE_PTR, 0));
+
+    /*After enough uses of the other entries it's dropped too*/
+    lv_cache_entry_t * e3 = find(&src[3], LV_CACHE_SRC_TYPE_PTR, 0);
+    use(e3);
+    release(e3);
+    use(e2);
+    release(e2);
+    add_entry(&src[4], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    TEST_ASSERT_NULL(find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NOT_NULL(find(&src[2], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NOT_NULL(find(&src[3], LV_CACHE_SRC_TYPE_PTR, 0));
+}
+
+void test_cache_keep_used_entries(void)
+{
+    static const int src[3];
+
+    set_max_size(20);
+    lv_cache_entry_t * e0 = add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e1 = add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+
+    /*The first entry is the least recently used but it's still in use*/
+    use(e0);
+    use(e1);
+    release(e1);
+
+    lv_cache_entry_t * e2 = add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    TEST_ASSERT_FALSE(e2->temporary);
+    TEST_ASSERT_EQUAL_PTR(e0, find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NULL(find(&src[1], LV_CACHE_SRC_TYPE_PTR, 0));
+    release(e0);
+}
+
+void test_cache_temporary_entry(void)
+{
+    static const int src;
+
+    set_max_size(30);
+    lv_cache_entry_t * e = add_entry(&src, LV_CACHE_SRC_TYPE_PTR, 0, 100);
+    TEST_ASSERT_TRUE(e->temporary);
+    use(e);
+    TEST_ASSERT_EQUAL_PTR(e, find(&src, LV_CACHE_SRC_TYPE_PTR, 0));
+
+    /*Freed when released and it doesn't affect the size of the cache*/
+    release(e);
+    TEST_ASSERT_NULL(find(&src, LV_CACHE_SRC_TYPE_PTR, 0));
+
+    e = add_entry(&src, LV_CACHE_SRC_TYPE_PTR, 0, 30);
+    TEST_ASSERT_FALSE(e->temporary);
+}
+
+void test_cache_derived_entry(void)
+{
+    static const int src[3];
+
+    set_max_size(40);
+    lv_cache_entry_t * base = add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * derived = add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_lock();
+    lv_cache_set_derived(base, derived);
+    lv_cache_unlock();
+    TEST_ASSERT_EQUAL_PTR(derived, base->derived);
+    TEST_ASSERT_EQUAL_PTR(base, derived->base);
+
+    /*The base is the least recently used, but it can't be dropped while its derived entry is used*/
+    use(derived);
+    add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 30);
+    TEST_ASSERT_EQUAL_PTR(base, find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    release(derived);
+
+    /*The derived entry is dropped with the base*/
+    lv_cache_lock();
+    lv_cache_invalidate(base);
+    lv_cache_unlock();
+    TEST_ASSERT_NULL(find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NULL(find(&src[1], LV_CACHE_SRC_TYPE_PTR, 0));
+}
+
+void test_cache_many_entries_indexed(void)
+{
+    /*A lot of entries with many lookups and drops. The entries are found in the hash table, not in a list.*/
+#define ENTRY_CNT   4096
+    static const uint8_t src[ENTRY_CNT];
+
+    set_max_size(ENTRY_CNT / 2);
+
+    uint32_t i;
+    for(i = 0; i < ENTRY_CNT; i++) {
+        TEST_ASSERT_NOT_NULL(add_entry(&src[i], LV_CACHE_SRC_TYPE_PTR, i % 4, 1));
+    }
+
+    /*Only the second half fits*/
+    uint32_t round;
+    for(round = 0; round < 8; round++) {
+        for(i = 0; i < ENTRY_CNT; i++) {
+            lv_cache_entry_t * e = find(&src[i], LV_CACHE_SRC_TYPE_PTR, i % 4);
+            if(i < ENTRY_CNT / 2) {
+                TEST_ASSERT_NULL(e);
+            }
+            else {
+                TEST_ASSERT_NOT_NULL(e);
+                TEST_ASSERT_EQUAL_PTR(&src[i], e->src);
+                use(e);
+                release(e);
+            }
+        }
+    }
+
+    const lv_cache_builtin_dsc_t * builtin_dsc = &LV_GLOBAL_DEFAULT()->cache_builtin_dsc;
+    TEST_ASSERT_NULL(builtin_dsc->pending);
+    TEST_ASSERT_EQUAL(ENTRY_CNT / 2, builtin_dsc->entries.indexed_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(ENTRY_CNT / 2, builtin_dsc->entries.bucket_cnt);
+#undef ENTRY_CNT
+}
+
+void test_cache_entry_without_src(void)
+{
+    static const int src;
+
+    set_max_size(100);
+    lv_cache_entry_t * e = add_entry(NULL, LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    add_entry(&src, LV_CACHE_SRC_TYPE_PTR, 0, 10);
+
+    /*The entry without a source is not waiting to be indexed anymore, but it's still in the cache*/
+    TEST_ASSERT_NOT_NULL(find(&src, LV_CACHE_SRC_TYPE_PTR, 0));
+    const lv_cache_builtin_dsc_t * builtin_dsc = &LV_GLOBAL_DEFAULT()->cache_builtin_dsc;
+    TEST_ASSERT_NULL(builtin_dsc->pending);
+    TEST_ASSERT_EQUAL(1, builtin_dsc->entries.indexed_cnt);
+
+    lv_cache_lock();
+    TEST_ASSERT_EQUAL_PTR(e, lv_cache_get_next_entry(lv_cache_get_next_entry(NULL)));
+    lv_cache_unlock();
+
+    /*It's dropped as the least recently used entry*/
+    set_max_size(10);
+    TEST_ASSERT_NOT_NULL(find(&src, LV_CACHE_SRC_TYPE_PTR, 0));
+    lv_cache_lock();
+    TEST_ASSERT_NULL(lv_cache_get_next_entry(lv_cache_get_next_entry(NULL)));
+    lv_cache_unlock();
+}
+
+void test_cache_stats(void)
+{
+    static const int src[3];
+
+    set_max_size(30);
+    lv_cache_entry_t * e0 = add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    add_entry("A:image.png", LV_CACHE_SRC_TYPE_STR, 0, 5);
+
+    TEST_ASSERT_NOT_NULL(find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NOT_NULL(find("A:image.png", LV_CACHE_SRC_TYPE_STR, 0));
+    TEST_ASSERT_NULL(find(&src[2], LV_CACHE_SRC_TYPE_PTR, 0));
+    use(e0);
+
+    /*The other lookups are not counted*/
+    lv_cache_lock();
+    TEST_ASSERT_NULL(lv_cache_find(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 0));
+    lv_cache_unlock();
+
+    lv_cache_stats_t stats;
+    get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.temporary_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.in_use_cnt);
+    TEST_ASSERT_EQUAL_UINT32(25, stats.cur_size);
+    TEST_ASSERT_EQUAL_UINT32(30, stats.max_size);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.src_types[LV_CACHE_SRC_TYPE_PTR].entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20, stats.src_types[LV_CACHE_SRC_TYPE_PTR].size);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.src_types[LV_CACHE_SRC_TYPE_PTR].hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.src_types[LV_CACHE_SRC_TYPE_PTR].miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.src_types[LV_CACHE_SRC_TYPE_STR].entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.src_types[LV_CACHE_SRC_TYPE_STR].size);
+
+    /*The second entry is dropped and the large one is only temporary*/
+    add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e_tmp = add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 1, 100);
+    use(e_tmp);
+
+    get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.temporary_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.in_use_cnt);
+    TEST_ASSERT_EQUAL_UINT32(25, stats.cur_size);
+
+    release(e_tmp);
+    release(e0);
+
+    /*Only the counters are reset*/
+    lv_cache_lock();
+    lv_cache_reset_stats();
+    lv_cache_unlock();
+    get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.in_use_cnt);
+}
+
+void test_cache_iterate_entries(void)
+{
+    static const int src[3];
+
+    set_max_size(100);
+    lv_cache_entry_t * e0 = add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e1 = add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e2 = add_entry(&src[2], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    use(e1);
+    release(e1);
+
+    /*From the most to the least recently used*/
+    lv_cache_entry_t * entries[4] = {NULL};
+    uint32_t cnt = 0;
+    lv_cache_lock();
+    lv_cache_entry_t * e = lv_cache_get_next_entry(NULL);
+    while(e && cnt < 4) {
+        entries[cnt++] = e;
+        e = lv_cache_get_next_entry(e);
+    }
+    lv_cache_unlock();
+
+    TEST_ASSERT_EQUAL_UINT32(3, cnt);
+    TEST_ASSERT_EQUAL_PTR(e1, entries[0]);
+    TEST_ASSERT_EQUAL_PTR(e2, entries[1]);
+    TEST_ASSERT_EQUAL_PTR(e0, entries[2]);
+}
+
+void test_cache_deinit(void)
+{
+    static const int src[2];
+
+    set_max_size(100);
+    add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    lv_cache_entry_t * e1 = add_entry(&src[1], LV_CACHE_SRC_TYPE_PTR, 0, 10);
+    use(e1);
+
+    /*All the entries are freed, even the ones in use*/
+    _lv_cache_deinit();
+    _lv_cache_init();
+    _lv_cache_builtin_init();
+
+    TEST_ASSERT_NULL(find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+    TEST_ASSERT_NULL(find(&src[1], LV_CACHE_SRC_TYPE_PTR, 0));
+
+    lv_cache_lock();
+    TEST_ASSERT_NULL(lv_cache_get_next_entry(NULL));
+    lv_cache_unlock();
+
+    /*The cache works again after the initialization*/
+    set_max_size(100);
+    TEST_ASSERT_NOT_NULL(add_entry(&src[0], LV_CACHE_SRC_TYPE_PTR, 0, 10));
+    TEST_ASSERT_NOT_NULL(find(&src[0], LV_CACHE_SRC_TYPE_PTR, 0));
+}
+
+#endif
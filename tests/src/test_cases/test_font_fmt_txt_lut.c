@@ -0,0 +1,296 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/core/lv_global.h"
+
+#include "unity/unity.h"
+
+/*A font with a format 0 cmap for 'A'..'Z' and a large sparse cmap like the CJK fonts have*/
+#define LATIN_CNT       26
+#define SPARSE_CNT      300
+#define SPARSE_START    0x4E00
+#define SPARSE_STEP     7
+#define GLYPH_CNT       (1 + LATIN_CNT + SPARSE_CNT)
+#define PAIR_CNT_MAX    (LATIN_CNT * LATIN_CNT)
+
+static lv_font_fmt_txt_glyph_dsc_t glyph_dsc[GLYPH_CNT];
+static uint16_t unicode_list[SPARSE_CNT];
+static lv_font_fmt_txt_cmap_t cmaps[2];
+static uint16_t kern_glyph_ids[PAIR_CNT_MAX * 2];
+static int8_t kern_values[PAIR_CNT_MAX];
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+static lv_font_fmt_txt_dsc_t font_dsc;
+static lv_font_t font;
+
+/*A font with much more glyphs than the glyph ID cache can hold*/
+#define LARGE_CNT       8000
+static lv_font_fmt_txt_glyph_dsc_t large_glyph_dsc[LARGE_CNT + 1];
+static uint16_t large_unicode_list[LARGE_CNT];
+static lv_font_fmt_txt_cmap_t large_cmap;
+static lv_font_fmt_txt_dsc_t large_font_dsc;
+static lv_font_t large_font;
+
+/*More fonts than the table of fonts can hold*/
+#define MANY_FONT_CNT   (_LV_FONT_FMT_TXT_LUT_FONT_CNT + 8)
+static lv_font_fmt_txt_dsc_t many_font_dscs[MANY_FONT_CNT];
+static lv_font_t many_fonts[MANY_FONT_CNT];
+
+static void font_init(void)
+{
+    uint32_t i;
+    for(i = 1; i < GLYPH_CNT; i++) {
+        glyph_dsc[i].adv_w = (i % 7 + 5) * 16;
+    }
+
+    for(i = 0; i < SPARSE_CNT; i++) {
+        unicode_list[i] = i * SPARSE_STEP;
+    }
+
+    cmaps[0].range_start = 'A';
+    cmaps[0].range_length = LATIN_CNT;
+    cmaps[0].glyph_id_start = 1;
+    cmaps[0].type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY;
+
+    cmaps[1].range_start = SPARSE_START;
+    cmaps[1].range_length = SPARSE_CNT * SPARSE_STEP;
+    cmaps[1].glyph_id_start = 1 + LATIN_CNT;
+    cmaps[1].unicode_list = unicode_list;
+    cmaps[1].list_length = SPARSE_CNT;
+    cmaps[1].type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY;
+
+    /*Some pairs of the latin letters, ordered by the left and then by the right glyph ID*/
+    uint32_t pair_cnt = 0;
+    uint32_t left;
+    uint32_t right;
+    for(left = 1; left <= LATIN_CNT; left++) {
+        for(right = 1; right <= LATIN_CNT; right++) {
+            if((left + right) % 3) continue;
+            kern_glyph_ids[pair_cnt * 2] = left;
+            kern_glyph_ids[pair_cnt * 2 + 1] = right;
+            kern_values[pair_cnt] = (int8_t)((left * 3 + right) % 9) - 4;
+            pair_cnt++;
+        }
+    }
+
+    kern_pairs.glyph_ids = kern_glyph_ids;
+    kern_pairs.values = kern_values;
+    kern_pairs.pair_cnt = pair_cnt;
+    kern_pairs.glyph_ids_size = 1;
+
+    font_dsc.glyph_dsc = glyph_dsc;
+    font_dsc.cmaps = cmaps;
+    font_dsc.cmap_num = 2;
+    font_dsc.kern_dsc = &kern_pairs;
+    font_dsc.kern_scale = 256;  /*16 in 12.4 format to have integer kern values*/
+    font_dsc.bpp = 4;
+
+    font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font.get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font.line_height = 16;
+    font.dsc = &font_dsc;
+}
+
+static uint32_t get_glyph_id(uint32_t letter)
+{
+    if(letter >= 'A' && letter < 'A' + LATIN_CNT) return 1 + letter - 'A';
+    if(letter >= SPARSE_START && (letter - SPARSE_START) % SPARSE_STEP == 0 &&
+       (letter - SPARSE_START) / SPARSE_STEP < SPARSE_CNT) {
+        return 1 + LATIN_CNT + (letter - SPARSE_START) / SPARSE_STEP;
+    }
+    return 0;
+}
+
+static int32_t get_kern_value(uint32_t left, uint32_t right)
+{
+    uint32_t i;
+    for(i = 0; i < kern_pairs.pair_cnt; i++) {
+        if(kern_glyph_ids[i * 2] == left && kern_glyph_ids[i * 2 + 1] == right) return kern_values[i];
+    }
+    return 0;
+}
+
+void setUp(void)
+{
+    font_init();
+}
+
+void tearDown(void)
+{
+    lv_font_fmt_txt_lut_invalidate_font(&font);
+    if(large_font.dsc) lv_font_fmt_txt_lut_invalidate_font(&large_font);
+
+    uint32_t i;
+    for(i = 0; i < MANY_FONT_CNT; i++) {
+        if(many_fonts[i].dsc) lv_font_fmt_txt_lut_invalidate_font(&many_fonts[i]);
+    }
+}
+
+static bool has_entry(const lv_font_t * f)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        if(LV_GLOBAL_DEFAULT()->font_fmt_txt_lut.fonts[i].fdsc == f->dsc) return true;
+    }
+    return false;
+}
+
+static const _lv_font_fmt_txt_lut_t * get_lut(const lv_font_t * f)
+{
+    const _lv_font_fmt_txt_lut_entry_t * fonts = LV_GLOBAL_DEFAULT()->font_fmt_txt_lut.fonts;
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        if(fonts[i].fdsc == f->dsc) return fonts[i].lut;
+    }
+    return NULL;
+}
+
+static bool is_missed(const lv_font_t * f)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_MISSED_CNT; i++) {
+        if(LV_GLOBAL_DEFAULT()->font_fmt_txt_lut.missed[i] == f->dsc) return true;
+    }
+    return false;
+}
+
+void test_font_fmt_txt_lut_glyph_ids(void)
+{
+    /*Go through twice to check the cached glyph IDs too*/
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        uint32_t letter;
+        for(letter = SPARSE_START - 10; letter < SPARSE_START + SPARSE_CNT * SPARSE_STEP + 10; letter++) {
+            lv_font_glyph_dsc_t g;
+            uint32_t gid = get_glyph_id(letter);
+            bool found = lv_font_get_glyph_dsc(&font, &g, letter, 0);
+            TEST_ASSERT_EQUAL(gid != 0, found);
+            if(found) TEST_ASSERT_EQUAL_UINT32(gid % 7 + 5, g.adv_w);
+        }
+
+        for(letter = 'A' - 5; letter < 'A' + LATIN_CNT + 5; letter++) {
+            lv_font_glyph_dsc_t g;
+            uint32_t gid = get_glyph_id(letter);
+            bool found = lv_font_get_glyph_dsc(&font, &g, letter, 0);
+            TEST_ASSERT_EQUAL(gid != 0, found);
+        }
+    }
+}
+
+void test_font_fmt_txt_lut_large_font(void)
+{
+    uint32_t i;
+    for(i = 0; i < LARGE_CNT; i++) {
+        large_glyph_dsc[i + 1].adv_w = (i % 7 + 5) * 16;
+        large_unicode_list[i] = i * 2;
+    }
+
+    large_cmap.range_start = SPARSE_START;
+    large_cmap.range_length = LARGE_CNT * 2;
+    large_cmap.glyph_id_start = 1;
+    large_cmap.unicode_list = large_unicode_list;
+    large_cmap.list_length = LARGE_CNT;
+    large_cmap.type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY;
+
+    large_font_dsc.glyph_dsc = large_glyph_dsc;
+    large_font_dsc.cmaps = &large_cmap;
+    large_font_dsc.cmap_num = 1;
+    large_font_dsc.bpp = 4;
+    large_font = font;
+    large_font.dsc = &large_font_dsc;
+
+    /*Go through more letters than the cache has slots, twice*/
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        for(i = 0; i < LARGE_CNT * 2; i++) {
+            lv_font_glyph_dsc_t g;
+            bool found = lv_font_get_glyph_dsc(&large_font, &g, SPARSE_START + i, 0);
+            TEST_ASSERT_EQUAL(i % 2 == 0, found);
+            if(found) TEST_ASSERT_EQUAL_UINT32(i / 2 % 7 + 5, g.adv_w);
+        }
+    }
+
+    /*The font has a glyph ID cache even if a table of all letters wouldn't fit*/
+    const _lv_font_fmt_txt_lut_t * lut = get_lut(&large_font);
+    TEST_ASSERT_NOT_NULL(lut);
+    TEST_ASSERT_NOT_NULL(lut->cmap_slots);
+    TEST_ASSERT_LESS_THAN_UINT32(LARGE_CNT, lut->cmap_mask + 1);
+}
+
+void test_font_fmt_txt_lut_kern_pairs(void)
+{
+    uint32_t left;
+    uint32_t right;
+    for(left = 'A'; left < 'A' + LATIN_CNT; left++) {
+        for(right = 'A'; right < 'A' + LATIN_CNT; right++) {
+            lv_font_glyph_dsc_t g;
+            uint32_t gid_left = get_glyph_id(left);
+            uint32_t gid_right = get_glyph_id(right);
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, left, right));
+            TEST_ASSERT_EQUAL_INT32((int32_t)(gid_left % 7 + 5) + get_kern_value(gid_left, gid_right), g.adv_w);
+        }
+    }
+
+    /*No kerning with the letters without pairs*/
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, 'A', SPARSE_START));
+    TEST_ASSERT_EQUAL_UINT32(get_glyph_id('A') % 7 + 5, g.adv_w);
+}
+
+void test_font_fmt_txt_lut_invalidate(void)
+{
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, SPARSE_START + SPARSE_STEP, 0));
+
+    /*The tables are built again after freeing them*/
+    lv_font_fmt_txt_lut_invalidate_font(&font);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g, SPARSE_START + SPARSE_STEP, 0));
+    TEST_ASSERT_EQUAL_UINT32(get_glyph_id(SPARSE_START + SPARSE_STEP) % 7 + 5, g.adv_w);
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&font, &g, SPARSE_START + 1, 0));
+}
+
+void test_font_fmt_txt_lut_many_fonts(void)
+{
+    uint32_t i;
+    for(i = 0; i < MANY_FONT_CNT; i++) {
+        many_font_dscs[i] = font_dsc;
+        many_fonts[i] = font;
+        many_fonts[i].dsc = &many_font_dscs[i];
+    }
+
+    /*The fonts without an entry work too, just without the tables*/
+    uint32_t missed_font = MANY_FONT_CNT;
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        for(i = 0; i < MANY_FONT_CNT; i++) {
+            lv_font_glyph_dsc_t g;
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&many_fonts[i], &g, SPARSE_START + SPARSE_STEP, 0));
+            TEST_ASSERT_EQUAL_UINT32(get_glyph_id(SPARSE_START + SPARSE_STEP) % 7 + 5, g.adv_w);
+            TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(&many_fonts[i], &g, SPARSE_START + 1, 0));
+            if(!has_entry(&many_fonts[i])) missed_font = i;
+        }
+    }
+
+    /*The last font without an entry is remembered to not search for it again*/
+    TEST_ASSERT_LESS_THAN_UINT32(MANY_FONT_CNT, missed_font);
+    TEST_ASSERT_TRUE(is_missed(&many_fonts[missed_font]));
+
+    /*It gets the entry of a freed font*/
+    for(i = 0; i < MANY_FONT_CNT; i++) {
+        if(has_entry(&many_fonts[i])) break;
+    }
+    lv_font_fmt_txt_lut_invalidate_font(&many_fonts[i]);
+    TEST_ASSERT_FALSE(is_missed(&many_fonts[missed_font]));
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&many_fonts[missed_font], &g, SPARSE_START + SPARSE_STEP, 0));
+    TEST_ASSERT_TRUE(has_entry(&many_fonts[missed_font]));
+
+    /*No removed entries are left to skip when all fonts are freed*/
+    for(i = 0; i < MANY_FONT_CNT; i++) {
+        lv_font_fmt_txt_lut_invalidate_font(&many_fonts[i]);
+    }
+    for(i = 0; i < _LV_FONT_FMT_TXT_LUT_FONT_CNT; i++) {
+        TEST_ASSERT_NULL(LV_GLOBAL_DEFAULT()->font_fmt_txt_lut.fonts[i].fdsc);
+    }
+}
+
+#endif
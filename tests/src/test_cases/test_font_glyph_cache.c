@@ -0,0 +1,74 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    lv_font_glyph_cache_invalidate_font(&lv_font_montserrat_28_compressed);
+    lv_font_glyph_cache_invalidate_font(&lv_font_montserrat_48);
+    lv_font_glyph_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_font_glyph_cache_hit(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, "abcabc");
+    lv_refr_now(NULL);
+
+    /*The repeated letters are decoded only once*/
+    lv_font_glyph_cache_stats_t stats;
+    lv_font_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.entry_cnt);
+
+    /*Redrawing the label doesn't decode anything*/
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    lv_font_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(9, stats.hit_cnt);
+
+    /*The glyphs are dropped when the font is invalidated*/
+    lv_font_glyph_cache_invalidate_font(&lv_font_montserrat_28_compressed);
+    lv_font_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.byte_cnt);
+}
+
+void test_font_glyph_cache_same_rendering(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, "Hello world");
+    lv_obj_center(label);
+
+    /*Drawn once with decoding and once from the cache*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_glyph_cache.png");
+    lv_obj_invalidate(label);
+    TEST_ASSERT_EQUAL_SCREENSHOT("font_glyph_cache.png");
+}
+
+void test_font_glyph_cache_evict(void)
+{
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_width(label, 780);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_48, 0);
+    lv_label_set_text(label, "ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz 0123456789");
+    lv_refr_now(NULL);
+
+    /*The glyphs don't fit into the cache so the least recently used ones are freed*/
+    lv_font_glyph_cache_stats_t stats;
+    lv_font_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.evict_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_FONT_GLYPH_CACHE_SIZE, stats.byte_cnt);
+}
+
+#endif
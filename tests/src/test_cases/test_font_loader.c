@@ -29,6 +29,11 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
 void test_font_loader_with_cache(void);
 void test_font_loader_no_cache(void);
 void test_font_loader_from_buffer(void);
+void test_font_loader_mapped(void);
+void test_font_loader_mapped_from_buffer(void);
+void test_font_loader_streamed(void);
+void test_font_loader_streamed_small_cache(void);
+void test_font_loader_invalid(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -69,6 +74,9 @@ void tearDown(void)
     lv_font_free(font_1_bin);
     lv_font_free(font_2_bin);
     lv_font_free(font_3_bin);
+    font_1_bin = NULL;
+    font_2_bin = NULL;
+    font_3_bin = NULL;
 }
 
 static void common(void)
@@ -126,6 +134,121 @@ void test_font_loader_from_buffer(void)
     common();
 }
 
+void test_font_loader_mapped(void)
+{
+    /*'B' is the POSIX driver which can map the files*/
+    font_1_bin = lv_font_load_mapped("B:src/test_assets/font_1.fnt");
+    font_2_bin = lv_font_load_mapped("B:src/test_assets/font_2.fnt");
+    font_3_bin = lv_font_load_mapped("B:src/test_assets/font_3.fnt");
+
+    common();
+
+    lv_font_load_info_t info;
+    lv_font_get_load_info(font_3_bin, &info);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(font_3_buf), info.mapped_size);
+    TEST_ASSERT_NOT_EQUAL(0, info.heap_size);
+
+    /*The glyph headers of the stock font_1 are 25 bits, so the file is mapped but the bitmaps are copied*/
+    lv_font_load_info_t info_stock;
+    lv_font_get_load_info(font_1_bin, &info_stock);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(font_1_buf), info_stock.mapped_size);
+
+    /*font_1 with byte aligned glyph headers (48 bits instead of 25) to use the bitmaps in place too*/
+    lv_font_t * font_aligned = lv_font_load_mapped("B:src/test_assets/font_1_aligned.fnt");
+    lv_font_t * font_aligned_copy = lv_font_load("B:src/test_assets/font_1_aligned.fnt");
+    compare_fonts(&font_1, font_aligned);
+    compare_fonts(&font_1, font_aligned_copy);
+
+    lv_font_load_info_t info_copy;
+    lv_font_get_load_info(font_aligned, &info);
+    lv_font_get_load_info(font_aligned_copy, &info_copy);
+    lv_font_free(font_aligned);
+    lv_font_free(font_aligned_copy);
+
+    /*The bitmaps are not copied so much less memory is allocated*/
+    TEST_ASSERT_EQUAL_UINT32(0, info_copy.mapped_size);
+    TEST_ASSERT_LESS_THAN_UINT32(info_copy.heap_size / 2, info.heap_size);
+    TEST_ASSERT_LESS_THAN_UINT32(info_stock.heap_size, info.heap_size);
+}
+
+void test_font_loader_mapped_from_buffer(void)
+{
+    lv_fs_path_ex_t mempath_1;
+    lv_fs_path_ex_t mempath_2;
+    lv_fs_path_ex_t mempath_3;
+    lv_fs_make_path_from_buffer(&mempath_1, LV_FS_MEMFS_LETTER, font_1_buf, sizeof(font_1_buf));
+    lv_fs_make_path_from_buffer(&mempath_2, LV_FS_MEMFS_LETTER, font_2_buf, sizeof(font_2_buf));
+    lv_fs_make_path_from_buffer(&mempath_3, LV_FS_MEMFS_LETTER, font_3_buf, sizeof(font_3_buf));
+    font_1_bin = lv_font_load_mapped((const char *)&mempath_1);
+    font_2_bin = lv_font_load_mapped((const char *)&mempath_2);
+    font_3_bin = lv_font_load_mapped((const char *)&mempath_3);
+
+    common();
+
+    lv_font_load_info_t info;
+    lv_font_get_load_info(font_1_bin, &info);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(font_1_buf), info.mapped_size);
+}
+
+void test_font_loader_streamed(void)
+{
+    font_1_bin = lv_font_load_streamed("A:src/test_assets/font_1.fnt", 4096);
+    font_2_bin = lv_font_load_streamed("B:src/test_assets/font_2.fnt", 4096);
+    font_3_bin = lv_font_load_streamed("B:src/test_assets/font_3.fnt", 4096);
+
+    /*Only the index is loaded*/
+    lv_font_load_info_t info;
+    lv_font_get_load_info(font_3_bin, &info);
+    TEST_ASSERT_EQUAL_UINT32(0, info.read_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, info.cache_size);
+
+    lv_font_t * font_3_copy = lv_font_load("B:src/test_assets/font_3.fnt");
+    lv_font_load_info_t info_copy;
+    lv_font_get_load_info(font_3_copy, &info_copy);
+    lv_font_free(font_3_copy);
+    TEST_ASSERT_LESS_THAN_UINT32(info_copy.heap_size / 2, info.heap_size);
+
+    /*The glyphs are read when the text or the font of a label is set*/
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_label_set_text(label, "aab");
+    lv_obj_set_style_text_font(label, font_3_bin, 0);
+    lv_font_get_load_info(font_3_bin, &info);
+    TEST_ASSERT_EQUAL_UINT32(2, info.read_cnt);
+
+    lv_label_set_text(label, "abc");
+    lv_font_get_load_info(font_3_bin, &info);
+    TEST_ASSERT_EQUAL_UINT32(3, info.read_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, info.cache_size);
+    lv_obj_del(label);
+
+    common();
+}
+
+void test_font_loader_streamed_small_cache(void)
+{
+    /*The glyphs are read again and again but they are still drawn correctly*/
+    font_1_bin = lv_font_load_streamed("B:src/test_assets/font_1.fnt", 256);
+    font_2_bin = lv_font_load_streamed("B:src/test_assets/font_2.fnt", 256);
+    font_3_bin = lv_font_load_streamed("B:src/test_assets/font_3.fnt", 256);
+
+    common();
+
+    lv_font_load_info_t info;
+    lv_font_get_load_info(font_3_bin, &info);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(256, info.cache_size);
+}
+
+void test_font_loader_invalid(void)
+{
+    /*The file is closed and everything is freed if the font can't be loaded (checked by the sanitizer)*/
+    lv_fs_path_ex_t mempath;
+    lv_fs_make_path_from_buffer(&mempath, LV_FS_MEMFS_LETTER, font_1_buf, sizeof(font_1_buf) / 2);
+    TEST_ASSERT_NULL(lv_font_load((const char *)&mempath));
+    TEST_ASSERT_NULL(lv_font_load_mapped((const char *)&mempath));
+    TEST_ASSERT_NULL(lv_font_load_streamed((const char *)&mempath, 4096));
+    TEST_ASSERT_NULL(lv_font_load("B:src/test_assets/no_such_font.fnt"));
+}
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
@@ -245,7 +368,8 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
     lv_font_fmt_txt_glyph_dsc_t * glyph_dsc2 = (lv_font_fmt_txt_glyph_dsc_t *)dsc2->glyph_dsc;
 
     for(int i = 0; i < total_glyphs; ++i) {
-        if(i < total_glyphs - 1) {
+        /*The streamed fonts have no bitmaps in the memory*/
+        if(i < total_glyphs - 1 && dsc2->glyph_bitmap) {
             int size1 = glyph_dsc1[i + 1].bitmap_index - glyph_dsc1[i].bitmap_index;
 
             if(size1 > 0) {
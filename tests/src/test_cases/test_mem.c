@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../src/misc/lv_mem_budget.h"
 
 #include "unity/unity.h"
 
@@ -23,4 +24,32 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+void test_mem_budget(void)
+{
+    lv_mem_budget_t budget;
+    lv_mem_budget_init(&budget, 100);
+
+    void * p1 = lv_mem_budget_alloc(&budget, 60);
+    TEST_ASSERT_NOT_NULL(p1);
+
+    /*Running out of the budget is not an error, just NULL is returned*/
+    TEST_ASSERT_NULL(lv_mem_budget_alloc(&budget, 60));
+    TEST_ASSERT_EQUAL_UINT32(60, budget.used);
+
+    void * p2 = lv_mem_budget_alloc(&budget, 40);
+    TEST_ASSERT_NOT_NULL(p2);
+    TEST_ASSERT_EQUAL_UINT32(100, budget.used);
+
+    lv_mem_budget_free(&budget, p1, 60);
+    lv_mem_budget_free(&budget, p2, 40);
+    TEST_ASSERT_EQUAL_UINT32(0, budget.used);
+
+#ifdef LVGL_CI_USING_DEF_HEAP
+    /*Running out of the heap within the budget is not an error either*/
+    lv_mem_budget_init(&budget, UINT32_MAX);
+    TEST_ASSERT_NULL(lv_mem_budget_alloc(&budget, LV_MEM_SIZE + 16384));
+    TEST_ASSERT_EQUAL_UINT32(0, budget.used);
+#endif
+}
+
 #endif
@@ -131,9 +131,179 @@ void test_txt_next_line_should_handle_empty_string(void)
     lv_coord_t max_width = 0;
     lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
 
-    uint32_t next_line = _lv_text_get_next_line("", font_ptr, letter_space, max_width, NULL, flag);
+    uint32_t next_line = _lv_text_get_next_line("", 0, font_ptr, letter_space, max_width, NULL, flag);
 
     TEST_ASSERT_EQUAL_UINT32(0, next_line);
 }
 
+void test_txt_encoded_next_n_should_match_encoded_next(void)
+{
+    const char * text = "Long ASCII text, then \xC3\x81rv\xC3\xADzt\xC5\xB1r\xC5\x91 \xE4\xB8\xAD\xF0\x9F\x98\x80"
+                        "\xC3\x28 invalid bytes and ASCII again";
+    uint32_t len = strlen(text);
+    char buf[128];
+    uint32_t letters[16];
+    uint32_t letter_ofs[16];
+
+    /*Try all alignments and both with known and unknown end*/
+    uint32_t align;
+    for(align = 0; align < 8; align++) {
+        char * txt = &buf[align];
+        lv_memcpy(txt, text, len + 1);
+
+        uint32_t end;
+        for(end = 0; end < 2; end++) {
+            uint32_t i = 0;
+            uint32_t i_ref = 0;
+            while(txt[i_ref] != '\0') {
+                uint32_t cnt = _lv_text_encoded_next_n(txt, &i, end ? len : UINT32_MAX, letters, letter_ofs, 16);
+                TEST_ASSERT_GREATER_THAN_UINT32(0, cnt);
+
+                uint32_t k;
+                for(k = 0; k < cnt; k++) {
+                    TEST_ASSERT_EQUAL_UINT32(i_ref, letter_ofs[k]);
+                    TEST_ASSERT_EQUAL_UINT32(_lv_text_encoded_next(txt, &i_ref), letters[k]);
+                }
+                TEST_ASSERT_EQUAL_UINT32(i_ref, i);
+            }
+
+            /*Nothing to decode at the end*/
+            TEST_ASSERT_EQUAL_UINT32(0, _lv_text_encoded_next_n(txt, &i, UINT32_MAX, letters, NULL, 16));
+        }
+    }
+
+    /*Stop at `end`*/
+    uint32_t i = 0;
+    TEST_ASSERT_EQUAL_UINT32(4, _lv_text_encoded_next_n(text, &i, 4, letters, NULL, 16));
+    TEST_ASSERT_EQUAL_UINT32(4, i);
+
+    /*Stop at the '\0' of an ASCII text if the end is unknown*/
+    char * ascii = lv_malloc(12);
+    lv_strcpy(ascii, "0123456789A");
+    i = 0;
+    TEST_ASSERT_EQUAL_UINT32(11, _lv_text_encoded_next_n(ascii, &i, UINT32_MAX, letters, NULL, 16));
+    TEST_ASSERT_EQUAL_UINT32(11, i);
+    TEST_ASSERT_EQUAL_UINT32('A', letters[10]);
+    lv_free(ascii);
+}
+
+void test_txt_get_width_should_match_glyph_widths(void)
+{
+    /*With kerning, tab, letters not in the font and a letter from the fallback font*/
+    const char * text = "AVAWAY Tj\tTo, \xE4\xB8\xAD \xEF\x80\x8C long text to measure in more runs.";
+    lv_font_t font = lv_font_montserrat_14;
+    font.fallback = &lv_font_simsun_16_cjk;
+
+    uint32_t len;
+    for(len = 0; len <= strlen(text); len++) {
+        lv_coord_t width_ref = 0;
+        uint32_t i = 0;
+        while(i < len) {
+            uint32_t letter;
+            uint32_t letter_next;
+            _lv_text_encoded_letter_next_2(text, &letter, &letter_next, &i);
+            lv_coord_t w = lv_font_get_glyph_width(&font, letter, letter_next);
+            if(w > 0) width_ref += w + 3;
+        }
+        if(width_ref > 0) width_ref -= 3;
+
+        TEST_ASSERT_EQUAL_INT32(width_ref, lv_text_get_width(text, len, &font, 3));
+    }
+}
+
+void test_txt_next_line_should_not_depend_on_known_length(void)
+{
+    /*Long ASCII words for the 8 byte blocks, UTF-8 letters and line breaks in various positions*/
+    const char * text = "Lorem ipsum dolor sit amet, consectetur adipiscing \xC3\xA9lit.\nSed_do_eiusmod_tempor_"
+                        "incididunt ut labore et dolore magna \xE4\xB8\xAD aliqua.\n\nUt enim ad minim veniam";
+    const lv_font_t * font = &lv_font_montserrat_14;
+    uint32_t text_len = strlen(text);
+
+    lv_coord_t max_width;
+    for(max_width = 20; max_width <= 300; max_width += 7) {
+        uint32_t line_start = 0;
+        while(text[line_start] != '\0') {
+            lv_coord_t w_ref;
+            lv_coord_t w;
+            uint32_t len_ref = _lv_text_get_next_line(&text[line_start], UINT32_MAX, font, 1, max_width, &w_ref,
+                                                      LV_TEXT_FLAG_NONE);
+            uint32_t len = _lv_text_get_next_line(&text[line_start], text_len - line_start, font, 1, max_width, &w,
+                                                  LV_TEXT_FLAG_NONE);
+            TEST_ASSERT_EQUAL_UINT32(len_ref, len);
+            TEST_ASSERT_EQUAL_INT32(w_ref, w);
+            line_start += len;
+        }
+    }
+}
+
+void test_txt_layout_should_match_text_size(void)
+{
+    const char * text = "Lorem ipsum dolor sit amet,\nconsectetur adipiscing elit.\r\nCras malesuada ultrices magna.\n";
+    const lv_font_t * font = &lv_font_montserrat_14;
+    lv_text_layout_t layout;
+    lv_text_layout_init(&layout);
+    TEST_ASSERT_TRUE(lv_text_layout_update(&layout, text, font, 2, 3, 100, LV_TEXT_FLAG_NONE));
+
+    lv_point_t size;
+    lv_text_get_size(&size, text, font, 2, 3, 100, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL_INT32(size.x, layout.size.x);
+    TEST_ASSERT_EQUAL_INT32(size.y, layout.size.y);
+
+    /*The lines are wrapped the same way as `_lv_text_get_next_line` does*/
+    TEST_ASSERT_GREATER_THAN_UINT32(3, layout.line_cnt);
+    uint32_t line_start = 0;
+    uint32_t i;
+    for(i = 0; i < layout.line_cnt; i++) {
+        TEST_ASSERT_EQUAL_UINT32(line_start, layout.lines[i].start);
+        uint32_t len = _lv_text_get_next_line(&text[line_start], UINT32_MAX, font, 2, 100, NULL, LV_TEXT_FLAG_NONE);
+        TEST_ASSERT_EQUAL_INT32(lv_text_get_width(&text[line_start], len, font, 2), layout.lines[i].width);
+        line_start += len;
+    }
+    TEST_ASSERT_EQUAL_UINT32(strlen(text), line_start);
+    TEST_ASSERT_EQUAL_UINT32(line_start, layout.lines[layout.line_cnt].start);
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_text_layout_get_line_of_byte(&layout, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_text_layout_get_line_of_byte(&layout, layout.lines[1].start - 1));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_text_layout_get_line_of_byte(&layout, layout.lines[1].start));
+    TEST_ASSERT_EQUAL_UINT32(layout.line_cnt - 1, lv_text_layout_get_line_of_byte(&layout, strlen(text)));
+
+    /*Empty texts have no lines but they are one line tall*/
+    TEST_ASSERT_TRUE(lv_text_layout_update(&layout, "", font, 2, 3, 100, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL_UINT32(0, layout.line_cnt);
+    TEST_ASSERT_EQUAL_INT32(lv_font_get_line_height(font), layout.size.y);
+
+    lv_text_layout_free(&layout);
+}
+
+void test_txt_layout_should_be_reused_until_invalidated(void)
+{
+    char text[] = "Hello\nworld";
+    const lv_font_t * font = &lv_font_montserrat_14;
+    lv_text_layout_t layout;
+    lv_text_layout_init(&layout);
+    TEST_ASSERT_TRUE(lv_text_layout_update(&layout, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL_UINT32(2, layout.line_cnt);
+
+    /*The text is identified by its pointer, so a modification is noticed only after invalidating the layout*/
+    text[5] = ' ';
+    TEST_ASSERT_TRUE(lv_text_layout_update(&layout, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL_UINT32(2, layout.line_cnt);
+
+    lv_text_layout_invalidate(&layout);
+    TEST_ASSERT_FALSE(lv_text_layout_is_valid_for(&layout, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_TRUE(lv_text_layout_update(&layout, text, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_EQUAL_UINT32(1, layout.line_cnt);
+
+    /*Any change in the settings requires a new layout*/
+    TEST_ASSERT_FALSE(lv_text_layout_is_valid_for(&layout, text, font, 1, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_FALSE(lv_text_layout_is_valid_for(&layout, text, font, 0, 1, LV_COORD_MAX, LV_TEXT_FLAG_NONE));
+    TEST_ASSERT_FALSE(lv_text_layout_is_valid_for(&layout, text, font, 0, 0, 100, LV_TEXT_FLAG_NONE));
+
+    /*The width doesn't matter if the lines are not wrapped*/
+    TEST_ASSERT_TRUE(lv_text_layout_update(&layout, text, font, 0, 0, 10, LV_TEXT_FLAG_EXPAND));
+    TEST_ASSERT_TRUE(lv_text_layout_is_valid_for(&layout, text, font, 0, 0, 500, LV_TEXT_FLAG_EXPAND));
+
+    lv_text_layout_free(&layout);
+}
+
 #endif
@@ -577,4 +577,68 @@ void test_label_text_selection(void)
     TEST_ASSERT_EQUAL(selection_end, end);
 }
 
+void test_label_text_layout(void)
+{
+    lv_label_t * l = (lv_label_t *)long_label_multiline;
+    lv_obj_set_width(long_label_multiline, 150);
+    lv_refr_now(NULL);
+
+    /*The size and the letter positions come from the same layout*/
+    TEST_ASSERT_TRUE(l->layout->valid);
+    TEST_ASSERT_EQUAL_PTR(l->text, l->layout->text);
+    TEST_ASSERT_GREATER_THAN_UINT32(3, l->layout->line_cnt);
+    TEST_ASSERT_EQUAL_INT32(l->layout->size.y, lv_obj_get_content_height(long_label_multiline));
+
+    const lv_font_t * font = lv_obj_get_style_text_font(long_label_multiline, LV_PART_MAIN);
+    lv_point_t pos;
+    lv_label_get_letter_pos(long_label_multiline, l->layout->lines[2].start, &pos);
+    TEST_ASSERT_EQUAL_INT32(0, pos.x);
+    TEST_ASSERT_EQUAL_INT32(2 * lv_font_get_line_height(font), pos.y);
+
+    /*Changing a style updates the layout*/
+    lv_obj_set_style_text_line_space(long_label_multiline, 5, LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_INT32(5, l->layout->line_space);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(l->layout->size.y, lv_obj_get_content_height(long_label_multiline));
+    lv_label_get_letter_pos(long_label_multiline, l->layout->lines[2].start, &pos);
+    TEST_ASSERT_EQUAL_INT32(2 * (lv_font_get_line_height(font) + 5), pos.y);
+}
+
+void test_label_text_layout_advances(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    lv_label_set_text(label, "AVA Wave\nTo");
+    lv_obj_set_style_text_letter_space(label, 3, LV_PART_MAIN);
+
+    /*The layout is allocated only when it's needed*/
+    TEST_ASSERT_NULL(l->layout);
+
+    const lv_font_t * font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_point_t pos;
+    lv_label_get_letter_pos(label, 5, &pos);
+    TEST_ASSERT_NOT_NULL(l->layout);
+    TEST_ASSERT_NOT_NULL(l->layout->advances);
+
+    /*The letter widths give the same position as measuring the text*/
+    TEST_ASSERT_EQUAL_INT32(lv_text_get_width(l->text, 5, font, 3) + 3, pos.x);
+    TEST_ASSERT_EQUAL_INT32(lv_text_get_width(l->text, 8, font, 3), l->layout->lines[0].width);
+
+    /*The letters are found at their positions*/
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_label_get_letter_pos(label, i, &pos);
+        pos.x += 1;
+        pos.y += 1;
+        TEST_ASSERT_EQUAL_UINT32(i, lv_label_get_letter_on(label, &pos));
+        TEST_ASSERT_TRUE(lv_label_is_char_under_pos(label, &pos));
+    }
+
+    /*The letter widths are measured again for a new text*/
+    lv_label_set_text(label, "Hello");
+    lv_label_get_letter_pos(label, 3, &pos);
+    TEST_ASSERT_EQUAL_PTR(l->text, l->layout->text);
+    TEST_ASSERT_NOT_NULL(l->layout->advances);
+    TEST_ASSERT_EQUAL_INT32(lv_text_get_width(l->text, 3, font, 3) + 3, pos.x);
+}
+
 #endif
@@ -68,6 +68,13 @@ bool lv_test_assert_image_eq(const char * fn_ref)
     char fn_ref_full[512];
     sprintf(fn_ref_full, "%s%s", REF_IMGS_PATH, fn_ref);
 
+#ifdef LV_TEST_REF_IMGS_VARIANT
+    /*Use the reference image of the configuration if it renders the screen differently*/
+    char fn_variant_full[512];
+    sprintf(fn_variant_full, "%s%s/%s", REF_IMGS_PATH, LV_TEST_REF_IMGS_VARIANT, fn_ref);
+    if(access(fn_variant_full, F_OK) == 0) strcpy(fn_ref_full, fn_variant_full);
+#endif
+
 
     //lv_obj_invalidate(lv_scr_act());
     lv_refr_now(NULL);